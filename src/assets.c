@@ -2,26 +2,53 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
+#include <limits.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <dirent.h>
 
+// WAVE format tags
+#define WAV_FORMAT_PCM 0x0001
+#define WAV_FORMAT_FLOAT 0x0003
+#define WAV_FORMAT_EXTENSIBLE 0xFFFE
+
+// What the fmt and data chunks say about one file
+typedef struct {
+    int format;
+    int channels;
+    unsigned int rate;
+    int bits;
+    int block_align;
+    long data_offset;
+    size_t data_bytes;
+} wav_info_t;
+
+typedef struct {
+    char name[64];               // File name, built-in or in ASSETS_OVERRIDE_DIR
+    const int16_t *pcm;          // Built-in table or slice of the arena
+    size_t frames;
+    bool overridden;             // Loaded from the override directory
+} sound_entry_t;
+
+static struct {
+    int16_t *arena;              // Override sounds back to back, stereo frames
+    size_t arena_bytes;
+    bool mapped;
+    sound_entry_t entries[ASSETS_MAX_SOUNDS];
+    int count;
+} sound_bank;
+
 int assets_init(void) {
     struct stat st = {0};
     
-    // Check if assets directory exists
-    if (stat(ASSETS_BASE_DIR, &st) == -1) {
-        printf("❌ Assets directory not found: %s\n", ASSETS_BASE_DIR);
-        return -1;
-    }
+    printf("✅ %d built-in sounds\n", assets_embedded_count);
     
-    // Check if sounds directory exists
-    if (stat(SOUNDS_DIR, &st) == -1) {
-        printf("❌ Sounds directory not found: %s\n", SOUNDS_DIR);
-        return -1;
+    // The override directory is optional
+    if (stat(ASSETS_OVERRIDE_DIR, &st) == 0 && S_ISDIR(st.st_mode)) {
+        printf("📁 Sound overrides from %s\n", ASSETS_OVERRIDE_DIR);
     }
-    
-    printf("✅ Assets directory initialized successfully\n");
     return 0;
 }
 
@@ -29,31 +56,398 @@ bool assets_file_exists(const char *asset_path) {
     return access(asset_path, F_OK) == 0;
 }
 
+// Absolute paths are kept, anything else is taken from the override directory
 int assets_get_full_path(const char *asset_path, char *full_path, size_t path_size) {
-    char cwd[256];
-    if (getcwd(cwd, sizeof(cwd)) == NULL) {
-        return -1;
+    if (asset_path[0] == '/') {
+        snprintf(full_path, path_size, "%s", asset_path);
+    } else {
+        snprintf(full_path, path_size, "%s/%s", ASSETS_OVERRIDE_DIR, asset_path);
     }
-    
-    snprintf(full_path, path_size, "%s/%s", cwd, asset_path);
     return assets_file_exists(full_path) ? 0 : -1;
 }
 
 void assets_list_available(void) {
     printf("📁 Available audio assets:\n");
     
-    DIR *dir = opendir(SOUNDS_DIR);
-    if (dir == NULL) {
-        printf("❌ Cannot open sounds directory\n");
-        return;
+    for (int i = 0; i < sound_bank.count; i++) {
+        printf("  🔊 %s%s\n", sound_bank.entries[i].name,
+               sound_bank.entries[i].overridden ? " (override)" : "");
+    }
+}
+
+static unsigned int read_le16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned int read_le32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+// Walk the RIFF chunks: fmt and data are used, LIST/INFO and anything else
+// is skipped (chunks are word aligned)
+static int assets_parse_wav(FILE *file, const char *path, wav_info_t *info) {
+    uint8_t header[12];
+    memset(info, 0, sizeof(wav_info_t));
+    
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+        printf("❌ Not a RIFF/WAVE file: %s\n", path);
+        return -1;
+    }
+    
+    fseek(file, 0, SEEK_END);
+    long file_size = ftell(file);
+    fseek(file, sizeof(header), SEEK_SET);
+    
+    uint8_t chunk[8];
+    while (fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk)) {
+        unsigned int size = read_le32(chunk + 4);
+        long body = ftell(file);
+    
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            uint8_t fmt[40] = {0};
+            if (size < 16 || fread(fmt, 1, size < sizeof(fmt) ? size : sizeof(fmt), file) < 16) {
+                break;
+            }
+            info->format = read_le16(fmt);
+            info->channels = read_le16(fmt + 2);
+            info->rate = read_le32(fmt + 4);
+            info->block_align = read_le16(fmt + 12);
+            info->bits = read_le16(fmt + 14);
+            if (info->format == WAV_FORMAT_EXTENSIBLE && size >= 26) {
+                info->format = read_le16(fmt + 24); // Sub-format GUID starts with the tag
+            }
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            info->data_offset = body;
+            info->data_bytes = size;
+            if (body + (long)size > file_size) {
+                info->data_bytes = file_size - body; // Truncated or streamed (size unknown)
+            }
+        }
+    
+        if (info->data_offset && info->rate) {
+            break;
+        }
+        fseek(file, body + size + (size & 1), SEEK_SET);
+    }
+    
+    bool supported = (info->format == WAV_FORMAT_PCM &&
+                      (info->bits == 8 || info->bits == 16 || info->bits == 24 || info->bits == 32)) ||
+                     (info->format == WAV_FORMAT_FLOAT && info->bits == 32);
+    
+    if (!info->data_offset || !info->rate || info->channels < 1 ||
+        info->block_align < info->channels * info->bits / 8 || !supported) {
+        printf("❌ Unsupported WAV layout in %s (format %d, %d ch, %u Hz, %d bit)\n",
+               path, info->format, info->channels, info->rate, info->bits);
+        return -1;
+    }
+    return 0;
+}
+
+// One source sample as 16-bit
+static int16_t wav_sample(const wav_info_t *info, const uint8_t *p) {
+    switch (info->bits) {
+        case 8:
+            return (int16_t)((p[0] - 128) * 256);
+        case 16:
+            return (int16_t)read_le16(p);
+        case 24:
+            return (int16_t)(p[1] | (p[2] << 8));
+        default:
+            if (info->format == WAV_FORMAT_FLOAT) {
+                float value;
+                memcpy(&value, p, sizeof(value));
+                value = value > 1.0f ? 1.0f : (value < -1.0f ? -1.0f : value);
+                return (int16_t)(value * 32767.0f);
+            }
+            return (int16_t)(read_le32(p) >> 16);
+    }
+}
+
+static size_t wav_source_frames(const wav_info_t *info) {
+    return info->data_bytes / info->block_align;
+}
+
+static size_t wav_output_frames(const wav_info_t *info) {
+    size_t frames = wav_source_frames(info);
+    return (size_t)(((uint64_t)frames * ASSETS_SOUND_RATE + info->rate - 1) / info->rate);
+}
+
+// Convert to stereo at ASSETS_SOUND_RATE: mono is duplicated, extra
+// channels dropped, other rates linearly interpolated
+static void wav_convert(const wav_info_t *info, const uint8_t *data, int16_t *out, size_t out_frames) {
+    size_t src_frames = wav_source_frames(info);
+    int sample_bytes = info->bits / 8;
+    
+    for (size_t i = 0; i < out_frames; i++) {
+        uint64_t pos = (uint64_t)i * info->rate;
+        size_t index = pos / ASSETS_SOUND_RATE;
+        float frac = (float)(pos % ASSETS_SOUND_RATE) / ASSETS_SOUND_RATE;
+        size_t next = index + 1 < src_frames ? index + 1 : index;
+    
+        for (int ch = 0; ch < 2; ch++) {
+            int src_ch = ch < info->channels ? ch : info->channels - 1;
+            int16_t a = wav_sample(info, data + index * info->block_align + src_ch * sample_bytes);
+            int16_t b = wav_sample(info, data + next * info->block_align + src_ch * sample_bytes);
+            out[i * 2 + ch] = (int16_t)(a + (b - a) * frac);
+        }
+    }
+}
+
+// Read the data chunk and convert it into out (wav_output_frames long)
+static int wav_decode_into(FILE *file, const wav_info_t *info, int16_t *out) {
+    uint8_t *data = malloc(info->data_bytes);
+    if (!data) {
+        return -1;
+    }
+    
+    fseek(file, info->data_offset, SEEK_SET);
+    size_t got = fread(data, 1, info->data_bytes, file);
+    if (got < info->data_bytes) {
+        memset(data + got, 0, info->data_bytes - got);
     }
     
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL) {
-        if (strstr(entry->d_name, ".wav") != NULL) {
-            printf("  🔊 %s\n", entry->d_name);
+    wav_convert(info, data, out, wav_output_frames(info));
+    free(data);
+    return 0;
+}
+
+// Decode any WAV into a new buffer in the output format (caller frees)
+int16_t *assets_decode_wav(const char *path, size_t *frames) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        printf("❌ Failed to open WAV file: %s\n", path);
+        return NULL;
+    }
+    
+    wav_info_t info;
+    int16_t *pcm = NULL;
+    if (assets_parse_wav(file, path, &info) == 0 && wav_source_frames(&info) > 0) {
+        *frames = wav_output_frames(&info);
+        pcm = malloc(*frames * 2 * sizeof(int16_t));
+        if (pcm && wav_decode_into(file, &info, pcm) != 0) {
+            free(pcm);
+            pcm = NULL;
         }
     }
     
-    closedir(dir);
+    fclose(file);
+    return pcm;
+}
+
+// A WAV from the override directory, before it has a place in the arena
+typedef struct {
+    char name[64];
+    wav_info_t info;
+    size_t offset;
+    int slot;                    // Bank entry it replaces or adds
+} sound_override_t;
+
+static int compare_overrides(const void *a, const void *b) {
+    return strcmp(((const sound_override_t *)a)->name, ((const sound_override_t *)b)->name);
+}
+
+// Full path of an override; false if it does not fit
+static bool override_path(char *path, size_t size, const char *name) {
+    int len = snprintf(path, size, "%s/%s", ASSETS_OVERRIDE_DIR, name);
+    return len >= 0 && (size_t)len < size;
+}
+
+static int find_entry(const char *name) {
+    for (int i = 0; i < sound_bank.count; i++) {
+        if (strcmp(sound_bank.entries[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Fill the bank from the built-in tables, then let ASSETS_OVERRIDE_DIR
+// replace or add sounds. Overrides are converted into one arena; with
+// use_mmap it is an anonymous mapping made read-only, and the whole bank
+// (built-in tables included) is locked in RAM so no sound ever faults in
+// from storage.
+int assets_load_sound_bank(bool use_mmap) {
+    assets_free_sound_bank();
+    
+    // Built-in sounds are already converted: used in place
+    for (int i = 0; i < assets_embedded_count && sound_bank.count < ASSETS_MAX_SOUNDS; i++) {
+        sound_entry_t *entry = &sound_bank.entries[sound_bank.count++];
+        snprintf(entry->name, sizeof(entry->name), "%s", assets_embedded_sounds[i].name);
+        entry->pcm = assets_embedded_sounds[i].pcm;
+        entry->frames = assets_embedded_sounds[i].frames;
+    }
+    
+    // Pass 1: override headers only, to size the arena
+    sound_override_t overrides[ASSETS_MAX_SOUNDS];
+    int override_count = 0;
+    size_t total_frames = 0;
+    
+    DIR *dir = opendir(ASSETS_OVERRIDE_DIR);
+    if (dir != NULL) {
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL && override_count < ASSETS_MAX_SOUNDS) {
+            const char *ext = strrchr(entry->d_name, '.');
+            if (!ext || strcasecmp(ext, ".wav") != 0 || strlen(entry->d_name) >= sizeof(overrides[0].name)) {
+                continue;
+            }
+            snprintf(overrides[override_count].name, sizeof(overrides[0].name), "%s", entry->d_name);
+            override_count++;
+        }
+        closedir(dir);
+    }
+    
+    // Stable handles regardless of directory order
+    qsort(overrides, override_count, sizeof(sound_override_t), compare_overrides);
+    
+    int kept = 0;
+    for (int i = 0; i < override_count; i++) {
+        char path[PATH_MAX];
+        if (!override_path(path, sizeof(path), overrides[i].name)) {
+            printf("⚠️  Path too long, ignoring %s\n", overrides[i].name);
+            continue;
+        }
+    
+        int slot = find_entry(overrides[i].name);
+        if (slot < 0 && sound_bank.count >= ASSETS_MAX_SOUNDS) {
+            printf("⚠️  Sound bank full, ignoring %s\n", path);
+            continue;
+        }
+    
+        FILE *file = fopen(path, "rb");
+        if (!file || assets_parse_wav(file, path, &overrides[i].info) != 0) {
+            if (file) {
+                fclose(file);
+            }
+            continue;
+        }
+        fclose(file);
+    
+        if (wav_output_frames(&overrides[i].info) == 0) {
+            printf("⚠️  Empty sound ignored: %s\n", path);
+            continue;
+        }
+        if (slot < 0) {
+            slot = sound_bank.count++;
+            memcpy(sound_bank.entries[slot].name, overrides[i].name, sizeof(sound_bank.entries[0].name));
+        }
+        overrides[kept] = overrides[i];
+        overrides[kept].slot = slot;
+        overrides[kept].offset = total_frames;
+        total_frames += wav_output_frames(&overrides[i].info);
+        kept++;
+    }
+    override_count = kept;
+    
+    if (total_frames > 0) {
+        sound_bank.arena_bytes = total_frames * 2 * sizeof(int16_t);
+        if (use_mmap) {
+            void *map = mmap(NULL, sound_bank.arena_bytes, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (map != MAP_FAILED) {
+                sound_bank.arena = map;
+                sound_bank.mapped = true;
+            }
+        }
+        if (!sound_bank.arena) {
+            sound_bank.arena = malloc(sound_bank.arena_bytes);
+        }
+        if (!sound_bank.arena) {
+            printf("❌ Failed to allocate %zu KB for sound overrides\n", sound_bank.arena_bytes / 1024);
+            sound_bank.arena_bytes = 0;
+            override_count = 0;
+        }
+    }
+    
+    // Pass 2: decode each override straight into its slice of the arena
+    for (int i = 0; i < override_count; i++) {
+        char path[PATH_MAX];
+        bool named = override_path(path, sizeof(path), overrides[i].name);  // Checked in pass 1
+    
+        sound_entry_t *entry = &sound_bank.entries[overrides[i].slot];
+        int16_t *out = sound_bank.arena + overrides[i].offset * 2;
+        entry->frames = wav_output_frames(&overrides[i].info);
+        entry->pcm = out;
+        entry->overridden = true;
+    
+        FILE *file = named ? fopen(path, "rb") : NULL;
+        if (!file || wav_decode_into(file, &overrides[i].info, out) != 0) {
+            memset(out, 0, entry->frames * 2 * sizeof(int16_t));
+        }
+        if (file) {
+            fclose(file);
+        }
+    
+        printf("  🔊 [%d] %s: %u Hz %d ch %d bit -> %zu frames (override)\n", overrides[i].slot, entry->name,
+               overrides[i].info.rate, overrides[i].info.channels, overrides[i].info.bits, entry->frames);
+    }
+    
+    // Drop the sounds whose override failed to load; built-in ones stay
+    kept = 0;
+    for (int i = 0; i < sound_bank.count; i++) {
+        if (sound_bank.entries[i].pcm) {
+            sound_bank.entries[kept++] = sound_bank.entries[i];
+        }
+    }
+    sound_bank.count = kept;
+    
+    if (sound_bank.mapped) {
+        mprotect(sound_bank.arena, sound_bank.arena_bytes, PROT_READ);
+    }
+    if (use_mmap) {
+        // Never paged out: the built-in tables live in the executable's
+        // read-only data and would otherwise be faulted in on first play
+        bool locked = true;
+        for (int i = 0; i < sound_bank.count; i++) {
+            if (mlock(sound_bank.entries[i].pcm, sound_bank.entries[i].frames * 2 * sizeof(int16_t)) != 0) {
+                locked = false;
+            }
+        }
+        if (!locked) {
+            printf("⚠️  Sound bank not locked in RAM\n");
+        }
+    }
+    
+    size_t bank_frames = 0;
+    for (int i = 0; i < sound_bank.count; i++) {
+        bank_frames += sound_bank.entries[i].frames;
+    }
+    printf("✅ Sound bank: %d sounds (%d overridden), %zu KB%s\n", sound_bank.count, override_count,
+           bank_frames * 4 / 1024, sound_bank.mapped ? " (mmap)" : "");
+    return 0;
+}
+
+// Nothing may still be playing from the bank
+void assets_free_sound_bank(void) {
+    if (sound_bank.arena) {
+        if (sound_bank.mapped) {
+            munmap(sound_bank.arena, sound_bank.arena_bytes);
+        } else {
+            free(sound_bank.arena);
+        }
+    }
+    memset(&sound_bank, 0, sizeof(sound_bank));
+}
+
+// Handle of a loaded sound, by asset path or file name
+sound_handle_t assets_sound_handle(const char *asset_path) {
+    if (!asset_path) {
+        return SOUND_HANDLE_INVALID;
+    }
+    
+    const char *name = strrchr(asset_path, '/');
+    name = name ? name + 1 : asset_path;
+    
+    int index = find_entry(name);
+    return index >= 0 ? index : SOUND_HANDLE_INVALID;
+}
+
+// Converted PCM of a loaded sound (16-bit stereo at ASSETS_SOUND_RATE)
+const int16_t *assets_sound_pcm(sound_handle_t handle, size_t *frames) {
+    if (handle < 0 || handle >= sound_bank.count) {
+        return NULL;
+    }
+    
+    *frames = sound_bank.entries[handle].frames;
+    return sound_bank.entries[handle].pcm;
 }
@@ -3,14 +3,46 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
-// Asset paths
-#define ASSETS_BASE_DIR "./assets"
-#define SOUNDS_DIR ASSETS_BASE_DIR "/sounds"
+// Sounds are built into the binary (tools/embed_sounds converts
+// assets/sounds at build time). WAVs in the override directory replace the
+// built-in sound of the same name or add new ones; the directory is
+// optional and must be absolute, so the working directory never matters.
+#ifndef ASSETS_OVERRIDE_DIR
+#define ASSETS_OVERRIDE_DIR "/etc/cdplayer/sounds"
+#endif
+
+// Settings and measurements kept between runs (latency profiles, the DSP
+// chain, the loudness cache). Absolute for the same reason; created on
+// the first save.
+#ifndef CDPLAYER_CONFIG_DIR
+#define CDPLAYER_CONFIG_DIR "/var/lib/cdplayer"
+#endif
+
+// Sound names (looked up by file name, built-in or overridden)
+#define BT_CONNECT_SOUND "bt_connect.wav"
+#define BT_DISCONNECT_SOUND "bt_disconnect.wav"
+#define ERROR_SOUND "error_beep.wav"
 
-#define BT_CONNECT_SOUND SOUNDS_DIR "/bt_connect.wav"
-#define BT_DISCONNECT_SOUND SOUNDS_DIR "/bt_disconnect.wav"
-#define ERROR_SOUND SOUNDS_DIR "/error_beep.wav"
+// Sound bank: the built-in tables plus every WAV in the override directory,
+// converted to the output format (16-bit stereo at ASSETS_SOUND_RATE) once
+// at startup. Read-only once loaded, so any thread may use the handles.
+#define ASSETS_SOUND_RATE 44100
+#define ASSETS_MAX_SOUNDS 32
+
+typedef struct {
+    const char *name;
+    const int16_t *pcm;          // Interleaved stereo at ASSETS_SOUND_RATE
+    size_t frames;
+} embedded_sound_t;
+
+// Generated index (src/assets_embedded.c)
+extern const embedded_sound_t assets_embedded_sounds[];
+extern const int assets_embedded_count;
+
+typedef int sound_handle_t;
+#define SOUND_HANDLE_INVALID (-1)
 
 // Asset management functions
 int assets_init(void);
@@ -18,4 +50,11 @@ bool assets_file_exists(const char *asset_path);
 int assets_get_full_path(const char *asset_path, char *full_path, size_t path_size);
 void assets_list_available(void);
 
+// Sound bank functions
+int assets_load_sound_bank(bool use_mmap);
+void assets_free_sound_bank(void);
+sound_handle_t assets_sound_handle(const char *asset_path);
+const int16_t *assets_sound_pcm(sound_handle_t handle, size_t *frames);
+int16_t *assets_decode_wav(const char *path, size_t *frames);
+
 #endif
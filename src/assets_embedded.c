@@ -0,0 +1,15538 @@
+// Generated by tools/embed_sounds from assets/sounds - do not edit.
+// 16-bit stereo PCM at 44100 Hz, sorted by file name.
+
+#include "assets.h"
+
+// bt_connect.wav: 93140 frames
+static const int16_t sound_bt_connect_wav[186280] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, -1, -1, 0, 0, 1, 1,
+    2, 2, 2, 2, 1, 1, 0, 0, 0, 0, 1, 1,
+    2, 2, 2, 2, 0, 0, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, 0, 0,
+    1, 1, 1, 1, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 2, 2, 0, 0, -1, -1, -1, -1,
+    1, 1, 1, 1, 0, 0, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 1, 1, 0, 0, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2,
+    1, 1, -1, -1, -1, -1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1,
+    -1, -1, 1, 1, 2, 2, 1, 1, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 2, 2, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 1, 1, 2, 2, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    0, 0, 1, 1, 1, 1, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 0, 0, -1, -1,
+    -1, -1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 2, 2, 1, 1, 1, 1,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
+    2, 2, 2, 2, 3, 3, 4, 4, 4, 4, 3, 3,
+    3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5,
+    5, 5, 4, 4, 3, 3, 3, 3, 5, 5, 7, 7,
+    6, 6, 4, 4, 3, 3, 4, 4, 6, 6, 5, 5,
+    5, 5, 6, 6, 7, 7, 8, 8, 7, 7, 7, 7,
+    7, 7, 7, 7, 9, 9, 9, 9, 6, 6, 5, 5,
+    6, 6, 7, 7, 8, 8, 8, 8, 7, 7, 7, 7,
+    8, 8, 7, 7, 7, 7, 8, 8, 9, 9, 10, 10,
+    10, 10, 9, 9, 8, 8, 9, 9, 12, 12, 12, 12,
+    11, 11, 10, 10, 11, 11, 12, 12, 13, 13, 13, 13,
+    13, 13, 13, 13, 14, 14, 16, 16, 17, 17, 17, 17,
+    17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 22, 22,
+    24, 24, 23, 23, 20, 20, 18, 18, 19, 19, 21, 21,
+    22, 22, 23, 23, 24, 24, 23, 23, 21, 21, 21, 21,
+    23, 23, 25, 25, 24, 24, 22, 22, 20, 20, 20, 20,
+    20, 20, 20, 20, 18, 18, 17, 17, 18, 18, 20, 20,
+    23, 23, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24,
+    22, 22, 19, 19, 16, 16, 17, 17, 18, 18, 16, 16,
+    11, 11, 8, 8, 8, 8, 9, 9, 9, 9, 5, 5,
+    1, 1, 1, 1, 2, 2, -1, -1, -4, -4, -7, -7,
+    -9, -9, -10, -10, -12, -12, -14, -14, -14, -14, -14, -14,
+    -13, -13, -12, -12, -13, -13, -14, -14, -15, -15, -14, -14,
+    -12, -12, -11, -11, -13, -13, -14, -14, -15, -15, -17, -17,
+    -19, -19, -21, -21, -21, -21, -21, -21, -22, -22, -22, -22,
+    -23, -23, -26, -26, -29, -29, -31, -31, -33, -33, -34, -34,
+    -37, -37, -38, -38, -35, -35, -35, -35, -40, -40, -43, -43,
+    -41, -41, -39, -39, -40, -40, -43, -43, -44, -44, -42, -42,
+    -40, -40, -41, -41, -43, -43, -43, -43, -42, -42, -40, -40,
+    -39, -39, -42, -42, -46, -46, -46, -46, -43, -43, -41, -41,
+    -42, -42, -45, -45, -44, -44, -40, -40, -38, -38, -38, -38,
+    -36, -36, -32, -32, -30, -30, -30, -30, -30, -30, -26, -26,
+    -22, -22, -19, -19, -17, -17, -16, -16, -15, -15, -15, -15,
+    -14, -14, -12, -12, -10, -10, -6, -6, -2, -2, -1, -1,
+    -2, -2, -1, -1, 2, 2, 7, 7, 10, 10, 10, 10,
+    12, 12, 15, 15, 19, 19, 22, 22, 25, 25, 25, 25,
+    27, 27, 31, 31, 37, 37, 42, 42, 45, 45, 48, 48,
+    52, 52, 56, 56, 58, 58, 61, 61, 65, 65, 69, 69,
+    71, 71, 72, 72, 75, 75, 80, 80, 84, 84, 85, 85,
+    85, 85, 87, 87, 91, 91, 95, 95, 98, 98, 100, 100,
+    102, 102, 105, 105, 105, 105, 106, 106, 108, 108, 111, 111,
+    114, 114, 117, 117, 122, 122, 125, 125, 123, 123, 120, 120,
+    121, 121, 126, 126, 128, 128, 127, 127, 125, 125, 125, 125,
+    124, 124, 121, 121, 119, 119, 118, 118, 117, 117, 116, 116,
+    115, 115, 114, 114, 110, 110, 105, 105, 102, 102, 99, 99,
+    96, 96, 91, 91, 87, 87, 84, 84, 78, 78, 74, 74,
+    73, 73, 71, 71, 66, 66, 61, 61, 56, 56, 53, 53,
+    48, 48, 42, 42, 37, 37, 32, 32, 27, 27, 24, 24,
+    19, 19, 11, 11, 2, 2, -6, -6, -9, -9, -12, -12,
+    -20, -20, -30, -30, -37, -37, -42, -42, -47, -47, -54, -54,
+    -62, -62, -68, -68, -73, -73, -78, -78, -85, -85, -93, -93,
+    -101, -101, -107, -107, -111, -111, -116, -116, -122, -122, -127, -127,
+    -130, -130, -136, -136, -146, -146, -156, -156, -159, -159, -159, -159,
+    -164, -164, -175, -175, -181, -181, -180, -180, -181, -181, -186, -186,
+    -194, -194, -200, -200, -202, -202, -202, -202, -205, -205, -211, -211,
+    -218, -218, -223, -223, -223, -223, -223, -223, -228, -228, -234, -234,
+    -235, -235, -232, -232, -229, -229, -231, -231, -236, -236, -239, -239,
+    -239, -239, -240, -240, -242, -242, -244, -244, -245, -245, -243, -243,
+    -243, -243, -247, -247, -252, -252, -254, -254, -252, -252, -246, -246,
+    -243, -243, -245, -245, -247, -247, -245, -245, -245, -245, -247, -247,
+    -247, -247, -243, -243, -237, -237, -233, -233, -231, -231, -229, -229,
+    -228, -228, -227, -227, -224, -224, -218, -218, -212, -212, -208, -208,
+    -204, -204, -198, -198, -194, -194, -195, -195, -194, -194, -188, -188,
+    -177, -177, -169, -169, -165, -165, -162, -162, -158, -158, -152, -152,
+    -144, -144, -136, -136, -131, -131, -128, -128, -121, -121, -111, -111,
+    -103, -103, -99, -99, -94, -94, -84, -84, -73, -73, -68, -68,
+    -64, -64, -55, -55, -42, -42, -33, -33, -27, -27, -21, -21,
+    -10, -10, 2, 2, 9, 9, 17, 17, 29, 29, 41, 41,
+    50, 50, 57, 57, 66, 66, 77, 77, 87, 87, 97, 97,
+    108, 108, 119, 119, 128, 128, 135, 135, 144, 144, 152, 152,
+    158, 158, 165, 165, 176, 176, 187, 187, 195, 195, 201, 201,
+    208, 208, 216, 216, 221, 221, 225, 225, 235, 235, 246, 246,
+    253, 253, 254, 254, 258, 258, 267, 267, 273, 273, 277, 277,
+    282, 282, 288, 288, 296, 296, 301, 301, 302, 302, 306, 306,
+    311, 311, 315, 315, 318, 318, 320, 320, 320, 320, 322, 322,
+    327, 327, 332, 332, 332, 332, 327, 327, 324, 324, 324, 324,
+    325, 325, 325, 325, 324, 324, 324, 324, 320, 320, 312, 312,
+    304, 304, 301, 301, 301, 301, 299, 299, 295, 295, 291, 291,
+    286, 286, 280, 280, 273, 273, 264, 264, 257, 257, 250, 250,
+    243, 243, 239, 239, 234, 234, 224, 224, 209, 209, 195, 195,
+    186, 186, 180, 180, 171, 171, 159, 159, 145, 145, 131, 131,
+    118, 118, 105, 105, 90, 90, 73, 73, 56, 56, 42, 42,
+    30, 30, 14, 14, -7, -7, -29, -29, -44, -44, -59, -59,
+    -81, -81, -107, -107, -128, -128, -146, -146, -164, -164, -184, -184,
+    -207, -207, -229, -229, -250, -250, -269, -269, -287, -287, -308, -308,
+    -333, -333, -355, -355, -372, -372, -390, -390, -416, -416, -445, -445,
+    -467, -467, -484, -484, -503, -503, -524, -524, -543, -543, -562, -562,
+    -583, -583, -605, -605, -625, -625, -640, -640, -656, -656, -675, -675,
+    -694, -694, -712, -712, -727, -727, -741, -741, -756, -756, -772, -772,
+    -789, -789, -803, -803, -811, -811, -818, -818, -829, -829, -841, -841,
+    -849, -849, -851, -851, -854, -854, -860, -860, -865, -865, -867, -867,
+    -866, -866, -865, -865, -863, -863, -861, -861, -859, -859, -854, -854,
+    -846, -846, -837, -837, -828, -828, -820, -820, -811, -811, -800, -800,
+    -789, -789, -776, -776, -761, -761, -744, -744, -726, -726, -707, -707,
+    -684, -684, -660, -660, -638, -638, -617, -617, -594, -594, -570, -570,
+    -545, -545, -519, -519, -490, -490, -461, -461, -434, -434, -405, -405,
+    -371, -371, -337, -337, -311, -311, -286, -286, -254, -254, -215, -215,
+    -177, -177, -147, -147, -117, -117, -84, -84, -52, -52, -22, -22,
+    10, 10, 45, 45, 81, 81, 116, 116, 152, 152, 187, 187,
+    217, 217, 245, 245, 276, 276, 310, 310, 347, 347, 380, 380,
+    408, 408, 436, 436, 467, 467, 497, 497, 527, 527, 554, 554,
+    583, 583, 612, 612, 641, 641, 667, 667, 693, 693, 719, 719,
+    747, 747, 770, 770, 789, 789, 810, 810, 835, 835, 861, 861,
+    883, 883, 900, 900, 917, 917, 939, 939, 960, 960, 977, 977,
+    991, 991, 1003, 1003, 1017, 1017, 1033, 1033, 1049, 1049, 1063, 1063,
+    1072, 1072, 1076, 1076, 1081, 1081, 1090, 1090, 1097, 1097, 1102, 1102,
+    1106, 1106, 1110, 1110, 1114, 1114, 1114, 1114, 1110, 1110, 1107, 1107,
+    1104, 1104, 1099, 1099, 1092, 1092, 1086, 1086, 1081, 1081, 1069, 1069,
+    1052, 1052, 1036, 1036, 1024, 1024, 1013, 1013, 997, 997, 979, 979,
+    963, 963, 948, 948, 930, 930, 908, 908, 885, 885, 864, 864,
+    843, 843, 823, 823, 801, 801, 772, 772, 742, 742, 716, 716,
+    693, 693, 666, 666, 633, 633, 600, 600, 570, 570, 540, 540,
+    506, 506, 472, 472, 440, 440, 407, 407, 371, 371, 334, 334,
+    301, 301, 267, 267, 227, 227, 185, 185, 149, 149, 114, 114,
+    75, 75, 34, 34, -6, -6, -45, -45, -87, -87, -130, -130,
+    -167, -167, -202, -202, -241, -241, -284, -284, -325, -325, -362, -362,
+    -401, -401, -443, -443, -486, -486, -523, -523, -561, -561, -600, -600,
+    -640, -640, -680, -680, -722, -722, -765, -765, -801, -801, -831, -831,
+    -864, -864, -905, -905, -948, -948, -986, -986, -1018, -1018, -1049, -1049,
+    -1085, -1085, -1123, -1123, -1154, -1154, -1177, -1177, -1200, -1200, -1228, -1228,
+    -1261, -1261, -1289, -1289, -1312, -1312, -1333, -1333, -1358, -1358, -1381, -1381,
+    -1398, -1398, -1412, -1412, -1429, -1429, -1451, -1451, -1473, -1473, -1489, -1489,
+    -1500, -1500, -1508, -1508, -1517, -1517, -1526, -1526, -1533, -1533, -1538, -1538,
+    -1540, -1540, -1542, -1542, -1546, -1546, -1548, -1548, -1544, -1544, -1536, -1536,
+    -1526, -1526, -1513, -1513, -1498, -1498, -1480, -1480, -1463, -1463, -1446, -1446,
+    -1423, -1423, -1392, -1392, -1357, -1357, -1325, -1325, -1293, -1293, -1258, -1258,
+    -1220, -1220, -1182, -1182, -1144, -1144, -1102, -1102, -1057, -1057, -1011, -1011,
+    -966, -966, -923, -923, -878, -878, -830, -830, -779, -779, -729, -729,
+    -686, -686, -643, -643, -594, -594, -542, -542, -493, -493, -451, -451,
+    -409, -409, -358, -358, -299, -299, -241, -241, -187, -187, -135, -135,
+    -82, -82, -28, -28, 25, 25, 79, 79, 133, 133, 186, 186,
+    238, 238, 289, 289, 336, 336, 376, 376, 419, 419, 470, 470,
+    524, 524, 570, 570, 604, 604, 639, 639, 680, 680, 725, 725,
+    764, 764, 797, 797, 829, 829, 864, 864, 897, 897, 927, 927,
+    956, 956, 992, 992, 1031, 1031, 1069, 1069, 1099, 1099, 1125, 1125,
+    1155, 1155, 1191, 1191, 1225, 1225, 1253, 1253, 1279, 1279, 1307, 1307,
+    1335, 1335, 1359, 1359, 1380, 1380, 1404, 1404, 1433, 1433, 1459, 1459,
+    1478, 1478, 1492, 1492, 1506, 1506, 1523, 1523, 1540, 1540, 1555, 1555,
+    1565, 1565, 1571, 1571, 1581, 1581, 1594, 1594, 1604, 1604, 1612, 1612,
+    1621, 1621, 1631, 1631, 1637, 1637, 1637, 1637, 1635, 1635, 1636, 1636,
+    1636, 1636, 1632, 1632, 1626, 1626, 1620, 1620, 1608, 1608, 1593, 1593,
+    1577, 1577, 1563, 1563, 1546, 1546, 1522, 1522, 1499, 1499, 1479, 1479,
+    1456, 1456, 1426, 1426, 1392, 1392, 1360, 1360, 1334, 1334, 1309, 1309,
+    1279, 1279, 1243, 1243, 1206, 1206, 1173, 1173, 1143, 1143, 1110, 1110,
+    1072, 1072, 1032, 1032, 997, 997, 963, 963, 926, 926, 885, 885,
+    843, 843, 802, 802, 761, 761, 718, 718, 675, 675, 632, 632,
+    588, 588, 540, 540, 490, 490, 440, 440, 392, 392, 346, 346,
+    302, 302, 253, 253, 197, 197, 140, 140, 89, 89, 42, 42,
+    -7, -7, -59, -59, -112, -112, -161, -161, -210, -210, -261, -261,
+    -313, -313, -362, -362, -407, -407, -453, -453, -503, -503, -554, -554,
+    -604, -604, -650, -650, -693, -693, -736, -736, -784, -784, -835, -835,
+    -884, -884, -928, -928, -969, -969, -1013, -1013, -1060, -1060, -1106, -1106,
+    -1148, -1148, -1187, -1187, -1224, -1224, -1265, -1265, -1305, -1305, -1342, -1342,
+    -1377, -1377, -1413, -1413, -1447, -1447, -1478, -1478, -1508, -1508, -1537, -1537,
+    -1562, -1562, -1579, -1579, -1592, -1592, -1607, -1607, -1626, -1626, -1643, -1643,
+    -1655, -1655, -1665, -1665, -1679, -1679, -1692, -1692, -1702, -1702, -1710, -1710,
+    -1719, -1719, -1731, -1731, -1743, -1743, -1750, -1750, -1750, -1750, -1751, -1751,
+    -1761, -1761, -1772, -1772, -1770, -1770, -1754, -1754, -1738, -1738, -1735, -1735,
+    -1739, -1739, -1733, -1733, -1715, -1715, -1688, -1688, -1659, -1659, -1629, -1629,
+    -1602, -1602, -1577, -1577, -1550, -1550, -1513, -1513, -1472, -1472, -1431, -1431,
+    -1391, -1391, -1346, -1346, -1295, -1295, -1244, -1244, -1197, -1197, -1150, -1150,
+    -1102, -1102, -1052, -1052, -1001, -1001, -947, -947, -895, -895, -845, -845,
+    -796, -796, -745, -745, -696, -696, -647, -647, -596, -596, -543, -543,
+    -492, -492, -439, -439, -381, -381, -324, -324, -271, -271, -219, -219,
+    -162, -162, -98, -98, -32, -32, 30, 30, 89, 89, 147, 147,
+    200, 200, 248, 248, 299, 299, 356, 356, 413, 413, 461, 461,
+    501, 501, 540, 540, 580, 580, 618, 618, 653, 653, 691, 691,
+    734, 734, 773, 773, 805, 805, 834, 834, 867, 867, 903, 903,
+    936, 936, 964, 964, 994, 994, 1031, 1031, 1071, 1071, 1112, 1112,
+    1152, 1152, 1191, 1191, 1226, 1226, 1257, 1257, 1286, 1286, 1318, 1318,
+    1352, 1352, 1384, 1384, 1413, 1413, 1438, 1438, 1459, 1459, 1476, 1476,
+    1491, 1491, 1507, 1507, 1524, 1524, 1542, 1542, 1558, 1558, 1574, 1574,
+    1587, 1587, 1595, 1595, 1602, 1602, 1612, 1612, 1620, 1620, 1628, 1628,
+    1637, 1637, 1649, 1649, 1659, 1659, 1664, 1664, 1667, 1667, 1669, 1669,
+    1670, 1670, 1671, 1671, 1672, 1672, 1669, 1669, 1661, 1661, 1648, 1648,
+    1635, 1635, 1625, 1625, 1612, 1612, 1590, 1590, 1564, 1564, 1539, 1539,
+    1515, 1515, 1490, 1490, 1465, 1465, 1438, 1438, 1403, 1403, 1362, 1362,
+    1324, 1324, 1295, 1295, 1264, 1264, 1226, 1226, 1185, 1185, 1149, 1149,
+    1115, 1115, 1078, 1078, 1040, 1040, 1006, 1006, 974, 974, 935, 935,
+    886, 886, 836, 836, 795, 795, 756, 756, 709, 709, 656, 656,
+    603, 603, 553, 553, 503, 503, 448, 448, 392, 392, 342, 342,
+    297, 297, 245, 245, 187, 187, 130, 130, 82, 82, 36, 36,
+    -17, -17, -73, -73, -122, -122, -165, -165, -212, -212, -267, -267,
+    -321, -321, -369, -369, -412, -412, -459, -459, -512, -512, -565, -565,
+    -614, -614, -661, -661, -706, -706, -752, -752, -803, -803, -858, -858,
+    -909, -909, -953, -953, -999, -999, -1049, -1049, -1097, -1097, -1137, -1137,
+    -1172, -1172, -1210, -1210, -1253, -1253, -1295, -1295, -1333, -1333, -1367, -1367,
+    -1400, -1400, -1431, -1431, -1460, -1460, -1490, -1490, -1522, -1522, -1552, -1552,
+    -1576, -1576, -1598, -1598, -1625, -1625, -1653, -1653, -1677, -1677, -1696, -1696,
+    -1713, -1713, -1731, -1731, -1752, -1752, -1772, -1772, -1789, -1789, -1803, -1803,
+    -1813, -1813, -1817, -1817, -1824, -1824, -1837, -1837, -1849, -1849, -1854, -1854,
+    -1854, -1854, -1856, -1856, -1859, -1859, -1856, -1856, -1849, -1849, -1845, -1845,
+    -1845, -1845, -1839, -1839, -1823, -1823, -1801, -1801, -1784, -1784, -1770, -1770,
+    -1748, -1748, -1716, -1716, -1683, -1683, -1655, -1655, -1630, -1630, -1599, -1599,
+    -1557, -1557, -1511, -1511, -1474, -1474, -1443, -1443, -1405, -1405, -1351, -1351,
+    -1294, -1294, -1245, -1245, -1198, -1198, -1148, -1148, -1095, -1095, -1039, -1039,
+    -984, -984, -932, -932, -884, -884, -836, -836, -779, -779, -715, -715,
+    -657, -657, -612, -612, -569, -569, -513, -513, -447, -447, -384, -384,
+    -327, -327, -267, -267, -206, -206, -147, -147, -83, -83, -13, -13,
+    53, 53, 108, 108, 160, 160, 216, 216, 273, 273, 325, 325,
+    371, 371, 418, 418, 467, 467, 515, 515, 560, 560, 602, 602,
+    647, 647, 695, 695, 743, 743, 784, 784, 813, 813, 839, 839,
+    877, 877, 934, 934, 993, 993, 1049, 1049, 1111, 1111, 1186, 1186,
+    1260, 1260, 1321, 1321, 1376, 1376, 1430, 1430, 1475, 1475, 1512, 1512,
+    1551, 1551, 1606, 1606, 1676, 1676, 1738, 1738, 1773, 1773, 1777, 1777,
+    1769, 1769, 1764, 1764, 1761, 1761, 1747, 1747, 1720, 1720, 1702, 1702,
+    1715, 1715, 1750, 1750, 1777, 1777, 1783, 1783, 1789, 1789, 1817, 1817,
+    1856, 1856, 1889, 1889, 1911, 1911, 1923, 1923, 1928, 1928, 1938, 1938,
+    1958, 1958, 1984, 1984, 2002, 2002, 2009, 2009, 2011, 2011, 2016, 2016,
+    2018, 2018, 2007, 2007, 1981, 1981, 1941, 1941, 1898, 1898, 1856, 1856,
+    1815, 1815, 1772, 1772, 1730, 1730, 1693, 1693, 1661, 1661, 1624, 1624,
+    1578, 1578, 1530, 1530, 1485, 1485, 1440, 1440, 1393, 1393, 1348, 1348,
+    1304, 1304, 1255, 1255, 1204, 1204, 1159, 1159, 1118, 1118, 1072, 1072,
+    1020, 1020, 965, 965, 906, 906, 836, 836, 760, 760, 689, 689,
+    618, 618, 543, 543, 472, 472, 412, 412, 347, 347, 266, 266,
+    185, 185, 130, 130, 88, 88, 22, 22, -65, -65, -130, -130,
+    -165, -165, -206, -206, -270, -270, -328, -328, -364, -364, -403, -403,
+    -471, -471, -545, -545, -587, -587, -605, -605, -639, -639, -702, -702,
+    -771, -771, -822, -822, -860, -860, -907, -907, -968, -968, -1032, -1032,
+    -1094, -1094, -1165, -1165, -1251, -1251, -1327, -1327, -1364, -1364, -1368, -1368,
+    -1388, -1388, -1452, -1452, -1530, -1530, -1576, -1576, -1593, -1593, -1614, -1614,
+    -1653, -1653, -1692, -1692, -1722, -1722, -1750, -1750, -1776, -1776, -1791, -1791,
+    -1804, -1804, -1836, -1836, -1882, -1882, -1913, -1913, -1917, -1917, -1916, -1916,
+    -1933, -1933, -1963, -1963, -1984, -1984, -1986, -1986, -1979, -1979, -1975, -1975,
+    -1974, -1974, -1976, -1976, -1977, -1977, -1978, -1978, -1979, -1979, -1977, -1977,
+    -1966, -1966, -1950, -1950, -1939, -1939, -1933, -1933, -1916, -1916, -1881, -1881,
+    -1848, -1848, -1833, -1833, -1823, -1823, -1795, -1795, -1750, -1750, -1703, -1703,
+    -1668, -1668, -1636, -1636, -1597, -1597, -1553, -1553, -1510, -1510, -1471, -1471,
+    -1424, -1424, -1369, -1369, -1313, -1313, -1257, -1257, -1200, -1200, -1139, -1139,
+    -1074, -1074, -1004, -1004, -929, -929, -852, -852, -774, -774, -696, -696,
+    -619, -619, -548, -548, -486, -486, -423, -423, -344, -344, -252, -252,
+    -171, -171, -111, -111, -50, -50, 33, 33, 119, 119, 184, 184,
+    240, 240, 305, 305, 368, 368, 407, 407, 429, 429, 455, 455,
+    486, 486, 511, 511, 536, 536, 576, 576, 649, 649, 766, 766,
+    918, 918, 1041, 1041, 1037, 1037, 904, 904, 793, 793, 863, 863,
+    1101, 1101, 1354, 1354, 1531, 1531, 1668, 1668, 1812, 1812, 1935, 1935,
+    2000, 2000, 2010, 2010, 1978, 1978, 1898, 1898, 1790, 1790, 1710, 1710,
+    1701, 1701, 1738, 1738, 1766, 1766, 1766, 1766, 1770, 1770, 1831, 1831,
+    1966, 1966, 2115, 2115, 2176, 2176, 2113, 2113, 2007, 2007, 1955, 1955,
+    1950, 1950, 1930, 1930, 1891, 1891, 1878, 1878, 1889, 1889, 1883, 1883,
+    1876, 1876, 1931, 1931, 2045, 2045, 2137, 2137, 2139, 2139, 2066, 2066,
+    1980, 1980, 1940, 1940, 1977, 1977, 2059, 2059, 2094, 2094, 2027, 2027,
+    1919, 1919, 1874, 1874, 1901, 1901, 1925, 1925, 1903, 1903, 1851, 1851,
+    1771, 1771, 1649, 1649, 1522, 1522, 1452, 1452, 1438, 1438, 1437, 1437,
+    1454, 1454, 1524, 1524, 1608, 1608, 1604, 1604, 1476, 1476, 1284, 1284,
+    1111, 1111, 999, 999, 969, 969, 1007, 1007, 1024, 1024, 929, 929,
+    763, 763, 661, 661, 672, 672, 689, 689, 602, 602, 421, 421,
+    237, 237, 129, 129, 132, 132, 220, 220, 295, 295, 264, 264,
+    145, 145, 34, 34, -34, -34, -107, -107, -210, -210, -302, -302,
+    -376, -376, -491, -491, -663, -663, -797, -797, -815, -815, -770, -770,
+    -772, -772, -838, -838, -899, -899, -922, -922, -951, -951, -1035, -1035,
+    -1170, -1170, -1300, -1300, -1365, -1365, -1338, -1338, -1259, -1259, -1210, -1210,
+    -1245, -1245, -1338, -1338, -1426, -1426, -1475, -1475, -1492, -1492, -1487, -1487,
+    -1458, -1458, -1428, -1428, -1438, -1438, -1511, -1511, -1618, -1618, -1711, -1711,
+    -1780, -1780, -1853, -1853, -1958, -1958, -2073, -2073, -2140, -2140, -2136, -2136,
+    -2107, -2107, -2124, -2124, -2203, -2203, -2287, -2287, -2313, -2313, -2276, -2276,
+    -2220, -2220, -2183, -2183, -2160, -2160, -2127, -2127, -2092, -2092, -2082, -2082,
+    -2092, -2092, -2072, -2072, -1989, -1989, -1879, -1879, -1813, -1813, -1812, -1812,
+    -1840, -1840, -1867, -1867, -1907, -1907, -1971, -1971, -2021, -2021, -1996, -1996,
+    -1885, -1885, -1753, -1753, -1676, -1676, -1680, -1680, -1716, -1716, -1716, -1716,
+    -1660, -1660, -1582, -1582, -1511, -1511, -1429, -1429, -1323, -1323, -1219, -1219,
+    -1145, -1145, -1082, -1082, -996, -996, -897, -897, -813, -813, -731, -731,
+    -614, -614, -457, -457, -297, -297, -150, -150, -16, -16, 85, 85,
+    133, 133, 168, 168, 248, 248, 348, 348, 389, 389, 375, 375,
+    399, 399, 503, 503, 623, 623, 705, 705, 773, 773, 868, 868,
+    963, 963, 1015, 1015, 1042, 1042, 1092, 1092, 1162, 1162, 1222, 1222,
+    1277, 1277, 1356, 1356, 1461, 1461, 1574, 1574, 1679, 1679, 1746, 1746,
+    1755, 1755, 1744, 1744, 1778, 1778, 1856, 1856, 1908, 1908, 1896, 1896,
+    1860, 1860, 1852, 1852, 1875, 1875, 1909, 1909, 1947, 1947, 1972, 1972,
+    1958, 1958, 1928, 1928, 1975, 1975, 2141, 2141, 2346, 2346, 2485, 2485,
+    2535, 2535, 2523, 2523, 2462, 2462, 2387, 2387, 2373, 2373, 2449, 2449,
+    2533, 2533, 2529, 2529, 2452, 2452, 2407, 2407, 2446, 2446, 2497, 2497,
+    2439, 2439, 2228, 2228, 1932, 1932, 1657, 1657, 1467, 1467, 1346, 1346,
+    1247, 1247, 1150, 1150, 1091, 1091, 1115, 1115, 1251, 1251, 1468, 1468,
+    1649, 1649, 1651, 1651, 1476, 1476, 1302, 1302, 1256, 1256, 1238, 1238,
+    1089, 1089, 864, 864, 781, 781, 907, 907, 1061, 1061, 1071, 1071,
+    964, 964, 861, 861, 789, 789, 691, 691, 553, 553, 422, 422,
+    369, 369, 438, 438, 590, 590, 692, 692, 646, 646, 538, 538,
+    537, 537, 625, 625, 579, 579, 303, 303, 16, 16, -19, -19,
+    165, 165, 286, 286, 158, 158, -129, -129, -336, -336, -331, -331,
+    -207, -207, -181, -181, -362, -362, -652, -652, -857, -857, -901, -901,
+    -869, -869, -868, -868, -915, -915, -989, -989, -1102, -1102, -1251, -1251,
+    -1375, -1375, -1441, -1441, -1504, -1504, -1605, -1605, -1686, -1686, -1666, -1666,
+    -1561, -1561, -1488, -1488, -1555, -1555, -1758, -1758, -1963, -1963, -2037, -2037,
+    -2007, -2007, -2027, -2027, -2183, -2183, -2368, -2368, -2424, -2424, -2342, -2342,
+    -2269, -2269, -2319, -2319, -2462, -2462, -2609, -2609, -2714, -2714, -2746, -2746,
+    -2680, -2680, -2560, -2560, -2503, -2503, -2559, -2559, -2669, -2669, -2755, -2755,
+    -2802, -2802, -2814, -2814, -2781, -2781, -2698, -2698, -2594, -2594, -2520, -2520,
+    -2521, -2521, -2598, -2598, -2702, -2702, -2758, -2758, -2723, -2723, -2620, -2620,
+    -2520, -2520, -2467, -2467, -2464, -2464, -2490, -2490, -2516, -2516, -2509, -2509,
+    -2466, -2466, -2434, -2434, -2435, -2435, -2418, -2418, -2328, -2328, -2198, -2198,
+    -2096, -2096, -2024, -2024, -1935, -1935, -1827, -1827, -1728, -1728, -1632, -1632,
+    -1507, -1507, -1358, -1358, -1227, -1227, -1142, -1142, -1089, -1089, -1046, -1046,
+    -994, -994, -915, -915, -811, -811, -715, -715, -651, -651, -582, -582,
+    -456, -456, -285, -285, -135, -135, -35, -35, 45, 45, 138, 138,
+    252, 252, 386, 386, 522, 522, 627, 627, 708, 708, 810, 810,
+    947, 947, 1075, 1075, 1172, 1172, 1277, 1277, 1427, 1427, 1588, 1588,
+    1687, 1687, 1709, 1709, 1720, 1720, 1789, 1789, 1920, 1920, 2065, 2065,
+    2182, 2182, 2263, 2263, 2329, 2329, 2391, 2391, 2412, 2412, 2359, 2359,
+    2285, 2285, 2286, 2286, 2356, 2356, 2386, 2386, 2332, 2332, 2263, 2263,
+    2249, 2249, 2295, 2295, 2405, 2405, 2592, 2592, 2806, 2806, 2942, 2942,
+    2956, 2956, 2913, 2913, 2863, 2863, 2768, 2768, 2615, 2615, 2523, 2523,
+    2593, 2593, 2752, 2752, 2862, 2862, 2895, 2895, 2887, 2887, 2801, 2801,
+    2596, 2596, 2366, 2366, 2260, 2260, 2284, 2284, 2297, 2297, 2212, 2212,
+    2096, 2096, 2043, 2043, 2035, 2035, 2010, 2010, 1962, 1962, 1919, 1919,
+    1879, 1879, 1813, 1813, 1727, 1727, 1660, 1660, 1643, 1643, 1672, 1672,
+    1708, 1708, 1705, 1705, 1663, 1663, 1623, 1623, 1597, 1597, 1540, 1540,
+    1407, 1407, 1211, 1211, 1009, 1009, 840, 840, 713, 713, 642, 642,
+    647, 647, 700, 700, 721, 721, 630, 630, 395, 395, 66, 66,
+    -219, -219, -306, -306, -173, -173, -2, -2, -22, -22, -268, -268,
+    -561, -561, -733, -733, -776, -776, -755, -755, -667, -667, -507, -507,
+    -398, -398, -503, -503, -810, -810, -1114, -1114, -1252, -1252, -1268, -1268,
+    -1291, -1291, -1352, -1352, -1393, -1393, -1403, -1403, -1445, -1445, -1575, -1575,
+    -1799, -1799, -2072, -2072, -2303, -2303, -2402, -2402, -2395, -2395, -2420, -2420,
+    -2559, -2559, -2735, -2735, -2820, -2820, -2813, -2813, -2826, -2826, -2922, -2922,
+    -3062, -3062, -3186, -3186, -3273, -3273, -3315, -3315, -3332, -3332, -3385, -3385,
+    -3479, -3479, -3498, -3498, -3361, -3361, -3181, -3181, -3117, -3117, -3142, -3142,
+    -3110, -3110, -3021, -3021, -3028, -3028, -3172, -3172, -3305, -3305, -3303, -3303,
+    -3195, -3195, -3043, -3043, -2837, -2837, -2632, -2632, -2586, -2586, -2752, -2752,
+    -2946, -2946, -2979, -2979, -2879, -2879, -2773, -2773, -2693, -2693, -2620, -2620,
+    -2588, -2588, -2610, -2610, -2603, -2603, -2514, -2514, -2425, -2425, -2433, -2433,
+    -2482, -2482, -2444, -2444, -2321, -2321, -2220, -2220, -2161, -2161, -2069, -2069,
+    -1921, -1921, -1753, -1753, -1545, -1545, -1266, -1266, -1011, -1011, -918, -918,
+    -948, -948, -912, -912, -728, -728, -500, -500, -324, -324, -153, -153,
+    60, 60, 248, 248, 351, 351, 442, 442, 612, 612, 819, 819,
+    958, 958, 1039, 1039, 1151, 1151, 1310, 1310, 1449, 1449, 1540, 1540,
+    1630, 1630, 1744, 1744, 1859, 1859, 1973, 1973, 2121, 2121, 2304, 2304,
+    2472, 2472, 2595, 2595, 2688, 2688, 2761, 2761, 2802, 2802, 2829, 2829,
+    2882, 2882, 2971, 2971, 3076, 3076, 3193, 3193, 3332, 3332, 3465, 3465,
+    3545, 3545, 3563, 3563, 3548, 3548, 3515, 3515, 3464, 3464, 3425, 3425,
+    3432, 3432, 3448, 3448, 3416, 3416, 3372, 3372, 3399, 3399, 3478, 3478,
+    3494, 3494, 3424, 3424, 3363, 3363, 3356, 3356, 3322, 3322, 3216, 3216,
+    3132, 3132, 3156, 3156, 3225, 3225, 3234, 3234, 3200, 3200, 3202, 3202,
+    3221, 3221, 3165, 3165, 3024, 3024, 2878, 2878, 2769, 2769, 2675, 2675,
+    2602, 2602, 2598, 2598, 2639, 2639, 2611, 2611, 2470, 2470, 2325, 2325,
+    2290, 2290, 2312, 2312, 2230, 2230, 2003, 2003, 1777, 1777, 1689, 1689,
+    1698, 1698, 1674, 1674, 1611, 1611, 1610, 1610, 1651, 1651, 1594, 1594,
+    1417, 1417, 1270, 1270, 1232, 1232, 1179, 1179, 986, 986, 705, 705,
+    463, 463, 275, 275, 104, 104, 8, 8, 82, 82, 255, 255,
+    313, 313, 131, 131, -237, -237, -668, -668, -1021, -1021, -1128, -1128,
+    -930, -930, -615, -615, -482, -482, -670, -670, -1059, -1059, -1383, -1383,
+    -1427, -1427, -1204, -1204, -966, -966, -956, -956, -1174, -1174, -1436, -1436,
+    -1623, -1623, -1767, -1767, -1893, -1893, -1936, -1936, -1898, -1898, -1926, -1926,
+    -2089, -2089, -2233, -2233, -2254, -2254, -2317, -2317, -2590, -2590, -2939, -2939,
+    -3124, -3124, -3130, -3130, -3100, -3100, -3117, -3117, -3211, -3211, -3419, -3419,
+    -3684, -3684, -3832, -3832, -3788, -3788, -3710, -3710, -3759, -3759, -3830, -3830,
+    -3723, -3723, -3497, -3497, -3392, -3392, -3456, -3456, -3532, -3532, -3573, -3573,
+    -3654, -3654, -3705, -3705, -3539, -3539, -3190, -3190, -2926, -2926, -2896, -2896,
+    -2970, -2970, -2980, -2980, -2930, -2930, -2915, -2915, -2928, -2928, -2894, -2894,
+    -2829, -2829, -2849, -2849, -2994, -2994, -3144, -3144, -3175, -3175, -3098, -3098,
+    -3011, -3011, -2959, -2959, -2911, -2911, -2852, -2852, -2821, -2821, -2826, -2826,
+    -2782, -2782, -2626, -2626, -2434, -2434, -2322, -2322, -2260, -2260, -2134, -2134,
+    -1936, -1936, -1751, -1751, -1572, -1572, -1323, -1323, -1012, -1012, -720, -720,
+    -458, -458, -188, -188, 58, 58, 215, 215, 307, 307, 402, 402,
+    501, 501, 584, 584, 712, 712, 953, 953, 1239, 1239, 1442, 1442,
+    1567, 1567, 1716, 1716, 1875, 1875, 1942, 1942, 1948, 1948, 2027, 2027,
+    2164, 2164, 2231, 2231, 2255, 2255, 2395, 2395, 2643, 2643, 2816, 2816,
+    2869, 2869, 2968, 2968, 3212, 3212, 3473, 3473, 3602, 3602, 3628, 3628,
+    3658, 3658, 3701, 3701, 3710, 3710, 3711, 3711, 3760, 3760, 3835, 3835,
+    3882, 3882, 3908, 3908, 3942, 3942, 3988, 3988, 4041, 4041, 4076, 4076,
+    4018, 4018, 3844, 3844, 3684, 3684, 3687, 3687, 3797, 3797, 3795, 3795,
+    3602, 3602, 3387, 3387, 3334, 3334, 3425, 3425, 3529, 3529, 3610, 3610,
+    3694, 3694, 3733, 3733, 3632, 3632, 3411, 3411, 3196, 3196, 3062, 3062,
+    2979, 2979, 2910, 2910, 2876, 2876, 2894, 2894, 2912, 2912, 2861, 2861,
+    2728, 2728, 2557, 2557, 2400, 2400, 2306, 2306, 2296, 2296, 2322, 2322,
+    2281, 2281, 2108, 2108, 1846, 1846, 1598, 1598, 1452, 1452, 1430, 1430,
+    1487, 1487, 1531, 1531, 1482, 1482, 1347, 1347, 1214, 1214, 1135, 1135,
+    1054, 1054, 877, 877, 597, 597, 289, 289, 54, 54, -20, -20,
+    66, 66, 127, 127, -59, -59, -436, -436, -677, -677, -619, -619,
+    -500, -500, -643, -643, -1020, -1020, -1333, -1333, -1430, -1430, -1406, -1406,
+    -1350, -1350, -1264, -1264, -1242, -1242, -1413, -1413, -1663, -1663, -1733, -1733,
+    -1629, -1629, -1631, -1631, -1847, -1847, -2061, -2061, -2110, -2110, -2113, -2113,
+    -2199, -2199, -2292, -2292, -2323, -2323, -2440, -2440, -2768, -2768, -3109, -3109,
+    -3172, -3172, -3013, -3013, -2977, -2977, -3232, -3232, -3601, -3601, -3856, -3856,
+    -3965, -3965, -4040, -4040, -4166, -4166, -4301, -4301, -4315, -4315, -4159, -4159,
+    -3970, -3970, -3917, -3917, -3991, -3991, -4047, -4047, -4031, -4031, -4026, -4026,
+    -4032, -4032, -3891, -3891, -3561, -3561, -3287, -3287, -3304, -3304, -3484, -3484,
+    -3506, -3506, -3295, -3295, -3063, -3063, -2983, -2983, -3037, -3037, -3155, -3155,
+    -3294, -3294, -3392, -3392, -3385, -3385, -3316, -3316, -3303, -3303, -3368, -3368,
+    -3408, -3408, -3372, -3372, -3351, -3351, -3418, -3418, -3498, -3498, -3476, -3476,
+    -3341, -3341, -3133, -3133, -2877, -2877, -2632, -2632, -2502, -2502, -2498, -2498,
+    -2474, -2474, -2276, -2276, -1920, -1920, -1538, -1538, -1206, -1206, -893, -893,
+    -589, -589, -354, -354, -202, -202, -56, -56, 138, 138, 329, 329,
+    469, 469, 600, 600, 787, 787, 1008, 1008, 1176, 1176, 1250, 1250,
+    1289, 1289, 1380, 1380, 1553, 1553, 1772, 1772, 1980, 1980, 2128, 2128,
+    2212, 2212, 2288, 2288, 2423, 2423, 2613, 2613, 2793, 2793, 2930, 2930,
+    3069, 3069, 3252, 3252, 3464, 3464, 3670, 3670, 3866, 3866, 4037, 4037,
+    4118, 4118, 4077, 4077, 4027, 4027, 4127, 4127, 4354, 4354, 4487, 4487,
+    4383, 4383, 4163, 4163, 4047, 4047, 4076, 4076, 4128, 4128, 4135, 4135,
+    4155, 4155, 4221, 4221, 4254, 4254, 4179, 4179, 4029, 4029, 3890, 3890,
+    3789, 3789, 3705, 3705, 3646, 3646, 3657, 3657, 3749, 3749, 3861, 3861,
+    3909, 3909, 3854, 3854, 3734, 3734, 3638, 3638, 3617, 3617, 3622, 3622,
+    3549, 3549, 3364, 3364, 3140, 3140, 2962, 2962, 2846, 2846, 2756, 2756,
+    2673, 2673, 2603, 2603, 2538, 2538, 2449, 2449, 2323, 2323, 2182, 2182,
+    2051, 2051, 1916, 1916, 1761, 1761, 1624, 1624, 1566, 1566, 1582, 1582,
+    1570, 1570, 1437, 1437, 1214, 1214, 1037, 1037, 997, 997, 1042, 1042,
+    1042, 1042, 932, 932, 754, 754, 575, 575, 414, 414, 251, 251,
+    86, 86, -66, -66, -226, -226, -447, -447, -709, -709, -866, -866,
+    -807, -807, -659, -659, -705, -705, -1047, -1047, -1457, -1457, -1646, -1646,
+    -1593, -1593, -1510, -1510, -1544, -1544, -1656, -1656, -1771, -1771, -1895, -1895,
+    -2044, -2044, -2155, -2155, -2172, -2172, -2135, -2135, -2136, -2136, -2213, -2213,
+    -2341, -2341, -2469, -2469, -2549, -2549, -2591, -2591, -2701, -2701, -2975, -2975,
+    -3328, -3328, -3533, -3533, -3504, -3504, -3464, -3464, -3689, -3689, -4133, -4133,
+    -4460, -4460, -4464, -4464, -4307, -4307, -4264, -4264, -4367, -4367, -4437, -4437,
+    -4386, -4386, -4316, -4316, -4333, -4333, -4396, -4396, -4407, -4407, -4345, -4345,
+    -4231, -4231, -4066, -4066, -3853, -3853, -3651, -3651, -3526, -3526, -3479, -3479,
+    -3456, -3456, -3413, -3413, -3351, -3351, -3306, -3306, -3315, -3315, -3386, -3386,
+    -3469, -3469, -3501, -3501, -3481, -3481, -3487, -3487, -3578, -3578, -3705, -3705,
+    -3775, -3775, -3752, -3752, -3667, -3667, -3561, -3561, -3464, -3464, -3385, -3385,
+    -3305, -3305, -3206, -3206, -3093, -3093, -2952, -2952, -2751, -2751, -2503, -2503,
+    -2274, -2274, -2080, -2080, -1839, -1839, -1490, -1490, -1099, -1099, -774, -774,
+    -510, -510, -220, -220, 82, 82, 276, 276, 338, 338, 387, 387,
+    496, 496, 612, 612, 719, 719, 891, 891, 1152, 1152, 1416, 1416,
+    1617, 1617, 1762, 1762, 1845, 1845, 1863, 1863, 1904, 1904, 2085, 2085,
+    2360, 2360, 2541, 2541, 2569, 2569, 2625, 2625, 2868, 2868, 3204, 3204,
+    3449, 3449, 3606, 3606, 3783, 3783, 3984, 3984, 4137, 4137, 4243, 4243,
+    4339, 4339, 4404, 4404, 4421, 4421, 4444, 4444, 4516, 4516, 4567, 4567,
+    4509, 4509, 4384, 4384, 4338, 4338, 4440, 4440, 4601, 4601, 4677, 4677,
+    4605, 4605, 4430, 4430, 4248, 4248, 4118, 4118, 4018, 4018, 3900, 3900,
+    3801, 3801, 3811, 3811, 3912, 3912, 3960, 3960, 3882, 3882, 3791, 3791,
+    3820, 3820, 3923, 3923, 3931, 3931, 3770, 3770, 3528, 3528, 3320, 3320,
+    3178, 3178, 3086, 3086, 3031, 3031, 3006, 3006, 2981, 2981, 2912, 2912,
+    2768, 2768, 2564, 2564, 2372, 2372, 2268, 2268, 2259, 2259, 2266, 2266,
+    2185, 2185, 1983, 1983, 1731, 1731, 1503, 1503, 1319, 1319, 1194, 1194,
+    1168, 1168, 1221, 1221, 1236, 1236, 1125, 1125, 951, 951, 832, 832,
+    772, 772, 662, 662, 454, 454, 231, 231, 53, 53, -158, -158,
+    -454, -454, -702, -702, -754, -754, -689, -689, -712, -712, -872, -872,
+    -1038, -1038, -1120, -1120, -1162, -1162, -1263, -1263, -1463, -1463, -1710, -1710,
+    -1900, -1900, -1972, -1972, -1968, -1968, -1985, -1985, -2058, -2058, -2126, -2126,
+    -2138, -2138, -2158, -2158, -2261, -2261, -2405, -2405, -2505, -2505, -2598, -2598,
+    -2757, -2757, -2932, -2932, -3045, -3045, -3153, -3153, -3330, -3330, -3495, -3495,
+    -3560, -3560, -3629, -3629, -3853, -3853, -4162, -4162, -4359, -4359, -4451, -4451,
+    -4629, -4629, -4902, -4902, -4997, -4997, -4769, -4769, -4485, -4485, -4466, -4466,
+    -4637, -4637, -4689, -4689, -4563, -4563, -4483, -4483, -4545, -4545, -4559, -4559,
+    -4353, -4353, -4032, -4032, -3821, -3821, -3766, -3766, -3717, -3717, -3592, -3592,
+    -3504, -3504, -3567, -3567, -3692, -3692, -3706, -3706, -3598, -3598, -3496, -3496,
+    -3470, -3470, -3482, -3482, -3520, -3520, -3648, -3648, -3870, -3870, -4047, -4047,
+    -4034, -4034, -3865, -3865, -3705, -3705, -3622, -3622, -3531, -3531, -3357, -3357,
+    -3148, -3148, -2971, -2971, -2824, -2824, -2689, -2689, -2566, -2566, -2418, -2418,
+    -2162, -2162, -1779, -1779, -1353, -1353, -980, -980, -663, -663, -348, -348,
+    -34, -34, 205, 205, 338, 338, 448, 448, 623, 623, 832, 832,
+    990, 990, 1104, 1104, 1239, 1239, 1406, 1406, 1562, 1562, 1692, 1692,
+    1839, 1839, 2035, 2035, 2232, 2232, 2348, 2348, 2395, 2395, 2492, 2492,
+    2705, 2705, 2946, 2946, 3122, 3122, 3272, 3272, 3476, 3476, 3701, 3701,
+    3850, 3850, 3933, 3933, 4091, 4091, 4404, 4404, 4738, 4738, 4893, 4893,
+    4871, 4871, 4840, 4840, 4872, 4872, 4875, 4875, 4811, 4811, 4761, 4761,
+    4769, 4769, 4767, 4767, 4710, 4710, 4644, 4644, 4617, 4617, 4608, 4608,
+    4579, 4579, 4533, 4533, 4485, 4485, 4405, 4405, 4260, 4260, 4087, 4087,
+    3970, 3970, 3939, 3939, 3965, 3965, 4026, 4026, 4086, 4086, 4077, 4077,
+    3971, 3971, 3838, 3838, 3740, 3740, 3650, 3650, 3533, 3533, 3411, 3411,
+    3291, 3291, 3121, 3121, 2874, 2874, 2625, 2625, 2485, 2485, 2462, 2462,
+    2435, 2435, 2303, 2303, 2108, 2108, 1968, 1968, 1914, 1914, 1862, 1862,
+    1757, 1757, 1639, 1639, 1546, 1546, 1436, 1436, 1249, 1249, 1018, 1018,
+    847, 847, 789, 789, 788, 788, 773, 773, 737, 737, 683, 683,
+    560, 560, 325, 325, 21, 21, -271, -271, -507, -507, -665, -665,
+    -759, -759, -878, -878, -1093, -1093, -1317, -1317, -1403, -1403, -1382, -1382,
+    -1430, -1430, -1592, -1592, -1744, -1744, -1826, -1826, -1935, -1935, -2125, -2125,
+    -2272, -2272, -2266, -2266, -2206, -2206, -2268, -2268, -2433, -2433, -2541, -2541,
+    -2551, -2551, -2579, -2579, -2677, -2677, -2780, -2780, -2845, -2845, -2907, -2907,
+    -3030, -3030, -3264, -3264, -3569, -3569, -3787, -3787, -3849, -3849, -3951, -3951,
+    -4300, -4300, -4757, -4757, -4987, -4987, -4938, -4938, -4888, -4888, -4980, -4980,
+    -4989, -4989, -4743, -4743, -4488, -4488, -4559, -4559, -4845, -4845, -4965, -4965,
+    -4840, -4840, -4700, -4700, -4614, -4614, -4426, -4426, -4124, -4124, -3892, -3892,
+    -3789, -3789, -3688, -3688, -3557, -3557, -3531, -3531, -3648, -3648, -3719, -3719,
+    -3600, -3600, -3439, -3439, -3483, -3483, -3727, -3727, -3938, -3938, -3977, -3977,
+    -3933, -3933, -3928, -3928, -3973, -3973, -4010, -4010, -3979, -3979, -3844, -3844,
+    -3613, -3613, -3373, -3373, -3229, -3229, -3200, -3200, -3181, -3181, -3049, -3049,
+    -2799, -2799, -2530, -2530, -2292, -2292, -2008, -2008, -1607, -1607, -1159, -1159,
+    -780, -780, -467, -467, -142, -142, 177, 177, 394, 394, 501, 501,
+    606, 606, 770, 770, 920, 920, 988, 988, 1048, 1048, 1217, 1217,
+    1463, 1463, 1642, 1642, 1729, 1729, 1850, 1850, 2066, 2066, 2282, 2282,
+    2435, 2435, 2598, 2598, 2819, 2819, 2997, 2997, 3036, 3036, 3033, 3033,
+    3198, 3198, 3595, 3595, 4058, 4058, 4393, 4393, 4579, 4579, 4702, 4702,
+    4807, 4807, 4919, 4919, 5091, 5091, 5292, 5292, 5373, 5373, 5268, 5268,
+    5112, 5112, 5059, 5059, 5090, 5090, 5090, 5090, 5032, 5032, 4989, 4989,
+    4989, 4989, 4950, 4950, 4821, 4821, 4677, 4677, 4602, 4602, 4547, 4547,
+    4414, 4414, 4224, 4224, 4079, 4079, 4009, 4009, 3958, 3958, 3897, 3897,
+    3866, 3866, 3914, 3914, 4012, 4012, 4057, 4057, 3985, 3985, 3843, 3843,
+    3707, 3707, 3576, 3576, 3415, 3415, 3242, 3242, 3097, 3097, 2961, 2961,
+    2785, 2785, 2570, 2570, 2380, 2380, 2267, 2267, 2206, 2206, 2117, 2117,
+    1950, 1950, 1740, 1740, 1555, 1555, 1418, 1418, 1301, 1301, 1168, 1168,
+    1023, 1023, 891, 891, 782, 782, 683, 683, 592, 592, 531, 531,
+    499, 499, 461, 461, 393, 393, 309, 309, 197, 197, 18, 18,
+    -218, -218, -440, -440, -642, -642, -882, -882, -1142, -1142, -1311, -1311,
+    -1348, -1348, -1348, -1348, -1396, -1396, -1485, -1485, -1605, -1605, -1785, -1785,
+    -2016, -2016, -2213, -2213, -2323, -2323, -2410, -2410, -2549, -2549, -2684, -2684,
+    -2704, -2704, -2630, -2630, -2596, -2596, -2675, -2675, -2828, -2828, -2973, -2973,
+    -3037, -3037, -3033, -3033, -3100, -3100, -3328, -3328, -3574, -3574, -3665, -3665,
+    -3724, -3724, -4017, -4017, -4514, -4514, -4889, -4889, -5001, -5001, -5067, -5067,
+    -5236, -5236, -5298, -5298, -5055, -5055, -4723, -4723, -4634, -4634, -4743, -4743,
+    -4799, -4799, -4825, -4825, -5000, -5000, -5176, -5176, -4994, -4994, -4475, -4475,
+    -4047, -4047, -3952, -3952, -3969, -3969, -3824, -3824, -3593, -3593, -3512, -3512,
+    -3603, -3603, -3696, -3696, -3703, -3703, -3684, -3684, -3682, -3682, -3667, -3667,
+    -3657, -3657, -3731, -3731, -3918, -3918, -4126, -4126, -4214, -4214, -4116, -4116,
+    -3892, -3892, -3670, -3670, -3519, -3519, -3408, -3408, -3281, -3281, -3145, -3145,
+    -3039, -3039, -2949, -2949, -2810, -2810, -2569, -2569, -2221, -2221, -1790, -1790,
+    -1327, -1327, -902, -902, -554, -554, -256, -256, 44, 44, 355, 355,
+    624, 624, 782, 782, 817, 817, 816, 816, 899, 899, 1109, 1109,
+    1384, 1384, 1622, 1622, 1766, 1766, 1854, 1854, 1981, 1981, 2189, 2189,
+    2415, 2415, 2579, 2579, 2685, 2685, 2808, 2808, 2979, 2979, 3128, 3128,
+    3198, 3198, 3278, 3278, 3520, 3520, 3921, 3921, 4312, 4312, 4591, 4591,
+    4808, 4808, 5003, 5003, 5137, 5137, 5228, 5228, 5377, 5377, 5592, 5592,
+    5713, 5713, 5618, 5618, 5395, 5395, 5246, 5246, 5250, 5250, 5314, 5314,
+    5336, 5336, 5295, 5295, 5206, 5206, 5088, 5088, 4970, 4970, 4866, 4866,
+    4746, 4746, 4569, 4569, 4344, 4344, 4109, 4109, 3919, 3919, 3847, 3847,
+    3911, 3911, 3999, 3999, 3989, 3989, 3917, 3917, 3904, 3904, 3934, 3934,
+    3858, 3858, 3629, 3629, 3393, 3393, 3279, 3279, 3231, 3231, 3127, 3127,
+    2956, 2956, 2784, 2784, 2622, 2622, 2441, 2441, 2279, 2279, 2191, 2191,
+    2144, 2144, 2049, 2049, 1862, 1862, 1609, 1609, 1339, 1339, 1119, 1119,
+    998, 998, 943, 943, 856, 856, 691, 691, 511, 511, 402, 402,
+    379, 379, 402, 402, 417, 417, 358, 358, 185, 185, -49, -49,
+    -234, -234, -339, -339, -459, -459, -683, -683, -967, -967, -1196, -1196,
+    -1322, -1322, -1378, -1378, -1394, -1394, -1387, -1387, -1423, -1423, -1580, -1580,
+    -1824, -1824, -2032, -2032, -2166, -2166, -2317, -2317, -2528, -2528, -2673, -2673,
+    -2637, -2637, -2547, -2547, -2632, -2632, -2866, -2866, -2976, -2976, -2892, -2892,
+    -2888, -2888, -3136, -3136, -3401, -3401, -3426, -3426, -3370, -3370, -3527, -3527,
+    -3829, -3829, -4010, -4010, -4144, -4144, -4539, -4539, -5122, -5122, -5405, -5405,
+    -5207, -5207, -4952, -4952, -5000, -5000, -5126, -5126, -4970, -4970, -4656, -4656,
+    -4578, -4578, -4814, -4814, -5112, -5112, -5272, -5272, -5230, -5230, -4916, -4916,
+    -4356, -4356, -3859, -3859, -3751, -3751, -3942, -3942, -4023, -4023, -3807, -3807,
+    -3522, -3522, -3435, -3435, -3542, -3542, -3678, -3678, -3735, -3735, -3701, -3701,
+    -3635, -3635, -3638, -3638, -3775, -3775, -3976, -3976, -4105, -4105, -4093, -4093,
+    -3961, -3961, -3739, -3739, -3464, -3464, -3221, -3221, -3091, -3091, -3044, -3044,
+    -2976, -2976, -2839, -2839, -2661, -2661, -2451, -2451, -2193, -2193, -1873, -1873,
+    -1457, -1457, -919, -919, -343, -343, 85, 85, 281, 281, 372, 372,
+    532, 532, 773, 773, 984, 984, 1123, 1123, 1233, 1233, 1341, 1341,
+    1465, 1465, 1686, 1686, 2038, 2038, 2352, 2352, 2418, 2418, 2286, 2286,
+    2248, 2248, 2470, 2470, 2814, 2814, 3064, 3064, 3188, 3188, 3297, 3297,
+    3447, 3447, 3609, 3609, 3793, 3793, 4067, 4067, 4422, 4422, 4740, 4740,
+    4947, 4947, 5103, 5103, 5299, 5299, 5502, 5502, 5605, 5605, 5604, 5604,
+    5611, 5611, 5679, 5679, 5697, 5697, 5562, 5562, 5364, 5364, 5269, 5269,
+    5279, 5279, 5257, 5257, 5155, 5155, 5066, 5066, 5026, 5026, 4940, 4940,
+    4739, 4739, 4508, 4508, 4365, 4365, 4304, 4304, 4228, 4228, 4102, 4102,
+    3977, 3977, 3914, 3914, 3925, 3925, 3982, 3982, 4021, 4021, 3978, 3978,
+    3846, 3846, 3671, 3671, 3498, 3498, 3347, 3347, 3228, 3228, 3127, 3127,
+    2985, 2985, 2772, 2772, 2546, 2546, 2393, 2393, 2300, 2300, 2177, 2177,
+    1988, 1988, 1787, 1787, 1617, 1617, 1456, 1456, 1271, 1271, 1077, 1077,
+    898, 898, 753, 753, 662, 662, 625, 625, 576, 576, 448, 448,
+    266, 266, 115, 115, 29, 29, -11, -11, -18, -18, -35, -35,
+    -162, -162, -447, -447, -760, -760, -927, -927, -960, -960, -1039, -1039,
+    -1246, -1246, -1456, -1456, -1535, -1535, -1530, -1530, -1577, -1577, -1727, -1727,
+    -1942, -1942, -2158, -2158, -2312, -2312, -2387, -2387, -2447, -2447, -2577, -2577,
+    -2748, -2748, -2854, -2854, -2878, -2878, -2930, -2930, -3066, -3066, -3190, -3190,
+    -3204, -3204, -3193, -3193, -3324, -3324, -3589, -3589, -3799, -3799, -3870, -3870,
+    -4006, -4006, -4447, -4447, -5089, -5089, -5491, -5491, -5358, -5358, -4918, -4918,
+    -4655, -4655, -4726, -4726, -4861, -4861, -4837, -4837, -4791, -4791, -4919, -4919,
+    -5113, -5113, -5120, -5120, -4926, -4926, -4733, -4733, -4602, -4602, -4394, -4394,
+    -4075, -4075, -3840, -3840, -3833, -3833, -3929, -3929, -3921, -3921, -3787, -3787,
+    -3655, -3655, -3612, -3612, -3636, -3636, -3687, -3687, -3747, -3747, -3814, -3814,
+    -3890, -3890, -3977, -3977, -4050, -4050, -4051, -4051, -3930, -3930, -3704, -3704,
+    -3457, -3457, -3258, -3258, -3111, -3111, -2970, -2970, -2819, -2819, -2698, -2698,
+    -2636, -2636, -2568, -2568, -2374, -2374, -2017, -2017, -1580, -1580, -1150, -1150,
+    -733, -733, -331, -331, 15, 15, 296, 296, 559, 559, 803, 803,
+    938, 938, 934, 934, 938, 938, 1123, 1123, 1472, 1472, 1798, 1798,
+    1980, 1980, 2068, 2068, 2163, 2163, 2305, 2305, 2507, 2507, 2779, 2779,
+    3068, 3068, 3273, 3273, 3356, 3356, 3394, 3394, 3478, 3478, 3626, 3626,
+    3819, 3819, 4067, 4067, 4391, 4391, 4749, 4749, 5050, 5050, 5241, 5241,
+    5360, 5360, 5464, 5464, 5566, 5566, 5645, 5645, 5692, 5692, 5705, 5705,
+    5663, 5663, 5562, 5562, 5459, 5459, 5429, 5429, 5452, 5452, 5420, 5420,
+    5296, 5296, 5186, 5186, 5182, 5182, 5189, 5189, 5051, 5051, 4798, 4798,
+    4603, 4603, 4518, 4518, 4395, 4395, 4150, 4150, 3929, 3929, 3898, 3898,
+    3990, 3990, 4019, 4019, 3963, 3963, 3945, 3945, 3974, 3974, 3902, 3902,
+    3674, 3674, 3422, 3422, 3242, 3242, 3048, 3048, 2777, 2777, 2555, 2555,
+    2510, 2510, 2523, 2523, 2382, 2382, 2107, 2107, 1929, 1929, 1927, 1927,
+    1919, 1919, 1754, 1754, 1503, 1503, 1278, 1278, 1043, 1043, 758, 758,
+    547, 547, 523, 523, 576, 576, 506, 506, 306, 306, 146, 146,
+    103, 103, 85, 85, 6, 6, -105, -105, -214, -214, -361, -361,
+    -573, -573, -796, -796, -993, -993, -1194, -1194, -1404, -1404, -1533, -1533,
+    -1504, -1504, -1379, -1379, -1331, -1331, -1485, -1485, -1796, -1796, -2093, -2093,
+    -2260, -2260, -2338, -2338, -2428, -2428, -2569, -2569, -2744, -2744, -2953, -2953,
+    -3163, -3163, -3268, -3268, -3217, -3217, -3181, -3181, -3364, -3364, -3642, -3642,
+    -3660, -3660, -3416, -3416, -3407, -3407, -3946, -3946, -4645, -4645, -4951, -4951,
+    -4934, -4934, -5093, -5093, -5496, -5496, -5653, -5653, -5300, -5300, -4801, -4801,
+    -4581, -4581, -4573, -4573, -4553, -4553, -4636, -4636, -5006, -5006, -5400, -5400,
+    -5352, -5352, -4857, -4857, -4376, -4376, -4206, -4206, -4180, -4180, -4078, -4078,
+    -3974, -3974, -4014, -4014, -4080, -4080, -3940, -3940, -3619, -3619, -3395, -3395,
+    -3431, -3431, -3620, -3620, -3785, -3785, -3874, -3874, -3931, -3931, -3982, -3982,
+    -4003, -4003, -3969, -3969, -3877, -3877, -3718, -3718, -3476, -3476, -3175, -3175,
+    -2907, -2907, -2759, -2759, -2728, -2728, -2726, -2726, -2650, -2650, -2457, -2457,
+    -2162, -2162, -1795, -1795, -1370, -1370, -899, -899, -408, -408, 56, 56,
+    412, 412, 585, 585, 618, 618, 689, 689, 939, 939, 1281, 1281,
+    1496, 1496, 1513, 1513, 1519, 1519, 1719, 1719, 2095, 2095, 2466, 2466,
+    2730, 2730, 2910, 2910, 3024, 3024, 3057, 3057, 3070, 3070, 3194, 3194,
+    3444, 3444, 3678, 3678, 3791, 3791, 3864, 3864, 4039, 4039, 4327, 4327,
+    4640, 4640, 4929, 4929, 5192, 5192, 5397, 5397, 5502, 5502, 5542, 5542,
+    5607, 5607, 5709, 5709, 5766, 5766, 5732, 5732, 5666, 5666, 5623, 5623,
+    5570, 5570, 5453, 5453, 5313, 5313, 5256, 5256, 5332, 5332, 5458, 5458,
+    5480, 5480, 5303, 5303, 4970, 4970, 4618, 4618, 4363, 4363, 4233, 4233,
+    4197, 4197, 4214, 4214, 4246, 4246, 4242, 4242, 4162, 4162, 4037, 4037,
+    3945, 3945, 3906, 3906, 3842, 3842, 3674, 3674, 3426, 3426, 3185, 3185,
+    2993, 2993, 2818, 2818, 2636, 2636, 2493, 2493, 2438, 2438, 2426, 2426,
+    2343, 2343, 2151, 2151, 1921, 1921, 1732, 1732, 1588, 1588, 1458, 1458,
+    1329, 1329, 1199, 1199, 1039, 1039, 829, 829, 624, 624, 519, 519,
+    532, 532, 563, 563, 493, 493, 301, 301, 66, 66, -108, -108,
+    -166, -166, -156, -156, -207, -207, -418, -418, -757, -757, -1098, -1098,
+    -1326, -1326, -1394, -1394, -1339, -1339, -1255, -1255, -1249, -1249, -1376, -1376,
+    -1600, -1600, -1863, -1863, -2146, -2146, -2428, -2428, -2633, -2633, -2716, -2716,
+    -2779, -2779, -2929, -2929, -3087, -3087, -3123, -3123, -3141, -3141, -3350, -3350,
+    -3633, -3633, -3599, -3599, -3232, -3232, -3129, -3129, -3767, -3767, -4772, -4772,
+    -5326, -5326, -5220, -5220, -5013, -5013, -5128, -5128, -5307, -5307, -5163, -5163,
+    -4824, -4824, -4693, -4693, -4839, -4839, -4994, -4994, -5010, -5010, -4983, -4983,
+    -4981, -4981, -4925, -4925, -4782, -4782, -4672, -4672, -4671, -4671, -4675, -4675,
+    -4551, -4551, -4312, -4312, -4090, -4090, -3973, -3973, -3941, -3941, -3916, -3916,
+    -3860, -3860, -3823, -3823, -3888, -3888, -4058, -4058, -4257, -4257, -4432, -4432,
+    -4557, -4557, -4567, -4567, -4392, -4392, -4083, -4083, -3804, -3804, -3637, -3637,
+    -3516, -3516, -3370, -3370, -3241, -3241, -3166, -3166, -3059, -3059, -2835, -2835,
+    -2564, -2564, -2363, -2363, -2201, -2201, -1961, -1961, -1604, -1604, -1160, -1160,
+    -639, -639, -86, -86, 350, 350, 547, 547, 585, 585, 641, 641,
+    771, 771, 895, 895, 998, 998, 1178, 1178, 1474, 1474, 1779, 1779,
+    1998, 1998, 2175, 2175, 2391, 2391, 2646, 2646, 2887, 2887, 3097, 3097,
+    3277, 3277, 3435, 3435, 3601, 3601, 3825, 3825, 4117, 4117, 4419, 4419,
+    4653, 4653, 4804, 4804, 4957, 4957, 5221, 5221, 5599, 5599, 5943, 5943,
+    6076, 6076, 5981, 5981, 5826, 5826, 5775, 5775, 5804, 5804, 5775, 5775,
+    5641, 5641, 5502, 5502, 5454, 5454, 5496, 5496, 5563, 5563, 5572, 5572,
+    5458, 5458, 5234, 5234, 5007, 5007, 4869, 4869, 4801, 4801, 4709, 4709,
+    4558, 4558, 4406, 4406, 4311, 4311, 4273, 4273, 4281, 4281, 4349, 4349,
+    4448, 4448, 4464, 4464, 4319, 4319, 4069, 4069, 3848, 3848, 3693, 3693,
+    3504, 3504, 3172, 3172, 2749, 2749, 2441, 2441, 2391, 2391, 2496, 2496,
+    2519, 2519, 2351, 2351, 2095, 2095, 1894, 1894, 1767, 1767, 1655, 1655,
+    1543, 1543, 1442, 1442, 1293, 1293, 1018, 1018, 679, 679, 472, 472,
+    517, 517, 719, 719, 882, 882, 890, 890, 747, 747, 525, 525,
+    304, 304, 131, 131, -12, -12, -194, -194, -477, -477, -833, -833,
+    -1151, -1151, -1335, -1335, -1391, -1391, -1403, -1403, -1450, -1450, -1574, -1574,
+    -1774, -1774, -1999, -1999, -2163, -2163, -2248, -2248, -2365, -2365, -2639, -2639,
+    -2978, -2978, -3116, -3116, -2995, -2995, -2947, -2947, -3260, -3260, -3673, -3673,
+    -3658, -3658, -3206, -3206, -2973, -2973, -3480, -3480, -4472, -4472, -5288, -5288,
+    -5643, -5643, -5758, -5758, -5846, -5846, -5855, -5855, -5720, -5720, -5547, -5547,
+    -5429, -5429, -5317, -5317, -5181, -5181, -5124, -5124, -5218, -5218, -5362, -5362,
+    -5378, -5378, -5198, -5198, -4929, -4929, -4759, -4759, -4801, -4801, -4946, -4946,
+    -4913, -4913, -4546, -4546, -4041, -4041, -3770, -3770, -3834, -3834, -3971, -3971,
+    -3948, -3948, -3867, -3867, -3971, -3971, -4291, -4291, -4649, -4649, -4904, -4904,
+    -5036, -5036, -5034, -5034, -4862, -4862, -4560, -4560, -4276, -4276, -4115, -4115,
+    -4010, -4010, -3818, -3818, -3521, -3521, -3239, -3239, -3048, -3048, -2887, -2887,
+    -2691, -2691, -2490, -2490, -2300, -2300, -2017, -2017, -1544, -1544, -997, -997,
+    -587, -587, -306, -306, 67, 67, 593, 593, 1008, 1008, 1077, 1077,
+    938, 938, 913, 913, 1086, 1086, 1294, 1294, 1457, 1457, 1667, 1667,
+    1965, 1965, 2241, 2241, 2440, 2440, 2677, 2677, 3057, 3057, 3493, 3493,
+    3824, 3824, 4031, 4031, 4216, 4216, 4432, 4432, 4619, 4619, 4750, 4750,
+    4897, 4897, 5127, 5127, 5408, 5408, 5682, 5682, 5961, 5961, 6269, 6269,
+    6523, 6523, 6585, 6585, 6426, 6426, 6166, 6166, 5918, 5918, 5711, 5711,
+    5572, 5572, 5572, 5572, 5685, 5685, 5730, 5730, 5580, 5580, 5354, 5354,
+    5238, 5238, 5214, 5214, 5125, 5125, 4949, 4949, 4808, 4808, 4743, 4743,
+    4655, 4655, 4493, 4493, 4338, 4338, 4257, 4257, 4206, 4206, 4159, 4159,
+    4167, 4167, 4226, 4226, 4206, 4206, 4016, 4016, 3750, 3750, 3530, 3530,
+    3302, 3302, 2932, 2932, 2455, 2455, 2100, 2100, 2018, 2018, 2077, 2077,
+    2013, 2013, 1756, 1756, 1507, 1507, 1443, 1443, 1460, 1460, 1341, 1341,
+    1092, 1092, 925, 925, 923, 923, 899, 899, 680, 680, 344, 344,
+    82, 82, -40, -40, -44, -44, 87, 87, 309, 309, 393, 393,
+    160, 160, -197, -197, -304, -304, -175, -175, -295, -295, -966, -966,
+    -1814, -1814, -2183, -2183, -1943, -1943, -1604, -1604, -1647, -1647, -2005, -2005,
+    -2334, -2334, -2532, -2532, -2703, -2703, -2826, -2826, -2824, -2824, -2900, -2900,
+    -3351, -3351, -3994, -3994, -4234, -4234, -3885, -3885, -3517, -3517, -3695, -3695,
+    -4198, -4198, -4406, -4406, -4274, -4274, -4438, -4438, -5290, -5290, -6384, -6384,
+    -6948, -6948, -6724, -6724, -6135, -6135, -5767, -5767, -5808, -5808, -5964, -5964,
+    -5912, -5912, -5745, -5745, -5756, -5756, -5859, -5859, -5666, -5666, -5201, -5201,
+    -5001, -5001, -5287, -5287, -5537, -5537, -5268, -5268, -4792, -4792, -4671, -4671,
+    -4780, -4780, -4580, -4580, -4113, -4113, -3928, -3928, -4071, -4071, -4002, -4002,
+    -3627, -3627, -3556, -3556, -4080, -4080, -4655, -4655, -4743, -4743, -4543, -4543,
+    -4493, -4493, -4540, -4540, -4329, -4329, -3822, -3822, -3324, -3324, -3021, -3021,
+    -2822, -2822, -2618, -2618, -2414, -2414, -2189, -2189, -1890, -1890, -1569, -1569,
+    -1356, -1356, -1292, -1292, -1265, -1265, -1045, -1045, -426, -426, 475, 475,
+    1192, 1192, 1442, 1442, 1501, 1501, 1723, 1723, 1962, 1962, 1918, 1918,
+    1779, 1779, 1988, 1988, 2459, 2459, 2629, 2629, 2358, 2358, 2241, 2241,
+    2724, 2724, 3428, 3428, 3789, 3789, 3919, 3919, 4282, 4282, 4860, 4860,
+    5240, 5240, 5304, 5304, 5302, 5302, 5385, 5385, 5496, 5496, 5633, 5633,
+    5899, 5899, 6263, 6263, 6498, 6498, 6471, 6471, 6388, 6388, 6571, 6571,
+    7001, 7001, 7243, 7243, 6904, 6904, 6096, 6096, 5364, 5364, 5136, 5136,
+    5273, 5273, 5292, 5292, 5026, 5026, 4795, 4795, 4827, 4827, 4889, 4889,
+    4687, 4687, 4337, 4337, 4169, 4169, 4267, 4267, 4409, 4409, 4359, 4359,
+    4077, 4077, 3687, 3687, 3359, 3359, 3216, 3216, 3277, 3277, 3432, 3432,
+    3512, 3512, 3451, 3451, 3286, 3286, 3035, 3035, 2680, 2680, 2278, 2278,
+    1919, 1919, 1606, 1606, 1282, 1282, 946, 946, 634, 634, 371, 371,
+    219, 219, 268, 268, 465, 465, 582, 582, 453, 453, 189, 189,
+    40, 40, 57, 57, 39, 39, -145, -145, -335, -335, -366, -366,
+    -367, -367, -549, -549, -799, -799, -789, -789, -466, -466, -174, -174,
+    -232, -232, -593, -593, -1014, -1014, -1406, -1406, -1862, -1862, -2372, -2372,
+    -2741, -2741, -2847, -2847, -2821, -2821, -2880, -2880, -3078, -3078, -3281, -3281,
+    -3346, -3346, -3301, -3301, -3381, -3381, -3766, -3766, -4241, -4241, -4361, -4361,
+    -4063, -4063, -3834, -3834, -4022, -4022, -4338, -4338, -4411, -4411, -4579, -4579,
+    -5502, -5502, -6997, -6997, -7964, -7964, -7806, -7806, -7260, -7260, -7264, -7264,
+    -7586, -7586, -7396, -7396, -6748, -6748, -6481, -6481, -6774, -6774, -6853, -6853,
+    -6300, -6300, -5740, -5740, -5771, -5771, -5943, -5943, -5487, -5487, -4614, -4614,
+    -4246, -4246, -4576, -4576, -4792, -4792, -4352, -4352, -3737, -3737, -3558, -3558,
+    -3596, -3596, -3296, -3296, -2785, -2785, -2771, -2771, -3473, -3473, -4206, -4206,
+    -4290, -4290, -3962, -3962, -3922, -3922, -4210, -4210, -4155, -4155, -3434, -3434,
+    -2552, -2552, -2097, -2097, -1998, -1998, -1805, -1805, -1368, -1368, -888, -888,
+    -489, -489, -104, -104, 244, 244, 421, 421, 540, 540, 937, 937,
+    1676, 1676, 2412, 2412, 2864, 2864, 3092, 3092, 3241, 3241, 3346, 3346,
+    3455, 3455, 3604, 3604, 3634, 3634, 3355, 3355, 2931, 2931, 2818, 2818,
+    3191, 3191, 3673, 3673, 3838, 3838, 3793, 3793, 3968, 3968, 4477, 4477,
+    5030, 5030, 5402, 5402, 5639, 5639, 5837, 5837, 6033, 6033, 6305, 6305,
+    6695, 6695, 7025, 7025, 7021, 7021, 6687, 6687, 6415, 6415, 6615, 6615,
+    7226, 7226, 7730, 7730, 7674, 7674, 7098, 7098, 6348, 6348, 5663, 5663,
+    5075, 5075, 4592, 4592, 4229, 4229, 3904, 3904, 3513, 3513, 3152, 3152,
+    3068, 3068, 3288, 3288, 3465, 3465, 3278, 3278, 2860, 2860, 2604, 2604,
+    2659, 2659, 2838, 2838, 2938, 2938, 2896, 2896, 2704, 2704, 2432, 2432,
+    2274, 2274, 2347, 2347, 2491, 2491, 2464, 2464, 2236, 2236, 1958, 1958,
+    1722, 1722, 1502, 1502, 1241, 1241, 856, 856, 241, 241, -576, -576,
+    -1310, -1310, -1628, -1628, -1515, -1515, -1278, -1278, -1146, -1146, -1062, -1062,
+    -910, -910, -735, -735, -643, -643, -648, -648, -677, -677, -642, -642,
+    -516, -516, -397, -397, -412, -412, -539, -539, -645, -645, -675, -675,
+    -645, -645, -570, -570, -529, -529, -696, -696, -1101, -1101, -1519, -1519,
+    -1764, -1764, -1969, -1969, -2366, -2366, -2885, -2885, -3253, -3253, -3461, -3461,
+    -3729, -3729, -3976, -3976, -3898, -3898, -3675, -3675, -3888, -3888, -4484, -4484,
+    -4630, -4630, -4002, -4002, -3396, -3396, -3603, -3603, -4400, -4400, -5206, -5206,
+    -6059, -6059, -7240, -7240, -8396, -8396, -8884, -8884, -8794, -8794, -8746, -8746,
+    -8714, -8714, -8022, -8022, -6700, -6700, -5849, -5849, -6174, -6174, -6983, -6983,
+    -7152, -7152, -6497, -6497, -5685, -5685, -5207, -5207, -4933, -4933, -4564, -4564,
+    -4123, -4123, -3824, -3824, -3653, -3653, -3402, -3402, -3059, -3059, -2857, -2857,
+    -2874, -2874, -2879, -2879, -2670, -2670, -2417, -2417, -2500, -2500, -3028, -3028,
+    -3669, -3669, -4033, -4033, -4029, -4029, -3711, -3711, -3077, -3077, -2234, -2234,
+    -1455, -1455, -826, -826, -191, -191, 446, 446, 851, 851, 1003, 1003,
+    1205, 1205, 1616, 1616, 2072, 2072, 2468, 2468, 2959, 2959, 3571, 3571,
+    3952, 3952, 3872, 3872, 3727, 3727, 4037, 4037, 4623, 4623, 4836, 4836,
+    4513, 4513, 4100, 4100, 3869, 3869, 3662, 3662, 3409, 3409, 3348, 3348,
+    3582, 3582, 3862, 3862, 3967, 3967, 4067, 4067, 4478, 4478, 5188, 5188,
+    5850, 5850, 6245, 6245, 6505, 6505, 6816, 6816, 7129, 7129, 7292, 7292,
+    7310, 7310, 7312, 7312, 7341, 7341, 7288, 7288, 7072, 7072, 6819, 6819,
+    6694, 6694, 6605, 6605, 6272, 6272, 5615, 5615, 4847, 4847, 4145, 4145,
+    3480, 3480, 2824, 2824, 2310, 2310, 2065, 2065, 2032, 2032, 2032, 2032,
+    1953, 1953, 1824, 1824, 1750, 1750, 1796, 1796, 1930, 1930, 2068, 2068,
+    2157, 2157, 2205, 2205, 2206, 2206, 2117, 2117, 1951, 1951, 1814, 1814,
+    1743, 1743, 1582, 1582, 1194, 1194, 722, 722, 432, 432, 337, 337,
+    193, 193, -158, -158, -659, -659, -1218, -1218, -1777, -1777, -2200, -2200,
+    -2341, -2341, -2240, -2240, -2061, -2061, -1842, -1842, -1482, -1482, -999, -999,
+    -597, -597, -430, -430, -431, -431, -430, -430, -363, -363, -256, -256,
+    -110, -110, 72, 72, 193, 193, 124, 124, -130, -130, -421, -421,
+    -617, -617, -755, -755, -1002, -1002, -1424, -1424, -1853, -1853, -2126, -2126,
+    -2373, -2373, -2796, -2796, -3247, -3247, -3426, -3426, -3440, -3440, -3677, -3677,
+    -4096, -4096, -4198, -4198, -3874, -3874, -3695, -3695, -3988, -3988, -4160, -4160,
+    -3591, -3591, -2857, -2857, -3218, -3218, -4920, -4920, -6810, -6810, -7800, -7800,
+    -8018, -8018, -8251, -8251, -8815, -8815, -9298, -9298, -9138, -9138, -8207, -8207,
+    -6987, -6987, -6186, -6186, -6095, -6095, -6363, -6363, -6494, -6494, -6351, -6351,
+    -6010, -6010, -5395, -5395, -4495, -4495, -3761, -3761, -3688, -3688, -3974, -3974,
+    -3777, -3777, -2948, -2948, -2279, -2279, -2271, -2271, -2402, -2402, -2082, -2082,
+    -1636, -1636, -1729, -1729, -2290, -2290, -2676, -2676, -2696, -2696, -2791, -2791,
+    -3146, -3146, -3253, -3253, -2629, -2629, -1548, -1548, -646, -646, -76, -76,
+    536, 536, 1391, 1391, 2177, 2177, 2518, 2518, 2491, 2491, 2514, 2514,
+    2794, 2794, 3146, 3146, 3411, 3411, 3718, 3718, 4149, 4149, 4467, 4467,
+    4497, 4497, 4518, 4518, 4862, 4862, 5327, 5327, 5406, 5406, 5006, 5006,
+    4549, 4549, 4322, 4322, 4173, 4173, 3961, 3961, 3895, 3895, 4143, 4143,
+    4462, 4462, 4585, 4585, 4706, 4706, 5178, 5178, 5907, 5907, 6476, 6476,
+    6744, 6744, 6942, 6942, 7189, 7189, 7291, 7291, 7071, 7071, 6675, 6675,
+    6368, 6368, 6205, 6205, 6055, 6055, 5897, 5897, 5847, 5847, 5880, 5880,
+    5760, 5760, 5322, 5322, 4692, 4692, 4121, 4121, 3688, 3688, 3275, 3275,
+    2789, 2789, 2302, 2302, 1932, 1932, 1678, 1678, 1491, 1491, 1400, 1400,
+    1453, 1453, 1561, 1561, 1567, 1567, 1449, 1449, 1340, 1340, 1334, 1334,
+    1372, 1372, 1316, 1316, 1096, 1096, 774, 774, 474, 474, 257, 257,
+    85, 85, -78, -78, -199, -199, -248, -248, -279, -279, -388, -388,
+    -589, -589, -802, -802, -982, -982, -1184, -1184, -1430, -1430, -1604, -1604,
+    -1599, -1599, -1474, -1474, -1354, -1354, -1243, -1243, -1058, -1058, -800, -800,
+    -572, -572, -442, -442, -390, -390, -382, -382, -439, -439, -582, -582,
+    -770, -770, -943, -943, -1102, -1102, -1271, -1271, -1416, -1416, -1505, -1505,
+    -1610, -1610, -1803, -1803, -2002, -2002, -2090, -2090, -2184, -2184, -2566, -2566,
+    -3231, -3231, -3747, -3747, -3834, -3834, -3864, -3864, -4375, -4375, -5132, -5132,
+    -5251, -5251, -4426, -4426, -3507, -3507, -3500, -3500, -4428, -4428, -5592, -5592,
+    -6613, -6613, -7611, -7611, -8552, -8552, -9120, -9120, -9282, -9282, -9351, -9351,
+    -9270, -9270, -8494, -8494, -6958, -6958, -5593, -5593, -5270, -5270, -5629, -5629,
+    -5612, -5612, -4964, -4964, -4421, -4421, -4402, -4402, -4356, -4356, -3759, -3759,
+    -3059, -3059, -2997, -2997, -3397, -3397, -3403, -3403, -2765, -2765, -2127, -2127,
+    -1949, -1949, -1859, -1859, -1427, -1427, -954, -954, -1000, -1000, -1497, -1497,
+    -1914, -1914, -2075, -2075, -2195, -2195, -2198, -2198, -1646, -1646, -472, -472,
+    786, 786, 1690, 1690, 2399, 2399, 3184, 3184, 3872, 3872, 4149, 4149,
+    4095, 4095, 4042, 4042, 4067, 4067, 4059, 4059, 4106, 4106, 4390, 4390,
+    4736, 4736, 4770, 4770, 4532, 4532, 4501, 4501, 4874, 4874, 5224, 5224,
+    5113, 5113, 4701, 4701, 4426, 4426, 4333, 4333, 4112, 4112, 3704, 3704,
+    3439, 3439, 3530, 3530, 3811, 3811, 4115, 4115, 4576, 4576, 5325, 5325,
+    6134, 6134, 6647, 6647, 6845, 6845, 6960, 6960, 6997, 6997, 6674, 6674,
+    5950, 5950, 5268, 5268, 5032, 5032, 5080, 5080, 4956, 4956, 4580, 4580,
+    4296, 4296, 4301, 4301, 4350, 4350, 4137, 4137, 3705, 3705, 3273, 3273,
+    2858, 2858, 2325, 2325, 1741, 1741, 1373, 1373, 1303, 1303, 1278, 1278,
+    1094, 1094, 906, 906, 1009, 1009, 1392, 1392, 1721, 1721, 1746, 1746,
+    1541, 1541, 1309, 1309, 1109, 1109, 870, 870, 568, 568, 250, 250,
+    -52, -52, -332, -332, -572, -572, -760, -760, -915, -915, -1014, -1014,
+    -974, -974, -786, -786, -624, -624, -667, -667, -850, -850, -943, -943,
+    -908, -908, -970, -970, -1235, -1235, -1438, -1438, -1267, -1267, -829, -829,
+    -531, -531, -517, -517, -496, -496, -232, -232, 39, 39, -80, -80,
+    -565, -565, -992, -992, -1130, -1130, -1214, -1214, -1527, -1527, -1950, -1950,
+    -2164, -2164, -2142, -2142, -2190, -2190, -2493, -2493, -2855, -2855, -2994, -2994,
+    -2945, -2945, -3009, -3009, -3358, -3358, -3801, -3801, -4033, -4033, -4027, -4027,
+    -4008, -4008, -4041, -4041, -3892, -3892, -3555, -3555, -3679, -3679, -4930, -4930,
+    -6908, -6908, -8333, -8333, -8591, -8591, -8525, -8525, -9126, -9126, -9939, -9939,
+    -9658, -9658, -8073, -8073, -6440, -6440, -5747, -5747, -5612, -5612, -5317, -5317,
+    -4990, -4990, -5005, -5005, -4932, -4932, -4131, -4131, -3018, -3018, -2673, -2673,
+    -3191, -3191, -3440, -3440, -2742, -2742, -1863, -1863, -1788, -1788, -2250, -2250,
+    -2224, -2224, -1467, -1467, -732, -732, -582, -582, -789, -789, -997, -997,
+    -1286, -1286, -1730, -1730, -1924, -1924, -1450, -1450, -545, -545, 214, 214,
+    767, 767, 1598, 1598, 2867, 2867, 4041, 4041, 4590, 4590, 4629, 4629,
+    4596, 4596, 4608, 4608, 4541, 4541, 4472, 4472, 4608, 4608, 4824, 4824,
+    4758, 4758, 4417, 4417, 4261, 4261, 4532, 4532, 4874, 4874, 4867, 4867,
+    4601, 4601, 4411, 4411, 4310, 4310, 4072, 4072, 3722, 3722, 3549, 3549,
+    3631, 3631, 3728, 3728, 3732, 3732, 3911, 3911, 4523, 4523, 5377, 5377,
+    6042, 6042, 6371, 6371, 6558, 6558, 6704, 6704, 6619, 6619, 6144, 6144,
+    5472, 5472, 4955, 4955, 4667, 4667, 4363, 4363, 3878, 3878, 3402, 3402,
+    3246, 3246, 3431, 3431, 3647, 3647, 3586, 3586, 3205, 3205, 2691, 2691,
+    2259, 2259, 1987, 1987, 1775, 1775, 1482, 1482, 1119, 1119, 864, 864,
+    860, 860, 1072, 1072, 1355, 1355, 1607, 1607, 1775, 1775, 1779, 1779,
+    1558, 1558, 1197, 1197, 873, 873, 622, 622, 293, 293, -202, -202,
+    -706, -706, -1001, -1001, -1088, -1088, -1149, -1149, -1254, -1254, -1252, -1252,
+    -1031, -1031, -756, -756, -677, -677, -756, -756, -732, -732, -565, -565,
+    -557, -557, -883, -883, -1261, -1261, -1297, -1297, -1004, -1004, -718, -718,
+    -592, -592, -471, -471, -269, -269, -152, -152, -256, -256, -493, -493,
+    -760, -760, -1098, -1098, -1499, -1499, -1808, -1808, -1972, -1972, -2156, -2156,
+    -2442, -2442, -2659, -2659, -2699, -2699, -2773, -2773, -3078, -3078, -3405, -3405,
+    -3424, -3424, -3261, -3261, -3378, -3378, -3832, -3832, -4087, -4087, -3741, -3741,
+    -3121, -3121, -2899, -2899, -3372, -3372, -4380, -4380, -5682, -5682, -7075, -7075,
+    -8244, -8244, -8919, -8919, -9217, -9217, -9485, -9485, -9670, -9670, -9204, -9204,
+    -7802, -7802, -6085, -6085, -5030, -5030, -4912, -4912, -5146, -5146, -5100, -5100,
+    -4671, -4671, -4074, -4074, -3465, -3465, -2944, -2944, -2617, -2617, -2446, -2446,
+    -2229, -2229, -1875, -1875, -1549, -1549, -1398, -1398, -1326, -1326, -1172, -1172,
+    -922, -922, -630, -630, -361, -361, -328, -328, -775, -775, -1525, -1525,
+    -1931, -1931, -1598, -1598, -852, -852, -191, -191, 449, 449, 1449, 1449,
+    2728, 2728, 3769, 3769, 4352, 4352, 4750, 4750, 5115, 5115, 5213, 5213,
+    4922, 4922, 4577, 4577, 4528, 4528, 4679, 4679, 4743, 4743, 4693, 4693,
+    4682, 4682, 4710, 4710, 4676, 4676, 4621, 4621, 4652, 4652, 4662, 4662,
+    4422, 4422, 3957, 3957, 3586, 3586, 3510, 3510, 3566, 3566, 3523, 3523,
+    3455, 3455, 3632, 3632, 4114, 4114, 4674, 4674, 5159, 5159, 5693, 5693,
+    6348, 6348, 6814, 6814, 6683, 6683, 6029, 6029, 5381, 5381, 5021, 5021,
+    4637, 4637, 3890, 3890, 3065, 3065, 2745, 2745, 2955, 2955, 3099, 3099,
+    2821, 2821, 2507, 2507, 2633, 2633, 2969, 2969, 2867, 2867, 2218, 2218,
+    1619, 1619, 1508, 1508, 1583, 1583, 1358, 1358, 939, 939, 815, 815,
+    1068, 1068, 1283, 1283, 1241, 1241, 1214, 1214, 1389, 1389, 1448, 1448,
+    1044, 1044, 398, 398, -8, -8, -147, -147, -423, -423, -981, -981,
+    -1476, -1476, -1603, -1603, -1509, -1509, -1476, -1476, -1505, -1505, -1404, -1404,
+    -1132, -1132, -829, -829, -601, -601, -475, -475, -483, -483, -638, -638,
+    -825, -825, -883, -883, -805, -805, -749, -749, -810, -810, -871, -871,
+    -760, -760, -521, -521, -421, -421, -643, -643, -1048, -1048, -1363, -1363,
+    -1558, -1558, -1860, -1860, -2350, -2350, -2757, -2757, -2831, -2831, -2742, -2742,
+    -2853, -2853, -3149, -3149, -3247, -3247, -3016, -3016, -2846, -2846, -3072, -3072,
+    -3434, -3434, -3476, -3476, -3273, -3273, -3276, -3276, -3502, -3502, -3522, -3522,
+    -3438, -3438, -4161, -4161, -6109, -6109, -8189, -8189, -8976, -8976, -8676, -8676,
+    -8807, -8807, -9804, -9804, -10186, -10186, -8727, -8727, -6417, -6417, -5139, -5139,
+    -5123, -5123, -5065, -5065, -4429, -4429, -4058, -4058, -4321, -4321, -4217, -4217,
+    -3058, -3058, -1819, -1819, -1693, -1693, -2203, -2203, -2004, -2004, -1059, -1059,
+    -620, -620, -1149, -1149, -1608, -1608, -1156, -1156, -386, -386, -263, -263,
+    -692, -692, -957, -957, -967, -967, -1163, -1163, -1471, -1471, -1272, -1272,
+    -407, -407, 585, 585, 1380, 1380, 2312, 2312, 3587, 3587, 4691, 4691,
+    5095, 5095, 5088, 5088, 5289, 5289, 5621, 5621, 5484, 5484, 4859, 4859,
+    4477, 4477, 4710, 4710, 4985, 4985, 4705, 4705, 4196, 4196, 4172, 4172,
+    4608, 4608, 4805, 4805, 4468, 4468, 4056, 4056, 3969, 3969, 3971, 3971,
+    3714, 3714, 3391, 3391, 3453, 3453, 3901, 3901, 4285, 4285, 4380, 4380,
+    4478, 4478, 4921, 4921, 5586, 5586, 6052, 6052, 6151, 6151, 6092, 6092,
+    6031, 6031, 5784, 5784, 5148, 5148, 4310, 4310, 3659, 3659, 3264, 3264,
+    2860, 2860, 2376, 2376, 2123, 2123, 2277, 2277, 2530, 2530, 2514, 2514,
+    2323, 2323, 2261, 2261, 2265, 2265, 2028, 2028, 1601, 1601, 1399, 1399,
+    1545, 1545, 1657, 1657, 1450, 1450, 1176, 1176, 1187, 1187, 1368, 1368,
+    1343, 1343, 1053, 1053, 762, 762, 573, 573, 290, 290, -194, -194,
+    -690, -690, -1007, -1007, -1214, -1214, -1457, -1457, -1698, -1698, -1805, -1805,
+    -1778, -1778, -1705, -1705, -1566, -1566, -1271, -1271, -877, -877, -562, -562,
+    -399, -399, -324, -324, -335, -335, -510, -510, -778, -778, -903, -903,
+    -816, -816, -761, -761, -927, -927, -1120, -1120, -1055, -1055, -858, -858,
+    -963, -963, -1495, -1495, -2049, -2049, -2222, -2222, -2145, -2145, -2268, -2268,
+    -2709, -2709, -3064, -3064, -2982, -2982, -2711, -2711, -2811, -2811, -3315, -3315,
+    -3565, -3565, -3140, -3140, -2640, -2640, -2973, -2973, -3937, -3937, -4271, -4271,
+    -3388, -3388, -2373, -2373, -2635, -2635, -4066, -4066, -5410, -5410, -6153, -6153,
+    -7000, -7000, -8371, -8371, -9533, -9533, -9764, -9764, -9467, -9467, -9301, -9301,
+    -8875, -8875, -7384, -7384, -5269, -5269, -4056, -4056, -4326, -4326, -4877, -4877,
+    -4405, -4405, -3208, -3208, -2470, -2470, -2446, -2446, -2338, -2338, -1756, -1756,
+    -1281, -1281, -1373, -1373, -1588, -1588, -1378, -1378, -1004, -1004, -1010, -1010,
+    -1191, -1191, -885, -885, -137, -137, 214, 214, -254, -254, -929, -929,
+    -1050, -1050, -678, -678, -329, -329, -51, -51, 580, 580, 1702, 1702,
+    2930, 2930, 3894, 3894, 4621, 4621, 5259, 5259, 5761, 5761, 5971, 5971,
+    5862, 5862, 5532, 5532, 5113, 5113, 4742, 4742, 4513, 4513, 4379, 4379,
+    4217, 4217, 4024, 4024, 3945, 3945, 4057, 4057, 4254, 4254, 4392, 4392,
+    4433, 4433, 4383, 4383, 4220, 4220, 3993, 3993, 3877, 3877, 3992, 3992,
+    4218, 4218, 4346, 4346, 4374, 4374, 4507, 4507, 4851, 4851, 5270, 5270,
+    5574, 5574, 5748, 5748, 5859, 5859, 5850, 5850, 5578, 5578, 5041, 5041,
+    4405, 4405, 3782, 3782, 3127, 3127, 2439, 2439, 1922, 1922, 1788, 1788,
+    1966, 1966, 2169, 2169, 2258, 2258, 2346, 2346, 2511, 2511, 2602, 2602,
+    2464, 2464, 2211, 2211, 2062, 2062, 1989, 1989, 1750, 1750, 1303, 1303,
+    945, 945, 904, 904, 991, 991, 852, 852, 466, 466, 150, 150,
+    88, 88, 89, 89, -95, -95, -423, -423, -698, -698, -909, -909,
+    -1204, -1204, -1573, -1573, -1783, -1783, -1704, -1704, -1502, -1502, -1383, -1383,
+    -1293, -1293, -1029, -1029, -594, -594, -245, -245, -184, -184, -333, -333,
+    -500, -500, -642, -642, -845, -845, -1111, -1111, -1312, -1312, -1395, -1395,
+    -1480, -1480, -1663, -1663, -1835, -1835, -1842, -1842, -1773, -1773, -1877, -1877,
+    -2175, -2175, -2397, -2397, -2405, -2405, -2445, -2445, -2772, -2772, -3205, -3205,
+    -3384, -3384, -3344, -3344, -3447, -3447, -3757, -3757, -3936, -3936, -3870, -3870,
+    -3897, -3897, -4113, -4113, -3984, -3984, -3223, -3223, -2688, -2688, -3570, -3570,
+    -5704, -5704, -7562, -7562, -8196, -8196, -8363, -8363, -9143, -9143, -10181, -10181,
+    -10214, -10214, -8961, -8961, -7419, -7419, -6295, -6295, -5255, -5255, -4053, -4053,
+    -3337, -3337, -3565, -3565, -3906, -3906, -3251, -3251, -1917, -1917, -1272, -1272,
+    -1738, -1738, -2262, -2262, -1982, -1982, -1406, -1406, -1401, -1401, -1825, -1825,
+    -1921, -1921, -1547, -1547, -1180, -1180, -938, -938, -494, -494, 68, 68,
+    143, 143, -424, -424, -910, -910, -643, -643, 160, 160, 897, 897,
+    1501, 1501, 2344, 2344, 3472, 3472, 4523, 4523, 5326, 5326, 6007, 6007,
+    6478, 6478, 6357, 6357, 5643, 5643, 4971, 4971, 4832, 4832, 4892, 4892,
+    4525, 4525, 3788, 3788, 3339, 3339, 3448, 3448, 3669, 3669, 3630, 3630,
+    3599, 3599, 3924, 3924, 4349, 4349, 4400, 4400, 4194, 4194, 4292, 4292,
+    4783, 4783, 5081, 5081, 4801, 4801, 4367, 4367, 4406, 4406, 4891, 4891,
+    5291, 5291, 5398, 5398, 5517, 5517, 5816, 5816, 5963, 5963, 5613, 5613,
+    4944, 4944, 4401, 4401, 4075, 4075, 3641, 3641, 2924, 2924, 2217, 2217,
+    1939, 1939, 2133, 2133, 2476, 2476, 2665, 2665, 2656, 2656, 2571, 2571,
+    2532, 2532, 2586, 2586, 2677, 2677, 2662, 2662, 2419, 2419, 1984, 1984,
+    1536, 1536, 1228, 1228, 1047, 1047, 873, 873, 623, 623, 332, 332,
+    104, 104, 9, 9, 10, 10, -13, -13, -145, -145, -388, -388,
+    -692, -692, -1001, -1001, -1230, -1230, -1306, -1306, -1273, -1273, -1251, -1251,
+    -1229, -1229, -1056, -1056, -703, -703, -400, -400, -335, -335, -375, -375,
+    -328, -328, -331, -331, -658, -658, -1196, -1196, -1520, -1520, -1541, -1541,
+    -1653, -1653, -2068, -2068, -2429, -2429, -2389, -2389, -2185, -2185, -2250, -2250,
+    -2512, -2512, -2560, -2560, -2390, -2390, -2437, -2437, -2834, -2834, -3165, -3165,
+    -3141, -3141, -3085, -3085, -3401, -3401, -3912, -3912, -4153, -4153, -4097, -4097,
+    -4122, -4122, -4270, -4270, -4106, -4106, -3532, -3532, -3314, -3314, -4297, -4297,
+    -6226, -6226, -7883, -7883, -8530, -8530, -8715, -8715, -9291, -9291, -10055, -10055,
+    -9960, -9960, -8609, -8609, -6842, -6842, -5636, -5636, -4983, -4983, -4342, -4342,
+    -3708, -3708, -3514, -3514, -3641, -3641, -3368, -3368, -2486, -2486, -1747, -1747,
+    -1801, -1801, -2250, -2250, -2290, -2290, -1917, -1917, -1794, -1794, -2087, -2087,
+    -2156, -2156, -1571, -1571, -758, -758, -330, -330, -274, -274, -233, -233,
+    -187, -187, -348, -348, -582, -582, -474, -474, 77, 77, 773, 773,
+    1474, 1474, 2379, 2379, 3523, 3523, 4514, 4514, 5046, 5046, 5315, 5315,
+    5594, 5594, 5708, 5708, 5351, 5351, 4730, 4730, 4396, 4396, 4448, 4448,
+    4398, 4398, 3972, 3972, 3585, 3585, 3715, 3715, 4141, 4141, 4278, 4278,
+    4079, 4079, 4065, 4065, 4439, 4439, 4727, 4727, 4547, 4547, 4256, 4256,
+    4413, 4413, 4882, 4882, 5016, 5016, 4671, 4671, 4440, 4440, 4731, 4731,
+    5155, 5155, 5207, 5207, 5080, 5080, 5269, 5269, 5638, 5638, 5535, 5535,
+    4801, 4801, 4038, 4038, 3705, 3705, 3501, 3501, 2985, 2985, 2371, 2371,
+    2237, 2237, 2628, 2628, 2992, 2992, 2979, 2979, 2825, 2825, 2856, 2856,
+    2990, 2990, 2956, 2956, 2749, 2749, 2593, 2593, 2541, 2541, 2378, 2378,
+    1976, 1976, 1529, 1529, 1284, 1284, 1176, 1176, 934, 934, 516, 516,
+    203, 203, 188, 188, 305, 305, 290, 290, 147, 147, 37, 37,
+    -68, -68, -320, -320, -646, -646, -799, -799, -759, -759, -768, -768,
+    -885, -885, -855, -855, -557, -557, -242, -242, -151, -151, -176, -176,
+    -142, -142, -178, -178, -510, -510, -1023, -1023, -1375, -1375, -1481, -1481,
+    -1591, -1591, -1872, -1872, -2180, -2180, -2323, -2323, -2340, -2340, -2395, -2395,
+    -2531, -2531, -2645, -2645, -2678, -2678, -2743, -2743, -2969, -2969, -3257, -3257,
+    -3339, -3339, -3217, -3217, -3313, -3313, -3909, -3909, -4559, -4559, -4502, -4502,
+    -3723, -3723, -3152, -3152, -3577, -3577, -4734, -4734, -5837, -5837, -6660, -6660,
+    -7560, -7560, -8620, -8620, -9401, -9401, -9599, -9599, -9383, -9383, -8899, -8899,
+    -7927, -7927, -6407, -6407, -4947, -4947, -4327, -4327, -4538, -4538, -4746, -4746,
+    -4299, -4299, -3453, -3453, -2872, -2872, -2719, -2719, -2614, -2614, -2352, -2352,
+    -2219, -2219, -2438, -2438, -2686, -2686, -2532, -2532, -2125, -2125, -1976, -1976,
+    -2089, -2089, -1869, -1869, -1081, -1081, -360, -360, -394, -394, -946, -946,
+    -1206, -1206, -876, -876, -360, -360, 72, 72, 691, 691, 1701, 1701,
+    2740, 2740, 3394, 3394, 3826, 3826, 4433, 4433, 5096, 5096, 5283, 5283,
+    4856, 4856, 4319, 4319, 4149, 4149, 4246, 4246, 4226, 4226, 3981, 3981,
+    3691, 3691, 3472, 3472, 3326, 3326, 3350, 3350, 3662, 3662, 4096, 4096,
+    4293, 4293, 4183, 4183, 4103, 4103, 4319, 4319, 4646, 4646, 4737, 4737,
+    4572, 4572, 4422, 4422, 4416, 4416, 4446, 4446, 4486, 4486, 4699, 4699,
+    5112, 5112, 5451, 5451, 5478, 5478, 5298, 5298, 5119, 5119, 4893, 4893,
+    4432, 4432, 3790, 3790, 3263, 3263, 2999, 2999, 2858, 2858, 2727, 2727,
+    2728, 2728, 2951, 2951, 3189, 3189, 3188, 3188, 3025, 3025, 2981, 2981,
+    3088, 3088, 3063, 3063, 2736, 2736, 2304, 2304, 2035, 2035, 1889, 1889,
+    1638, 1638, 1258, 1258, 960, 960, 836, 836, 716, 716, 479, 479,
+    280, 280, 310, 310, 471, 471, 493, 493, 309, 309, 122, 122,
+    63, 63, 3, 3, -194, -194, -388, -388, -352, -352, -141, -141,
+    -26, -26, -74, -74, -71, -71, 98, 98, 209, 209, 14, 14,
+    -381, -381, -679, -679, -832, -832, -1060, -1060, -1430, -1430, -1735, -1735,
+    -1850, -1850, -1934, -1934, -2130, -2130, -2324, -2324, -2377, -2377, -2381, -2381,
+    -2487, -2487, -2626, -2626, -2650, -2650, -2625, -2625, -2744, -2744, -3016, -3016,
+    -3310, -3310, -3615, -3615, -3933, -3933, -4006, -4006, -3617, -3617, -3184, -3184,
+    -3524, -3524, -4820, -4820, -6293, -6293, -7199, -7199, -7721, -7721, -8443, -8443,
+    -9277, -9277, -9527, -9527, -8899, -8899, -7849, -7849, -6837, -6837, -5832, -5832,
+    -4812, -4812, -4182, -4182, -4242, -4242, -4567, -4567, -4417, -4417, -3688, -3688,
+    -3004, -3004, -2838, -2838, -2947, -2947, -2862, -2862, -2602, -2602, -2556, -2556,
+    -2809, -2809, -2983, -2983, -2798, -2798, -2417, -2417, -2091, -2091, -1755, -1755,
+    -1265, -1265, -829, -829, -827, -827, -1194, -1194, -1382, -1382, -1060, -1060,
+    -506, -506, -78, -78, 371, 371, 1204, 1204, 2338, 2338, 3300, 3300,
+    3857, 3857, 4202, 4202, 4487, 4487, 4541, 4541, 4227, 4227, 3780, 3780,
+    3557, 3557, 3574, 3574, 3558, 3558, 3367, 3367, 3144, 3144, 3085, 3085,
+    3231, 3231, 3495, 3495, 3762, 3762, 3951, 3951, 4052, 4052, 4140, 4140,
+    4291, 4291, 4483, 4483, 4602, 4602, 4572, 4572, 4439, 4439, 4311, 4311,
+    4249, 4249, 4267, 4267, 4384, 4384, 4613, 4613, 4890, 4890, 5093, 5093,
+    5147, 5147, 5076, 5076, 4914, 4914, 4616, 4616, 4111, 4111, 3466, 3466,
+    2912, 2912, 2642, 2642, 2644, 2644, 2775, 2775, 2922, 2922, 3028, 3028,
+    3053, 3053, 3005, 3005, 2972, 2972, 3021, 3021, 3059, 3059, 2909, 2909,
+    2527, 2527, 2091, 2091, 1789, 1789, 1609, 1609, 1406, 1406, 1119, 1119,
+    833, 833, 646, 646, 568, 568, 553, 553, 571, 571, 615, 615,
+    651, 651, 604, 604, 431, 431, 183, 183, -40, -40, -197, -197,
+    -333, -333, -474, -474, -561, -561, -511, -511, -335, -335, -145, -145,
+    -41, -41, -24, -24, -64, -64, -177, -177, -401, -401, -720, -720,
+    -1050, -1050, -1296, -1296, -1445, -1445, -1592, -1592, -1823, -1823, -2073, -2073,
+    -2190, -2190, -2163, -2163, -2175, -2175, -2345, -2345, -2529, -2529, -2534, -2534,
+    -2446, -2446, -2547, -2547, -2914, -2914, -3317, -3317, -3559, -3559, -3657, -3657,
+    -3626, -3626, -3413, -3413, -3229, -3229, -3592, -3592, -4707, -4707, -6028, -6028,
+    -6844, -6844, -7163, -7163, -7564, -7564, -8193, -8193, -8440, -8440, -7806, -7806,
+    -6630, -6630, -5601, -5601, -4925, -4925, -4392, -4392, -4006, -4006, -3976, -3976,
+    -4135, -4135, -3935, -3935, -3200, -3200, -2456, -2456, -2250, -2250, -2444, -2444,
+    -2519, -2519, -2377, -2377, -2388, -2388, -2708, -2708, -2980, -2980, -2846, -2846,
+    -2396, -2396, -1921, -1921, -1498, -1498, -1073, -1073, -765, -765, -762, -762,
+    -957, -957, -980, -980, -650, -650, -145, -145, 347, 347, 908, 908,
+    1668, 1668, 2494, 2494, 3129, 3129, 3533, 3533, 3857, 3857, 4136, 4136,
+    4197, 4197, 3945, 3945, 3566, 3566, 3334, 3334, 3304, 3304, 3317, 3317,
+    3247, 3247, 3132, 3132, 3063, 3063, 3091, 3091, 3234, 3234, 3485, 3485,
+    3767, 3767, 3970, 3970, 4080, 4080, 4208, 4208, 4429, 4429, 4648, 4648,
+    4710, 4710, 4607, 4607, 4456, 4456, 4325, 4325, 4200, 4200, 4134, 4134,
+    4249, 4249, 4534, 4534, 4786, 4786, 4833, 4833, 4718, 4718, 4558, 4558,
+    4326, 4326, 3902, 3902, 3322, 3322, 2817, 2817, 2566, 2566, 2526, 2526,
+    2554, 2554, 2602, 2602, 2690, 2690, 2770, 2770, 2730, 2730, 2556, 2556,
+    2398, 2398, 2381, 2381, 2411, 2411, 2271, 2271, 1933, 1933, 1606, 1606,
+    1439, 1439, 1300, 1300, 1001, 1001, 601, 601, 336, 336, 267, 267,
+    218, 218, 82, 82, -17, -17, 38, 38, 116, 116, 4, 4,
+    -283, -283, -538, -538, -675, -675, -811, -811, -1032, -1032, -1220, -1220,
+    -1225, -1225, -1086, -1086, -966, -966, -919, -919, -858, -858, -770, -770,
+    -793, -793, -1010, -1010, -1300, -1300, -1509, -1509, -1678, -1678, -1938, -1938,
+    -2253, -2253, -2452, -2452, -2514, -2514, -2609, -2609, -2827, -2827, -3032, -3032,
+    -3094, -3094, -3096, -3096, -3200, -3200, -3413, -3413, -3627, -3627, -3782, -3782,
+    -3833, -3833, -3678, -3678, -3347, -3347, -3208, -3208, -3705, -3705, -4817, -4817,
+    -5954, -5954, -6581, -6581, -6792, -6792, -7070, -7070, -7526, -7526, -7687, -7687,
+    -7130, -7130, -6052, -6052, -5002, -5002, -4234, -4234, -3652, -3652, -3264, -3264,
+    -3231, -3231, -3387, -3387, -3213, -3213, -2550, -2550, -1950, -1950, -1940, -1940,
+    -2239, -2239, -2196, -2196, -1788, -1788, -1598, -1598, -1839, -1839, -2038, -2038,
+    -1808, -1808, -1397, -1397, -1162, -1162, -978, -978, -574, -574, -141, -141,
+    -109, -109, -435, -435, -562, -562, -153, -153, 517, 517, 1032, 1032,
+    1405, 1405, 1959, 1959, 2793, 2793, 3626, 3626, 4168, 4168, 4428, 4428,
+    4543, 4543, 4487, 4487, 4169, 4169, 3749, 3749, 3561, 3561, 3681, 3681,
+    3797, 3797, 3644, 3644, 3372, 3372, 3302, 3302, 3483, 3483, 3723, 3723,
+    3906, 3906, 4043, 4043, 4106, 4106, 4082, 4082, 4131, 4131, 4429, 4429,
+    4835, 4835, 5003, 5003, 4836, 4836, 4586, 4586, 4477, 4477, 4486, 4486,
+    4555, 4555, 4743, 4743, 5018, 5018, 5140, 5140, 4955, 4955, 4648, 4648,
+    4470, 4470, 4343, 4343, 3969, 3969, 3297, 3297, 2661, 2661, 2381, 2381,
+    2412, 2412, 2478, 2478, 2439, 2439, 2376, 2376, 2367, 2367, 2345, 2345,
+    2250, 2250, 2172, 2172, 2210, 2210, 2246, 2246, 2041, 2041, 1593, 1593,
+    1187, 1187, 1013, 1013, 888, 888, 547, 547, 69, 69, -217, -217,
+    -218, -218, -183, -183, -295, -295, -420, -420, -408, -408, -400, -400,
+    -607, -607, -940, -940, -1128, -1128, -1147, -1147, -1237, -1237, -1477, -1477,
+    -1633, -1633, -1531, -1531, -1337, -1337, -1283, -1283, -1329, -1329, -1313, -1313,
+    -1305, -1305, -1501, -1501, -1852, -1852, -2105, -2105, -2224, -2224, -2454, -2454,
+    -2870, -2870, -3190, -3190, -3218, -3218, -3177, -3177, -3344, -3344, -3576, -3576,
+    -3573, -3573, -3455, -3455, -3611, -3611, -3975, -3975, -3978, -3978, -3403, -3403,
+    -2855, -2855, -3044, -3044, -3907, -3907, -4854, -4854, -5634, -5634, -6452, -6452,
+    -7313, -7313, -7831, -7831, -7810, -7810, -7528, -7528, -7184, -7184, -6513, -6513,
+    -5324, -5324, -4087, -4087, -3493, -3493, -3564, -3564, -3668, -3668, -3402, -3402,
+    -3010, -3010, -2821, -2821, -2714, -2714, -2421, -2421, -2034, -2034, -1893, -1893,
+    -2054, -2054, -2206, -2206, -2114, -2114, -1887, -1887, -1719, -1719, -1553, -1553,
+    -1193, -1193, -679, -679, -329, -329, -336, -336, -493, -493, -467, -467,
+    -234, -234, -27, -27, 125, 125, 513, 513, 1296, 1296, 2201, 2201,
+    2873, 2873, 3334, 3334, 3831, 3831, 4341, 4341, 4559, 4559, 4363, 4363,
+    4011, 4011, 3778, 3778, 3653, 3653, 3508, 3508, 3381, 3381, 3404, 3404,
+    3567, 3567, 3720, 3720, 3793, 3793, 3868, 3868, 4038, 4038, 4281, 4281,
+    4490, 4490, 4595, 4595, 4626, 4626, 4673, 4673, 4780, 4780, 4890, 4890,
+    4919, 4919, 4871, 4871, 4827, 4827, 4832, 4832, 4860, 4860, 4898, 4898,
+    5001, 5001, 5187, 5187, 5328, 5328, 5235, 5235, 4876, 4876, 4412, 4412,
+    4002, 4002, 3644, 3644, 3280, 3280, 2972, 2972, 2847, 2847, 2889, 2889,
+    2932, 2932, 2886, 2886, 2829, 2829, 2813, 2813, 2744, 2744, 2552, 2552,
+    2357, 2357, 2302, 2302, 2283, 2283, 2079, 2079, 1685, 1685, 1325, 1325,
+    1111, 1111, 902, 902, 579, 579, 262, 262, 111, 111, 68, 68,
+    -33, -33, -208, -208, -340, -340, -428, -428, -618, -618, -960, -960,
+    -1301, -1301, -1489, -1489, -1561, -1561, -1640, -1640, -1742, -1742, -1785, -1785,
+    -1740, -1740, -1675, -1675, -1659, -1659, -1702, -1702, -1776, -1776, -1865, -1865,
+    -1983, -1983, -2186, -2186, -2495, -2495, -2811, -2811, -2988, -2988, -3056, -3056,
+    -3222, -3222, -3538, -3538, -3773, -3773, -3792, -3792, -3875, -3875, -4285, -4285,
+    -4692, -4692, -4510, -4510, -3813, -3813, -3378, -3378, -3680, -3680, -4373, -4373,
+    -5013, -5013, -5725, -5725, -6697, -6697, -7528, -7528, -7735, -7735, -7550, -7550,
+    -7516, -7516, -7461, -7461, -6715, -6715, -5315, -5315, -4192, -4192, -3912, -3912,
+    -3987, -3987, -3759, -3759, -3346, -3346, -3162, -3162, -3054, -3054, -2598, -2598,
+    -1969, -1969, -1792, -1792, -2174, -2174, -2504, -2504, -2359, -2359, -2049, -2049,
+    -2018, -2018, -2123, -2123, -1900, -1900, -1305, -1305, -756, -756, -524, -524,
+    -461, -461, -377, -377, -345, -345, -448, -448, -472, -472, -123, -123,
+    569, 569, 1298, 1298, 1892, 1892, 2456, 2456, 3106, 3106, 3780, 3780,
+    4320, 4320, 4605, 4605, 4556, 4556, 4207, 4207, 3794, 3794, 3593, 3593,
+    3625, 3625, 3665, 3665, 3577, 3577, 3457, 3457, 3405, 3405, 3400, 3400,
+    3463, 3463, 3714, 3714, 4110, 4110, 4356, 4356, 4302, 4302, 4219, 4219,
+    4444, 4444, 4883, 4883, 5145, 5145, 5070, 5070, 4863, 4863, 4732, 4732,
+    4665, 4665, 4633, 4633, 4749, 4749, 5072, 5072, 5408, 5408, 5483, 5483,
+    5260, 5260, 4949, 4949, 4693, 4693, 4395, 4395, 3915, 3915, 3344, 3344,
+    2955, 2955, 2878, 2878, 2953, 2953, 2970, 2970, 2914, 2914, 2888, 2888,
+    2881, 2881, 2806, 2806, 2692, 2692, 2664, 2664, 2698, 2698, 2600, 2600,
+    2284, 2284, 1915, 1915, 1662, 1662, 1444, 1444, 1096, 1096, 667, 667,
+    361, 361, 224, 224, 97, 97, -88, -88, -209, -209, -214, -214,
+    -286, -286, -564, -564, -884, -884, -1017, -1017, -1041, -1041, -1212, -1212,
+    -1506, -1506, -1644, -1644, -1558, -1558, -1506, -1506, -1623, -1623, -1715, -1715,
+    -1671, -1671, -1714, -1714, -1997, -1997, -2281, -2281, -2345, -2345, -2406, -2406,
+    -2756, -2756, -3217, -3217, -3432, -3432, -3473, -3473, -3681, -3681, -4030, -4030,
+    -4202, -4202, -4210, -4210, -4347, -4347, -4509, -4509, -4224, -4224, -3527, -3527,
+    -3191, -3191, -3755, -3755, -4830, -4830, -5717, -5717, -6303, -6303, -6905, -6905,
+    -7551, -7551, -7925, -7925, -7864, -7864, -7467, -7467, -6788, -6788, -5815, -5815,
+    -4753, -4753, -3986, -3986, -3676, -3676, -3597, -3597, -3436, -3436, -3117, -3117,
+    -2775, -2775, -2548, -2548, -2448, -2448, -2403, -2403, -2362, -2362, -2358, -2358,
+    -2433, -2433, -2521, -2521, -2477, -2477, -2257, -2257, -1959, -1959, -1664, -1664,
+    -1327, -1327, -918, -918, -564, -564, -433, -433, -509, -509, -574, -574,
+    -443, -443, -138, -138, 218, 218, 626, 626, 1224, 1224, 2051, 2051,
+    2898, 2898, 3513, 3513, 3891, 3891, 4188, 4188, 4379, 4379, 4257, 4257,
+    3826, 3826, 3441, 3441, 3362, 3362, 3405, 3405, 3257, 3257, 2990, 2990,
+    2945, 2945, 3190, 3190, 3440, 3440, 3532, 3532, 3645, 3645, 3944, 3944,
+    4275, 4275, 4430, 4430, 4486, 4486, 4671, 4671, 4962, 4962, 5090, 5090,
+    4927, 4927, 4675, 4675, 4588, 4588, 4670, 4670, 4748, 4748, 4762, 4762,
+    4817, 4817, 4967, 4967, 5085, 5085, 5011, 5011, 4747, 4747, 4405, 4405,
+    4025, 4025, 3567, 3567, 3081, 3081, 2753, 2753, 2704, 2704, 2816, 2816,
+    2868, 2868, 2799, 2799, 2752, 2752, 2834, 2834, 2944, 2944, 2916, 2916,
+    2748, 2748, 2569, 2569, 2412, 2412, 2151, 2151, 1719, 1719, 1256, 1256,
+    921, 921, 687, 687, 444, 444, 222, 222, 137, 137, 158, 158,
+    116, 116, -36, -36, -179, -179, -274, -274, -447, -447, -748, -748,
+    -1020, -1020, -1133, -1133, -1189, -1189, -1336, -1336, -1523, -1523, -1607, -1607,
+    -1606, -1606, -1647, -1647, -1751, -1751, -1839, -1839, -1916, -1916, -2068, -2068,
+    -2296, -2296, -2513, -2513, -2710, -2710, -2969, -2969, -3290, -3290, -3558, -3558,
+    -3720, -3720, -3858, -3858, -4032, -4032, -4178, -4178, -4200, -4200, -4058, -4058,
+    -3762, -3762, -3422, -3422, -3345, -3345, -3857, -3857, -4904, -4904, -6003, -6003,
+    -6731, -6731, -7147, -7147, -7523, -7523, -7820, -7820, -7712, -7712, -7064, -7064,
+    -6105, -6105, -5103, -5103, -4165, -4165, -3432, -3432, -3128, -3128, -3221, -3221,
+    -3299, -3299, -3041, -3041, -2628, -2628, -2431, -2431, -2448, -2448, -2400, -2400,
+    -2251, -2251, -2246, -2246, -2413, -2413, -2438, -2438, -2163, -2163, -1845, -1845,
+    -1710, -1710, -1563, -1563, -1132, -1132, -589, -589, -344, -344, -444, -444,
+    -534, -534, -400, -400, -192, -192, -17, -17, 328, 328, 1014, 1014,
+    1822, 1822, 2422, 2422, 2834, 2834, 3319, 3319, 3884, 3884, 4223, 4223,
+    4160, 4160, 3860, 3860, 3544, 3544, 3241, 3241, 2948, 2948, 2792, 2792,
+    2843, 2843, 2944, 2944, 2930, 2930, 2909, 2909, 3104, 3104, 3498, 3498,
+    3853, 3853, 4043, 4043, 4171, 4171, 4340, 4340, 4506, 4506, 4612, 4612,
+    4695, 4695, 4785, 4785, 4808, 4808, 4690, 4690, 4495, 4495, 4379, 4379,
+    4423, 4423, 4560, 4560, 4668, 4668, 4699, 4699, 4684, 4684, 4615, 4615,
+    4392, 4392, 3969, 3969, 3483, 3483, 3128, 3128, 2923, 2923, 2743, 2743,
+    2568, 2568, 2528, 2528, 2652, 2652, 2766, 2766, 2748, 2748, 2700, 2700,
+    2735, 2735, 2758, 2758, 2619, 2619, 2360, 2360, 2122, 2122, 1890, 1890,
+    1541, 1541, 1098, 1098, 733, 733, 522, 522, 354, 354, 140, 140,
+    -59, -59, -156, -156, -201, -201, -317, -317, -529, -529, -741, -741,
+    -886, -886, -1019, -1019, -1211, -1211, -1407, -1407, -1501, -1501, -1533, -1533,
+    -1660, -1660, -1887, -1887, -2015, -2015, -1958, -1958, -1935, -1935, -2147, -2147,
+    -2445, -2445, -2574, -2574, -2604, -2604, -2815, -2815, -3197, -3197, -3443, -3443,
+    -3468, -3468, -3552, -3552, -3858, -3858, -4149, -4149, -4162, -4162, -3970, -3970,
+    -3787, -3787, -3671, -3671, -3662, -3662, -3978, -3978, -4766, -4766, -5778, -5778,
+    -6575, -6575, -7010, -7010, -7261, -7261, -7436, -7436, -7373, -7373, -6885, -6885,
+    -6008, -6008, -4961, -4961, -3994, -3994, -3309, -3309, -3001, -3001, -2976, -2976,
+    -3011, -3011, -2932, -2932, -2741, -2741, -2541, -2541, -2411, -2411, -2364, -2364,
+    -2386, -2386, -2439, -2439, -2444, -2444, -2343, -2343, -2180, -2180, -2048, -2048,
+    -1931, -1931, -1691, -1691, -1272, -1272, -830, -830, -558, -558, -438, -438,
+    -296, -296, -62, -62, 184, 184, 439, 439, 840, 840, 1423, 1423,
+    2007, 2007, 2436, 2436, 2793, 2793, 3215, 3215, 3621, 3621, 3802, 3802,
+    3713, 3713, 3503, 3503, 3276, 3276, 3010, 3010, 2728, 2728, 2584, 2584,
+    2676, 2676, 2902, 2902, 3089, 3089, 3224, 3224, 3440, 3440, 3810, 3810,
+    4231, 4231, 4520, 4520, 4598, 4598, 4558, 4558, 4563, 4563, 4685, 4685,
+    4843, 4843, 4905, 4905, 4834, 4834, 4715, 4715, 4635, 4635, 4600, 4600,
+    4576, 4576, 4577, 4577, 4624, 4624, 4661, 4661, 4592, 4592, 4406, 4406,
+    4190, 4190, 3987, 3987, 3733, 3733, 3402, 3402, 3095, 3095, 2924, 2924,
+    2870, 2870, 2847, 2847, 2841, 2841, 2875, 2875, 2895, 2895, 2820, 2820,
+    2663, 2663, 2516, 2516, 2394, 2394, 2209, 2209, 1903, 1903, 1525, 1525,
+    1163, 1163, 862, 862, 606, 606, 358, 358, 96, 96, -154, -154,
+    -339, -339, -469, -469, -615, -615, -803, -803, -978, -978, -1122, -1122,
+    -1299, -1299, -1535, -1535, -1748, -1748, -1868, -1868, -1939, -1939, -2054, -2054,
+    -2239, -2239, -2453, -2453, -2636, -2636, -2733, -2733, -2754, -2754, -2817, -2817,
+    -3007, -3007, -3230, -3230, -3362, -3362, -3480, -3480, -3725, -3725, -3990, -3990,
+    -4077, -4077, -4119, -4119, -4420, -4420, -4814, -4814, -4730, -4730, -4115, -4115,
+    -3736, -3736, -4193, -4193, -5131, -5131, -5866, -5866, -6357, -6357, -6955, -6955,
+    -7571, -7571, -7773, -7773, -7541, -7541, -7208, -7208, -6748, -6748, -5797, -5797,
+    -4468, -4468, -3450, -3450, -3120, -3120, -3104, -3104, -2962, -2962, -2787, -2787,
+    -2811, -2811, -2902, -2902, -2829, -2829, -2690, -2690, -2675, -2675, -2684, -2684,
+    -2516, -2516, -2264, -2264, -2170, -2170, -2199, -2199, -2081, -2081, -1755, -1755,
+    -1431, -1431, -1219, -1219, -975, -975, -618, -618, -307, -307, -157, -157,
+    -2, -2, 368, 368, 894, 894, 1360, 1360, 1738, 1738, 2203, 2203,
+    2790, 2790, 3279, 3279, 3499, 3499, 3580, 3580, 3699, 3699, 3755, 3755,
+    3548, 3548, 3162, 3162, 2886, 2886, 2815, 2815, 2796, 2796, 2776, 2776,
+    2905, 2905, 3241, 3241, 3610, 3610, 3890, 3890, 4204, 4204, 4643, 4643,
+    4997, 4997, 5019, 5019, 4823, 4823, 4725, 4725, 4797, 4797, 4863, 4863,
+    4856, 4856, 4888, 4888, 4989, 4989, 5029, 5029, 4955, 4955, 4901, 4901,
+    4960, 4960, 5010, 5010, 4901, 4901, 4681, 4681, 4493, 4493, 4332, 4332,
+    4090, 4090, 3770, 3770, 3494, 3494, 3327, 3327, 3224, 3224, 3154, 3154,
+    3136, 3136, 3169, 3169, 3190, 3190, 3155, 3155, 3077, 3077, 2961, 2961,
+    2765, 2765, 2480, 2480, 2169, 2169, 1859, 1859, 1493, 1493, 1067, 1067,
+    700, 700, 475, 475, 301, 301, 65, 65, -167, -167, -262, -262,
+    -292, -292, -453, -453, -739, -739, -937, -937, -1002, -1002, -1170, -1170,
+    -1567, -1567, -1964, -1964, -2118, -2118, -2160, -2160, -2352, -2352, -2622, -2622,
+    -2686, -2686, -2568, -2568, -2614, -2614, -2929, -2929, -3200, -3200, -3241, -3241,
+    -3324, -3324, -3713, -3713, -4166, -4166, -4288, -4288, -4179, -4179, -4294, -4294,
+    -4689, -4689, -4874, -4874, -4555, -4555, -4111, -4111, -4079, -4079, -4494, -4494,
+    -5051, -5051, -5662, -5662, -6437, -6437, -7247, -7247, -7738, -7738, -7800, -7800,
+    -7677, -7677, -7500, -7500, -7032, -7032, -6075, -6075, -4899, -4899, -3995, -3995,
+    -3542, -3542, -3352, -3352, -3233, -3233, -3167, -3167, -3173, -3173, -3209, -3209,
+    -3234, -3234, -3238, -3238, -3205, -3205, -3134, -3134, -3061, -3061, -2985, -2985,
+    -2828, -2828, -2551, -2551, -2264, -2264, -2077, -2077, -1901, -1901, -1577, -1577,
+    -1160, -1160, -872, -872, -744, -744, -546, -546, -148, -148, 288, 288,
+    599, 599, 902, 902, 1396, 1396, 2013, 2013, 2490, 2490, 2739, 2739,
+    2930, 2930, 3195, 3195, 3431, 3431, 3459, 3459, 3271, 3271, 3032, 3032,
+    2886, 2886, 2840, 2840, 2827, 2827, 2844, 2844, 2978, 2978, 3292, 3292,
+    3732, 3732, 4172, 4172, 4557, 4557, 4919, 4919, 5247, 5247, 5413, 5413,
+    5350, 5350, 5195, 5195, 5134, 5134, 5163, 5163, 5138, 5138, 5022, 5022,
+    4945, 4945, 5020, 5020, 5174, 5174, 5244, 5244, 5191, 5191, 5129, 5129,
+    5122, 5122, 5082, 5082, 4911, 4911, 4647, 4647, 4405, 4405, 4232, 4232,
+    4073, 4073, 3888, 3888, 3743, 3743, 3722, 3722, 3772, 3772, 3753, 3753,
+    3651, 3651, 3569, 3569, 3514, 3514, 3362, 3362, 3039, 3039, 2631, 2631,
+    2274, 2274, 1999, 1999, 1718, 1718, 1357, 1357, 966, 966, 659, 659,
+    468, 468, 320, 320, 134, 134, -83, -83, -268, -268, -409, -409,
+    -589, -589, -848, -848, -1092, -1092, -1267, -1267, -1498, -1498, -1856, -1856,
+    -2151, -2151, -2217, -2217, -2225, -2225, -2424, -2424, -2702, -2702, -2769, -2769,
+    -2691, -2691, -2843, -2843, -3274, -3274, -3582, -3582, -3596, -3596, -3689, -3689,
+    -4107, -4107, -4467, -4467, -4405, -4405, -4250, -4250, -4460, -4460, -4762, -4762,
+    -4587, -4587, -4146, -4146, -4262, -4262, -5136, -5136, -6062, -6062, -6536, -6536,
+    -6916, -6916, -7578, -7578, -8113, -8113, -7955, -7955, -7320, -7320, -6798, -6798,
+    -6344, -6344, -5460, -5460, -4246, -4246, -3455, -3455, -3413, -3413, -3575, -3575,
+    -3424, -3424, -3203, -3203, -3347, -3347, -3678, -3678, -3696, -3696, -3395, -3395,
+    -3226, -3226, -3332, -3332, -3358, -3358, -3072, -3072, -2716, -2716, -2561, -2561,
+    -2503, -2503, -2302, -2302, -1977, -1977, -1699, -1699, -1493, -1493, -1249, -1249,
+    -923, -923, -548, -548, -137, -137, 296, 296, 704, 704, 1093, 1093,
+    1540, 1540, 2032, 2032, 2410, 2410, 2587, 2587, 2714, 2714, 2923, 2923,
+    3073, 3073, 2970, 2970, 2739, 2739, 2663, 2663, 2734, 2734, 2711, 2711,
+    2586, 2586, 2652, 2652, 3048, 3048, 3551, 3551, 3944, 3944, 4314, 4314,
+    4807, 4807, 5289, 5289, 5506, 5506, 5464, 5464, 5390, 5390, 5373, 5373,
+    5314, 5314, 5188, 5188, 5118, 5118, 5170, 5170, 5266, 5266, 5333, 5333,
+    5393, 5393, 5476, 5476, 5535, 5535, 5494, 5494, 5339, 5339, 5117, 5117,
+    4869, 4869, 4628, 4628, 4417, 4417, 4234, 4234, 4067, 4067, 3965, 3965,
+    3996, 3996, 4118, 4118, 4194, 4194, 4148, 4148, 4035, 4035, 3915, 3915,
+    3750, 3750, 3481, 3481, 3136, 3136, 2778, 2778, 2402, 2402, 1982, 1982,
+    1569, 1569, 1236, 1236, 968, 968, 711, 711, 478, 478, 313, 313,
+    183, 183, 38, 38, -94, -94, -186, -186, -328, -328, -619, -619,
+    -974, -974, -1238, -1238, -1464, -1464, -1801, -1801, -2147, -2147, -2250, -2250,
+    -2186, -2186, -2317, -2317, -2676, -2676, -2887, -2887, -2841, -2841, -2964, -2964,
+    -3495, -3495, -3987, -3987, -4000, -4000, -3873, -3873, -4175, -4175, -4670, -4670,
+    -4663, -4663, -4207, -4207, -4060, -4060, -4402, -4402, -4575, -4575, -4345, -4345,
+    -4448, -4448, -5393, -5393, -6566, -6566, -7155, -7155, -7333, -7333, -7740, -7740,
+    -8227, -8227, -8039, -8039, -7090, -7090, -6099, -6099, -5431, -5431, -4718, -4718,
+    -3797, -3797, -3182, -3182, -3233, -3233, -3565, -3565, -3675, -3675, -3654, -3654,
+    -3845, -3845, -4174, -4174, -4263, -4263, -4026, -4026, -3706, -3706, -3425, -3425,
+    -3094, -3094, -2742, -2742, -2533, -2533, -2457, -2457, -2349, -2349, -2207, -2207,
+    -2153, -2153, -2123, -2123, -1912, -1912, -1508, -1508, -1091, -1091, -701, -701,
+    -172, -172, 534, 534, 1165, 1165, 1521, 1521, 1732, 1732, 2002, 2002,
+    2245, 2245, 2262, 2262, 2129, 2129, 2114, 2114, 2253, 2253, 2340, 2340,
+    2303, 2303, 2342, 2342, 2597, 2597, 2926, 2926, 3146, 3146, 3321, 3321,
+    3647, 3647, 4113, 4113, 4503, 4503, 4723, 4723, 4904, 4904, 5146, 5146,
+    5342, 5342, 5369, 5369, 5288, 5288, 5248, 5248, 5278, 5278, 5303, 5303,
+    5292, 5292, 5312, 5312, 5410, 5410, 5545, 5545, 5638, 5638, 5661, 5661,
+    5638, 5638, 5575, 5575, 5438, 5438, 5200, 5200, 4890, 4890, 4603, 4603,
+    4435, 4435, 4397, 4397, 4417, 4417, 4447, 4447, 4516, 4516, 4634, 4634,
+    4708, 4708, 4638, 4638, 4426, 4426, 4135, 4135, 3775, 3775, 3315, 3315,
+    2787, 2787, 2310, 2310, 1978, 1978, 1749, 1749, 1513, 1513, 1269, 1269,
+    1121, 1121, 1095, 1095, 1060, 1060, 903, 903, 672, 672, 460, 460,
+    228, 228, -145, -145, -625, -625, -1004, -1004, -1188, -1188, -1339, -1339,
+    -1593, -1593, -1821, -1821, -1877, -1877, -1900, -1900, -2098, -2098, -2395, -2395,
+    -2573, -2573, -2684, -2684, -2980, -2980, -3452, -3452, -3790, -3790, -3876, -3876,
+    -3970, -3970, -4234, -4234, -4415, -4415, -4297, -4297, -4116, -4116, -4173, -4173,
+    -4318, -4318, -4270, -4270, -4227, -4227, -4637, -4637, -5468, -5468, -6212, -6212,
+    -6646, -6646, -7066, -7066, -7613, -7613, -7885, -7885, -7534, -7534, -6817, -6817,
+    -6157, -6157, -5521, -5521, -4676, -4676, -3808, -3808, -3356, -3356, -3363, -3363,
+    -3476, -3476, -3547, -3547, -3768, -3768, -4158, -4158, -4382, -4382, -4257, -4257,
+    -4007, -4007, -3822, -3822, -3560, -3560, -3115, -3115, -2728, -2728, -2625, -2625,
+    -2657, -2657, -2591, -2591, -2513, -2513, -2605, -2605, -2715, -2715, -2532, -2532,
+    -2079, -2079, -1639, -1639, -1252, -1252, -690, -690, 50, 50, 664, 664,
+    1013, 1013, 1278, 1278, 1566, 1566, 1713, 1713, 1619, 1619, 1476, 1476,
+    1487, 1487, 1580, 1580, 1600, 1600, 1615, 1615, 1817, 1817, 2198, 2198,
+    2585, 2585, 2914, 2914, 3269, 3269, 3667, 3667, 4023, 4023, 4294, 4294,
+    4511, 4511, 4688, 4688, 4823, 4823, 4926, 4926, 4998, 4998, 5035, 5035,
+    5056, 5056, 5099, 5099, 5169, 5169, 5230, 5230, 5275, 5275, 5360, 5360,
+    5511, 5511, 5637, 5637, 5633, 5633, 5532, 5532, 5442, 5442, 5366, 5366,
+    5222, 5222, 5014, 5014, 4844, 4844, 4772, 4772, 4766, 4766, 4778, 4778,
+    4794, 4794, 4815, 4815, 4812, 4812, 4726, 4726, 4518, 4518, 4212, 4212,
+    3863, 3863, 3504, 3504, 3132, 3132, 2750, 2750, 2394, 2394, 2118, 2118,
+    1927, 1927, 1760, 1760, 1582, 1582, 1447, 1447, 1393, 1393, 1336, 1336,
+    1157, 1157, 868, 868, 578, 578, 330, 330, 58, 58, -289, -289,
+    -651, -651, -930, -930, -1117, -1117, -1270, -1270, -1415, -1415, -1536, -1536,
+    -1654, -1654, -1836, -1836, -2098, -2098, -2383, -2383, -2652, -2652, -2915, -2915,
+    -3166, -3166, -3364, -3364, -3500, -3500, -3608, -3608, -3703, -3703, -3775, -3775,
+    -3844, -3844, -3949, -3949, -4070, -4070, -4143, -4143, -4185, -4185, -4317, -4317,
+    -4597, -4597, -4918, -4918, -5191, -5191, -5513, -5513, -5980, -5980, -6434, -6434,
+    -6630, -6630, -6562, -6562, -6382, -6382, -6084, -6084, -5533, -5533, -4788, -4788,
+    -4131, -4131, -3713, -3713, -3420, -3420, -3174, -3174, -3118, -3118, -3332, -3332,
+    -3618, -3618, -3780, -3780, -3890, -3890, -4030, -4030, -4017, -4017, -3703, -3703,
+    -3310, -3310, -3124, -3124, -3048, -3048, -2820, -2820, -2526, -2526, -2475, -2475,
+    -2628, -2628, -2605, -2605, -2305, -2305, -2053, -2053, -1972, -1972, -1699, -1699,
+    -1002, -1002, -244, -244, 183, 183, 460, 460, 941, 941, 1458, 1458,
+    1567, 1567, 1314, 1314, 1181, 1181, 1311, 1311, 1347, 1347, 1148, 1148,
+    1106, 1106, 1492, 1492, 1978, 1978, 2190, 2190, 2323, 2323, 2746, 2746,
+    3304, 3304, 3562, 3562, 3547, 3547, 3690, 3690, 4085, 4085, 4359, 4359,
+    4351, 4351, 4402, 4402, 4740, 4740, 5056, 5056, 5026, 5026, 4858, 4858,
+    4917, 4917, 5115, 5115, 5117, 5117, 4949, 4949, 4937, 4937, 5114, 5114,
+    5173, 5173, 5008, 5008, 4867, 4867, 4872, 4872, 4800, 4800, 4512, 4512,
+    4234, 4234, 4180, 4180, 4222, 4222, 4183, 4183, 4153, 4153, 4265, 4265,
+    4380, 4380, 4282, 4282, 4032, 4032, 3824, 3824, 3606, 3606, 3180, 3180,
+    2601, 2601, 2153, 2153, 1898, 1898, 1622, 1622, 1262, 1262, 1040, 1040,
+    1062, 1062, 1112, 1112, 1001, 1001, 834, 834, 758, 758, 665, 665,
+    383, 383, 7, 7, -238, -238, -360, -360, -568, -568, -893, -893,
+    -1128, -1128, -1194, -1194, -1259, -1259, -1444, -1444, -1647, -1647, -1765, -1765,
+    -1879, -1879, -2102, -2102, -2383, -2383, -2602, -2602, -2764, -2764, -2958, -2958,
+    -3175, -3175, -3308, -3308, -3325, -3325, -3303, -3303, -3278, -3278, -3215, -3215,
+    -3118, -3118, -3057, -3057, -3063, -3063, -3128, -3128, -3286, -3286, -3576, -3576,
+    -3944, -3944, -4277, -4277, -4567, -4567, -4895, -4895, -5239, -5239, -5403, -5403,
+    -5254, -5254, -4906, -4906, -4538, -4538, -4148, -4148, -3640, -3640, -3095, -3095,
+    -2735, -2735, -2613, -2613, -2571, -2571, -2524, -2524, -2581, -2581, -2810, -2810,
+    -3038, -3038, -3052, -3052, -2884, -2884, -2725, -2725, -2626, -2626, -2479, -2479,
+    -2278, -2278, -2173, -2173, -2231, -2231, -2337, -2337, -2389, -2389, -2431, -2431,
+    -2498, -2498, -2479, -2479, -2259, -2259, -1885, -1885, -1468, -1468, -1037, -1037,
+    -572, -572, -131, -131, 195, 195, 405, 405, 552, 552, 626, 626,
+    578, 578, 459, 459, 396, 396, 428, 428, 501, 501, 601, 601,
+    766, 766, 977, 977, 1168, 1168, 1335, 1335, 1523, 1523, 1714, 1714,
+    1845, 1845, 1928, 1928, 2055, 2055, 2260, 2260, 2476, 2476, 2657, 2657,
+    2851, 2851, 3080, 3080, 3270, 3270, 3357, 3357, 3396, 3396, 3457, 3457,
+    3501, 3501, 3457, 3457, 3353, 3353, 3287, 3287, 3302, 3302, 3339, 3339,
+    3321, 3321, 3248, 3248, 3200, 3200, 3224, 3224, 3262, 3262, 3227, 3227,
+    3117, 3117, 3014, 3014, 2973, 2973, 2953, 2953, 2885, 2885, 2777, 2777,
+    2686, 2686, 2620, 2620, 2522, 2522, 2372, 2372, 2200, 2200, 2027, 2027,
+    1850, 1850, 1669, 1669, 1486, 1486, 1294, 1294, 1114, 1114, 993, 993,
+    932, 932, 861, 861, 735, 735, 599, 599, 517, 517, 474, 474,
+    419, 419, 355, 355, 308, 308, 239, 239, 93, 93, -93, -93,
+    -238, -238, -349, -349, -497, -497, -687, -687, -851, -851, -962, -962,
+    -1050, -1050, -1123, -1123, -1152, -1152, -1147, -1147, -1165, -1165, -1218, -1218,
+    -1261, -1261, -1276, -1276, -1298, -1298, -1345, -1345, -1398, -1398, -1448, -1448,
+    -1506, -1506, -1568, -1568, -1608, -1608, -1634, -1634, -1680, -1680, -1746, -1746,
+    -1798, -1798, -1810, -1810, -1797, -1797, -1787, -1787, -1792, -1792, -1795, -1795,
+    -1772, -1772, -1735, -1735, -1742, -1742, -1829, -1829, -1942, -1942, -2016, -2016,
+    -2101, -2101, -2289, -2289, -2494, -2494, -2496, -2496, -2269, -2269, -2042, -2042,
+    -1934, -1934, -1741, -1741, -1270, -1270, -714, -714, -414, -414, -368, -368,
+    -274, -274, -37, -37, 89, 89, -89, -89, -430, -430, -711, -711,
+    -933, -933, -1198, -1198, -1478, -1478, -1657, -1657, -1728, -1728, -1770, -1770,
+    -1792, -1792, -1724, -1724, -1553, -1553, -1354, -1354, -1179, -1179, -1003, -1003,
+    -784, -784, -547, -547, -355, -355, -233, -233, -135, -135, 6, 6,
+    198, 198, 373, 373, 460, 460, 467, 467, 455, 455, 443, 443,
+    396, 396, 280, 280, 115, 115, -51, -51, -194, -194, -308, -308,
+    -383, -383, -382, -382, -284, -284, -119, -119, 60, 60, 239, 239,
+    441, 441, 650, 650, 805, 805, 883, 883, 944, 944, 1018, 1018,
+    1019, 1019, 868, 868, 633, 633, 456, 456, 354, 354, 244, 244,
+    126, 126, 92, 92, 143, 143, 158, 158, 92, 92, 61, 61,
+    146, 146, 267, 267, 323, 323, 343, 343, 387, 387, 415, 415,
+    380, 380, 357, 357, 460, 460, 670, 670, 866, 866, 975, 975,
+    1016, 1016, 1013, 1013, 969, 969, 899, 899, 813, 813, 669, 669,
+    438, 438, 191, 191, 52, 52, 55, 55, 122, 122, 200, 200,
+    321, 321, 512, 512, 704, 704, 802, 802, 812, 812, 835, 835,
+    927, 927, 1013, 1013, 990, 990, 879, 879, 798, 798, 793, 793,
+    788, 788, 728, 728, 673, 673, 680, 680, 668, 668, 528, 528,
+    312, 312, 176, 176, 154, 154, 121, 121, 1, 1, -126, -126,
+    -172, -172, -170, -170, -178, -178, -157, -157, -55, -55, 69, 69,
+    103, 103, 48, 48, 1, 1, 3, 3, -15, -15, -103, -103,
+    -200, -200, -225, -225, -203, -203, -217, -217, -279, -279, -313, -313,
+    -280, -280, -239, -239, -255, -255, -296, -296, -297, -297, -274, -274,
+    -284, -284, -322, -322, -327, -327, -302, -302, -318, -318, -385, -385,
+    -421, -421, -376, -376, -315, -315, -317, -317, -356, -356, -367, -367,
+    -341, -341, -316, -316, -303, -303, -297, -297, -313, -313, -362, -362,
+    -417, -417, -460, -460, -513, -513, -588, -588, -637, -637, -621, -621,
+    -580, -580, -566, -566, -564, -564, -527, -527, -474, -474, -463, -463,
+    -495, -495, -513, -513, -499, -499, -495, -495, -527, -527, -562, -562,
+    -559, -559, -529, -529, -506, -506, -507, -507, -518, -518, -521, -521,
+    -511, -511, -508, -508, -528, -528, -559, -559, -577, -577, -576, -576,
+    -576, -576, -577, -577, -559, -559, -519, -519, -481, -481, -455, -455,
+    -416, -416, -354, -354, -295, -295, -261, -261, -233, -233, -185, -185,
+    -124, -124, -74, -74, -38, -38, -2, -2, 38, 38, 75, 75,
+    116, 116, 167, 167, 224, 224, 277, 277, 320, 320, 359, 359,
+    398, 398, 445, 445, 499, 499, 547, 547, 580, 580, 605, 605,
+    633, 633, 661, 661, 688, 688, 731, 731, 803, 803, 882, 882,
+    938, 938, 978, 978, 1018, 1018, 1051, 1051, 1053, 1053, 1035, 1035,
+    1036, 1036, 1055, 1055, 1052, 1052, 1014, 1014, 979, 979, 973, 973,
+    973, 973, 956, 956, 929, 929, 911, 911, 893, 893, 866, 866,
+    842, 842, 829, 829, 806, 806, 757, 757, 704, 704, 676, 676,
+    662, 662, 627, 627, 566, 566, 506, 506, 465, 465, 433, 433,
+    392, 392, 338, 338, 277, 277, 219, 219, 170, 170, 133, 133,
+    98, 98, 55, 55, 8, 8, -40, -40, -91, -91, -135, -135,
+    -157, -157, -158, -158, -167, -167, -205, -205, -253, -253, -279, -279,
+    -288, -288, -315, -315, -371, -371, -427, -427, -459, -459, -477, -477,
+    -495, -495, -510, -510, -521, -521, -540, -540, -576, -576, -611, -611,
+    -626, -626, -623, -623, -622, -622, -632, -632, -648, -648, -659, -659,
+    -660, -660, -654, -654, -652, -652, -661, -661, -678, -678, -690, -690,
+    -695, -695, -699, -699, -699, -699, -683, -683, -655, -655, -644, -644,
+    -666, -666, -694, -694, -692, -692, -665, -665, -644, -644, -648, -648,
+    -659, -659, -658, -658, -648, -648, -640, -640, -635, -635, -622, -622,
+    -600, -600, -579, -579, -567, -567, -558, -558, -547, -547, -538, -538,
+    -533, -533, -528, -528, -512, -512, -485, -485, -464, -464, -463, -463,
+    -470, -470, -456, -456, -412, -412, -364, -364, -340, -340, -335, -335,
+    -327, -327, -309, -309, -293, -293, -289, -289, -289, -289, -275, -275,
+    -247, -247, -218, -218, -195, -195, -167, -167, -124, -124, -79, -79,
+    -53, -53, -50, -50, -46, -46, -13, -13, 38, 38, 75, 75,
+    84, 84, 93, 93, 139, 139, 212, 212, 270, 270, 293, 293,
+    300, 300, 319, 319, 349, 349, 378, 378, 407, 407, 448, 448,
+    488, 488, 504, 504, 495, 495, 488, 488, 502, 502, 529, 529,
+    550, 550, 566, 566, 581, 581, 597, 597, 615, 615, 639, 639,
+    667, 667, 693, 693, 711, 711, 713, 713, 700, 700, 686, 686,
+    691, 691, 709, 709, 709, 709, 677, 677, 638, 638, 623, 623,
+    623, 623, 607, 607, 578, 578, 567, 567, 579, 579, 577, 577,
+    546, 546, 512, 512, 499, 499, 498, 498, 490, 490, 480, 480,
+    470, 470, 455, 455, 431, 431, 413, 413, 408, 408, 399, 399,
+    371, 371, 335, 335, 310, 310, 293, 293, 268, 268, 233, 233,
+    201, 201, 173, 173, 140, 140, 104, 104, 79, 79, 76, 76,
+    80, 80, 79, 79, 75, 75, 75, 75, 71, 71, 52, 52,
+    20, 20, -12, -12, -35, -35, -56, -56, -78, -78, -96, -96,
+    -110, -110, -136, -136, -170, -170, -190, -190, -186, -186, -184, -184,
+    -203, -203, -225, -225, -232, -232, -236, -236, -253, -253, -270, -270,
+    -270, -270, -268, -268, -287, -287, -313, -313, -318, -318, -312, -312,
+    -329, -329, -361, -361, -371, -371, -355, -355, -351, -351, -367, -367,
+    -374, -374, -362, -362, -360, -360, -379, -379, -390, -390, -381, -381,
+    -372, -372, -375, -375, -370, -370, -346, -346, -331, -331, -346, -346,
+    -374, -374, -384, -384, -378, -378, -378, -378, -387, -387, -391, -391,
+    -390, -390, -396, -396, -412, -412, -427, -427, -433, -433, -436, -436,
+    -441, -441, -451, -451, -459, -459, -460, -460, -460, -460, -465, -465,
+    -464, -464, -446, -446, -426, -426, -428, -428, -449, -449, -463, -463,
+    -462, -462, -461, -461, -463, -463, -451, -451, -423, -423, -407, -407,
+    -416, -416, -428, -428, -418, -418, -396, -396, -387, -387, -386, -386,
+    -375, -375, -357, -357, -347, -347, -343, -343, -332, -332, -315, -315,
+    -298, -298, -281, -281, -264, -264, -245, -245, -217, -217, -177, -177,
+    -138, -138, -118, -118, -109, -109, -92, -92, -67, -67, -48, -48,
+    -45, -45, -40, -40, -21, -21, 6, 6, 33, 33, 60, 60,
+    85, 85, 110, 110, 133, 133, 159, 159, 182, 182, 192, 192,
+    193, 193, 204, 204, 223, 223, 240, 240, 256, 256, 282, 282,
+    313, 313, 335, 335, 351, 351, 372, 372, 396, 396, 412, 412,
+    423, 423, 438, 438, 451, 451, 453, 453, 446, 446, 447, 447,
+    458, 458, 465, 465, 456, 456, 441, 441, 434, 434, 439, 439,
+    449, 449, 458, 458, 468, 468, 481, 481, 495, 495, 509, 509,
+    514, 514, 509, 509, 498, 498, 483, 483, 465, 465, 450, 450,
+    442, 442, 436, 436, 426, 426, 420, 420, 419, 419, 415, 415,
+    403, 403, 390, 390, 380, 380, 370, 370, 353, 353, 333, 333,
+    317, 317, 301, 301, 287, 287, 280, 280, 281, 281, 275, 275,
+    253, 253, 225, 225, 206, 206, 186, 186, 155, 155, 120, 120,
+    95, 95, 74, 74, 47, 47, 22, 22, 8, 8, -10, -10,
+    -44, -44, -76, -76, -95, -95, -117, -117, -157, -157, -198, -198,
+    -218, -218, -227, -227, -257, -257, -305, -305, -340, -340, -351, -351,
+    -366, -366, -405, -405, -451, -451, -476, -476, -485, -485, -502, -502,
+    -534, -534, -563, -563, -575, -575, -574, -574, -576, -576, -587, -587,
+    -598, -598, -600, -600, -602, -602, -617, -617, -640, -640, -666, -666,
+    -693, -693, -727, -727, -755, -755, -768, -768, -772, -772, -777, -777,
+    -781, -781, -776, -776, -765, -765, -753, -753, -742, -742, -725, -725,
+    -707, -707, -697, -697, -691, -691, -677, -677, -656, -656, -643, -643,
+    -638, -638, -627, -627, -605, -605, -586, -586, -577, -577, -566, -566,
+    -545, -545, -520, -520, -500, -500, -487, -487, -477, -477, -461, -461,
+    -433, -433, -401, -401, -371, -371, -341, -341, -302, -302, -254, -254,
+    -204, -204, -158, -158, -113, -113, -68, -68, -26, -26, 9, 9,
+    32, 32, 50, 50, 64, 64, 77, 77, 94, 94, 113, 113,
+    129, 129, 143, 143, 167, 167, 205, 205, 249, 249, 289, 289,
+    325, 325, 355, 355, 385, 385, 416, 416, 445, 445, 465, 465,
+    476, 476, 489, 489, 506, 506, 523, 523, 540, 540, 558, 558,
+    574, 574, 579, 579, 576, 576, 573, 573, 570, 570, 563, 563,
+    555, 555, 553, 553, 556, 556, 554, 554, 548, 548, 555, 555,
+    575, 575, 589, 589, 589, 589, 587, 587, 594, 594, 596, 596,
+    586, 586, 571, 571, 557, 557, 538, 538, 514, 514, 494, 494,
+    474, 474, 441, 441, 401, 401, 372, 372, 359, 359, 349, 349,
+    334, 334, 320, 320, 309, 309, 294, 294, 276, 276, 261, 261,
+    242, 242, 205, 205, 154, 154, 115, 115, 91, 91, 58, 58,
+    11, 11, -24, -24, -39, -39, -57, -57, -95, -95, -140, -140,
+    -172, -172, -197, -197, -232, -232, -284, -284, -337, -337, -369, -369,
+    -373, -373, -364, -364, -360, -360, -363, -363, -360, -360, -353, -353,
+    -358, -358, -383, -383, -413, -413, -432, -432, -452, -452, -488, -488,
+    -532, -532, -566, -566, -589, -589, -616, -616, -643, -643, -657, -657,
+    -659, -659, -658, -658, -650, -650, -631, -631, -615, -615, -612, -612,
+    -609, -609, -592, -592, -574, -574, -576, -576, -589, -589, -594, -594,
+    -584, -584, -576, -576, -574, -574, -565, -565, -548, -548, -537, -537,
+    -534, -534, -529, -529, -516, -516, -506, -506, -501, -501, -492, -492,
+    -474, -474, -456, -456, -438, -438, -414, -414, -382, -382, -348, -348,
+    -312, -312, -271, -271, -224, -224, -180, -180, -149, -149, -133, -133,
+    -124, -124, -109, -109, -89, -89, -75, -75, -70, -70, -64, -64,
+    -43, -43, -12, -12, 13, 13, 29, 29, 54, 54, 97, 97,
+    139, 139, 162, 162, 179, 179, 210, 210, 249, 249, 273, 273,
+    282, 282, 290, 290, 304, 304, 313, 313, 312, 312, 309, 309,
+    317, 317, 331, 331, 334, 334, 324, 324, 316, 316, 317, 317,
+    318, 318, 314, 314, 312, 312, 320, 320, 334, 334, 352, 352,
+    373, 373, 398, 398, 417, 417, 420, 420, 414, 414, 410, 410,
+    409, 409, 401, 401, 383, 383, 369, 369, 361, 361, 350, 350,
+    331, 331, 319, 319, 317, 317, 313, 313, 296, 296, 276, 276,
+    265, 265, 259, 259, 245, 245, 225, 225, 213, 213, 209, 209,
+    199, 199, 175, 175, 143, 143, 118, 118, 99, 99, 82, 82,
+    63, 63, 38, 38, 8, 8, -20, -20, -42, -42, -64, -64,
+    -95, -95, -130, -130, -160, -160, -183, -183, -206, -206, -228, -228,
+    -241, -241, -243, -243, -239, -239, -234, -234, -228, -228, -223, -223,
+    -226, -226, -245, -245, -270, -270, -294, -294, -318, -318, -349, -349,
+    -381, -381, -400, -400, -403, -403, -400, -400, -400, -400, -403, -403,
+    -403, -403, -399, -399, -397, -397, -401, -401, -407, -407, -406, -406,
+    -398, -398, -394, -394, -396, -396, -396, -396, -391, -391, -384, -384,
+    -378, -378, -369, -369, -356, -356, -344, -344, -338, -338, -335, -335,
+    -329, -329, -326, -326, -337, -337, -351, -351, -353, -353, -342, -342,
+    -335, -335, -333, -333, -319, -319, -290, -290, -267, -267, -258, -258,
+    -240, -240, -198, -198, -149, -149, -120, -120, -108, -108, -87, -87,
+    -55, -55, -36, -36, -36, -36, -35, -35, -17, -17, 7, 7,
+    23, 23, 36, 36, 54, 54, 73, 73, 89, 89, 106, 106,
+    129, 129, 155, 155, 181, 181, 202, 202, 217, 217, 230, 230,
+    246, 246, 262, 262, 275, 275, 282, 282, 288, 288, 293, 293,
+    300, 300, 306, 306, 312, 312, 315, 315, 309, 309, 296, 296,
+    287, 287, 288, 288, 290, 290, 285, 285, 283, 283, 294, 294,
+    309, 309, 315, 315, 319, 319, 330, 330, 339, 339, 334, 334,
+    321, 321, 318, 318, 323, 323, 320, 320, 300, 300, 277, 277,
+    261, 261, 248, 248, 227, 227, 206, 206, 196, 196, 192, 192,
+    180, 180, 157, 157, 132, 132, 118, 118, 117, 117, 117, 117,
+    103, 103, 78, 78, 59, 59, 51, 51, 40, 40, 14, 14,
+    -15, -15, -31, -31, -39, -39, -54, -54, -83, -83, -115, -115,
+    -146, -146, -181, -181, -223, -223, -258, -258, -281, -281, -293, -293,
+    -292, -292, -275, -275, -252, -252, -240, -240, -240, -240, -240, -240,
+    -240, -240, -255, -255, -286, -286, -314, -314, -326, -326, -332, -332,
+    -347, -347, -366, -366, -377, -377, -382, -382, -390, -390, -400, -400,
+    -403, -403, -399, -399, -395, -395, -388, -388, -373, -373, -359, -359,
+    -353, -353, -352, -352, -346, -346, -335, -335, -325, -325, -315, -315,
+    -302, -302, -288, -288, -280, -280, -277, -277, -272, -272, -268, -268,
+    -272, -272, -281, -281, -288, -288, -285, -285, -278, -278, -273, -273,
+    -269, -269, -257, -257, -237, -237, -218, -218, -203, -203, -191, -191,
+    -173, -173, -146, -146, -114, -114, -89, -89, -72, -72, -54, -54,
+    -32, -32, -11, -11, 7, 7, 27, 27, 46, 46, 61, 61,
+    73, 73, 92, 92, 118, 118, 137, 137, 145, 145, 152, 152,
+    167, 167, 184, 184, 193, 193, 199, 199, 213, 213, 234, 234,
+    248, 248, 255, 255, 262, 262, 270, 270, 277, 277, 282, 282,
+    288, 288, 297, 297, 304, 304, 306, 306, 308, 308, 310, 310,
+    311, 311, 311, 311, 311, 311, 312, 312, 314, 314, 318, 318,
+    322, 322, 322, 322, 318, 318, 318, 318, 321, 321, 320, 320,
+    308, 308, 294, 294, 287, 287, 282, 282, 266, 266, 244, 244,
+    231, 231, 230, 230, 222, 222, 198, 198, 175, 175, 168, 168,
+    168, 168, 157, 157, 135, 135, 118, 118, 111, 111, 100, 100,
+    79, 79, 61, 61, 50, 50, 39, 39, 19, 19, -3, -3,
+    -20, -20, -38, -38, -64, -64, -94, -94, -123, -123, -152, -152,
+    -179, -179, -195, -195, -196, -196, -195, -195, -202, -202, -205, -205,
+    -189, -189, -168, -168, -165, -165, -181, -181, -199, -199, -214, -214,
+    -238, -238, -273, -273, -297, -297, -300, -300, -297, -297, -304, -304,
+    -316, -316, -318, -318, -314, -314, -316, -316, -321, -321, -322, -322,
+    -321, -321, -321, -321, -318, -318, -309, -309, -299, -299, -293, -293,
+    -290, -290, -278, -278, -262, -262, -257, -257, -262, -262, -262, -262,
+    -252, -252, -246, -246, -250, -250, -258, -258, -253, -253, -240, -240,
+    -236, -236, -245, -245, -249, -249, -231, -231, -205, -205, -188, -188,
+    -183, -183, -175, -175, -154, -154, -128, -128, -103, -103, -83, -83,
+    -65, -65, -45, -45, -24, -24, -6, -6, 5, 5, 7, 7,
+    10, 10, 22, 22, 38, 38, 53, 53, 67, 67, 86, 86,
+    108, 108, 124, 124, 136, 136, 154, 154, 177, 177, 192, 192,
+    195, 195, 201, 201, 218, 218, 233, 233, 239, 239, 243, 243,
+    254, 254, 266, 266, 268, 268, 262, 262, 261, 261, 268, 268,
+    274, 274, 273, 273, 275, 275, 279, 279, 282, 282, 284, 284,
+    290, 290, 297, 297, 300, 300, 296, 296, 292, 292, 293, 293,
+    294, 294, 289, 289, 279, 279, 273, 273, 273, 273, 269, 269,
+    262, 262, 254, 254, 248, 248, 239, 239, 227, 227, 214, 214,
+    205, 205, 195, 195, 181, 181, 163, 163, 148, 148, 136, 136,
+    127, 127, 117, 117, 106, 106, 94, 94, 81, 81, 68, 68,
+    51, 51, 31, 31, 13, 13, -3, -3, -22, -22, -43, -43,
+    -66, -66, -86, -86, -106, -106, -130, -130, -155, -155, -172, -172,
+    -178, -178, -181, -181, -184, -184, -186, -186, -185, -185, -183, -183,
+    -183, -183, -184, -184, -190, -190, -203, -203, -221, -221, -236, -236,
+    -247, -247, -258, -258, -270, -270, -273, -273, -266, -266, -259, -259,
+    -259, -259, -260, -260, -252, -252, -244, -244, -246, -246, -253, -253,
+    -254, -254, -247, -247, -240, -240, -237, -237, -230, -230, -218, -218,
+    -209, -209, -207, -207, -204, -204, -196, -196, -187, -187, -185, -185,
+    -187, -187, -186, -186, -181, -181, -176, -176, -173, -173, -169, -169,
+    -162, -162, -153, -153, -142, -142, -128, -128, -112, -112, -97, -97,
+    -82, -82, -67, -67, -51, -51, -33, -33, -14, -14, 4, 4,
+    18, 18, 30, 30, 40, 40, 55, 55, 72, 72, 87, 87,
+    96, 96, 104, 104, 116, 116, 132, 132, 147, 147, 157, 157,
+    165, 165, 174, 174, 183, 183, 192, 192, 201, 201, 210, 210,
+    217, 217, 218, 218, 219, 219, 225, 225, 232, 232, 237, 237,
+    240, 240, 241, 241, 243, 243, 245, 245, 246, 246, 247, 247,
+    248, 248, 247, 247, 246, 246, 247, 247, 246, 246, 243, 243,
+    245, 245, 249, 249, 252, 252, 251, 251, 248, 248, 247, 247,
+    245, 245, 238, 238, 229, 229, 224, 224, 221, 221, 216, 216,
+    209, 209, 204, 204, 203, 203, 198, 198, 189, 189, 178, 178,
+    169, 169, 162, 162, 152, 152, 140, 140, 127, 127, 114, 114,
+    102, 102, 93, 93, 83, 83, 70, 70, 57, 57, 45, 45,
+    32, 32, 15, 15, -2, -2, -15, -15, -29, -29, -52, -52,
+    -77, -77, -95, -95, -104, -104, -114, -114, -127, -127, -136, -136,
+    -135, -135, -131, -131, -132, -132, -138, -138, -146, -146, -155, -155,
+    -166, -166, -180, -180, -193, -193, -204, -204, -213, -213, -219, -219,
+    -224, -224, -226, -226, -228, -228, -229, -229, -226, -226, -221, -221,
+    -217, -217, -215, -215, -214, -214, -211, -211, -206, -206, -202, -202,
+    -199, -199, -195, -195, -193, -193, -189, -189, -182, -182, -177, -177,
+    -174, -174, -172, -172, -171, -171, -167, -167, -161, -161, -155, -155,
+    -150, -150, -146, -146, -141, -141, -134, -134, -124, -124, -114, -114,
+    -102, -102, -90, -90, -75, -75, -58, -58, -41, -41, -26, -26,
+    -10, -10, 7, 7, 22, 22, 35, 35, 44, 44, 51, 51,
+    59, 59, 69, 69, 81, 81, 92, 92, 103, 103, 114, 114,
+    128, 128, 142, 142, 154, 154, 160, 160, 166, 166, 175, 175,
+    186, 186, 194, 194, 199, 199, 204, 204, 210, 210, 214, 214,
+    217, 217, 221, 221, 225, 225, 227, 227, 228, 228, 229, 229,
+    230, 230, 231, 231, 230, 230, 229, 229, 230, 230, 232, 232,
+    233, 233, 233, 233, 231, 231, 228, 228, 225, 225, 225, 225,
+    227, 227, 226, 226, 224, 224, 222, 222, 223, 223, 221, 221,
+    214, 214, 208, 208, 206, 206, 205, 205, 201, 201, 193, 193,
+    183, 183, 174, 174, 168, 168, 162, 162, 154, 154, 144, 144,
+    134, 134, 125, 125, 116, 116, 105, 105, 94, 94, 85, 85,
+    78, 78, 70, 70, 59, 59, 48, 48, 38, 38, 25, 25,
+    8, 8, -7, -7, -20, -20, -35, -35, -51, -51, -68, -68,
+    -83, -83, -96, -96, -106, -106, -115, -115, -122, -122, -129, -129,
+    -136, -136, -144, -144, -155, -155, -165, -165, -175, -175, -182, -182,
+    -186, -186, -190, -190, -196, -196, -204, -204, -209, -209, -211, -211,
+    -212, -212, -212, -212, -212, -212, -214, -214, -215, -215, -214, -214,
+    -211, -211, -210, -210, -209, -209, -207, -207, -204, -204, -200, -200,
+    -192, -192, -185, -185, -180, -180, -175, -175, -166, -166, -155, -155,
+    -148, -148, -143, -143, -137, -137, -128, -128, -115, -115, -102, -102,
+    -92, -92, -83, -83, -73, -73, -62, -62, -50, -50, -34, -34,
+    -19, -19, -10, -10, -3, -3, 8, 8, 21, 21, 33, 33,
+    42, 42, 52, 52, 61, 61, 71, 71, 83, 83, 95, 95,
+    106, 106, 118, 118, 133, 133, 147, 147, 158, 158, 165, 165,
+    171, 171, 178, 178, 187, 187, 195, 195, 202, 202, 211, 211,
+    221, 221, 229, 229, 235, 235, 238, 238, 240, 240, 241, 241,
+    243, 243, 249, 249, 254, 254, 258, 258, 262, 262, 264, 264,
+    266, 266, 269, 269, 273, 273, 272, 272, 268, 268, 266, 266,
+    267, 267, 270, 270, 270, 270, 269, 269, 265, 265, 261, 261,
+    258, 258, 255, 255, 249, 249, 243, 243, 236, 236, 230, 230,
+    226, 226, 223, 223, 219, 219, 213, 213, 207, 207, 198, 198,
+    189, 189, 181, 181, 176, 176, 167, 167, 157, 157, 147, 147,
+    138, 138, 126, 126, 117, 117, 110, 110, 100, 100, 86, 86,
+    73, 73, 65, 65, 57, 57, 45, 45, 32, 32, 24, 24,
+    17, 17, 4, 4, -13, -13, -27, -27, -36, -36, -46, -46,
+    -59, -59, -68, -68, -76, -76, -86, -86, -98, -98, -104, -104,
+    -108, -108, -116, -116, -127, -127, -136, -136, -142, -142, -148, -148,
+    -154, -154, -161, -161, -168, -168, -172, -172, -173, -173, -174, -174,
+    -181, -181, -189, -189, -191, -191, -190, -190, -190, -190, -191, -191,
+    -190, -190, -189, -189, -192, -192, -192, -192, -187, -187, -180, -180,
+    -179, -179, -178, -178, -172, -172, -164, -164, -159, -159, -157, -157,
+    -152, -152, -143, -143, -137, -137, -129, -129, -119, -119, -111, -111,
+    -107, -107, -101, -101, -89, -89, -78, -78, -73, -73, -64, -64,
+    -48, -48, -36, -36, -30, -30, -20, -20, -5, -5, 4, 4,
+    6, 6, 14, 14, 31, 31, 44, 44, 50, 50, 58, 58,
+    71, 71, 81, 81, 87, 87, 96, 96, 110, 110, 121, 121,
+    126, 126, 134, 134, 146, 146, 155, 155, 159, 159, 168, 168,
+    180, 180, 183, 183, 182, 182, 190, 190, 199, 199, 197, 197,
+    194, 194, 204, 204, 215, 215, 215, 215, 212, 212, 217, 217,
+    223, 223, 219, 219, 217, 217, 224, 224, 231, 231, 227, 227,
+    221, 221, 224, 224, 228, 228, 222, 222, 214, 214, 213, 213,
+    215, 215, 207, 207, 202, 202, 208, 208, 210, 210, 198, 198,
+    189, 189, 193, 193, 192, 192, 176, 176, 166, 166, 167, 167,
+    163, 163, 150, 150, 146, 146, 148, 148, 137, 137, 118, 118,
+    112, 112, 112, 112, 101, 101, 82, 82, 71, 71, 71, 71,
+    64, 64, 48, 48, 38, 38, 37, 37, 27, 27, 5, 5,
+    -6, -6, -5, -5, -14, -14, -33, -33, -39, -39, -36, -36,
+    -51, -51, -74, -74, -81, -81, -85, -85, -103, -103, -121, -121,
+    -121, -121, -118, -118, -131, -131, -142, -142, -140, -140, -138, -138,
+    -149, -149, -159, -159, -159, -159, -158, -158, -168, -168, -175, -175,
+    -170, -170, -167, -167, -177, -177, -184, -184, -174, -174, -168, -168,
+    -182, -182, -189, -189, -171, -171, -158, -158, -171, -171, -175, -175,
+    -155, -155, -145, -145, -153, -153, -150, -150, -129, -129, -124, -124,
+    -132, -132, -124, -124, -102, -102, -96, -96, -105, -105, -99, -99,
+    -77, -77, -67, -67, -72, -72, -66, -66, -44, -44, -30, -30,
+    -33, -33, -26, -26, 0, 0, 11, 11, 4, 4, 13, 13,
+    39, 39, 45, 45, 37, 37, 53, 53, 79, 79, 80, 80,
+    73, 73, 88, 88, 106, 106, 102, 102, 98, 98, 114, 114,
+    129, 129, 124, 124, 118, 118, 131, 131, 145, 145, 144, 144,
+    140, 140, 152, 152, 165, 165, 159, 159, 152, 152, 167, 167,
+    180, 180, 168, 168, 158, 158, 176, 176, 187, 187, 169, 169,
+    158, 158, 176, 176, 185, 185, 169, 169, 162, 162, 173, 173,
+    171, 171, 154, 154, 153, 153, 167, 167, 166, 166, 152, 152,
+    150, 150, 159, 159, 155, 155, 136, 136, 131, 131, 142, 142,
+    141, 141, 124, 124, 119, 119, 132, 132, 129, 129, 106, 106,
+    101, 101, 117, 117, 115, 115, 93, 93, 90, 90, 101, 101,
+    91, 91, 70, 70, 71, 71, 79, 79, 67, 67, 53, 53,
+    58, 58, 62, 62, 49, 49, 39, 39, 46, 46, 50, 50,
+    35, 35, 20, 20, 23, 23, 26, 26, 10, 10, -7, -7,
+    2, 2, 13, 13, -5, -5, -25, -25, -16, -16, -8, -8,
+    -30, -30, -49, -49, -36, -36, -27, -27, -50, -50, -67, -67,
+    -55, -55, -50, -50, -66, -66, -72, -72, -57, -57, -55, -55,
+    -73, -73, -86, -86, -80, -80, -74, -74, -78, -78, -78, -78,
+    -66, -66, -62, -62, -71, -71, -72, -72, -63, -63, -66, -66,
+    -81, -81, -79, -79, -65, -65, -73, -73, -95, -95, -85, -85,
+    -54, -54, -48, -48, -66, -66, -67, -67, -54, -54, -59, -59,
+    -69, -69, -58, -58, -43, -43, -50, -50, -56, -56, -37, -37,
+    -19, -19, -30, -30, -47, -47, -37, -37, -16, -16, -16, -16,
+    -26, -26, -18, -18, -2, -2, -2, -2, -8, -8, 9, 9,
+    40, 40, 51, 51, 43, 43, 42, 42, 45, 45, 40, 40,
+    40, 40, 52, 52, 62, 62, 72, 72, 95, 95, 106, 106,
+    75, 75, 40, 40, 50, 50, 83, 83, 97, 97, 114, 114,
+    167, 167, 227, 227, 250, 250, 237, 237, 196, 196, 107, 107,
+    -27, -27, -148, -148, -215, -215, -241, -241, -170, -170, 164, 164,
+    780, 780, 1353, 1353, 1486, 1486, 1157, 1157, 660, 660, 181, 181,
+    -279, -279, -640, -640, -722, -722, -513, -513, -198, -198, 90, 90,
+    360, 360, 589, 589, 651, 651, 474, 474, 153, 153, -166, -166,
+    -405, -405, -522, -522, -466, -466, -245, -245, 50, 50, 322, 322,
+    499, 499, 507, 507, 336, 336, 107, 107, -61, -61, -200, -200,
+    -364, -364, -451, -451, -325, -325, -44, -44, 204, 204, 328, 328,
+    374, 374, 362, 362, 247, 247, 29, 29, -199, -199, -341, -341,
+    -369, -369, -288, -288, -134, -134, 7, 7, 72, 72, 81, 81,
+    56, 56, -47, -47, -232, -232, -378, -378, -381, -381, -286, -286,
+    -168, -168, -29, -29, 105, 105, 138, 138, 48, 48, -54, -54,
+    -98, -98, -147, -147, -246, -246, -313, -313, -278, -278, -199, -199,
+    -147, -147, -78, -78, 42, 42, 120, 120, 59, 59, -77, -77,
+    -166, -166, -197, -197, -198, -198, -142, -142, -57, -57, -37, -37,
+    -67, -67, -20, -20, 87, 87, 82, 82, -63, -63, -171, -171,
+    -143, -143, -75, -75, -44, -44, -2, -2, 66, 66, 79, 79,
+    15, 15, -29, -29, -9, -9, -4, -4, -42, -42, -19, -19,
+    86, 86, 118, 118, 30, 30, -7, -7, 91, 91, 171, 171,
+    134, 134, 74, 74, 48, 48, 1, 1, -35, -35, 46, 46,
+    196, 196, 262, 262, 221, 221, 174, 174, 148, 148, 83, 83,
+    -10, -10, -51, -51, -18, -18, 34, 34, 112, 112, 266, 266,
+    412, 412, 379, 379, 199, 199, 83, 83, 76, 76, 25, 25,
+    -84, -84, -109, -109, -29, -29, 63, 63, 170, 170, 308, 308,
+    369, 369, 290, 290, 150, 150, -1, -1, -183, -183, -286, -286,
+    -129, -129, 200, 200, 373, 373, 275, 275, 171, 171, 248, 248,
+    294, 294, 75, 75, -213, -213, -242, -242, -87, -87, -25, -25,
+    -26, -26, 97, 97, 266, 266, 304, 304, 258, 258, 218, 218,
+    135, 135, 59, 59, 107, 107, 80, 80, -303, -303, -731, -731,
+    -565, -565, 153, 153, 647, 647, 527, 527, 262, 262, 291, 291,
+    323, 323, -10, -10, -386, -386, -317, -317, 18, 18, 154, 154,
+    142, 142, 224, 224, 198, 198, -136, -136, -392, -392, -194, -194,
+    145, 145, 162, 162, -82, -82, -298, -298, -358, -358, -153, -153,
+    323, 323, 617, 617, 209, 209, -602, -602, -874, -874, -301, -301,
+    324, 324, 274, 274, -132, -132, -224, -224, -27, -27, 122, 122,
+    310, 310, 526, 526, 194, 194, -786, -786, -1358, -1358, -712, -712,
+    431, 431, 858, 858, 461, 461, -22, -22, -193, -193, -205, -205,
+    -235, -235, -248, -248, -145, -145, 126, 126, 467, 467, 550, 550,
+    111, 111, -535, -535, -703, -703, -326, -326, -118, -118, -310, -310,
+    -146, -146, 664, 664, 1125, 1125, 519, 519, -372, -372, -604, -604,
+    -455, -455, -500, -500, -417, -417, 249, 249, 986, 986, 975, 975,
+    336, 336, -144, -144, -227, -227, -347, -347, -608, -608, -535, -535,
+    23, 23, 554, 554, 656, 656, 448, 448, 148, 148, -111, -111,
+    -170, -170, -81, -81, -128, -128, -231, -231, 46, 46, 591, 591,
+    680, 680, 134, 134, -311, -311, -126, -126, 253, 253, 183, 183,
+    -206, -206, -286, -286, 101, 101, 479, 479, 498, 498, 344, 344,
+    292, 292, 312, 312, 198, 198, -178, -178, -636, -636, -617, -617,
+    191, 191, 1140, 1140, 1282, 1282, 686, 686, 147, 147, -227, -227,
+    -865, -865, -1335, -1335, -637, -637, 914, 914, 1592, 1592, 649, 649,
+    -494, -494, -313, -313, 605, 605, 651, 651, -285, -285, -885, -885,
+    -580, -580, -69, -69, 240, 240, 712, 712, 1249, 1249, 1007, 1007,
+    -207, -207, -1293, -1293, -1176, -1176, -154, -154, 583, 583, 457, 457,
+    11, 11, -28, -28, 300, 300, 443, 443, 192, 192, -169, -169,
+    -383, -383, -473, -473, -426, -426, -55, -55, 574, 574, 865, 865,
+    290, 290, -718, -718, -1006, -1006, -146, -146, 815, 815, 607, 607,
+    -530, -530, -1060, -1060, -184, -184, 974, 974, 785, 785, -570, -570,
+    -1126, -1126, 168, 168, 1700, 1700, 1208, 1208, -992, -992, -2284, -2284,
+    -1291, -1291, 480, 480, 1100, 1100, 774, 774, 751, 751, 938, 938,
+    299, 299, -917, -917, -1253, -1253, -430, -430, 114, 114, -376, -376,
+    -646, -646, 457, 457, 1864, 1864, 1666, 1666, -105, -105, -1512, -1512,
+    -1291, -1291, -186, -186, 429, 429, 271, 271, 23, 23, 149, 149,
+    432, 432, 500, 500, 312, 312, 93, 93, -1, -1, -58, -58,
+    -258, -258, -550, -550, -620, -620, -269, -269, 396, 396, 1207, 1207,
+    2000, 2000, 2342, 2342, 1661, 1661, 30, 30, -1483, -1483, -1751, -1751,
+    -824, -824, 196, 196, 519, 519, 442, 442, 683, 683, 1404, 1404,
+    1996, 1996, 1588, 1588, -69, -69, -1947, -1947, -2453, -2453, -1234, -1234,
+    362, 362, 1067, 1067, 1124, 1124, 1304, 1304, 1329, 1329, 388, 388,
+    -1158, -1158, -1850, -1850, -1141, -1141, -154, -154, 115, 115, 175, 175,
+    835, 835, 1659, 1659, 1553, 1553, 236, 236, -1441, -1441, -2152, -2152,
+    -1183, -1183, 629, 629, 1489, 1489, 782, 782, -84, -84, 343, 343,
+    1474, 1474, 1488, 1488, -179, -179, -2045, -2045, -2404, -2404, -1109, -1109,
+    721, 721, 1891, 1891, 1645, 1645, 127, 127, -1289, -1289, -1306, -1306,
+    -423, -423, -18, -18, -161, -161, -33, -33, 192, 192, -143, -143,
+    -464, -464, 173, 173, 1011, 1011, 450, 450, -1160, -1160, -1613, -1613,
+    -192, -192, 1097, 1097, 640, 640, -436, -436, -538, -538, -144, -144,
+    -188, -188, -13, -13, 908, 908, 1189, 1189, -272, -272, -1964, -1964,
+    -1749, -1749, 24, 24, 1221, 1221, 933, 933, 167, 167, -79, -79,
+    66, 66, 175, 175, 175, 175, -90, -90, -734, -734, -1145, -1145,
+    -657, -657, 110, 110, -5, -5, -702, -702, -526, -526, 838, 838,
+    1970, 1970, 1538, 1538, -274, -274, -2185, -2185, -2851, -2851, -1635, -1635,
+    789, 789, 2522, 2522, 2025, 2025, -65, -65, -1474, -1474, -1068, -1068,
+    -171, -171, -415, -415, -1236, -1236, -788, -788, 1070, 1070, 2225, 2225,
+    1100, 1100, -1159, -1159, -2127, -2127, -1083, -1083, 441, 441, 836, 836,
+    157, 157, -481, -481, -477, -477, -137, -137, 128, 128, 266, 266,
+    218, 218, -186, -186, -681, -681, -574, -574, 265, 265, 886, 886,
+    300, 300, -1093, -1093, -1650, -1650, -512, -512, 970, 970, 861, 861,
+    -509, -509, -941, -941, 227, 227, 1104, 1104, 301, 301, -979, -979,
+    -1063, -1063, -320, -320, -51, -51, -72, -72, 641, 641, 1510, 1510,
+    876, 876, -974, -974, -1791, -1791, -882, -882, -44, -44, -233, -233,
+    -106, -106, 1087, 1087, 1817, 1817, 790, 790, -931, -931, -1605, -1605,
+    -1092, -1092, -342, -342, 221, 221, 624, 624, 498, 498, -307, -307,
+    -823, -823, -170, -170, 818, 818, 746, 746, -156, -156, -650, -650,
+    -556, -556, -506, -506, -480, -480, -132, -132, 154, 154, -82, -82,
+    -313, -313, 163, 163, 816, 816, 510, 510, -602, -602, -1122, -1122,
+    -542, -542, 116, 116, 213, 213, 379, 379, 830, 830, 581, 581,
+    -736, -736, -1823, -1823, -1430, -1430, 9, 9, 1119, 1119, 1130, 1130,
+    259, 259, -751, -751, -1047, -1047, -251, -251, 807, 807, 640, 640,
+    -822, -822, -1630, -1630, -458, -458, 1219, 1219, 1166, 1166, -350, -350,
+    -1187, -1187, -554, -554, 249, 249, 140, 140, -273, -273, 10, 10,
+    648, 648, 473, 473, -591, -591, -1246, -1246, -656, -656, 390, 390,
+    592, 592, -123, -123, -522, -522, 234, 234, 1202, 1202, 769, 769,
+    -870, -870, -1709, -1709, -804, -804, 462, 462, 641, 641, 164, 164,
+    157, 157, 643, 643, 797, 797, 222, 222, -741, -741, -1529, -1529,
+    -1633, -1633, -692, -692, 931, 931, 1898, 1898, 1239, 1239, -159, -159,
+    -611, -611, 3, 3, 304, 304, -363, -363, -1172, -1172, -1163, -1163,
+    -288, -288, 750, 750, 1132, 1132, 691, 691, 129, 129, 57, 57,
+    109, 109, -356, -356, -1009, -1009, -881, -881, 94, 94, 759, 759,
+    362, 362, -249, -249, 88, 88, 996, 996, 1124, 1124, 159, 159,
+    -918, -918, -1243, -1243, -737, -737, 158, 158, 713, 713, 479, 479,
+    45, 45, 338, 338, 1017, 1017, 728, 728, -737, -737, -1786, -1786,
+    -1127, -1127, 500, 500, 1470, 1470, 1391, 1391, 1053, 1053, 754, 754,
+    10, 10, -1099, -1099, -1570, -1570, -825, -825, 465, 465, 1246, 1246,
+    1179, 1179, 712, 712, 442, 442, 445, 445, 172, 172, -767, -767,
+    -1797, -1797, -1858, -1858, -675, -675, 957, 957, 2082, 2082, 2237, 2237,
+    1343, 1343, -334, -334, -1966, -1966, -2506, -2506, -1658, -1658, -243, -243,
+    671, 671, 816, 816, 663, 663, 591, 591, 506, 506, 187, 187,
+    -384, -384, -1020, -1020, -1362, -1362, -1008, -1008, 74, 74, 1214, 1214,
+    1425, 1425, 421, 421, -816, -816, -884, -884, 328, 328, 1272, 1272,
+    653, 653, -782, -782, -1290, -1290, -538, -538, 197, 197, 98, 98,
+    -240, -240, -81, -81, 405, 405, 734, 734, 773, 773, 435, 435,
+    -379, -379, -1151, -1151, -1012, -1012, -82, -82, 437, 437, 99, 99,
+    -18, -18, 829, 829, 1618, 1618, 1107, 1107, -205, -205, -877, -877,
+    -512, -512, 207, 207, 810, 810, 1230, 1230, 1215, 1215, 616, 616,
+    -32, -32, -139, -139, 22, 22, -143, -143, -406, -406, -64, -64,
+    747, 747, 1080, 1080, 597, 597, 49, 49, 119, 119, 490, 490,
+    406, 406, -248, -248, -754, -754, -380, -380, 707, 707, 1437, 1437,
+    990, 990, -159, -159, -757, -757, -315, -315, 391, 391, 463, 463,
+    -35, -35, -436, -436, -390, -390, -40, -40, 365, 365, 601, 601,
+    470, 470, 79, 79, -94, -94, 212, 212, 579, 579, 410, 410,
+    -223, -223, -616, -616, -320, -320, 301, 301, 551, 551, 282, 282,
+    -11, -11, -2, -2, -58, -58, -612, -612, -1299, -1299, -1269, -1269,
+    -340, -340, 692, 692, 1043, 1043, 755, 755, 289, 289, -202, -202,
+    -757, -757, -1121, -1121, -895, -895, -86, -86, 807, 807, 1207, 1207,
+    857, 857, 4, 4, -736, -736, -910, -910, -666, -666, -442, -442,
+    -333, -333, -96, -96, 278, 278, 434, 434, 176, 176, -246, -246,
+    -487, -487, -458, -458, -235, -235, 63, 63, 250, 250, 203, 203,
+    52, 52, -2, -2, -6, -6, -146, -146, -451, -451, -801, -801,
+    -1021, -1021, -831, -831, -80, -80, 794, 794, 991, 991, 329, 329,
+    -470, -470, -779, -779, -781, -781, -782, -782, -506, -506, 249, 249,
+    865, 865, 676, 676, 38, 38, -231, -231, -111, -111, -221, -221,
+    -640, -640, -757, -757, -264, -264, 360, 360, 463, 463, -59, -59,
+    -682, -682, -717, -717, 8, 8, 841, 841, 928, 928, 245, 245,
+    -393, -393, -426, -426, -114, -114, 117, 117, 240, 240, 315, 315,
+    267, 267, 146, 146, 27, 27, -381, -381, -1233, -1233, -1713, -1713,
+    -760, -760, 1153, 1153, 2133, 2133, 1247, 1247, -255, -255, -721, -721,
+    -167, -167, 221, 221, -112, -112, -673, -673, -834, -834, -407, -407,
+    394, 394, 1065, 1065, 1113, 1113, 534, 534, -257, -257, -947, -947,
+    -1373, -1373, -1201, -1201, -224, -224, 990, 990, 1461, 1461, 971, 971,
+    246, 246, -157, -157, -420, -420, -753, -753, -830, -830, -332, -332,
+    506, 506, 1150, 1150, 1197, 1197, 494, 494, -659, -659, -1474, -1474,
+    -1376, -1376, -698, -698, -204, -204, -64, -64, 122, 122, 458, 458,
+    562, 562, 273, 273, -83, -83, -253, -253, -332, -332, -369, -369,
+    -215, -215, 91, 91, 265, 265, 202, 202, 76, 76, -6, -6,
+    -106, -106, -267, -267, -507, -507, -872, -872, -1200, -1200, -1062, -1062,
+    -255, -255, 762, 762, 1245, 1245, 918, 918, 147, 147, -540, -540,
+    -859, -859, -747, -747, -288, -288, 265, 265, 581, 581, 478, 478,
+    50, 50, -363, -363, -414, -414, -135, -135, -7, -7, -333, -333,
+    -739, -739, -648, -648, -78, -78, 450, 450, 627, 627, 555, 555,
+    369, 369, 114, 114, -63, -63, -45, -45, -48, -48, -329, -329,
+    -585, -585, -219, -219, 659, 659, 1105, 1105, 508, 508, -609, -609,
+    -1270, -1270, -1147, -1147, -665, -665, -299, -299, -37, -37, 430, 430,
+    1120, 1120, 1483, 1483, 921, 921, -413, -413, -1525, -1525, -1476, -1476,
+    -333, -333, 891, 891, 1252, 1252, 715, 715, -12, -12, -326, -326,
+    -260, -260, -223, -223, -394, -394, -528, -528, -397, -397, -126, -126,
+    118, 118, 430, 430, 799, 799, 802, 802, 177, 177, -573, -573,
+    -743, -743, -376, -376, -67, -67, -1, -1, 171, 171, 546, 546,
+    693, 693, 328, 328, -277, -277, -728, -728, -881, -881, -668, -668,
+    -89, -89, 467, 467, 466, 466, -18, -18, -309, -309, -75, -75,
+    241, 241, 157, 157, -144, -144, -139, -139, 268, 268, 598, 598,
+    367, 367, -346, -346, -935, -935, -878, -878, -301, -301, 173, 173,
+    182, 182, 16, 16, 64, 64, 195, 195, 66, 66, -233, -233,
+    -339, -339, -233, -233, -149, -149, -45, -45, 250, 250, 478, 478,
+    181, 181, -480, -480, -740, -740, -268, -268, 334, 334, 383, 383,
+    4, 4, -244, -244, -248, -248, -298, -298, -383, -383, -162, -162,
+    330, 330, 517, 517, 72, 72, -516, -516, -528, -528, 33, 33,
+    451, 451, 248, 248, -242, -242, -373, -373, 7, 7, 445, 445,
+    432, 432, -85, -85, -666, -666, -761, -761, -239, -239, 445, 445,
+    701, 701, 421, 421, 25, 25, -101, -101, -2, -2, 67, 67,
+    39, 39, 28, 28, 45, 45, -36, -36, -221, -221, -305, -305,
+    -134, -134, 137, 137, 191, 191, -23, -23, -163, -163, 67, 67,
+    446, 446, 476, 476, 94, 94, -199, -199, -79, -79, 139, 139,
+    22, 22, -310, -310, -413, -413, -160, -160, 206, 206, 473, 473,
+    552, 552, 304, 304, -294, -294, -831, -831, -723, -723, 102, 102,
+    1040, 1040, 1403, 1403, 1017, 1017, 255, 255, -320, -320, -380, -380,
+    -118, -118, -50, -50, -356, -356, -593, -593, -276, -276, 437, 437,
+    912, 912, 764, 764, 158, 158, -493, -493, -859, -859, -782, -782,
+    -320, -320, 237, 237, 574, 574, 640, 640, 580, 580, 423, 423,
+    51, 51, -474, -474, -806, -806, -691, -691, -318, -318, -121, -121,
+    -197, -197, -114, -114, 463, 463, 1074, 1074, 860, 860, -197, -197,
+    -1015, -1015, -776, -776, -36, -36, 127, 127, -289, -289, -280, -280,
+    539, 539, 1256, 1256, 934, 934, -109, -109, -846, -846, -882, -882,
+    -660, -660, -571, -571, -458, -458, -32, -32, 578, 578, 866, 866,
+    469, 469, -387, -387, -1041, -1041, -1029, -1029, -501, -501, 30, 30,
+    270, 270, 360, 360, 529, 529, 703, 703, 559, 559, -32, -32,
+    -745, -745, -1056, -1056, -770, -770, -219, -219, 106, 106, 99, 99,
+    49, 49, 158, 158, 293, 293, 262, 262, 72, 72, -171, -171,
+    -375, -375, -413, -413, -185, -185, 191, 191, 426, 426, 340, 340,
+    6, 6, -330, -330, -399, -399, -98, -98, 325, 325, 389, 389,
+    -71, -71, -580, -580, -526, -526, 64, 64, 577, 577, 596, 596,
+    256, 256, -129, -129, -392, -392, -448, -448, -276, -276, 7, 7,
+    273, 273, 501, 501, 599, 599, 356, 356, -165, -165, -476, -476,
+    -280, -280, 29, 29, -64, -64, -349, -349, -208, -208, 332, 332,
+    561, 561, 156, 156, -356, -356, -382, -382, 2, 2, 315, 315,
+    272, 272, -54, -54, -354, -354, -320, -320, 25, 25, 247, 247,
+    7, 7, -438, -438, -508, -508, -66, -66, 419, 419, 471, 471,
+    116, 116, -267, -267, -365, -365, -150, -150, 128, 128, 175, 175,
+    15, 15, 15, 15, 353, 353, 646, 646, 400, 400, -308, -308,
+    -905, -905, -941, -941, -413, -413, 375, 375, 981, 981, 987, 987,
+    328, 328, -513, -513, -875, -875, -572, -572, -41, -41, 193, 193,
+    69, 69, -74, -74, 32, 32, 275, 275, 313, 313, 22, 22,
+    -291, -291, -237, -237, 112, 112, 266, 266, -56, -56, -550, -550,
+    -689, -689, -311, -311, 252, 252, 539, 539, 378, 378, -20, -20,
+    -338, -338, -450, -450, -425, -425, -331, -331, -162, -162, 43, 43,
+    172, 172, 198, 198, 231, 231, 309, 309, 267, 267, 8, 8,
+    -251, -251, -222, -222, 39, 39, 204, 204, 108, 108, -85, -85,
+    -139, -139, -28, -28, 49, 49, -103, -103, -406, -406, -522, -522,
+    -222, -222, 299, 299, 599, 599, 488, 488, 200, 200, 38, 38,
+    16, 16, -26, -26, -100, -100, -81, -81, 50, 50, 166, 166,
+    183, 183, 145, 145, 107, 107, 29, 29, -167, -167, -421, -421,
+    -509, -509, -306, -306, -25, -25, -5, -5, -240, -240, -350, -350,
+    -71, -71, 419, 419, 747, 747, 734, 734, 458, 458, 69, 69,
+    -289, -289, -487, -487, -487, -487, -366, -366, -181, -181, 63, 63,
+    248, 248, 165, 165, -185, -185, -509, -509, -553, -553, -338, -338,
+    6, 6, 384, 384, 639, 639, 567, 567, 182, 182, -230, -230,
+    -420, -420, -375, -375, -191, -191, 60, 60, 233, 233, 160, 160,
+    -85, -85, -198, -198, -86, -86, -34, -34, -257, -257, -537, -537,
+    -543, -543, -292, -292, -73, -73, -64, -64, -181, -181, -222, -222,
+    -48, -48, 284, 284, 521, 521, 425, 425, 58, 58, -247, -247,
+    -236, -236, -5, -5, 135, 135, -21, -21, -391, -391, -687, -687,
+    -660, -660, -329, -329, 48, 48, 276, 276, 398, 398, 509, 509,
+    545, 545, 405, 405, 159, 159, -27, -27, -75, -75, 15, 15,
+    197, 197, 323, 323, 220, 220, -39, -39, -147, -147, 15, 15,
+    166, 166, 48, 48, -170, -170, -170, -170, -1, -1, 41, 41,
+    -76, -76, -87, -87, 99, 99, 247, 247, 189, 189, 67, 67,
+    94, 94, 254, 254, 348, 348, 242, 242, -1, -1, -203, -203,
+    -241, -241, -163, -163, -120, -120, -192, -192, -293, -293, -299, -299,
+    -196, -196, -61, -61, 60, 60, 174, 174, 285, 285, 352, 352,
+    325, 325, 184, 184, -26, -26, -199, -199, -255, -255, -230, -230,
+    -207, -207, -167, -167, -25, -25, 178, 178, 237, 237, 30, 30,
+    -293, -293, -439, -439, -290, -290, 11, 11, 256, 256, 346, 346,
+    277, 277, 82, 82, -139, -139, -223, -223, -105, -105, 102, 102,
+    235, 235, 253, 253, 198, 198, 69, 69, -144, -144, -345, -345,
+    -412, -412, -373, -373, -352, -352, -341, -341, -210, -210, 27, 27,
+    174, 174, 141, 141, 69, 69, 78, 78, 105, 105, 87, 87,
+    87, 87, 131, 131, 109, 109, -30, -30, -159, -159, -189, -189,
+    -228, -228, -368, -368, -467, -467, -363, -363, -159, -159, -63, -63,
+    -73, -73, -25, -25, 112, 112, 215, 215, 228, 228, 201, 201,
+    149, 149, 43, 43, -75, -75, -112, -112, -70, -70, -47, -47,
+    -94, -94, -172, -172, -234, -234, -273, -273, -274, -274, -222, -222,
+    -147, -147, -107, -107, -97, -97, -69, -69, -13, -13, 34, 34,
+    60, 60, 93, 93, 149, 149, 188, 188, 144, 144, 7, 7,
+    -141, -141, -198, -198, -162, -162, -138, -138, -205, -205, -315, -315,
+    -357, -357, -291, -291, -165, -165, -35, -35, 69, 69, 133, 133,
+    165, 165, 198, 198, 232, 232, 190, 190, 32, 32, -146, -146,
+    -189, -189, -76, -76, 64, 64, 102, 102, 28, 28, -81, -81,
+    -148, -148, -144, -144, -98, -98, -65, -65, -65, -65, -71, -71,
+    -55, -55, -31, -31, -12, -12, 17, 17, 61, 61, 87, 87,
+    85, 85, 89, 89, 120, 120, 135, 135, 97, 97, 30, 30,
+    -31, -31, -100, -100, -180, -180, -210, -210, -134, -134, -3, -3,
+    64, 64, 24, 24, -51, -51, -59, -59, 28, 28, 146, 146,
+    205, 205, 180, 180, 133, 133, 120, 120, 110, 110, 46, 46,
+    -51, -51, -97, -97, -77, -77, -57, -57, -72, -72, -78, -78,
+    -39, -39, 25, 25, 92, 92, 168, 168, 232, 232, 231, 231,
+    157, 157, 64, 64, -5, -5, -45, -45, -41, -41, 32, 32,
+    136, 136, 182, 182, 151, 151, 114, 114, 117, 117, 115, 115,
+    74, 74, 32, 32, 15, 15, -14, -14, -64, -64, -67, -67,
+    15, 15, 96, 96, 82, 82, 7, 7, -21, -21, 26, 26,
+    84, 84, 122, 122, 156, 156, 165, 165, 109, 109, 32, 32,
+    24, 24, 76, 76, 70, 70, -38, -38, -133, -133, -111, -111,
+    -14, -14, 66, 66, 130, 130, 219, 219, 281, 281, 246, 246,
+    173, 173, 168, 168, 193, 193, 113, 113, -68, -68, -190, -190,
+    -166, -166, -82, -82, -27, -27, 24, 24, 83, 83, 68, 68,
+    -47, -47, -135, -135, -93, -93, -10, -10, -7, -7, -26, -26,
+    56, 56, 177, 177, 156, 156, -15, -15, -150, -150, -149, -149,
+    -117, -117, -158, -158, -215, -215, -194, -194, -133, -133, -141, -141,
+    -232, -232, -325, -325, -356, -356, -330, -330, -276, -276, -226, -226,
+    -197, -197, -162, -162, -81, -81, 15, 15, 20, 20, -118, -118,
+    -323, -323, -475, -475, -535, -535, -531, -531, -465, -465, -332, -332,
+    -195, -195, -147, -147, -186, -186, -214, -214, -193, -193, -205, -205,
+    -309, -309, -420, -420, -415, -415, -310, -310, -249, -249, -315, -315,
+    -443, -443, -519, -519, -505, -505, -437, -437, -371, -371, -353, -353,
+    -391, -391, -429, -429, -394, -394, -304, -304, -252, -252, -289, -289,
+    -359, -359, -399, -399, -422, -422, -468, -468, -518, -518, -523, -523,
+    -479, -479, -416, -416, -350, -350, -304, -304, -335, -335, -452, -452,
+    -560, -560, -549, -549, -429, -429, -290, -290, -177, -177, -86, -86,
+    -50, -50, -116, -116, -238, -238, -292, -292, -223, -223, -115, -115,
+    -81, -81, -140, -140, -226, -226, -266, -266, -235, -235, -167, -167,
+    -126, -126, -130, -130, -109, -109, 2, 2, 151, 151, 228, 228,
+    208, 208, 165, 165, 154, 154, 153, 153, 142, 142, 148, 148,
+    177, 177, 179, 179, 122, 122, 55, 55, 42, 42, 78, 78,
+    121, 121, 160, 160, 208, 208, 261, 261, 308, 308, 362, 362,
+    439, 439, 520, 520, 547, 547, 493, 493, 402, 402, 354, 354,
+    378, 378, 433, 433, 466, 466, 475, 475, 489, 489, 509, 509,
+    504, 504, 473, 473, 457, 457, 484, 484, 532, 532, 583, 583,
+    655, 655, 754, 754, 838, 838, 871, 871, 873, 873, 870, 870,
+    837, 837, 748, 748, 650, 650, 624, 624, 687, 687, 756, 756,
+    755, 755, 690, 690, 625, 625, 607, 607, 637, 637, 688, 688,
+    731, 731, 753, 753, 763, 763, 770, 770, 757, 757, 700, 700,
+    592, 592, 463, 463, 362, 362, 332, 332, 356, 356, 364, 364,
+    308, 308, 232, 232, 223, 223, 289, 289, 338, 338, 299, 299,
+    221, 221, 205, 205, 255, 255, 283, 283, 241, 241, 180, 180,
+    152, 152, 129, 129, 55, 55, -59, -59, -160, -160, -232, -232,
+    -301, -301, -349, -349, -299, -299, -148, -148, -18, -18, -25, -25,
+    -140, -140, -249, -249, -309, -309, -365, -365, -446, -446, -515, -515,
+    -544, -544, -557, -557, -571, -571, -574, -574, -578, -578, -647, -647,
+    -793, -793, -921, -921, -936, -936, -858, -858, -765, -765, -679, -679,
+    -604, -604, -598, -598, -740, -740, -993, -993, -1214, -1214, -1310, -1310,
+    -1322, -1322, -1322, -1322, -1290, -1290, -1189, -1189, -1087, -1087, -1107, -1107,
+    -1240, -1240, -1318, -1318, -1220, -1220, -1050, -1050, -1012, -1012, -1145, -1145,
+    -1265, -1265, -1222, -1222, -1112, -1112, -1133, -1133, -1324, -1324, -1527, -1527,
+    -1596, -1596, -1515, -1515, -1351, -1351, -1176, -1176, -1061, -1061, -1052, -1052,
+    -1117, -1117, -1159, -1159, -1132, -1132, -1084, -1084, -1066, -1066, -1065, -1065,
+    -1064, -1064, -1089, -1089, -1131, -1131, -1118, -1118, -1024, -1024, -934, -934,
+    -923, -923, -933, -933, -859, -859, -718, -718, -628, -628, -636, -636,
+    -648, -648, -576, -576, -438, -438, -294, -294, -151, -151, -12, -12,
+    60, 60, 2, 2, -129, -129, -189, -189, -92, -92, 92, 92,
+    234, 234, 299, 299, 366, 366, 490, 490, 620, 620, 681, 681,
+    700, 700, 783, 783, 968, 968, 1155, 1155, 1225, 1225, 1204, 1204,
+    1224, 1224, 1326, 1326, 1389, 1389, 1312, 1312, 1195, 1195, 1241, 1241,
+    1493, 1493, 1768, 1768, 1883, 1883, 1864, 1864, 1866, 1866, 1942, 1942,
+    2019, 2019, 2049, 2049, 2079, 2079, 2145, 2145, 2206, 2206, 2217, 2217,
+    2186, 2186, 2169, 2169, 2207, 2207, 2298, 2298, 2387, 2387, 2408, 2408,
+    2353, 2353, 2281, 2281, 2242, 2242, 2219, 2219, 2177, 2177, 2139, 2139,
+    2141, 2141, 2147, 2147, 2093, 2093, 1990, 1990, 1899, 1899, 1826, 1826,
+    1746, 1746, 1672, 1672, 1623, 1623, 1554, 1554, 1428, 1428, 1306, 1306,
+    1262, 1262, 1248, 1248, 1157, 1157, 995, 995, 866, 866, 806, 806,
+    745, 745, 663, 663, 615, 615, 612, 612, 584, 584, 512, 512,
+    436, 436, 348, 348, 205, 205, 56, 56, 14, 14, 68, 68,
+    59, 59, -112, -112, -356, -356, -527, -527, -602, -602, -669, -669,
+    -782, -782, -905, -905, -966, -966, -943, -943, -883, -883, -850, -850,
+    -850, -850, -854, -854, -898, -898, -1047, -1047, -1255, -1255, -1382, -1382,
+    -1429, -1429, -1578, -1578, -1887, -1887, -2140, -2140, -2154, -2154, -2080, -2080,
+    -2159, -2159, -2343, -2343, -2402, -2402, -2333, -2333, -2348, -2348, -2483, -2483,
+    -2526, -2526, -2401, -2401, -2336, -2336, -2497, -2497, -2730, -2730, -2803, -2803,
+    -2744, -2744, -2742, -2742, -2850, -2850, -2933, -2933, -2881, -2881, -2738, -2738,
+    -2608, -2608, -2528, -2528, -2474, -2474, -2450, -2450, -2510, -2510, -2671, -2671,
+    -2831, -2831, -2833, -2833, -2616, -2616, -2280, -2280, -1969, -1969, -1754, -1754,
+    -1654, -1654, -1677, -1677, -1766, -1766, -1799, -1799, -1732, -1732, -1668, -1668,
+    -1687, -1687, -1689, -1689, -1532, -1532, -1267, -1267, -1091, -1091, -1097, -1097,
+    -1163, -1163, -1118, -1118, -911, -911, -606, -606, -289, -289, -15, -15,
+    186, 186, 321, 321, 403, 403, 437, 437, 437, 437, 437, 437,
+    446, 446, 434, 434, 415, 415, 474, 474, 657, 657, 889, 889,
+    1076, 1076, 1240, 1240, 1469, 1469, 1756, 1756, 1985, 1985, 2094, 2094,
+    2166, 2166, 2294, 2294, 2434, 2434, 2473, 2473, 2424, 2424, 2425, 2425,
+    2555, 2555, 2706, 2706, 2726, 2726, 2625, 2625, 2577, 2577, 2698, 2698,
+    2910, 2910, 3084, 3084, 3200, 3200, 3307, 3307, 3399, 3399, 3428, 3428,
+    3403, 3403, 3403, 3403, 3467, 3467, 3541, 3541, 3544, 3544, 3462, 3462,
+    3350, 3350, 3257, 3257, 3163, 3163, 3013, 3013, 2814, 2814, 2666, 2666,
+    2659, 2659, 2750, 2750, 2803, 2803, 2768, 2768, 2716, 2716, 2683, 2683,
+    2591, 2591, 2387, 2387, 2153, 2153, 1996, 1996, 1916, 1916, 1833, 1833,
+    1707, 1707, 1557, 1557, 1402, 1402, 1241, 1241, 1071, 1071, 891, 891,
+    707, 707, 567, 567, 533, 533, 583, 583, 608, 608, 548, 548,
+    453, 453, 369, 369, 263, 263, 110, 110, -45, -45, -176, -176,
+    -322, -322, -505, -505, -665, -665, -756, -756, -809, -809, -860, -860,
+    -880, -880, -852, -852, -830, -830, -870, -870, -944, -944, -997, -997,
+    -1028, -1028, -1045, -1045, -1033, -1033, -1024, -1024, -1102, -1102, -1278, -1278,
+    -1471, -1471, -1651, -1651, -1861, -1861, -2060, -2060, -2109, -2109, -1989, -1989,
+    -1868, -1868, -1873, -1873, -1932, -1932, -1970, -1970, -2099, -2099, -2398, -2398,
+    -2675, -2675, -2687, -2687, -2525, -2525, -2487, -2487, -2627, -2627, -2723, -2723,
+    -2701, -2701, -2776, -2776, -3075, -3075, -3381, -3381, -3419, -3419, -3249, -3249,
+    -3165, -3165, -3252, -3252, -3270, -3270, -3052, -3052, -2789, -2789, -2761, -2761,
+    -2893, -2893, -2819, -2819, -2416, -2416, -2026, -2026, -2006, -2006, -2211, -2211,
+    -2213, -2213, -1964, -1964, -1877, -1877, -2159, -2159, -2446, -2446, -2328, -2328,
+    -1959, -1959, -1802, -1802, -1922, -1922, -1925, -1925, -1566, -1566, -1074, -1074,
+    -758, -758, -577, -577, -321, -321, -15, -15, 112, 112, -8, -8,
+    -186, -186, -263, -263, -302, -302, -413, -413, -536, -536, -502, -502,
+    -284, -284, -50, -50, 76, 76, 214, 214, 566, 566, 1124, 1124,
+    1639, 1639, 1902, 1902, 1935, 1935, 1885, 1885, 1818, 1818, 1714, 1714,
+    1586, 1586, 1506, 1506, 1528, 1528, 1663, 1663, 1915, 1915, 2242, 2242,
+    2506, 2506, 2572, 2572, 2472, 2472, 2390, 2390, 2450, 2450, 2606, 2606,
+    2766, 2766, 2933, 2933, 3158, 3158, 3405, 3405, 3584, 3584, 3679, 3679,
+    3745, 3745, 3787, 3787, 3740, 3740, 3580, 3580, 3370, 3370, 3168, 3168,
+    2967, 2967, 2765, 2765, 2635, 2635, 2652, 2652, 2797, 2797, 2981, 2981,
+    3157, 3157, 3322, 3322, 3450, 3450, 3488, 3488, 3431, 3431, 3308, 3308,
+    3122, 3122, 2864, 2864, 2569, 2569, 2297, 2297, 2052, 2052, 1787, 1787,
+    1491, 1491, 1246, 1246, 1157, 1157, 1230, 1230, 1362, 1362, 1441, 1441,
+    1427, 1427, 1348, 1348, 1254, 1254, 1165, 1165, 1058, 1058, 918, 918,
+    766, 766, 612, 612, 437, 437, 259, 259, 135, 135, 68, 68,
+    -22, -22, -177, -177, -319, -319, -358, -358, -332, -332, -365, -365,
+    -508, -508, -695, -695, -850, -850, -939, -939, -930, -930, -815, -815,
+    -687, -687, -677, -677, -784, -784, -891, -891, -950, -950, -1030, -1030,
+    -1147, -1147, -1210, -1210, -1206, -1206, -1282, -1282, -1532, -1532, -1823, -1823,
+    -1978, -1978, -2045, -2045, -2197, -2197, -2397, -2397, -2408, -2408, -2170, -2170,
+    -1933, -1933, -1901, -1901, -1962, -1962, -1945, -1945, -1959, -1959, -2199, -2199,
+    -2554, -2554, -2706, -2706, -2653, -2653, -2790, -2790, -3341, -3341, -3980, -3980,
+    -4251, -4251, -4162, -4162, -4060, -4060, -4048, -4048, -3877, -3877, -3418, -3418,
+    -2915, -2915, -2643, -2643, -2549, -2549, -2420, -2420, -2260, -2260, -2256, -2256,
+    -2437, -2437, -2585, -2585, -2544, -2544, -2442, -2442, -2493, -2493, -2669, -2669,
+    -2731, -2731, -2546, -2546, -2241, -2241, -1986, -1986, -1772, -1772, -1510, -1510,
+    -1245, -1245, -1120, -1120, -1148, -1148, -1174, -1174, -1081, -1081, -909, -909,
+    -756, -756, -658, -658, -597, -597, -550, -550, -466, -466, -294, -294,
+    -66, -66, 121, 121, 237, 237, 334, 334, 416, 416, 427, 427,
+    396, 396, 448, 448, 624, 624, 821, 821, 990, 990, 1235, 1235,
+    1627, 1627, 2017, 2017, 2186, 2186, 2136, 2136, 2083, 2083, 2176, 2176,
+    2341, 2341, 2427, 2427, 2408, 2408, 2377, 2377, 2404, 2404, 2458, 2458,
+    2482, 2482, 2520, 2520, 2695, 2695, 3040, 3040, 3421, 3421, 3701, 3701,
+    3880, 3880, 4011, 4011, 4061, 4061, 3973, 3973, 3809, 3809, 3689, 3689,
+    3621, 3621, 3511, 3511, 3340, 3340, 3212, 3212, 3186, 3186, 3192, 3192,
+    3153, 3153, 3096, 3096, 3086, 3086, 3130, 3130, 3190, 3190, 3215, 3215,
+    3158, 3158, 3013, 3013, 2854, 2854, 2754, 2754, 2681, 2681, 2547, 2547,
+    2329, 2329, 2091, 2091, 1879, 1879, 1676, 1676, 1474, 1474, 1314, 1314,
+    1222, 1222, 1165, 1165, 1112, 1112, 1083, 1083, 1099, 1099, 1116, 1116,
+    1070, 1070, 941, 941, 773, 773, 630, 630, 527, 527, 405, 405,
+    212, 212, -20, -20, -216, -216, -364, -364, -506, -506, -643, -643,
+    -715, -715, -698, -698, -668, -668, -716, -716, -823, -823, -887, -887,
+    -870, -870, -860, -860, -945, -945, -1079, -1079, -1139, -1139, -1097, -1097,
+    -1073, -1073, -1164, -1164, -1289, -1289, -1319, -1319, -1326, -1326, -1521, -1521,
+    -1900, -1900, -2176, -2176, -2175, -2175, -2105, -2105, -2249, -2249, -2547, -2547,
+    -2676, -2676, -2514, -2514, -2285, -2285, -2248, -2248, -2375, -2375, -2443, -2443,
+    -2365, -2365, -2297, -2297, -2443, -2443, -2812, -2812, -3246, -3246, -3666, -3666,
+    -4162, -4162, -4738, -4738, -5100, -5100, -4959, -4959, -4475, -4475, -4079, -4079,
+    -3839, -3839, -3402, -3402, -2662, -2662, -2066, -2066, -1986, -1986, -2171, -2171,
+    -2178, -2178, -2056, -2056, -2175, -2175, -2543, -2543, -2778, -2778, -2745, -2745,
+    -2745, -2745, -2949, -2949, -3068, -3068, -2798, -2798, -2279, -2279, -1872, -1872,
+    -1663, -1663, -1451, -1451, -1132, -1132, -862, -862, -801, -801, -870, -870,
+    -852, -852, -687, -687, -540, -540, -529, -529, -529, -529, -345, -345,
+    -10, -10, 242, 242, 295, 295, 266, 266, 281, 281, 303, 303,
+    253, 253, 175, 175, 169, 169, 278, 278, 519, 519, 918, 918,
+    1427, 1427, 1902, 1902, 2250, 2250, 2512, 2512, 2723, 2723, 2811, 2811,
+    2756, 2756, 2683, 2683, 2673, 2673, 2604, 2604, 2368, 2368, 2113, 2113,
+    2071, 2071, 2227, 2227, 2389, 2389, 2541, 2541, 2874, 2874, 3433, 3433,
+    3948, 3948, 4170, 4170, 4184, 4184, 4227, 4227, 4304, 4304, 4225, 4225,
+    3967, 3967, 3729, 3729, 3623, 3623, 3531, 3531, 3360, 3360, 3221, 3221,
+    3222, 3222, 3260, 3260, 3182, 3182, 3058, 3058, 3061, 3061, 3139, 3139,
+    3060, 3060, 2804, 2804, 2629, 2629, 2658, 2658, 2687, 2687, 2549, 2549,
+    2380, 2380, 2360, 2360, 2388, 2388, 2259, 2259, 2000, 2000, 1810, 1810,
+    1726, 1726, 1577, 1577, 1281, 1281, 964, 964, 736, 736, 535, 535,
+    293, 293, 117, 117, 141, 141, 316, 316, 476, 476, 546, 546,
+    571, 571, 577, 577, 516, 516, 348, 348, 119, 119, -104, -104,
+    -335, -335, -626, -626, -931, -931, -1146, -1146, -1267, -1267, -1380, -1380,
+    -1475, -1475, -1433, -1433, -1240, -1240, -1059, -1059, -1014, -1014, -1035, -1035,
+    -1016, -1016, -1012, -1012, -1144, -1144, -1376, -1376, -1548, -1548, -1616, -1616,
+    -1692, -1692, -1835, -1835, -1984, -1984, -2121, -2121, -2304, -2304, -2501, -2501,
+    -2585, -2585, -2544, -2544, -2524, -2524, -2609, -2609, -2717, -2717, -2756, -2756,
+    -2747, -2747, -2745, -2745, -2772, -2772, -2919, -2919, -3348, -3348, -4040, -4040,
+    -4640, -4640, -4815, -4815, -4689, -4689, -4648, -4648, -4710, -4710, -4469, -4469,
+    -3760, -3760, -3010, -3010, -2695, -2695, -2733, -2733, -2727, -2727, -2592, -2592,
+    -2548, -2548, -2603, -2603, -2490, -2490, -2218, -2218, -2201, -2201, -2612, -2612,
+    -3007, -3007, -2957, -2957, -2709, -2709, -2736, -2736, -2911, -2911, -2685, -2685,
+    -1983, -1983, -1367, -1367, -1224, -1224, -1282, -1282, -1129, -1129, -843, -843,
+    -749, -749, -809, -809, -684, -684, -329, -329, -82, -82, -105, -105,
+    -141, -141, 25, 25, 206, 206, 149, 149, -22, -22, 23, 23,
+    308, 308, 514, 514, 481, 481, 446, 446, 670, 670, 1064, 1064,
+    1421, 1421, 1758, 1758, 2160, 2160, 2501, 2501, 2630, 2630, 2690, 2690,
+    2894, 2894, 3116, 3116, 3052, 3052, 2726, 2726, 2493, 2493, 2518, 2518,
+    2572, 2572, 2472, 2472, 2392, 2392, 2548, 2548, 2838, 2838, 3075, 3075,
+    3331, 3331, 3741, 3741, 4142, 4142, 4260, 4260, 4144, 4144, 4094, 4094,
+    4190, 4190, 4207, 4207, 3996, 3996, 3722, 3722, 3605, 3605, 3607, 3607,
+    3519, 3519, 3294, 3294, 3093, 3093, 3013, 3013, 2943, 2943, 2769, 2769,
+    2556, 2556, 2413, 2413, 2331, 2331, 2252, 2252, 2225, 2225, 2330, 2330,
+    2511, 2511, 2601, 2601, 2535, 2535, 2413, 2413, 2314, 2314, 2174, 2174,
+    1924, 1924, 1622, 1622, 1350, 1350, 1099, 1099, 842, 842, 606, 606,
+    391, 391, 149, 149, -77, -77, -154, -154, -56, -56, 96, 96,
+    215, 215, 315, 315, 374, 374, 314, 314, 148, 148, -18, -18,
+    -159, -159, -367, -367, -646, -646, -834, -834, -847, -847, -846, -846,
+    -999, -999, -1213, -1213, -1308, -1308, -1322, -1322, -1397, -1397, -1485, -1485,
+    -1439, -1439, -1325, -1325, -1365, -1365, -1584, -1584, -1743, -1743, -1673, -1673,
+    -1533, -1533, -1602, -1602, -1872, -1872, -2035, -2035, -1963, -1963, -1952, -1952,
+    -2244, -2244, -2576, -2576, -2566, -2566, -2373, -2373, -2495, -2495, -2944, -2944,
+    -3159, -3159, -2923, -2923, -2828, -2828, -3416, -3416, -4289, -4289, -4686, -4686,
+    -4645, -4645, -4793, -4793, -5147, -5147, -5036, -5036, -4288, -4288, -3595, -3595,
+    -3446, -3446, -3441, -3441, -3068, -3068, -2563, -2563, -2480, -2480, -2777, -2777,
+    -2898, -2898, -2637, -2637, -2389, -2389, -2484, -2484, -2756, -2756, -2945, -2945,
+    -3104, -3104, -3352, -3352, -3529, -3529, -3377, -3377, -2928, -2928, -2473, -2473,
+    -2195, -2195, -1977, -1977, -1654, -1654, -1316, -1316, -1181, -1181, -1205, -1205,
+    -1100, -1100, -788, -788, -498, -498, -375, -375, -277, -277, -101, -101,
+    9, 9, -65, -65, -170, -170, -103, -103, 56, 56, 82, 82,
+    1, 1, 67, 67, 348, 348, 625, 625, 771, 771, 948, 948,
+    1320, 1320, 1808, 1808, 2240, 2240, 2552, 2552, 2758, 2758, 2881, 2881,
+    2962, 2962, 3039, 3039, 3085, 3085, 3026, 3026, 2846, 2846, 2616, 2616,
+    2443, 2443, 2398, 2398, 2493, 2493, 2695, 2695, 2942, 2942, 3177, 3177,
+    3406, 3406, 3674, 3674, 3961, 3961, 4148, 4148, 4155, 4155, 4072, 4072,
+    4061, 4061, 4156, 4156, 4226, 4226, 4148, 4148, 3951, 3951, 3749, 3749,
+    3588, 3588, 3424, 3424, 3240, 3240, 3103, 3103, 3038, 3038, 2960, 2960,
+    2799, 2799, 2624, 2624, 2519, 2519, 2435, 2435, 2285, 2285, 2122, 2122,
+    2088, 2088, 2217, 2217, 2378, 2378, 2406, 2406, 2276, 2276, 2105, 2105,
+    2000, 2000, 1911, 1911, 1714, 1714, 1403, 1403, 1103, 1103, 885, 885,
+    679, 679, 406, 406, 119, 119, -59, -59, -113, -113, -127, -127,
+    -114, -114, 0, 0, 158, 158, 169, 169, -7, -7, -182, -182,
+    -243, -243, -307, -307, -482, -482, -681, -681, -791, -791, -840, -840,
+    -910, -910, -1006, -1006, -1083, -1083, -1158, -1158, -1282, -1282, -1419, -1419,
+    -1448, -1448, -1375, -1375, -1383, -1383, -1569, -1569, -1777, -1777, -1810, -1810,
+    -1718, -1718, -1711, -1711, -1864, -1864, -2033, -2033, -2089, -2089, -2130, -2130,
+    -2313, -2313, -2551, -2551, -2644, -2644, -2660, -2660, -2815, -2815, -2989, -2989,
+    -2874, -2874, -2646, -2646, -2928, -2928, -3842, -3842, -4678, -4678, -4849, -4849,
+    -4720, -4720, -4970, -4970, -5450, -5450, -5362, -5362, -4524, -4524, -3688, -3688,
+    -3403, -3403, -3318, -3318, -2976, -2976, -2625, -2625, -2697, -2697, -2965, -2965,
+    -2872, -2872, -2441, -2441, -2269, -2269, -2625, -2625, -3068, -3068, -3133, -3133,
+    -3016, -3016, -3198, -3198, -3605, -3605, -3650, -3650, -3101, -3101, -2437, -2437,
+    -2158, -2158, -2138, -2138, -1942, -1942, -1538, -1538, -1313, -1313, -1415, -1415,
+    -1476, -1476, -1158, -1158, -644, -644, -314, -314, -185, -185, -11, -11,
+    218, 218, 269, 269, 93, 93, -71, -71, -49, -49, 64, 64,
+    106, 106, 95, 95, 175, 175, 393, 393, 652, 652, 881, 881,
+    1135, 1135, 1498, 1498, 1933, 1933, 2316, 2316, 2583, 2583, 2785, 2785,
+    2998, 2998, 3206, 3206, 3315, 3315, 3262, 3262, 3076, 3076, 2846, 2846,
+    2678, 2678, 2651, 2651, 2750, 2750, 2864, 2864, 2929, 2929, 3039, 3039,
+    3303, 3303, 3640, 3640, 3845, 3845, 3868, 3868, 3859, 3859, 3934, 3934,
+    4053, 4053, 4151, 4151, 4222, 4222, 4242, 4242, 4149, 4149, 3946, 3946,
+    3740, 3740, 3620, 3620, 3538, 3538, 3374, 3374, 3112, 3112, 2867, 2867,
+    2721, 2721, 2604, 2604, 2397, 2397, 2112, 2112, 1899, 1899, 1877, 1877,
+    2004, 2004, 2128, 2128, 2178, 2178, 2213, 2213, 2257, 2257, 2221, 2221,
+    2065, 2065, 1898, 1898, 1794, 1794, 1659, 1659, 1402, 1402, 1089, 1089,
+    829, 829, 614, 614, 370, 370, 87, 87, -160, -160, -292, -292,
+    -299, -299, -233, -233, -158, -158, -119, -119, -117, -117, -115, -115,
+    -109, -109, -165, -165, -299, -299, -410, -410, -426, -426, -426, -426,
+    -506, -506, -646, -646, -786, -786, -917, -917, -1053, -1053, -1198, -1198,
+    -1370, -1370, -1541, -1541, -1631, -1631, -1632, -1632, -1659, -1659, -1756, -1756,
+    -1801, -1801, -1715, -1715, -1669, -1669, -1844, -1844, -2095, -2095, -2125, -2125,
+    -2000, -2000, -2092, -2092, -2430, -2430, -2593, -2593, -2419, -2419, -2306, -2306,
+    -2538, -2538, -2842, -2842, -2988, -2988, -3315, -3315, -4135, -4135, -5055, -5055,
+    -5454, -5454, -5394, -5394, -5414, -5414, -5542, -5542, -5209, -5209, -4248, -4248,
+    -3318, -3318, -3005, -3005, -3060, -3060, -2928, -2928, -2608, -2608, -2489, -2489,
+    -2616, -2616, -2641, -2641, -2435, -2435, -2320, -2320, -2589, -2589, -3087, -3087,
+    -3435, -3435, -3528, -3528, -3574, -3574, -3676, -3676, -3627, -3627, -3226, -3226,
+    -2622, -2622, -2153, -2153, -1940, -1940, -1817, -1817, -1651, -1651, -1505, -1505,
+    -1433, -1433, -1282, -1282, -900, -900, -406, -406, -75, -75, 25, 25,
+    67, 67, 172, 172, 255, 255, 201, 201, 42, 42, -81, -81,
+    -72, -72, 46, 46, 168, 168, 238, 238, 328, 328, 551, 551,
+    910, 910, 1305, 1305, 1703, 1703, 2170, 2170, 2692, 2692, 3110, 3110,
+    3329, 3329, 3446, 3446, 3566, 3566, 3590, 3590, 3370, 3370, 2992, 2992,
+    2719, 2719, 2661, 2661, 2702, 2702, 2761, 2761, 2909, 2909, 3181, 3181,
+    3453, 3453, 3609, 3609, 3690, 3690, 3790, 3790, 3904, 3904, 3974, 3974,
+    4016, 4016, 4102, 4102, 4246, 4246, 4371, 4371, 4386, 4386, 4270, 4270,
+    4067, 4067, 3837, 3837, 3643, 3643, 3518, 3518, 3433, 3433, 3312, 3312,
+    3105, 3105, 2835, 2835, 2566, 2566, 2329, 2329, 2097, 2097, 1851, 1851,
+    1672, 1672, 1694, 1694, 1928, 1928, 2193, 2193, 2306, 2306, 2272, 2272,
+    2215, 2215, 2166, 2166, 2045, 2045, 1823, 1823, 1585, 1585, 1387, 1387,
+    1156, 1156, 817, 817, 452, 452, 196, 196, 32, 32, -163, -163,
+    -381, -381, -461, -461, -338, -338, -156, -156, -65, -65, -36, -36,
+    20, 20, 68, 68, -7, -7, -195, -195, -350, -350, -395, -395,
+    -408, -408, -461, -461, -515, -515, -530, -530, -572, -572, -709, -709,
+    -900, -900, -1058, -1058, -1183, -1183, -1334, -1334, -1514, -1514, -1639, -1639,
+    -1645, -1645, -1573, -1573, -1535, -1535, -1596, -1596, -1717, -1717, -1814, -1814,
+    -1855, -1855, -1887, -1887, -1959, -1959, -2060, -2060, -2165, -2165, -2289, -2289,
+    -2417, -2417, -2431, -2431, -2293, -2293, -2272, -2272, -2753, -2753, -3710, -3710,
+    -4623, -4623, -5093, -5093, -5324, -5324, -5697, -5697, -6054, -6054, -5825, -5825,
+    -4886, -4886, -3832, -3832, -3229, -3229, -2958, -2958, -2630, -2630, -2302, -2302,
+    -2322, -2322, -2617, -2617, -2678, -2678, -2328, -2328, -2028, -2028, -2216, -2216,
+    -2699, -2699, -3029, -3029, -3177, -3177, -3450, -3450, -3842, -3842, -3935, -3935,
+    -3498, -3498, -2836, -2836, -2365, -2365, -2126, -2126, -1925, -1925, -1757, -1757,
+    -1790, -1790, -1986, -1986, -2026, -2026, -1683, -1683, -1089, -1089, -532, -532,
+    -111, -111, 258, 258, 576, 576, 701, 701, 555, 555, 277, 277,
+    68, 68, -17, -17, -57, -57, -92, -92, -69, -69, 57, 57,
+    235, 235, 394, 394, 552, 552, 819, 819, 1281, 1281, 1894, 1894,
+    2508, 2508, 2994, 2994, 3353, 3353, 3655, 3655, 3876, 3876, 3884, 3884,
+    3634, 3634, 3282, 3282, 3034, 3034, 2912, 2912, 2817, 2817, 2754, 2754,
+    2862, 2862, 3163, 3163, 3465, 3465, 3596, 3596, 3602, 3602, 3627, 3627,
+    3695, 3695, 3745, 3745, 3795, 3795, 3940, 3940, 4177, 4177, 4382, 4382,
+    4463, 4463, 4443, 4443, 4366, 4366, 4228, 4228, 4043, 4043, 3882, 3882,
+    3783, 3783, 3676, 3676, 3460, 3460, 3132, 3132, 2771, 2771, 2431, 2431,
+    2108, 2108, 1813, 1813, 1617, 1617, 1586, 1586, 1706, 1706, 1895, 1895,
+    2074, 2074, 2211, 2211, 2292, 2292, 2305, 2305, 2246, 2246, 2134, 2134,
+    1987, 1987, 1798, 1798, 1551, 1551, 1239, 1239, 883, 883, 517, 517,
+    189, 189, -52, -52, -184, -184, -235, -235, -250, -250, -250, -250,
+    -221, -221, -167, -167, -128, -128, -136, -136, -177, -177, -209, -209,
+    -215, -215, -216, -216, -233, -233, -258, -258, -271, -271, -282, -282,
+    -327, -327, -426, -426, -562, -562, -703, -703, -841, -841, -994, -994,
+    -1166, -1166, -1329, -1329, -1444, -1444, -1491, -1491, -1497, -1497, -1507, -1507,
+    -1553, -1553, -1616, -1616, -1653, -1653, -1642, -1642, -1625, -1625, -1663, -1663,
+    -1778, -1778, -1940, -1940, -2117, -2117, -2290, -2290, -2422, -2422, -2454, -2454,
+    -2403, -2403, -2455, -2455, -2851, -2851, -3617, -3617, -4471, -4471, -5096, -5096,
+    -5458, -5458, -5725, -5725, -5887, -5887, -5676, -5676, -4955, -4955, -4003, -4003,
+    -3244, -3244, -2809, -2809, -2565, -2565, -2470, -2470, -2588, -2588, -2777, -2777,
+    -2703, -2703, -2313, -2313, -2011, -2011, -2151, -2151, -2577, -2577, -2906, -2906,
+    -3099, -3099, -3420, -3420, -3891, -3891, -4130, -4130, -3834, -3834, -3168, -3168,
+    -2525, -2525, -2092, -2092, -1814, -1814, -1656, -1656, -1668, -1668, -1794, -1794,
+    -1812, -1812, -1549, -1549, -1085, -1085, -636, -636, -280, -280, 67, 67,
+    424, 424, 619, 619, 508, 508, 210, 210, -12, -12, -60, -60,
+    -57, -57, -90, -90, -70, -70, 89, 89, 302, 302, 446, 446,
+    571, 571, 845, 845, 1323, 1323, 1877, 1877, 2370, 2370, 2795, 2795,
+    3216, 3216, 3616, 3616, 3879, 3879, 3917, 3917, 3764, 3764, 3530, 3530,
+    3279, 3279, 3025, 3025, 2836, 2836, 2835, 2835, 3036, 3036, 3271, 3271,
+    3385, 3385, 3433, 3433, 3557, 3557, 3740, 3740, 3823, 3823, 3783, 3783,
+    3798, 3798, 3990, 3990, 4254, 4254, 4417, 4417, 4454, 4454, 4431, 4431,
+    4352, 4352, 4181, 4181, 3975, 3975, 3853, 3853, 3825, 3825, 3754, 3754,
+    3532, 3532, 3209, 3209, 2905, 2905, 2643, 2643, 2344, 2344, 1988, 1988,
+    1691, 1691, 1581, 1581, 1641, 1641, 1753, 1753, 1844, 1844, 1930, 1930,
+    2019, 2019, 2067, 2067, 2047, 2047, 1986, 1986, 1908, 1908, 1788, 1788,
+    1593, 1593, 1328, 1328, 1011, 1011, 658, 658, 306, 306, 10, 10,
+    -200, -200, -321, -321, -353, -353, -316, -316, -260, -260, -225, -225,
+    -187, -187, -128, -128, -103, -103, -165, -165, -259, -259, -281, -281,
+    -231, -231, -190, -190, -188, -188, -187, -187, -197, -197, -280, -280,
+    -428, -428, -556, -556, -640, -640, -753, -753, -919, -919, -1054, -1054,
+    -1092, -1092, -1100, -1100, -1179, -1179, -1316, -1316, -1410, -1410, -1426, -1426,
+    -1467, -1467, -1621, -1621, -1796, -1796, -1800, -1800, -1641, -1641, -1605, -1605,
+    -1888, -1888, -2260, -2260, -2338, -2338, -2136, -2136, -2040, -2040, -2242, -2242,
+    -2547, -2547, -2861, -2861, -3440, -3440, -4388, -4388, -5285, -5285, -5700, -5700,
+    -5782, -5782, -5882, -5882, -5833, -5833, -5159, -5159, -3949, -3949, -2938, -2938,
+    -2598, -2598, -2630, -2630, -2565, -2565, -2422, -2422, -2459, -2459, -2589, -2589,
+    -2493, -2493, -2181, -2181, -2053, -2053, -2348, -2348, -2856, -2856, -3263, -3263,
+    -3549, -3549, -3850, -3850, -4061, -4061, -3872, -3872, -3228, -3228, -2499, -2499,
+    -2074, -2074, -1947, -1947, -1884, -1884, -1839, -1839, -1919, -1919, -2023, -2023,
+    -1849, -1849, -1309, -1309, -676, -676, -202, -202, 146, 146, 456, 456,
+    610, 610, 475, 475, 172, 172, -70, -70, -194, -194, -276, -276,
+    -298, -298, -178, -178, 32, 32, 187, 187, 275, 275, 450, 450,
+    818, 818, 1318, 1318, 1838, 1838, 2344, 2344, 2844, 2844, 3301, 3301,
+    3635, 3635, 3787, 3787, 3764, 3764, 3612, 3612, 3383, 3383, 3121, 3121,
+    2899, 2899, 2813, 2813, 2897, 2897, 3073, 3073, 3233, 3233, 3355, 3355,
+    3475, 3475, 3594, 3594, 3660, 3660, 3658, 3658, 3651, 3651, 3718, 3718,
+    3880, 3880, 4089, 4089, 4268, 4268, 4370, 4370, 4410, 4410, 4405, 4405,
+    4321, 4321, 4137, 4137, 3942, 3942, 3847, 3847, 3800, 3800, 3624, 3624,
+    3262, 3262, 2853, 2853, 2514, 2514, 2198, 2198, 1854, 1854, 1578, 1578,
+    1488, 1488, 1562, 1562, 1701, 1701, 1859, 1859, 2008, 2008, 2077, 2077,
+    2027, 2027, 1915, 1915, 1808, 1808, 1697, 1697, 1576, 1576, 1478, 1478,
+    1371, 1371, 1148, 1148, 794, 794, 446, 446, 196, 196, -17, -17,
+    -246, -246, -403, -403, -407, -407, -331, -331, -286, -286, -266, -266,
+    -231, -231, -224, -224, -281, -281, -329, -329, -296, -296, -237, -237,
+    -217, -217, -191, -191, -109, -109, -49, -49, -105, -105, -222, -222,
+    -293, -293, -356, -356, -523, -523, -763, -763, -916, -916, -939, -939,
+    -967, -967, -1110, -1110, -1291, -1291, -1372, -1372, -1354, -1354, -1361, -1361,
+    -1449, -1449, -1526, -1526, -1500, -1500, -1438, -1438, -1472, -1472, -1607, -1607,
+    -1749, -1749, -1902, -1902, -2154, -2154, -2419, -2419, -2441, -2441, -2221, -2221,
+    -2190, -2190, -2709, -2709, -3558, -3558, -4243, -4243, -4695, -4695, -5238, -5238,
+    -5888, -5888, -6164, -6164, -5757, -5757, -4987, -4987, -4301, -4301, -3688, -3688,
+    -2962, -2962, -2343, -2343, -2257, -2257, -2628, -2628, -2853, -2853, -2605, -2605,
+    -2242, -2242, -2218, -2218, -2456, -2456, -2605, -2605, -2677, -2677, -3004, -3004,
+    -3613, -3613, -4065, -4065, -4018, -4018, -3648, -3648, -3300, -3300, -2996, -2996,
+    -2558, -2558, -2081, -2081, -1907, -1907, -2113, -2113, -2332, -2332, -2206, -2206,
+    -1805, -1805, -1408, -1408, -1067, -1067, -621, -621, -78, -78, 284, 284,
+    279, 279, 58, 58, -111, -111, -182, -182, -278, -278, -400, -400,
+    -377, -377, -150, -150, 87, 87, 135, 135, 61, 61, 112, 112,
+    408, 408, 863, 863, 1367, 1367, 1900, 1900, 2442, 2442, 2917, 2917,
+    3267, 3267, 3504, 3504, 3633, 3633, 3610, 3610, 3422, 3422, 3157, 3157,
+    2935, 2935, 2819, 2819, 2828, 2828, 2947, 2947, 3103, 3103, 3195, 3195,
+    3212, 3212, 3249, 3249, 3360, 3360, 3473, 3473, 3514, 3514, 3542, 3542,
+    3674, 3674, 3913, 3913, 4141, 4141, 4264, 4264, 4288, 4288, 4248, 4248,
+    4144, 4144, 3968, 3968, 3767, 3767, 3621, 3621, 3548, 3548, 3465, 3465,
+    3277, 3277, 3000, 3000, 2737, 2737, 2525, 2525, 2278, 2278, 1949, 1949,
+    1666, 1666, 1579, 1579, 1659, 1659, 1747, 1747, 1791, 1791, 1865, 1865,
+    1971, 1971, 1987, 1987, 1850, 1850, 1668, 1668, 1557, 1557, 1488, 1488,
+    1361, 1361, 1159, 1159, 942, 942, 746, 746, 546, 546, 319, 319,
+    83, 83, -104, -104, -186, -186, -169, -169, -125, -125, -110, -110,
+    -101, -101, -73, -73, -74, -74, -147, -147, -221, -221, -201, -201,
+    -123, -123, -95, -95, -112, -112, -64, -64, 49, 49, 78, 78,
+    -51, -51, -225, -225, -327, -327, -400, -400, -541, -541, -718, -718,
+    -837, -837, -894, -894, -976, -976, -1119, -1119, -1257, -1257, -1326, -1326,
+    -1334, -1334, -1343, -1343, -1396, -1396, -1477, -1477, -1523, -1523, -1499, -1499,
+    -1464, -1464, -1537, -1537, -1765, -1765, -2065, -2065, -2293, -2293, -2365, -2365,
+    -2330, -2330, -2352, -2352, -2612, -2612, -3169, -3169, -3902, -3902, -4608, -4608,
+    -5168, -5168, -5579, -5579, -5852, -5852, -5928, -5928, -5699, -5699, -5106, -5106,
+    -4235, -4235, -3353, -3353, -2771, -2771, -2601, -2601, -2653, -2653, -2669, -2669,
+    -2599, -2599, -2570, -2570, -2622, -2622, -2651, -2651, -2632, -2632, -2721, -2721,
+    -3028, -3028, -3433, -3433, -3737, -3737, -3895, -3895, -3974, -3974, -3929, -3929,
+    -3622, -3622, -3075, -3075, -2560, -2560, -2330, -2330, -2361, -2361, -2420, -2420,
+    -2354, -2354, -2205, -2205, -2040, -2040, -1798, -1798, -1372, -1372, -804, -804,
+    -278, -278, 73, 73, 274, 274, 366, 366, 294, 294, 32, 32,
+    -272, -272, -409, -409, -369, -369, -335, -335, -391, -391, -404, -404,
+    -231, -231, 79, 79, 415, 415, 804, 804, 1332, 1332, 1952, 1952,
+    2504, 2504, 2923, 2923, 3266, 3266, 3549, 3549, 3675, 3675, 3582, 3582,
+    3343, 3343, 3101, 3101, 2945, 2945, 2898, 2898, 2943, 2943, 3042, 3042,
+    3162, 3162, 3298, 3298, 3438, 3438, 3522, 3522, 3508, 3508, 3454, 3454,
+    3453, 3453, 3502, 3502, 3534, 3534, 3569, 3569, 3705, 3705, 3920, 3920,
+    4046, 4046, 3997, 3997, 3907, 3907, 3940, 3940, 4044, 4044, 4056, 4056,
+    3953, 3953, 3843, 3843, 3735, 3735, 3483, 3483, 3030, 3030, 2527, 2527,
+    2152, 2152, 1890, 1890, 1636, 1636, 1422, 1422, 1400, 1400, 1585, 1585,
+    1789, 1789, 1848, 1848, 1825, 1825, 1853, 1853, 1911, 1911, 1861, 1861,
+    1694, 1694, 1542, 1542, 1450, 1450, 1296, 1296, 1014, 1014, 731, 731,
+    577, 577, 478, 478, 299, 299, 88, 88, 6, 6, 60, 60,
+    82, 82, -20, -20, -164, -164, -257, -257, -325, -325, -408, -408,
+    -450, -450, -383, -383, -235, -235, -84, -84, 46, 46, 179, 179,
+    302, 302, 357, 357, 307, 307, 180, 180, 39, 39, -86, -86,
+    -234, -234, -444, -444, -676, -676, -844, -844, -951, -951, -1095, -1095,
+    -1296, -1296, -1418, -1418, -1367, -1367, -1265, -1265, -1283, -1283, -1377, -1377,
+    -1370, -1370, -1272, -1272, -1285, -1285, -1479, -1479, -1687, -1687, -1806, -1806,
+    -1973, -1973, -2297, -2297, -2579, -2579, -2558, -2558, -2324, -2324, -2260, -2260,
+    -2582, -2582, -3149, -3149, -3759, -3759, -4392, -4392, -5070, -5070, -5656, -5656,
+    -5969, -5969, -5984, -5984, -5762, -5762, -5273, -5273, -4486, -4486, -3603, -3603,
+    -2974, -2974, -2729, -2729, -2653, -2653, -2530, -2530, -2392, -2392, -2339, -2339,
+    -2309, -2309, -2231, -2231, -2264, -2264, -2619, -2619, -3201, -3201, -3689, -3689,
+    -3970, -3970, -4208, -4208, -4428, -4428, -4352, -4352, -3824, -3824, -3153, -3153,
+    -2763, -2763, -2674, -2674, -2603, -2603, -2453, -2453, -2387, -2387, -2415, -2415,
+    -2257, -2257, -1734, -1734, -1064, -1064, -572, -572, -281, -281, -15, -15,
+    224, 224, 229, 229, -56, -56, -389, -389, -521, -521, -483, -483,
+    -468, -468, -536, -536, -568, -568, -493, -493, -382, -382, -276, -276,
+    -62, -62, 403, 403, 1097, 1097, 1852, 1852, 2514, 2514, 3024, 3024,
+    3372, 3372, 3542, 3542, 3541, 3541, 3422, 3422, 3252, 3252, 3080, 3080,
+    2955, 2955, 2928, 2928, 3007, 3007, 3130, 3130, 3217, 3217, 3220, 3220,
+    3144, 3144, 3041, 3041, 2978, 2978, 2994, 2994, 3075, 3075, 3188, 3188,
+    3333, 3333, 3534, 3534, 3786, 3786, 4027, 4027, 4164, 4164, 4161, 4161,
+    4092, 4092, 4104, 4104, 4261, 4261, 4431, 4431, 4379, 4379, 4027, 4027,
+    3555, 3555, 3167, 3167, 2833, 2833, 2400, 2400, 1896, 1896, 1537, 1537,
+    1451, 1451, 1534, 1534, 1634, 1634, 1737, 1737, 1881, 1881, 2000, 2000,
+    2005, 2005, 1952, 1952, 1972, 1972, 2061, 2061, 2074, 2074, 1925, 1925,
+    1690, 1690, 1476, 1476, 1283, 1283, 1037, 1037, 718, 718, 413, 413,
+    227, 227, 174, 174, 172, 172, 143, 143, 80, 80, 13, 13,
+    -65, -65, -177, -177, -286, -286, -289, -289, -142, -142, 70, 70,
+    248, 248, 387, 387, 529, 529, 642, 642, 650, 650, 538, 538,
+    374, 374, 219, 219, 57, 57, -148, -148, -368, -368, -530, -530,
+    -626, -626, -742, -742, -941, -941, -1168, -1168, -1312, -1312, -1350, -1350,
+    -1357, -1357, -1367, -1367, -1303, -1303, -1135, -1135, -1014, -1014, -1091, -1091,
+    -1278, -1278, -1371, -1371, -1390, -1390, -1583, -1583, -2036, -2036, -2469, -2469,
+    -2567, -2567, -2399, -2399, -2312, -2312, -2494, -2494, -2854, -2854, -3332, -3332,
+    -4025, -4025, -4893, -4893, -5610, -5610, -5906, -5906, -5915, -5915, -5918, -5918,
+    -5822, -5822, -5226, -5226, -4087, -4087, -3015, -3015, -2621, -2621, -2767, -2767,
+    -2827, -2827, -2557, -2557, -2324, -2324, -2428, -2428, -2648, -2648, -2663, -2663,
+    -2619, -2619, -2905, -2905, -3510, -3510, -4007, -4007, -4165, -4165, -4218, -4218,
+    -4358, -4358, -4344, -4344, -3857, -3857, -3072, -3072, -2542, -2542, -2536, -2536,
+    -2760, -2760, -2794, -2794, -2601, -2601, -2410, -2410, -2259, -2259, -1927, -1927,
+    -1314, -1314, -645, -645, -192, -192, 21, 21, 122, 122, 120, 120,
+    -72, -72, -402, -402, -651, -651, -684, -684, -596, -596, -550, -550,
+    -583, -583, -610, -610, -528, -528, -266, -266, 173, 173, 709, 709,
+    1275, 1275, 1881, 1881, 2513, 2513, 3041, 3041, 3320, 3320, 3376, 3376,
+    3348, 3348, 3276, 3276, 3097, 3097, 2876, 2876, 2836, 2836, 3050, 3050,
+    3294, 3294, 3351, 3351, 3294, 3294, 3314, 3314, 3385, 3385, 3313, 3313,
+    3080, 3080, 2914, 2914, 2995, 2995, 3235, 3235, 3457, 3457, 3640, 3640,
+    3875, 3875, 4124, 4124, 4237, 4237, 4199, 4199, 4209, 4209, 4421, 4421,
+    4703, 4703, 4787, 4787, 4598, 4598, 4287, 4287, 3961, 3961, 3546, 3546,
+    2986, 2986, 2417, 2417, 1997, 1997, 1724, 1724, 1539, 1539, 1493, 1493,
+    1659, 1659, 1935, 1935, 2108, 2108, 2107, 2107, 2056, 2056, 2076, 2076,
+    2146, 2146, 2196, 2196, 2207, 2207, 2172, 2172, 2057, 2057, 1853, 1853,
+    1595, 1595, 1313, 1313, 1015, 1015, 733, 733, 519, 519, 384, 384,
+    293, 293, 206, 206, 104, 104, -23, -23, -166, -166, -282, -282,
+    -321, -321, -273, -273, -160, -160, 12, 12, 243, 243, 489, 489,
+    675, 675, 765, 765, 766, 766, 693, 693, 550, 550, 355, 355,
+    137, 137, -83, -83, -288, -288, -475, -475, -668, -668, -889, -889,
+    -1105, -1105, -1248, -1248, -1315, -1315, -1370, -1370, -1423, -1423, -1392, -1392,
+    -1249, -1249, -1100, -1100, -1061, -1061, -1100, -1100, -1132, -1132, -1182, -1182,
+    -1353, -1353, -1647, -1647, -1963, -1963, -2222, -2222, -2409, -2409, -2490, -2490,
+    -2441, -2441, -2385, -2385, -2581, -2581, -3170, -3170, -4001, -4001, -4777, -4777,
+    -5329, -5329, -5682, -5682, -5878, -5878, -5848, -5848, -5493, -5493, -4849, -4849,
+    -4097, -4097, -3422, -3422, -2928, -2928, -2671, -2671, -2666, -2666, -2785, -2785,
+    -2775, -2775, -2523, -2523, -2250, -2250, -2277, -2277, -2623, -2623, -3027, -3027,
+    -3348, -3348, -3705, -3705, -4142, -4142, -4429, -4429, -4375, -4375, -4096, -4096,
+    -3780, -3780, -3404, -3404, -2923, -2923, -2576, -2576, -2631, -2631, -2912, -2912,
+    -2938, -2938, -2551, -2551, -2041, -2041, -1633, -1633, -1208, -1208, -676, -676,
+    -260, -260, -164, -164, -244, -244, -272, -272, -312, -312, -530, -530,
+    -788, -788, -787, -787, -547, -547, -405, -405, -506, -506, -612, -612,
+    -498, -498, -233, -233, 65, 65, 481, 481, 1112, 1112, 1812, 1812,
+    2360, 2360, 2760, 2760, 3131, 3131, 3401, 3401, 3369, 3369, 3086, 3086,
+    2884, 2884, 2953, 2953, 3120, 3120, 3174, 3174, 3182, 3182, 3303, 3303,
+    3468, 3468, 3480, 3480, 3336, 3336, 3218, 3218, 3197, 3197, 3172, 3172,
+    3135, 3135, 3248, 3248, 3556, 3556, 3845, 3845, 3929, 3929, 3915, 3915,
+    4009, 4009, 4206, 4206, 4357, 4357, 4448, 4448, 4599, 4599, 4795, 4795,
+    4829, 4829, 4569, 4569, 4141, 4141, 3730, 3730, 3338, 3338, 2872, 2872,
+    2389, 2389, 2085, 2085, 2039, 2039, 2111, 2111, 2132, 2132, 2090, 2090,
+    2068, 2068, 2079, 2079, 2071, 2071, 2059, 2059, 2127, 2127, 2270, 2270,
+    2352, 2352, 2277, 2277, 2104, 2104, 1935, 1935, 1774, 1774, 1559, 1559,
+    1291, 1291, 1048, 1048, 882, 882, 772, 772, 672, 672, 567, 567,
+    438, 438, 255, 255, 27, 27, -164, -164, -231, -231, -148, -148,
+    29, 29, 217, 217, 381, 381, 533, 533, 674, 674, 751, 751,
+    735, 735, 676, 676, 628, 628, 566, 566, 437, 437, 258, 258,
+    89, 89, -89, -89, -369, -369, -741, -741, -1041, -1041, -1154, -1154,
+    -1174, -1174, -1249, -1249, -1348, -1348, -1330, -1330, -1200, -1200, -1128, -1128,
+    -1199, -1199, -1274, -1274, -1223, -1223, -1161, -1161, -1292, -1292, -1555, -1555,
+    -1689, -1689, -1682, -1682, -1841, -1841, -2270, -2270, -2572, -2572, -2413, -2413,
+    -2159, -2159, -2495, -2495, -3455, -3455, -4341, -4341, -4742, -4742, -5044, -5044,
+    -5626, -5626, -6106, -6106, -5921, -5921, -5237, -5237, -4640, -4640, -4199, -4199,
+    -3542, -3542, -2748, -2748, -2413, -2413, -2681, -2681, -2902, -2902, -2577, -2577,
+    -2088, -2088, -2050, -2050, -2393, -2393, -2642, -2642, -2771, -2771, -3161, -3161,
+    -3835, -3835, -4316, -4316, -4317, -4317, -4090, -4090, -3951, -3951, -3793, -3793,
+    -3363, -3363, -2813, -2813, -2582, -2582, -2773, -2773, -2970, -2970, -2795, -2795,
+    -2358, -2358, -1968, -1968, -1620, -1620, -1097, -1097, -466, -466, -112, -112,
+    -185, -185, -370, -370, -378, -378, -356, -356, -527, -527, -720, -720,
+    -625, -625, -356, -356, -309, -309, -536, -536, -678, -678, -525, -525,
+    -246, -246, 19, 19, 417, 417, 1069, 1069, 1789, 1789, 2335, 2335,
+    2700, 2700, 2981, 2981, 3146, 3146, 3136, 3136, 3051, 3051, 3039, 3039,
+    3108, 3108, 3202, 3202, 3337, 3337, 3514, 3514, 3601, 3601, 3489, 3489,
+    3288, 3288, 3179, 3179, 3144, 3144, 3048, 3048, 2937, 2937, 3022, 3022,
+    3350, 3350, 3700, 3700, 3871, 3871, 3897, 3897, 3922, 3922, 4002, 4002,
+    4110, 4110, 4254, 4254, 4448, 4448, 4630, 4630, 4712, 4712, 4691, 4691,
+    4596, 4596, 4363, 4363, 3907, 3907, 3323, 3323, 2835, 2835, 2557, 2557,
+    2412, 2412, 2309, 2309, 2264, 2264, 2295, 2295, 2317, 2317, 2238, 2238,
+    2102, 2102, 2038, 2038, 2084, 2084, 2170, 2170, 2260, 2260, 2380, 2380,
+    2487, 2487, 2466, 2466, 2272, 2272, 1991, 1991, 1721, 1721, 1484, 1484,
+    1270, 1270, 1097, 1097, 984, 984, 913, 913, 827, 827, 669, 669,
+    433, 433, 172, 172, -23, -23, -80, -80, 6, 6, 183, 183,
+    392, 392, 594, 594, 741, 741, 790, 790, 761, 761, 712, 712,
+    644, 644, 527, 527, 404, 404, 369, 369, 397, 397, 338, 338,
+    108, 108, -202, -202, -469, -469, -687, -687, -903, -903, -1085, -1085,
+    -1146, -1146, -1088, -1088, -1015, -1015, -1007, -1007, -1045, -1045, -1090, -1090,
+    -1135, -1135, -1192, -1192, -1283, -1283, -1429, -1429, -1592, -1592, -1688, -1688,
+    -1737, -1737, -1890, -1890, -2203, -2203, -2486, -2486, -2544, -2544, -2497, -2497,
+    -2687, -2687, -3267, -3267, -4015, -4015, -4600, -4600, -4921, -4921, -5124, -5124,
+    -5334, -5334, -5472, -5472, -5336, -5336, -4847, -4847, -4183, -4183, -3629, -3629,
+    -3289, -3289, -3044, -3044, -2826, -2826, -2746, -2746, -2828, -2828, -2846, -2846,
+    -2661, -2661, -2531, -2531, -2777, -2777, -3271, -3271, -3604, -3604, -3686, -3686,
+    -3800, -3800, -4060, -4060, -4184, -4184, -3948, -3948, -3543, -3543, -3282, -3282,
+    -3180, -3180, -3062, -3062, -2912, -2912, -2860, -2860, -2875, -2875, -2742, -2742,
+    -2356, -2356, -1861, -1861, -1449, -1449, -1152, -1152, -890, -890, -653, -653,
+    -549, -549, -642, -642, -804, -804, -844, -844, -757, -757, -705, -705,
+    -718, -718, -649, -649, -471, -471, -361, -361, -372, -372, -282, -282,
+    79, 79, 562, 562, 949, 949, 1286, 1286, 1724, 1724, 2179, 2179,
+    2434, 2434, 2497, 2497, 2567, 2567, 2680, 2680, 2710, 2710, 2706, 2706,
+    2861, 2861, 3149, 3149, 3329, 3329, 3339, 3339, 3351, 3351, 3445, 3445,
+    3500, 3500, 3457, 3457, 3418, 3418, 3457, 3457, 3522, 3522, 3582, 3582,
+    3698, 3698, 3873, 3873, 3983, 3983, 3968, 3968, 3958, 3958, 4085, 4085,
+    4283, 4283, 4406, 4406, 4430, 4430, 4419, 4419, 4390, 4390, 4311, 4311,
+    4155, 4155, 3913, 3913, 3606, 3606, 3309, 3309, 3092, 3092, 2957, 2957,
+    2872, 2872, 2807, 2807, 2743, 2743, 2681, 2681, 2647, 2647, 2654, 2654,
+    2654, 2654, 2588, 2588, 2485, 2485, 2435, 2435, 2438, 2438, 2387, 2387,
+    2234, 2234, 2072, 2072, 1983, 1983, 1907, 1907, 1763, 1763, 1602, 1602,
+    1518, 1518, 1478, 1478, 1371, 1371, 1178, 1178, 986, 986, 844, 844,
+    715, 715, 586, 586, 510, 510, 517, 517, 577, 577, 650, 650,
+    722, 722, 787, 787, 830, 830, 828, 828, 768, 768, 673, 673,
+    585, 585, 505, 505, 413, 413, 305, 305, 169, 169, -31, -31,
+    -270, -270, -443, -443, -498, -498, -523, -523, -619, -619, -752, -752,
+    -803, -803, -773, -773, -815, -815, -1004, -1004, -1198, -1198, -1258, -1258,
+    -1264, -1264, -1360, -1360, -1514, -1514, -1617, -1617, -1677, -1677, -1754, -1754,
+    -1842, -1842, -1958, -1958, -2168, -2168, -2439, -2439, -2602, -2602, -2617, -2617,
+    -2727, -2727, -3197, -3197, -3934, -3934, -4545, -4545, -4821, -4821, -4930, -4930,
+    -5059, -5059, -5102, -5102, -4881, -4881, -4452, -4452, -4013, -4013, -3644, -3644,
+    -3298, -3298, -3000, -3000, -2876, -2876, -2955, -2955, -3053, -3053, -2974, -2974,
+    -2808, -2808, -2848, -2848, -3176, -3176, -3529, -3529, -3664, -3664, -3671, -3671,
+    -3768, -3768, -3932, -3932, -3956, -3956, -3795, -3795, -3616, -3616, -3520, -3520,
+    -3425, -3425, -3297, -3297, -3270, -3270, -3380, -3380, -3401, -3401, -3126, -3126,
+    -2662, -2662, -2260, -2260, -1951, -1951, -1599, -1599, -1213, -1213, -977, -977,
+    -959, -959, -1013, -1013, -1023, -1023, -1029, -1029, -1087, -1087, -1138, -1138,
+    -1115, -1115, -1049, -1049, -1001, -1001, -955, -955, -835, -835, -604, -604,
+    -294, -294, 70, 70, 487, 487, 925, 925, 1317, 1317, 1620, 1620,
+    1819, 1819, 1904, 1904, 1934, 1934, 2028, 2028, 2240, 2240, 2496, 2496,
+    2724, 2724, 2932, 2932, 3127, 3127, 3266, 3266, 3328, 3328, 3347, 3347,
+    3365, 3365, 3364, 3364, 3312, 3312, 3246, 3246, 3249, 3249, 3314, 3314,
+    3344, 3344, 3341, 3341, 3413, 3413, 3577, 3577, 3721, 3721, 3816, 3816,
+    3965, 3965, 4211, 4211, 4451, 4451, 4550, 4550, 4467, 4467, 4267, 4267,
+    4043, 4043, 3831, 3831, 3613, 3613, 3375, 3375, 3154, 3154, 3012, 3012,
+    2976, 2976, 2991, 2991, 2958, 2958, 2858, 2858, 2774, 2774, 2729, 2729,
+    2645, 2645, 2501, 2501, 2403, 2403, 2403, 2403, 2407, 2407, 2310, 2310,
+    2157, 2157, 2066, 2066, 2067, 2067, 2072, 2072, 2011, 2011, 1921, 1921,
+    1868, 1868, 1828, 1828, 1719, 1719, 1529, 1529, 1306, 1306, 1076, 1076,
+    839, 839, 639, 639, 556, 556, 603, 603, 703, 703, 783, 783,
+    845, 845, 919, 919, 985, 985, 994, 994, 933, 933, 832, 832,
+    717, 717, 586, 586, 439, 439, 299, 299, 191, 191, 104, 104,
+    5, 5, -128, -128, -283, -283, -421, -421, -504, -504, -539, -539,
+    -561, -561, -587, -587, -642, -642, -788, -788, -1013, -1013, -1173, -1173,
+    -1190, -1190, -1199, -1199, -1318, -1318, -1433, -1433, -1403, -1403, -1353, -1353,
+    -1479, -1479, -1697, -1697, -1779, -1779, -1800, -1800, -2062, -2062, -2532, -2532,
+    -2779, -2779, -2681, -2681, -2753, -2753, -3392, -3392, -4198, -4198, -4543, -4543,
+    -4484, -4484, -4543, -4543, -4808, -4808, -4846, -4846, -4438, -4438, -3904, -3904,
+    -3611, -3611, -3514, -3514, -3348, -3348, -3079, -3079, -2923, -2923, -2991, -2991,
+    -3138, -3138, -3174, -3174, -3099, -3099, -3075, -3075, -3223, -3223, -3475, -3475,
+    -3655, -3655, -3712, -3712, -3775, -3775, -3899, -3899, -3942, -3942, -3826, -3826,
+    -3696, -3696, -3676, -3676, -3665, -3665, -3553, -3553, -3434, -3434, -3426, -3426,
+    -3425, -3425, -3242, -3242, -2889, -2889, -2541, -2541, -2253, -2253, -1934, -1934,
+    -1577, -1577, -1328, -1328, -1257, -1257, -1275, -1275, -1303, -1303, -1354, -1354,
+    -1395, -1395, -1335, -1335, -1231, -1231, -1255, -1255, -1382, -1382, -1342, -1342,
+    -1029, -1029, -684, -684, -510, -510, -328, -328, 107, 107, 660, 660,
+    1002, 1002, 1127, 1127, 1323, 1323, 1645, 1645, 1816, 1816, 1752, 1752,
+    1784, 1784, 2135, 2135, 2543, 2543, 2694, 2694, 2720, 2720, 2908, 2908,
+    3185, 3185, 3257, 3257, 3108, 3108, 3006, 3006, 3073, 3073, 3160, 3160,
+    3116, 3116, 3000, 3000, 2971, 2971, 3100, 3100, 3306, 3306, 3443, 3443,
+    3458, 3458, 3482, 3482, 3702, 3702, 4078, 4078, 4329, 4329, 4303, 4303,
+    4196, 4196, 4203, 4203, 4183, 4183, 3920, 3920, 3538, 3538, 3329, 3329,
+    3328, 3328, 3334, 3334, 3237, 3237, 3086, 3086, 2950, 2950, 2870, 2870,
+    2857, 2857, 2824, 2824, 2638, 2638, 2344, 2344, 2191, 2191, 2305, 2305,
+    2453, 2453, 2354, 2354, 2102, 2102, 2028, 2028, 2197, 2197, 2335, 2335,
+    2259, 2259, 2084, 2084, 1977, 1977, 1953, 1953, 1919, 1919, 1768, 1768,
+    1460, 1460, 1114, 1114, 905, 905, 849, 849, 814, 814, 759, 759,
+    787, 787, 915, 915, 997, 997, 951, 951, 898, 898, 944, 944,
+    978, 978, 860, 860, 672, 672, 570, 570, 513, 513, 383, 383,
+    244, 244, 207, 207, 175, 175, -7, -7, -230, -230, -260, -260,
+    -155, -155, -213, -213, -495, -495, -701, -701, -646, -646, -559, -559,
+    -723, -723, -1057, -1057, -1254, -1254, -1208, -1208, -1085, -1085, -1054, -1054,
+    -1128, -1128, -1261, -1261, -1397, -1397, -1445, -1445, -1415, -1415, -1551, -1551,
+    -2033, -2033, -2553, -2553, -2628, -2628, -2369, -2369, -2416, -2416, -2977, -2977,
+    -3504, -3504, -3569, -3569, -3524, -3524, -3871, -3871, -4389, -4389, -4476, -4476,
+    -4143, -4143, -3951, -3951, -4029, -4029, -3926, -3926, -3509, -3509, -3209, -3209,
+    -3207, -3207, -3164, -3164, -2948, -2948, -2884, -2884, -3074, -3074, -3169, -3169,
+    -3022, -3022, -2989, -2989, -3298, -3298, -3627, -3627, -3658, -3658, -3618, -3618,
+    -3806, -3806, -4002, -4002, -3880, -3880, -3658, -3658, -3712, -3712, -3882, -3882,
+    -3791, -3791, -3548, -3548, -3496, -3496, -3563, -3563, -3431, -3431, -3112, -3112,
+    -2845, -2845, -2617, -2617, -2257, -2257, -1880, -1880, -1768, -1768, -1836, -1836,
+    -1711, -1711, -1388, -1388, -1295, -1295, -1552, -1552, -1721, -1721, -1510, -1510,
+    -1246, -1246, -1327, -1327, -1581, -1581, -1549, -1549, -1162, -1162, -778, -778,
+    -620, -620, -499, -499, -170, -170, 290, 290, 633, 633, 796, 796,
+    934, 934, 1142, 1142, 1339, 1339, 1481, 1481, 1703, 1703, 2099, 2099,
+    2477, 2477, 2575, 2575, 2490, 2490, 2577, 2577, 2893, 2893, 3058, 3058,
+    2828, 2828, 2521, 2521, 2599, 2599, 2958, 2958, 3053, 3053, 2747, 2747,
+    2566, 2566, 2872, 2872, 3273, 3273, 3294, 3294, 3174, 3174, 3429, 3429,
+    3935, 3935, 4100, 4100, 3856, 3856, 3768, 3768, 4045, 4045, 4143, 4143,
+    3704, 3704, 3248, 3248, 3332, 3332, 3580, 3580, 3339, 3339, 2839, 2839,
+    2798, 2798, 3155, 3155, 3169, 3169, 2685, 2685, 2377, 2377, 2618, 2618,
+    2891, 2891, 2638, 2638, 2119, 2119, 1987, 1987, 2325, 2325, 2600, 2600,
+    2456, 2456, 2132, 2132, 2041, 2041, 2250, 2250, 2472, 2472, 2416, 2416,
+    2109, 2109, 1837, 1837, 1764, 1764, 1737, 1737, 1589, 1589, 1407, 1407,
+    1297, 1297, 1186, 1186, 1078, 1078, 1148, 1148, 1360, 1360, 1386, 1386,
+    1132, 1132, 955, 955, 1087, 1087, 1220, 1220, 993, 993, 604, 604,
+    523, 523, 744, 744, 789, 789, 446, 446, 89, 89, 121, 121,
+    446, 446, 620, 620, 356, 356, -144, -144, -333, -333, -2, -2,
+    262, 262, -186, -186, -979, -979, -1154, -1154, -634, -634, -381, -381,
+    -875, -875, -1393, -1393, -1218, -1218, -722, -722, -648, -648, -968, -968,
+    -1170, -1170, -1191, -1191, -1286, -1286, -1395, -1395, -1404, -1404, -1628, -1628,
+    -2227, -2227, -2609, -2609, -2276, -2276, -1825, -1825, -2110, -2110, -2822, -2822,
+    -2972, -2972, -2551, -2551, -2566, -2566, -3367, -3367, -4063, -4063, -3938, -3938,
+    -3520, -3520, -3623, -3623, -4042, -4042, -3994, -3994, -3449, -3449, -3178, -3178,
+    -3505, -3505, -3794, -3794, -3427, -3427, -2756, -2756, -2601, -2601, -3055, -3055,
+    -3368, -3368, -3082, -3082, -2685, -2685, -2851, -2851, -3436, -3436, -3746, -3746,
+    -3568, -3568, -3364, -3364, -3459, -3459, -3628, -3628, -3599, -3599, -3498, -3498,
+    -3541, -3541, -3652, -3652, -3625, -3625, -3458, -3458, -3322, -3322, -3299, -3299,
+    -3281, -3281, -3105, -3105, -2742, -2742, -2356, -2356, -2137, -2137, -2088, -2088,
+    -2029, -2029, -1847, -1847, -1623, -1623, -1476, -1476, -1398, -1398, -1356, -1356,
+    -1396, -1396, -1504, -1504, -1534, -1534, -1439, -1439, -1346, -1346, -1298, -1298,
+    -1145, -1145, -832, -832, -519, -519, -294, -294, -37, -37, 295, 295,
+    520, 520, 587, 587, 760, 760, 1182, 1182, 1541, 1541, 1557, 1557,
+    1509, 1509, 1839, 1839, 2399, 2399, 2616, 2616, 2350, 2350, 2118, 2118,
+    2355, 2355, 2800, 2800, 2887, 2887, 2575, 2575, 2396, 2396, 2651, 2651,
+    2968, 2968, 2902, 2902, 2617, 2617, 2626, 2626, 3010, 3010, 3329, 3329,
+    3357, 3357, 3413, 3413, 3746, 3746, 4024, 4024, 3881, 3881, 3565, 3565,
+    3513, 3513, 3633, 3633, 3554, 3554, 3291, 3291, 3139, 3139, 3140, 3140,
+    3095, 3095, 2970, 2970, 2912, 2912, 2936, 2936, 2884, 2884, 2713, 2713,
+    2571, 2571, 2544, 2544, 2568, 2568, 2586, 2586, 2561, 2561, 2413, 2413,
+    2218, 2218, 2229, 2229, 2424, 2424, 2427, 2427, 2146, 2146, 1997, 1997,
+    2178, 2178, 2289, 2289, 2051, 2051, 1798, 1798, 1843, 1843, 1868, 1868,
+    1513, 1513, 1128, 1128, 1214, 1214, 1496, 1496, 1375, 1375, 1035, 1035,
+    1108, 1108, 1446, 1446, 1335, 1335, 843, 843, 778, 778, 1258, 1258,
+    1445, 1445, 938, 938, 422, 422, 518, 518, 830, 830, 710, 710,
+    306, 306, 165, 165, 292, 292, 309, 309, 187, 187, 151, 151,
+    110, 110, -176, -176, -551, -551, -653, -653, -511, -511, -480, -480,
+    -651, -651, -757, -757, -699, -699, -720, -720, -934, -934, -1059, -1059,
+    -893, -893, -727, -727, -942, -942, -1369, -1369, -1475, -1475, -1172, -1172,
+    -1012, -1012, -1381, -1381, -1906, -1906, -2014, -2014, -1819, -1819, -1888, -1888,
+    -2270, -2270, -2411, -2411, -2113, -2113, -1934, -1934, -2315, -2315, -2875, -2875,
+    -3027, -3027, -2856, -2856, -2847, -2847, -3084, -3084, -3270, -3270, -3284, -3284,
+    -3202, -3202, -3016, -3016, -2795, -2795, -2811, -2811, -3079, -3079, -3120, -3120,
+    -2678, -2678, -2279, -2279, -2497, -2497, -2993, -2993, -3019, -3019, -2645, -2645,
+    -2589, -2589, -2938, -2938, -3072, -3072, -2860, -2860, -2859, -2859, -3208, -3208,
+    -3358, -3358, -3099, -3099, -2908, -2908, -3048, -3048, -3139, -3139, -2935, -2935,
+    -2792, -2792, -2977, -2977, -3115, -3115, -2832, -2832, -2428, -2428, -2350, -2350,
+    -2448, -2448, -2351, -2351, -2142, -2142, -2072, -2072, -2036, -2036, -1839, -1839,
+    -1587, -1587, -1461, -1461, -1468, -1468, -1552, -1552, -1633, -1633, -1530, -1530,
+    -1190, -1190, -929, -929, -1058, -1058, -1314, -1314, -1109, -1109, -462, -462,
+    -102, -102, -351, -351, -526, -526, -14, -14, 728, 728, 924, 924,
+    650, 650, 555, 555, 880, 880, 1343, 1343, 1656, 1656, 1738, 1738,
+    1663, 1663, 1645, 1645, 1885, 1885, 2266, 2266, 2409, 2409, 2194, 2194,
+    2021, 2021, 2254, 2254, 2613, 2613, 2597, 2597, 2312, 2312, 2291, 2291,
+    2612, 2612, 2831, 2831, 2757, 2757, 2695, 2695, 2888, 2888, 3156, 3156,
+    3217, 3217, 3109, 3109, 3072, 3072, 3148, 3148, 3127, 3127, 2949, 2949,
+    2863, 2863, 2999, 2999, 3084, 3084, 2853, 2853, 2520, 2520, 2508, 2508,
+    2800, 2800, 2913, 2913, 2599, 2599, 2235, 2235, 2288, 2288, 2627, 2627,
+    2750, 2750, 2536, 2536, 2350, 2350, 2422, 2422, 2522, 2522, 2362, 2362,
+    2054, 2054, 1960, 1960, 2176, 2176, 2357, 2357, 2174, 2174, 1810, 1810,
+    1731, 1731, 1995, 1995, 2144, 2144, 1899, 1899, 1583, 1583, 1587, 1587,
+    1734, 1734, 1625, 1625, 1378, 1378, 1427, 1427, 1674, 1674, 1551, 1551,
+    989, 989, 637, 637, 899, 899, 1349, 1349, 1358, 1358, 897, 897,
+    455, 455, 392, 392, 592, 592, 677, 677, 470, 470, 176, 176,
+    94, 94, 219, 219, 254, 254, 51, 51, -140, -140, -67, -67,
+    105, 105, 76, 76, -149, -149, -448, -448, -805, -805, -977, -977,
+    -610, -610, -76, -76, -247, -247, -1001, -1001, -1135, -1135, -366, -366,
+    -44, -44, -940, -940, -1723, -1723, -1036, -1036, 46, 46, -438, -438,
+    -1974, -1974, -2162, -2162, -669, -669, 81, 81, -1173, -1173, -2525, -2525,
+    -2063, -2063, -748, -748, -590, -590, -1640, -1640, -2393, -2393, -2145, -2145,
+    -1573, -1573, -1430, -1430, -1737, -1737, -2165, -2165, -2442, -2442, -2339, -2339,
+    -1884, -1884, -1601, -1601, -1930, -1930, -2458, -2458, -2402, -2402, -1764, -1764,
+    -1327, -1327, -1577, -1577, -2156, -2156, -2362, -2362, -1931, -1931, -1371, -1371,
+    -1438, -1438, -2133, -2133, -2588, -2588, -2269, -2269, -1768, -1768, -1885, -1885,
+    -2414, -2414, -2547, -2547, -2159, -2159, -1932, -1932, -2216, -2216, -2493, -2493,
+    -2260, -2260, -1812, -1812, -1725, -1725, -1953, -1953, -2010, -2010, -1792, -1792,
+    -1656, -1656, -1733, -1733, -1737, -1737, -1524, -1524, -1388, -1388, -1564, -1564,
+    -1762, -1762, -1540, -1540, -1042, -1042, -923, -923, -1362, -1362, -1640, -1640,
+    -1203, -1203, -624, -624, -712, -712, -1156, -1156, -1094, -1094, -569, -569,
+    -297, -297, -384, -384, -385, -385, -257, -257, -256, -256, -207, -207,
+    225, 225, 726, 726, 692, 692, 326, 326, 440, 440, 1044, 1044,
+    1237, 1237, 813, 813, 675, 675, 1177, 1177, 1510, 1510, 1292, 1292,
+    1192, 1192, 1478, 1478, 1536, 1536, 1221, 1221, 1184, 1184, 1587, 1587,
+    1798, 1798, 1582, 1582, 1467, 1467, 1746, 1746, 2029, 2029, 2036, 2036,
+    2035, 2035, 2157, 2157, 2079, 2079, 1829, 1829, 1959, 1959, 2401, 2401,
+    2369, 2369, 1910, 1910, 2013, 2013, 2660, 2660, 2629, 2629, 1801, 1801,
+    1617, 1617, 2525, 2525, 3024, 3024, 2191, 2191, 1309, 1309, 1799, 1799,
+    2927, 2927, 2986, 2986, 1942, 1942, 1351, 1351, 1911, 1911, 2618, 2618,
+    2513, 2513, 1950, 1950, 1718, 1718, 1902, 1902, 2080, 2080, 2004, 2004,
+    1781, 1781, 1684, 1684, 1798, 1798, 1832, 1832, 1530, 1530, 1158, 1158,
+    1141, 1141, 1420, 1420, 1638, 1638, 1639, 1639, 1374, 1374, 833, 833,
+    407, 407, 648, 648, 1286, 1286, 1328, 1328, 568, 568, 91, 91,
+    609, 609, 1181, 1181, 661, 661, -289, -289, -133, -133, 939, 939,
+    1150, 1150, 34, 34, -739, -739, -69, -69, 875, 875, 626, 626,
+    -412, -412, -832, -832, -290, -290, 279, 279, 87, 87, -556, -556,
+    -746, -746, -205, -205, 325, 325, 71, 71, -695, -695, -1027, -1027,
+    -609, -609, -115, -115, -177, -177, -528, -528, -585, -585, -454, -454,
+    -607, -607, -900, -900, -824, -824, -540, -540, -605, -605, -877, -877,
+    -798, -798, -534, -534, -716, -716, -1211, -1211, -1275, -1275, -848, -848,
+    -699, -699, -1202, -1202, -1702, -1702, -1460, -1460, -761, -761, -579, -579,
+    -1208, -1208, -1802, -1802, -1556, -1556, -848, -848, -677, -677, -1215, -1215,
+    -1572, -1572, -1145, -1145, -593, -593, -851, -851, -1561, -1561, -1552, -1552,
+    -825, -825, -644, -644, -1342, -1342, -1689, -1689, -1067, -1067, -592, -592,
+    -1139, -1139, -1827, -1827, -1566, -1566, -865, -865, -864, -864, -1431, -1431,
+    -1514, -1514, -972, -972, -738, -738, -1152, -1152, -1379, -1379, -878, -878,
+    -328, -328, -511, -511, -1127, -1127, -1328, -1328, -861, -861, -293, -293,
+    -337, -337, -995, -995, -1432, -1432, -1039, -1039, -383, -383, -400, -400,
+    -949, -949, -1100, -1100, -660, -660, -358, -358, -545, -545, -729, -729,
+    -553, -553, -366, -366, -441, -441, -436, -436, -167, -167, -112, -112,
+    -467, -467, -528, -528, 101, 101, 597, 597, 221, 221, -381, -381,
+    -247, -247, 344, 344, 487, 487, 132, 132, -38, -38, 209, 209,
+    467, 467, 470, 470, 382, 382, 383, 383, 473, 473, 634, 634,
+    797, 797, 777, 777, 603, 603, 679, 679, 1130, 1130, 1379, 1379,
+    976, 976, 453, 453, 577, 577, 1146, 1146, 1341, 1341, 1013, 1013,
+    770, 770, 943, 943, 1178, 1178, 1129, 1129, 968, 968, 1017, 1017,
+    1221, 1221, 1254, 1254, 1043, 1043, 898, 898, 1052, 1052, 1328, 1328,
+    1422, 1422, 1324, 1324, 1263, 1263, 1333, 1333, 1388, 1388, 1330, 1330,
+    1295, 1295, 1354, 1354, 1292, 1292, 1007, 1007, 865, 865, 1156, 1156,
+    1498, 1498, 1382, 1382, 986, 986, 802, 802, 858, 858, 917, 917,
+    1019, 1019, 1178, 1178, 1047, 1047, 552, 552, 343, 343, 848, 848,
+    1331, 1331, 889, 889, 61, 61, 149, 149, 1043, 1043, 1284, 1284,
+    486, 486, -26, -26, 473, 473, 974, 974, 619, 619, 69, 69,
+    112, 112, 359, 359, 233, 233, 48, 48, 225, 225, 374, 374,
+    72, 72, -222, -222, 42, 42, 409, 409, 181, 181, -280, -280,
+    -167, -167, 327, 327, 398, 398, 40, 40, -115, -115, 43, 43,
+    131, 131, 43, 43, -84, -84, -204, -204, -211, -211, -12, -12,
+    70, 70, -338, -338, -814, -814, -553, -553, 218, 218, 282, 282,
+    -670, -670, -1262, -1262, -472, -472, 595, 595, 327, 327, -839, -839,
+    -1185, -1185, -428, -428, 151, 151, -107, -107, -579, -579, -679, -679,
+    -524, -524, -422, -422, -516, -516, -739, -739, -793, -793, -487, -487,
+    -183, -183, -393, -393, -909, -909, -944, -944, -339, -339, 36, 36,
+    -403, -403, -930, -930, -672, -672, -90, -90, -114, -114, -535, -535,
+    -613, -613, -486, -486, -598, -598, -650, -650, -363, -363, -269, -269,
+    -658, -658, -826, -826, -328, -328, 59, 59, -397, -397, -1030, -1030,
+    -787, -787, -4, -4, 93, 93, -554, -554, -771, -771, -218, -218,
+    110, 110, -267, -267, -620, -620, -485, -485, -290, -290, -302, -302,
+    -284, -284, -214, -214, -286, -286, -389, -389, -334, -334, -256, -256,
+    -290, -290, -256, -256, -35, -35, 86, 86, -150, -150, -435, -435,
+    -291, -291, 104, 104, 134, 134, -198, -198, -270, -270, 36, 36,
+    176, 176, -62, -62, -314, -314, -325, -325, -106, -106, 266, 266,
+    449, 449, 51, 51, -547, -547, -439, -439, 367, 367, 762, 762,
+    224, 224, -325, -325, 14, 14, 689, 689, 624, 624, -31, -31,
+    -188, -188, 386, 386, 776, 776, 475, 475, 37, 37, -3, -3,
+    177, 177, 278, 278, 307, 307, 297, 297, 254, 254, 294, 294,
+    398, 398, 342, 342, 163, 163, 198, 198, 446, 446, 493, 493,
+    250, 250, 140, 140, 341, 341, 489, 489, 362, 362, 262, 262,
+    384, 384, 392, 392, 98, 98, -9, -9, 392, 392, 678, 678,
+    216, 216, -426, -426, -281, -281, 416, 416, 624, 624, 169, 169,
+    -125, -125, 158, 158, 487, 487, 345, 345, -22, -22, -49, -49,
+    312, 312, 532, 532, 279, 279, -83, -83, -32, -32, 349, 349,
+    542, 542, 328, 328, -16, -16, -150, -150, -22, -22, 194, 194,
+    327, 327, 314, 314, 162, 162, -9, -9, 8, 8, 179, 179,
+    165, 165, -66, -66, 0, 0, 502, 502, 725, 725, 244, 244,
+    -237, -237, 14, 14, 560, 560, 550, 550, 57, 57, -157, -157,
+    144, 144, 430, 430, 291, 291, -26, -26, -88, -88, 124, 124,
+    324, 324, 303, 303, 55, 55, -175, -175, -54, -54, 291, 291,
+    277, 277, -146, -146, -204, -204, 362, 362, 662, 662, 142, 142,
+    -383, -383, -107, -107, 440, 440, 409, 409, 53, 53, 74, 74,
+    310, 310, 178, 178, -113, -113, 28, 28, 326, 326, 106, 106,
+    -300, -300, -96, -96, 344, 344, 76, 76, -492, -492, -198, -198,
+    617, 617, 561, 561, -272, -272, -384, -384, 441, 441, 701, 701,
+    -171, -171, -761, -761, -87, -87, 740, 740, 431, 431, -383, -383,
+    -416, -416, 113, 113, 153, 153, -252, -252, -316, -316, -65, -65,
+    -74, -74, -244, -244, -109, -109, 147, 147, 75, 75, -119, -119,
+    5, 5, 211, 211, 26, 26, -269, -269, -62, -62, 397, 397,
+    297, 297, -288, -288, -429, -429, 55, 55, 256, 256, -218, -218,
+    -523, -523, -55, -55, 460, 460, 146, 146, -567, -567, -604, -604,
+    87, 87, 503, 503, 119, 119, -432, -432, -396, -396, 86, 86,
+    387, 387, 267, 267, -49, -49, -294, -294, -289, -289, 8, 8,
+    317, 317, 205, 205, -298, -298, -568, -568, -212, -212, 289, 289,
+    212, 212, -341, -341, -553, -553, -96, -96, 389, 389, 218, 218,
+    -369, -369, -575, -575, -144, -144, 323, 323, 199, 199, -350, -350,
+    -594, -594, -208, -208, 294, 294, 235, 235, -304, -304, -612, -612,
+    -339, -339, 36, 36, -40, -40, -378, -378, -388, -388, -19, -19,
+    175, 175, -113, -113, -513, -513, -546, -546, -279, -279, -113, -113,
+    -165, -165, -199, -199, -97, -97, -51, -51, -175, -175, -267, -267,
+    -142, -142, 16, 16, -83, -83, -314, -314, -242, -242, 170, 170,
+    348, 348, -95, -95, -640, -640, -485, -485, 248, 248, 553, 553,
+    -37, -37, -725, -725, -557, -557, 204, 204, 507, 507, 49, 49,
+    -387, -387, -207, -207, 174, 174, 143, 143, -147, -147, -164, -164,
+    85, 85, 156, 156, -43, -43, -159, -159, -36, -36, 76, 76,
+    21, 21, -15, -15, 98, 98, 175, 175, 54, 54, -100, -100,
+    -34, -34, 212, 212, 352, 352, 203, 203, -73, -73, -113, -113,
+    183, 183, 432, 432, 244, 244, -166, -166, -219, -219, 172, 172,
+    440, 440, 250, 250, 13, 13, 142, 142, 329, 329, 156, 156,
+    -64, -64, 139, 139, 419, 419, 188, 188, -196, -196, 49, 49,
+    645, 645, 559, 559, -205, -205, -446, -446, 290, 290, 874, 874,
+    375, 375, -411, -411, -251, -251, 529, 529, 672, 672, 63, 63,
+    -250, -250, 119, 119, 431, 431, 227, 227, -39, -39, 44, 44,
+    210, 210, 141, 141, 47, 47, 207, 207, 400, 400, 270, 270,
+    -20, -20, -31, -31, 229, 229, 349, 349, 169, 169, -64, -64,
+    -106, -106, 79, 79, 321, 321, 338, 338, 60, 60, -161, -161,
+    -24, -24, 226, 226, 194, 194, -14, -14, -11, -11, 198, 198,
+    235, 235, 11, 11, -92, -92, 130, 130, 311, 311, 118, 118,
+    -151, -151, -85, -85, 138, 138, 138, 138, -13, -13, -58, -58,
+    -24, -24, 1, 1, 69, 69, 114, 114, -30, -30, -229, -229,
+    -169, -169, 89, 89, 133, 133, -155, -155, -381, -381, -233, -233,
+    34, 34, 27, 27, -175, -175, -272, -272, -277, -277, -305, -305,
+    -222, -222, -49, -49, -153, -153, -532, -532, -602, -602, -182, -182,
+    79, 79, -250, -250, -665, -665, -577, -577, -235, -235, -202, -202,
+    -408, -408, -363, -363, -106, -106, -161, -161, -547, -547, -648, -648,
+    -265, -265, 23, 23, -170, -170, -472, -472, -457, -457, -273, -273,
+    -265, -265, -421, -421, -456, -456, -273, -273, -135, -135, -306, -306,
+    -608, -608, -601, -601, -241, -241, 5, 5, -174, -174, -491, -491,
+    -494, -494, -199, -199, -25, -25, -157, -157, -324, -324, -300, -300,
+    -235, -235, -267, -267, -234, -234, -73, -73, -62, -62, -305, -305,
+    -443, -443, -233, -233, -1, -1, -122, -122, -402, -402, -395, -395,
+    -114, -114, 12, 12, -147, -147, -241, -241, -66, -66, 104, 104,
+    30, 30, -87, -87, -2, -2, 147, 147, 132, 132, 38, 38,
+    71, 71, 169, 169, 117, 117, -47, -47, -67, -67, 100, 100,
+    193, 193, 85, 85, -8, -8, 87, 87, 212, 212, 180, 180,
+    104, 104, 168, 168, 294, 294, 300, 300, 224, 224, 249, 249,
+    360, 360, 343, 343, 159, 159, 70, 70, 222, 222, 378, 378,
+    281, 281, 77, 77, 72, 72, 239, 239, 266, 266, 70, 70,
+    -45, -45, 144, 144, 382, 382, 287, 287, -18, -18, -26, -26,
+    348, 348, 567, 567, 276, 276, -130, -130, -88, -88, 311, 311,
+    496, 496, 262, 262, 13, 13, 98, 98, 313, 313, 283, 283,
+    54, 54, -25, -25, 150, 150, 335, 335, 304, 304, 105, 105,
+    -39, -39, 42, 42, 281, 281, 405, 405, 261, 261, 41, 41,
+    34, 34, 232, 232, 361, 361, 267, 267, 96, 96, 64, 64,
+    169, 169, 245, 245, 219, 219, 170, 170, 147, 147, 110, 110,
+    67, 67, 78, 78, 125, 125, 110, 110, 17, 17, -35, -35,
+    40, 40, 142, 142, 97, 97, -69, -69, -99, -99, 102, 102,
+    226, 226, 7, 7, -282, -282, -185, -185, 175, 175, 227, 227,
+    -162, -162, -445, -445, -241, -241, 100, 100, 87, 87, -168, -168,
+    -241, -241, -130, -130, -155, -155, -303, -303, -275, -275, -116, -116,
+    -173, -173, -430, -430, -472, -472, -213, -213, -72, -72, -266, -266,
+    -461, -461, -370, -370, -219, -219, -299, -299, -435, -435, -311, -311,
+    -62, -62, -77, -77, -345, -345, -477, -477, -346, -346, -241, -241,
+    -324, -324, -390, -390, -300, -300, -241, -241, -348, -348, -431, -431,
+    -329, -329, -224, -224, -306, -306, -416, -416, -317, -317, -123, -123,
+    -121, -121, -298, -298, -392, -392, -316, -316, -238, -238, -248, -248,
+    -256, -256, -230, -230, -251, -251, -284, -284, -213, -213, -117, -117,
+    -180, -180, -323, -323, -305, -305, -150, -150, -107, -107, -193, -193,
+    -186, -186, -44, -44, 38, 38, -9, -9, -47, -47, -13, -13,
+    -3, -3, -41, -41, -12, -12, 91, 91, 93, 93, -53, -53,
+    -122, -122, 26, 26, 187, 187, 138, 138, -14, -14, -25, -25,
+    142, 142, 319, 319, 330, 330, 162, 162, 34, 34, 156, 156,
+    361, 361, 295, 295, 12, 12, -39, -39, 260, 260, 476, 476,
+    298, 298, 20, 20, 70, 70, 346, 346, 411, 411, 200, 200,
+    81, 81, 217, 217, 356, 356, 320, 320, 241, 241, 228, 228,
+    233, 233, 251, 251, 295, 295, 281, 281, 198, 198, 194, 194,
+    291, 291, 313, 313, 214, 214, 161, 161, 223, 223, 284, 284,
+    291, 291, 310, 310, 310, 310, 177, 177, 0, 0, 51, 51,
+    321, 321, 421, 421, 199, 199, 42, 42, 192, 192, 302, 302,
+    121, 121, 12, 12, 243, 243, 424, 424, 231, 231, 33, 33,
+    204, 204, 415, 415, 250, 250, -7, -7, 135, 135, 451, 451,
+    340, 340, -101, -101, -167, -167, 262, 262, 483, 483, 155, 155,
+    -160, -160, 23, 23, 358, 358, 344, 344, 90, 90, -10, -10,
+    96, 96, 188, 188, 178, 178, 150, 150, 128, 128, 52, 52,
+    -44, -44, -24, -24, 119, 119, 202, 202, 115, 115, -34, -34,
+    -90, -90, -27, -27, 74, 74, 117, 117, 55, 55, -64, -64,
+    -148, -148, -152, -152, -81, -81, 30, 30, 77, 77, -38, -38,
+    -216, -216, -233, -233, -63, -63, 50, 50, -69, -69, -257, -257,
+    -222, -222, 18, 18, 126, 126, -81, -81, -357, -357, -371, -371,
+    -159, -159, -34, -34, -143, -143, -298, -298, -250, -250, -39, -39,
+    33, 33, -191, -191, -433, -433, -320, -320, 66, 66, 222, 222,
+    -103, -103, -521, -521, -500, -500, -94, -94, 133, 133, -84, -84,
+    -353, -353, -250, -250, 49, 49, 90, 90, -161, -161, -329, -329,
+    -218, -218, -35, -35, -10, -10, -93, -93, -134, -134, -132, -132,
+    -150, -150, -139, -139, -60, -60, -31, -31, -131, -131, -211, -211,
+    -112, -112, 50, 50, 46, 46, -109, -109, -178, -178, -49, -49,
+    118, 118, 134, 134, 43, 43, 30, 30, 116, 116, 138, 138,
+    43, 43, -12, -12, 59, 59, 89, 89, -43, -43, -147, -147,
+    4, 4, 235, 235, 178, 178, -90, -90, -78, -78, 292, 292,
+    451, 451, 130, 130, -89, -89, 265, 265, 649, 649, 373, 373,
+    -167, -167, -89, -89, 474, 474, 576, 576, 76, 76, -133, -133,
+    323, 323, 643, 643, 253, 253, -186, -186, 83, 83, 604, 604,
+    504, 504, -40, -40, -150, -150, 296, 296, 571, 571, 329, 329,
+    48, 48, 148, 148, 397, 397, 398, 398, 201, 201, 129, 129,
+    264, 264, 376, 376, 286, 286, 103, 103, 54, 54, 179, 179,
+    280, 280, 189, 189, 34, 34, 82, 82, 314, 314, 384, 384,
+    143, 143, -82, -82, 34, 34, 311, 311, 347, 347, 129, 129,
+    20, 20, 186, 186, 367, 367, 287, 287, 61, 61, 1, 1,
+    148, 148, 246, 246, 149, 149, 10, 10, -8, -8, 42, 42,
+    47, 47, 38, 38, 78, 78, 94, 94, 14, 14, -52, -52,
+    38, 38, 192, 192, 185, 185, 12, 12, -97, -97, -25, -25,
+    88, 88, 104, 104, 61, 61, 30, 30, -5, -5, -43, -43,
+    -27, -27, 13, 13, -38, -38, -162, -162, -167, -167, 6, 6,
+    139, 139, 35, 35, -180, -180, -223, -223, -51, -51, 84, 84,
+    -6, -6, -173, -173, -145, -145, 59, 59, 137, 137, -55, -55,
+    -271, -271, -221, -221, 23, 23, 139, 139, 3, 3, -185, -185,
+    -203, -203, -62, -62, 78, 78, 76, 76, -111, -111, -338, -338,
+    -312, -312, 18, 18, 230, 230, -30, -30, -412, -412, -302, -302,
+    169, 169, 247, 247, -241, -241, -541, -541, -151, -151, 361, 361,
+    235, 235, -306, -306, -467, -467, -117, -117, 165, 165, 83, 83,
+    -94, -94, -166, -166, -208, -208, -174, -174, 50, 50, 233, 233,
+    45, 45, -291, -291, -235, -235, 148, 148, 215, 215, -160, -160,
+    -310, -310, 89, 89, 401, 401, 101, 101, -311, -311, -161, -161,
+    260, 260, 232, 232, -171, -171, -267, -267, 64, 64, 247, 247,
+    27, 27, -170, -170, -26, -26, 194, 194, 183, 183, 48, 48,
+    -11, -11, 13, 13, 89, 89, 188, 188, 143, 143, -90, -90,
+    -164, -164, 174, 174, 512, 512, 298, 298, -207, -207, -228, -228,
+    273, 273, 495, 495, 121, 121, -159, -159, 131, 131, 437, 437,
+    208, 208, -134, -134, -9, -9, 301, 301, 258, 258, 25, 25,
+    58, 58, 243, 243, 193, 193, 17, 17, 92, 92, 311, 311,
+    271, 271, 59, 59, 111, 111, 353, 353, 309, 309, 24, 24,
+    28, 28, 341, 341, 394, 394, 50, 50, -142, -142, 119, 119,
+    409, 409, 283, 283, -45, -45, -76, -76, 226, 226, 416, 416,
+    245, 245, -30, -30, -55, -55, 164, 164, 331, 331, 230, 230,
+    -9, -9, -57, -57, 145, 145, 248, 248, 33, 33, -180, -180,
+    -31, -31, 269, 269, 271, 271, 1, 1, -124, -124, 30, 30,
+    154, 154, 29, 29, -128, -128, -60, -60, 105, 105, 114, 114,
+    19, 19, 8, 8, 50, 50, 25, 25, -9, -9, 36, 36,
+    73, 73, 13, 13, -48, -48, 2, 2, 62, 62, -31, -31,
+    -214, -214, -248, -248, -88, -88, 28, 28, -51, -51, -188, -188,
+    -213, -213, -150, -150, -83, -83, -35, -35, -40, -40, -126, -126,
+    -190, -190, -107, -107, 42, 42, 47, 47, -123, -123, -253, -253,
+    -199, -199, -103, -103, -146, -146, -249, -249, -232, -232, -131, -131,
+    -96, -96, -118, -118, -89, -89, -40, -40, -69, -69, -130, -130,
+    -93, -93, 22, 22, 52, 52, -74, -74, -223, -223, -237, -237,
+    -132, -132, -47, -47, -59, -59, -123, -123, -172, -172, -183, -183,
+    -153, -153, -85, -85, -20, -20, -32, -32, -128, -128, -192, -192,
+    -105, -105, 61, 61, 106, 106, -17, -17, -123, -123, -73, -73,
+    40, 40, 77, 77, 58, 58, 51, 51, 26, 26, -38, -38,
+    -44, -44, 47, 47, 103, 103, 43, 43, -13, -13, 35, 35,
+    79, 79, 12, 12, -44, -44, 40, 40, 149, 149, 103, 103,
+    -23, -23, -28, -28, 72, 72, 115, 115, 97, 97, 122, 122,
+    140, 140, 43, 43, -59, -59, 20, 20, 213, 213, 281, 281,
+    172, 172, 45, 45, 17, 17, 78, 78, 177, 177, 254, 254,
+    219, 219, 83, 83, 23, 23, 155, 155, 314, 314, 257, 257,
+    44, 44, -38, -38, 99, 99, 260, 260, 280, 280, 191, 191,
+    88, 88, 27, 27, 38, 38, 114, 114, 194, 194, 210, 210,
+    154, 154, 73, 73, 35, 35, 79, 79, 161, 161, 176, 176,
+    87, 87, 16, 16, 94, 94, 239, 239, 249, 249, 122, 122,
+    60, 60, 131, 131, 182, 182, 132, 132, 88, 88, 122, 122,
+    153, 153, 124, 124, 96, 96, 123, 123, 150, 150, 117, 117,
+    58, 58, 21, 21, -8, -8, -33, -33, -10, -10, 46, 46,
+    38, 38, -42, -42, -90, -90, -65, -65, -23, -23, 11, 11,
+    41, 41, 29, 29, -29, -29, -43, -43, 27, 27, 70, 70,
+    -13, -13, -129, -129, -107, -107, 31, 31, 69, 69, -82, -82,
+    -232, -232, -187, -187, -39, -39, -15, -15, -144, -144, -232, -232,
+    -131, -131, 59, 59, 91, 91, -93, -93, -248, -248, -172, -172,
+    -21, -21, -57, -57, -213, -213, -227, -227, -87, -87, -34, -34,
+    -155, -155, -268, -268, -235, -235, -142, -142, -104, -104, -99, -99,
+    -98, -98, -154, -154, -249, -249, -245, -245, -118, -118, -33, -33,
+    -86, -86, -163, -163, -168, -168, -168, -168, -216, -216, -240, -240,
+    -198, -198, -156, -156, -145, -145, -118, -118, -86, -86, -114, -114,
+    -160, -160, -104, -104, 16, 16, 25, 25, -121, -121, -249, -249,
+    -212, -212, -78, -78, 4, 4, -4, -4, -39, -39, -53, -53,
+    -54, -54, -53, -53, -45, -45, -26, -26, -3, -3, 0, 0,
+    -57, -57, -162, -162, -208, -208, -134, -134, -31, -31, -7, -7,
+    -24, -24, -9, -9, 18, 18, 19, 19, 16, 16, 17, 17,
+    -18, -18, -80, -80, -98, -98, -34, -34, 79, 79, 165, 165,
+    150, 150, 25, 25, -107, -107, -102, -102, 61, 61, 209, 209,
+    156, 156, -35, -35, -97, -97, 58, 58, 209, 209, 174, 174,
+    61, 61, 52, 52, 145, 145, 222, 222, 211, 211, 113, 113,
+    -4, -4, -45, -45, 6, 6, 67, 67, 75, 75, 47, 47,
+    22, 22, 19, 19, 62, 62, 151, 151, 218, 218, 184, 184,
+    67, 67, -14, -14, 30, 30, 135, 135, 175, 175, 140, 140,
+    109, 109, 110, 110, 113, 113, 112, 112, 104, 104, 67, 67,
+    44, 44, 109, 109, 201, 201, 189, 189, 96, 96, 74, 74,
+    138, 138, 151, 151, 60, 60, -26, -26, -1, -1, 112, 112,
+    194, 194, 136, 136, -51, -51, -208, -208, -158, -158, 72, 72,
+    232, 232, 147, 147, -42, -42, -80, -80, 27, 27, 67, 67,
+    3, 3, -14, -14, 32, 32, 0, 0, -98, -98, -103, -103,
+    -34, -34, -71, -71, -202, -202, -201, -201, -6, -6, 139, 139,
+    37, 37, -163, -163, -174, -174, 1, 1, 64, 64, -130, -130,
+    -328, -328, -241, -241, -2, -2, 23, 23, -209, -209, -353, -353,
+    -214, -214, -30, -30, -59, -59, -196, -196, -205, -205, -125, -125,
+    -140, -140, -218, -218, -196, -196, -141, -141, -208, -208, -269, -269,
+    -134, -134, 5, 5, -133, -133, -330, -330, -196, -196, 93, 93,
+    43, 43, -301, -301, -426, -426, -212, -212, -69, -69, -218, -218,
+    -378, -378, -293, -293, -123, -123, -112, -112, -205, -205, -243, -243,
+    -246, -246, -244, -244, -152, -152, -36, -36, -114, -114, -307, -307,
+    -283, -283, -66, -66, -25, -25, -202, -202, -250, -250, -61, -61,
+    84, 84, 13, 13, -122, -122, -147, -147, -101, -101, -98, -98,
+    -134, -134, -133, -133, -108, -108, -115, -115, -109, -109, -40, -40,
+    17, 17, -20, -20, -92, -92, -125, -125, -113, -113, -54, -54,
+    -2, -2, -60, -60, -148, -148, -41, -41, 173, 173, 120, 120,
+    -203, -203, -337, -337, -97, -97, 133, 133, 65, 65, -79, -79,
+    -36, -36, 52, 52, -15, -15, -87, -87, 49, 49, 220, 220,
+    152, 152, -16, -16, 22, 22, 173, 173, 150, 150, 24, 24,
+    46, 46, 121, 121, 36, 36, -48, -48, 96, 96, 255, 255,
+    123, 123, -114, -114, -90, -90, 115, 115, 156, 156, 19, 19,
+    -11, -11, 137, 137, 213, 213, 78, 78, -58, -58, 29, 29,
+    221, 221, 264, 264, 169, 169, 129, 129, 160, 160, 123, 123,
+    18, 18, -14, -14, 96, 96, 232, 232, 214, 214, 25, 25,
+    -113, -113, -49, -49, 63, 63, 93, 93, 163, 163, 264, 264,
+    143, 143, -138, -138, -134, -134, 206, 206, 374, 374, 148, 148,
+    -61, -61, 49, 49, 197, 197, 64, 64, -147, -147, -104, -104,
+    38, 38, -53, -53, -203, -203, -64, -64, 132, 132, -9, -9,
+    -197, -197, -6, -6, 201, 201, -47, -47, -321, -321, -76, -76,
+    272, 272, 98, 98, -277, -277, -200, -200, 126, 126, 64, 64,
+    -266, -266, -222, -222, 121, 121, 49, 49, -439, -439, -522, -522,
+    -30, -30, 228, 228, -67, -67, -278, -278, -118, -118, -72, -72,
+    -271, -271, -233, -233, 75, 75, 119, 119, -164, -164, -262, -262,
+    -88, -88, -108, -108, -391, -391, -412, -412, -47, -47, 78, 78,
+    -333, -333, -640, -640, -328, -328, 91, 91, -9, -9, -325, -325,
+    -273, -273, -22, -22, -72, -72, -357, -357, -448, -448, -262, -262,
+    -72, -72, -72, -72, -206, -206, -287, -287, -202, -202, -52, -52,
+    -33, -33, -149, -149, -192, -192, -78, -78, 9, 9, -85, -85,
+    -214, -214, -180, -180, -104, -104, -223, -223, -410, -410, -333, -333,
+    -39, -39, 102, 102, -9, -9, -140, -140, -190, -190, -233, -233,
+    -236, -236, -159, -159, -123, -123, -164, -164, -99, -99, 68, 68,
+    23, 23, -292, -292, -415, -415, -74, -74, 284, 284, 133, 133,
+    -283, -283, -341, -341, -54, -54, 17, 17, -240, -240, -334, -334,
+    -73, -73, 149, 149, 65, 65, -118, -118, -189, -189, -187, -187,
+    -134, -134, -6, -6, 58, 58, -79, -79, -250, -250, -191, -191,
+    3, 3, 20, 20, -135, -135, -145, -145, 33, 33, 58, 58,
+    -175, -175, -297, -297, -89, -89, 131, 131, 42, 42, -177, -177,
+    -202, -202, -80, -80, -64, -64, -159, -159, -134, -134, 60, 60,
+    170, 170, 17, 17, -209, -209, -223, -223, -73, -73, -34, -34,
+    -160, -160, -206, -206, -56, -56, 51, 51, -122, -122, -371, -371,
+    -305, -305, 24, 24, 139, 139, -119, -119, -319, -319, -124, -124,
+    183, 183, 162, 162, -123, -123, -250, -250, -84, -84, 86, 86,
+    35, 35, -122, -122, -198, -198, -207, -207, -213, -213, -169, -169,
+    -70, -70, -34, -34, -88, -88, -77, -77, 58, 58, 134, 134,
+    -1, -1, -217, -217, -280, -280, -185, -185, -115, -115, -108, -108,
+    -45, -45, 32, 32, -77, -77, -316, -316, -336, -336, -52, -52,
+    144, 144, -39, -39, -320, -320, -291, -291, -45, -45, -4, -4,
+    -235, -235, -381, -381, -264, -264, -112, -112, -102, -102, -90, -90,
+    8, 8, -3, -3, -224, -224, -408, -408, -331, -331, -129, -129,
+    -38, -38, -61, -61, -90, -90, -154, -154, -290, -290, -348, -348,
+    -189, -189, 3, 3, -72, -72, -365, -365, -524, -524, -401, -401,
+    -211, -211, -153, -153, -162, -162, -140, -140, -166, -166, -325, -325,
+    -474, -474, -389, -389, -97, -97, 105, 105, 11, 11, -270, -270,
+    -472, -472, -465, -465, -318, -318, -172, -172, -127, -127, -193, -193,
+    -294, -294, -340, -340, -335, -335, -338, -338, -330, -330, -222, -222,
+    -78, -78, -117, -117, -352, -352, -447, -447, -170, -170, 189, 189,
+    186, 186, -120, -120, -285, -285, -188, -188, -154, -154, -343, -343,
+    -482, -482, -381, -381, -262, -262, -328, -328, -394, -394, -262, -262,
+    -106, -106, -157, -157, -302, -302, -300, -300, -181, -181, -115, -115,
+    -100, -100, -45, -45, -12, -12, -91, -91, -194, -194, -208, -208,
+    -209, -209, -269, -269, -264, -264, -131, -131, -73, -73, -222, -222,
+    -346, -346, -223, -223, -29, -29, -36, -36, -153, -153, -139, -139,
+    -68, -68, -165, -165, -332, -332, -267, -267, -1, -1, 105, 105,
+    -61, -61, -200, -200, -96, -96, 82, 82, 102, 102, -17, -17,
+    -123, -123, -138, -138, -74, -74, -4, -4, -47, -47, -214, -214,
+    -300, -300, -123, -123, 163, 163, 191, 191, -124, -124, -418, -418,
+    -322, -322, 51, 51, 259, 259, 104, 104, -163, -163, -209, -209,
+    -21, -21, 153, 153, 160, 160, 74, 74, 1, 1, -77, -77,
+    -168, -168, -155, -155, 9, 9, 122, 122, 3, 3, -195, -195,
+    -196, -196, -22, -22, 80, 80, 41, 41, 18, 18, 77, 77,
+    111, 111, 73, 73, 57, 57, 88, 88, 72, 72, -6, -6,
+    -43, -43, -20, -20, -41, -41, -91, -91, -36, -36, 84, 84,
+    52, 52, -132, -132, -198, -198, -64, -64, 0, 0, -170, -170,
+    -324, -324, -186, -186, 112, 112, 216, 216, 46, 46, -145, -145,
+    -154, -154, -44, -44, 34, 34, 43, 43, 21, 21, -20, -20,
+    -88, -88, -160, -160, -205, -205, -197, -197, -135, -135, -62, -62,
+    -28, -28, -41, -41, -89, -89, -167, -167, -223, -223, -167, -167,
+    -44, -44, -37, -37, -189, -189, -278, -278, -137, -137, 63, 63,
+    35, 35, -196, -196, -326, -326, -201, -201, -6, -6, 34, 34,
+    -77, -77, -201, -201, -255, -255, -211, -211, -98, -98, -47, -47,
+    -160, -160, -297, -297, -229, -229, 3, 3, 116, 116, -4, -4,
+    -175, -175, -215, -215, -166, -166, -154, -154, -203, -203, -259, -259,
+    -281, -281, -233, -233, -102, -102, 24, 24, 12, 12, -114, -114,
+    -170, -170, -97, -97, -67, -67, -191, -191, -307, -307, -234, -234,
+    -64, -64, -23, -23, -153, -153, -274, -274, -230, -230, -63, -63,
+    52, 52, 12, 12, -106, -106, -167, -167, -141, -141, -100, -100,
+    -89, -89, -98, -98, -129, -129, -186, -186, -215, -215, -150, -150,
+    -25, -25, 28, 28, -42, -42, -119, -119, -106, -106, -81, -81,
+    -143, -143, -223, -223, -207, -207, -125, -125, -68, -68, -34, -34,
+    1, 1, -11, -11, -72, -72, -85, -85, -19, -19, 19, 19,
+    -26, -26, -57, -57, -5, -5, 24, 24, -84, -84, -235, -235,
+    -237, -237, -80, -80, 64, 64, 92, 92, 47, 47, -10, -10,
+    -55, -55, -47, -47, 7, 7, 19, 19, -49, -49, -97, -97,
+    -51, -51, 12, 12, 14, 14, -2, -2, 30, 30, 85, 85,
+    115, 115, 107, 107, 61, 61, -20, -20, -79, -79, -41, -41,
+    63, 63, 109, 109, 60, 60, 21, 21, 51, 51, 67, 67,
+    25, 25, 35, 35, 147, 147, 205, 205, 91, 91, -58, -58,
+    -63, -63, 42, 42, 111, 111, 116, 116, 106, 106, 92, 92,
+    65, 65, 69, 69, 129, 129, 180, 180, 148, 148, 61, 61,
+    7, 7, 6, 6, 14, 14, 29, 29, 86, 86, 156, 156,
+    167, 167, 119, 119, 76, 76, 69, 69, 86, 86, 113, 113,
+    123, 123, 89, 89, 34, 34, 20, 20, 52, 52, 77, 77,
+    70, 70, 63, 63, 81, 81, 104, 104, 99, 99, 69, 69,
+    51, 51, 61, 61, 73, 73, 60, 60, 38, 38, 45, 45,
+    85, 85, 125, 125, 128, 128, 89, 89, 48, 48, 44, 44,
+    63, 63, 71, 71, 70, 70, 74, 74, 69, 69, 47, 47,
+    39, 39, 63, 63, 87, 87, 72, 72, 29, 29, 0, 0,
+    9, 9, 42, 42, 65, 65, 62, 62, 48, 48, 39, 39,
+    31, 31, 21, 21, 23, 23, 33, 33, 27, 27, 1, 1,
+    -15, -15, 1, 1, 34, 34, 49, 49, 39, 39, 31, 31,
+    35, 35, 21, 21, -21, -21, -48, -48, -30, -30, 1, 1,
+    10, 10, 14, 14, 28, 28, 30, 30, 11, 11, 0, 0,
+    15, 15, 31, 31, 26, 26, 8, 8, -7, -7, -16, -16,
+    -19, -19, -4, -4, 28, 28, 51, 51, 39, 39, 9, 9,
+    -4, -4, 10, 10, 29, 29, 38, 38, 32, 32, 21, 21,
+    24, 24, 47, 47, 59, 59, 36, 36, 10, 10, 24, 24,
+    54, 54, 52, 52, 28, 28, 27, 27, 53, 53, 63, 63,
+    42, 42, 17, 17, 16, 16, 37, 37, 59, 59, 74, 74,
+    77, 77, 70, 70, 63, 63, 66, 66, 72, 72, 66, 66,
+    56, 56, 59, 59, 70, 70, 74, 74, 80, 80, 101, 101,
+    117, 117, 109, 109, 87, 87, 74, 74, 71, 71, 77, 77,
+    98, 98, 116, 116, 109, 109, 89, 89, 96, 96, 128, 128,
+    137, 137, 108, 108, 83, 83, 95, 95, 116, 116, 111, 111,
+    100, 100, 119, 119, 145, 145, 138, 138, 112, 112, 105, 105,
+    109, 109, 97, 97, 85, 85, 107, 107, 141, 141, 145, 145,
+    126, 126, 122, 122, 134, 134, 129, 129, 100, 100, 85, 85,
+    110, 110, 141, 141, 138, 138, 111, 111, 100, 100, 111, 111,
+    117, 117, 107, 107, 97, 97, 101, 101, 114, 114, 120, 120,
+    112, 112, 95, 95, 85, 85, 93, 93, 113, 113, 123, 123,
+    109, 109, 85, 85, 80, 80, 100, 100, 114, 114, 100, 100,
+    84, 84, 91, 91, 100, 100, 83, 83, 56, 56, 58, 58,
+    86, 86, 102, 102, 93, 93, 83, 83, 84, 84, 80, 80,
+    64, 64, 55, 55, 67, 67, 81, 81, 76, 76, 64, 64,
+    63, 63, 64, 64, 58, 58, 51, 51, 54, 54, 60, 60,
+    65, 65, 70, 70, 67, 67, 48, 48, 24, 24, 19, 19,
+    32, 32, 41, 41, 32, 32, 24, 24, 31, 31, 40, 40,
+    31, 31, 15, 15, 16, 16, 29, 29, 29, 29, 16, 16,
+    10, 10, 23, 23, 38, 38, 37, 37, 26, 26, 20, 20,
+    25, 25, 32, 32, 32, 32, 25, 25, 16, 16, 9, 9,
+    11, 11, 20, 20, 27, 27, 21, 21, 8, 8, 7, 7,
+    21, 21, 35, 35, 36, 36, 26, 26, 17, 17, 15, 15,
+    19, 19, 23, 23, 24, 24, 21, 21, 16, 16, 18, 18,
+    25, 25, 25, 25, 17, 17, 12, 12, 21, 21, 34, 34,
+    41, 41, 39, 39, 34, 34, 32, 32, 36, 36, 46, 46,
+    53, 53, 50, 50, 41, 41, 40, 40, 45, 45, 43, 43,
+    34, 34, 37, 37, 51, 51, 56, 56, 41, 41, 29, 29,
+    37, 37, 48, 48, 45, 45, 43, 43, 58, 58, 72, 72,
+    59, 59, 35, 35, 29, 29, 45, 45, 60, 60, 62, 62,
+    62, 62, 63, 63, 58, 58, 53, 53, 60, 60, 73, 73,
+    72, 72, 57, 57, 53, 53, 65, 65, 72, 72, 63, 63,
+    55, 55, 60, 60, 65, 65, 55, 55, 41, 41, 43, 43,
+    59, 59, 67, 67, 59, 59, 50, 50, 51, 51, 59, 59,
+    68, 68, 74, 74, 74, 74, 62, 62, 50, 50, 53, 53,
+    69, 69, 79, 79, 65, 65, 44, 44, 44, 44, 62, 62,
+    70, 70, 57, 57, 48, 48, 61, 61, 76, 76, 69, 69,
+    52, 52, 47, 47, 53, 53, 54, 54, 47, 47, 41, 41,
+    40, 40, 38, 38, 33, 33, 35, 35, 41, 41, 34, 34,
+    16, 16, 10, 10, 24, 24, 35, 35, 31, 31, 21, 21,
+    16, 16, 16, 16, 15, 15, 14, 14, 11, 11, 8, 8,
+    9, 9, 12, 12, 12, 12, 7, 7, 3, 3, 5, 5,
+    12, 12, 10, 10, -2, -2, -9, -9, -6, -6, -4, -4,
+    -7, -7, -5, -5, 1, 1, -3, -3, -19, -19, -30, -30,
+    -27, -27, -18, -18, -12, -12, -9, -9, -9, -9, -11, -11,
+    -19, -19, -27, -27, -25, -25, -13, -13, -3, -3, -4, -4,
+    -13, -13, -20, -20, -23, -23, -18, -18, -11, -11, -11, -11,
+    -15, -15, -16, -16, -14, -14, -15, -15, -19, -19, -22, -22,
+    -26, -26, -25, -25, -13, -13, -2, -2, -7, -7, -19, -19,
+    -20, -20, -8, -8, 3, 3, -1, -1, -16, -16, -23, -23,
+    -17, -17, -9, -9, -11, -11, -19, -19, -26, -26, -27, -27,
+    -17, -17, -4, -4, -5, -5, -19, -19, -23, -23, -5, -5,
+    8, 8, -3, -3, -18, -18, -12, -12, 6, 6, 10, 10,
+    -6, -6, -20, -20, -15, -15, -1, -1, 4, 4, 0, 0,
+    -6, -6, -10, -10, -8, -8, 3, 3, 11, 11, 1, 1,
+    -15, -15, -15, -15, -1, -1, 5, 5, 5, 5, 12, 12,
+    21, 21, 14, 14, -4, -4, -7, -7, 9, 9, 21, 21,
+    11, 11, -2, -2, 1, 1, 9, 9, 4, 4, -5, -5,
+    -1, -1, 10, 10, 11, 11, 3, 3, 1, 1, 5, 5,
+    11, 11, 14, 14, 10, 10, 3, 3, 5, 5, 14, 14,
+    16, 16, 5, 5, -2, -2, 9, 9, 24, 24, 20, 20,
+    2, 2, -2, -2, 12, 12, 20, 20, 11, 11, 2, 2,
+    3, 3, 1, 1, -5, -5, 1, 1, 14, 14, 12, 12,
+    -4, -4, -11, -11, -1, -1, 4, 4, -5, -5, -9, -9,
+    4, 4, 14, 14, 7, 7, -6, -6, -9, -9, -12, -12,
+    -25, -25, -31, -31, -22, -22, -20, -20, -33, -33, -39, -39,
+    -22, -22, -7, -7, -14, -14, -30, -30, -30, -30, -15, -15,
+    -9, -9, -19, -19, -36, -36, -46, -46, -43, -43, -28, -28,
+    -19, -19, -31, -31, -57, -57, -67, -67, -49, -49, -32, -32,
+    -45, -45, -68, -68, -68, -68, -48, -48, -36, -36, -40, -40,
+    -51, -51, -61, -61, -68, -68, -69, -69, -61, -61, -54, -54,
+    -56, -56, -61, -61, -58, -58, -50, -50, -55, -55, -71, -71,
+    -76, -76, -63, -63, -56, -56, -68, -68, -84, -84, -81, -81,
+    -65, -65, -56, -56, -60, -60, -70, -70, -73, -73, -69, -69,
+    -66, -66, -66, -66, -66, -66, -69, -69, -78, -78, -83, -83,
+    -77, -77, -65, -65, -59, -59, -60, -60, -62, -62, -65, -65,
+    -67, -67, -66, -66, -60, -60, -57, -57, -61, -61, -68, -68,
+    -68, -68, -63, -63, -61, -61, -61, -61, -56, -56, -44, -44,
+    -40, -40, -47, -47, -53, -53, -55, -55, -62, -62, -70, -70,
+    -64, -64, -45, -45, -36, -36, -47, -47, -60, -60, -56, -56,
+    -40, -40, -33, -33, -39, -39, -44, -44, -43, -43, -43, -43,
+    -49, -49, -51, -51, -45, -45, -39, -39, -42, -42, -46, -46,
+    -44, -44, -39, -39, -32, -32, -25, -25, -21, -21, -21, -21,
+    -29, -29, -38, -38, -41, -41, -34, -34, -28, -28, -27, -27,
+    -27, -27, -25, -25, -24, -24, -25, -25, -24, -24, -17, -17,
+    -12, -12, -19, -19, -34, -34, -44, -44, -41, -41, -29, -29,
+    -21, -21, -20, -20, -23, -23, -28, -28, -28, -28, -23, -23,
+    -17, -17, -19, -19, -26, -26, -30, -30, -28, -28, -25, -25,
+    -24, -24, -22, -22, -23, -23, -29, -29, -34, -34, -31, -31,
+    -24, -24, -25, -25, -33, -33, -35, -35, -28, -28, -28, -28,
+    -40, -40, -50, -50, -41, -41, -24, -24, -21, -21, -33, -33,
+    -43, -43, -40, -40, -32, -32, -31, -31, -38, -38, -47, -47,
+    -55, -55, -55, -55, -47, -47, -35, -35, -28, -28, -29, -29,
+    -35, -35, -44, -44, -56, -56, -63, -63, -61, -61, -54, -54,
+    -53, -53, -59, -59, -64, -64, -62, -62, -55, -55, -51, -51,
+    -51, -51, -52, -52, -53, -53, -57, -57, -60, -60, -56, -56,
+    -51, -51, -54, -54, -65, -65, -72, -72, -72, -72, -71, -71,
+    -71, -71, -70, -70, -66, -66, -62, -62, -65, -65, -72, -72,
+    -76, -76, -76, -76, -78, -78, -79, -79, -76, -76, -72, -72,
+    -71, -71, -70, -70, -71, -71, -75, -75, -79, -79, -77, -77,
+    -72, -72, -74, -74, -82, -82, -87, -87, -84, -84, -79, -79,
+    -81, -81, -88, -88, -90, -90, -82, -82, -75, -75, -73, -73,
+    -73, -73, -73, -73, -73, -73, -72, -72, -70, -70, -72, -72,
+    -80, -80, -86, -86, -84, -84, -75, -75, -69, -69, -71, -71,
+    -72, -72, -69, -69, -68, -68, -73, -73, -77, -77, -73, -73,
+    -69, -69, -72, -72, -77, -77, -73, -73, -62, -62, -59, -59,
+    -65, -65, -66, -66, -60, -60, -58, -58, -64, -64, -64, -64,
+    -53, -53, -44, -44, -48, -48, -57, -57, -59, -59, -52, -52,
+    -46, -46, -44, -44, -40, -40, -38, -38, -43, -43, -49, -49,
+    -47, -47, -41, -41, -40, -40, -43, -43, -42, -42, -38, -38,
+    -38, -38, -38, -38, -33, -33, -27, -27, -28, -28, -35, -35,
+    -36, -36, -30, -30, -28, -28, -36, -36, -43, -43, -38, -38,
+    -29, -29, -29, -29, -34, -34, -35, -35, -30, -30, -29, -29,
+    -32, -32, -35, -35, -35, -35, -34, -34, -33, -33, -33, -33,
+    -33, -33, -32, -32, -28, -28, -24, -24, -23, -23, -26, -26,
+    -30, -30, -31, -31, -28, -28, -27, -27, -28, -28, -30, -30,
+    -30, -30, -26, -26, -25, -25, -29, -29, -33, -33, -30, -30,
+    -23, -23, -20, -20, -25, -25, -29, -29, -29, -29, -26, -26,
+    -24, -24, -24, -24, -24, -24, -25, -25, -30, -30, -32, -32,
+    -26, -26, -18, -18, -17, -17, -20, -20, -25, -25, -28, -28,
+    -31, -31, -31, -31, -27, -27, -23, -23, -25, -25, -30, -30,
+    -32, -32, -32, -32, -31, -31, -29, -29, -26, -26, -27, -27,
+    -34, -34, -40, -40, -40, -40, -36, -36, -33, -33, -37, -37,
+    -41, -41, -41, -41, -42, -42, -44, -44, -47, -47, -46, -46,
+    -44, -44, -44, -44, -47, -47, -50, -50, -50, -50, -48, -48,
+    -48, -48, -49, -49, -51, -51, -52, -52, -51, -51, -49, -49,
+    -49, -49, -53, -53, -56, -56, -56, -56, -54, -54, -53, -53,
+    -52, -52, -51, -51, -50, -50, -51, -51, -52, -52, -54, -54,
+    -55, -55, -56, -56, -55, -55, -51, -51, -48, -48, -50, -50,
+    -54, -54, -54, -54, -51, -51, -49, -49, -52, -52, -54, -54,
+    -53, -53, -49, -49, -47, -47, -48, -48, -52, -52, -53, -53,
+    -51, -51, -48, -48, -46, -46, -44, -44, -42, -42, -43, -43,
+    -48, -48, -51, -51, -49, -49, -44, -44, -42, -42, -44, -44,
+    -46, -46, -47, -47, -48, -48, -48, -48, -45, -45, -39, -39,
+    -36, -36, -39, -39, -43, -43, -44, -44, -43, -43, -42, -42,
+    -41, -41, -39, -39, -36, -36, -37, -37, -41, -41, -41, -41,
+    -38, -38, -33, -33, -31, -31, -31, -31, -32, -32, -35, -35,
+    -37, -37, -36, -36, -33, -33, -28, -28, -25, -25, -28, -28,
+    -33, -33, -35, -35, -30, -30, -23, -23, -20, -20, -21, -21,
+    -25, -25, -27, -27, -26, -26, -23, -23, -21, -21, -19, -19,
+    -19, -19, -22, -22, -25, -25, -24, -24, -21, -21, -18, -18,
+    -17, -17, -18, -18, -20, -20, -18, -18, -15, -15, -14, -14,
+    -16, -16, -18, -18, -17, -17, -13, -13, -11, -11, -12, -12,
+    -14, -14, -16, -16, -16, -16, -17, -17, -15, -15, -13, -13,
+    -13, -13, -15, -15, -18, -18, -17, -17, -14, -14, -12, -12,
+    -13, -13, -16, -16, -17, -17, -15, -15, -13, -13, -13, -13,
+    -17, -17, -21, -21, -21, -21, -17, -17, -13, -13, -11, -11,
+    -14, -14, -19, -19, -23, -23, -22, -22, -16, -16, -11, -11,
+    -13, -13, -20, -20, -23, -23, -22, -22, -20, -20, -20, -20,
+    -19, -19, -18, -18, -18, -18, -20, -20, -22, -22, -22, -22,
+    -20, -20, -18, -18, -19, -19, -21, -21, -20, -20, -18, -18,
+    -17, -17, -19, -19, -21, -21, -21, -21, -17, -17, -14, -14,
+    -15, -15, -18, -18, -20, -20, -20, -20, -18, -18, -17, -17,
+    -17, -17, -17, -17, -17, -17, -19, -19, -20, -20, -18, -18,
+    -16, -16, -16, -16, -16, -16, -15, -15, -15, -15, -15, -15,
+    -14, -14, -12, -12, -11, -11, -13, -13, -14, -14, -15, -15,
+    -15, -15, -15, -15, -13, -13, -12, -12, -12, -12, -14, -14,
+    -15, -15, -14, -14, -12, -12, -13, -13, -16, -16, -19, -19,
+    -16, -16, -11, -11, -10, -10, -11, -11, -13, -13, -13, -13,
+    -12, -12, -13, -13, -15, -15, -14, -14, -12, -12, -11, -11,
+    -14, -14, -17, -17, -17, -17, -15, -15, -13, -13, -11, -11,
+    -12, -12, -14, -14, -15, -15, -15, -15, -10, -10, -6, -6,
+    -10, -10, -16, -16, -17, -17, -13, -13, -8, -8, -8, -8,
+    -11, -11, -11, -11, -11, -11, -10, -10, -10, -10, -9, -9,
+    -9, -9, -9, -9, -9, -9, -9, -9, -11, -11, -12, -12,
+    -9, -9, -6, -6, -6, -6, -8, -8, -7, -7, -5, -5,
+    -5, -5, -8, -8, -9, -9, -8, -8, -6, -6, -6, -6,
+    -6, -6, -5, -5, -4, -4, -5, -5, -6, -6, -5, -5,
+    -3, -3, -5, -5, -6, -6, -5, -5, -3, -3, -3, -3,
+    -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, -1, -1,
+    -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 1, 1,
+    0, 0, -2, -2, -3, -3, -2, -2, -2, -2, -2, -2,
+    -2, -2, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3,
+    4, 4, 4, 4, 2, 2, 1, 1, 3, 3, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 8, 8,
+    7, 7, 7, 7, 7, 7, 11, 11, 15, 15, 14, 14,
+    10, 10, 7, 7, 9, 9, 14, 14, 16, 16, 16, 16,
+    14, 14, 12, 12, 13, 13, 16, 16, 18, 18, 18, 18,
+    16, 16, 14, 14, 15, 15, 18, 18, 20, 20, 21, 21,
+    21, 21, 20, 20, 20, 20, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 21, 21, 22, 22, 22, 22, 21, 21,
+    20, 20, 22, 22, 22, 22, 21, 21, 22, 22, 24, 24,
+    24, 24, 22, 22, 20, 20, 20, 20, 21, 21, 22, 22,
+    22, 22, 23, 23, 23, 23, 22, 22, 23, 23, 24, 24,
+    25, 25, 25, 25, 25, 25, 24, 24, 25, 25, 26, 26,
+    26, 26, 24, 24, 23, 23, 22, 22, 22, 22, 23, 23,
+    25, 25, 25, 25, 23, 23, 22, 22, 22, 22, 25, 25,
+    26, 26, 23, 23, 20, 20, 21, 21, 22, 22, 25, 25,
+    27, 27, 28, 28, 28, 28, 25, 25, 22, 22, 22, 22,
+    24, 24, 23, 23, 21, 21, 21, 21, 22, 22, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20,
+    18, 18, 19, 19, 22, 22, 24, 24, 23, 23, 20, 20,
+    17, 17, 16, 16, 16, 16, 19, 19, 22, 22, 24, 24,
+    22, 22, 18, 18, 15, 15, 16, 16, 18, 18, 20, 20,
+    21, 21, 21, 21, 22, 22, 21, 21, 19, 19, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 19, 19, 17, 17,
+    16, 16, 17, 17, 19, 19, 21, 21, 22, 22, 21, 21,
+    20, 20, 19, 19, 20, 20, 22, 22, 25, 25, 26, 26,
+    23, 23, 20, 20, 18, 18, 20, 20, 23, 23, 27, 27,
+    28, 28, 26, 26, 24, 24, 23, 23, 25, 25, 28, 28,
+    29, 29, 30, 30, 31, 31, 31, 31, 29, 29, 30, 30,
+    31, 31, 32, 32, 32, 32, 31, 31, 31, 31, 33, 33,
+    36, 36, 38, 38, 37, 37, 36, 36, 37, 37, 37, 37,
+    37, 37, 37, 37, 38, 38, 40, 40, 41, 41, 40, 40,
+    41, 41, 41, 41, 42, 42, 41, 41, 41, 41, 42, 42,
+    44, 44, 45, 45, 45, 45, 44, 44, 42, 42, 40, 40,
+    41, 41, 44, 44, 45, 45, 44, 44, 42, 42, 42, 42,
+    45, 45, 45, 45, 44, 44, 42, 42, 40, 40, 39, 39,
+    39, 39, 40, 40, 42, 42, 42, 42, 40, 40, 39, 39,
+    40, 40, 40, 40, 39, 39, 39, 39, 41, 41, 41, 41,
+    41, 41, 40, 40, 40, 40, 40, 40, 39, 39, 38, 38,
+    36, 36, 35, 35, 37, 37, 38, 38, 39, 39, 39, 39,
+    38, 38, 36, 36, 37, 37, 39, 39, 39, 39, 36, 36,
+    32, 32, 34, 34, 39, 39, 41, 41, 38, 38, 34, 34,
+    32, 32, 33, 33, 34, 34, 33, 33, 32, 32, 33, 33,
+    34, 34, 33, 33, 31, 31, 30, 30, 29, 29, 28, 28,
+    28, 28, 28, 28, 28, 28, 27, 27, 28, 28, 29, 29,
+    28, 28, 26, 26, 23, 23, 22, 22, 23, 23, 23, 23,
+    23, 23, 24, 24, 24, 24, 24, 24, 22, 22, 21, 21,
+    22, 22, 22, 22, 21, 21, 21, 21, 22, 22, 22, 22,
+    19, 19, 18, 18, 20, 20, 21, 21, 19, 19, 17, 17,
+    18, 18, 21, 21, 21, 21, 18, 18, 18, 18, 20, 20,
+    22, 22, 23, 23, 22, 22, 19, 19, 13, 13, 11, 11,
+    16, 16, 23, 23, 25, 25, 20, 20, 15, 15, 16, 16,
+    19, 19, 18, 18, 16, 16, 16, 16, 20, 20, 23, 23,
+    21, 21, 15, 15, 13, 13, 16, 16, 21, 21, 21, 21,
+    20, 20, 20, 20, 21, 21, 19, 19, 17, 17, 17, 17,
+    20, 20, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 23, 23, 25, 25, 25, 25, 24, 24, 21, 21,
+    19, 19, 22, 22, 27, 27, 29, 29, 28, 28, 24, 24,
+    22, 22, 25, 25, 28, 28, 30, 30, 29, 29, 29, 29,
+    31, 31, 33, 33, 32, 32, 30, 30, 28, 28, 29, 29,
+    32, 32, 33, 33, 33, 33, 34, 34, 35, 35, 34, 34,
+    32, 32, 32, 32, 35, 35, 37, 37, 37, 37, 36, 36,
+    35, 35, 36, 36, 37, 37, 38, 38, 39, 39, 39, 39,
+    37, 37, 37, 37, 38, 38, 37, 37, 36, 36, 38, 38,
+    41, 41, 42, 42, 38, 38, 33, 33, 34, 34, 41, 41,
+    44, 44, 40, 40, 34, 34, 34, 34, 39, 39, 43, 43,
+    41, 41, 36, 36, 34, 34, 37, 37, 41, 41, 42, 42,
+    38, 38, 33, 33, 31, 31, 31, 31, 34, 34, 37, 37,
+    38, 38, 36, 36, 33, 33, 33, 33, 33, 33, 32, 32,
+    28, 28, 26, 26, 29, 29, 31, 31, 31, 31, 28, 28,
+    28, 28, 32, 32, 36, 36, 33, 33, 23, 23, 16, 16,
+    19, 19, 25, 25, 26, 26, 22, 22, 17, 17, 16, 16,
+    22, 22, 26, 26, 24, 24, 17, 17, 13, 13, 15, 15,
+    20, 20, 22, 22, 20, 20, 17, 17, 17, 17, 19, 19,
+    20, 20, 19, 19, 16, 16, 11, 11, 10, 10, 15, 15,
+    19, 19, 18, 18, 14, 14, 13, 13, 16, 16, 17, 17,
+    15, 15, 13, 13, 14, 14, 17, 17, 18, 18, 15, 15,
+    12, 12, 12, 12, 12, 12, 13, 13, 14, 14, 15, 15,
+    16, 16, 16, 16, 14, 14, 12, 12, 11, 11, 10, 10,
+    9, 9, 7, 7, 9, 9, 16, 16, 19, 19, 16, 16,
+    11, 11, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10,
+    11, 11, 11, 11, 12, 12, 14, 14, 17, 17, 16, 16,
+    12, 12, 9, 9, 10, 10, 11, 11, 12, 12, 12, 12,
+    10, 10, 9, 9, 12, 12, 16, 16, 16, 16, 12, 12,
+    10, 10, 12, 12, 14, 14, 17, 17, 18, 18, 16, 16,
+    15, 15, 18, 18, 23, 23, 23, 23, 17, 17, 9, 9,
+    7, 7, 11, 11, 15, 15, 16, 16, 19, 19, 21, 21,
+    18, 18, 14, 14, 15, 15, 18, 18, 17, 17, 15, 15,
+    15, 15, 15, 15, 14, 14, 12, 12, 15, 15, 20, 20,
+    22, 22, 20, 20, 19, 19, 18, 18, 15, 15, 14, 14,
+    19, 19, 24, 24, 18, 18, 8, 8, 7, 7, 13, 13,
+    19, 19, 21, 21, 20, 20, 16, 16, 9, 9, 8, 8,
+    13, 13, 15, 15, 11, 11, 11, 11, 18, 18, 21, 21,
+    15, 15, 11, 11, 16, 16, 23, 23, 21, 21, 11, 11,
+    6, 6, 7, 7, 4, 4, 1, 1, 5, 5, 15, 15,
+    19, 19, 17, 17, 14, 14, 9, 9, 2, 2, 1, 1,
+    7, 7, 12, 12, 9, 9, 6, 6, 6, 6, 5, 5,
+    3, 3, 4, 4, 13, 13, 19, 19, 17, 17, 11, 11,
+    11, 11, 17, 17, 22, 22, 17, 17, 4, 4, -7, -7,
+    -8, -8, 5, 5, 21, 21, 24, 24, 15, 15, 7, 7,
+    5, 5, 6, 6, 10, 10, 14, 14, 11, 11, 1, 1,
+    1, 1, 18, 18, 36, 36, 35, 35, 20, 20, 11, 11,
+    13, 13, 17, 17, 16, 16, 13, 13, 12, 12, 14, 14,
+    21, 21, 33, 33, 43, 43, 40, 40, 24, 24, 9, 9,
+    6, 6, 14, 14, 22, 22, 20, 20, 8, 8, -1, -1,
+    5, 5, 21, 21, 28, 28, 23, 23, 26, 26, 36, 36,
+    40, 40, 37, 37, 28, 28, 4, 4, -39, -39, -80, -80,
+    -80, -80, -31, -31, 35, 35, 94, 94, 137, 137, 150, 150,
+    113, 113, 27, 27, -65, -65, -115, -115, -106, -106, -49, -49,
+    35, 35, 103, 103, 113, 113, 68, 68, 9, 9, -36, -36,
+    -74, -74, -107, -107, -111, -111, -69, -69, -6, -6, 35, 35,
+    32, 32, -2, -2, -39, -39, -57, -57, -56, -56, -54, -54,
+    -61, -61, -61, -61, -35, -35, 0, 0, 9, 9, -19, -19,
+    -51, -51, -66, -66, -68, -68, -63, -63, -46, -46, -27, -27,
+    -27, -27, -45, -45, -56, -56, -54, -54, -53, -53, -60, -60,
+    -62, -62, -50, -50, -38, -38, -36, -36, -41, -41, -48, -48,
+    -57, -57, -64, -64, -63, -63, -58, -58, -58, -58, -61, -61,
+    -50, -50, -33, -33, -32, -32, -43, -43, -50, -50, -50, -50,
+    -51, -51, -42, -42, -16, -16, 8, 8, -1, -1, -35, -35,
+    -55, -55, -49, -49, -38, -38, -38, -38, -40, -40, -33, -33,
+    -22, -22, -20, -20, -22, -22, -28, -28, -36, -36, -39, -39,
+    -28, -28, -19, -19, -21, -21, -22, -22, -14, -14, -13, -13,
+    -29, -29, -39, -39, -30, -30, -20, -20, -24, -24, -18, -18,
+    15, 15, 53, 53, 68, 68, 63, 63, 56, 56, 58, 58,
+    60, 60, 66, 66, 92, 92, 139, 139, 194, 194, 239, 239,
+    257, 257, 227, 227, 142, 142, 25, 25, -73, -73, -72, -72,
+    102, 102, 431, 431, 767, 767, 945, 945, 931, 931, 782, 782,
+    530, 530, 204, 204, -82, -82, -189, -189, -109, -109, 37, 37,
+    144, 144, 202, 202, 221, 221, 176, 176, 74, 74, -20, -20,
+    -51, -51, -37, -37, -12, -12, 37, 37, 119, 119, 181, 181,
+    166, 166, 88, 88, 12, 12, -11, -11, 31, 31, 109, 109,
+    173, 173, 197, 197, 204, 204, 214, 214, 201, 201, 145, 145,
+    80, 80, 65, 65, 129, 129, 241, 241, 327, 327, 320, 320,
+    228, 228, 129, 129, 86, 86, 87, 87, 81, 81, 57, 57,
+    39, 39, 33, 33, 16, 16, -16, -16, -29, -29, -14, -14,
+    1, 1, 4, 4, 11, 11, 16, 16, 2, 2, 2, 2,
+    49, 49, 94, 94, 79, 79, 40, 40, 41, 41, 50, 50,
+    2, 2, -69, -69, -62, -62, 40, 40, 155, 155, 191, 191,
+    118, 118, -12, -12, -104, -104, -91, -91, -7, -7, 48, 48,
+    40, 40, 50, 50, 124, 124, 159, 159, 58, 58, -87, -87,
+    -113, -113, -31, -31, 23, 23, 8, 8, -9, -9, 21, 21,
+    92, 92, 189, 189, 252, 252, 214, 214, 108, 108, 28, 28,
+    -15, -15, -74, -74, -111, -111, -10, -10, 218, 218, 385, 385,
+    356, 356, 223, 223, 149, 149, 148, 148, 130, 130, 93, 93,
+    106, 106, 170, 170, 241, 241, 311, 311, 349, 349, 281, 281,
+    121, 121, 1, 1, -13, -13, 20, 20, 55, 55, 100, 100,
+    134, 134, 115, 115, 70, 70, 34, 34, -32, -32, -157, -157,
+    -256, -256, -233, -233, -144, -144, -118, -118, -151, -151, -115, -115,
+    12, 12, 105, 105, 104, 104, 82, 82, 71, 71, 64, 64,
+    181, 181, 557, 557, 1009, 1009, 1155, 1155, 905, 905, 566, 566,
+    406, 406, 375, 375, 301, 301, 161, 161, 85, 85, 175, 175,
+    362, 362, 429, 429, 236, 236, -86, -86, -218, -218, -8, -8,
+    324, 324, 462, 462, 419, 419, 495, 495, 797, 797, 1026, 1026,
+    854, 854, 329, 329, -196, -196, -409, -409, -273, -273, -17, -17,
+    115, 115, 107, 107, 97, 97, 96, 96, -24, -24, -239, -239,
+    -310, -310, -112, -112, 175, 175, 298, 298, 258, 258, 233, 233,
+    267, 267, 189, 189, -83, -83, -339, -339, -305, -305, -20, -20,
+    175, 175, 22, 22, -351, -351, -554, -554, -344, -344, 89, 89,
+    308, 308, 84, 84, -373, -373, -635, -635, -457, -457, -29, -29,
+    209, 209, 77, 77, -69, -69, 194, 194, 661, 661, 665, 665,
+    9, 9, -674, -674, -713, -713, -232, -232, 126, 126, 80, 80,
+    -73, -73, -35, -35, 115, 115, 173, 173, 144, 144, 120, 120,
+    38, 38, -240, -240, -656, -656, -908, -908, -707, -707, -90, -90,
+    550, 550, 810, 810, 641, 641, 277, 277, -115, -115, -503, -503,
+    -755, -755, -648, -648, -210, -210, 202, 202, 315, 315, 218, 218,
+    141, 141, 126, 126, 53, 53, -154, -154, -442, -442, -615, -615,
+    -426, -426, 155, 155, 707, 707, 675, 675, 33, 33, -598, -598,
+    -628, -628, -83, -83, 580, 580, 940, 940, 751, 751, 4, 4,
+    -838, -838, -1059, -1059, -540, -540, -32, -32, -132, -132, -362, -362,
+    94, 94, 996, 996, 1195, 1195, 243, 243, -925, -925, -1214, -1214,
+    -666, -666, -76, -76, 184, 184, 331, 331, 480, 480, 488, 488,
+    373, 373, 304, 304, 194, 194, -170, -170, -594, -594, -589, -589,
+    -60, -60, 495, 495, 589, 589, 243, 243, -182, -182, -384, -384,
+    -261, -261, 52, 52, 215, 215, 2, 2, -332, -332, -323, -323,
+    26, 26, 255, 255, 203, 203, 212, 212, 421, 421, 444, 444,
+    61, 61, -339, -339, -369, -369, -209, -209, -177, -177, -153, -153,
+    116, 116, 439, 439, 424, 424, 110, 110, -89, -89, -20, -20,
+    71, 71, 10, 10, -90, -90, -90, -90, 21, 21, 208, 208,
+    376, 376, 363, 363, 180, 180, 80, 80, 161, 161, 170, 170,
+    -55, -55, -242, -242, -121, -121, 96, 96, 50, 50, -162, -162,
+    -146, -146, 112, 112, 223, 223, 33, 33, -154, -154, -103, -103,
+    8, 8, -32, -32, -112, -112, -28, -28, 176, 176, 308, 308,
+    322, 322, 313, 313, 305, 305, 176, 176, -172, -172, -560, -560,
+    -575, -575, -28, -28, 662, 662, 813, 813, 263, 263, -419, -419,
+    -660, -660, -521, -521, -397, -397, -343, -343, -91, -91, 376, 376,
+    696, 696, 616, 616, 246, 246, -210, -210, -651, -651, -907, -907,
+    -738, -738, -172, -172, 387, 387, 581, 581, 436, 436, 160, 160,
+    -167, -167, -522, -522, -745, -745, -652, -652, -289, -289, 88, 88,
+    263, 263, 182, 182, -88, -88, -392, -392, -525, -525, -400, -400,
+    -136, -136, 81, 81, 172, 172, 115, 115, -139, -139, -504, -504,
+    -656, -656, -366, -366, 124, 124, 330, 330, 119, 119, -175, -175,
+    -275, -275, -288, -288, -394, -394, -479, -479, -323, -323, -10, -10,
+    130, 130, -27, -27, -246, -246, -284, -284, -196, -196, -173, -173,
+    -212, -212, -118, -118, 177, 177, 429, 429, 297, 297, -257, -257,
+    -852, -852, -1013, -1013, -593, -593, 132, 132, 717, 717, 854, 854,
+    516, 516, -63, -63, -562, -562, -797, -797, -776, -776, -568, -568,
+    -223, -223, 162, 162, 433, 433, 521, 521, 496, 496, 390, 390,
+    60, 60, -558, -558, -1140, -1140, -1159, -1159, -481, -481, 404, 404,
+    846, 846, 607, 607, -23, -23, -552, -552, -674, -674, -460, -460,
+    -225, -225, -154, -154, -127, -127, 27, 27, 226, 226, 220, 220,
+    -53, -53, -359, -359, -438, -438, -254, -254, 23, 23, 192, 192,
+    159, 159, -2, -2, -121, -121, -155, -155, -255, -255, -481, -481,
+    -562, -562, -227, -227, 318, 318, 582, 582, 416, 416, 127, 127,
+    -48, -48, -194, -194, -368, -368, -361, -361, -18, -18, 446, 446,
+    691, 691, 655, 655, 510, 510, 371, 371, 260, 260, 249, 249,
+    374, 374, 487, 487, 409, 409, 187, 187, -5, -5, -121, -121,
+    -226, -226, -298, -298, -216, -216, 69, 69, 424, 424, 609, 609,
+    443, 443, -16, -16, -441, -441, -474, -474, -93, -93, 329, 329,
+    418, 418, 194, 194, -32, -32, -86, -86, -79, -79, -151, -151,
+    -264, -264, -278, -278, -141, -141, 43, 43, 103, 103, -3, -3,
+    -99, -99, 19, 19, 278, 278, 370, 370, 139, 139, -172, -172,
+    -184, -184, 138, 138, 408, 408, 272, 272, -154, -154, -413, -413,
+    -214, -214, 259, 259, 558, 558, 421, 421, 22, 22, -228, -228,
+    -141, -141, 72, 72, 114, 114, -8, -8, -6, -6, 263, 263,
+    532, 532, 411, 411, -76, -76, -425, -425, -247, -247, 229, 229,
+    450, 450, 243, 243, -15, -15, 70, 70, 404, 404, 539, 539,
+    235, 235, -252, -252, -444, -444, -159, -159, 314, 314, 539, 539,
+    405, 405, 213, 213, 256, 256, 416, 416, 367, 367, 93, 93,
+    -75, -75, 52, 52, 290, 290, 429, 429, 514, 514, 618, 618,
+    585, 585, 252, 252, -209, -209, -387, -387, -88, -88, 460, 460,
+    878, 878, 969, 969, 751, 751, 342, 342, -88, -88, -357, -357,
+    -362, -362, -120, -120, 260, 260, 589, 589, 663, 663, 436, 436,
+    121, 121, 12, 12, 184, 184, 398, 398, 363, 363, 89, 89,
+    -101, -101, 26, 26, 304, 304, 399, 399, 267, 267, 172, 172,
+    263, 263, 345, 345, 179, 179, -147, -147, -323, -323, -233, -233,
+    -63, -63, 12, 12, 24, 24, 53, 53, 63, 63, -17, -17,
+    -181, -181, -358, -358, -428, -428, -262, -262, 110, 110, 418, 418,
+    384, 384, 45, 45, -293, -293, -415, -415, -408, -408, -451, -451,
+    -526, -526, -463, -463, -220, -220, 9, 9, -12, -12, -332, -332,
+    -738, -738, -922, -922, -786, -786, -549, -549, -453, -453, -442, -442,
+    -339, -339, -230, -230, -386, -386, -801, -801, -1108, -1108, -1042, -1042,
+    -763, -763, -601, -601, -655, -655, -793, -793, -905, -905, -980, -980,
+    -1016, -1016, -1034, -1034, -1104, -1104, -1214, -1214, -1218, -1218, -1067, -1067,
+    -939, -939, -965, -965, -1012, -1012, -932, -932, -827, -827, -867, -867,
+    -1001, -1001, -1077, -1077, -1119, -1119, -1249, -1249, -1394, -1394, -1330, -1330,
+    -1025, -1025, -731, -731, -673, -673, -845, -845, -1123, -1123, -1380, -1380,
+    -1471, -1471, -1333, -1333, -1117, -1117, -997, -997, -900, -900, -652, -652,
+    -342, -342, -256, -256, -458, -458, -705, -705, -791, -791, -752, -752,
+    -686, -686, -550, -550, -283, -283, 30, 30, 218, 218, 205, 205,
+    15, 15, -280, -280, -538, -538, -598, -598, -430, -430, -139, -139,
+    190, 190, 510, 510, 714, 714, 695, 695, 526, 526, 398, 398,
+    400, 400, 472, 472, 568, 568, 721, 721, 946, 946, 1160, 1160,
+    1256, 1256, 1207, 1207, 1078, 1078, 967, 967, 956, 956, 1056, 1056,
+    1170, 1170, 1204, 1204, 1201, 1201, 1260, 1260, 1363, 1363, 1419, 1419,
+    1446, 1446, 1523, 1523, 1619, 1619, 1635, 1635, 1578, 1578, 1554, 1554,
+    1603, 1603, 1675, 1675, 1728, 1728, 1775, 1775, 1823, 1823, 1830, 1830,
+    1757, 1757, 1635, 1635, 1541, 1541, 1511, 1511, 1526, 1526, 1548, 1548,
+    1549, 1549, 1533, 1533, 1525, 1525, 1507, 1507, 1418, 1418, 1286, 1286,
+    1256, 1256, 1398, 1398, 1592, 1592, 1676, 1676, 1606, 1606, 1431, 1431,
+    1228, 1228, 1087, 1087, 1057, 1057, 1078, 1078, 1044, 1044, 941, 941,
+    852, 852, 827, 827, 799, 799, 689, 689, 525, 525, 400, 400,
+    330, 330, 281, 281, 276, 276, 341, 341, 401, 401, 356, 356,
+    199, 199, -9, -9, -211, -211, -351, -351, -390, -390, -372, -372,
+    -379, -379, -437, -437, -513, -513, -573, -573, -606, -606, -630, -630,
+    -685, -685, -814, -814, -1023, -1023, -1250, -1250, -1394, -1394, -1419, -1419,
+    -1379, -1379, -1336, -1336, -1290, -1290, -1254, -1254, -1279, -1279, -1378, -1378,
+    -1502, -1502, -1638, -1638, -1789, -1789, -1898, -1898, -1924, -1924, -1946, -1946,
+    -2080, -2080, -2312, -2312, -2539, -2539, -2696, -2696, -2755, -2755, -2663, -2663,
+    -2413, -2413, -2180, -2180, -2239, -2239, -2664, -2664, -3212, -3212, -3614, -3614,
+    -3858, -3858, -4047, -4047, -4129, -4129, -3949, -3949, -3467, -3467, -2807, -2807,
+    -2154, -2154, -1692, -1692, -1523, -1523, -1579, -1579, -1692, -1692, -1749, -1749,
+    -1735, -1735, -1653, -1653, -1500, -1500, -1345, -1345, -1309, -1309, -1424, -1424,
+    -1585, -1585, -1702, -1702, -1799, -1799, -1855, -1855, -1694, -1694, -1215, -1215,
+    -632, -632, -246, -246, -99, -99, -30, -30, 32, 32, 39, 39,
+    13, 13, 63, 63, 250, 250, 532, 532, 844, 844, 1126, 1126,
+    1312, 1312, 1363, 1363, 1336, 1336, 1307, 1307, 1240, 1240, 1045, 1045,
+    786, 786, 645, 645, 681, 681, 797, 797, 940, 940, 1147, 1147,
+    1402, 1402, 1643, 1643, 1880, 1880, 2152, 2152, 2387, 2387, 2481, 2481,
+    2466, 2466, 2472, 2472, 2513, 2513, 2478, 2478, 2321, 2321, 2124, 2124,
+    1955, 1955, 1784, 1784, 1625, 1625, 1589, 1589, 1704, 1704, 1842, 1842,
+    1914, 1914, 1973, 1973, 2061, 2061, 2111, 2111, 2090, 2090, 2048, 2048,
+    2013, 2013, 1972, 1972, 1959, 1959, 2018, 2018, 2082, 2082, 2045, 2045,
+    1924, 1924, 1831, 1831, 1782, 1782, 1683, 1683, 1503, 1503, 1330, 1330,
+    1194, 1194, 1011, 1011, 758, 758, 566, 566, 522, 522, 568, 568,
+    647, 647, 775, 775, 911, 911, 960, 960, 947, 947, 999, 999,
+    1118, 1118, 1163, 1163, 1074, 1074, 945, 945, 852, 852, 753, 753,
+    602, 602, 433, 433, 306, 306, 230, 230, 202, 202, 232, 232,
+    286, 286, 298, 298, 286, 286, 345, 345, 474, 474, 568, 568,
+    594, 594, 628, 628, 697, 697, 743, 743, 755, 755, 788, 788,
+    853, 853, 912, 912, 943, 943, 948, 948, 922, 922, 867, 867,
+    796, 796, 705, 705, 578, 578, 450, 450, 403, 403, 451, 451,
+    505, 505, 493, 493, 466, 466, 487, 487, 504, 504, 446, 446,
+    357, 357, 306, 306, 239, 239, 68, 68, -205, -205, -530, -530,
+    -866, -866, -1121, -1121, -1196, -1196, -1151, -1151, -1164, -1164, -1290, -1290,
+    -1404, -1404, -1424, -1424, -1431, -1431, -1522, -1522, -1679, -1679, -1826, -1826,
+    -1923, -1923, -1948, -1948, -1910, -1910, -1943, -1943, -2237, -2237, -2788, -2788,
+    -3402, -3402, -3972, -3972, -4531, -4531, -4997, -4997, -5134, -5134, -4866, -4866,
+    -4362, -4362, -3757, -3757, -3074, -3074, -2440, -2440, -2095, -2095, -2092, -2092,
+    -2220, -2220, -2293, -2293, -2313, -2313, -2301, -2301, -2223, -2223, -2143, -2143,
+    -2209, -2209, -2409, -2409, -2567, -2567, -2649, -2649, -2797, -2797, -2966, -2966,
+    -2866, -2866, -2411, -2411, -1890, -1890, -1547, -1547, -1298, -1298, -1030, -1030,
+    -836, -836, -786, -786, -737, -737, -559, -559, -293, -293, 20, 20,
+    444, 444, 952, 952, 1331, 1331, 1447, 1447, 1401, 1401, 1297, 1297,
+    1083, 1083, 761, 761, 526, 526, 500, 500, 546, 546, 547, 547,
+    641, 641, 972, 972, 1415, 1415, 1767, 1767, 2029, 2029, 2316, 2316,
+    2633, 2633, 2914, 2914, 3149, 3149, 3341, 3341, 3423, 3423, 3337, 3337,
+    3143, 3143, 2923, 2923, 2664, 2664, 2338, 2338, 2021, 2021, 1837, 1837,
+    1811, 1811, 1882, 1882, 2004, 2004, 2157, 2157, 2307, 2307, 2433, 2433,
+    2538, 2538, 2601, 2601, 2579, 2579, 2484, 2484, 2375, 2375, 2280, 2280,
+    2215, 2215, 2219, 2219, 2301, 2301, 2371, 2371, 2328, 2328, 2170, 2170,
+    1946, 1946, 1656, 1656, 1283, 1283, 892, 892, 582, 582, 366, 366,
+    197, 197, 103, 103, 155, 155, 302, 302, 414, 414, 480, 480,
+    598, 598, 779, 779, 921, 921, 983, 983, 1012, 1012, 1003, 1003,
+    888, 888, 678, 678, 466, 466, 288, 288, 95, 95, -121, -121,
+    -268, -268, -280, -280, -195, -195, -66, -66, 97, 97, 251, 251,
+    327, 327, 350, 350, 431, 431, 587, 587, 726, 726, 814, 814,
+    916, 916, 1044, 1044, 1142, 1142, 1228, 1228, 1376, 1376, 1538, 1538,
+    1563, 1563, 1442, 1442, 1334, 1334, 1311, 1311, 1233, 1233, 1009, 1009,
+    786, 786, 721, 721, 741, 741, 709, 709, 677, 677, 742, 742,
+    833, 833, 851, 851, 873, 873, 1005, 1005, 1142, 1142, 1106, 1106,
+    898, 898, 637, 637, 343, 343, -44, -44, -480, -480, -849, -849,
+    -1130, -1130, -1382, -1382, -1592, -1592, -1705, -1705, -1783, -1783, -1928, -1928,
+    -2097, -2097, -2200, -2200, -2306, -2306, -2520, -2520, -2752, -2752, -2848, -2848,
+    -2851, -2851, -2914, -2914, -3051, -3051, -3224, -3224, -3560, -3560, -4229, -4229,
+    -5142, -5142, -6008, -6008, -6648, -6648, -7050, -7050, -7148, -7148, -6803, -6803,
+    -6065, -6065, -5196, -5196, -4393, -4393, -3704, -3704, -3227, -3227, -3109, -3109,
+    -3294, -3294, -3501, -3501, -3529, -3529, -3404, -3404, -3221, -3221, -3047, -3047,
+    -2959, -2959, -3012, -3012, -3149, -3149, -3261, -3261, -3298, -3298, -3234, -3234,
+    -2991, -2991, -2524, -2524, -1941, -1941, -1424, -1424, -1046, -1046, -793, -793,
+    -693, -693, -750, -750, -778, -778, -544, -544, -36, -36, 581, 581,
+    1226, 1226, 1897, 1897, 2491, 2491, 2842, 2842, 2915, 2915, 2788, 2788,
+    2517, 2517, 2148, 2148, 1792, 1792, 1548, 1548, 1418, 1418, 1372, 1372,
+    1448, 1448, 1685, 1685, 2038, 2038, 2433, 2433, 2858, 2858, 3313, 3313,
+    3735, 3735, 4082, 4082, 4400, 4400, 4688, 4688, 4801, 4801, 4640, 4640,
+    4308, 4308, 3925, 3925, 3468, 3468, 2937, 2937, 2495, 2495, 2271, 2271,
+    2207, 2207, 2222, 2222, 2350, 2350, 2590, 2590, 2804, 2804, 2863, 2863,
+    2802, 2802, 2701, 2701, 2548, 2548, 2325, 2325, 2126, 2126, 2059, 2059,
+    2079, 2079, 2082, 2082, 2087, 2087, 2157, 2157, 2229, 2229, 2173, 2173,
+    1954, 1954, 1594, 1594, 1106, 1106, 564, 564, 99, 99, -236, -236,
+    -481, -481, -630, -630, -634, -634, -530, -530, -416, -416, -303, -303,
+    -117, -117, 147, 147, 393, 393, 569, 569, 734, 734, 903, 903,
+    956, 956, 805, 805, 529, 529, 250, 250, -19, -19, -288, -288,
+    -476, -476, -519, -519, -452, -452, -315, -315, -102, -102, 153, 153,
+    363, 363, 494, 494, 589, 589, 701, 701, 849, 849, 1017, 1017,
+    1184, 1184, 1352, 1352, 1537, 1537, 1725, 1725, 1886, 1886, 2017, 2017,
+    2131, 2131, 2202, 2202, 2179, 2179, 2039, 2039, 1820, 1820, 1589, 1589,
+    1370, 1370, 1154, 1154, 984, 984, 945, 945, 1025, 1025, 1118, 1118,
+    1194, 1194, 1303, 1303, 1443, 1443, 1562, 1562, 1656, 1656, 1701, 1701,
+    1589, 1589, 1284, 1284, 915, 915, 565, 565, 147, 147, -396, -396,
+    -917, -917, -1270, -1270, -1522, -1522, -1798, -1798, -2023, -2023, -2071, -2071,
+    -2051, -2051, -2180, -2180, -2406, -2406, -2504, -2504, -2506, -2506, -2651, -2651,
+    -2942, -2942, -3154, -3154, -3249, -3249, -3388, -3388, -3597, -3597, -3817, -3817,
+    -4186, -4186, -4893, -4893, -5820, -5820, -6676, -6676, -7378, -7378, -7980, -7980,
+    -8326, -8326, -8146, -8146, -7459, -7459, -6556, -6556, -5600, -5600, -4601, -4601,
+    -3758, -3758, -3383, -3383, -3405, -3405, -3420, -3420, -3284, -3284, -3214, -3214,
+    -3261, -3261, -3208, -3208, -3024, -3024, -2961, -2961, -3110, -3110, -3294, -3294,
+    -3412, -3412, -3502, -3502, -3473, -3473, -3125, -3125, -2484, -2484, -1793, -1793,
+    -1178, -1178, -581, -581, -49, -49, 246, 246, 344, 344, 524, 524,
+    890, 890, 1264, 1264, 1600, 1600, 2093, 2093, 2766, 2766, 3333, 3333,
+    3603, 3603, 3666, 3666, 3596, 3596, 3320, 3320, 2853, 2853, 2367, 2367,
+    1985, 1985, 1727, 1727, 1642, 1642, 1797, 1797, 2155, 2155, 2604, 2604,
+    3106, 3106, 3665, 3665, 4186, 4186, 4529, 4529, 4708, 4708, 4877, 4877,
+    5061, 5061, 5115, 5115, 4972, 4972, 4691, 4691, 4270, 4270, 3659, 3659,
+    2958, 2958, 2354, 2354, 1912, 1912, 1629, 1629, 1569, 1569, 1752, 1752,
+    2034, 2034, 2273, 2273, 2449, 2449, 2538, 2538, 2441, 2441, 2149, 2149,
+    1830, 1830, 1641, 1641, 1557, 1557, 1501, 1501, 1525, 1525, 1694, 1694,
+    1870, 1870, 1847, 1847, 1628, 1628, 1346, 1346, 999, 999, 526, 526,
+    16, 16, -404, -404, -753, -753, -1059, -1059, -1221, -1221, -1190, -1190,
+    -1081, -1081, -969, -969, -772, -772, -450, -450, -108, -108, 183, 183,
+    501, 501, 879, 879, 1151, 1151, 1146, 1146, 939, 939, 720, 720,
+    505, 505, 201, 201, -125, -125, -292, -292, -266, -266, -140, -140,
+    58, 58, 323, 323, 578, 578, 772, 772, 956, 956, 1142, 1142,
+    1265, 1265, 1333, 1333, 1447, 1447, 1634, 1634, 1826, 1826, 2008, 2008,
+    2247, 2247, 2551, 2551, 2807, 2807, 2916, 2916, 2907, 2907, 2835, 2835,
+    2669, 2669, 2387, 2387, 2088, 2088, 1867, 1867, 1701, 1701, 1554, 1554,
+    1457, 1457, 1385, 1385, 1260, 1260, 1128, 1128, 1125, 1125, 1238, 1238,
+    1342, 1342, 1425, 1425, 1553, 1553, 1639, 1639, 1501, 1501, 1114, 1114,
+    616, 616, 86, 86, -517, -517, -1166, -1166, -1696, -1696, -2005, -2005,
+    -2178, -2178, -2318, -2318, -2426, -2426, -2531, -2531, -2727, -2727, -2998, -2998,
+    -3209, -3209, -3357, -3357, -3567, -3567, -3819, -3819, -3977, -3977, -4065, -4065,
+    -4221, -4221, -4406, -4406, -4495, -4495, -4601, -4601, -5023, -5023, -5851, -5851,
+    -6850, -6850, -7780, -7780, -8579, -8579, -9179, -9179, -9362, -9362, -8981, -8981,
+    -8151, -8151, -7089, -7089, -5935, -5935, -4863, -4863, -4115, -4115, -3753, -3753,
+    -3589, -3589, -3459, -3459, -3346, -3346, -3207, -3207, -2958, -2958, -2679, -2679,
+    -2569, -2569, -2666, -2666, -2834, -2834, -2985, -2985, -3129, -3129, -3184, -3184,
+    -2968, -2968, -2411, -2411, -1661, -1661, -903, -903, -214, -214, 344, 344,
+    677, 677, 814, 814, 942, 942, 1171, 1171, 1449, 1449, 1769, 1769,
+    2232, 2232, 2823, 2823, 3394, 3394, 3881, 3881, 4315, 4315, 4630, 4630,
+    4671, 4671, 4418, 4418, 3994, 3994, 3500, 3500, 2980, 2980, 2526, 2526,
+    2268, 2268, 2248, 2248, 2387, 2387, 2626, 2626, 2970, 2970, 3373, 3373,
+    3733, 3733, 4043, 4043, 4394, 4394, 4766, 4766, 5023, 5023, 5127, 5127,
+    5132, 5132, 4959, 4959, 4441, 4441, 3615, 3615, 2724, 2724, 1957, 1957,
+    1356, 1356, 954, 954, 824, 824, 962, 962, 1251, 1251, 1553, 1553,
+    1780, 1780, 1867, 1867, 1777, 1777, 1565, 1565, 1355, 1355, 1212, 1212,
+    1114, 1114, 1061, 1061, 1076, 1076, 1096, 1096, 1015, 1015, 856, 856,
+    726, 726, 615, 615, 419, 419, 125, 125, -176, -176, -434, -434,
+    -663, -663, -853, -853, -971, -971, -1020, -1020, -1031, -1031, -1001, -1001,
+    -892, -892, -678, -678, -382, -382, -31, -31, 364, 364, 776, 776,
+    1144, 1144, 1431, 1431, 1617, 1617, 1651, 1651, 1500, 1500, 1239, 1239,
+    982, 982, 765, 765, 585, 585, 479, 479, 490, 490, 597, 597,
+    768, 768, 1006, 1006, 1317, 1317, 1647, 1647, 1926, 1926, 2126, 2126,
+    2277, 2277, 2431, 2431, 2609, 2609, 2794, 2794, 2956, 2956, 3064, 3064,
+    3113, 3113, 3141, 3141, 3176, 3176, 3175, 3175, 3082, 3082, 2908, 2908,
+    2703, 2703, 2477, 2477, 2217, 2217, 1937, 1937, 1666, 1666, 1412, 1412,
+    1170, 1170, 941, 941, 747, 747, 636, 636, 656, 656, 786, 786,
+    936, 936, 1008, 1008, 937, 937, 708, 708, 339, 339, -134, -134,
+    -672, -672, -1228, -1228, -1761, -1761, -2253, -2253, -2683, -2683, -3010, -3010,
+    -3222, -3222, -3380, -3380, -3570, -3570, -3814, -3814, -4050, -4050, -4205, -4205,
+    -4292, -4292, -4404, -4404, -4587, -4587, -4767, -4767, -4857, -4857, -4873, -4873,
+    -4884, -4884, -4936, -4936, -5103, -5103, -5545, -5545, -6372, -6372, -7478, -7478,
+    -8593, -8593, -9491, -9491, -10074, -10074, -10278, -10278, -9997, -9997, -9179, -9179,
+    -7952, -7952, -6586, -6586, -5349, -5349, -4408, -4408, -3808, -3808, -3472, -3472,
+    -3258, -3258, -3037, -3037, -2738, -2738, -2366, -2366, -2017, -2017, -1833, -1833,
+    -1870, -1870, -2047, -2047, -2256, -2256, -2441, -2441, -2546, -2546, -2453, -2453,
+    -2064, -2064, -1419, -1419, -666, -666, 66, 66, 705, 705, 1196, 1196,
+    1507, 1507, 1696, 1696, 1893, 1893, 2192, 2192, 2609, 2609, 3134, 3134,
+    3744, 3744, 4381, 4381, 4950, 4950, 5359, 5359, 5527, 5527, 5405, 5405,
+    5006, 5006, 4416, 4416, 3745, 3745, 3094, 3094, 2564, 2564, 2240, 2240,
+    2148, 2148, 2240, 2240, 2450, 2450, 2733, 2733, 3039, 3039, 3331, 3331,
+    3620, 3620, 3949, 3949, 4300, 4300, 4591, 4591, 4763, 4763, 4794, 4794,
+    4628, 4628, 4178, 4178, 3453, 3453, 2610, 2610, 1816, 1816, 1160, 1160,
+    694, 694, 485, 485, 543, 543, 750, 750, 935, 935, 1009, 1009,
+    988, 988, 911, 911, 797, 797, 647, 647, 484, 484, 384, 384,
+    441, 441, 670, 670, 959, 959, 1165, 1165, 1237, 1237, 1184, 1184,
+    998, 998, 684, 684, 316, 316, -23, -23, -345, -345, -686, -686,
+    -982, -982, -1115, -1115, -1083, -1083, -1018, -1018, -994, -994, -938, -938,
+    -737, -737, -367, -367, 130, 130, 710, 710, 1305, 1305, 1819, 1819,
+    2174, 2174, 2328, 2328, 2272, 2272, 2038, 2038, 1719, 1719, 1410, 1410,
+    1155, 1155, 993, 993, 991, 991, 1166, 1166, 1423, 1423, 1632, 1632,
+    1773, 1773, 1916, 1916, 2081, 2081, 2210, 2210, 2279, 2279, 2348, 2348,
+    2468, 2468, 2620, 2620, 2779, 2779, 2961, 2961, 3168, 3168, 3350, 3350,
+    3461, 3461, 3484, 3484, 3406, 3406, 3222, 3222, 2970, 2970, 2712, 2712,
+    2472, 2472, 2227, 2227, 1958, 1958, 1669, 1669, 1359, 1359, 1005, 1005,
+    623, 623, 307, 307, 157, 157, 181, 181, 296, 296, 431, 431,
+    559, 559, 639, 639, 582, 582, 303, 303, -184, -184, -777, -777,
+    -1366, -1366, -1911, -1911, -2413, -2413, -2853, -2853, -3211, -3211, -3520, -3520,
+    -3842, -3842, -4182, -4182, -4475, -4475, -4660, -4660, -4736, -4736, -4747, -4747,
+    -4732, -4732, -4718, -4718, -4736, -4736, -4842, -4842, -5047, -5047, -5261, -5261,
+    -5357, -5357, -5329, -5329, -5353, -5353, -5641, -5641, -6263, -6263, -7119, -7119,
+    -8072, -8072, -9026, -9026, -9846, -9846, -10304, -10304, -10211, -10211, -9559, -9559,
+    -8493, -8493, -7179, -7179, -5797, -5797, -4575, -4575, -3690, -3690, -3132, -3132,
+    -2733, -2733, -2348, -2348, -1956, -1956, -1601, -1601, -1306, -1306, -1089, -1089,
+    -1004, -1004, -1097, -1097, -1322, -1322, -1566, -1566, -1727, -1727, -1734, -1734,
+    -1533, -1533, -1119, -1119, -556, -556, 64, 64, 661, 661, 1160, 1160,
+    1505, 1505, 1714, 1714, 1877, 1877, 2091, 2091, 2404, 2404, 2816, 2816,
+    3323, 3323, 3912, 3912, 4522, 4522, 5053, 5053, 5427, 5427, 5596, 5596,
+    5481, 5481, 5007, 5007, 4232, 4232, 3366, 3366, 2624, 2624, 2090, 2090,
+    1743, 1743, 1551, 1551, 1508, 1508, 1585, 1585, 1720, 1720, 1882, 1882,
+    2122, 2122, 2500, 2500, 2990, 2990, 3499, 3499, 3948, 3948, 4269, 4269,
+    4359, 4359, 4120, 4120, 3547, 3547, 2763, 2763, 1936, 1936, 1192, 1192,
+    604, 604, 231, 231, 101, 101, 164, 164, 312, 312, 457, 457,
+    553, 553, 589, 589, 591, 591, 608, 608, 640, 640, 638, 638,
+    600, 600, 606, 606, 704, 704, 827, 827, 900, 900, 933, 933,
+    968, 968, 978, 978, 917, 917, 827, 827, 774, 774, 720, 720,
+    574, 574, 360, 360, 206, 206, 151, 151, 100, 100, -13, -13,
+    -122, -122, -114, -114, 75, 75, 453, 453, 969, 969, 1514, 1514,
+    1996, 1996, 2407, 2407, 2748, 2748, 2945, 2945, 2920, 2920, 2719, 2719,
+    2471, 2471, 2251, 2251, 2065, 2065, 1931, 1931, 1863, 1863, 1796, 1796,
+    1672, 1672, 1563, 1563, 1602, 1602, 1784, 1784, 1983, 1983, 2148, 2148,
+    2348, 2348, 2596, 2596, 2799, 2799, 2877, 2877, 2853, 2853, 2769, 2769,
+    2638, 2638, 2490, 2490, 2378, 2378, 2310, 2310, 2242, 2242, 2147, 2147,
+    2047, 2047, 1958, 1958, 1856, 1856, 1696, 1696, 1444, 1444, 1110, 1110,
+    755, 755, 457, 457, 227, 227, 18, 18, -198, -198, -387, -387,
+    -535, -535, -671, -671, -809, -809, -929, -929, -1050, -1050, -1216, -1216,
+    -1401, -1401, -1528, -1528, -1618, -1618, -1793, -1793, -2093, -2093, -2428, -2428,
+    -2728, -2728, -3028, -3028, -3352, -3352, -3651, -3651, -3890, -3890, -4084, -4084,
+    -4222, -4222, -4256, -4256, -4226, -4226, -4252, -4252, -4381, -4381, -4531, -4531,
+    -4643, -4643, -4739, -4739, -4808, -4808, -4781, -4781, -4667, -4667, -4583, -4583,
+    -4624, -4624, -4827, -4827, -5269, -5269, -6014, -6014, -6928, -6928, -7725, -7725,
+    -8227, -8227, -8447, -8447, -8382, -8382, -7926, -7926, -7067, -7067, -5992, -5992,
+    -4920, -4920, -3950, -3950, -3117, -3117, -2459, -2459, -1939, -1939, -1441, -1441,
+    -921, -921, -496, -496, -294, -294, -315, -315, -479, -479, -727, -727,
+    -1019, -1019, -1295, -1295, -1491, -1491, -1538, -1538, -1369, -1369, -971, -971,
+    -446, -446, 59, 59, 470, 470, 795, 795, 1054, 1054, 1263, 1263,
+    1454, 1454, 1636, 1636, 1783, 1783, 1919, 1919, 2158, 2158, 2576, 2576,
+    3099, 3099, 3579, 3579, 3939, 3939, 4152, 4152, 4174, 4174, 3973, 3973,
+    3600, 3600, 3145, 3145, 2648, 2648, 2137, 2137, 1684, 1684, 1348, 1348,
+    1089, 1089, 840, 840, 617, 617, 506, 506, 575, 575, 845, 845,
+    1308, 1308, 1888, 1888, 2454, 2454, 2900, 2900, 3192, 3192, 3301, 3301,
+    3165, 3165, 2764, 2764, 2194, 2194, 1625, 1625, 1182, 1182, 888, 888,
+    699, 699, 577, 577, 527, 527, 566, 566, 672, 672, 783, 783,
+    859, 859, 917, 917, 967, 967, 977, 977, 937, 937, 896, 896,
+    877, 877, 832, 832, 757, 757, 753, 753, 886, 886, 1071, 1071,
+    1199, 1199, 1287, 1287, 1411, 1411, 1567, 1567, 1692, 1692, 1761, 1761,
+    1767, 1767, 1671, 1671, 1453, 1453, 1155, 1155, 842, 842, 546, 546,
+    316, 316, 248, 248, 394, 394, 698, 698, 1078, 1078, 1510, 1510,
+    1946, 1946, 2274, 2274, 2441, 2441, 2528, 2528, 2591, 2591, 2563, 2563,
+    2386, 2386, 2148, 2148, 1962, 1962, 1832, 1832, 1716, 1716, 1630, 1630,
+    1600, 1600, 1598, 1598, 1611, 1611, 1694, 1694, 1879, 1879, 2078, 2078,
+    2179, 2179, 2178, 2178, 2152, 2152, 2128, 2128, 2073, 2073, 1973, 1973,
+    1855, 1855, 1745, 1745, 1663, 1663, 1621, 1621, 1604, 1604, 1591, 1591,
+    1595, 1595, 1625, 1625, 1620, 1620, 1502, 1502, 1275, 1275, 992, 992,
+    671, 671, 324, 324, 21, 21, -181, -181, -316, -316, -452, -452,
+    -585, -585, -679, -679, -751, -751, -864, -864, -1027, -1027, -1190, -1190,
+    -1319, -1319, -1416, -1416, -1487, -1487, -1569, -1569, -1743, -1743, -2035, -2035,
+    -2352, -2352, -2613, -2613, -2849, -2849, -3089, -3089, -3256, -3256, -3298, -3298,
+    -3296, -3296, -3326, -3326, -3354, -3354, -3363, -3363, -3454, -3454, -3676, -3676,
+    -3911, -3911, -4038, -4038, -4110, -4110, -4209, -4209, -4265, -4265, -4182, -4182,
+    -4072, -4072, -4164, -4164, -4524, -4524, -5046, -5046, -5655, -5655, -6309, -6309,
+    -6851, -6851, -7103, -7103, -7076, -7076, -6897, -6897, -6551, -6551, -5910, -5910,
+    -5009, -5009, -4092, -4092, -3368, -3368, -2839, -2839, -2391, -2391, -1942, -1942,
+    -1491, -1491, -1090, -1090, -809, -809, -687, -687, -707, -707, -808, -808,
+    -947, -947, -1115, -1115, -1295, -1295, -1432, -1432, -1441, -1441, -1255, -1255,
+    -893, -893, -486, -486, -183, -183, -3, -3, 158, 158, 352, 352,
+    514, 514, 597, 597, 650, 650, 743, 743, 917, 917, 1217, 1217,
+    1652, 1652, 2137, 2137, 2549, 2549, 2837, 2837, 3018, 3018, 3084, 3084,
+    2994, 2994, 2746, 2746, 2395, 2395, 2008, 2008, 1645, 1645, 1361, 1361,
+    1156, 1156, 943, 943, 658, 658, 389, 389, 279, 279, 339, 339,
+    491, 491, 748, 748, 1179, 1179, 1712, 1712, 2178, 2178, 2497, 2497,
+    2682, 2682, 2686, 2686, 2445, 2445, 2054, 2054, 1718, 1718, 1531, 1531,
+    1407, 1407, 1267, 1267, 1166, 1166, 1178, 1178, 1266, 1266, 1326, 1326,
+    1310, 1310, 1227, 1227, 1113, 1113, 1032, 1032, 1035, 1035, 1086, 1086,
+    1102, 1102, 1075, 1075, 1069, 1069, 1108, 1108, 1170, 1170, 1250, 1250,
+    1337, 1337, 1385, 1385, 1393, 1393, 1447, 1447, 1622, 1622, 1869, 1869,
+    2061, 2061, 2116, 2116, 2038, 2038, 1865, 1865, 1638, 1638, 1393, 1393,
+    1152, 1152, 924, 924, 747, 747, 706, 706, 839, 839, 1059, 1059,
+    1251, 1251, 1402, 1402, 1545, 1545, 1668, 1668, 1749, 1749, 1814, 1814,
+    1872, 1872, 1887, 1887, 1865, 1865, 1872, 1872, 1913, 1913, 1899, 1899,
+    1785, 1785, 1647, 1647, 1575, 1575, 1567, 1567, 1575, 1575, 1599, 1599,
+    1655, 1655, 1710, 1710, 1721, 1721, 1717, 1717, 1729, 1729, 1696, 1696,
+    1552, 1552, 1358, 1358, 1236, 1236, 1221, 1221, 1264, 1264, 1332, 1332,
+    1414, 1414, 1495, 1495, 1560, 1560, 1597, 1597, 1567, 1567, 1437, 1437,
+    1228, 1228, 997, 997, 774, 774, 563, 563, 377, 377, 222, 222,
+    73, 73, -94, -94, -271, -271, -422, -422, -551, -551, -690, -690,
+    -834, -834, -938, -938, -1005, -1005, -1087, -1087, -1187, -1187, -1279, -1279,
+    -1393, -1393, -1571, -1571, -1762, -1762, -1892, -1892, -1988, -1988, -2105, -2105,
+    -2198, -2198, -2198, -2198, -2152, -2152, -2167, -2167, -2266, -2266, -2403, -2403,
+    -2565, -2565, -2769, -2769, -2967, -2967, -3083, -3083, -3134, -3134, -3211, -3211,
+    -3326, -3326, -3384, -3384, -3349, -3349, -3316, -3316, -3375, -3375, -3559, -3559,
+    -3904, -3904, -4406, -4406, -4940, -4940, -5360, -5360, -5652, -5652, -5853, -5853,
+    -5901, -5901, -5709, -5709, -5318, -5318, -4842, -4842, -4323, -4323, -3748, -3748,
+    -3171, -3171, -2692, -2692, -2321, -2321, -1975, -1975, -1627, -1627, -1349, -1349,
+    -1187, -1187, -1102, -1102, -1076, -1076, -1156, -1156, -1319, -1319, -1456, -1456,
+    -1508, -1508, -1513, -1513, -1479, -1479, -1366, -1366, -1185, -1185, -991, -991,
+    -815, -815, -659, -659, -544, -544, -490, -490, -481, -481, -471, -471,
+    -413, -413, -281, -281, -67, -67, 225, 225, 569, 569, 917, 917,
+    1236, 1236, 1525, 1525, 1771, 1771, 1926, 1926, 1961, 1961, 1902, 1902,
+    1787, 1787, 1643, 1643, 1491, 1491, 1323, 1323, 1109, 1109, 854, 854,
+    606, 606, 402, 402, 269, 269, 260, 260, 392, 392, 610, 610,
+    865, 865, 1165, 1165, 1490, 1490, 1756, 1756, 1892, 1892, 1910, 1910,
+    1861, 1861, 1775, 1775, 1667, 1667, 1586, 1586, 1588, 1588, 1669, 1669,
+    1751, 1751, 1787, 1787, 1800, 1800, 1800, 1800, 1754, 1754, 1666, 1666,
+    1595, 1595, 1555, 1555, 1511, 1511, 1458, 1458, 1417, 1417, 1381, 1381,
+    1335, 1335, 1284, 1284, 1232, 1232, 1186, 1186, 1177, 1177, 1236, 1236,
+    1348, 1348, 1482, 1482, 1620, 1620, 1743, 1743, 1817, 1817, 1830, 1830,
+    1796, 1796, 1730, 1730, 1628, 1628, 1486, 1486, 1335, 1335, 1234, 1234,
+    1198, 1198, 1188, 1188, 1191, 1191, 1238, 1238, 1310, 1310, 1337, 1337,
+    1315, 1315, 1314, 1314, 1343, 1343, 1357, 1357, 1369, 1369, 1427, 1427,
+    1501, 1501, 1517, 1517, 1472, 1472, 1421, 1421, 1389, 1389, 1358, 1358,
+    1332, 1332, 1343, 1343, 1398, 1398, 1465, 1465, 1516, 1516, 1564, 1564,
+    1604, 1604, 1586, 1586, 1500, 1500, 1415, 1415, 1374, 1374, 1341, 1341,
+    1299, 1299, 1296, 1296, 1352, 1352, 1420, 1420, 1464, 1464, 1479, 1479,
+    1457, 1457, 1397, 1397, 1307, 1307, 1186, 1186, 1040, 1040, 914, 914,
+    842, 842, 794, 794, 733, 733, 662, 662, 590, 590, 495, 495,
+    361, 361, 221, 221, 118, 118, 60, 60, 15, 15, -35, -35,
+    -91, -91, -195, -195, -405, -405, -668, -668, -856, -856, -952, -952,
+    -1064, -1064, -1223, -1223, -1329, -1329, -1342, -1342, -1344, -1344, -1380, -1380,
+    -1424, -1424, -1479, -1479, -1569, -1569, -1649, -1649, -1658, -1658, -1651, -1651,
+    -1739, -1739, -1922, -1922, -2080, -2080, -2156, -2156, -2216, -2216, -2304, -2304,
+    -2354, -2354, -2332, -2332, -2316, -2316, -2361, -2361, -2424, -2424, -2506, -2506,
+    -2706, -2706, -3040, -3040, -3397, -3397, -3730, -3730, -4110, -4110, -4509, -4509,
+    -4753, -4753, -4748, -4748, -4581, -4581, -4355, -4355, -4081, -4081, -3766, -3766,
+    -3464, -3464, -3195, -3195, -2904, -2904, -2564, -2564, -2248, -2248, -2013, -2013,
+    -1811, -1811, -1589, -1589, -1417, -1417, -1386, -1386, -1471, -1471, -1586, -1586,
+    -1692, -1692, -1770, -1770, -1782, -1782, -1741, -1741, -1701, -1701, -1665, -1665,
+    -1590, -1590, -1500, -1500, -1470, -1470, -1504, -1504, -1543, -1543, -1552, -1552,
+    -1538, -1538, -1490, -1490, -1375, -1375, -1200, -1200, -1004, -1004, -795, -795,
+    -544, -544, -248, -248, 48, 48, 306, 306, 520, 520, 689, 689,
+    802, 802, 886, 886, 962, 962, 986, 986, 914, 914, 803, 803,
+    724, 724, 651, 651, 541, 541, 452, 452, 464, 464, 547, 547,
+    646, 646, 787, 787, 1010, 1010, 1243, 1243, 1368, 1368, 1386, 1386,
+    1406, 1406, 1486, 1486, 1567, 1567, 1594, 1594, 1602, 1602, 1640, 1640,
+    1687, 1687, 1711, 1711, 1711, 1711, 1694, 1694, 1668, 1668, 1668, 1668,
+    1721, 1721, 1790, 1790, 1825, 1825, 1830, 1830, 1830, 1830, 1818, 1818,
+    1787, 1787, 1754, 1754, 1719, 1719, 1652, 1652, 1554, 1554, 1473, 1473,
+    1442, 1442, 1431, 1431, 1397, 1397, 1345, 1345, 1307, 1307, 1295, 1295,
+    1299, 1299, 1313, 1313, 1320, 1320, 1279, 1279, 1188, 1188, 1113, 1113,
+    1106, 1106, 1130, 1130, 1135, 1135, 1139, 1139, 1180, 1180, 1237, 1237,
+    1279, 1279, 1314, 1314, 1358, 1358, 1390, 1390, 1392, 1392, 1383, 1383,
+    1382, 1382, 1367, 1367, 1315, 1315, 1251, 1251, 1234, 1234, 1286, 1286,
+    1366, 1366, 1424, 1424, 1458, 1458, 1497, 1497, 1553, 1553, 1600, 1600,
+    1605, 1605, 1563, 1563, 1500, 1500, 1444, 1444, 1395, 1395, 1362, 1362,
+    1369, 1369, 1418, 1418, 1463, 1463, 1487, 1487, 1528, 1528, 1594, 1594,
+    1600, 1600, 1481, 1481, 1313, 1313, 1235, 1235, 1262, 1262, 1288, 1288,
+    1234, 1234, 1131, 1131, 1041, 1041, 973, 973, 907, 907, 855, 855,
+    831, 831, 811, 811, 773, 773, 741, 741, 746, 746, 752, 752,
+    689, 689, 553, 553, 403, 403, 281, 281, 171, 171, 46, 46,
+    -85, -85, -188, -188, -252, -252, -300, -300, -367, -367, -463, -463,
+    -566, -566, -641, -641, -671, -671, -694, -694, -774, -774, -909, -909,
+    -1007, -1007, -1000, -1000, -953, -953, -974, -974, -1057, -1057, -1115, -1115,
+    -1125, -1125, -1152, -1152, -1221, -1221, -1278, -1278, -1302, -1302, -1346, -1346,
+    -1446, -1446, -1553, -1553, -1612, -1612, -1643, -1643, -1696, -1696, -1783, -1783,
+    -1912, -1912, -2117, -2117, -2399, -2399, -2676, -2676, -2886, -2886, -3053, -3053,
+    -3204, -3204, -3293, -3293, -3276, -3276, -3189, -3189, -3090, -3090, -2973, -2973,
+    -2816, -2816, -2646, -2646, -2509, -2509, -2401, -2401, -2292, -2292, -2186, -2186,
+    -2107, -2107, -2039, -2039, -1956, -1956, -1877, -1877, -1854, -1854, -1884, -1884,
+    -1915, -1915, -1923, -1923, -1933, -1933, -1955, -1955, -1967, -1967, -1969, -1969,
+    -1979, -1979, -1993, -1993, -1990, -1990, -1978, -1978, -1986, -1986, -2017, -2017,
+    -2039, -2039, -2030, -2030, -1994, -1994, -1941, -1941, -1859, -1859, -1723, -1723,
+    -1535, -1535, -1336, -1336, -1160, -1160, -1005, -1005, -871, -871, -757, -757,
+    -651, -651, -533, -533, -404, -404, -287, -287, -193, -193, -115, -115,
+    -44, -44, 21, 21, 63, 63, 78, 78, 95, 95, 148, 148,
+    226, 226, 294, 294, 353, 353, 432, 432, 536, 536, 629, 629,
+    673, 673, 685, 685, 721, 721, 803, 803, 886, 886, 929, 929,
+    961, 961, 1035, 1035, 1137, 1137, 1223, 1223, 1285, 1285, 1343, 1343,
+    1399, 1399, 1445, 1445, 1485, 1485, 1521, 1521, 1538, 1538, 1527, 1527,
+    1499, 1499, 1474, 1474, 1461, 1461, 1446, 1446, 1427, 1427, 1425, 1425,
+    1450, 1450, 1478, 1478, 1499, 1499, 1529, 1529, 1570, 1570, 1594, 1594,
+    1591, 1591, 1585, 1585, 1583, 1583, 1571, 1571, 1539, 1539, 1496, 1496,
+    1454, 1454, 1427, 1427, 1414, 1414, 1397, 1397, 1364, 1364, 1318, 1318,
+    1264, 1264, 1211, 1211, 1185, 1185, 1198, 1198, 1236, 1236, 1283, 1283,
+    1336, 1336, 1382, 1382, 1383, 1383, 1335, 1335, 1285, 1285, 1283, 1283,
+    1324, 1324, 1352, 1352, 1344, 1344, 1351, 1351, 1421, 1421, 1519, 1519,
+    1564, 1564, 1539, 1539, 1500, 1500, 1500, 1500, 1551, 1551, 1620, 1620,
+    1643, 1643, 1585, 1585, 1497, 1497, 1452, 1452, 1449, 1449, 1435, 1435,
+    1396, 1396, 1360, 1360, 1332, 1332, 1306, 1306, 1300, 1300, 1329, 1329,
+    1356, 1356, 1336, 1336, 1296, 1296, 1302, 1302, 1344, 1344, 1334, 1334,
+    1246, 1246, 1150, 1150, 1085, 1085, 1003, 1003, 893, 893, 821, 821,
+    806, 806, 782, 782, 724, 724, 682, 682, 651, 651, 573, 573,
+    481, 481, 487, 487, 580, 580, 597, 597, 439, 439, 225, 225,
+    126, 126, 147, 147, 153, 153, 87, 87, 24, 24, 22, 22,
+    32, 32, -4, -4, -64, -64, -105, -105, -132, -132, -183, -183,
+    -255, -255, -299, -299, -290, -290, -296, -296, -398, -398, -557, -557,
+    -651, -651, -658, -658, -672, -672, -729, -729, -752, -752, -717, -717,
+    -712, -712, -778, -778, -844, -844, -859, -859, -870, -870, -916, -916,
+    -959, -959, -975, -975, -1017, -1017, -1120, -1120, -1220, -1220, -1249, -1249,
+    -1260, -1260, -1332, -1332, -1444, -1444, -1528, -1528, -1596, -1596, -1694, -1694,
+    -1797, -1797, -1874, -1874, -1957, -1957, -2050, -2050, -2096, -2096, -2076, -2076,
+    -2050, -2050, -2038, -2038, -1994, -1994, -1913, -1913, -1859, -1859, -1862, -1862,
+    -1866, -1866, -1826, -1826, -1781, -1781, -1776, -1776, -1790, -1790, -1788, -1788,
+    -1793, -1793, -1847, -1847, -1930, -1930, -2001, -2001, -2061, -2061, -2109, -2109,
+    -2116, -2116, -2085, -2085, -2068, -2068, -2085, -2085, -2097, -2097, -2093, -2093,
+    -2090, -2090, -2081, -2081, -2054, -2054, -2039, -2039, -2053, -2053, -2046, -2046,
+    -1970, -1970, -1859, -1859, -1774, -1774, -1710, -1710, -1617, -1617, -1484, -1484,
+    -1357, -1357, -1262, -1262, -1178, -1178, -1085, -1085, -989, -989, -886, -886,
+    -767, -767, -652, -652, -572, -572, -516, -516, -456, -456, -401, -401,
+    -357, -357, -291, -291, -191, -191, -100, -100, -38, -38, 40, 40,
+    145, 145, 223, 223, 249, 249, 275, 275, 326, 326, 360, 360,
+    363, 363, 392, 392, 480, 480, 590, 590, 679, 679, 763, 763,
+    871, 871, 976, 976, 1033, 1033, 1052, 1052, 1067, 1067, 1076, 1076,
+    1063, 1063, 1050, 1050, 1053, 1053, 1046, 1046, 1024, 1024, 1030, 1030,
+    1072, 1072, 1108, 1108, 1126, 1126, 1155, 1155, 1199, 1199, 1235, 1235,
+    1260, 1260, 1285, 1285, 1301, 1301, 1301, 1301, 1304, 1304, 1313, 1313,
+    1299, 1299, 1248, 1248, 1191, 1191, 1160, 1160, 1143, 1143, 1126, 1126,
+    1148, 1148, 1243, 1243, 1346, 1346, 1356, 1356, 1281, 1281, 1223, 1223,
+    1229, 1229, 1252, 1252, 1261, 1261, 1259, 1259, 1237, 1237, 1192, 1192,
+    1161, 1161, 1161, 1161, 1160, 1160, 1155, 1155, 1190, 1190, 1266, 1266,
+    1316, 1316, 1323, 1323, 1351, 1351, 1433, 1433, 1509, 1509, 1512, 1512,
+    1457, 1457, 1394, 1394, 1332, 1332, 1273, 1273, 1264, 1264, 1328, 1328,
+    1400, 1400, 1416, 1416, 1400, 1400, 1394, 1394, 1375, 1375, 1337, 1337,
+    1334, 1334, 1369, 1369, 1372, 1372, 1337, 1337, 1315, 1315, 1274, 1274,
+    1147, 1147, 1017, 1017, 1028, 1028, 1119, 1119, 1079, 1079, 892, 892,
+    805, 805, 938, 938, 1080, 1080, 1019, 1019, 883, 883, 905, 905,
+    1034, 1034, 1037, 1037, 888, 888, 744, 744, 659, 659, 585, 585,
+    549, 549, 611, 611, 694, 694, 681, 681, 599, 599, 557, 557,
+    561, 561, 529, 529, 449, 449, 399, 399, 403, 403, 404, 404,
+    378, 378, 355, 355, 339, 339, 291, 291, 226, 226, 200, 200,
+    196, 196, 138, 138, 33, 33, -19, -19, 19, 19, 58, 58,
+    13, 13, -89, -89, -175, -175, -233, -233, -317, -317, -446, -446,
+    -557, -557, -593, -593, -608, -608, -678, -678, -764, -764, -772, -772,
+    -744, -744, -809, -809, -964, -964, -1063, -1063, -1049, -1049, -1050, -1050,
+    -1166, -1166, -1323, -1323, -1405, -1405, -1431, -1431, -1493, -1493, -1594, -1594,
+    -1671, -1671, -1733, -1733, -1827, -1827, -1931, -1931, -2002, -2002, -2072, -2072,
+    -2171, -2171, -2233, -2233, -2211, -2211, -2177, -2177, -2188, -2188, -2180, -2180,
+    -2100, -2100, -2022, -2022, -2017, -2017, -2041, -2041, -2025, -2025, -1990, -1990,
+    -1985, -1985, -1997, -1997, -1985, -1985, -1959, -1959, -1952, -1952, -1953, -1953,
+    -1945, -1945, -1966, -1966, -2040, -2040, -2093, -2093, -2065, -2065, -2010, -2010,
+    -2002, -2002, -2004, -2004, -1972, -1972, -1948, -1948, -1967, -1967, -1976, -1976,
+    -1942, -1942, -1907, -1907, -1894, -1894, -1862, -1862, -1786, -1786, -1694, -1694,
+    -1607, -1607, -1508, -1508, -1390, -1390, -1283, -1283, -1202, -1202, -1123, -1123,
+    -1024, -1024, -928, -928, -853, -853, -777, -777, -684, -684, -599, -599,
+    -538, -538, -477, -477, -415, -415, -374, -374, -340, -340, -286, -286,
+    -233, -233, -200, -200, -136, -136, -25, -25, 44, 44, 16, 16,
+    -22, -22, 26, 26, 119, 119, 164, 164, 171, 171, 219, 219,
+    324, 324, 427, 427, 485, 485, 518, 518, 561, 561, 626, 626,
+    702, 702, 762, 762, 783, 783, 794, 794, 856, 856, 941, 941,
+    945, 945, 874, 874, 868, 868, 971, 971, 1054, 1054, 1041, 1041,
+    1021, 1021, 1052, 1052, 1067, 1067, 1046, 1046, 1066, 1066, 1134, 1134,
+    1146, 1146, 1080, 1080, 1038, 1038, 1062, 1062, 1066, 1066, 1011, 1011,
+    994, 994, 1068, 1068, 1131, 1131, 1106, 1106, 1080, 1080, 1136, 1136,
+    1189, 1189, 1150, 1150, 1089, 1089, 1092, 1092, 1121, 1121, 1134, 1134,
+    1166, 1166, 1203, 1203, 1157, 1157, 1033, 1033, 962, 962, 1007, 1007,
+    1077, 1077, 1102, 1102, 1129, 1129, 1199, 1199, 1269, 1269, 1297, 1297,
+    1324, 1324, 1388, 1388, 1442, 1442, 1426, 1426, 1364, 1364, 1334, 1334,
+    1351, 1351, 1366, 1366, 1353, 1353, 1360, 1360, 1440, 1440, 1553, 1553,
+    1573, 1573, 1449, 1449, 1333, 1333, 1414, 1414, 1606, 1606, 1622, 1622,
+    1417, 1417, 1279, 1279, 1380, 1380, 1513, 1513, 1457, 1457, 1303, 1303,
+    1236, 1236, 1237, 1237, 1204, 1204, 1167, 1167, 1194, 1194, 1235, 1235,
+    1211, 1211, 1153, 1153, 1125, 1125, 1084, 1084, 971, 971, 851, 851,
+    814, 814, 806, 806, 725, 725, 606, 606, 540, 540, 517, 517,
+    495, 495, 498, 498, 507, 507, 434, 434, 290, 290, 200, 200,
+    193, 193, 169, 169, 93, 93, 23, 23, -28, -28, -97, -97,
+    -158, -158, -170, -170, -189, -189, -291, -291, -403, -403, -384, -384,
+    -268, -268, -237, -237, -331, -331, -395, -395, -370, -370, -392, -392,
+    -510, -510, -581, -581, -552, -552, -552, -552, -627, -627, -667, -667,
+    -646, -646, -675, -675, -780, -780, -860, -860, -876, -876, -895, -895,
+    -946, -946, -996, -996, -1039, -1039, -1092, -1092, -1135, -1135, -1145, -1145,
+    -1156, -1156, -1214, -1214, -1282, -1282, -1289, -1289, -1272, -1272, -1320, -1320,
+    -1407, -1407, -1424, -1424, -1391, -1391, -1424, -1424, -1512, -1512, -1555, -1555,
+    -1561, -1561, -1605, -1605, -1667, -1667, -1686, -1686, -1685, -1685, -1696, -1696,
+    -1676, -1676, -1608, -1608, -1557, -1557, -1559, -1559, -1574, -1574, -1574, -1574,
+    -1583, -1583, -1616, -1616, -1635, -1635, -1610, -1610, -1582, -1582, -1589, -1589,
+    -1603, -1603, -1598, -1598, -1621, -1621, -1685, -1685, -1707, -1707, -1647, -1647,
+    -1597, -1597, -1619, -1619, -1633, -1633, -1582, -1582, -1538, -1538, -1548, -1548,
+    -1556, -1556, -1518, -1518, -1481, -1481, -1479, -1479, -1478, -1478, -1447, -1447,
+    -1395, -1395, -1335, -1335, -1272, -1272, -1206, -1206, -1133, -1133, -1050, -1050,
+    -968, -968, -906, -906, -860, -860, -805, -805, -735, -735, -667, -667,
+    -611, -611, -545, -545, -466, -466, -414, -414, -396, -396, -354, -354,
+    -272, -272, -221, -221, -217, -217, -173, -173, -73, -73, -22, -22,
+    -52, -52, -57, -57, 9, 9, 51, 51, 24, 24, 15, 15,
+    75, 75, 134, 134, 142, 142, 145, 145, 187, 187, 249, 249,
+    300, 300, 347, 347, 392, 392, 420, 420, 438, 438, 479, 479,
+    532, 532, 541, 541, 520, 520, 552, 552, 638, 638, 679, 679,
+    655, 655, 660, 660, 725, 725, 782, 782, 799, 799, 810, 810,
+    822, 822, 837, 837, 880, 880, 922, 922, 902, 902, 860, 860,
+    898, 898, 988, 988, 1010, 1010, 958, 958, 948, 948, 996, 996,
+    996, 996, 936, 936, 950, 950, 1075, 1075, 1156, 1156, 1102, 1102,
+    1058, 1058, 1124, 1124, 1151, 1151, 1048, 1048, 1012, 1012, 1163, 1163,
+    1276, 1276, 1172, 1172, 1045, 1045, 1093, 1093, 1179, 1179, 1128, 1128,
+    1061, 1061, 1141, 1141, 1266, 1266, 1254, 1254, 1155, 1155, 1146, 1146,
+    1223, 1223, 1229, 1229, 1139, 1139, 1082, 1082, 1099, 1099, 1104, 1104,
+    1075, 1075, 1063, 1063, 1051, 1051, 1020, 1020, 1031, 1031, 1085, 1085,
+    1065, 1065, 970, 970, 956, 956, 1036, 1036, 1010, 1010, 822, 822,
+    685, 685, 752, 752, 880, 880, 879, 879, 782, 782, 746, 746,
+    781, 781, 771, 771, 683, 683, 592, 592, 539, 539, 512, 512,
+    523, 523, 557, 557, 527, 527, 414, 414, 340, 340, 374, 374,
+    399, 399, 321, 321, 240, 240, 277, 277, 358, 358, 329, 329,
+    198, 198, 119, 119, 170, 170, 248, 248, 219, 219, 109, 109,
+    45, 45, 64, 64, 67, 67, 3, 3, -45, -45, -4, -4,
+    61, 61, 40, 40, -45, -45, -74, -74, -24, -24, -7, -7,
+    -94, -94, -194, -194, -192, -192, -122, -122, -115, -115, -207, -207,
+    -298, -298, -299, -299, -238, -238, -206, -206, -249, -249, -318, -318,
+    -340, -340, -321, -321, -341, -341, -411, -411, -452, -452, -440, -440,
+    -462, -462, -549, -549, -611, -611, -597, -597, -593, -593, -660, -660,
+    -718, -718, -702, -702, -679, -679, -737, -737, -832, -832, -866, -866,
+    -852, -852, -877, -877, -951, -951, -995, -995, -978, -978, -958, -958,
+    -973, -973, -1015, -1015, -1080, -1080, -1154, -1154, -1184, -1184, -1157, -1157,
+    -1141, -1141, -1169, -1169, -1192, -1192, -1198, -1198, -1243, -1243, -1316, -1316,
+    -1334, -1334, -1289, -1289, -1262, -1262, -1281, -1281, -1287, -1287, -1251, -1251,
+    -1226, -1226, -1254, -1254, -1291, -1291, -1285, -1285, -1266, -1266, -1278, -1278,
+    -1297, -1297, -1283, -1283, -1272, -1272, -1308, -1308, -1347, -1347, -1350, -1350,
+    -1351, -1351, -1368, -1368, -1362, -1362, -1326, -1326, -1311, -1311, -1323, -1323,
+    -1315, -1315, -1278, -1278, -1248, -1248, -1242, -1242, -1246, -1246, -1242, -1242,
+    -1222, -1222, -1178, -1178, -1110, -1110, -1032, -1032, -968, -968, -931, -931,
+    -902, -902, -858, -858, -802, -802, -747, -747, -691, -691, -636, -636,
+    -594, -594, -561, -561, -529, -529, -494, -494, -453, -453, -398, -398,
+    -352, -352, -335, -335, -320, -320, -265, -265, -185, -185, -134, -134,
+    -123, -123, -123, -123, -112, -112, -74, -74, -4, -4, 55, 55,
+    48, 48, 13, 13, 42, 42, 134, 134, 189, 189, 178, 178,
+    202, 202, 312, 312, 408, 408, 411, 411, 394, 394, 448, 448,
+    529, 529, 554, 554, 543, 543, 550, 550, 551, 551, 527, 527,
+    546, 546, 649, 649, 736, 736, 719, 719, 679, 679, 709, 709,
+    757, 757, 751, 751, 758, 758, 834, 834, 884, 884, 823, 823,
+    744, 744, 768, 768, 847, 847, 857, 857, 786, 786, 727, 727,
+    734, 734, 775, 775, 805, 805, 816, 816, 819, 819, 820, 820,
+    822, 822, 827, 827, 823, 823, 816, 816, 825, 825, 833, 833,
+    822, 822, 839, 839, 905, 905, 916, 916, 798, 798, 704, 704,
+    798, 798, 957, 957, 951, 951, 825, 825, 809, 809, 928, 928,
+    983, 983, 895, 895, 818, 818, 874, 874, 965, 965, 953, 953,
+    881, 881, 885, 885, 969, 969, 1019, 1019, 988, 988, 949, 949,
+    963, 963, 1009, 1009, 1018, 1018, 960, 960, 910, 910, 964, 964,
+    1058, 1058, 1031, 1031, 913, 913, 898, 898, 997, 997, 992, 992,
+    835, 835, 748, 748, 838, 838, 926, 926, 868, 868, 782, 782,
+    802, 802, 849, 849, 802, 802, 732, 732, 759, 759, 813, 813,
+    751, 751, 619, 619, 556, 556, 548, 548, 509, 509, 489, 489,
+    555, 555, 588, 588, 482, 482, 360, 360, 369, 369, 440, 440,
+    431, 431, 354, 354, 306, 306, 296, 296, 273, 273, 218, 218,
+    164, 164, 136, 136, 125, 125, 102, 102, 58, 58, 17, 17,
+    14, 14, 46, 46, 54, 54, -2, -2, -66, -66, -58, -58,
+    -45, -45, -147, -147, -301, -301, -332, -332, -253, -253, -245, -245,
+    -330, -330, -362, -362, -318, -318, -328, -328, -418, -418, -475, -475,
+    -464, -464, -473, -473, -547, -547, -619, -619, -639, -639, -650, -650,
+    -689, -689, -709, -709, -681, -681, -665, -665, -717, -717, -790, -790,
+    -828, -828, -850, -850, -884, -884, -903, -903, -895, -895, -901, -901,
+    -935, -935, -966, -966, -979, -979, -994, -994, -1012, -1012, -1035, -1035,
+    -1073, -1073, -1107, -1107, -1111, -1111, -1107, -1107, -1130, -1130, -1157, -1157,
+    -1140, -1140, -1102, -1102, -1099, -1099, -1141, -1141, -1181, -1181, -1185, -1185,
+    -1165, -1165, -1147, -1147, -1133, -1133, -1116, -1116, -1114, -1114, -1142, -1142,
+    -1163, -1163, -1138, -1138, -1089, -1089, -1066, -1066, -1080, -1080, -1098, -1098,
+    -1082, -1082, -1021, -1021, -959, -959, -955, -955, -987, -987, -976, -976,
+    -924, -924, -924, -924, -984, -984, -1005, -1005, -956, -956, -923, -923,
+    -936, -936, -921, -921, -855, -855, -812, -812, -825, -825, -828, -828,
+    -786, -786, -755, -755, -773, -773, -771, -771, -696, -696, -613, -613,
+    -600, -600, -613, -613, -576, -576, -528, -528, -532, -532, -538, -538,
+    -490, -490, -444, -444, -446, -446, -421, -421, -313, -313, -196, -196,
+    -156, -156, -166, -166, -171, -171, -159, -159, -143, -143, -135, -135,
+    -139, -139, -139, -139, -112, -112, -65, -65, -26, -26, -7, -7,
+    7, 7, 30, 30, 45, 45, 31, 31, 22, 22, 77, 77,
+    168, 168, 198, 198, 165, 165, 165, 165, 223, 223, 289, 289,
+    361, 361, 432, 432, 434, 434, 372, 372, 376, 376, 488, 488,
+    571, 571, 542, 542, 497, 497, 542, 542, 628, 628, 650, 650,
+    607, 607, 587, 587, 632, 632, 691, 691, 714, 714, 711, 711,
+    687, 687, 651, 651, 656, 656, 710, 710, 716, 716, 648, 648,
+    630, 630, 703, 703, 746, 746, 735, 735, 786, 786, 872, 872,
+    837, 837, 727, 727, 756, 756, 898, 898, 895, 895, 714, 714,
+    643, 643, 819, 819, 974, 974, 873, 873, 708, 708, 740, 740,
+    832, 832, 739, 739, 622, 622, 763, 763, 996, 996, 971, 971,
+    770, 770, 733, 733, 867, 867, 904, 904, 791, 791, 710, 710,
+    737, 737, 772, 772, 749, 749, 726, 726, 763, 763, 828, 828,
+    862, 862, 851, 851, 797, 797, 730, 730, 733, 733, 818, 818,
+    845, 845, 740, 740, 658, 658, 697, 697, 705, 705, 606, 606,
+    600, 600, 762, 762, 835, 835, 668, 668, 483, 483, 479, 479,
+    535, 535, 501, 501, 477, 477, 569, 569, 613, 613, 439, 439,
+    224, 224, 241, 241, 392, 392, 382, 382, 248, 248, 238, 238,
+    302, 302, 218, 218, 77, 77, 127, 127, 289, 289, 295, 295,
+    158, 158, 102, 102, 161, 161, 185, 185, 150, 150, 154, 154,
+    187, 187, 145, 145, 50, 50, 21, 21, 31, 31, -55, -55,
+    -173, -173, -124, -124, 44, 44, 77, 77, -41, -41, -75, -75,
+    25, 25, 61, 61, -46, -46, -158, -158, -183, -183, -158, -158,
+    -113, -113, -62, -62, -66, -66, -154, -154, -239, -239, -235, -235,
+    -197, -197, -223, -223, -272, -272, -245, -245, -204, -204, -279, -279,
+    -398, -398, -385, -385, -296, -296, -340, -340, -487, -487, -504, -504,
+    -368, -368, -301, -301, -394, -394, -502, -502, -529, -529, -547, -547,
+    -631, -631, -720, -720, -732, -732, -693, -693, -692, -692, -751, -751,
+    -806, -806, -808, -808, -771, -771, -744, -744, -758, -758, -796, -796,
+    -814, -814, -829, -829, -907, -907, -1009, -1009, -981, -981, -805, -805,
+    -676, -676, -722, -722, -825, -825, -859, -859, -888, -888, -984, -984,
+    -1049, -1049, -986, -986, -889, -889, -886, -886, -915, -915, -848, -848,
+    -739, -739, -736, -736, -818, -818, -832, -832, -765, -765, -745, -745,
+    -792, -792, -794, -794, -743, -743, -762, -762, -860, -860, -875, -875,
+    -752, -752, -662, -662, -742, -742, -872, -872, -875, -875, -780, -780,
+    -742, -742, -779, -779, -770, -770, -675, -675, -615, -615, -672, -672,
+    -752, -752, -740, -740, -685, -685, -683, -683, -688, -688, -618, -618,
+    -532, -532, -523, -523, -535, -535, -465, -465, -370, -370, -370, -370,
+    -427, -427, -400, -400, -291, -291, -255, -255, -316, -316, -312, -312,
+    -178, -178, -80, -80, -120, -120, -162, -162, -104, -104, -48, -48,
+    -76, -76, -96, -96, -58, -58, -51, -51, -85, -85, -49, -49,
+    45, 45, 24, 24, -123, -123, -166, -166, 2, 2, 162, 162,
+    119, 119, 46, 46, 187, 187, 409, 409, 407, 407, 227, 227,
+    190, 190, 362, 362, 486, 486, 417, 417, 319, 319, 368, 368,
+    507, 507, 553, 553, 445, 445, 325, 325, 352, 352, 497, 497,
+    596, 596, 602, 602, 622, 622, 692, 692, 692, 692, 557, 557,
+    445, 445, 524, 524, 699, 699, 748, 748, 672, 672, 655, 655,
+    699, 699, 634, 634, 500, 500, 539, 539, 747, 747, 836, 836,
+    712, 712, 598, 598, 631, 631, 698, 698, 716, 716, 766, 766,
+    855, 855, 851, 851, 744, 744, 717, 717, 832, 832, 906, 906,
+    843, 843, 819, 819, 924, 924, 949, 949, 776, 776, 642, 642,
+    722, 722, 826, 826, 780, 780, 739, 739, 857, 857, 968, 968,
+    881, 881, 730, 730, 741, 741, 847, 847, 834, 834, 743, 743,
+    792, 792, 944, 944, 942, 942, 769, 769, 689, 689, 798, 798,
+    894, 894, 827, 827, 674, 674, 578, 578, 606, 606, 718, 718,
+    776, 776, 678, 678, 542, 542, 574, 574, 735, 735, 741, 741,
+    517, 517, 391, 391, 582, 582, 761, 761, 537, 537, 176, 176,
+    247, 247, 655, 655, 751, 751, 394, 394, 158, 158, 342, 342,
+    526, 526, 356, 356, 143, 143, 272, 272, 517, 517, 445, 445,
+    176, 176, 156, 156, 368, 368, 369, 369, 69, 69, -143, -143,
+    -52, -52, 120, 120, 163, 163, 145, 145, 158, 158, 146, 146,
+    70, 70, -7, -7, -46, -46, -75, -75, -96, -96, -77, -77,
+    -55, -55, -106, -106, -184, -184, -158, -158, -41, -41, -7, -7,
+    -118, -118, -243, -243, -290, -290, -330, -330, -422, -422, -499, -499,
+    -507, -507, -485, -485, -484, -484, -510, -510, -562, -562, -630, -630,
+    -665, -665, -644, -644, -617, -617, -645, -645, -704, -704, -727, -727,
+    -714, -714, -731, -731, -801, -801, -875, -875, -916, -916, -941, -941,
+    -959, -959, -975, -975, -1019, -1019, -1103, -1103, -1149, -1149, -1078, -1078,
+    -960, -960, -944, -944, -1055, -1055, -1180, -1180, -1244, -1244, -1283, -1283,
+    -1326, -1326, -1323, -1323, -1238, -1238, -1127, -1127, -1079, -1079, -1097, -1097,
+    -1112, -1112, -1091, -1091, -1070, -1070, -1066, -1066, -1045, -1045, -1003, -1003,
+    -996, -996, -1043, -1043, -1075, -1075, -1043, -1043, -998, -998, -1004, -1004,
+    -1040, -1040, -1045, -1045, -1026, -1026, -1037, -1037, -1074, -1074, -1075, -1075,
+    -1034, -1034, -1022, -1022, -1060, -1060, -1072, -1072, -1021, -1021, -975, -975,
+    -982, -982, -986, -986, -934, -934, -865, -865, -827, -827, -812, -812,
+    -798, -798, -779, -779, -742, -742, -676, -676, -606, -606, -567, -567,
+    -558, -558, -542, -542, -492, -492, -422, -422, -368, -368, -345, -345,
+    -346, -346, -346, -346, -289, -289, -149, -149, -3, -3, 33, 33,
+    -31, -31, -88, -88, -98, -98, -98, -98, -91, -91, -47, -47,
+    2, 2, 10, 10, -9, -9, 0, 0, 68, 68, 177, 177,
+    281, 281, 328, 328, 307, 307, 272, 272, 299, 299, 384, 384,
+    441, 441, 435, 435, 435, 435, 504, 504, 592, 592, 631, 631,
+    641, 641, 662, 662, 673, 673, 679, 679, 738, 738, 837, 837,
+    878, 878, 840, 840, 810, 810, 810, 810, 775, 775, 727, 727,
+    765, 765, 860, 860, 872, 872, 793, 793, 771, 771, 836, 836,
+    844, 844, 745, 745, 693, 693, 783, 783, 893, 893, 912, 912,
+    917, 917, 970, 970, 955, 955, 810, 810, 709, 709, 788, 788,
+    919, 919, 952, 952, 937, 937, 958, 958, 966, 966, 927, 927,
+    909, 909, 935, 935, 942, 942, 917, 917, 932, 932, 1005, 1005,
+    1064, 1064, 1067, 1067, 1041, 1041, 989, 989, 898, 898, 861, 861,
+    995, 995, 1184, 1184, 1182, 1182, 1014, 1014, 941, 941, 1005, 1005,
+    1004, 1004, 928, 928, 947, 947, 1019, 1019, 962, 962, 879, 879,
+    1004, 1004, 1210, 1210, 1142, 1142, 849, 849, 764, 764, 977, 977,
+    1063, 1063, 826, 826, 660, 660, 832, 832, 987, 987, 797, 797,
+    554, 554, 594, 594, 685, 685, 528, 528, 363, 363, 509, 509,
+    738, 738, 647, 647, 372, 372, 353, 353, 601, 601, 701, 701,
+    511, 511, 329, 329, 323, 323, 300, 300, 155, 155, 83, 83,
+    188, 188, 273, 273, 192, 192, 79, 79, 82, 82, 142, 142,
+    140, 140, 81, 81, 23, 23, -34, -34, -114, -114, -199, -199,
+    -258, -258, -304, -304, -353, -353, -377, -377, -348, -348, -303, -303,
+    -294, -294, -318, -318, -352, -352, -404, -404, -482, -482, -556, -556,
+    -598, -598, -621, -621, -658, -658, -712, -712, -749, -749, -748, -748,
+    -738, -738, -766, -766, -832, -832, -891, -891, -914, -914, -931, -931,
+    -973, -973, -1022, -1022, -1047, -1047, -1063, -1063, -1122, -1122, -1239, -1239,
+    -1357, -1357, -1393, -1393, -1317, -1317, -1193, -1193, -1138, -1138, -1214, -1214,
+    -1373, -1373, -1514, -1514, -1593, -1593, -1637, -1637, -1677, -1677, -1716, -1716,
+    -1743, -1743, -1751, -1751, -1713, -1713, -1602, -1602, -1439, -1439, -1304, -1304,
+    -1258, -1258, -1272, -1272, -1275, -1275, -1243, -1243, -1204, -1204, -1174, -1174,
+    -1137, -1137, -1088, -1088, -1045, -1045, -1037, -1037, -1071, -1071, -1122, -1122,
+    -1158, -1158, -1176, -1176, -1190, -1190, -1187, -1187, -1147, -1147, -1097, -1097,
+    -1086, -1086, -1120, -1120, -1153, -1153, -1164, -1164, -1179, -1179, -1218, -1218,
+    -1252, -1252, -1245, -1245, -1219, -1219, -1209, -1209, -1187, -1187, -1106, -1106,
+    -992, -992, -916, -916, -884, -884, -838, -838, -757, -757, -679, -679,
+    -613, -613, -528, -528, -412, -412, -304, -304, -230, -230, -171, -171,
+    -101, -101, -33, -33, 12, 12, 52, 52, 112, 112, 163, 163,
+    157, 157, 115, 115, 106, 106, 157, 157, 228, 228, 279, 279,
+    305, 305, 315, 315, 316, 316, 331, 331, 385, 385, 459, 459,
+    512, 512, 538, 538, 577, 577, 639, 639, 675, 675, 654, 654,
+    627, 627, 653, 653, 703, 703, 728, 728, 771, 771, 897, 897,
+    1056, 1056, 1124, 1124, 1077, 1077, 1002, 1002, 954, 954, 918, 918,
+    908, 908, 973, 973, 1089, 1089, 1145, 1145, 1105, 1105, 1071, 1071,
+    1114, 1114, 1141, 1141, 1053, 1053, 941, 941, 944, 944, 1017, 1017,
+    1016, 1016, 944, 944, 925, 925, 971, 971, 976, 976, 918, 918,
+    894, 894, 953, 953, 1014, 1014, 1006, 1006, 976, 976, 995, 995,
+    1037, 1037, 1058, 1058, 1085, 1085, 1145, 1145, 1194, 1194, 1192, 1192,
+    1158, 1158, 1096, 1096, 1012, 1012, 977, 977, 1044, 1044, 1110, 1110,
+    1057, 1057, 969, 969, 1024, 1024, 1170, 1170, 1165, 1165, 991, 991,
+    950, 950, 1190, 1190, 1428, 1428, 1380, 1380, 1188, 1188, 1119, 1119,
+    1127, 1127, 1053, 1053, 1012, 1012, 1171, 1171, 1343, 1343, 1244, 1244,
+    992, 992, 953, 953, 1147, 1147, 1238, 1238, 1101, 1101, 966, 966,
+    976, 976, 995, 995, 952, 952, 965, 965, 1033, 1033, 971, 971,
+    787, 787, 715, 715, 797, 797, 797, 797, 626, 626, 495, 495,
+    505, 505, 482, 482, 360, 360, 372, 372, 608, 608, 762, 762,
+    579, 579, 261, 261, 131, 131, 165, 165, 155, 155, 87, 87,
+    75, 75, 102, 102, 82, 82, 41, 41, 39, 39, 49, 49,
+    48, 48, 81, 81, 123, 123, 48, 48, -127, -127, -191, -191,
+    -93, -93, -93, -93, -340, -340, -583, -583, -570, -570, -461, -461,
+    -526, -526, -684, -684, -696, -696, -599, -599, -619, -619, -774, -774,
+    -884, -884, -895, -895, -925, -925, -1007, -1007, -1041, -1041, -1031, -1031,
+    -1105, -1105, -1254, -1254, -1315, -1315, -1249, -1249, -1218, -1218, -1308, -1308,
+    -1419, -1419, -1466, -1466, -1499, -1499, -1575, -1575, -1665, -1665, -1726, -1726,
+    -1762, -1762, -1799, -1799, -1851, -1851, -1933, -1933, -2061, -2061, -2222, -2222,
+    -2353, -2353, -2423, -2423, -2465, -2465, -2498, -2498, -2469, -2469, -2343, -2343,
+    -2185, -2185, -2072, -2072, -1994, -1994, -1892, -1892, -1750, -1750, -1614, -1614,
+    -1534, -1534, -1500, -1500, -1445, -1445, -1337, -1337, -1214, -1214, -1125, -1125,
+    -1081, -1081, -1078, -1078, -1107, -1107, -1124, -1124, -1093, -1093, -1042, -1042,
+    -1027, -1027, -1054, -1054, -1081, -1081, -1081, -1081, -1081, -1081, -1118, -1118,
+    -1192, -1192, -1272, -1272, -1342, -1342, -1387, -1387, -1374, -1374, -1300, -1300,
+    -1214, -1214, -1145, -1145, -1058, -1058, -924, -924, -782, -782, -667, -667,
+    -571, -571, -480, -480, -396, -396, -294, -294, -131, -131, 83, 83,
+    270, 270, 375, 375, 440, 440, 528, 528, 621, 621, 658, 658,
+    644, 644, 648, 648, 687, 687, 715, 715, 705, 705, 690, 690,
+    690, 690, 672, 672, 601, 601, 499, 499, 430, 430, 411, 411,
+    396, 396, 344, 344, 287, 287, 295, 295, 379, 379, 475, 475,
+    519, 519, 517, 517, 505, 505, 504, 504, 522, 522, 588, 588,
+    719, 719, 878, 878, 1001, 1001, 1063, 1063, 1097, 1097, 1143, 1143,
+    1198, 1198, 1237, 1237, 1257, 1257, 1284, 1284, 1329, 1329, 1375, 1375,
+    1403, 1403, 1414, 1414, 1422, 1422, 1428, 1428, 1417, 1417, 1383, 1383,
+    1338, 1338, 1286, 1286, 1224, 1224, 1167, 1167, 1130, 1130, 1079, 1079,
+    973, 973, 852, 852, 802, 802, 830, 830, 858, 858, 850, 850,
+    844, 844, 865, 865, 876, 876, 875, 875, 942, 942, 1115, 1115,
+    1288, 1288, 1356, 1356, 1372, 1372, 1435, 1435, 1528, 1528, 1584, 1584,
+    1639, 1639, 1763, 1763, 1921, 1921, 2032, 2032, 2088, 2088, 2123, 2123,
+    2117, 2117, 2040, 2040, 1945, 1945, 1905, 1905, 1888, 1888, 1811, 1811,
+    1697, 1697, 1642, 1642, 1627, 1627, 1552, 1552, 1437, 1437, 1386, 1386,
+    1378, 1378, 1276, 1276, 1080, 1080, 955, 955, 997, 997, 1105, 1105,
+    1136, 1136, 1088, 1088, 1057, 1057, 1074, 1074, 1090, 1090, 1081, 1081,
+    1076, 1076, 1090, 1090, 1115, 1115, 1166, 1166, 1251, 1251, 1347, 1347,
+    1439, 1439, 1521, 1521, 1566, 1566, 1546, 1546, 1473, 1473, 1382, 1382,
+    1297, 1297, 1239, 1239, 1214, 1214, 1195, 1195, 1147, 1147, 1082, 1082,
+    1055, 1055, 1092, 1092, 1133, 1133, 1101, 1101, 1019, 1019, 991, 991,
+    1036, 1036, 1049, 1049, 981, 981, 902, 902, 871, 871, 849, 849,
+    776, 776, 656, 656, 542, 542, 469, 469, 444, 444, 467, 467,
+    537, 537, 616, 616, 655, 655, 663, 663, 686, 686, 708, 708,
+    671, 671, 572, 572, 444, 444, 275, 275, 55, 55, -152, -152,
+    -261, -261, -278, -278, -300, -300, -386, -386, -476, -476, -488, -488,
+    -452, -452, -474, -474, -590, -590, -754, -754, -931, -931, -1114, -1114,
+    -1292, -1292, -1475, -1475, -1698, -1698, -1940, -1940, -2125, -2125, -2224, -2224,
+    -2296, -2296, -2402, -2402, -2509, -2509, -2538, -2538, -2491, -2491, -2471, -2471,
+    -2547, -2547, -2680, -2680, -2828, -2828, -3036, -3036, -3359, -3359, -3764, -3764,
+    -4159, -4159, -4482, -4482, -4757, -4757, -5042, -5042, -5324, -5324, -5486, -5486,
+    -5462, -5462, -5383, -5383, -5497, -5497, -5944, -5944, -6666, -6666, -7487, -7487,
+    -8258, -8258, -8903, -8903, -9393, -9393, -9715, -9715, -9832, -9832, -9649, -9649,
+    -9049, -9049, -8062, -8062, -6923, -6923, -5877, -5877, -4940, -4940, -3948, -3948,
+    -2785, -2785, -1511, -1511, -273, -273, 830, 830, 1810, 1810, 2734, 2734,
+    3640, 3640, 4489, 4489, 5183, 5183, 5638, 5638, 5882, 5882, 6065, 6065,
+    6329, 6329, 6661, 6661, 6901, 6901, 6903, 6903, 6653, 6653, 6219, 6219,
+    5622, 5622, 4798, 4798, 3708, 3708, 2446, 2446, 1185, 1185, 69, 69,
+    -834, -834, -1512, -1512, -1994, -1994, -2321, -2321, -2507, -2507, -2550, -2550,
+    -2482, -2482, -2372, -2372, -2268, -2268, -2165, -2165, -2033, -2033, -1868, -1868,
+    -1681, -1681, -1479, -1479, -1282, -1282, -1121, -1121, -990, -990, -843, -843,
+    -671, -671, -524, -524, -421, -421, -284, -284, -51, -51, 209, 209,
+    353, 353, 310, 310, 119, 119, -178, -178, -572, -572, -1039, -1039,
+    -1526, -1526, -1982, -1982, -2351, -2351, -2541, -2541, -2466, -2466, -2155, -2155,
+    -1734, -1734, -1297, -1297, -810, -810, -206, -206, 485, 485, 1148, 1148,
+    1716, 1716, 2229, 2229, 2757, 2757, 3321, 3321, 3876, 3876, 4346, 4346,
+    4685, 4685, 4922, 4922, 5151, 5151, 5452, 5452, 5814, 5814, 6133, 6133,
+    6302, 6302, 6312, 6312, 6223, 6223, 6059, 6059, 5761, 5761, 5244, 5244,
+    4486, 4486, 3565, 3565, 2639, 2639, 1839, 1839, 1180, 1180, 607, 607,
+    109, 109, -256, -256, -443, -443, -492, -492, -502, -502, -542, -542,
+    -609, -609, -659, -659, -668, -668, -639, -639, -589, -589, -542, -542,
+    -478, -478, -333, -333, -79, -79, 230, 230, 527, 527, 783, 783,
+    1006, 1006, 1220, 1220, 1464, 1464, 1748, 1748, 2019, 2019, 2189, 2189,
+    2210, 2210, 2112, 2112, 1955, 1955, 1774, 1774, 1592, 1592, 1436, 1436,
+    1324, 1324, 1248, 1248, 1244, 1244, 1377, 1377, 1628, 1628, 1866, 1866,
+    2005, 2005, 2096, 2096, 2201, 2201, 2285, 2285, 2273, 2273, 2156, 2156,
+    1985, 1985, 1817, 1817, 1702, 1702, 1682, 1682, 1738, 1738, 1781, 1781,
+    1759, 1759, 1751, 1751, 1844, 1844, 1975, 1975, 2006, 2006, 1920, 1920,
+    1808, 1808, 1700, 1700, 1544, 1544, 1318, 1318, 1052, 1052, 768, 768,
+    472, 472, 204, 204, 27, 27, -57, -57, -121, -121, -204, -204,
+    -250, -250, -215, -215, -175, -175, -247, -247, -432, -432, -648, -648,
+    -847, -847, -1043, -1043, -1263, -1263, -1509, -1509, -1769, -1769, -2021, -2021,
+    -2231, -2231, -2366, -2366, -2449, -2449, -2555, -2555, -2704, -2704, -2825, -2825,
+    -2895, -2895, -3019, -3019, -3292, -3292, -3637, -3637, -3928, -3928, -4184, -4184,
+    -4531, -4531, -4980, -4980, -5404, -5404, -5747, -5747, -6111, -6111, -6542, -6542,
+    -6854, -6854, -6830, -6830, -6524, -6524, -6252, -6252, -6342, -6342, -6961, -6961,
+    -8060, -8060, -9362, -9362, -10490, -10490, -11242, -11242, -11686, -11686, -11929, -11929,
+    -11856, -11856, -11201, -11201, -9851, -9851, -8005, -8005, -6025, -6025, -4217, -4217,
+    -2722, -2722, -1454, -1454, -139, -139, 1454, 1454, 3260, 3260, 4983, 4983,
+    6409, 6409, 7572, 7572, 8601, 8601, 9512, 9512, 10189, 10189, 10528, 10528,
+    10563, 10563, 10440, 10440, 10308, 10308, 10221, 10221, 10104, 10104, 9784, 9784,
+    9083, 9083, 7912, 7912, 6310, 6310, 4403, 4403, 2337, 2337, 241, 241,
+    -1746, -1746, -3434, -3434, -4646, -4646, -5345, -5345, -5652, -5652, -5713, -5713,
+    -5607, -5607, -5387, -5387, -5137, -5137, -4939, -4939, -4820, -4820, -4731, -4731,
+    -4571, -4571, -4236, -4236, -3692, -3692, -3033, -3033, -2453, -2453, -2079, -2079,
+    -1854, -1854, -1620, -1620, -1322, -1322, -1057, -1057, -924, -924, -867, -867,
+    -723, -723, -415, -415, -74, -74, 61, 61, -155, -155, -686, -686,
+    -1389, -1389, -2113, -2113, -2718, -2718, -3077, -3077, -3118, -3118, -2843, -2843,
+    -2280, -2280, -1444, -1444, -396, -396, 708, 708, 1693, 1693, 2507, 2507,
+    3230, 3230, 3937, 3937, 4604, 4604, 5195, 5195, 5763, 5763, 6402, 6402,
+    7094, 7094, 7678, 7678, 7996, 7996, 8054, 8054, 7995, 7995, 7948, 7948,
+    7925, 7925, 7844, 7844, 7622, 7622, 7230, 7230, 6688, 6688, 6018, 6018,
+    5198, 5198, 4146, 4146, 2801, 2801, 1251, 1251, -260, -260, -1491, -1491,
+    -2352, -2352, -2888, -2888, -3166, -3166, -3239, -3239, -3182, -3182, -3090, -3090,
+    -3029, -3029, -3008, -3008, -3023, -3023, -3076, -3076, -3132, -3132, -3095, -3095,
+    -2869, -2869, -2436, -2436, -1868, -1868, -1269, -1269, -717, -717, -228, -228,
+    223, 223, 670, 670, 1132, 1132, 1606, 1606, 2058, 2058, 2437, 2437,
+    2718, 2718, 2915, 2915, 3032, 3032, 3014, 3014, 2809, 2809, 2454, 2454,
+    2087, 2087, 1847, 1847, 1793, 1793, 1917, 1917, 2185, 2185, 2541, 2541,
+    2899, 2899, 3198, 3198, 3419, 3419, 3533, 3533, 3492, 3492, 3292, 3292,
+    3014, 3014, 2774, 2774, 2639, 2639, 2594, 2594, 2576, 2576, 2537, 2537,
+    2482, 2482, 2443, 2443, 2417, 2417, 2345, 2345, 2185, 2185, 1972, 1972,
+    1783, 1783, 1626, 1626, 1432, 1432, 1160, 1160, 857, 857, 580, 580,
+    325, 325, 49, 49, -260, -260, -563, -563, -782, -782, -849, -849,
+    -760, -760, -577, -577, -379, -379, -204, -204, -58, -58, 44, 44,
+    61, 61, -42, -42, -258, -258, -545, -545, -828, -828, -1019, -1019,
+    -1075, -1075, -1042, -1042, -1021, -1021, -1074, -1074, -1197, -1197, -1358, -1358,
+    -1530, -1530, -1709, -1709, -1913, -1913, -2160, -2160, -2437, -2437, -2708, -2708,
+    -2958, -2958, -3218, -3218, -3532, -3532, -3908, -3908, -4307, -4307, -4674, -4674,
+    -4974, -4974, -5195, -5195, -5339, -5339, -5430, -5430, -5522, -5522, -5678, -5678,
+    -5871, -5871, -5919, -5919, -5645, -5645, -5180, -5180, -5010, -5010, -5566, -5566,
+    -6795, -6795, -8248, -8248, -9527, -9527, -10523, -10523, -11246, -11246, -11634, -11634,
+    -11547, -11547, -10851, -10851, -9469, -9469, -7482, -7482, -5217, -5217, -3096, -3096,
+    -1314, -1314, 251, 251, 1801, 1801, 3411, 3411, 5067, 5067, 6741, 6741,
+    8326, 8326, 9659, 9659, 10680, 10680, 11481, 11481, 12103, 12103, 12423, 12423,
+    12332, 12332, 11928, 11928, 11412, 11412, 10867, 10867, 10235, 10235, 9437, 9437,
+    8390, 8390, 6973, 6973, 5103, 5103, 2857, 2857, 439, 439, -1962, -1962,
+    -4204, -4204, -6135, -6135, -7609, -7609, -8560, -8560, -9022, -9022, -9064, -9064,
+    -8769, -8769, -8248, -8248, -7631, -7631, -7037, -7037, -6542, -6542, -6152, -6152,
+    -5774, -5774, -5264, -5264, -4544, -4544, -3696, -3696, -2901, -2901, -2291, -2291,
+    -1844, -1844, -1434, -1434, -975, -975, -517, -517, -182, -182, 3, 3,
+    165, 165, 431, 431, 757, 757, 958, 958, 894, 894, 559, 559,
+    37, 37, -568, -568, -1127, -1127, -1493, -1493, -1557, -1557, -1296, -1296,
+    -739, -739, 82, 82, 1138, 1138, 2362, 2362, 3637, 3637, 4812, 4812,
+    5747, 5747, 6399, 6399, 6860, 6860, 7284, 7284, 7761, 7761, 8230, 8230,
+    8540, 8540, 8585, 8585, 8385, 8385, 8035, 8035, 7601, 7601, 7068, 7068,
+    6402, 6402, 5613, 5613, 4752, 4752, 3877, 3877, 3007, 3007, 2116, 2116,
+    1132, 1132, -13, -13, -1315, -1315, -2668, -2668, -3928, -3928, -4980, -4980,
+    -5754, -5754, -6206, -6206, -6314, -6314, -6109, -6109, -5677, -5677, -5116, -5116,
+    -4510, -4510, -3916, -3916, -3356, -3356, -2827, -2827, -2316, -2316, -1800, -1800,
+    -1239, -1239, -604, -604, 72, 72, 702, 702, 1211, 1211, 1590, 1590,
+    1906, 1906, 2251, 2251, 2675, 2675, 3136, 3136, 3543, 3543, 3855, 3855,
+    4120, 4120, 4376, 4376, 4558, 4558, 4548, 4548, 4311, 4311, 3927, 3927,
+    3505, 3505, 3125, 3125, 2851, 2851, 2739, 2739, 2781, 2781, 2909, 2909,
+    3071, 3071, 3246, 3246, 3392, 3392, 3438, 3438, 3352, 3352, 3163, 3163,
+    2904, 2904, 2602, 2602, 2295, 2295, 2027, 2027, 1798, 1798, 1561, 1561,
+    1297, 1297, 1043, 1043, 838, 838, 661, 661, 471, 471, 276, 276,
+    142, 142, 121, 121, 183, 183, 228, 228, 171, 171, 11, 11,
+    -176, -176, -312, -312, -378, -378, -380, -380, -320, -320, -205, -205,
+    -48, -48, 158, 158, 425, 425, 719, 719, 956, 956, 1084, 1084,
+    1127, 1127, 1141, 1141, 1155, 1155, 1165, 1165, 1154, 1154, 1102, 1102,
+    998, 998, 851, 851, 671, 671, 446, 446, 156, 156, -179, -179,
+    -504, -504, -793, -793, -1063, -1063, -1331, -1331, -1591, -1591, -1865, -1865,
+    -2202, -2202, -2593, -2593, -2960, -2960, -3265, -3265, -3555, -3555, -3872, -3872,
+    -4173, -4173, -4381, -4381, -4498, -4498, -4593, -4593, -4715, -4715, -4839, -4839,
+    -4921, -4921, -4973, -4973, -5071, -5071, -5278, -5278, -5559, -5559, -5745, -5745,
+    -5614, -5614, -5110, -5110, -4524, -4524, -4396, -4396, -5110, -5110, -6546, -6546,
+    -8159, -8159, -9446, -9446, -10285, -10285, -10830, -10830, -11121, -11121, -10911, -10911,
+    -9886, -9886, -7968, -7968, -5422, -5422, -2732, -2732, -370, -370, 1460, 1460,
+    2931, 2931, 4373, 4373, 5945, 5945, 7539, 7539, 8992, 8992, 10254, 10254,
+    11339, 11339, 12192, 12192, 12709, 12709, 12833, 12833, 12579, 12579, 11997, 11997,
+    11155, 11155, 10170, 10170, 9155, 9155, 8122, 8122, 6956, 6956, 5479, 5479,
+    3558, 3558, 1201, 1201, -1403, -1403, -3999, -3999, -6395, -6395, -8475, -8475,
+    -10104, -10104, -11144, -11144, -11553, -11553, -11399, -11399, -10774, -10774, -9772, -9772,
+    -8561, -8561, -7367, -7367, -6354, -6354, -5550, -5550, -4892, -4892, -4293, -4293,
+    -3649, -3649, -2857, -2857, -1930, -1930, -1029, -1029, -316, -316, 198, 198,
+    608, 608, 961, 961, 1231, 1231, 1393, 1393, 1465, 1465, 1487, 1487,
+    1504, 1504, 1526, 1526, 1491, 1491, 1282, 1282, 829, 829, 193, 193,
+    -460, -460, -956, -956, -1179, -1179, -1070, -1070, -597, -597, 243, 243,
+    1384, 1384, 2701, 2701, 4065, 4065, 5379, 5379, 6568, 6568, 7532, 7532,
+    8151, 8151, 8367, 8367, 8260, 8260, 8008, 8008, 7743, 7743, 7446, 7446,
+    6994, 6994, 6266, 6266, 5252, 5252, 4086, 4086, 2970, 2970, 1999, 1999,
+    1090, 1090, 102, 102, -996, -996, -2106, -2106, -3120, -3120, -4015, -4015,
+    -4853, -4853, -5694, -5694, -6512, -6512, -7198, -7198, -7615, -7615, -7663, -7663,
+    -7307, -7307, -6574, -6574, -5531, -5531, -4287, -4287, -2986, -2986, -1765, -1765,
+    -673, -673, 305, 305, 1171, 1171, 1877, 1877, 2371, 2371, 2659, 2659,
+    2830, 2830, 3009, 3009, 3244, 3244, 3467, 3467, 3591, 3591, 3638, 3638,
+    3708, 3708, 3863, 3863, 4074, 4074, 4268, 4268, 4389, 4389, 4418, 4418,
+    4358, 4358, 4232, 4232, 4057, 4057, 3826, 3826, 3512, 3512, 3126, 3126,
+    2737, 2737, 2423, 2423, 2215, 2215, 2114, 2114, 2107, 2107, 2149, 2149,
+    2160, 2160, 2090, 2090, 1947, 1947, 1738, 1738, 1435, 1435, 1023, 1023,
+    535, 535, 44, 44, -378, -378, -683, -683, -862, -862, -934, -934,
+    -927, -927, -873, -873, -777, -777, -614, -614, -355, -355, -14, -14,
+    359, 359, 710, 710, 1022, 1022, 1316, 1316, 1605, 1605, 1849, 1849,
+    1996, 1996, 2060, 2060, 2113, 2113, 2190, 2190, 2263, 2263, 2305, 2305,
+    2325, 2325, 2336, 2336, 2330, 2330, 2279, 2279, 2162, 2162, 1977, 1977,
+    1728, 1728, 1407, 1407, 1015, 1015, 594, 594, 202, 202, -143, -143,
+    -456, -456, -733, -733, -957, -957, -1136, -1136, -1292, -1292, -1419, -1419,
+    -1495, -1495, -1533, -1533, -1610, -1610, -1774, -1774, -1972, -1972, -2126, -2126,
+    -2254, -2254, -2436, -2436, -2660, -2660, -2815, -2815, -2851, -2851, -2827, -2827,
+    -2826, -2826, -2888, -2888, -3030, -3030, -3220, -3220, -3366, -3366, -3427, -3427,
+    -3490, -3490, -3681, -3681, -3987, -3987, -4283, -4283, -4519, -4519, -4786, -4786,
+    -5106, -5106, -5289, -5289, -5104, -5104, -4595, -4595, -4135, -4135, -4171, -4171,
+    -4940, -4940, -6316, -6316, -7868, -7868, -9135, -9135, -9932, -9932, -10343, -10343,
+    -10392, -10392, -9840, -9840, -8371, -8371, -5945, -5945, -2935, -2935, 87, 87,
+    2683, 2683, 4737, 4737, 6390, 6390, 7827, 7827, 9141, 9141, 10333, 10333,
+    11371, 11371, 12214, 12214, 12770, 12770, 12895, 12895, 12503, 12503, 11653, 11653,
+    10512, 10512, 9223, 9223, 7850, 7850, 6400, 6400, 4883, 4883, 3359, 3359,
+    1893, 1893, 414, 414, -1320, -1320, -3491, -3491, -5978, -5978, -8395, -8395,
+    -10372, -10372, -11758, -11758, -12579, -12579, -12873, -12873, -12607, -12607, -11735, -11735,
+    -10299, -10299, -8465, -8465, -6491, -6491, -4657, -4657, -3170, -3170, -2087, -2087,
+    -1332, -1332, -767, -767, -240, -240, 356, 356, 1005, 1005, 1562, 1562,
+    1878, 1878, 1941, 1941, 1886, 1886, 1866, 1866, 1908, 1908, 1920, 1920,
+    1828, 1828, 1687, 1687, 1598, 1598, 1587, 1587, 1582, 1582, 1481, 1481,
+    1212, 1212, 801, 801, 400, 400, 203, 203, 331, 331, 816, 816,
+    1672, 1672, 2885, 2885, 4348, 4348, 5859, 5859, 7213, 7213, 8274, 8274,
+    8949, 8949, 9127, 9127, 8737, 8737, 7859, 7859, 6712, 6712, 5517, 5517,
+    4369, 4369, 3209, 3209, 1890, 1890, 327, 327, -1346, -1346, -2843, -2843,
+    -3983, -3983, -4844, -4844, -5614, -5614, -6372, -6372, -7049, -7049, -7522, -7522,
+    -7728, -7728, -7718, -7718, -7611, -7611, -7482, -7482, -7291, -7291, -6921, -6921,
+    -6266, -6266, -5276, -5276, -3955, -3955, -2362, -2362, -634, -634, 1046, 1046,
+    2544, 2544, 3806, 3806, 4779, 4779, 5379, 5379, 5590, 5590, 5520, 5520,
+    5314, 5314, 5067, 5067, 4810, 4810, 4517, 4517, 4123, 4123, 3634, 3634,
+    3184, 3184, 2906, 2906, 2780, 2780, 2685, 2685, 2557, 2557, 2440, 2440,
+    2401, 2401, 2448, 2448, 2525, 2525, 2555, 2555, 2475, 2475, 2278, 2278,
+    2020, 2020, 1759, 1759, 1496, 1496, 1230, 1230, 1042, 1042, 1030, 1030,
+    1146, 1146, 1211, 1211, 1101, 1101, 842, 842, 500, 500, 105, 105,
+    -342, -342, -833, -833, -1342, -1342, -1797, -1797, -2110, -2110, -2245, -2245,
+    -2226, -2226, -2074, -2074, -1772, -1772, -1307, -1307, -703, -703, -13, -13,
+    697, 697, 1372, 1372, 1990, 1990, 2568, 2568, 3127, 3127, 3640, 3640,
+    4025, 4025, 4232, 4232, 4291, 4291, 4263, 4263, 4180, 4180, 4071, 4071,
+    3959, 3959, 3814, 3814, 3578, 3578, 3251, 3251, 2869, 2869, 2409, 2409,
+    1812, 1812, 1104, 1104, 383, 383, -291, -291, -921, -921, -1497, -1497,
+    -1968, -1968, -2292, -2292, -2468, -2468, -2505, -2505, -2396, -2396, -2143, -2143,
+    -1789, -1789, -1399, -1399, -1020, -1020, -680, -680, -394, -394, -166, -166,
+    0, 0, 73, 73, 27, 27, -99, -99, -237, -237, -355, -355,
+    -457, -457, -553, -553, -665, -665, -825, -825, -1010, -1010, -1180, -1180,
+    -1374, -1374, -1682, -1682, -2123, -2123, -2616, -2616, -3086, -3086, -3508, -3508,
+    -3873, -3873, -4176, -4176, -4431, -4431, -4625, -4625, -4696, -4696, -4624, -4624,
+    -4547, -4547, -4618, -4618, -4690, -4690, -4348, -4348, -3421, -3421, -2369, -2369,
+    -1975, -1975, -2651, -2651, -4145, -4145, -5837, -5837, -7219, -7219, -8150, -8150,
+    -8746, -8746, -9025, -9025, -8699, -8699, -7387, -7387, -5042, -5042, -2095, -2095,
+    808, 808, 3196, 3196, 4952, 4952, 6245, 6245, 7323, 7323, 8341, 8341,
+    9305, 9305, 10144, 10144, 10778, 10778, 11115, 11115, 11034, 11034, 10466, 10466,
+    9503, 9503, 8342, 8342, 7104, 7104, 5782, 5782, 4374, 4374, 2957, 2957,
+    1602, 1602, 305, 305, -1029, -1029, -2581, -2581, -4510, -4510, -6750, -6750,
+    -8944, -8944, -10687, -10687, -11792, -11792, -12292, -12292, -12258, -12258, -11693, -11693,
+    -10573, -10573, -8940, -8940, -6959, -6959, -4888, -4888, -2978, -2978, -1386, -1386,
+    -178, -178, 641, 641, 1149, 1149, 1549, 1549, 2063, 2063, 2683, 2683,
+    3147, 3147, 3227, 3227, 2986, 2986, 2663, 2663, 2428, 2428, 2305, 2305,
+    2233, 2233, 2111, 2111, 1891, 1891, 1673, 1673, 1595, 1595, 1616, 1616,
+    1523, 1523, 1205, 1205, 783, 783, 459, 459, 339, 339, 471, 471,
+    928, 928, 1755, 1755, 2860, 2860, 4051, 4051, 5179, 5179, 6159, 6159,
+    6904, 6904, 7306, 7306, 7273, 7273, 6755, 6755, 5795, 5795, 4583, 4583,
+    3335, 3335, 2102, 2102, 764, 764, -757, -757, -2362, -2362, -3855, -3855,
+    -5065, -5065, -5911, -5911, -6449, -6449, -6824, -6824, -7126, -7126, -7289, -7289,
+    -7192, -7192, -6825, -6825, -6311, -6311, -5776, -5776, -5242, -5242, -4657, -4657,
+    -3973, -3973, -3154, -3154, -2155, -2155, -926, -926, 542, 542, 2155, 2155,
+    3689, 3689, 4901, 4901, 5722, 5722, 6279, 6279, 6665, 6665, 6784, 6784,
+    6515, 6515, 5912, 5912, 5146, 5146, 4343, 4343, 3553, 3553, 2791, 2791,
+    2023, 2023, 1206, 1206, 418, 418, -136, -136, -313, -313, -187, -187,
+    44, 44, 263, 263, 480, 480, 720, 720, 945, 945, 1102, 1102,
+    1158, 1158, 1099, 1099, 944, 944, 766, 766, 638, 638, 592, 592,
+    645, 645, 796, 796, 952, 952, 958, 958, 764, 764, 470, 470,
+    184, 184, -104, -104, -474, -474, -967, -967, -1512, -1512, -1948, -1948,
+    -2117, -2117, -1988, -1988, -1664, -1664, -1276, -1276, -858, -858, -350, -350,
+    295, 295, 1042, 1042, 1809, 1809, 2539, 2539, 3211, 3211, 3800, 3800,
+    4267, 4267, 4566, 4566, 4664, 4664, 4582, 4582, 4399, 4399, 4165, 4165,
+    3868, 3868, 3502, 3502, 3112, 3112, 2730, 2730, 2341, 2341, 1929, 1929,
+    1469, 1469, 901, 901, 202, 202, -527, -527, -1141, -1141, -1614, -1614,
+    -2028, -2028, -2404, -2404, -2651, -2651, -2692, -2692, -2552, -2552, -2294, -2294,
+    -1946, -1946, -1529, -1529, -1076, -1076, -586, -586, -42, -42, 495, 495,
+    907, 907, 1157, 1157, 1303, 1303, 1354, 1354, 1252, 1252, 1020, 1020,
+    759, 759, 500, 500, 188, 188, -181, -181, -545, -545, -895, -895,
+    -1271, -1271, -1666, -1666, -2033, -2033, -2370, -2370, -2700, -2700, -2991, -2991,
+    -3214, -3214, -3420, -3420, -3652, -3652, -3820, -3820, -3819, -3819, -3723, -3723,
+    -3680, -3680, -3649, -3649, -3485, -3485, -3272, -3272, -3269, -3269, -3458, -3458,
+    -3450, -3450, -2950, -2950, -2142, -2142, -1532, -1532, -1586, -1586, -2502, -2502,
+    -4109, -4109, -5912, -5912, -7400, -7400, -8413, -8413, -9087, -9087, -9415, -9415,
+    -9024, -9024, -7509, -7509, -4914, -4914, -1790, -1790, 1178, 1178, 3551, 3551,
+    5273, 5273, 6565, 6565, 7676, 7676, 8695, 8695, 9604, 9604, 10410, 10410,
+    11082, 11082, 11411, 11411, 11132, 11132, 10231, 10231, 8974, 8974, 7623, 7623,
+    6235, 6235, 4745, 4745, 3152, 3152, 1569, 1569, 134, 134, -1137, -1137,
+    -2429, -2429, -4021, -4021, -6011, -6011, -8156, -8156, -10023, -10023, -11313, -11313,
+    -11985, -11985, -12086, -12086, -11614, -11614, -10570, -10570, -9040, -9040, -7169, -7169,
+    -5108, -5108, -3037, -3037, -1169, -1169, 316, 316, 1336, 1336, 1948, 1948,
+    2344, 2344, 2738, 2738, 3202, 3202, 3605, 3605, 3751, 3751, 3563, 3563,
+    3136, 3136, 2651, 2651, 2250, 2250, 1954, 1954, 1709, 1709, 1486, 1486,
+    1343, 1343, 1344, 1344, 1449, 1449, 1515, 1515, 1428, 1428, 1204, 1204,
+    939, 939, 743, 743, 729, 729, 1020, 1020, 1663, 1663, 2582, 2582,
+    3636, 3636, 4691, 4691, 5615, 5615, 6288, 6288, 6636, 6636, 6626, 6626,
+    6205, 6205, 5336, 5336, 4096, 4096, 2697, 2697, 1347, 1347, 102, 102,
+    -1156, -1156, -2567, -2567, -4123, -4123, -5608, -5608, -6733, -6733, -7346, -7346,
+    -7550, -7550, -7572, -7572, -7521, -7521, -7285, -7285, -6716, -6716, -5847, -5847,
+    -4866, -4866, -3941, -3941, -3114, -3114, -2335, -2335, -1523, -1523, -593, -593,
+    522, 522, 1824, 1824, 3204, 3204, 4476, 4476, 5478, 5478, 6142, 6142,
+    6475, 6475, 6504, 6504, 6259, 6259, 5781, 5781, 5124, 5124, 4355, 4355,
+    3556, 3556, 2776, 2776, 1998, 1998, 1182, 1182, 354, 354, -376, -376,
+    -898, -898, -1173, -1173, -1225, -1225, -1075, -1075, -736, -736, -262, -262,
+    249, 249, 712, 712, 1094, 1094, 1370, 1370, 1516, 1516, 1533, 1533,
+    1449, 1449, 1295, 1295, 1103, 1103, 925, 925, 803, 803, 709, 709,
+    559, 559, 297, 297, -53, -53, -415, -415, -750, -750, -1069, -1069,
+    -1368, -1368, -1600, -1600, -1722, -1722, -1723, -1723, -1592, -1592, -1300, -1300,
+    -846, -846, -279, -279, 341, 341, 989, 989, 1657, 1657, 2328, 2328,
+    2985, 2985, 3618, 3618, 4201, 4201, 4657, 4657, 4912, 4912, 4958, 4958,
+    4838, 4838, 4558, 4558, 4097, 4097, 3502, 3502, 2897, 2897, 2360, 2360,
+    1866, 1866, 1357, 1357, 816, 816, 250, 250, -332, -332, -897, -897,
+    -1404, -1404, -1834, -1834, -2182, -2182, -2404, -2404, -2440, -2440, -2307, -2307,
+    -2091, -2091, -1840, -1840, -1513, -1513, -1077, -1077, -589, -589, -123, -123,
+    314, 314, 739, 739, 1121, 1121, 1424, 1424, 1670, 1670, 1883, 1883,
+    2014, 2014, 1985, 1985, 1778, 1778, 1427, 1427, 977, 977, 478, 478,
+    -3, -3, -427, -427, -833, -833, -1291, -1291, -1797, -1797, -2237, -2237,
+    -2517, -2517, -2670, -2670, -2815, -2815, -2998, -2998, -3136, -3136, -3141, -3141,
+    -3050, -3050, -2979, -2979, -2952, -2952, -2878, -2878, -2721, -2721, -2583, -2583,
+    -2547, -2547, -2518, -2518, -2389, -2389, -2277, -2277, -2423, -2423, -2803, -2803,
+    -3032, -3032, -2758, -2758, -2120, -2120, -1736, -1736, -2214, -2214, -3656, -3656,
+    -5598, -5598, -7395, -7395, -8689, -8689, -9523, -9523, -10039, -10039, -10094, -10094,
+    -9278, -9278, -7307, -7307, -4385, -4385, -1119, -1119, 1869, 1869, 4262, 4262,
+    6086, 6086, 7535, 7535, 8782, 8782, 9896, 9896, 10870, 10870, 11646, 11646,
+    12099, 12099, 12048, 12048, 11383, 11383, 10184, 10184, 8688, 8688, 7111, 7111,
+    5518, 5518, 3873, 3873, 2190, 2190, 588, 588, -834, -834, -2148, -2148,
+    -3583, -3583, -5331, -5331, -7339, -7339, -9307, -9307, -10876, -10876, -11834, -11834,
+    -12159, -12159, -11911, -11911, -11127, -11127, -9806, -9806, -7998, -7998, -5864, -5864,
+    -3645, -3645, -1576, -1576, 167, 167, 1458, 1458, 2245, 2245, 2623, 2623,
+    2815, 2815, 3019, 3019, 3246, 3246, 3351, 3351, 3214, 3214, 2863, 2863,
+    2425, 2425, 2003, 2003, 1623, 1623, 1289, 1289, 1051, 1051, 992, 992,
+    1140, 1140, 1418, 1418, 1687, 1687, 1843, 1843, 1858, 1858, 1761, 1761,
+    1625, 1625, 1582, 1582, 1773, 1773, 2268, 2268, 3041, 3041, 4011, 4011,
+    5047, 5047, 5966, 5966, 6586, 6586, 6822, 6822, 6666, 6666, 6080, 6080,
+    4997, 4997, 3475, 3475, 1758, 1758, 124, 124, -1309, -1309, -2619, -2619,
+    -3945, -3945, -5345, -5345, -6701, -6701, -7747, -7747, -8272, -8272, -8317, -8317,
+    -8120, -8120, -7831, -7831, -7361, -7361, -6539, -6539, -5363, -5363, -4025, -4025,
+    -2756, -2756, -1694, -1694, -854, -854, -123, -123, 685, 685, 1687, 1687,
+    2854, 2854, 4073, 4073, 5243, 5243, 6261, 6261, 6982, 6982, 7280, 7280,
+    7141, 7141, 6650, 6650, 5890, 5890, 4931, 4931, 3879, 3879, 2879, 2879,
+    2020, 2020, 1283, 1283, 591, 591, -92, -92, -718, -718, -1187, -1187,
+    -1409, -1409, -1355, -1355, -1074, -1074, -658, -658, -189, -189, 293, 293,
+    774, 774, 1205, 1205, 1482, 1482, 1504, 1504, 1278, 1278, 924, 924,
+    560, 560, 215, 215, -113, -113, -382, -382, -549, -549, -666, -666,
+    -843, -843, -1115, -1115, -1400, -1400, -1614, -1614, -1752, -1752, -1854, -1854,
+    -1926, -1926, -1920, -1920, -1763, -1763, -1389, -1389, -789, -789, -34, -34,
+    772, 772, 1577, 1577, 2386, 2386, 3187, 3187, 3920, 3920, 4523, 4523,
+    4963, 4963, 5221, 5221, 5280, 5280, 5155, 5155, 4868, 4868, 4414, 4414,
+    3787, 3787, 3043, 3043, 2288, 2288, 1588, 1588, 950, 950, 394, 394,
+    -40, -40, -358, -358, -643, -643, -948, -948, -1245, -1245, -1481, -1481,
+    -1651, -1651, -1763, -1763, -1806, -1806, -1773, -1773, -1676, -1676, -1497, -1497,
+    -1178, -1178, -717, -717, -205, -205, 263, 263, 684, 684, 1082, 1082,
+    1412, 1412, 1605, 1605, 1659, 1659, 1629, 1629, 1537, 1537, 1375, 1375,
+    1166, 1166, 954, 954, 755, 755, 563, 563, 388, 388, 230, 230,
+    43, 43, -198, -198, -424, -424, -553, -553, -601, -601, -667, -667,
+    -803, -803, -983, -983, -1175, -1175, -1392, -1392, -1642, -1642, -1905, -1905,
+    -2144, -2144, -2324, -2324, -2430, -2430, -2493, -2493, -2566, -2566, -2647, -2647,
+    -2681, -2681, -2674, -2674, -2731, -2731, -2906, -2906, -3114, -3114, -3254, -3254,
+    -3356, -3356, -3514, -3514, -3718, -3718, -3823, -3823, -3640, -3640, -3047, -3047,
+    -2183, -2183, -1591, -1591, -1945, -1945, -3388, -3388, -5276, -5276, -6790, -6790,
+    -7705, -7705, -8313, -8313, -8701, -8701, -8471, -8471, -7217, -7217, -4979, -4979,
+    -2154, -2154, 787, 787, 3409, 3409, 5409, 5409, 6803, 6803, 7897, 7897,
+    8959, 8959, 9995, 9995, 10863, 10863, 11433, 11433, 11556, 11556, 11056, 11056,
+    9911, 9911, 8362, 8362, 6718, 6718, 5131, 5131, 3602, 3602, 2128, 2128,
+    736, 736, -569, -569, -1824, -1824, -3126, -3126, -4632, -4632, -6431, -6431,
+    -8372, -8372, -10081, -10081, -11230, -11230, -11718, -11718, -11578, -11578, -10846, -10846,
+    -9569, -9569, -7865, -7865, -5882, -5882, -3753, -3753, -1652, -1652, 178, 178,
+    1517, 1517, 2294, 2294, 2607, 2607, 2666, 2666, 2704, 2704, 2834, 2834,
+    2943, 2943, 2781, 2781, 2248, 2248, 1544, 1544, 987, 987, 704, 704,
+    579, 579, 464, 464, 383, 383, 480, 480, 825, 825, 1314, 1314,
+    1767, 1767, 2075, 2075, 2241, 2241, 2317, 2317, 2375, 2375, 2526, 2526,
+    2895, 2895, 3537, 3537, 4374, 4374, 5235, 5235, 5931, 5931, 6320, 6320,
+    6336, 6336, 5993, 5993, 5317, 5317, 4292, 4292, 2900, 2900, 1239, 1239,
+    -467, -467, -2018, -2018, -3372, -3372, -4633, -4633, -5898, -5898, -7120, -7120,
+    -8084, -8084, -8538, -8538, -8400, -8400, -7832, -7832, -7071, -7071, -6218, -6218,
+    -5215, -5215, -4012, -4012, -2675, -2675, -1345, -1345, -160, -160, 783, 783,
+    1474, 1474, 2021, 2021, 2582, 2582, 3240, 3240, 3947, 3947, 4596, 4596,
+    5083, 5083, 5332, 5332, 5301, 5301, 5022, 5022, 4572, 4572, 4020, 4020,
+    3402, 3402, 2758, 2758, 2128, 2128, 1534, 1534, 984, 984, 508, 508,
+    159, 159, -39, -39, -100, -100, -45, -45, 132, 132, 458, 458,
+    926, 926, 1448, 1448, 1866, 1866, 2047, 2047, 1976, 1976, 1722, 1722,
+    1325, 1325, 776, 776, 90, 90, -653, -653, -1354, -1354, -1929, -1929,
+    -2307, -2307, -2468, -2468, -2493, -2493, -2506, -2506, -2538, -2538, -2510, -2510,
+    -2346, -2346, -2049, -2049, -1660, -1660, -1205, -1205, -717, -717, -219, -219,
+    328, 328, 984, 984, 1710, 1710, 2375, 2375, 2887, 2887, 3269, 3269,
+    3570, 3570, 3797, 3797, 3957, 3957, 4078, 4078, 4144, 4144, 4063, 4063,
+    3762, 3762, 3261, 3261, 2643, 2643, 1991, 1991, 1381, 1381, 863, 863,
+    443, 443, 102, 102, -135, -135, -224, -224, -196, -196, -147, -147,
+    -134, -134, -128, -128, -101, -101, -85, -85, -107, -107, -138, -138,
+    -144, -144, -143, -143, -182, -182, -267, -267, -356, -356, -402, -402,
+    -390, -390, -339, -339, -275, -275, -195, -195, -78, -78, 78, 78,
+    249, 249, 413, 413, 565, 565, 693, 693, 797, 797, 922, 922,
+    1118, 1118, 1345, 1345, 1487, 1487, 1500, 1500, 1458, 1458, 1427, 1427,
+    1356, 1356, 1170, 1170, 883, 883, 557, 557, 196, 196, -235, -235,
+    -712, -712, -1166, -1166, -1576, -1576, -1957, -1957, -2291, -2291, -2534, -2534,
+    -2684, -2684, -2781, -2781, -2832, -2832, -2802, -2802, -2676, -2676, -2490, -2490,
+    -2281, -2281, -2055, -2055, -1811, -1811, -1579, -1579, -1400, -1400, -1278, -1278,
+    -1187, -1187, -1128, -1128, -1157, -1157, -1307, -1307, -1494, -1494, -1584, -1584,
+    -1594, -1594, -1714, -1714, -2045, -2045, -2372, -2372, -2392, -2392, -2176, -2176,
+    -2239, -2239, -3039, -3039, -4488, -4488, -6057, -6057, -7270, -7270, -8003, -8003,
+    -8321, -8321, -8182, -8182, -7371, -7371, -5682, -5682, -3149, -3149, -142, -142,
+    2761, 2761, 5084, 5084, 6694, 6694, 7783, 7783, 8619, 8619, 9334, 9334,
+    9914, 9914, 10269, 10269, 10237, 10237, 9608, 9608, 8285, 8285, 6462, 6462,
+    4537, 4537, 2816, 2816, 1341, 1341, 33, 33, -1090, -1090, -1927, -1927,
+    -2474, -2474, -2892, -2892, -3407, -3407, -4163, -4163, -5142, -5142, -6145, -6145,
+    -6875, -6875, -7123, -7123, -6884, -6884, -6286, -6286, -5423, -5423, -4323, -4323,
+    -3025, -3025, -1608, -1608, -176, -176, 1109, 1109, 1996, 1996, 2250, 2250,
+    1851, 1851, 1049, 1049, 197, 197, -474, -474, -954, -954, -1397, -1397,
+    -1939, -1939, -2518, -2518, -2866, -2866, -2749, -2749, -2188, -2188, -1407, -1407,
+    -555, -555, 422, 422, 1646, 1646, 3090, 3090, 4528, 4528, 5643, 5643,
+    6214, 6214, 6251, 6251, 5989, 5989, 5717, 5717, 5580, 5580, 5549, 5549,
+    5505, 5505, 5349, 5349, 5022, 5022, 4511, 4511, 3815, 3815, 2895, 2895,
+    1685, 1685, 204, 204, -1378, -1378, -2821, -2821, -3977, -3977, -4841, -4841,
+    -5485, -5485, -5998, -5998, -6419, -6419, -6675, -6675, -6583, -6583, -6008, -6008,
+    -5033, -5033, -3889, -3889, -2740, -2740, -1596, -1596, -445, -445, 624, 624,
+    1458, 1458, 1946, 1946, 2047, 2047, 1781, 1781, 1271, 1271, 736, 736,
+    388, 388, 295, 295, 381, 381, 535, 535, 688, 688, 814, 814,
+    925, 925, 1076, 1076, 1327, 1327, 1670, 1670, 2023, 2023, 2324, 2324,
+    2587, 2587, 2855, 2855, 3120, 3120, 3319, 3319, 3422, 3422, 3456, 3456,
+    3481, 3481, 3537, 3537, 3611, 3611, 3625, 3625, 3456, 3456, 3008, 3008,
+    2289, 2289, 1401, 1401, 454, 454, -508, -508, -1500, -1500, -2525, -2525,
+    -3515, -3515, -4324, -4324, -4802, -4802, -4895, -4895, -4665, -4665, -4227, -4227,
+    -3679, -3679, -3067, -3067, -2393, -2393, -1645, -1645, -857, -857, -148, -148,
+    364, 364, 690, 690, 983, 983, 1369, 1369, 1821, 1821, 2205, 2205,
+    2413, 2413, 2429, 2429, 2319, 2319, 2205, 2205, 2204, 2204, 2335, 2335,
+    2500, 2500, 2595, 2595, 2599, 2599, 2538, 2538, 2413, 2413, 2224, 2224,
+    2014, 2014, 1831, 1831, 1684, 1684, 1584, 1584, 1577, 1577, 1682, 1682,
+    1814, 1814, 1849, 1849, 1741, 1741, 1538, 1538, 1289, 1289, 1009, 1009,
+    702, 702, 370, 370, -8, -8, -453, -453, -932, -932, -1365, -1365,
+    -1696, -1696, -1916, -1916, -2033, -2033, -2045, -2045, -1962, -1962, -1807, -1807,
+    -1578, -1578, -1227, -1227, -729, -729, -150, -150, 383, 383, 806, 806,
+    1160, 1160, 1504, 1504, 1798, 1798, 1938, 1938, 1893, 1893, 1748, 1748,
+    1609, 1609, 1506, 1506, 1418, 1418, 1313, 1313, 1157, 1157, 913, 913,
+    596, 596, 262, 262, -66, -66, -420, -420, -808, -808, -1165, -1165,
+    -1431, -1431, -1610, -1610, -1725, -1725, -1767, -1767, -1742, -1742, -1717, -1717,
+    -1735, -1735, -1744, -1744, -1663, -1663, -1511, -1511, -1395, -1395, -1392, -1392,
+    -1486, -1486, -1633, -1633, -1827, -1827, -2090, -2090, -2400, -2400, -2665, -2665,
+    -2792, -2792, -2795, -2795, -2778, -2778, -2780, -2780, -2724, -2724, -2585, -2585,
+    -2512, -2512, -2621, -2621, -2721, -2721, -2452, -2452, -1753, -1753, -1060, -1060,
+    -971, -971, -1786, -1786, -3335, -3335, -5126, -5126, -6617, -6617, -7497, -7497,
+    -7767, -7767, -7489, -7489, -6486, -6486, -4491, -4491, -1606, -1606, 1544, 1544,
+    4242, 4242, 6159, 6159, 7379, 7379, 8148, 8148, 8697, 8697, 9156, 9156,
+    9443, 9443, 9292, 9292, 8511, 8511, 7171, 7171, 5509, 5509, 3729, 3729,
+    1992, 1992, 490, 490, -619, -619, -1323, -1323, -1724, -1724, -1934, -1934,
+    -2067, -2067, -2275, -2275, -2674, -2674, -3242, -3242, -3852, -3852, -4361, -4361,
+    -4643, -4643, -4603, -4603, -4242, -4242, -3674, -3674, -3009, -3009, -2243, -2243,
+    -1344, -1344, -398, -398, 386, 386, 809, 809, 753, 753, 196, 196,
+    -732, -732, -1727, -1727, -2479, -2479, -2912, -2912, -3205, -3205, -3523, -3523,
+    -3782, -3782, -3725, -3725, -3195, -3195, -2263, -2263, -1112, -1112, 145, 145,
+    1516, 1516, 3037, 3037, 4638, 4638, 6089, 6089, 7069, 7069, 7363, 7363,
+    7024, 7024, 6345, 6345, 5647, 5647, 5093, 5093, 4688, 4688, 4382, 4382,
+    4105, 4105, 3744, 3744, 3183, 3183, 2399, 2399, 1465, 1465, 452, 452,
+    -618, -618, -1704, -1704, -2675, -2675, -3380, -3380, -3769, -3769, -3928, -3928,
+    -3991, -3991, -4014, -4014, -3941, -3941, -3665, -3665, -3134, -3134, -2412, -2412,
+    -1640, -1640, -947, -947, -395, -395, -1, -1, 214, 214, 194, 194,
+    -108, -108, -665, -665, -1338, -1338, -1932, -1932, -2294, -2294, -2383, -2383,
+    -2237, -2237, -1926, -1926, -1510, -1510, -1020, -1020, -457, -457, 181, 181,
+    871, 871, 1567, 1567, 2256, 2256, 2957, 2957, 3655, 3655, 4265, 4265,
+    4680, 4680, 4854, 4854, 4830, 4830, 4693, 4693, 4501, 4501, 4253, 4253,
+    3931, 3931, 3544, 3544, 3126, 3126, 2662, 2662, 2065, 2065, 1265, 1265,
+    323, 323, -610, -610, -1425, -1425, -2121, -2121, -2723, -2723, -3192, -3192,
+    -3447, -3447, -3441, -3441, -3206, -3206, -2833, -2833, -2412, -2412, -2002, -2002,
+    -1622, -1622, -1279, -1279, -988, -988, -768, -768, -629, -629, -569, -569,
+    -565, -565, -568, -568, -533, -533, -473, -473, -438, -438, -432, -432,
+    -376, -376, -177, -177, 179, 179, 631, 631, 1119, 1119, 1616, 1616,
+    2107, 2107, 2570, 2570, 2964, 2964, 3240, 3240, 3374, 3374, 3408, 3408,
+    3434, 3434, 3507, 3507, 3587, 3587, 3587, 3587, 3457, 3457, 3205, 3205,
+    2867, 2867, 2464, 2464, 1997, 1997, 1462, 1462, 877, 877, 302, 302,
+    -183, -183, -541, -541, -789, -789, -969, -969, -1096, -1096, -1157, -1157,
+    -1141, -1141, -1056, -1056, -928, -928, -788, -788, -656, -656, -542, -542,
+    -455, -455, -392, -392, -340, -340, -289, -289, -261, -261, -281, -281,
+    -320, -320, -304, -304, -192, -192, -15, -15, 172, 172, 336, 336,
+    459, 459, 535, 535, 579, 579, 612, 612, 628, 628, 626, 626,
+    652, 652, 750, 750, 870, 870, 906, 906, 837, 837, 749, 749,
+    688, 688, 589, 589, 385, 385, 100, 100, -210, -210, -540, -540,
+    -891, -891, -1220, -1220, -1506, -1506, -1799, -1799, -2141, -2141, -2473, -2473,
+    -2695, -2695, -2788, -2788, -2816, -2816, -2843, -2843, -2876, -2876, -2881, -2881,
+    -2839, -2839, -2768, -2768, -2703, -2703, -2635, -2635, -2507, -2507, -2333, -2333,
+    -2264, -2264, -2428, -2428, -2694, -2694, -2700, -2700, -2200, -2200, -1380, -1380,
+    -808, -808, -1055, -1055, -2291, -2291, -4135, -4135, -5921, -5921, -7170, -7170,
+    -7803, -7803, -7873, -7873, -7208, -7208, -5500, -5500, -2751, -2751, 529, 529,
+    3596, 3596, 5893, 5893, 7260, 7260, 7914, 7914, 8263, 8263, 8596, 8596,
+    8851, 8851, 8718, 8718, 7985, 7985, 6701, 6701, 5055, 5055, 3232, 3232,
+    1437, 1437, -90, -90, -1168, -1168, -1732, -1732, -1812, -1812, -1516, -1516,
+    -1081, -1081, -808, -808, -866, -866, -1200, -1200, -1651, -1651, -2088, -2088,
+    -2408, -2408, -2523, -2523, -2420, -2420, -2179, -2179, -1886, -1886, -1550, -1550,
+    -1155, -1155, -736, -736, -389, -389, -243, -243, -452, -452, -1120, -1120,
+    -2164, -2164, -3291, -3291, -4179, -4179, -4690, -4690, -4883, -4883, -4854, -4854,
+    -4599, -4599, -4037, -4037, -3122, -3122, -1926, -1926, -616, -616, 682, 682,
+    1989, 1989, 3420, 3420, 4965, 4965, 6346, 6346, 7159, 7159, 7180, 7180,
+    6527, 6527, 5523, 5523, 4473, 4473, 3563, 3563, 2889, 2889, 2471, 2471,
+    2238, 2238, 2083, 2083, 1929, 1929, 1722, 1722, 1372, 1372, 804, 804,
+    95, 95, -526, -526, -852, -852, -870, -870, -745, -745, -684, -684,
+    -796, -796, -1040, -1040, -1267, -1267, -1342, -1342, -1266, -1266, -1145, -1145,
+    -1057, -1057, -1007, -1007, -1001, -1001, -1104, -1104, -1399, -1399, -1919, -1919,
+    -2632, -2632, -3433, -3433, -4130, -4130, -4515, -4515, -4482, -4482, -4084, -4084,
+    -3450, -3450, -2694, -2694, -1890, -1890, -1071, -1071, -226, -226, 659, 659,
+    1538, 1538, 2327, 2327, 2979, 2979, 3476, 3476, 3781, 3781, 3851, 3851,
+    3701, 3701, 3418, 3418, 3093, 3093, 2789, 2789, 2553, 2553, 2410, 2410,
+    2348, 2348, 2333, 2333, 2328, 2328, 2277, 2277, 2109, 2109, 1824, 1824,
+    1528, 1528, 1301, 1301, 1092, 1092, 785, 785, 350, 350, -138, -138,
+    -578, -578, -877, -877, -978, -978, -947, -947, -975, -975, -1176, -1176,
+    -1453, -1453, -1648, -1648, -1788, -1788, -2037, -2037, -2438, -2438, -2822, -2822,
+    -2993, -2993, -2894, -2894, -2599, -2599, -2234, -2234, -1899, -1899, -1594, -1594,
+    -1205, -1205, -628, -628, 96, 96, 826, 826, 1454, 1454, 1949, 1949,
+    2299, 2299, 2495, 2495, 2574, 2574, 2591, 2591, 2562, 2562, 2485, 2485,
+    2396, 2396, 2354, 2354, 2366, 2366, 2396, 2396, 2422, 2422, 2434, 2434,
+    2420, 2420, 2377, 2377, 2348, 2348, 2362, 2362, 2386, 2386, 2349, 2349,
+    2220, 2220, 2022, 2022, 1796, 1796, 1573, 1573, 1360, 1360, 1139, 1139,
+    884, 884, 598, 598, 302, 302, 0, 0, -315, -315, -611, -611,
+    -841, -841, -1014, -1014, -1183, -1183, -1338, -1338, -1408, -1408, -1366, -1366,
+    -1277, -1277, -1197, -1197, -1088, -1088, -878, -878, -561, -561, -202, -202,
+    122, 122, 349, 349, 457, 457, 482, 482, 477, 477, 450, 450,
+    371, 371, 250, 250, 145, 145, 87, 87, 48, 48, 4, 4,
+    -17, -17, 4, 4, 34, 34, 28, 28, -9, -9, -53, -53,
+    -104, -104, -185, -185, -300, -300, -439, -439, -612, -612, -848, -848,
+    -1152, -1152, -1481, -1481, -1772, -1772, -1999, -1999, -2192, -2192, -2402, -2402,
+    -2628, -2628, -2798, -2798, -2854, -2854, -2829, -2829, -2822, -2822, -2869, -2869,
+    -2881, -2881, -2759, -2759, -2562, -2562, -2489, -2489, -2641, -2641, -2822, -2822,
+    -2659, -2659, -2023, -2023, -1282, -1282, -1086, -1086, -1833, -1833, -3346, -3346,
+    -5065, -5065, -6486, -6486, -7401, -7401, -7769, -7769, -7464, -7464, -6245, -6245,
+    -3987, -3987, -948, -948, 2228, 2228, 4832, 4832, 6487, 6487, 7300, 7300,
+    7670, 7670, 7922, 7922, 8076, 8076, 7909, 7909, 7200, 7200, 5937, 5937,
+    4319, 4319, 2628, 2628, 1099, 1099, -128, -128, -985, -985, -1423, -1423,
+    -1414, -1414, -1016, -1016, -432, -432, 53, 53, 248, 248, 155, 155,
+    -94, -94, -371, -371, -605, -605, -768, -768, -860, -860, -892, -892,
+    -869, -869, -792, -792, -693, -693, -640, -640, -686, -686, -884, -884,
+    -1325, -1325, -2102, -2102, -3149, -3149, -4209, -4209, -5002, -5002, -5421, -5421,
+    -5503, -5503, -5289, -5289, -4778, -4778, -3971, -3971, -2900, -2900, -1633, -1633,
+    -292, -292, 989, 989, 2178, 2178, 3346, 3346, 4473, 4473, 5312, 5312,
+    5569, 5569, 5177, 5177, 4333, 4333, 3316, 3316, 2359, 2359, 1636, 1636,
+    1222, 1222, 1045, 1045, 968, 968, 943, 943, 1001, 1001, 1129, 1129,
+    1237, 1237, 1273, 1273, 1272, 1272, 1295, 1295, 1388, 1388, 1568, 1568,
+    1776, 1776, 1836, 1836, 1582, 1582, 1050, 1050, 459, 459, 3, 3,
+    -302, -302, -546, -546, -813, -813, -1139, -1139, -1532, -1532, -1969, -1969,
+    -2433, -2433, -2951, -2951, -3539, -3539, -4096, -4096, -4409, -4409, -4314, -4314,
+    -3832, -3832, -3127, -3127, -2359, -2359, -1600, -1600, -862, -862, -159, -159,
+    474, 474, 998, 998, 1402, 1402, 1694, 1694, 1870, 1870, 1910, 1910,
+    1808, 1808, 1583, 1583, 1271, 1271, 927, 927, 665, 665, 620, 620,
+    850, 850, 1274, 1274, 1744, 1744, 2167, 2167, 2522, 2522, 2800, 2800,
+    2970, 2970, 3014, 3014, 2945, 2945, 2780, 2780, 2533, 2533, 2222, 2222,
+    1862, 1862, 1448, 1448, 976, 976, 490, 490, 55, 55, -319, -319,
+    -702, -702, -1146, -1146, -1600, -1600, -1957, -1957, -2176, -2176, -2303, -2303,
+    -2368, -2368, -2327, -2327, -2132, -2132, -1807, -1807, -1437, -1437, -1078, -1078,
+    -734, -734, -401, -401, -94, -94, 172, 172, 396, 396, 566, 566,
+    654, 654, 642, 642, 554, 554, 454, 454, 410, 410, 468, 468,
+    633, 633, 878, 878, 1192, 1192, 1595, 1595, 2083, 2083, 2572, 2572,
+    2942, 2942, 3138, 3138, 3213, 3213, 3251, 3251, 3285, 3285, 3291, 3291,
+    3239, 3239, 3110, 3110, 2901, 2901, 2633, 2633, 2334, 2334, 2005, 2005,
+    1621, 1621, 1185, 1185, 767, 767, 442, 442, 200, 200, -28, -28,
+    -264, -264, -462, -462, -577, -577, -630, -630, -663, -663, -676, -676,
+    -639, -639, -555, -555, -465, -465, -400, -400, -361, -361, -350, -350,
+    -382, -382, -475, -475, -626, -626, -806, -806, -969, -969, -1077, -1077,
+    -1134, -1134, -1174, -1174, -1206, -1206, -1190, -1190, -1088, -1088, -918, -918,
+    -726, -726, -521, -521, -283, -283, -31, -31, 173, 173, 300, 300,
+    388, 388, 464, 464, 467, 467, 316, 316, 22, 22, -314, -314,
+    -612, -612, -890, -890, -1196, -1196, -1530, -1530, -1831, -1831, -2039, -2039,
+    -2133, -2133, -2142, -2142, -2139, -2139, -2191, -2191, -2297, -2297, -2397, -2397,
+    -2472, -2472, -2562, -2562, -2666, -2666, -2707, -2707, -2685, -2685, -2764, -2764,
+    -3043, -3043, -3274, -3274, -3045, -3045, -2331, -2331, -1688, -1688, -1775, -1775,
+    -2758, -2758, -4273, -4273, -5809, -5809, -6997, -6997, -7621, -7621, -7559, -7559,
+    -6725, -6725, -5017, -5017, -2422, -2422, 719, 719, 3671, 3671, 5746, 5746,
+    6800, 6800, 7188, 7188, 7305, 7305, 7297, 7297, 7130, 7130, 6668, 6668,
+    5711, 5711, 4189, 4189, 2382, 2382, 771, 771, -381, -381, -1128, -1128,
+    -1514, -1514, -1389, -1389, -656, -656, 453, 453, 1517, 1517, 2233, 2233,
+    2511, 2511, 2396, 2396, 2016, 2016, 1548, 1548, 1105, 1105, 688, 688,
+    279, 279, -98, -98, -447, -447, -842, -842, -1330, -1330, -1865, -1865,
+    -2410, -2410, -3036, -3036, -3805, -3805, -4604, -4604, -5190, -5190, -5400, -5400,
+    -5266, -5266, -4926, -4926, -4471, -4471, -3889, -3889, -3120, -3120, -2154, -2154,
+    -1070, -1070, 6, 6, 972, 972, 1788, 1788, 2436, 2436, 2875, 2875,
+    3015, 3015, 2753, 2753, 2071, 2071, 1113, 1113, 158, 158, -529, -529,
+    -816, -816, -707, -707, -284, -284, 334, 334, 1022, 1022, 1702, 1702,
+    2345, 2345, 2920, 2920, 3369, 3369, 3656, 3656, 3799, 3799, 3836, 3836,
+    3778, 3778, 3612, 3612, 3321, 3321, 2873, 2873, 2246, 2246, 1484, 1484,
+    698, 698, -17, -17, -620, -620, -1088, -1088, -1408, -1408, -1608, -1608,
+    -1753, -1753, -1871, -1871, -1947, -1947, -1981, -1981, -2007, -2007, -2015, -2015,
+    -1913, -1913, -1633, -1633, -1229, -1229, -842, -842, -587, -587, -509, -509,
+    -595, -595, -812, -812, -1111, -1111, -1433, -1433, -1714, -1714, -1889, -1889,
+    -1923, -1923, -1824, -1824, -1621, -1621, -1340, -1340, -1000, -1000, -610, -610,
+    -149, -149, 405, 405, 1012, 1012, 1579, 1579, 2041, 2041, 2380, 2380,
+    2569, 2569, 2558, 2558, 2377, 2377, 2166, 2166, 2028, 2028, 1922, 1922,
+    1765, 1765, 1582, 1582, 1459, 1459, 1411, 1411, 1372, 1372, 1287, 1287,
+    1140, 1140, 933, 933, 714, 714, 604, 604, 693, 693, 928, 928,
+    1164, 1164, 1316, 1316, 1410, 1410, 1483, 1483, 1507, 1507, 1410, 1410,
+    1144, 1144, 730, 730, 270, 270, -103, -103, -327, -327, -455, -455,
+    -571, -571, -686, -686, -732, -732, -650, -650, -448, -448, -184, -184,
+    93, 93, 387, 387, 721, 721, 1066, 1066, 1321, 1321, 1413, 1413,
+    1369, 1369, 1284, 1284, 1212, 1212, 1153, 1153, 1110, 1110, 1100, 1100,
+    1111, 1111, 1116, 1116, 1121, 1121, 1151, 1151, 1201, 1201, 1251, 1251,
+    1305, 1305, 1374, 1374, 1438, 1438, 1470, 1470, 1493, 1493, 1528, 1528,
+    1536, 1536, 1469, 1469, 1362, 1362, 1285, 1285, 1231, 1231, 1131, 1131,
+    969, 969, 804, 804, 671, 671, 535, 535, 365, 365, 193, 193,
+    74, 74, 23, 23, 17, 17, 13, 13, -10, -10, -24, -24,
+    19, 19, 84, 84, 65, 65, -92, -92, -306, -306, -480, -480,
+    -625, -625, -809, -809, -1026, -1026, -1218, -1218, -1377, -1377, -1536, -1536,
+    -1662, -1662, -1685, -1685, -1621, -1621, -1592, -1592, -1680, -1680, -1834, -1834,
+    -1950, -1950, -1984, -1984, -1979, -1979, -1992, -1992, -2043, -2043, -2098, -2098,
+    -2104, -2104, -2043, -2043, -1959, -1959, -1922, -1922, -1964, -1964, -2054, -2054,
+    -2144, -2144, -2233, -2233, -2391, -2391, -2667, -2667, -2998, -2998, -3255, -3255,
+    -3404, -3404, -3509, -3509, -3523, -3523, -3227, -3227, -2563, -2563, -1946, -1946,
+    -2017, -2017, -3009, -3009, -4515, -4515, -5916, -5916, -6845, -6845, -7169, -7169,
+    -6746, -6746, -5442, -5442, -3320, -3320, -685, -685, 2015, 2015, 4261, 4261,
+    5603, 5603, 5950, 5950, 5687, 5687, 5323, 5323, 5011, 5011, 4540, 4540,
+    3736, 3736, 2702, 2702, 1643, 1643, 686, 686, -65, -65, -459, -459,
+    -407, -407, 41, 41, 819, 819, 1924, 1924, 3234, 3234, 4356, 4356,
+    4849, 4849, 4622, 4622, 3980, 3980, 3265, 3265, 2587, 2587, 1917, 1917,
+    1306, 1306, 862, 862, 571, 571, 276, 276, -173, -173, -809, -809,
+    -1557, -1557, -2310, -2310, -2957, -2957, -3407, -3407, -3626, -3626, -3631, -3631,
+    -3460, -3460, -3150, -3150, -2759, -2759, -2346, -2346, -1936, -1936, -1498, -1498,
+    -1013, -1013, -551, -551, -241, -241, -180, -180, -362, -362, -699, -699,
+    -1102, -1102, -1536, -1536, -1987, -1987, -2395, -2395, -2631, -2631, -2578, -2578,
+    -2225, -2225, -1659, -1659, -985, -985, -260, -260, 485, 485, 1220, 1220,
+    1919, 1919, 2550, 2550, 3025, 3025, 3222, 3222, 3099, 3099, 2765, 2765,
+    2396, 2396, 2086, 2086, 1822, 1822, 1591, 1591, 1434, 1434, 1375, 1375,
+    1375, 1375, 1389, 1389, 1414, 1414, 1463, 1463, 1522, 1522, 1583, 1583,
+    1669, 1669, 1779, 1779, 1855, 1855, 1829, 1829, 1699, 1699, 1496, 1496,
+    1225, 1225, 894, 894, 556, 556, 272, 272, 22, 22, -262, -262,
+    -596, -596, -927, -927, -1219, -1219, -1476, -1476, -1689, -1689, -1809, -1809,
+    -1806, -1806, -1709, -1709, -1550, -1550, -1321, -1321, -1016, -1016, -698, -698,
+    -460, -460, -354, -354, -358, -358, -426, -426, -519, -519, -602, -602,
+    -644, -644, -648, -648, -645, -645, -657, -657, -657, -657, -591, -591,
+    -431, -431, -174, -174, 177, 177, 623, 623, 1121, 1121, 1582, 1582,
+    1928, 1928, 2144, 2144, 2252, 2252, 2252, 2252, 2133, 2133, 1936, 1936,
+    1750, 1750, 1642, 1642, 1603, 1603, 1577, 1577, 1516, 1516, 1417, 1417,
+    1319, 1319, 1285, 1285, 1357, 1357, 1515, 1515, 1682, 1682, 1791, 1791,
+    1824, 1824, 1805, 1805, 1758, 1758, 1676, 1676, 1534, 1534, 1327, 1327,
+    1109, 1109, 958, 958, 911, 911, 930, 930, 939, 939, 890, 890,
+    782, 782, 658, 658, 575, 575, 569, 569, 620, 620, 687, 687,
+    756, 756, 839, 839, 916, 916, 935, 935, 879, 879, 786, 786,
+    683, 683, 553, 553, 391, 391, 245, 245, 145, 145, 63, 63,
+    -28, -28, -75, -75, -8, -8, 162, 162, 367, 367, 579, 579,
+    816, 816, 1056, 1056, 1235, 1235, 1322, 1322, 1355, 1355, 1366, 1366,
+    1325, 1325, 1199, 1199, 1007, 1007, 804, 804, 614, 614, 413, 413,
+    184, 184, -54, -54, -270, -270, -446, -446, -570, -570, -630, -630,
+    -627, -627, -607, -607, -628, -628, -697, -697, -759, -759, -791, -791,
+    -854, -854, -1014, -1014, -1242, -1242, -1446, -1446, -1594, -1594, -1737, -1737,
+    -1922, -1922, -2127, -2127, -2321, -2321, -2512, -2512, -2693, -2693, -2805, -2805,
+    -2816, -2816, -2784, -2784, -2783, -2783, -2781, -2781, -2700, -2700, -2566, -2566,
+    -2513, -2513, -2581, -2581, -2658, -2658, -2666, -2666, -2719, -2719, -2941, -2941,
+    -3197, -3197, -3174, -3174, -2795, -2795, -2391, -2391, -2410, -2410, -3034, -3034,
+    -4141, -4141, -5473, -5473, -6710, -6710, -7485, -7485, -7510, -7510, -6696, -6696,
+    -5089, -5089, -2786, -2786, -53, -53, 2550, 2550, 4407, 4407, 5282, 5282,
+    5409, 5409, 5141, 5141, 4664, 4664, 4027, 4027, 3263, 3263, 2360, 2360,
+    1286, 1286, 159, 159, -717, -717, -1099, -1099, -1008, -1008, -577, -577,
+    198, 198, 1397, 1397, 2893, 2893, 4280, 4280, 5147, 5147, 5351, 5351,
+    5019, 5019, 4359, 4359, 3547, 3547, 2733, 2733, 2051, 2051, 1568, 1568,
+    1225, 1225, 876, 876, 419, 419, -134, -134, -710, -710, -1256, -1256,
+    -1739, -1739, -2096, -2096, -2257, -2257, -2204, -2204, -1996, -1996, -1708, -1708,
+    -1402, -1402, -1118, -1118, -876, -876, -662, -662, -466, -466, -330, -330,
+    -323, -323, -484, -484, -797, -797, -1225, -1225, -1736, -1736, -2288, -2288,
+    -2822, -2822, -3255, -3255, -3487, -3487, -3418, -3418, -3001, -3001, -2292, -2292,
+    -1439, -1439, -617, -617, 50, 50, 548, 548, 955, 955, 1335, 1335,
+    1646, 1646, 1778, 1778, 1692, 1692, 1460, 1460, 1174, 1174, 875, 875,
+    585, 585, 359, 359, 272, 272, 365, 365, 629, 629, 992, 992,
+    1342, 1342, 1599, 1599, 1789, 1789, 1994, 1994, 2241, 2241, 2475, 2475,
+    2648, 2648, 2749, 2749, 2751, 2751, 2603, 2603, 2311, 2311, 1943, 1943,
+    1545, 1545, 1103, 1103, 643, 643, 266, 266, 46, 46, -61, -61,
+    -135, -135, -179, -179, -149, -149, -50, -50, 58, 58, 146, 146,
+    236, 236, 338, 338, 420, 420, 432, 432, 325, 325, 68, 68,
+    -315, -315, -719, -719, -1031, -1031, -1226, -1226, -1368, -1368, -1500, -1500,
+    -1576, -1576, -1520, -1520, -1341, -1341, -1138, -1138, -983, -983, -853, -853,
+    -677, -677, -434, -434, -187, -187, -18, -18, 51, 51, 73, 73,
+    119, 119, 215, 215, 323, 323, 388, 388, 405, 405, 430, 430,
+    522, 522, 684, 684, 863, 863, 986, 986, 1014, 1014, 992, 992,
+    1039, 1039, 1242, 1242, 1555, 1555, 1853, 1853, 2076, 2076, 2258, 2258,
+    2409, 2409, 2470, 2470, 2415, 2415, 2310, 2310, 2215, 2215, 2111, 2111,
+    1983, 1983, 1890, 1890, 1873, 1873, 1879, 1879, 1846, 1846, 1819, 1819,
+    1877, 1877, 2008, 2008, 2126, 2126, 2196, 2196, 2229, 2229, 2212, 2212,
+    2115, 2115, 1951, 1951, 1749, 1749, 1497, 1497, 1182, 1182, 859, 859,
+    592, 592, 379, 379, 178, 178, 8, 8, -92, -92, -144, -144,
+    -211, -211, -302, -302, -362, -362, -341, -341, -217, -217, -3, -3,
+    220, 220, 324, 324, 256, 256, 103, 103, -17, -17, -97, -97,
+    -220, -220, -416, -416, -638, -638, -837, -837, -1001, -1001, -1128, -1128,
+    -1228, -1228, -1317, -1317, -1377, -1377, -1340, -1340, -1173, -1173, -946, -946,
+    -770, -770, -698, -698, -705, -705, -751, -751, -809, -809, -869, -869,
+    -959, -959, -1136, -1136, -1402, -1402, -1685, -1685, -1910, -1910, -2077, -2077,
+    -2220, -2220, -2338, -2338, -2396, -2396, -2373, -2373, -2271, -2271, -2096, -2096,
+    -1871, -1871, -1651, -1651, -1502, -1502, -1451, -1451, -1484, -1484, -1577, -1577,
+    -1725, -1725, -1927, -1927, -2169, -2169, -2425, -2425, -2665, -2665, -2826, -2826,
+    -2786, -2786, -2463, -2463, -2041, -2041, -1999, -1999, -2719, -2719, -4029, -4029,
+    -5293, -5293, -6008, -6008, -6152, -6152, -5856, -5856, -5015, -5015, -3449, -3449,
+    -1339, -1339, 769, 769, 2389, 2389, 3334, 3334, 3627, 3627, 3410, 3410,
+    2967, 2967, 2564, 2564, 2159, 2159, 1466, 1466, 404, 404, -680, -680,
+    -1364, -1364, -1579, -1579, -1519, -1519, -1258, -1258, -646, -646, 404, 404,
+    1706, 1706, 2929, 2929, 3821, 3821, 4260, 4260, 4207, 4207, 3743, 3743,
+    3105, 3105, 2560, 2560, 2191, 2191, 1884, 1884, 1541, 1541, 1228, 1228,
+    1028, 1028, 840, 840, 470, 470, -86, -86, -585, -585, -807, -807,
+    -781, -781, -680, -680, -588, -588, -454, -454, -241, -241, 7, 7,
+    225, 225, 398, 398, 537, 537, 632, 632, 634, 634, 476, 476,
+    100, 100, -491, -491, -1201, -1201, -1875, -1875, -2383, -2383, -2682, -2682,
+    -2780, -2780, -2680, -2680, -2364, -2364, -1849, -1849, -1231, -1231, -639, -639,
+    -169, -169, 145, 145, 315, 315, 398, 398, 468, 468, 525, 525,
+    452, 452, 145, 145, -319, -319, -728, -728, -954, -954, -1037, -1037,
+    -1026, -1026, -860, -860, -481, -481, 32, 32, 540, 540, 981, 981,
+    1344, 1344, 1599, 1599, 1739, 1739, 1851, 1851, 2012, 2012, 2150, 2150,
+    2120, 2120, 1895, 1895, 1599, 1599, 1335, 1335, 1101, 1101, 880, 880,
+    714, 714, 642, 642, 633, 633, 641, 641, 686, 686, 815, 815,
+    1011, 1011, 1190, 1190, 1300, 1300, 1367, 1367, 1440, 1440, 1501, 1501,
+    1489, 1489, 1386, 1386, 1233, 1233, 1041, 1041, 747, 747, 321, 321,
+    -127, -127, -422, -422, -518, -518, -518, -518, -512, -512, -474, -474,
+    -352, -352, -183, -183, -46, -46, 38, 38, 98, 98, 147, 147,
+    181, 181, 210, 210, 236, 236, 197, 197, 27, 27, -241, -241,
+    -470, -470, -566, -566, -566, -566, -565, -565, -572, -572, -498, -498,
+    -278, -278, 37, 37, 325, 325, 523, 523, 666, 666, 825, 825,
+    1017, 1017, 1184, 1184, 1251, 1251, 1185, 1185, 1021, 1021, 838, 838,
+    724, 724, 739, 739, 889, 889, 1140, 1140, 1453, 1453, 1807, 1807,
+    2183, 2183, 2513, 2513, 2692, 2692, 2658, 2658, 2481, 2481, 2311, 2311,
+    2229, 2229, 2193, 2193, 2124, 2124, 2011, 2011, 1899, 1899, 1806, 1806,
+    1706, 1706, 1570, 1570, 1389, 1389, 1167, 1167, 944, 944, 784, 784,
+    714, 714, 678, 678, 601, 601, 486, 486, 405, 405, 402, 402,
+    450, 450, 509, 509, 566, 566, 622, 622, 651, 651, 604, 604,
+    447, 447, 186, 186, -129, -129, -423, -423, -648, -648, -816, -816,
+    -966, -966, -1109, -1109, -1200, -1200, -1195, -1195, -1105, -1105, -1000, -1000,
+    -949, -949, -957, -957, -968, -968, -942, -942, -906, -906, -933, -933,
+    -1073, -1073, -1314, -1314, -1592, -1592, -1837, -1837, -2015, -2015, -2152, -2152,
+    -2290, -2290, -2415, -2415, -2462, -2462, -2409, -2409, -2345, -2345, -2369, -2369,
+    -2459, -2459, -2480, -2480, -2355, -2355, -2154, -2154, -2007, -2007, -1959, -1959,
+    -1965, -1965, -1988, -1988, -2058, -2058, -2213, -2213, -2415, -2415, -2572, -2572,
+    -2631, -2631, -2618, -2618, -2581, -2581, -2549, -2549, -2592, -2592, -2833, -2833,
+    -3338, -3338, -4013, -4013, -4700, -4700, -5304, -5304, -5701, -5701, -5565, -5565,
+    -4541, -4541, -2711, -2711, -686, -686, 906, 906, 1938, 1938, 2637, 2637,
+    3083, 3083, 3122, 3122, 2719, 2719, 2113, 2113, 1523, 1523, 915, 915,
+    196, 196, -545, -545, -1143, -1143, -1548, -1548, -1721, -1721, -1432, -1432,
+    -444, -444, 1070, 1070, 2517, 2517, 3437, 3437, 3893, 3893, 4188, 4188,
+    4369, 4369, 4226, 4226, 3705, 3705, 3052, 3052, 2493, 2493, 1999, 1999,
+    1479, 1479, 1004, 1004, 683, 683, 442, 442, 121, 121, -234, -234,
+    -397, -397, -267, -267, 11, 11, 275, 275, 535, 535, 848, 848,
+    1132, 1132, 1228, 1228, 1115, 1115, 939, 939, 821, 821, 727, 727,
+    537, 537, 186, 186, -311, -311, -930, -930, -1649, -1649, -2369, -2369,
+    -2896, -2896, -3068, -3068, -2880, -2880, -2453, -2453, -1904, -1904, -1306, -1306,
+    -750, -750, -339, -339, -93, -93, 80, 80, 253, 253, 356, 356,
+    254, 254, -91, -91, -567, -567, -1029, -1029, -1409, -1409, -1721, -1721,
+    -1960, -1960, -2048, -2048, -1880, -1880, -1445, -1445, -850, -850, -217, -217,
+    395, 395, 956, 956, 1412, 1412, 1734, 1734, 1960, 1960, 2124, 2124,
+    2177, 2177, 2050, 2050, 1794, 1794, 1546, 1546, 1371, 1371, 1203, 1203,
+    985, 985, 783, 783, 712, 712, 813, 813, 1024, 1024, 1254, 1254,
+    1449, 1449, 1625, 1625, 1840, 1840, 2108, 2108, 2360, 2360, 2512, 2512,
+    2543, 2543, 2469, 2469, 2291, 2291, 2008, 2008, 1657, 1657, 1282, 1282,
+    886, 886, 471, 471, 105, 105, -120, -120, -192, -192, -182, -182,
+    -135, -135, -37, -37, 116, 116, 275, 275, 388, 388, 445, 445,
+    446, 446, 395, 395, 304, 304, 191, 191, 50, 50, -130, -130,
+    -343, -343, -562, -562, -752, -752, -870, -870, -891, -891, -833, -833,
+    -736, -736, -612, -612, -441, -441, -236, -236, -51, -51, 104, 104,
+    286, 286, 517, 517, 716, 716, 789, 789, 774, 774, 790, 790,
+    869, 869, 928, 928, 903, 903, 847, 847, 849, 849, 925, 925,
+    1018, 1018, 1097, 1097, 1212, 1212, 1415, 1415, 1662, 1662, 1854, 1854,
+    1959, 1959, 2041, 2041, 2130, 2130, 2160, 2160, 2089, 2089, 1998, 1998,
+    1995, 1995, 2045, 2045, 2003, 2003, 1816, 1816, 1590, 1590, 1441, 1441,
+    1371, 1371, 1329, 1329, 1305, 1305, 1301, 1301, 1272, 1272, 1188, 1188,
+    1100, 1100, 1084, 1084, 1132, 1132, 1157, 1157, 1099, 1099, 998, 998,
+    934, 934, 902, 902, 806, 806, 587, 587, 315, 315, 99, 99,
+    -55, -55, -232, -232, -471, -471, -711, -711, -882, -882, -984, -984,
+    -1053, -1053, -1086, -1086, -1086, -1086, -1114, -1114, -1227, -1227, -1382, -1382,
+    -1476, -1476, -1491, -1491, -1518, -1518, -1639, -1639, -1847, -1847, -2082, -2082,
+    -2315, -2315, -2565, -2565, -2843, -2843, -3099, -3099, -3249, -3249, -3269, -3269,
+    -3238, -3238, -3243, -3243, -3267, -3267, -3226, -3226, -3087, -3087, -2921, -2921,
+    -2820, -2820, -2805, -2805, -2845, -2845, -2915, -2915, -2987, -2987, -3011, -3011,
+    -2950, -2950, -2856, -2856, -2864, -2864, -3091, -3091, -3563, -3563, -4224, -4224,
+    -4978, -4978, -5690, -5690, -6142, -6142, -6076, -6076, -5379, -5379, -4229, -4229,
+    -2944, -2944, -1679, -1679, -387, -387, 894, 894, 1896, 1896, 2379, 2379,
+    2413, 2413, 2266, 2266, 2057, 2057, 1678, 1678, 1056, 1056, 314, 314,
+    -358, -358, -853, -853, -1090, -1090, -941, -941, -353, -353, 532, 532,
+    1491, 1491, 2412, 2412, 3292, 3292, 4060, 4060, 4525, 4525, 4543, 4543,
+    4215, 4215, 3817, 3817, 3515, 3515, 3220, 3220, 2775, 2775, 2213, 2213,
+    1721, 1721, 1384, 1384, 1111, 1111, 829, 829, 628, 628, 620, 620,
+    758, 758, 897, 897, 999, 999, 1137, 1137, 1313, 1313, 1422, 1422,
+    1415, 1415, 1366, 1366, 1321, 1321, 1198, 1198, 898, 898, 440, 440,
+    -76, -76, -599, -599, -1147, -1147, -1701, -1701, -2160, -2160, -2418, -2418,
+    -2463, -2463, -2351, -2351, -2115, -2115, -1760, -1760, -1333, -1333, -920, -920,
+    -585, -585, -333, -333, -174, -174, -153, -153, -311, -311, -617, -617,
+    -988, -988, -1380, -1380, -1797, -1797, -2196, -2196, -2445, -2445, -2433, -2433,
+    -2177, -2177, -1778, -1778, -1319, -1319, -836, -836, -354, -354, 99, 99,
+    503, 503, 846, 846, 1103, 1103, 1246, 1246, 1287, 1287, 1297, 1297,
+    1321, 1321, 1303, 1303, 1156, 1156, 905, 905, 700, 700, 657, 657,
+    754, 754, 894, 894, 1032, 1032, 1206, 1206, 1458, 1458, 1777, 1777,
+    2116, 2116, 2432, 2432, 2685, 2685, 2844, 2844, 2919, 2919, 2935, 2935,
+    2875, 2875, 2690, 2690, 2379, 2379, 2016, 2016, 1685, 1685, 1427, 1427,
+    1248, 1248, 1134, 1134, 1050, 1050, 972, 972, 922, 922, 954, 954,
+    1082, 1082, 1247, 1247, 1364, 1364, 1407, 1407, 1399, 1399, 1345, 1345,
+    1220, 1220, 1031, 1031, 832, 832, 657, 657, 490, 490, 308, 308,
+    117, 117, -47, -47, -159, -159, -220, -220, -243, -243, -221, -221,
+    -142, -142, -25, -25, 93, 93, 200, 200, 302, 302, 393, 393,
+    458, 458, 498, 498, 515, 515, 488, 488, 394, 394, 239, 239,
+    79, 79, -20, -20, -31, -31, 11, 11, 67, 67, 137, 137,
+    246, 246, 401, 401, 576, 576, 733, 733, 854, 854, 950, 950,
+    1029, 1029, 1073, 1073, 1067, 1067, 1036, 1036, 1014, 1014, 992, 992,
+    954, 954, 917, 917, 906, 906, 911, 911, 906, 906, 898, 898,
+    918, 918, 970, 970, 1024, 1024, 1059, 1059, 1094, 1094, 1150, 1150,
+    1215, 1215, 1263, 1263, 1287, 1287, 1282, 1282, 1233, 1233, 1147, 1147,
+    1056, 1056, 964, 964, 828, 828, 631, 631, 420, 420, 242, 242,
+    100, 100, -18, -18, -93, -93, -108, -108, -97, -97, -124, -124,
+    -202, -202, -272, -272, -304, -304, -348, -348, -472, -472, -664, -664,
+    -881, -881, -1116, -1116, -1375, -1375, -1632, -1632, -1853, -1853, -2064, -2064,
+    -2316, -2316, -2589, -2589, -2786, -2786, -2859, -2859, -2897, -2897, -3015, -3015,
+    -3184, -3184, -3269, -3269, -3245, -3245, -3259, -3259, -3432, -3432, -3678, -3678,
+    -3807, -3807, -3767, -3767, -3734, -3734, -3920, -3920, -4353, -4353, -4890, -4890,
+    -5390, -5390, -5800, -5800, -6068, -6068, -6101, -6101, -5861, -5861, -5420, -5420,
+    -4874, -4874, -4244, -4244, -3505, -3505, -2707, -2707, -1998, -1998, -1500, -1500,
+    -1193, -1193, -980, -980, -837, -837, -832, -832, -1000, -1000, -1267, -1267,
+    -1508, -1508, -1628, -1628, -1578, -1578, -1331, -1331, -877, -877, -265, -265,
+    404, 404, 1055, 1055, 1685, 1685, 2271, 2271, 2676, 2676, 2772, 2772,
+    2639, 2639, 2525, 2525, 2568, 2568, 2654, 2654, 2591, 2591, 2363, 2363,
+    2137, 2137, 2045, 2045, 2070, 2070, 2125, 2125, 2182, 2182, 2254, 2254,
+    2348, 2348, 2450, 2450, 2534, 2534, 2554, 2554, 2494, 2494, 2409, 2409,
+    2376, 2376, 2398, 2398, 2401, 2401, 2320, 2320, 2139, 2139, 1888, 1888,
+    1629, 1629, 1410, 1410, 1205, 1205, 941, 941, 604, 604, 313, 313,
+    210, 210, 281, 281, 361, 361, 345, 345, 311, 311, 375, 375,
+    504, 504, 564, 564, 494, 494, 346, 346, 182, 182, -4, -4,
+    -248, -248, -550, -550, -865, -865, -1142, -1142, -1345, -1345, -1415, -1415,
+    -1294, -1294, -1026, -1026, -772, -772, -651, -651, -612, -612, -514, -514,
+    -332, -332, -194, -194, -207, -207, -323, -323, -410, -410, -439, -439,
+    -483, -483, -563, -563, -598, -598, -534, -534, -424, -424, -331, -331,
+    -239, -239, -87, -87, 141, 141, 393, 393, 601, 601, 746, 746,
+    857, 857, 961, 961, 1059, 1059, 1148, 1148, 1228, 1228, 1277, 1277,
+    1268, 1268, 1224, 1224, 1209, 1209, 1252, 1252, 1296, 1296, 1275, 1275,
+    1218, 1218, 1240, 1240, 1385, 1385, 1556, 1556, 1631, 1631, 1620, 1620,
+    1618, 1618, 1677, 1677, 1784, 1784, 1913, 1913, 2015, 2015, 2015, 2015,
+    1899, 1899, 1772, 1772, 1754, 1754, 1832, 1832, 1875, 1875, 1807, 1807,
+    1683, 1683, 1597, 1597, 1562, 1562, 1547, 1547, 1545, 1545, 1535, 1535,
+    1464, 1464, 1332, 1332, 1230, 1230, 1223, 1223, 1255, 1255, 1237, 1237,
+    1166, 1166, 1097, 1097, 1045, 1045, 983, 983, 899, 899, 810, 810,
+    724, 724, 633, 633, 552, 552, 513, 513, 505, 505, 473, 473,
+    397, 397, 326, 326, 321, 321, 390, 390, 493, 493, 553, 553,
+    501, 501, 355, 355, 229, 229, 208, 208, 245, 245, 228, 228,
+    114, 114, -42, -42, -161, -161, -205, -205, -182, -182, -130, -130,
+    -92, -92, -91, -91, -99, -99, -68, -68, 9, 9, 63, 63,
+    29, 29, -65, -65, -124, -124, -107, -107, -75, -75, -135, -135,
+    -301, -301, -459, -459, -493, -493, -432, -432, -418, -418, -530, -530,
+    -702, -702, -827, -827, -862, -862, -837, -837, -807, -807, -809, -809,
+    -843, -843, -888, -888, -926, -926, -942, -942, -932, -932, -931, -931,
+    -1019, -1019, -1234, -1234, -1505, -1505, -1715, -1715, -1833, -1833, -1952, -1952,
+    -2153, -2153, -2376, -2376, -2494, -2494, -2481, -2481, -2434, -2434, -2445, -2445,
+    -2521, -2521, -2607, -2607, -2651, -2651, -2658, -2658, -2707, -2707, -2873, -2873,
+    -3145, -3145, -3478, -3478, -3860, -3860, -4242, -4242, -4483, -4483, -4510, -4510,
+    -4476, -4476, -4557, -4557, -4604, -4604, -4246, -4246, -3432, -3432, -2634, -2634,
+    -2302, -2302, -2301, -2301, -2155, -2155, -1726, -1726, -1357, -1357, -1342, -1342,
+    -1568, -1568, -1760, -1760, -1847, -1847, -1925, -1925, -2017, -2017, -2015, -2015,
+    -1850, -1850, -1593, -1593, -1317, -1317, -956, -956, -426, -426, 142, 142,
+    469, 469, 496, 496, 512, 512, 767, 767, 1106, 1106, 1185, 1185,
+    980, 980, 830, 830, 936, 936, 1095, 1095, 1055, 1055, 914, 914,
+    918, 918, 1061, 1061, 1138, 1138, 1120, 1120, 1199, 1199, 1453, 1453,
+    1703, 1703, 1766, 1766, 1721, 1721, 1785, 1785, 1987, 1987, 2114, 2114,
+    2024, 2024, 1860, 1860, 1834, 1834, 1901, 1901, 1822, 1822, 1538, 1538,
+    1278, 1278, 1232, 1232, 1301, 1301, 1288, 1288, 1203, 1203, 1200, 1200,
+    1289, 1289, 1332, 1332, 1314, 1314, 1373, 1373, 1526, 1526, 1579, 1579,
+    1420, 1420, 1203, 1203, 1136, 1136, 1190, 1190, 1158, 1158, 946, 946,
+    691, 691, 568, 568, 561, 561, 511, 511, 357, 357, 218, 218,
+    200, 200, 230, 230, 189, 189, 106, 106, 103, 103, 172, 172,
+    170, 170, 68, 68, 28, 28, 143, 143, 258, 258, 196, 196,
+    52, 52, 38, 38, 144, 144, 158, 158, 2, 2, -158, -158,
+    -164, -164, -75, -75, -46, -46, -89, -89, -58, -58, 126, 126,
+    348, 348, 445, 445, 431, 431, 458, 458, 585, 585, 686, 686,
+    647, 647, 537, 537, 500, 500, 535, 535, 525, 525, 464, 464,
+    498, 498, 686, 686, 882, 882, 945, 945, 947, 947, 1052, 1052,
+    1272, 1272, 1466, 1466, 1530, 1530, 1513, 1513, 1520, 1520, 1584, 1584,
+    1650, 1650, 1676, 1676, 1681, 1681, 1690, 1690, 1680, 1680, 1648, 1648,
+    1657, 1657, 1741, 1741, 1804, 1804, 1709, 1709, 1489, 1489, 1355, 1355,
+    1434, 1434, 1593, 1593, 1607, 1607, 1451, 1451, 1315, 1315, 1341, 1341,
+    1471, 1471, 1546, 1546, 1473, 1473, 1274, 1274, 1055, 1055, 924, 924,
+    909, 909, 941, 941, 928, 928, 821, 821, 644, 644, 485, 485,
+    440, 440, 502, 502, 535, 535, 430, 430, 254, 254, 173, 173,
+    226, 226, 272, 272, 188, 188, 25, 25, -97, -97, -147, -147,
+    -171, -171, -198, -198, -245, -245, -341, -341, -470, -470, -551, -551,
+    -543, -543, -519, -519, -570, -570, -689, -689, -792, -792, -818, -818,
+    -794, -794, -791, -791, -839, -839, -881, -881, -844, -844, -761, -761,
+    -756, -756, -877, -877, -1016, -1016, -1052, -1052, -1022, -1022, -1053, -1053,
+    -1175, -1175, -1306, -1306, -1403, -1403, -1482, -1482, -1506, -1506, -1431, -1431,
+    -1362, -1362, -1457, -1457, -1667, -1667, -1756, -1756, -1647, -1647, -1537, -1537,
+    -1609, -1609, -1788, -1788, -1899, -1899, -1936, -1936, -2021, -2021, -2173, -2173,
+    -2284, -2284, -2315, -2315, -2371, -2371, -2529, -2529, -2694, -2694, -2687, -2687,
+    -2495, -2495, -2338, -2338, -2458, -2458, -2831, -2831, -3172, -3172, -3286, -3286,
+    -3308, -3308, -3465, -3465, -3698, -3698, -3737, -3737, -3501, -3501, -3179, -3179,
+    -2914, -2914, -2652, -2652, -2381, -2381, -2228, -2228, -2194, -2194, -2035, -2035,
+    -1631, -1631, -1296, -1296, -1429, -1429, -1922, -1922, -2235, -2235, -2098, -2098,
+    -1827, -1827, -1834, -1834, -2063, -2063, -2101, -2101, -1732, -1732, -1170, -1170,
+    -758, -758, -589, -589, -504, -504, -371, -371, -222, -222, -110, -110,
+    7, 7, 154, 154, 220, 220, 129, 129, 26, 26, 130, 130,
+    379, 379, 466, 466, 294, 294, 179, 179, 422, 422, 856, 856,
+    1068, 1068, 975, 975, 890, 890, 1033, 1033, 1262, 1262, 1353, 1353,
+    1335, 1335, 1386, 1386, 1543, 1543, 1674, 1674, 1692, 1692, 1663, 1663,
+    1675, 1675, 1704, 1704, 1670, 1670, 1577, 1577, 1519, 1519, 1536, 1536,
+    1553, 1553, 1511, 1511, 1488, 1488, 1593, 1593, 1774, 1774, 1856, 1856,
+    1821, 1821, 1868, 1868, 2108, 2108, 2344, 2344, 2328, 2328, 2106, 2106,
+    1925, 1925, 1858, 1858, 1741, 1741, 1484, 1484, 1222, 1222, 1104, 1104,
+    1079, 1079, 1007, 1007, 876, 876, 798, 798, 820, 820, 871, 871,
+    880, 880, 875, 875, 915, 915, 992, 992, 1033, 1033, 985, 985,
+    874, 874, 769, 769, 697, 697, 620, 620, 497, 497, 341, 341,
+    197, 197, 93, 93, 39, 39, 31, 31, 37, 37, 16, 16,
+    -18, -18, 11, 11, 160, 160, 381, 381, 542, 542, 554, 554,
+    459, 459, 376, 376, 381, 381, 445, 445, 483, 483, 437, 437,
+    332, 332, 256, 256, 287, 287, 415, 415, 534, 534, 541, 541,
+    455, 455, 431, 431, 591, 591, 869, 869, 1063, 1063, 1065, 1065,
+    984, 984, 997, 997, 1154, 1154, 1343, 1343, 1420, 1420, 1346, 1346,
+    1213, 1213, 1165, 1165, 1255, 1255, 1372, 1372, 1356, 1356, 1181, 1181,
+    995, 995, 968, 968, 1118, 1118, 1306, 1306, 1377, 1377, 1293, 1293,
+    1159, 1159, 1131, 1131, 1252, 1252, 1398, 1398, 1408, 1408, 1269, 1269,
+    1116, 1116, 1063, 1063, 1087, 1087, 1099, 1099, 1035, 1035, 884, 884,
+    691, 691, 545, 545, 505, 505, 525, 525, 497, 497, 381, 381,
+    246, 246, 179, 179, 181, 181, 181, 181, 113, 113, -25, -25,
+    -162, -162, -212, -212, -176, -176, -163, -163, -268, -268, -451, -451,
+    -592, -592, -641, -641, -655, -655, -712, -712, -834, -834, -990, -990,
+    -1121, -1121, -1169, -1169, -1137, -1137, -1092, -1092, -1098, -1098, -1149, -1149,
+    -1195, -1195, -1196, -1196, -1148, -1148, -1098, -1098, -1143, -1143, -1325, -1325,
+    -1523, -1523, -1558, -1558, -1438, -1438, -1390, -1390, -1580, -1580, -1885, -1885,
+    -2045, -2045, -1961, -1961, -1772, -1772, -1687, -1687, -1812, -1812, -2069, -2069,
+    -2238, -2238, -2153, -2153, -1923, -1923, -1846, -1846, -2048, -2048, -2315, -2315,
+    -2372, -2372, -2213, -2213, -2056, -2056, -2060, -2060, -2218, -2218, -2429, -2429,
+    -2563, -2563, -2511, -2511, -2311, -2311, -2188, -2188, -2332, -2332, -2626, -2626,
+    -2733, -2733, -2517, -2517, -2252, -2252, -2315, -2315, -2710, -2710, -3026, -3026,
+    -2912, -2912, -2496, -2496, -2211, -2211, -2237, -2237, -2317, -2317, -2177, -2177,
+    -1899, -1899, -1724, -1724, -1655, -1655, -1524, -1524, -1369, -1369, -1406, -1406,
+    -1622, -1622, -1706, -1706, -1501, -1501, -1275, -1275, -1345, -1345, -1588, -1588,
+    -1603, -1603, -1275, -1275, -907, -907, -763, -763, -724, -724, -543, -543,
+    -260, -260, -138, -138, -232, -232, -277, -277, -94, -94, 116, 116,
+    92, 92, -40, -40, 39, 39, 298, 298, 369, 369, 147, 147,
+    14, 14, 283, 283, 711, 711, 844, 844, 659, 659, 559, 559,
+    772, 772, 1093, 1093, 1243, 1243, 1243, 1243, 1266, 1266, 1343, 1343,
+    1373, 1373, 1339, 1339, 1337, 1337, 1385, 1385, 1362, 1362, 1186, 1186,
+    1004, 1004, 1047, 1047, 1302, 1302, 1484, 1484, 1451, 1451, 1434, 1434,
+    1691, 1691, 2082, 2082, 2224, 2224, 2035, 2035, 1835, 1835, 1880, 1880,
+    2041, 2041, 2043, 2043, 1856, 1856, 1655, 1655, 1532, 1532, 1442, 1442,
+    1378, 1378, 1397, 1397, 1474, 1474, 1485, 1485, 1376, 1376, 1266, 1266,
+    1305, 1305, 1486, 1486, 1626, 1626, 1569, 1569, 1372, 1372, 1249, 1249,
+    1303, 1303, 1415, 1415, 1418, 1418, 1291, 1291, 1130, 1130, 1015, 1015,
+    961, 961, 945, 945, 916, 916, 813, 813, 641, 641, 507, 507,
+    517, 517, 636, 636, 730, 730, 723, 723, 671, 671, 662, 662,
+    729, 729, 833, 833, 884, 884, 803, 803, 625, 625, 490, 490,
+    473, 473, 498, 498, 461, 461, 371, 371, 301, 301, 299, 299,
+    367, 367, 479, 479, 569, 569, 568, 568, 500, 500, 478, 478,
+    566, 566, 681, 681, 700, 700, 626, 626, 564, 564, 571, 571,
+    622, 622, 687, 687, 744, 744, 749, 749, 689, 689, 647, 647,
+    693, 693, 773, 773, 775, 775, 671, 671, 550, 550, 526, 526,
+    615, 615, 723, 723, 750, 750, 703, 703, 681, 681, 744, 744,
+    843, 843, 869, 869, 780, 780, 642, 642, 549, 549, 523, 523,
+    520, 520, 499, 499, 434, 434, 324, 324, 219, 219, 183, 183,
+    214, 214, 248, 248, 239, 239, 183, 183, 109, 109, 60, 60,
+    59, 59, 61, 61, -10, -10, -167, -167, -339, -339, -453, -453,
+    -500, -500, -528, -528, -575, -575, -646, -646, -720, -720, -772, -772,
+    -780, -780, -770, -770, -812, -812, -911, -911, -971, -971, -937, -937,
+    -885, -885, -900, -900, -953, -953, -981, -981, -997, -997, -1044, -1044,
+    -1103, -1103, -1135, -1135, -1181, -1181, -1310, -1310, -1484, -1484, -1568, -1568,
+    -1515, -1515, -1444, -1444, -1467, -1467, -1540, -1540, -1549, -1549, -1471, -1471,
+    -1384, -1384, -1358, -1358, -1382, -1382, -1418, -1418, -1468, -1468, -1557, -1557,
+    -1657, -1657, -1705, -1705, -1705, -1705, -1746, -1746, -1875, -1875, -2014, -2014,
+    -2038, -2038, -1938, -1938, -1826, -1826, -1785, -1785, -1773, -1773, -1718, -1718,
+    -1658, -1658, -1689, -1689, -1813, -1813, -1926, -1926, -1952, -1952, -1937, -1937,
+    -1978, -1978, -2087, -2087, -2178, -2178, -2175, -2175, -2092, -2092, -1974, -1974,
+    -1844, -1844, -1754, -1754, -1776, -1776, -1857, -1857, -1814, -1814, -1572, -1572,
+    -1324, -1324, -1311, -1311, -1498, -1498, -1624, -1624, -1547, -1547, -1390, -1390,
+    -1298, -1298, -1253, -1253, -1200, -1200, -1174, -1174, -1178, -1178, -1103, -1103,
+    -903, -903, -733, -733, -748, -748, -868, -868, -883, -883, -723, -723,
+    -516, -516, -407, -407, -411, -411, -425, -425, -343, -343, -161, -161,
+    0, 0, 21, 21, -52, -52, -36, -36, 133, 133, 288, 288,
+    269, 269, 166, 166, 192, 192, 387, 387, 604, 604, 724, 724,
+    763, 763, 773, 773, 779, 779, 813, 813, 919, 919, 1062, 1062,
+    1118, 1118, 1019, 1019, 874, 874, 878, 878, 1082, 1082, 1322, 1322,
+    1394, 1394, 1290, 1290, 1201, 1201, 1282, 1282, 1466, 1466, 1555, 1555,
+    1467, 1467, 1334, 1334, 1329, 1329, 1465, 1465, 1604, 1604, 1635, 1635,
+    1580, 1580, 1540, 1540, 1574, 1574, 1650, 1650, 1710, 1710, 1732, 1732,
+    1706, 1706, 1616, 1616, 1487, 1487, 1427, 1427, 1496, 1496, 1586, 1586,
+    1535, 1535, 1362, 1362, 1272, 1272, 1388, 1388, 1581, 1581, 1647, 1647,
+    1549, 1549, 1417, 1417, 1351, 1351, 1345, 1345, 1348, 1348, 1326, 1326,
+    1247, 1247, 1107, 1107, 965, 965, 905, 905, 945, 945, 1018, 1018,
+    1040, 1040, 971, 971, 849, 849, 766, 766, 785, 785, 860, 860,
+    875, 875, 777, 777, 635, 635, 548, 548, 543, 543, 573, 573,
+    578, 578, 529, 529, 438, 438, 351, 351, 330, 330, 385, 385,
+    439, 439, 395, 395, 261, 261, 146, 146, 140, 140, 232, 232,
+    333, 333, 367, 367, 328, 328, 277, 277, 282, 282, 361, 361,
+    459, 459, 462, 462, 309, 309, 101, 101, 47, 47, 200, 200,
+    353, 353, 292, 292, 82, 82, -23, -23, 107, 107, 336, 336,
+    458, 458, 418, 418, 317, 317, 266, 266, 293, 293, 345, 345,
+    333, 333, 219, 219, 83, 83, 29, 29, 36, 36, 17, 17,
+    -24, -24, -27, -27, -14, -14, -47, -47, -94, -94, -88, -88,
+    -84, -84, -176, -176, -288, -288, -236, -236, -41, -41, 29, 29,
+    -163, -163, -395, -395, -409, -409, -281, -281, -264, -264, -390, -390,
+    -483, -483, -480, -480, -506, -506, -638, -638, -759, -759, -728, -728,
+    -578, -578, -461, -461, -441, -441, -458, -458, -473, -473, -520, -520,
+    -595, -595, -623, -623, -567, -567, -513, -513, -584, -584, -791, -791,
+    -983, -983, -974, -974, -746, -746, -501, -501, -498, -498, -776, -776,
+    -1059, -1059, -1027, -1027, -726, -726, -520, -520, -573, -573, -644, -644,
+    -550, -550, -493, -493, -685, -685, -930, -930, -910, -910, -702, -702,
+    -641, -641, -777, -777, -830, -830, -703, -703, -629, -629, -725, -725,
+    -824, -824, -836, -836, -875, -875, -910, -910, -754, -754, -479, -479,
+    -406, -406, -571, -571, -657, -657, -546, -546, -512, -512, -708, -708,
+    -862, -862, -700, -700, -410, -410, -377, -377, -630, -630, -867, -867,
+    -879, -879, -695, -695, -457, -457, -362, -362, -523, -523, -715, -715,
+    -572, -572, -176, -176, -25, -25, -276, -276, -476, -476, -289, -289,
+    -40, -40, -205, -205, -649, -649, -781, -781, -396, -396, 26, 26,
+    -24, -24, -430, -430, -658, -658, -433, -433, 4, 4, 221, 221,
+    50, 50, -261, -261, -328, -328, -74, -74, 202, 202, 198, 198,
+    -73, -73, -349, -349, -394, -394, -222, -222, -84, -84, -138, -138,
+    -189, -189, -13, -13, 189, 189, 71, 71, -191, -191, -88, -88,
+    342, 342, 440, 440, -35, -35, -406, -406, -38, -38, 645, 645,
+    749, 749, 241, 241, -51, -51, 240, 240, 530, 530, 289, 289,
+    -170, -170, -242, -242, 162, 162, 622, 622, 714, 714, 369, 369,
+    -61, -61, -116, -116, 290, 290, 781, 781, 934, 934, 667, 667,
+    271, 271, 186, 186, 594, 594, 1102, 1102, 1069, 1069, 405, 405,
+    -149, -149, 108, 108, 811, 811, 928, 928, 284, 284, -95, -95,
+    409, 409, 993, 993, 781, 781, 270, 270, 394, 394, 920, 920,
+    945, 945, 473, 473, 347, 347, 792, 792, 1063, 1063, 687, 687,
+    238, 238, 410, 410, 898, 898, 888, 888, 348, 348, 51, 51,
+    408, 408, 942, 942, 984, 984, 481, 481, 21, 21, 134, 134,
+    652, 652, 933, 933, 728, 728, 420, 420, 355, 355, 410, 410,
+    374, 374, 306, 306, 353, 353, 481, 481, 504, 504, 298, 298,
+    -19, -19, -131, -131, 153, 153, 624, 624, 799, 799, 424, 424,
+    -164, -164, -326, -326, 93, 93, 540, 540, 496, 496, 109, 109,
+    -150, -150, -100, -100, 102, 102, 207, 207, 50, 50, -239, -239,
+    -242, -242, 190, 190, 555, 555, 296, 296, -343, -343, -572, -572,
+    -162, -162, 237, 237, 71, 71, -334, -334, -366, -366, -71, -71,
+    73, 73, -3, -3, 0, 0, 55, 55, -160, -160, -571, -571,
+    -673, -673, -286, -286, 122, 122, 52, 52, -387, -387, -667, -667,
+    -515, -515, -175, -175, -30, -30, -161, -161, -347, -347, -371, -371,
+    -236, -236, -105, -105, -84, -84, -115, -115, -131, -131, -240, -240,
+    -526, -526, -731, -731, -472, -472, 103, 103, 267, 267, -346, -346,
+    -1062, -1062, -922, -922, -17, -17, 547, 547, 108, 108, -711, -711,
+    -913, -913, -391, -391, 163, 163, 258, 258, 6, 6, -293, -293,
+    -475, -475, -451, -451, -199, -199, 72, 72, 55, 55, -270, -270,
+    -544, -544, -436, -436, -19, -19, 289, 289, 120, 120, -424, -424,
+    -761, -761, -444, -444, 204, 204, 414, 414, -51, -51, -608, -608,
+    -621, -621, -98, -98, 440, 440, 522, 522, 84, 84, -483, -483,
+    -613, -613, -117, -117, 497, 497, 506, 506, -126, -126, -626, -626,
+    -426, -426, 104, 104, 252, 252, -70, -70, -372, -372, -296, -296,
+    70, 70, 363, 363, 302, 302, 42, 42, 4, 4, 179, 179,
+    72, 72, -343, -343, -349, -349, 321, 321, 776, 776, 218, 218,
+    -677, -677, -632, -632, 273, 273, 669, 669, 26, 26, -575, -575,
+    -260, -260, 364, 364, 443, 443, 132, 132, -128, -128, -350, -350,
+    -417, -417, 44, 44, 728, 728, 739, 739, -31, -31, -628, -628,
+    -408, -408, 155, 155, 358, 358, 221, 221, 81, 81, -80, -80,
+    -269, -269, -89, -89, 448, 448, 478, 478, -338, -338, -920, -920,
+    -342, -342, 649, 649, 802, 802, 121, 121, -481, -481, -483, -483,
+    -41, -41, 431, 431, 543, 543, 198, 198, -220, -220, -237, -237,
+    104, 104, 297, 297, 129, 129, -51, -51, -41, -41, -121, -121,
+    -269, -269, 14, 14, 545, 545, 391, 391, -361, -361, -358, -358,
+    682, 682, 1168, 1168, 201, 201, -808, -808, -355, -355, 784, 784,
+    891, 891, -3, -3, -402, -402, 140, 140, 540, 540, 213, 213,
+    -121, -121, 36, 36, 197, 197, 70, 70, 63, 63, 260, 260,
+    215, 215, -12, -12, 156, 156, 628, 628, 615, 615, 18, 18,
+    -237, -237, 357, 357, 958, 958, 578, 578, -366, -366, -597, -597,
+    156, 156, 807, 807, 534, 534, -157, -157, -316, -316, 165, 165,
+    598, 598, 498, 498, 116, 116, -30, -30, 137, 137, 269, 269,
+    207, 207, 147, 147, 205, 205, 244, 244, 202, 202, 155, 155,
+    89, 89, -23, -23, -27, -27, 151, 151, 232, 232, -32, -32,
+    -367, -367, -301, -301, 106, 106, 306, 306, 87, 87, -120, -120,
+    45, 45, 320, 320, 304, 304, 49, 49, -163, -163, -193, -193,
+    50, 50, 511, 511, 678, 678, 84, 84, -751, -751, -749, -749,
+    135, 135, 690, 690, 196, 196, -529, -529, -436, -436, 194, 194,
+    356, 356, -59, -59, -311, -311, -168, -168, -96, -96, -162, -162,
+    70, 70, 475, 475, 341, 341, -358, -358, -688, -688, -167, -167,
+    446, 446, 269, 269, -419, -419, -674, -674, -291, -291, 26, 26,
+    -156, -156, -400, -400, -226, -226, 72, 72, -43, -43, -440, -440,
+    -533, -533, -191, -191, 124, 124, 109, 109, -19, -19, -41, -41,
+    -136, -136, -412, -412, -477, -477, -33, -33, 404, 404, 143, 143,
+    -523, -523, -651, -651, -101, -101, 278, 278, -5, -5, -415, -415,
+    -311, -311, 138, 138, 315, 315, 4, 4, -435, -435, -525, -525,
+    -95, -95, 528, 528, 657, 657, -50, -50, -900, -900, -804, -804,
+    178, 178, 742, 742, 192, 192, -586, -586, -554, -554, 20, 20,
+    275, 275, 129, 129, 56, 56, 65, 65, -166, -166, -421, -421,
+    -150, -150, 478, 478, 664, 664, 220, 220, -168, -168, -102, -102,
+    56, 56, 74, 74, 235, 235, 547, 547, 460, 460, -157, -157,
+    -509, -509, 34, 34, 845, 845, 784, 784, -145, -145, -724, -724,
+    -208, -208, 689, 689, 860, 860, 240, 240, -312, -312, -212, -212,
+    252, 252, 468, 468, 274, 274, -5, -5, -61, -61, 121, 121,
+    381, 381, 522, 522, 393, 393, 71, 71, -133, -133, -10, -10,
+    286, 286, 436, 436, 337, 337, 161, 161, 101, 101, 176, 176,
+    296, 296, 351, 351, 224, 224, -74, -74, -231, -231, 76, 76,
+    645, 645, 840, 840, 365, 365, -330, -330, -560, -560, -126, -126,
+    540, 540, 776, 776, 279, 279, -497, -497, -649, -649, 149, 149,
+    992, 992, 704, 704, -471, -471, -942, -942, 27, 27, 1072, 1072,
+    598, 598, -794, -794, -1084, -1084, 205, 205, 1318, 1318, 829, 829,
+    -467, -467, -939, -939, -330, -330, 359, 359, 483, 483, 270, 270,
+    44, 44, -151, -151, -199, -199, 54, 54, 338, 338, 194, 194,
+    -239, -239, -322, -322, 97, 97, 469, 469, 394, 394, 76, 76,
+    -133, -133, -106, -106, 137, 137, 431, 431, 458, 458, 83, 83,
+    -338, -338, -289, -289, 221, 221, 596, 596, 400, 400, -86, -86,
+    -297, -297, -92, -92, 258, 258, 446, 446, 293, 293, -93, -93,
+    -247, -247, 127, 127, 616, 616, 572, 572, 8, 8, -424, -424,
+    -238, -238, 367, 367, 702, 702, 301, 301, -450, -450, -568, -568,
+    303, 303, 1153, 1153, 726, 726, -595, -595, -955, -955, 328, 328,
+    1410, 1410, 511, 511, -1154, -1154, -1053, -1053, 687, 687, 1425, 1425,
+    143, 143, -1108, -1108, -577, -577, 634, 634, 668, 668, -222, -222,
+    -557, -557, -184, -184, -78, -78, -269, -269, 57, 57, 633, 633,
+    292, 292, -764, -764, -875, -875, 376, 376, 1201, 1201, 307, 307,
+    -995, -995, -770, -770, 543, 543, 851, 851, -279, -279, -945, -945,
+    12, 12, 1066, 1066, 393, 393, -1118, -1118, -1137, -1137, 447, 447,
+    1310, 1310, 253, 253, -1062, -1062, -751, -751, 573, 573, 987, 987,
+    117, 117, -687, -687, -562, -562, -40, -40, 220, 220, 260, 260,
+    188, 188, -130, -130, -457, -457, -311, -311, 114, 114, 117, 117,
+    -284, -284, -323, -323, 144, 144, 287, 287, -280, -280, -686, -686,
+    -126, -126, 704, 704, 511, 511, -562, -562, -988, -988, -114, -114,
+    759, 759, 231, 231, -1061, -1061, -1219, -1219, 172, 172, 1246, 1246,
+    393, 393, -1311, -1311, -1450, -1450, 262, 262, 1424, 1424, 375, 375,
+    -1360, -1360, -1266, -1266, 479, 479, 1306, 1306, 55, 55, -1362, -1362,
+    -852, -852, 768, 768, 1032, 1032, -470, -470, -1460, -1460, -363, -363,
+    1292, 1292, 1097, 1097, -658, -658, -1445, -1445, -241, -241, 1097, 1097,
+    722, 722, -626, -626, -1025, -1025, -162, -162, 655, 655, 637, 637,
+    193, 193, -239, -239, -574, -574, -410, -410, 524, 524, 1281, 1281,
+    648, 648, -759, -759, -1020, -1020, 247, 247, 1228, 1228, 609, 609,
+    -585, -585, -685, -685, 271, 271, 928, 928, 625, 625, -64, -64,
+    -398, -398, -160, -160, 408, 408, 730, 730, 361, 361, -226, -226,
+    -100, -100, 586, 586, 665, 665, -38, -38, -231, -231, 572, 572,
+    936, 936, -118, -118, -1080, -1080, -122, -122, 1687, 1687, 1660, 1660,
+    -313, -313, -1402, -1402, -157, -157, 1335, 1335, 858, 858, -549, -549,
+    -527, -527, 802, 802, 1230, 1230, 90, 90, -799, -799, -134, -134,
+    901, 901, 682, 682, -299, -299, -401, -401, 489, 489, 900, 900,
+    181, 181, -576, -576, -332, -332, 413, 413, 599, 599, 181, 181,
+    -120, -120, -56, -56, 24, 24, 6, 6, 136, 136, 368, 368,
+    292, 292, -164, -164, -474, -474, -223, -223, 307, 307, 510, 510,
+    223, 223, -152, -152, -203, -203, 24, 24, 152, 152, 16, 16,
+    -90, -90, 101, 101, 290, 290, 50, 50, -305, -305, -60, -60,
+    616, 616, 658, 658, -230, -230, -871, -871, -307, -307, 650, 650,
+    644, 644, -103, -103, -266, -266, 298, 298, 378, 378, -348, -348,
+    -625, -625, 178, 178, 842, 842, 288, 288, -551, -551, -278, -278,
+    578, 578, 454, 454, -532, -532, -685, -685, 415, 415, 1068, 1068,
+    128, 128, -1087, -1087, -748, -748, 716, 716, 1258, 1258, 193, 193,
+    -945, -945, -682, -682, 474, 474, 962, 962, 246, 246, -719, -719,
+    -808, -808, -6, -6, 708, 708, 564, 564, -127, -127, -491, -491,
+    -244, -244, 74, 74, 6, 6, -181, -181, -24, -24, 296, 296,
+    197, 197, -314, -314, -538, -538, -149, -149, 313, 313, 294, 294,
+    -60, -60, -319, -319, -344, -344, -183, -183, 119, 119, 368, 368,
+    260, 260, -197, -197, -521, -521, -323, -323, 109, 109, 179, 179,
+    -135, -135, -270, -270, 45, 45, 409, 409, 310, 310, -301, -301,
+    -901, -901, -712, -712, 438, 438, 1420, 1420, 764, 764, -1195, -1195,
+    -2081, -2081, -416, -416, 1901, 1901, 1709, 1709, -921, -921, -2392, -2392,
+    -597, -597, 1918, 1918, 1611, 1611, -918, -918, -2044, -2044, -533, -533,
+    1061, 1061, 638, 638, -573, -573, -559, -559, 247, 247, 193, 193,
+    -590, -590, -608, -608, 239, 239, 503, 503, -252, -252, -740, -740,
+    -181, -181, 440, 440, 90, 90, -659, -659, -651, -651, 85, 85,
+    592, 592, 445, 445, 12, 12, -373, -373, -619, -619, -495, -495,
+    117, 117, 670, 670, 411, 411, -492, -492, -976, -976, -459, -459,
+    394, 394, 598, 598, 46, 46, -582, -582, -709, -709, -287, -287,
+    322, 322, 563, 563, 111, 111, -594, -594, -634, -634, 138, 138,
+    636, 636, 18, 18, -836, -836, -456, -456, 825, 825, 1055, 1055,
+    -372, -372, -1500, -1500, -570, -570, 1261, 1261, 1499, 1499, -125, -125,
+    -1395, -1395, -807, -807, 635, 635, 1193, 1193, 564, 564, -342, -342,
+    -721, -721, -338, -338, 532, 532, 1066, 1066, 532, 532, -588, -588,
+    -854, -854, 185, 185, 1133, 1133, 655, 655, -518, -518, -654, -654,
+    413, 413, 1150, 1150, 624, 624, -344, -344, -551, -551, 53, 53,
+    613, 613, 588, 588, 218, 218, -16, -16, -2, -2, 60, 60,
+    80, 80, 212, 212, 528, 528, 712, 712, 338, 338, -381, -381,
+    -519, -519, 349, 349, 1228, 1228, 843, 843, -487, -487, -1100, -1100,
+    -216, -216, 1032, 1032, 1152, 1152, 213, 213, -457, -457, -185, -185,
+    309, 309, 253, 253, -30, -30, 111, 111, 476, 476, 406, 406,
+    -56, -56, -214, -214, 157, 157, 451, 451, 183, 183, -237, -237,
+    -155, -155, 288, 288, 391, 391, -6, -6, -336, -336, -187, -187,
+    226, 226, 447, 447, 256, 256, -191, -191, -429, -429, -103, -103,
+    467, 467, 501, 501, -133, -133, -504, -504, 80, 80, 816, 816,
+    426, 426, -726, -726, -901, -901, 332, 332, 1182, 1182, 289, 289,
+    -1078, -1078, -889, -889, 527, 527, 1056, 1056, 74, 74, -760, -760,
+    -254, -254, 593, 593, 444, 444, -253, -253, -253, -253, 340, 340,
+    393, 393, -254, -254, -600, -600, -198, -198, 276, 276, 300, 300,
+    136, 136, -1, -1, -286, -286, -506, -506, -97, -97, 659, 659,
+    617, 617, -408, -408, -951, -951, -11, -11, 1143, 1143, 706, 706,
+    -788, -788, -1135, -1135, 181, 181, 1178, 1178, 411, 411, -907, -907,
+    -839, -839, 405, 405, 926, 926, 15, 15, -890, -890, -414, -414,
+    754, 754, 921, 921, -168, -168, -997, -997, -435, -435, 730, 730,
+    938, 938, -4, -4, -791, -791, -518, -518, 231, 231, 472, 472,
+    138, 138, -195, -195, -220, -220, -9, -9, 295, 295, 434, 434,
+    126, 126, -384, -384, -363, -363, 337, 337, 798, 798, 292, 292,
+    -493, -493, -392, -392, 469, 469, 873, 873, 297, 297, -483, -483,
+    -565, -565, 73, 73, 744, 744, 716, 716, -97, -97, -801, -801,
+    -352, -352, 901, 901, 1258, 1258, -12, -12, -1280, -1280, -740, -740,
+    812, 812, 1133, 1133, 17, 17, -577, -577, 101, 101, 512, 512,
+    -221, -221, -680, -680, 260, 260, 1224, 1224, 514, 514, -939, -939,
+    -919, -919, 556, 556, 1255, 1255, 205, 205, -955, -955, -614, -614,
+    555, 555, 900, 900, 166, 166, -537, -537, -467, -467, 48, 48,
+    397, 397, 407, 407, 239, 239, 28, 28, -153, -153, -204, -204,
+    -51, -51, 207, 207, 305, 305, 80, 80, -271, -271, -307, -307,
+    144, 144, 607, 607, 379, 379, -497, -497, -1000, -1000, -323, -323,
+    874, 874, 1070, 1070, -116, -116, -1224, -1224, -761, -761, 731, 731,
+    1238, 1238, -37, -37, -1453, -1453, -1038, -1038, 817, 817, 1768, 1768,
+    562, 562, -1316, -1316, -1503, -1503, 233, 233, 1660, 1660, 909, 909,
+    -1066, -1066, -1700, -1700, -238, -238, 1272, 1272, 828, 828, -819, -819,
+    -1359, -1359, -155, -155, 1075, 1075, 825, 825, -313, -313, -867, -867,
+    -472, -472, 199, 199, 589, 589, 466, 466, -255, -255, -1014, -1014,
+    -744, -744, 546, 546, 1191, 1191, 49, 49, -1498, -1498, -1234, -1234,
+    577, 577, 1379, 1379, 49, 49, -1431, -1431, -958, -958, 653, 653,
+    1101, 1101, -15, -15, -943, -943, -523, -523, 401, 401, 502, 502,
+    -199, -199, -600, -600, -116, -116, 552, 552, 349, 349, -646, -646,
+    -1109, -1109, -184, -184, 1026, 1026, 661, 661, -1092, -1092, -1772, -1772,
+    -116, -116, 1681, 1681, 943, 943, -1297, -1297, -1608, -1608, 579, 579,
+    1933, 1933, 340, 340, -1763, -1763, -1154, -1154, 1173, 1173, 1629, 1629,
+    -393, -393, -1770, -1770, -631, -631, 980, 980, 607, 607, -913, -913,
+    -1176, -1176, 6, 6, 716, 716, 99, 99, -655, -655, -498, -498,
+    34, 34, 86, 86, -122, -122, 22, 22, 312, 312, 155, 155,
+    -297, -297, -373, -373, -28, -28, 113, 113, -147, -147, -249, -249,
+    104, 104, 320, 320, -152, -152, -739, -739, -450, -450, 490, 490,
+    735, 735, -187, -187, -985, -985, -403, -403, 857, 857, 1021, 1021,
+    -227, -227, -1202, -1202, -515, -515, 936, 936, 1131, 1131, -268, -268,
+    -1349, -1349, -540, -540, 1136, 1136, 1316, 1316, -452, -452, -1895, -1895,
+    -998, -998, 1169, 1169, 1832, 1832, 287, 287, -1285, -1285, -982, -982,
+    423, 423, 1024, 1024, 438, 438, -211, -211, -212, -212, 65, 65,
+    195, 195, 283, 283, 374, 374, 157, 157, -372, -372, -618, -618,
+    -180, -180, 510, 510, 698, 698, 217, 217, -379, -379, -467, -467,
+    -32, -32, 369, 369, 362, 362, 204, 204, 240, 240, 282, 282,
+    67, 67, -81, -81, 230, 230, 563, 563, 217, 217, -429, -429,
+    -268, -268, 676, 676, 970, 970, -41, -41, -992, -992, -476, -476,
+    758, 758, 928, 928, -117, -117, -800, -800, -152, -152, 951, 951,
+    1071, 1071, 1, 1, -991, -991, -622, -622, 762, 762, 1369, 1369,
+    246, 246, -1154, -1154, -783, -783, 915, 915, 1389, 1389, -187, -187,
+    -1479, -1479, -546, -546, 1118, 1118, 1043, 1043, -327, -327, -701, -701,
+    159, 159, 435, 435, -244, -244, -221, -221, 886, 886, 1108, 1108,
+    -482, -482, -1666, -1666, -308, -308, 1952, 1952, 1761, 1761, -872, -872,
+    -2297, -2297, -483, -483, 1936, 1936, 1435, 1435, -1241, -1241, -2113, -2113,
+    174, 174, 2231, 2231, 921, 921, -1831, -1831, -1859, -1859, 858, 858,
+    2162, 2162, 200, 200, -1777, -1777, -702, -702, 1486, 1486, 1161, 1161,
+    -1081, -1081, -1537, -1537, 480, 480, 1614, 1614, 79, 79, -1497, -1497,
+    -546, -546, 1253, 1253, 887, 887, -1037, -1037, -1388, -1388, 399, 399,
+    1505, 1505, 261, 261, -1276, -1276, -657, -657, 1089, 1089, 1105, 1105,
+    -711, -711, -1452, -1452, 208, 208, 1759, 1759, 626, 626, -1722, -1722,
+    -1767, -1767, 721, 721, 2141, 2141, 364, 364, -2021, -2021, -1558, -1558,
+    929, 929, 1709, 1709, -196, -196, -1765, -1765, -718, -718, 1201, 1201,
+    1107, 1107, -715, -715, -1469, -1469, -131, -131, 1165, 1165, 489, 489,
+    -1011, -1011, -1005, -1005, 428, 428, 1026, 1026, -90, -90, -1095, -1095,
+    -392, -392, 817, 817, 448, 448, -1011, -1011, -1143, -1143, 438, 438,
+    1249, 1249, -121, -121, -1581, -1581, -751, -751, 1191, 1191, 1210, 1210,
+    -923, -923, -2156, -2156, -583, -583, 1797, 1797, 1856, 1856, -467, -467,
+    -2244, -2244, -1428, -1428, 754, 754, 1618, 1618, 344, 344, -1254, -1254,
+    -1205, -1205, 122, 122, 741, 741, -39, -39, -779, -779, -341, -341,
+    362, 362, 122, 122, -422, -422, -29, -29, 712, 712, 213, 213,
+    -1170, -1170, -1233, -1233, 577, 577, 1854, 1854, 628, 628, -1606, -1606,
+    -1954, -1954, -116, -116, 1501, 1501, 1142, 1142, -444, -444, -1409, -1409,
+    -878, -878, 471, 471, 1208, 1208, 532, 532, -782, -782, -1132, -1132,
+    -113, -113, 826, 826, 385, 385, -670, -670, -698, -698, 249, 249,
+    583, 583, -202, -202, -796, -796, -290, -290, 449, 449, 350, 350,
+    -226, -226, -302, -302, 162, 162, 455, 455, 271, 271, -81, -81,
+    -320, -320, -360, -360, -82, -82, 445, 445, 674, 674, 147, 147,
+    -711, -711, -943, -943, -225, -225, 732, 732, 948, 948, 152, 152,
+    -870, -870, -899, -899, 319, 319, 1433, 1433, 936, 936, -719, -719,
+    -1439, -1439, -248, -248, 1293, 1293, 1215, 1215, -173, -173, -917, -917,
+    -254, -254, 604, 604, 528, 528, -69, -69, -269, -269, -2, -2,
+    269, 269, 396, 396, 461, 461, 369, 369, 76, 76, -119, -119,
+    38, 38, 299, 299, 261, 261, -8, -8, -68, -68, 196, 196,
+    399, 399, 205, 205, -221, -221, -396, -396, -43, -43, 562, 562,
+    745, 745, 168, 168, -592, -592, -575, -575, 316, 316, 1023, 1023,
+    632, 632, -372, -372, -686, -686, 73, 73, 841, 841, 574, 574,
+    -327, -327, -614, -614, 53, 53, 677, 677, 373, 373, -366, -366,
+    -367, -367, 509, 509, 1049, 1049, 344, 344, -811, -811, -863, -863,
+    352, 352, 1272, 1272, 676, 676, -635, -635, -911, -911, 169, 169,
+    1077, 1077, 568, 568, -660, -660, -998, -998, -80, -80, 888, 888,
+    794, 794, -99, -99, -709, -709, -471, -471, 201, 201, 556, 556,
+    303, 303, -213, -213, -431, -431, -114, -114, 409, 409, 558, 558,
+    136, 136, -407, -407, -457, -457, 41, 41, 495, 495, 340, 340,
+    -239, -239, -491, -491, -73, -73, 425, 425, 273, 273, -321, -321,
+    -473, -473, 81, 81, 579, 579, 323, 323, -354, -354, -598, -598,
+    -157, -157, 421, 421, 540, 540, 112, 112, -478, -478, -659, -659,
+    -135, -135, 600, 600, 603, 603, -239, -239, -811, -811, -278, -278,
+    590, 590, 506, 506, -366, -366, -651, -651, 109, 109, 770, 770,
+    360, 360, -484, -484, -559, -559, 149, 149, 610, 610, 281, 281,
+    -319, -319, -444, -444, 22, 22, 516, 516, 380, 380, -353, -353,
+    -796, -796, -242, -242, 723, 723, 819, 819, -140, -140, -857, -857,
+    -351, -351, 619, 619, 657, 657, -224, -224, -700, -700, -161, -161,
+    499, 499, 373, 373, -188, -188, -346, -346, -45, -45, 155, 155,
+    53, 53, -48, -48, 17, 17, 60, 60, 7, 7, 65, 65,
+    222, 222, 98, 98, -331, -331, -415, -415, 177, 177, 679, 679,
+    245, 245, -631, -631, -662, -662, 314, 314, 960, 960, 328, 328,
+    -716, -716, -721, -721, 242, 242, 740, 740, 120, 120, -641, -641,
+    -488, -488, 264, 264, 561, 561, 91, 91, -419, -419, -275, -275,
+    264, 264, 372, 372, -146, -146, -500, -500, -32, -32, 723, 723,
+    638, 638, -403, -403, -1106, -1106, -371, -371, 1078, 1078, 1397, 1397,
+    37, 37, -1360, -1360, -996, -996, 741, 741, 1724, 1724, 730, 730,
+    -1058, -1058, -1526, -1526, -214, -214, 1211, 1211, 1116, 1116, -205, -205,
+    -1205, -1205, -988, -988, 51, 51, 929, 929, 856, 856, -175, -175,
+    -1112, -1112, -738, -738, 636, 636, 1136, 1136, -163, -163, -1522, -1522,
+    -776, -776, 1217, 1217, 1491, 1491, -508, -508, -1852, -1852, -574, -574,
+    1322, 1322, 1071, 1071, -673, -673, -1223, -1223, -58, -58, 861, 861,
+    431, 431, -343, -343, -477, -477, -298, -298, -162, -162, 263, 263,
+    734, 734, 223, 223, -1122, -1122, -1495, -1495, -79, -79, 1376, 1376,
+    992, 992, -531, -531, -1145, -1145, -414, -414, 339, 339, 313, 313,
+    57, 57, 32, 32, -145, -145, -587, -587, -552, -552, 243, 243,
+    764, 764, 120, 120, -923, -923, -969, -969, -14, -14, 660, 660,
+    350, 350, -300, -300, -468, -468, -229, -229, -79, -79, -48, -48,
+    79, 79, 82, 82, -320, -320, -666, -666, -254, -254, 618, 618,
+    813, 813, -51, -51, -958, -958, -770, -770, 308, 308, 947, 947,
+    314, 314, -869, -869, -1113, -1113, 12, 12, 1185, 1185, 821, 821,
+    -834, -834, -1718, -1718, -540, -540, 1283, 1283, 1338, 1338, -441, -441,
+    -1630, -1630, -739, -739, 866, 866, 1161, 1161, 158, 158, -701, -701,
+    -735, -735, -330, -330, 214, 214, 757, 757, 678, 678, -371, -371,
+    -1245, -1245, -489, -489, 1137, 1137, 1209, 1209, -705, -705, -1959, -1959,
+    -619, -619, 1475, 1475, 1302, 1302, -872, -872, -1910, -1910, -388, -388,
+    1488, 1488, 1222, 1222, -533, -533, -1246, -1246, -145, -145, 1061, 1061,
+    814, 814, -379, -379, -945, -945, -276, -276, 716, 716, 791, 791,
+    -157, -157, -952, -952, -560, -560, 556, 556, 986, 986, 245, 245,
+    -593, -593, -433, -433, 337, 337, 588, 588, 187, 187, -19, -19,
+    221, 221, 200, 200, -295, -295, -429, -429, 240, 240, 814, 814,
+    382, 382, -497, -497, -606, -606, 121, 121, 601, 601, 253, 253,
+    -298, -298, -317, -317, 86, 86, 419, 419, 526, 526, 441, 441,
+    118, 118, -264, -264, -227, -227, 319, 319, 726, 726, 414, 414,
+    -275, -275, -501, -501, -28, -28, 543, 543, 568, 568, 44, 44,
+    -509, -509, -579, -579, -86, -86, 491, 491, 511, 511, -54, -54,
+    -445, -445, -106, -106, 437, 437, 330, 330, -235, -235, -295, -295,
+    260, 260, 427, 427, -193, -193, -558, -558, 146, 146, 959, 959,
+    465, 465, -886, -886, -1222, -1222, 25, 25, 1221, 1221, 826, 826,
+    -568, -568, -1239, -1239, -593, -593, 413, 413, 726, 726, 286, 286,
+    -243, -243, -311, -311, 20, 20, 251, 251, 101, 101, -95, -95,
+    107, 107, 475, 475, 338, 338, -334, -334, -710, -710, -236, -236,
+    519, 519, 625, 625, 7, 7, -582, -582, -578, -578, -118, -118,
+    319, 319, 392, 392, 86, 86, -288, -288, -348, -348, -36, -36,
+    335, 335, 455, 455, 252, 252, -165, -165, -465, -465, -206, -206,
+    510, 510, 741, 741, -153, -153, -1246, -1246, -976, -976, 524, 524,
+    1296, 1296, 297, 297, -1019, -1019, -865, -865, 277, 277, 676, 676,
+    92, 92, -254, -254, 6, 6, 7, 7, -415, -415, -301, -301,
+    521, 521, 774, 774, -205, -205, -1141, -1141, -684, -684, 438, 438,
+    493, 493, -593, -593, -1154, -1154, -301, -301, 830, 830, 760, 760,
+    -385, -385, -1166, -1166, -612, -612, 713, 713, 1337, 1337, 500, 500,
+    -927, -927, -1350, -1350, -322, -322, 922, 922, 976, 976, -106, -106,
+    -1075, -1075, -1058, -1058, -314, -314, 419, 419, 661, 661, 244, 244,
+    -599, -599, -1045, -1045, -383, -383, 848, 848, 1210, 1210, 223, 223,
+    -901, -901, -840, -840, 165, 165, 770, 770, 274, 274, -701, -701,
+    -1127, -1127, -633, -633, 329, 329, 893, 893, 377, 377, -938, -938,
+    -1664, -1664, -673, -673, 1266, 1266, 2030, 2030, 664, 664, -1315, -1315,
+    -1655, -1655, -37, -37, 1588, 1588, 1352, 1352, -373, -373, -1567, -1567,
+    -1025, -1025, 388, 388, 976, 976, 162, 162, -1012, -1012, -1119, -1119,
+    49, 49, 1163, 1163, 819, 819, -707, -707, -1601, -1601, -662, -662,
+    1067, 1067, 1489, 1489, 184, 184, -1000, -1000, -558, -558, 587, 587,
+    654, 654, -270, -270, -615, -615, 81, 81, 628, 628, 218, 218,
+    -468, -468, -498, -498, 32, 32, 447, 447, 438, 438, 112, 112,
+    -321, -321, -500, -500, -121, -121, 458, 458, 479, 479, -28, -28,
+    -188, -188, 234, 234, 398, 398, -95, -95, -434, -434, 27, 27,
+    699, 699, 728, 728, 172, 172, -385, -385, -594, -594, -299, -299,
+    457, 457, 968, 968, 351, 351, -893, -893, -981, -981, 552, 552,
+    1638, 1638, 558, 558, -1195, -1195, -1027, -1027, 716, 716, 1297, 1297,
+    -93, -93, -1184, -1184, -278, -278, 1233, 1233, 1189, 1189, -126, -126,
+    -738, -738, -101, -101, 402, 402, -23, -23, -384, -384, 195, 195,
+    854, 854, 370, 370, -787, -787, -1049, -1049, -63, -63, 811, 811,
+    550, 550, -103, -103, -24, -24, 393, 393, 54, 54, -700, -700,
+    -446, -446, 848, 848, 1427, 1427, 309, 309, -1171, -1171, -1184, -1184,
+    170, 170, 1176, 1176, 766, 766, -396, -396, -1029, -1029, -680, -680,
+    100, 100, 539, 539, 337, 337, -153, -153, -349, -349, -97, -97,
+    254, 254, 412, 412, 361, 361, 69, 69, -394, -394, -521, -521,
+    76, 76, 814, 814, 692, 692, -253, -253, -864, -864, -413, -413,
+    495, 495, 849, 849, 447, 447, -206, -206, -639, -639, -584, -584,
+    26, 26, 684, 684, 535, 535, -386, -386, -844, -844, -111, -111,
+    790, 790, 513, 513, -583, -583, -942, -942, -46, -46, 942, 942,
+    822, 822, -164, -164, -831, -831, -534, -534, 291, 291, 808, 808,
+    585, 585, -165, -165, -792, -792, -735, -735, -32, -32, 672, 672,
+    699, 699, -54, -54, -938, -938, -1016, -1016, -82, -82, 823, 823,
+    518, 518, -647, -647, -1019, -1019, 88, 88, 1244, 1244, 754, 754,
+    -876, -876, -1466, -1466, -165, -165, 1312, 1312, 1065, 1065, -386, -386,
+    -1022, -1022, -235, -235, 559, 559, 212, 212, -569, -569, -515, -515,
+    245, 245, 474, 474, -229, -229, -860, -860, -542, -542, 291, 291,
+    680, 680, 388, 388, -166, -166, -587, -587, -595, -595, -19, -19,
+    751, 751, 821, 821, -88, -88, -970, -970, -745, -745, 190, 190,
+    532, 532, 48, 48, -221, -221, 144, 144, 204, 204, -553, -553,
+    -1019, -1019, -146, -146, 1165, 1165, 1177, 1177, -168, -168, -1176, -1176,
+    -783, -783, 178, 178, 407, 407, -141, -141, -537, -537, -277, -277,
+    271, 271, 477, 477, 73, 73, -600, -600, -769, -769, -23, -23,
+    946, 946, 941, 941, -196, -196, -1203, -1203, -930, -930, 226, 226,
+    924, 924, 581, 581, -154, -154, -494, -494, -372, -372, -121, -121,
+    103, 103, 275, 275, 278, 278, 21, 21, -383, -383, -692, -692,
+    -685, -685, -293, -293, 249, 249, 444, 444, 10, 10, -659, -659,
+    -799, -799, -177, -177, 539, 539, 577, 577, 77, 77, -91, -91,
+    459, 459, 999, 999, 557, 557, -689, -689, -1327, -1327, -360, -360,
+    1296, 1296, 1584, 1584, -182, -182, -2199, -2199, -2169, -2169, -118, -118,
+    1567, 1567, 1040, 1040, -800, -800, -1548, -1548, -307, -307, 1365, 1365,
+    1547, 1547, 244, 244, -867, -867, -571, -571, 575, 575, 1107, 1107,
+    431, 431, -612, -612, -864, -864, -164, -164, 645, 645, 731, 731,
+    55, 55, -718, -718, -841, -841, -133, -133, 777, 777, 952, 952,
+    136, 136, -787, -787, -710, -710, 279, 279, 912, 912, 411, 411,
+    -465, -465, -537, -537, 172, 172, 642, 642, 363, 363, -138, -138,
+    -218, -218, 90, 90, 369, 369, 380, 380, 145, 145, -163, -163,
+    -227, -227, 140, 140, 560, 560, 393, 393, -314, -314, -697, -697,
+    -223, -223, 539, 539, 683, 683, 87, 87, -583, -583, -692, -692,
+    -185, -185, 450, 450, 583, 583, 27, 27, -643, -643, -619, -619,
+    144, 144, 782, 782, 606, 606, -48, -48, -409, -409, -274, -274,
+    67, 67, 442, 442, 698, 698, 434, 434, -412, -412, -1018, -1018,
+    -549, -549, 553, 553, 929, 929, 77, 77, -935, -935, -856, -856,
+    142, 142, 797, 797, 401, 401, -482, -482, -880, -880, -470, -470,
+    306, 306, 787, 787, 605, 605, -85, -85, -700, -700, -659, -659,
+    72, 72, 804, 804, 737, 737, -105, -105, -789, -789, -573, -573,
+    210, 210, 653, 653, 348, 348, -338, -338, -789, -789, -637, -637,
+    -4, -4, 497, 497, 259, 259, -533, -533, -910, -910, -339, -339,
+    433, 433, 374, 374, -296, -296, -471, -471, 62, 62, 373, 373,
+    11, 11, -312, -312, -54, -54, 259, 259, 34, 34, -386, -386,
+    -352, -352, 78, 78, 357, 357, 248, 248, -77, -77, -396, -396,
+    -458, -458, -62, -62, 483, 483, 464, 464, -199, -199, -650, -650,
+    -387, -387, -59, -59, -277, -277, -501, -501, -91, -91, 362, 362,
+    -24, -24, -762, -762, -641, -641, 263, 263, 640, 640, 55, 55,
+    -387, -387, 75, 75, 643, 643, 401, 401, -162, -162, -104, -104,
+    368, 368, 376, 376, -121, -121, -404, -404, -265, -265, -198, -198,
+    -420, -420, -558, -558, -415, -415, -325, -325, -496, -496, -581, -581,
+    -282, -282, 80, 80, 83, 83, -101, -101, -19, -19, 328, 328,
+    544, 544, 465, 465, 315, 315, 314, 314, 419, 419, 453, 453,
+    332, 332, 113, 113, -88, -88, -202, -202, -264, -264, -384, -384,
+    -584, -584, -687, -687, -543, -543, -335, -335, -367, -367, -561, -561,
+    -520, -520, -130, -130, 250, 250, 307, 307, 165, 165, 117, 117,
+    210, 210, 293, 293, 311, 311, 313, 313, 252, 252, 61, 61,
+    -92, -92, -2, -2, 137, 137, -57, -57, -460, -460, -498, -498,
+    -64, -64, 210, 210, -121, -121, -602, -602, -536, -536, -34, -34,
+    209, 209, -2, -2, -172, -172, -56, -56, -1, -1, -164, -164,
+    -176, -176, 82, 82, 140, 140, -181, -181, -307, -307, 102, 102,
+    408, 408, -15, -15, -610, -610, -388, -388, 427, 427, 616, 616,
+    -140, -140, -722, -722, -315, -315, 382, 382, 331, 331, -280, -280,
+    -492, -492, -48, -48, 385, 385, 263, 263, -199, -199, -457, -457,
+    -292, -292, 65, 65, 227, 227, 2, 2, -414, -414, -576, -576,
+    -285, -285, 124, 124, 188, 188, -73, -73, -244, -244, -115, -115,
+    113, 113, 185, 185, 87, 87, -27, -27, -27, -27, 69, 69,
+    103, 103, -33, -33, -222, -222, -227, -227, -13, -13, 141, 141,
+    -36, -36, -400, -400, -506, -506, -199, -199, 134, 134, 73, 73,
+    -272, -272, -417, -417, -151, -151, 195, 195, 171, 171, -185, -185,
+    -384, -384, -146, -146, 206, 206, 197, 197, -150, -150, -390, -390,
+    -262, -262, 19, 19, 104, 104, -57, -57, -216, -216, -196, -196,
+    -90, -90, -67, -67, -134, -134, -176, -176, -127, -127, -40, -40,
+    -26, -26, -128, -128, -240, -240, -212, -212, -59, -59, 30, 30,
+    -80, -80, -289, -289, -356, -356, -190, -190, 17, 17, 12, 12,
+    -177, -177, -284, -284, -190, -190, -68, -68, -101, -101, -216, -216,
+    -223, -223, -87, -87, 40, 40, 28, 28, -78, -78, -146, -146,
+    -124, -124, -61, -61, -27, -27, -61, -61, -125, -125, -128, -128,
+    -56, -56, -31, -31, -116, -116, -185, -185, -118, -118, -7, -7,
+    -16, -16, -116, -116, -144, -144, -64, -64, -7, -7, -52, -52,
+    -118, -118, -128, -128, -122, -122, -139, -139, -122, -122, -60, -60,
+    -50, -50, -114, -114, -127, -127, -40, -40, 16, 16, -43, -43,
+    -95, -95, -17, -17, 98, 98, 74, 74, -66, -66, -130, -130,
+    -50, -50, 23, 23, -26, -26, -109, -109, -105, -105, -55, -55,
+    -58, -58, -109, -109, -137, -137, -124, -124, -100, -100, -84, -84,
+    -70, -70, -56, -56, -58, -58, -77, -77, -76, -76, -33, -33,
+    13, 13, 11, 11, -25, -25, -47, -47, -38, -38, -22, -22,
+    -27, -27, -55, -55, -71, -71, -50, -50, -20, -20, -18, -18,
+    -26, -26, -4, -4, 21, 21, 0, 0, -53, -53, -68, -68,
+    -22, -22, 18, 18, -16, -16, -89, -89, -103, -103, -45, -45,
+    -1, -1, -25, -25, -70, -70, -78, -78, -48, -48, -11, -11,
+    6, 6, -5, -5, -22, -22, -20, -20, -6, -6, 1, 1,
+    10, 10, 37, 37, 64, 64, 53, 53, 8, 8, -15, -15,
+    13, 13, 44, 44, 28, 28, 2, 2, 22, 22, 47, 47,
+    10, 10, -50, -50, -32, -32, 55, 55, 103, 103, 66, 66,
+    12, 12, 10, 10, 50, 50, 82, 82, 89, 89, 81, 81,
+    60, 60, 29, 29, 15, 15, 30, 30, 44, 44, 33, 33,
+    15, 15, 11, 11, 18, 18, 21, 21, 20, 20, 22, 22,
+    35, 35, 61, 61, 80, 80, 75, 75, 59, 59, 62, 62,
+    84, 84, 94, 94, 81, 81, 69, 69, 72, 72, 70, 70,
+    44, 44, 11, 11, 6, 6, 25, 25, 37, 37, 28, 28,
+    7, 7, -6, -6, 10, 10, 61, 61, 97, 97, 65, 65,
+    -6, -6, -34, -34, 5, 5, 52, 52, 61, 61, 52, 52,
+    50, 50, 33, 33, -9, -9, -32, -32, -2, -2, 40, 40,
+    37, 37, 7, 7, -5, -5, 0, 0, -5, -5, -5, -5,
+    18, 18, 38, 38, 25, 25, 1, 1, 5, 5, 22, 22,
+    14, 14, -15, -15, -22, -22, 1, 1, 12, 12, -7, -7,
+    -28, -28, -22, -22, -12, -12, -22, -22, -42, -42, -49, -49,
+    -41, -41, -35, -35, -37, -37, -32, -32, -4, -4, 25, 25,
+    12, 12, -41, -41, -70, -70, -29, -29, 40, 40, 56, 56,
+    5, 5, -43, -43, -34, -34, 1, 1, -1, -1, -36, -36,
+    -52, -52, -25, -25, 10, 10, 16, 16, -6, -6, -25, -25,
+    -17, -17, 8, 8, 21, 21, 13, 13, 0, 0, -4, -4,
+    -7, -7, -13, -13, -16, -16, -15, -15, -18, -18, -30, -30,
+    -35, -35, -24, -24, -13, -13, -16, -16, -17, -17, 5, 5,
+    21, 21, 0, 0, -25, -25, 0, 0, 45, 45, 37, 37,
+    -24, -24, -48, -48, -1, -1, 43, 43, 16, 16, -36, -36,
+    -27, -27, 28, 28, 40, 40, -5, -5, -33, -33, -12, -12,
+    15, 15, 15, 15, 8, 8, 9, 9, 9, 9, 5, 5,
+    19, 19, 50, 50, 58, 58, 24, 24, -9, -9, 6, 6,
+    46, 46, 50, 50, 7, 7, -30, -30, -22, -22, 13, 13,
+    28, 28, 1, 1, -35, -35, -30, -30, 20, 20, 56, 56,
+    34, 34, -10, -10, -11, -11, 39, 39, 86, 86, 86, 86,
+    50, 50, 20, 20, 13, 13, 22, 22, 35, 35, 46, 46,
+    44, 44, 26, 26, 12, 12, 13, 13, 19, 19, 28, 28,
+    46, 46, 68, 68, 73, 73, 56, 56, 39, 39, 44, 44,
+    71, 71, 89, 89, 70, 70, 35, 35, 32, 32, 71, 71,
+    98, 98, 68, 68, 18, 18, 16, 16, 60, 60, 73, 73,
+    22, 22, -20, -20, 11, 11, 68, 68, 74, 74, 45, 45,
+    49, 49, 88, 88, 106, 106, 88, 88, 74, 74, 83, 83,
+    91, 91, 88, 88, 95, 95, 115, 115, 111, 111, 73, 73,
+    44, 44, 59, 59, 85, 85, 71, 71, 33, 33, 25, 25,
+    65, 65, 108, 108, 99, 99, 49, 49, 22, 22, 56, 56,
+    107, 107, 106, 106, 58, 58, 30, 30, 64, 64, 120, 120,
+    133, 133, 96, 96, 60, 60, 63, 63, 84, 84, 92, 92,
+    82, 82, 64, 64, 51, 51, 52, 52, 67, 67, 77, 77,
+    72, 72, 59, 59, 53, 53, 62, 62, 77, 77, 74, 74,
+    54, 54, 45, 45, 63, 63, 85, 85, 83, 83, 61, 61,
+    39, 39, 30, 30, 30, 30, 34, 34, 42, 42, 58, 58,
+    70, 70, 64, 64, 43, 43, 24, 24, 15, 15, 16, 16,
+    28, 28, 34, 34, 21, 21, 6, 6, 14, 14, 36, 36,
+    43, 43, 32, 32, 22, 22, 23, 23, 30, 30, 36, 36,
+    37, 37, 38, 38, 42, 42, 39, 39, 24, 24, 10, 10,
+    11, 11, 22, 22, 19, 19, -8, -8, -39, -39, -29, -29,
+    24, 24, 50, 50, 5, 5, -58, -58, -62, -62, -14, -14,
+    23, 23, 19, 19, -1, -1, -12, -12, -5, -5, 9, 9,
+    16, 16, 8, 8, -6, -6, -9, -9, 5, 5, 19, 19,
+    10, 10, -16, -16, -33, -33, -37, -37, -37, -37, -26, -26,
+    -4, -4, 2, 2, -21, -21, -34, -34, -10, -10, 15, 15,
+    3, 3, -23, -23, -25, -25, -13, -13, -23, -23, -50, -50,
+    -57, -57, -31, -31, -9, -9, -22, -22, -48, -48, -54, -54,
+    -34, -34, -11, -11, -1, -1, -9, -9, -26, -26, -29, -29,
+    -14, -14, -4, -4, -18, -18, -32, -32, -19, -19, 5, 5,
+    0, 0, -35, -35, -51, -51, -21, -21, 14, 14, 0, 0,
+    -54, -54, -74, -74, -30, -30, 18, 18, 4, 4, -46, -46,
+    -58, -58, -18, -18, 19, 19, 19, 19, 1, 1, -10, -10,
+    -21, -21, -37, -37, -42, -42, -29, -29, -22, -22, -28, -28,
+    -20, -20, 4, 4, 3, 3, -34, -34, -53, -53, -20, -20,
+    16, 16, 3, 3, -35, -35, -37, -37, -3, -3, 19, 19,
+    14, 14, 2, 2, -1, -1, -2, -2, -8, -8, -19, -19,
+    -26, -26, -20, -20, 2, 2, 20, 20, 13, 13, -17, -17,
+    -34, -34, -14, -14, 17, 17, 22, 22, 0, 0, -21, -21,
+    -18, -18, 6, 6, 34, 34, 31, 31, -12, -12, -50, -50,
+    -34, -34, 16, 16, 35, 35, 5, 5, -28, -28, -26, -26,
+    -1, -1, 12, 12, -4, -4, -30, -30, -36, -36, -9, -9,
+    32, 32, 47, 47, 23, 23, -8, -8, -2, -2, 31, 31,
+    44, 44, 21, 21, -3, -3, 0, 0, 16, 16, 21, 21,
+    11, 11, -5, -5, -11, -11, 4, 4, 21, 21, 9, 9,
+    -29, -29, -44, -44, -13, -13, 21, 21, 12, 12, -22, -22,
+    -25, -25, 13, 13, 39, 39, 21, 21, -5, -5, 9, 9,
+    47, 47, 51, 51, 14, 14, -8, -8, 15, 15, 44, 44,
+    26, 26, -21, -21, -34, -34, 0, 0, 20, 20, -12, -12,
+    -46, -46, -32, -32, 2, 2, 2, 2, -16, -16, -5, -5,
+    21, 21, 16, 16, -18, -18, -30, -30, -8, -8, 15, 15,
+    17, 17, 7, 7, -6, -6, -20, -20, -23, -23, 0, 0,
+    19, 19, -2, -2, -44, -44, -46, -46, -7, -7, 12, 12,
+    -16, -16, -44, -44, -40, -40, -29, -29, -31, -31, -28, -28,
+    -13, -13, -12, -12, -31, -31, -35, -35, -4, -4, 25, 25,
+    11, 11, -26, -26, -32, -32, 0, 0, 13, 13, -22, -22,
+    -63, -63, -61, -61, -27, -27, -16, -16, -45, -45, -74, -74,
+    -61, -61, -29, -29, -27, -27, -60, -60, -74, -74, -41, -41,
+    0, 0, -5, -5, -44, -44, -69, -69, -53, -53, -21, -21,
+    -12, -12, -39, -39, -68, -68, -62, -62, -32, -32, -20, -20,
+    -43, -43, -69, -69, -67, -67, -48, -48, -45, -45, -63, -63,
+    -74, -74, -65, -65, -57, -57, -64, -64, -70, -70, -61, -61,
+    -52, -52, -56, -56, -62, -62, -62, -62, -61, -61, -67, -67,
+    -71, -71, -64, -64, -51, -51, -48, -48, -59, -59, -73, -73,
+    -71, -71, -57, -57, -53, -53, -65, -65, -76, -76, -71, -71,
+    -62, -62, -62, -62, -64, -64, -56, -56, -50, -50, -63, -63,
+    -84, -84, -78, -78, -47, -47, -35, -35, -61, -61, -88, -88,
+    -83, -83, -62, -62, -58, -58, -68, -68, -75, -75, -80, -80,
+    -81, -81, -64, -64, -39, -39, -35, -35, -60, -60, -78, -78,
+    -59, -59, -31, -31, -34, -34, -63, -63, -77, -77, -61, -61,
+    -43, -43, -44, -44, -56, -56, -67, -67, -70, -70, -63, -63,
+    -51, -51, -49, -49, -63, -63, -74, -74, -63, -63, -45, -45,
+    -44, -44, -58, -58, -63, -63, -50, -50, -37, -37, -43, -43,
+    -55, -55, -51, -51, -36, -36, -33, -33, -50, -50, -62, -62,
+    -46, -46, -21, -21, -21, -21, -51, -51, -74, -74, -59, -59,
+    -26, -26, -19, -19, -46, -46, -69, -69, -61, -61, -37, -37,
+    -23, -23, -29, -29, -42, -42, -46, -46, -35, -35, -17, -17,
+    -10, -10, -25, -25, -46, -46, -43, -43, -16, -16, 1, 1,
+    -17, -17, -49, -49, -52, -52, -26, -26, -7, -7, -14, -14,
+    -30, -30, -32, -32, -20, -20, -12, -12, -18, -18, -30, -30,
+    -34, -34, -23, -23, -8, -8, -3, -3, -14, -14, -25, -25,
+    -22, -22, -6, -6, 5, 5, 1, 1, -9, -9, -12, -12,
+    -8, -8, -8, -8, -12, -12, -14, -14, -9, -9, -5, -5,
+    -10, -10, -20, -20, -24, -24, -17, -17, -9, -9, -8, -8,
+    -13, -13, -17, -17, -17, -17, -15, -15, -13, -13, -9, -9,
+    -7, -7, -9, -9, -13, -13, -13, -13, -9, -9, -6, -6,
+    -8, -8, -11, -11, -15, -15, -19, -19, -15, -15, -3, -3,
+    -1, -1, -17, -17, -34, -34, -28, -28, -2, -2, 8, 8,
+    -13, -13, -34, -34, -28, -28, -5, -5, 2, 2, -12, -12,
+    -27, -27, -29, -29, -18, -18, -5, -5, 0, 0, -10, -10,
+    -26, -26, -29, -29, -13, -13, -1, -1, -10, -10, -26, -26,
+    -23, -23, -6, -6, -2, -2, -17, -17, -32, -32, -29, -29,
+    -13, -13, -6, -6, -12, -12, -23, -23, -29, -29, -22, -22,
+    -8, -8, -6, -6, -23, -23, -39, -39, -32, -32, -8, -8,
+    2, 2, -17, -17, -41, -41, -40, -40, -15, -15, 0, 0,
+    -14, -14, -39, -39, -46, -46, -26, -26, -4, -4, -6, -6,
+    -28, -28, -43, -43, -32, -32, -10, -10, -8, -8, -29, -29,
+    -46, -46, -38, -38, -19, -19, -15, -15, -32, -32, -45, -45,
+    -38, -38, -19, -19, -12, -12, -26, -26, -47, -47, -49, -49,
+    -28, -28, -7, -7, -11, -11, -36, -36, -54, -54, -41, -41,
+    -14, -14, -7, -7, -27, -27, -43, -43, -35, -35, -15, -15,
+    -13, -13, -33, -33, -49, -49, -42, -42, -24, -24, -18, -18,
+    -32, -32, -48, -48, -48, -48, -32, -32, -19, -19, -22, -22,
+    -40, -40, -49, -49, -36, -36, -16, -16, -17, -17, -39, -39,
+    -56, -56, -45, -45, -23, -23, -18, -18, -32, -32, -44, -44,
+    -43, -43, -34, -34, -29, -29, -27, -27, -27, -27, -36, -36,
+    -45, -45, -42, -42, -29, -29, -28, -28, -41, -41, -47, -47,
+    -35, -35, -22, -22, -29, -29, -43, -43, -41, -41, -26, -26,
+    -23, -23, -36, -36, -40, -40, -25, -25, -14, -14, -24, -24,
+    -41, -41, -41, -41, -28, -28, -18, -18, -21, -21, -28, -28,
+    -31, -31, -33, -33, -31, -31, -22, -22, -11, -11, -12, -12,
+    -23, -23, -34, -34, -33, -33, -23, -23, -16, -16, -15, -15,
+    -20, -20, -26, -26, -32, -32, -31, -31, -21, -21, -10, -10,
+    -10, -10, -20, -20, -26, -26, -20, -20, -10, -10, -9, -9,
+    -14, -14, -15, -15, -11, -11, -8, -8, -9, -9, -10, -10,
+    -10, -10, -10, -10, -14, -14, -15, -15, -12, -12, -11, -11,
+    -14, -14, -17, -17, -16, -16, -14, -14, -14, -14, -12, -12,
+    -8, -8, -6, -6, -8, -8, -11, -11, -9, -9, -3, -3,
+    1, 1, -2, -2, -9, -9, -13, -13, -10, -10, -4, -4,
+    0, 0, -3, -3, -11, -11, -16, -16, -11, -11, -3, -3,
+    2, 2, -4, -4, -13, -13, -15, -15, -7, -7, 0, 0,
+    -5, -5, -14, -14, -15, -15, -6, -6, 2, 2, -2, -2,
+    -12, -12, -16, -16, -10, -10, -3, -3, -3, -3, -7, -7,
+    -9, -9, -6, -6, -4, -4, -7, -7, -10, -10, -10, -10,
+    -7, -7, -5, -5, -7, -7, -15, -15, -18, -18, -10, -10,
+    1, 1, 1, 1, -10, -10, -18, -18, -13, -13, -2, -2,
+    1, 1, -9, -9, -15, -15, -8, -8, 5, 5, 6, 6,
+    -11, -11, -28, -28, -25, -25, -3, -3, 11, 11, -2, -2,
+    -26, -26, -34, -34, -17, -17, 2, 2, -3, -3, -25, -25,
+    -38, -38, -26, -26, -5, -5, 3, 3, -11, -11, -26, -26,
+    -27, -27, -14, -14, -5, -5, -12, -12, -25, -25, -26, -26,
+    -14, -14, -6, -6, -15, -15, -31, -31, -33, -33, -18, -18,
+    -8, -8, -14, -14, -29, -29, -36, -36, -32, -32, -25, -25,
+    -21, -21, -20, -20, -23, -23, -29, -29, -31, -31, -25, -25,
+    -19, -19, -21, -21, -28, -28, -33, -33, -29, -29, -21, -21,
+    -19, -19, -23, -23, -26, -26, -27, -27, -26, -26, -25, -25,
+    -25, -25, -24, -24, -23, -23, -28, -28, -36, -36, -40, -40,
+    -32, -32, -19, -19, -15, -15, -21, -21, -29, -29, -34, -34,
+    -34, -34, -29, -29, -18, -18, -10, -10, -14, -14, -26, -26,
+    -30, -30, -24, -24, -17, -17, -20, -20, -26, -26, -25, -25,
+    -18, -18, -16, -16, -23, -23, -31, -31, -31, -31, -24, -24,
+    -16, -16, -14, -14, -17, -17, -21, -21, -21, -21, -20, -20,
+    -20, -20, -19, -19, -17, -17, -14, -14, -16, -16, -20, -20,
+    -18, -18, -14, -14, -13, -13, -19, -19, -25, -25, -22, -22,
+    -14, -14, -9, -9, -12, -12, -18, -18, -21, -21, -18, -18,
+    -13, -13, -10, -10, -11, -11, -15, -15, -14, -14, -10, -10,
+    -7, -7, -8, -8, -13, -13, -19, -19, -18, -18, -10, -10,
+    -3, -3, -4, -4, -10, -10, -13, -13, -11, -11, -10, -10,
+    -11, -11, -11, -11, -9, -9, -7, -7, -9, -9, -7, -7,
+    -4, -4, -6, -6, -14, -14, -17, -17, -7, -7, 4, 4,
+    0, 0, -13, -13, -19, -19, -10, -10, 2, 2, 4, 4,
+    -6, -6, -14, -14, -12, -12, -4, -4, 1, 1, -1, -1,
+    -7, -7, -8, -8, -4, -4, 0, 0, 0, 0, -1, -1,
+    0, 0, 2, 2, 2, 2, 2, 2, 3, 3, 4, 4,
+    3, 3, 2, 2, 2, 2, 0, 0, -3, -3, -4, -4,
+    -1, -1, 2, 2, 2, 2, 1, 1, 2, 2, 4, 4,
+    4, 4, 2, 2, 0, 0, 3, 3, 8, 8, 8, 8,
+    3, 3, 0, 0, 1, 1, 3, 3, 2, 2, -1, -1,
+    3, 3, 11, 11, 13, 13, 2, 2, -10, -10, -8, -8,
+    5, 5, 13, 13, 8, 8, 0, 0, -3, -3, 1, 1,
+    5, 5, 3, 3, 0, 0, -1, -1, 1, 1, 3, 3,
+    2, 2, -3, -3, -5, -5, -2, -2, 2, 2, 3, 3,
+    2, 2, 1, 1, 0, 0, -5, -5, -10, -10, -8, -8,
+    0, 0, 4, 4, -3, -3, -15, -15, -18, -18, -8, -8,
+    4, 4, 4, 4, -9, -9, -22, -22, -21, -21, -12, -12,
+    -6, -6, -6, -6, -11, -11, -14, -14, -12, -12, -9, -9,
+    -8, -8, -10, -10, -15, -15, -19, -19, -19, -19, -14, -14,
+    -10, -10, -13, -13, -20, -20, -26, -26, -24, -24, -15, -15,
+    -8, -8, -12, -12, -20, -20, -22, -22, -18, -18, -16, -16,
+    -20, -20, -25, -25, -26, -26, -22, -22, -17, -17, -17, -17,
+    -24, -24, -33, -33, -36, -36, -31, -31, -23, -23, -22, -22,
+    -31, -31, -39, -39, -36, -36, -26, -26, -20, -20, -23, -23,
+    -31, -31, -36, -36, -33, -33, -24, -24, -19, -19, -24, -24,
+    -35, -35, -43, -43, -39, -39, -29, -29, -24, -24, -31, -31,
+    -42, -42, -47, -47, -45, -45, -38, -38, -32, -32, -31, -31,
+    -37, -37, -46, -46, -48, -48, -38, -38, -24, -24, -23, -23,
+    -35, -35, -45, -45, -44, -44, -34, -34, -28, -28, -31, -31,
+    -37, -37, -39, -39, -39, -39, -38, -38, -36, -36, -34, -34,
+    -36, -36, -40, -40, -43, -43, -40, -40, -35, -35, -33, -33,
+    -35, -35, -36, -36, -33, -33, -28, -28, -29, -29, -36, -36,
+    -43, -43, -41, -41, -31, -31, -25, -25, -29, -29, -36, -36,
+    -40, -40, -38, -38, -35, -35, -32, -32, -29, -29, -29, -29,
+    -32, -32, -35, -35, -34, -34, -32, -32, -30, -30, -30, -30,
+    -28, -28, -27, -27, -28, -28, -29, -29, -28, -28, -25, -25,
+    -23, -23, -23, -23, -21, -21, -17, -17, -14, -14, -15, -15,
+    -19, -19, -21, -21, -20, -20, -15, -15, -12, -12, -13, -13,
+    -15, -15, -18, -18, -19, -19, -18, -18, -13, -13, -7, -7,
+    -7, -7, -12, -12, -16, -16, -12, -12, -7, -7, -6, -6,
+    -6, -6, -3, -3, -1, -1, -5, -5, -8, -8, -3, -3,
+    4, 4, 3, 3, -5, -5, -8, -8, -2, -2, 5, 5,
+    6, 6, 5, 5, 2, 2, 1, 1, 5, 5, 14, 14,
+    18, 18, 10, 10, 3, 3, 9, 9, 22, 22, 23, 23,
+    12, 12, 5, 5, 11, 11, 22, 22, 26, 26, 22, 22,
+    13, 13, 4, 4, 6, 6, 20, 20, 34, 34, 35, 35,
+    22, 22, 7, 7, 3, 3, 12, 12, 28, 28, 38, 38,
+    33, 33, 20, 20, 13, 13, 20, 20, 30, 30, 34, 34,
+    29, 29, 23, 23, 23, 23, 30, 30, 36, 36, 36, 36,
+    29, 29, 26, 26, 30, 30, 35, 35, 35, 35, 33, 33,
+    35, 35, 34, 34, 27, 27, 24, 24, 32, 32, 41, 41,
+    38, 38, 30, 30, 28, 28, 30, 30, 31, 31, 34, 34,
+    40, 40, 41, 41, 37, 37, 33, 33, 35, 35, 39, 39,
+    38, 38, 38, 38, 41, 41, 43, 43, 39, 39, 33, 33,
+    34, 34, 41, 41, 45, 45, 42, 42, 37, 37, 34, 34,
+    34, 34, 37, 37, 40, 40, 38, 38, 32, 32, 27, 27,
+    27, 27, 33, 33, 43, 43, 48, 48, 39, 39, 27, 27,
+    29, 29, 38, 38, 38, 38, 33, 33, 38, 38, 45, 45,
+    38, 38, 25, 25, 26, 26, 39, 39, 43, 43, 32, 32,
+    25, 25, 34, 34, 40, 40, 33, 33, 29, 29, 38, 38,
+    42, 42, 34, 34, 37, 37, 51, 51, 50, 50, 33, 33,
+    27, 27, 42, 42, 50, 50, 41, 41, 32, 32, 38, 38,
+    42, 42, 34, 34, 30, 30, 39, 39, 47, 47, 42, 42,
+    37, 37, 38, 38, 37, 37, 35, 35, 40, 40, 48, 48,
+    44, 44, 34, 34, 36, 36, 51, 51, 55, 55, 42, 42,
+    39, 39, 51, 51, 53, 53, 42, 42, 48, 48, 68, 68,
+    70, 70, 54, 54, 50, 50, 61, 61, 68, 68, 64, 64,
+    59, 59, 58, 58, 57, 57, 53, 53, 54, 54, 60, 60,
+    56, 56, 38, 38, 35, 35, 57, 57, 72, 72, 64, 64,
+    60, 60, 69, 69, 65, 65, 49, 49, 55, 55, 87, 87,
+    104, 104, 83, 83, 53, 53, 54, 54, 79, 79, 86, 86,
+    64, 64, 53, 53, 73, 73, 85, 85, 65, 65, 47, 47,
+    69, 69, 105, 105, 109, 109, 83, 83, 67, 67, 84, 84,
+    111, 111, 119, 119, 108, 108, 90, 90, 69, 69, 53, 53,
+    66, 66, 103, 103, 121, 121, 101, 101, 81, 81, 90, 90,
+    99, 99, 79, 79, 56, 56, 63, 63, 86, 86, 90, 90,
+    72, 72, 60, 60, 66, 66, 79, 79, 91, 91, 96, 96,
+    92, 92, 84, 84, 90, 90, 111, 111, 120, 120, 101, 101,
+    77, 77, 73, 73, 77, 77, 69, 69, 66, 66, 73, 73,
+    68, 68, 59, 59, 86, 86, 136, 136, 150, 150, 131, 131,
+    136, 136, 165, 165, 164, 164, 129, 129, 112, 112, 126, 126,
+    123, 123, 80, 80, 41, 41, 37, 37, 48, 48, 56, 56,
+    90, 90, 144, 144, 167, 167, 174, 174, 232, 232, 293, 293,
+    260, 260, 205, 205, 252, 252, 299, 299, 165, 165, -49, -49,
+    -97, -97, 14, 14, 82, 82, 73, 73, 100, 100, 110, 110,
+    -29, -29, -133, -133, 163, 163, 744, 744, 1013, 1013, 787, 787,
+    616, 616, 840, 840, 1033, 1033, 828, 828, 563, 563, 567, 567,
+    525, 525, 135, 135, -265, -265, -293, -293, -194, -194, -342, -342,
+    -546, -546, -421, -421, -143, -143, -144, -144, -288, -288, -120, -120,
+    227, 227, 251, 251, 62, 62, 178, 178, 479, 479, 387, 387,
+    -17, -17, -107, -107, 149, 149, 144, 144, -271, -271, -534, -534,
+    -357, -357, -184, -184, -374, -374, -569, -569, -360, -360, -19, -19,
+    24, 24, -58, -58, 110, 110, 378, 378, 390, 390, 246, 246,
+    261, 261, 374, 374, 310, 310, 104, 104, 2, 2, -12, -12,
+    -166, -166, -426, -426, -494, -494, -331, -331, -248, -248, -349, -349,
+    -330, -330, -32, -32, 237, 237, 222, 222, 169, 169, 364, 364,
+    580, 580, 471, 471, 230, 230, 232, 232, 258, 258, -154, -154,
+    -716, -716, -656, -656, -10, -10, 293, 293, -162, -162, -657, -657,
+    -503, -503, -62, -62, 14, 14, -75, -75, 228, 228, 717, 717,
+    774, 774, 498, 498, 447, 447, 571, 571, 419, 419, 99, 99,
+    78, 78, 266, 266, 184, 184, -148, -148, -224, -224, 59, 59,
+    231, 231, 67, 67, -62, -62, 81, 81, 157, 157, -81, -81,
+    -279, -279, -119, -119, 130, 130, 115, 115, -44, -44, -87, -87,
+    -41, -41, -34, -34, -30, -30, 58, 58, 184, 184, 205, 205,
+    47, 47, -160, -160, -194, -194, -32, -32, 97, 97, 26, 26,
+    -114, -114, -114, -114, 9, 9, 72, 72, 31, 31, 43, 43,
+    184, 184, 320, 320, 379, 379, 454, 454, 503, 503, 332, 332,
+    62, 62, 96, 96, 395, 395, 397, 397, -65, -65, -421, -421,
+    -284, -284, -32, -32, -98, -98, -263, -263, -142, -142, 112, 112,
+    117, 117, -23, -23, 92, 92, 406, 406, 473, 473, 249, 249,
+    175, 175, 388, 388, 478, 478, 208, 208, -83, -83, -35, -35,
+    200, 200, 232, 232, -6, -6, -216, -216, -170, -170, 32, 32,
+    161, 161, 198, 198, 292, 292, 438, 438, 456, 456, 338, 338,
+    317, 317, 459, 459, 503, 503, 297, 297, 92, 92, 128, 128,
+    201, 201, -2, -2, -334, -334, -383, -383, -160, -160, -98, -98,
+    -315, -315, -437, -437, -289, -289, -172, -172, -244, -244, -223, -223,
+    24, 24, 169, 169, 9, 9, -151, -151, -36, -36, 139, 139,
+    87, 87, -38, -38, 38, 38, 188, 188, 122, 122, -54, -54,
+    -14, -14, 167, 167, 131, 131, -101, -101, -140, -140, 103, 103,
+    275, 275, 159, 159, -50, -50, -102, -102, 0, 0, 106, 106,
+    96, 96, -40, -40, -156, -156, -72, -72, 133, 133, 130, 130,
+    -150, -150, -298, -298, -39, -39, 234, 234, 38, 38, -351, -351,
+    -293, -293, 178, 178, 423, 423, 238, 238, 71, 71, 182, 182,
+    300, 300, 261, 261, 277, 277, 377, 377, 243, 243, -138, -138,
+    -301, -301, -82, -82, 65, 65, -155, -155, -383, -383, -265, -265,
+    -44, -44, -65, -65, -156, -156, 25, 25, 358, 358, 472, 472,
+    340, 340, 251, 251, 331, 331, 445, 445, 461, 461, 358, 358,
+    183, 183, 44, 44, 47, 47, 122, 122, 104, 104, -8, -8,
+    -59, -59, -21, -21, -10, -10, -40, -40, -8, -8, 72, 72,
+    79, 79, 32, 32, 57, 57, 134, 134, 142, 142, 109, 109,
+    156, 156, 236, 236, 228, 228, 184, 184, 234, 234, 347, 347,
+    391, 391, 333, 333, 207, 207, 39, 39, -94, -94, -141, -141,
+    -235, -235, -489, -489, -592, -592, -121, -121, 649, 649, 894, 894,
+    479, 479, 265, 265, 746, 746, 1224, 1224, 1009, 1009, 541, 541,
+    510, 510, 653, 653, 388, 388, -26, -26, -1, -1, 224, 224,
+    6, 6, -456, -456, -397, -397, 143, 143, 354, 354, 28, 28,
+    -178, -178, 54, 54, 275, 275, 174, 174, 19, 19, 0, 0,
+    -71, -71, -237, -237, -265, -265, -180, -180, -298, -298, -576, -576,
+    -552, -552, -144, -144, 105, 105, -101, -101, -322, -322, -125, -125,
+    234, 234, 302, 302, 148, 148, 111, 111, 201, 201, 194, 194,
+    86, 86, 59, 59, 89, 89, -34, -34, -290, -290, -421, -421,
+    -387, -387, -463, -463, -701, -701, -742, -742, -415, -415, -111, -111,
+    -185, -185, -340, -340, -84, -84, 410, 410, 510, 510, 177, 177,
+    94, 94, 508, 508, 722, 722, 219, 219, -401, -401, -340, -340,
+    147, 147, 220, 220, -198, -198, -410, -410, -136, -136, 139, 139,
+    82, 82, 15, 15, 223, 223, 434, 434, 370, 370, 278, 278,
+    446, 446, 649, 649, 544, 544, 269, 269, 185, 185, 280, 280,
+    236, 236, -14, -14, -209, -209, -209, -209, -184, -184, -268, -268,
+    -322, -322, -208, -208, -37, -37, 26, 26, 26, 26, 99, 99,
+    263, 263, 448, 448, 597, 597, 641, 641, 494, 494, 220, 220,
+    57, 57, 103, 103, 114, 114, -144, -144, -466, -466, -482, -482,
+    -266, -266, -234, -234, -460, -460, -556, -556, -302, -302, 33, 33,
+    136, 136, 76, 76, 64, 64, 112, 112, 140, 140, 186, 186,
+    258, 258, 214, 214, -5, -5, -220, -220, -274, -274, -239, -239,
+    -237, -237, -275, -275, -346, -346, -477, -477, -574, -574, -490, -490,
+    -284, -284, -185, -185, -220, -220, -161, -161, 57, 57, 197, 197,
+    136, 136, 98, 98, 258, 258, 435, 435, 392, 392, 186, 186,
+    27, 27, -10, -10, 5, 5, -13, -13, -101, -101, -224, -224,
+    -271, -271, -194, -194, -95, -95, -76, -76, -58, -58, 58, 58,
+    162, 162, 106, 106, 28, 28, 142, 142, 305, 305, 210, 210,
+    -42, -42, -55, -55, 184, 184, 234, 234, -90, -90, -398, -398,
+    -301, -301, 9, 9, 67, 67, -175, -175, -335, -335, -198, -198,
+    29, 29, 100, 100, 42, 42, 2, 2, -3, -3, -19, -19,
+    11, 11, 146, 146, 226, 226, 25, 25, -315, -315, -352, -352,
+    -20, -20, 169, 169, -128, -128, -533, -533, -525, -525, -221, -221,
+    -108, -108, -270, -270, -373, -373, -300, -300, -262, -262, -289, -289,
+    -163, -163, 75, 75, 96, 96, -119, -119, -189, -189, 24, 24,
+    186, 186, 62, 62, -164, -164, -278, -278, -329, -329, -390, -390,
+    -381, -381, -295, -295, -295, -295, -403, -403, -384, -384, -141, -141,
+    61, 61, 7, 7, -88, -88, 61, 61, 326, 326, 381, 381,
+    206, 206, 60, 60, 56, 56, 47, 47, -61, -61, -148, -148,
+    -119, -119, -111, -111, -253, -253, -370, -370, -210, -210, 94, 94,
+    155, 155, -73, -73, -176, -176, 105, 105, 460, 460, 475, 475,
+    242, 242, 161, 161, 294, 294, 350, 350, 231, 231, 142, 142,
+    149, 149, 84, 84, -79, -79, -141, -141, -59, -59, -45, -45,
+    -187, -187, -282, -282, -169, -169, 17, 17, 74, 74, 6, 6,
+    -63, -63, -74, -74, -24, -24, 69, 69, 120, 120, 32, 32,
+    -143, -143, -271, -271, -333, -333, -398, -398, -421, -421, -300, -300,
+    -106, -106, -48, -48, -179, -179, -329, -329, -353, -353, -260, -260,
+    -106, -106, 49, 49, 81, 81, -81, -81, -246, -246, -154, -154,
+    130, 130, 264, 264, 124, 124, -28, -28, 10, 10, 59, 59,
+    -116, -116, -368, -368, -372, -372, -139, -139, -13, -13, -161, -161,
+    -365, -365, -371, -371, -215, -215, -65, -65, 47, 47, 178, 178,
+    288, 288, 304, 304, 306, 306, 418, 418, 559, 559, 539, 539,
+    387, 387, 314, 314, 345, 345, 286, 286, 98, 98, 10, 10,
+    148, 148, 311, 311, 288, 288, 198, 198, 274, 274, 481, 481,
+    616, 616, 661, 661, 731, 731, 793, 793, 745, 745, 663, 663,
+    692, 692, 768, 768, 710, 710, 540, 540, 450, 450, 485, 485,
+    473, 473, 307, 307, 103, 103, -6, -6, -32, -32, -1, -1,
+    132, 132, 314, 314, 356, 356, 211, 211, 78, 78, 115, 115,
+    210, 210, 172, 172, 0, 0, -150, -150, -198, -198, -213, -213,
+    -259, -259, -309, -309, -326, -326, -332, -332, -332, -332, -293, -293,
+    -228, -228, -207, -207, -242, -242, -278, -278, -277, -277, -265, -265,
+    -287, -287, -348, -348, -411, -411, -446, -446, -475, -475, -539, -539,
+    -609, -609, -605, -605, -499, -499, -393, -393, -416, -416, -555, -555,
+    -640, -640, -561, -561, -409, -409, -323, -323, -312, -312, -323, -323,
+    -367, -367, -436, -436, -425, -425, -281, -281, -141, -141, -164, -164,
+    -272, -272, -249, -249, -67, -67, 72, 72, 49, 49, -24, -24,
+    -23, -23, 35, 35, 96, 96, 146, 146, 144, 144, 54, 54,
+    -21, -21, 61, 61, 239, 239, 296, 296, 194, 194, 144, 144,
+    259, 259, 375, 375, 343, 343, 284, 284, 355, 355, 459, 459,
+    440, 440, 372, 372, 412, 412, 504, 504, 499, 499, 444, 444,
+    480, 480, 544, 544, 455, 455, 256, 256, 194, 194, 336, 336,
+    464, 464, 402, 402, 254, 254, 198, 198, 244, 244, 305, 305,
+    354, 354, 398, 398, 407, 407, 373, 373, 341, 341, 312, 312,
+    237, 237, 136, 136, 102, 102, 134, 134, 111, 111, -16, -16,
+    -145, -145, -197, -197, -231, -231, -305, -305, -346, -346, -281, -281,
+    -192, -192, -196, -196, -251, -251, -240, -240, -184, -184, -200, -200,
+    -282, -282, -313, -313, -275, -275, -292, -292, -423, -423, -571, -571,
+    -621, -621, -591, -591, -567, -567, -573, -573, -564, -564, -532, -532,
+    -519, -519, -520, -520, -469, -469, -361, -361, -292, -292, -318, -318,
+    -343, -343, -248, -248, -76, -76, 7, 7, -69, -69, -186, -186,
+    -212, -212, -193, -193, -243, -243, -347, -347, -388, -388, -331, -331,
+    -239, -239, -163, -163, -92, -92, -11, -11, 83, 83, 186, 186,
+    277, 277, 330, 330, 350, 350, 360, 360, 348, 348, 291, 291,
+    218, 218, 186, 186, 181, 181, 124, 124, 20, 20, -29, -29,
+    7, 7, 25, 25, -31, -31, -58, -58, 32, 32, 145, 145,
+    152, 152, 96, 96, 113, 113, 214, 214, 282, 282, 253, 253,
+    175, 175, 125, 125, 121, 121, 114, 114, 44, 44, -86, -86,
+    -188, -188, -207, -207, -204, -204, -254, -254, -308, -308, -283, -283,
+    -238, -238, -289, -289, -395, -395, -389, -389, -244, -244, -119, -119,
+    -119, -119, -160, -160, -151, -151, -134, -134, -153, -153, -153, -153,
+    -113, -113, -110, -110, -173, -173, -217, -217, -209, -209, -241, -241,
+    -360, -360, -455, -455, -417, -417, -295, -295, -225, -225, -237, -237,
+    -243, -243, -170, -170, -73, -73, -48, -48, -86, -86, -94, -94,
+    -34, -34, 8, 8, -65, -65, -188, -188, -203, -203, -85, -85,
+    -10, -10, -95, -95, -228, -228, -252, -252, -210, -210, -223, -223,
+    -263, -263, -225, -225, -127, -127, -80, -80, -102, -102, -105, -105,
+    -31, -31, 87, 87, 195, 195, 262, 262, 274, 274, 217, 217,
+    116, 116, 28, 28, -22, -22, -69, -69, -129, -129, -160, -160,
+    -151, -151, -161, -161, -241, -241, -337, -337, -326, -326, -158, -158,
+    48, 48, 131, 131, 93, 93, 77, 77, 123, 123, 106, 106,
+    -15, -15, -99, -99, -57, -57, -11, -11, -85, -85, -208, -208,
+    -252, -252, -234, -234, -254, -254, -293, -293, -242, -242, -113, -113,
+    -36, -36, -61, -61, -105, -105, -132, -132, -180, -180, -232, -232,
+    -205, -205, -102, -102, -21, -21, -10, -10, -31, -31, -50, -50,
+    -77, -77, -112, -112, -131, -131, -137, -137, -160, -160, -203, -203,
+    -239, -239, -250, -250, -254, -254, -269, -269, -291, -291, -303, -303,
+    -295, -295, -249, -249, -161, -161, -55, -55, 42, 42, 112, 112,
+    150, 150, 144, 144, 92, 92, 16, 16, -46, -46, -88, -88,
+    -136, -136, -208, -208, -289, -289, -345, -345, -370, -370, -394, -394,
+    -428, -428, -422, -422, -331, -331, -201, -201, -126, -126, -104, -104,
+    -51, -51, 40, 40, 76, 76, 18, 18, -55, -55, -68, -68,
+    -54, -54, -88, -88, -178, -178, -277, -277, -360, -360, -428, -428,
+    -459, -459, -428, -428, -367, -367, -331, -331, -319, -319, -284, -284,
+    -208, -208, -122, -122, -61, -61, -24, -24, 9, 9, 46, 46,
+    59, 59, 11, 11, -87, -87, -172, -172, -204, -204, -213, -213,
+    -245, -245, -294, -294, -317, -317, -276, -276, -165, -165, -26, -26,
+    59, 59, 50, 50, 6, 6, 13, 13, 72, 72, 114, 114,
+    98, 98, 42, 42, -29, -29, -100, -100, -149, -149, -161, -161,
+    -172, -172, -238, -238, -338, -338, -374, -374, -296, -296, -165, -165,
+    -59, -59, -1, -1, 18, 18, 28, 28, 84, 84, 174, 174,
+    188, 188, 76, 76, -42, -42, -50, -50, -9, -9, -50, -50,
+    -161, -161, -234, -234, -257, -257, -314, -314, -407, -407, -429, -429,
+    -340, -340, -232, -232, -178, -178, -137, -137, -90, -90, -92, -92,
+    -151, -151, -176, -176, -124, -124, -68, -68, -82, -82, -148, -148,
+    -209, -209, -238, -238, -245, -245, -255, -255, -294, -294, -361, -361,
+    -432, -432, -476, -476, -469, -469, -388, -388, -259, -259, -167, -167,
+    -162, -162, -179, -179, -123, -123, -8, -8, 58, 58, 33, 33,
+    -14, -14, -29, -29, -57, -57, -128, -128, -188, -188, -205, -205,
+    -229, -229, -266, -266, -239, -239, -142, -142, -77, -77, -83, -83,
+    -79, -79, -24, -24, 15, 15, -2, -2, -10, -10, 36, 36,
+    82, 82, 72, 72, 45, 45, 55, 55, 72, 72, 36, 36,
+    -31, -31, -55, -55, -34, -34, -29, -29, -65, -65, -118, -118,
+    -165, -165, -187, -187, -172, -172, -140, -140, -118, -118, -100, -100,
+    -64, -64, -17, -17, 20, 20, 47, 47, 66, 66, 51, 51,
+    3, 3, -34, -34, -33, -33, -20, -20, -30, -30, -73, -73,
+    -149, -149, -248, -248, -328, -328, -338, -338, -291, -291, -243, -243,
+    -213, -213, -167, -167, -86, -86, -10, -10, 30, 30, 54, 54,
+    72, 72, 43, 43, -44, -44, -136, -136, -192, -192, -240, -240,
+    -294, -294, -328, -328, -338, -338, -351, -351, -348, -348, -289, -289,
+    -194, -194, -118, -118, -64, -64, 7, 7, 89, 89, 128, 128,
+    111, 111, 77, 77, 49, 49, 0, 0, -97, -97, -230, -230,
+    -371, -371, -489, -489, -531, -531, -459, -459, -310, -310, -173, -173,
+    -77, -77, 15, 15, 126, 126, 209, 209, 210, 210, 126, 126,
+    6, 6, -83, -83, -101, -101, -76, -76, -80, -80, -135, -135,
+    -197, -197, -216, -216, -175, -175, -93, -93, -14, -14, 12, 12,
+    -18, -18, -44, -44, -34, -34, -23, -23, -42, -42, -70, -70,
+    -70, -70, -41, -41, -1, -1, 56, 56, 143, 143, 217, 217,
+    223, 223, 174, 174, 128, 128, 95, 95, 35, 35, -56, -56,
+    -129, -129, -147, -147, -122, -122, -79, -79, -55, -55, -74, -74,
+    -98, -98, -65, -65, 12, 12, 67, 67, 88, 88, 105, 105,
+    100, 100, 31, 31, -62, -62, -100, -100, -93, -93, -124, -124,
+    -199, -199, -227, -227, -171, -171, -108, -108, -101, -101, -99, -99,
+    -52, -52, -8, -8, -23, -23, -64, -64, -97, -97, -148, -148,
+    -215, -215, -226, -226, -168, -168, -123, -123, -121, -121, -96, -96,
+    -10, -10, 74, 74, 97, 97, 89, 89, 109, 109, 154, 154,
+    169, 169, 120, 120, 29, 29, -55, -55, -117, -117, -173, -173,
+    -217, -217, -209, -209, -132, -132, -29, -29, 37, 37, 66, 66,
+    120, 120, 216, 216, 266, 266, 209, 209, 110, 110, 55, 55,
+    24, 24, -28, -28, -69, -69, -64, -64, -51, -51, -72, -72,
+    -105, -105, -105, -105, -55, -55, 41, 41, 158, 158, 242, 242,
+    274, 274, 292, 292, 313, 313, 296, 296, 223, 223, 163, 163,
+    186, 186, 257, 257, 283, 283, 247, 247, 210, 210, 179, 179,
+    106, 106, 13, 13, -19, -19, 0, 0, -13, -13, -54, -54,
+    -62, -62, -55, -55, -83, -83, -98, -98, -53, -53, -16, -16,
+    -45, -45, -69, -69, -12, -12, 66, 66, 72, 72, 21, 21,
+    -20, -20, -59, -59, -144, -144, -245, -245, -284, -284, -262, -262,
+    -248, -248, -242, -242, -195, -195, -131, -131, -100, -100, -62, -62,
+    17, 17, 52, 52, -19, -19, -112, -112, -148, -148, -186, -186,
+    -271, -271, -335, -335, -340, -340, -352, -352, -406, -406, -433, -433,
+    -393, -393, -355, -355, -369, -369, -365, -365, -266, -266, -136, -136,
+    -85, -85, -103, -103, -111, -111, -116, -116, -167, -167, -224, -224,
+    -229, -229, -210, -210, -204, -204, -192, -192, -177, -177, -201, -201,
+    -248, -248, -249, -249, -225, -225, -253, -253, -323, -323, -347, -347,
+    -315, -315, -292, -292, -291, -291, -250, -250, -163, -163, -112, -112,
+    -141, -141, -188, -188, -203, -203, -221, -221, -274, -274, -312, -312,
+    -315, -315, -341, -341, -417, -417, -486, -486, -520, -520, -561, -561,
+    -620, -620, -657, -657, -651, -651, -621, -621, -575, -575, -512, -512,
+    -466, -466, -488, -488, -564, -564, -613, -613, -583, -583, -524, -524,
+    -522, -522, -590, -590, -666, -666, -705, -705, -722, -722, -749, -749,
+    -786, -786, -816, -816, -840, -840, -871, -871, -896, -896, -895, -895,
+    -904, -904, -985, -985, -1108, -1108, -1150, -1150, -1068, -1068, -976, -976,
+    -985, -985, -1061, -1061, -1099, -1099, -1066, -1066, -1010, -1010, -974, -974,
+    -979, -979, -1038, -1038, -1114, -1114, -1125, -1125, -1053, -1053, -988, -988,
+    -1007, -1007, -1068, -1068, -1096, -1096, -1096, -1096, -1103, -1103, -1106, -1106,
+    -1099, -1099, -1107, -1107, -1124, -1124, -1084, -1084, -964, -964, -833, -833,
+    -758, -758, -724, -724, -682, -682, -626, -626, -589, -589, -582, -582,
+    -592, -592, -602, -602, -600, -600, -552, -552, -431, -431, -274, -274,
+    -162, -162, -119, -119, -84, -84, 19, 19, 181, 181, 298, 298,
+    318, 318, 341, 341, 475, 475, 641, 641, 684, 684, 655, 655,
+    744, 744, 948, 948, 1079, 1079, 1115, 1115, 1234, 1234, 1463, 1463,
+    1593, 1593, 1537, 1537, 1498, 1498, 1634, 1634, 1785, 1785, 1744, 1744,
+    1607, 1607, 1609, 1609, 1739, 1739, 1810, 1810, 1813, 1813, 1900, 1900,
+    2076, 2076, 2180, 2180, 2160, 2160, 2126, 2126, 2137, 2137, 2124, 2124,
+    2034, 2034, 1921, 1921, 1863, 1863, 1853, 1853, 1814, 1814, 1727, 1727,
+    1689, 1689, 1794, 1794, 1968, 1968, 2060, 2060, 2051, 2051, 2067, 2067,
+    2164, 2164, 2238, 2238, 2194, 2194, 2087, 2087, 2023, 2023, 2003, 2003,
+    1966, 1966, 1926, 1926, 1936, 1936, 1975, 1975, 1983, 1983, 1989, 1989,
+    2051, 2051, 2127, 2127, 2152, 2152, 2152, 2152, 2168, 2168, 2167, 2167,
+    2135, 2135, 2125, 2125, 2118, 2118, 2022, 2022, 1859, 1859, 1766, 1766,
+    1780, 1780, 1803, 1803, 1784, 1784, 1779, 1779, 1805, 1805, 1791, 1791,
+    1714, 1714, 1639, 1639, 1588, 1588, 1489, 1489, 1333, 1333, 1244, 1244,
+    1273, 1273, 1291, 1291, 1210, 1210, 1123, 1123, 1113, 1113, 1111, 1111,
+    1078, 1078, 1068, 1068, 1064, 1064, 979, 979, 853, 853, 807, 807,
+    812, 812, 742, 742, 601, 601, 500, 500, 464, 464, 444, 444,
+    447, 447, 506, 506, 554, 554, 494, 494, 385, 385, 382, 382,
+    461, 461, 414, 414, 189, 189, -14, -14, -63, -63, -50, -50,
+    -88, -88, -182, -182, -330, -330, -500, -500, -576, -576, -525, -525,
+    -509, -509, -646, -646, -807, -807, -842, -842, -824, -824, -900, -900,
+    -1054, -1054, -1179, -1179, -1265, -1265, -1369, -1369, -1482, -1482, -1577, -1577,
+    -1714, -1714, -1956, -1956, -2227, -2227, -2421, -2421, -2576, -2576, -2780, -2780,
+    -2996, -2996, -3150, -3150, -3265, -3265, -3318, -3318, -3201, -3201, -2988, -2988,
+    -2976, -2976, -3242, -3242, -3463, -3463, -3396, -3396, -3247, -3247, -3322, -3322,
+    -3563, -3563, -3719, -3719, -3768, -3768, -3912, -3912, -4230, -4230, -4592, -4592,
+    -4881, -4881, -5079, -5079, -5135, -5135, -4939, -4939, -4516, -4516, -4089, -4089,
+    -3844, -3844, -3722, -3722, -3499, -3499, -3079, -3079, -2648, -2648, -2488, -2488,
+    -2602, -2602, -2664, -2664, -2461, -2461, -2231, -2231, -2298, -2298, -2565, -2565,
+    -2690, -2690, -2614, -2614, -2523, -2523, -2407, -2407, -2085, -2085, -1616, -1616,
+    -1267, -1267, -1063, -1063, -740, -740, -230, -230, 153, 153, 165, 165,
+    24, 24, 104, 104, 425, 425, 701, 701, 782, 782, 785, 785,
+    863, 863, 1042, 1042, 1252, 1252, 1401, 1401, 1451, 1451, 1460, 1460,
+    1508, 1508, 1609, 1609, 1756, 1756, 1940, 1940, 2076, 2076, 2044, 2044,
+    1900, 1900, 1863, 1863, 2034, 2034, 2252, 2252, 2339, 2339, 2350, 2350,
+    2468, 2468, 2709, 2709, 2895, 2895, 2893, 2893, 2741, 2741, 2544, 2544,
+    2384, 2384, 2333, 2333, 2398, 2398, 2445, 2445, 2357, 2357, 2226, 2226,
+    2237, 2237, 2408, 2408, 2599, 2599, 2723, 2723, 2815, 2815, 2922, 2922,
+    3037, 3037, 3135, 3135, 3205, 3205, 3214, 3214, 3122, 3122, 2948, 2948,
+    2788, 2788, 2714, 2714, 2693, 2693, 2650, 2650, 2577, 2577, 2527, 2527,
+    2543, 2543, 2606, 2606, 2657, 2657, 2659, 2659, 2638, 2638, 2648, 2648,
+    2717, 2717, 2823, 2823, 2925, 2925, 2994, 2994, 3020, 3020, 3015, 3015,
+    3008, 3008, 3015, 3015, 3017, 3017, 2957, 2957, 2827, 2827, 2709, 2709,
+    2687, 2687, 2724, 2724, 2705, 2705, 2594, 2594, 2473, 2473, 2430, 2430,
+    2457, 2457, 2486, 2486, 2495, 2495, 2520, 2520, 2561, 2561, 2566, 2566,
+    2525, 2525, 2486, 2486, 2444, 2444, 2338, 2338, 2165, 2165, 1987, 1987,
+    1843, 1843, 1728, 1728, 1642, 1642, 1571, 1571, 1491, 1491, 1404, 1404,
+    1324, 1324, 1235, 1235, 1117, 1117, 1001, 1001, 933, 933, 892, 892,
+    806, 806, 659, 659, 531, 531, 462, 462, 352, 352, 126, 126,
+    -103, -103, -216, -216, -314, -314, -519, -519, -734, -734, -841, -841,
+    -942, -942, -1157, -1157, -1380, -1380, -1470, -1470, -1508, -1508, -1633, -1633,
+    -1777, -1777, -1783, -1783, -1676, -1676, -1641, -1641, -1734, -1734, -1838, -1838,
+    -1891, -1891, -1979, -1979, -2154, -2154, -2372, -2372, -2608, -2608, -2850, -2850,
+    -3029, -3029, -3134, -3134, -3296, -3296, -3548, -3548, -3702, -3702, -3684, -3684,
+    -3695, -3695, -3826, -3826, -3872, -3872, -3761, -3761, -3796, -3796, -4158, -4158,
+    -4527, -4527, -4551, -4551, -4432, -4432, -4585, -4585, -4934, -4934, -5041, -5041,
+    -4866, -4866, -4852, -4852, -5176, -5176, -5485, -5485, -5556, -5556, -5671, -5671,
+    -6023, -6023, -6249, -6249, -5957, -5957, -5355, -5355, -4945, -4945, -4762, -4762,
+    -4359, -4359, -3557, -3557, -2798, -2798, -2544, -2544, -2590, -2590, -2407, -2407,
+    -2008, -2008, -1921, -1921, -2272, -2272, -2546, -2546, -2461, -2461, -2414, -2414,
+    -2703, -2703, -2906, -2906, -2533, -2533, -1865, -1865, -1513, -1513, -1429, -1429,
+    -1024, -1024, -191, -191, 492, 492, 688, 688, 744, 744, 985, 985,
+    1204, 1204, 1157, 1157, 1025, 1025, 1052, 1052, 1163, 1163, 1207, 1207,
+    1231, 1231, 1329, 1329, 1469, 1469, 1582, 1582, 1637, 1637, 1632, 1632,
+    1627, 1627, 1710, 1710, 1850, 1850, 1878, 1878, 1737, 1737, 1625, 1625,
+    1746, 1746, 1997, 1997, 2116, 2116, 2091, 2091, 2156, 2156, 2365, 2365,
+    2526, 2526, 2565, 2565, 2593, 2593, 2593, 2593, 2419, 2419, 2117, 2117,
+    1892, 1892, 1802, 1802, 1745, 1745, 1695, 1695, 1734, 1734, 1916, 1916,
+    2225, 2225, 2595, 2595, 2921, 2921, 3109, 3109, 3160, 3160, 3170, 3170,
+    3218, 3218, 3283, 3283, 3289, 3289, 3214, 3214, 3097, 3097, 2970, 2970,
+    2855, 2855, 2779, 2779, 2727, 2727, 2640, 2640, 2535, 2535, 2514, 2514,
+    2598, 2598, 2707, 2707, 2820, 2820, 2966, 2966, 3090, 3090, 3132, 3132,
+    3173, 3173, 3295, 3295, 3397, 3397, 3374, 3374, 3340, 3340, 3451, 3451,
+    3619, 3619, 3634, 3634, 3482, 3482, 3332, 3332, 3249, 3249, 3158, 3158,
+    3042, 3042, 2977, 2977, 2975, 2975, 2977, 2977, 2986, 2986, 3061, 3061,
+    3159, 3159, 3176, 3176, 3111, 3111, 3061, 3061, 3049, 3049, 3021, 3021,
+    2968, 2968, 2902, 2902, 2771, 2771, 2556, 2556, 2362, 2362, 2260, 2260,
+    2161, 2161, 1990, 1990, 1827, 1827, 1756, 1756, 1730, 1730, 1679, 1679,
+    1608, 1608, 1511, 1511, 1352, 1352, 1150, 1150, 972, 972, 830, 830,
+    677, 677, 479, 479, 245, 245, 19, 19, -151, -151, -259, -259,
+    -365, -365, -556, -556, -833, -833, -1084, -1084, -1232, -1232, -1361, -1361,
+    -1557, -1557, -1738, -1738, -1830, -1830, -1939, -1939, -2121, -2121, -2216, -2216,
+    -2157, -2157, -2151, -2151, -2278, -2278, -2315, -2315, -2196, -2196, -2214, -2214,
+    -2519, -2519, -2853, -2853, -3002, -3002, -3129, -3129, -3404, -3404, -3667, -3667,
+    -3733, -3733, -3748, -3748, -3888, -3888, -3996, -3996, -3899, -3899, -3829, -3829,
+    -4051, -4051, -4359, -4359, -4435, -4435, -4426, -4426, -4589, -4589, -4769, -4769,
+    -4771, -4771, -4833, -4833, -5160, -5160, -5455, -5455, -5463, -5463, -5530, -5530,
+    -6057, -6057, -6757, -6757, -7036, -7036, -6845, -6845, -6623, -6623, -6514, -6514,
+    -6234, -6234, -5670, -5670, -5054, -5054, -4476, -4476, -3773, -3773, -3032, -3032,
+    -2627, -2627, -2610, -2610, -2580, -2580, -2328, -2328, -2150, -2150, -2349, -2349,
+    -2776, -2776, -3040, -3040, -2987, -2987, -2819, -2819, -2752, -2752, -2686, -2686,
+    -2339, -2339, -1686, -1686, -1017, -1017, -512, -512, -36, -36, 515, 515,
+    963, 963, 1155, 1155, 1264, 1264, 1514, 1514, 1768, 1768, 1712, 1712,
+    1391, 1391, 1200, 1200, 1302, 1302, 1425, 1425, 1350, 1350, 1225, 1225,
+    1247, 1247, 1349, 1349, 1402, 1402, 1445, 1445, 1543, 1543, 1632, 1632,
+    1631, 1631, 1575, 1575, 1596, 1596, 1788, 1788, 2079, 2079, 2234, 2234,
+    2124, 2124, 1944, 1944, 1973, 1973, 2149, 2149, 2151, 2151, 1894, 1894,
+    1638, 1638, 1570, 1570, 1547, 1547, 1403, 1403, 1232, 1232, 1194, 1194,
+    1247, 1247, 1292, 1292, 1423, 1423, 1766, 1766, 2219, 2219, 2601, 2601,
+    2911, 2911, 3197, 3197, 3361, 3361, 3321, 3321, 3211, 3211, 3177, 3177,
+    3175, 3175, 3105, 3105, 2981, 2981, 2863, 2863, 2760, 2760, 2689, 2689,
+    2677, 2677, 2676, 2676, 2615, 2615, 2525, 2525, 2534, 2534, 2693, 2693,
+    2903, 2903, 3058, 3058, 3171, 3171, 3298, 3298, 3422, 3422, 3500, 3500,
+    3550, 3550, 3604, 3604, 3649, 3649, 3668, 3668, 3651, 3651, 3562, 3562,
+    3394, 3394, 3214, 3214, 3067, 3067, 2908, 2908, 2746, 2746, 2701, 2701,
+    2814, 2814, 2959, 2959, 3038, 3038, 3112, 3112, 3242, 3242, 3364, 3364,
+    3402, 3402, 3379, 3379, 3336, 3336, 3256, 3256, 3122, 3122, 2975, 2975,
+    2839, 2839, 2676, 2676, 2463, 2463, 2252, 2252, 2094, 2094, 1977, 1977,
+    1882, 1882, 1836, 1836, 1843, 1843, 1843, 1843, 1810, 1810, 1766, 1766,
+    1680, 1680, 1498, 1498, 1276, 1276, 1119, 1119, 998, 998, 811, 811,
+    585, 585, 423, 423, 310, 310, 137, 137, -132, -132, -452, -452,
+    -788, -788, -1108, -1108, -1383, -1383, -1625, -1625, -1871, -1871, -2095, -2095,
+    -2229, -2229, -2270, -2270, -2280, -2280, -2282, -2282, -2242, -2242, -2172, -2172,
+    -2156, -2156, -2217, -2217, -2273, -2273, -2308, -2308, -2445, -2445, -2742, -2742,
+    -3097, -3097, -3428, -3428, -3727, -3727, -3930, -3930, -3980, -3980, -4011, -4011,
+    -4149, -4149, -4246, -4246, -4158, -4158, -4080, -4080, -4219, -4219, -4403, -4403,
+    -4415, -4415, -4437, -4437, -4692, -4692, -4951, -4951, -4915, -4915, -4833, -4833,
+    -5115, -5115, -5535, -5535, -5585, -5585, -5512, -5512, -6070, -6070, -7144, -7144,
+    -7726, -7726, -7473, -7473, -7184, -7184, -7329, -7329, -7278, -7278, -6520, -6520,
+    -5562, -5562, -4969, -4969, -4475, -4475, -3703, -3703, -2999, -2999, -2802, -2802,
+    -2791, -2791, -2423, -2423, -1903, -1903, -1856, -1856, -2291, -2291, -2642, -2642,
+    -2711, -2711, -2807, -2807, -2983, -2983, -2883, -2883, -2390, -2390, -1804, -1804,
+    -1289, -1289, -679, -679, 113, 113, 875, 875, 1349, 1349, 1532, 1532,
+    1646, 1646, 1885, 1885, 2180, 2180, 2298, 2298, 2174, 2174, 1994, 1994,
+    1897, 1897, 1783, 1783, 1540, 1540, 1283, 1283, 1201, 1201, 1269, 1269,
+    1315, 1315, 1330, 1330, 1471, 1471, 1716, 1716, 1830, 1830, 1763, 1763,
+    1747, 1747, 1889, 1889, 2016, 2016, 2027, 2027, 2066, 2066, 2222, 2222,
+    2350, 2350, 2295, 2295, 2065, 2065, 1743, 1743, 1395, 1395, 1082, 1082,
+    852, 852, 713, 713, 657, 657, 709, 709, 896, 896, 1172, 1172,
+    1449, 1449, 1698, 1698, 1975, 1975, 2301, 2301, 2618, 2618, 2871, 2871,
+    3050, 3050, 3136, 3136, 3123, 3123, 3053, 3053, 2930, 2930, 2699, 2699,
+    2402, 2402, 2223, 2223, 2246, 2246, 2330, 2330, 2357, 2357, 2406, 2406,
+    2558, 2558, 2708, 2708, 2717, 2717, 2649, 2649, 2681, 2681, 2833, 2833,
+    2964, 2964, 3025, 3025, 3127, 3127, 3317, 3317, 3467, 3467, 3467, 3467,
+    3371, 3371, 3262, 3262, 3129, 3129, 2947, 2947, 2773, 2773, 2679, 2679,
+    2646, 2646, 2581, 2581, 2448, 2448, 2333, 2333, 2353, 2353, 2498, 2498,
+    2655, 2655, 2773, 2773, 2923, 2923, 3141, 3141, 3337, 3337, 3387, 3387,
+    3293, 3293, 3150, 3150, 2985, 2985, 2738, 2738, 2425, 2425, 2191, 2191,
+    2123, 2123, 2117, 2117, 2045, 2045, 1945, 1945, 1916, 1916, 1935, 1935,
+    1911, 1911, 1847, 1847, 1825, 1825, 1857, 1857, 1871, 1871, 1837, 1837,
+    1798, 1798, 1750, 1750, 1618, 1618, 1387, 1387, 1147, 1147, 943, 943,
+    721, 721, 476, 476, 267, 267, 80, 80, -170, -170, -461, -461,
+    -690, -690, -858, -858, -1054, -1054, -1263, -1263, -1356, -1356, -1303, -1303,
+    -1219, -1219, -1187, -1187, -1163, -1163, -1140, -1140, -1220, -1220, -1444, -1444,
+    -1706, -1706, -1948, -1948, -2234, -2234, -2554, -2554, -2784, -2784, -2933, -2933,
+    -3136, -3136, -3354, -3354, -3408, -3408, -3343, -3343, -3387, -3387, -3528, -3528,
+    -3529, -3529, -3379, -3379, -3345, -3345, -3505, -3505, -3629, -3629, -3628, -3628,
+    -3739, -3739, -4088, -4088, -4418, -4418, -4529, -4529, -4611, -4611, -4849, -4849,
+    -5050, -5050, -5046, -5046, -5089, -5089, -5442, -5442, -5932, -5932, -6296, -6296,
+    -6625, -6625, -7095, -7095, -7559, -7559, -7723, -7723, -7521, -7521, -7071, -7071,
+    -6461, -6461, -5757, -5757, -5066, -5066, -4457, -4457, -3919, -3919, -3479, -3479,
+    -3226, -3226, -3146, -3146, -3072, -3072, -2938, -2938, -2897, -2897, -3048, -3048,
+    -3229, -3229, -3297, -3297, -3345, -3345, -3451, -3451, -3459, -3459, -3194, -3194,
+    -2667, -2667, -1987, -1987, -1273, -1273, -652, -652, -146, -146, 329, 329,
+    727, 727, 881, 881, 858, 858, 983, 983, 1341, 1341, 1611, 1611,
+    1603, 1603, 1584, 1584, 1779, 1779, 1911, 1911, 1655, 1655, 1252, 1252,
+    1148, 1148, 1256, 1256, 1187, 1187, 1027, 1027, 1164, 1164, 1494, 1494,
+    1577, 1577, 1450, 1450, 1522, 1522, 1792, 1792, 1920, 1920, 1929, 1929,
+    2129, 2129, 2476, 2476, 2603, 2603, 2445, 2445, 2261, 2261, 2104, 2104,
+    1758, 1758, 1233, 1233, 859, 859, 793, 793, 838, 838, 872, 872,
+    1038, 1038, 1374, 1374, 1662, 1662, 1796, 1796, 1918, 1918, 2102, 2102,
+    2286, 2286, 2484, 2484, 2726, 2726, 2889, 2889, 2876, 2876, 2799, 2799,
+    2750, 2750, 2635, 2635, 2423, 2423, 2288, 2288, 2314, 2314, 2358, 2358,
+    2319, 2319, 2311, 2311, 2401, 2401, 2441, 2441, 2334, 2334, 2244, 2244,
+    2321, 2321, 2427, 2427, 2423, 2423, 2474, 2474, 2750, 2750, 3056, 3056,
+    3148, 3148, 3126, 3126, 3166, 3166, 3153, 3153, 2949, 2949, 2694, 2694,
+    2546, 2546, 2418, 2418, 2230, 2230, 2094, 2094, 2084, 2084, 2084, 2084,
+    2002, 2002, 1934, 1934, 1973, 1973, 2055, 2055, 2098, 2098, 2163, 2163,
+    2316, 2316, 2469, 2469, 2499, 2499, 2442, 2442, 2387, 2387, 2303, 2303,
+    2163, 2163, 2058, 2058, 2028, 2028, 1988, 1988, 1915, 1915, 1889, 1889,
+    1880, 1880, 1770, 1770, 1590, 1590, 1474, 1474, 1416, 1416, 1319, 1319,
+    1210, 1210, 1210, 1210, 1317, 1317, 1416, 1416, 1446, 1446, 1446, 1446,
+    1442, 1442, 1396, 1396, 1281, 1281, 1137, 1137, 1002, 1002, 852, 852,
+    673, 673, 492, 492, 307, 307, 91, 91, -123, -123, -286, -286,
+    -419, -419, -533, -533, -568, -568, -520, -520, -491, -491, -510, -510,
+    -499, -499, -462, -462, -521, -521, -701, -701, -890, -890, -1018, -1018,
+    -1120, -1120, -1224, -1224, -1309, -1309, -1376, -1376, -1469, -1469, -1588, -1588,
+    -1683, -1683, -1745, -1745, -1837, -1837, -1984, -1984, -2122, -2122, -2208, -2208,
+    -2279, -2279, -2355, -2355, -2386, -2386, -2387, -2387, -2446, -2446, -2581, -2581,
+    -2720, -2720, -2837, -2837, -2959, -2959, -3070, -3070, -3145, -3145, -3229, -3229,
+    -3364, -3364, -3533, -3533, -3727, -3727, -3987, -3987, -4314, -4314, -4635, -4635,
+    -4896, -4896, -5085, -5085, -5159, -5159, -5060, -5060, -4834, -4834, -4616, -4616,
+    -4463, -4463, -4299, -4299, -4081, -4081, -3900, -3900, -3828, -3828, -3780, -3780,
+    -3667, -3667, -3545, -3545, -3501, -3501, -3506, -3506, -3513, -3513, -3564, -3564,
+    -3690, -3690, -3816, -3816, -3863, -3863, -3825, -3825, -3703, -3703, -3480, -3480,
+    -3192, -3192, -2898, -2898, -2600, -2600, -2278, -2278, -1976, -1976, -1751, -1751,
+    -1569, -1569, -1369, -1369, -1173, -1173, -1034, -1034, -926, -926, -800, -800,
+    -707, -707, -733, -733, -833, -833, -874, -874, -828, -828, -774, -774,
+    -725, -725, -616, -616, -452, -452, -311, -311, -212, -212, -110, -110,
+    -7, -7, 78, 78, 189, 189, 369, 369, 567, 567, 715, 715,
+    830, 830, 930, 930, 972, 972, 938, 938, 892, 892, 887, 887,
+    902, 902, 921, 921, 982, 982, 1102, 1102, 1227, 1227, 1321, 1321,
+    1414, 1414, 1535, 1535, 1656, 1656, 1764, 1764, 1905, 1905, 2093, 2093,
+    2266, 2266, 2392, 2392, 2512, 2512, 2630, 2630, 2682, 2682, 2662, 2662,
+    2662, 2662, 2725, 2725, 2807, 2807, 2889, 2889, 3000, 3000, 3129, 3129,
+    3231, 3231, 3312, 3312, 3390, 3390, 3429, 3429, 3408, 3408, 3390, 3390,
+    3431, 3431, 3495, 3495, 3530, 3530, 3568, 3568, 3646, 3646, 3710, 3710,
+    3688, 3688, 3627, 3627, 3623, 3623, 3653, 3653, 3621, 3621, 3539, 3539,
+    3495, 3495, 3484, 3484, 3424, 3424, 3315, 3315, 3217, 3217, 3120, 3120,
+    2994, 2994, 2885, 2885, 2846, 2846, 2834, 2834, 2800, 2800, 2772, 2772,
+    2771, 2771, 2746, 2746, 2666, 2666, 2589, 2589, 2565, 2565, 2559, 2559,
+    2521, 2521, 2474, 2474, 2463, 2463, 2465, 2465, 2424, 2424, 2350, 2350,
+    2285, 2285, 2218, 2218, 2119, 2119, 2028, 2028, 1996, 1996, 2001, 2001,
+    1994, 1994, 1969, 1969, 1934, 1934, 1882, 1882, 1831, 1831, 1816, 1816,
+    1822, 1822, 1818, 1818, 1822, 1822, 1853, 1853, 1872, 1872, 1841, 1841,
+    1787, 1787, 1731, 1731, 1644, 1644, 1516, 1516, 1412, 1412, 1377, 1377,
+    1361, 1361, 1291, 1291, 1183, 1183, 1088, 1088, 985, 985, 821, 821,
+    633, 633, 508, 508, 437, 437, 347, 347, 243, 243, 182, 182,
+    137, 137, 29, 29, -135, -135, -281, -281, -395, -395, -502, -502,
+    -596, -596, -660, -660, -720, -720, -813, -813, -938, -938, -1083, -1083,
+    -1253, -1253, -1447, -1447, -1644, -1644, -1820, -1820, -1969, -1969, -2099, -2099,
+    -2221, -2221, -2353, -2353, -2505, -2505, -2662, -2662, -2800, -2800, -2934, -2934,
+    -3101, -3101, -3291, -3291, -3467, -3467, -3667, -3667, -3950, -3950, -4278, -4278,
+    -4550, -4550, -4766, -4766, -4994, -4994, -5213, -5213, -5330, -5330, -5336, -5336,
+    -5318, -5318, -5316, -5316, -5304, -5304, -5287, -5287, -5312, -5312, -5382, -5382,
+    -5458, -5458, -5532, -5532, -5629, -5629, -5743, -5743, -5829, -5829, -5880, -5880,
+    -5941, -5941, -6028, -6028, -6094, -6094, -6100, -6100, -6049, -6049, -5941, -5941,
+    -5761, -5761, -5528, -5528, -5284, -5284, -5043, -5043, -4804, -4804, -4602, -4602,
+    -4459, -4459, -4341, -4341, -4209, -4209, -4071, -4071, -3936, -3936, -3777, -3777,
+    -3595, -3595, -3443, -3443, -3365, -3365, -3343, -3343, -3324, -3324, -3259, -3259,
+    -3129, -3129, -2948, -2948, -2758, -2758, -2582, -2582, -2409, -2409, -2221, -2221,
+    -2024, -2024, -1830, -1830, -1628, -1628, -1396, -1396, -1148, -1148, -913, -913,
+    -674, -674, -396, -396, -125, -125, 55, 55, 148, 148, 246, 246,
+    393, 393, 567, 567, 764, 764, 998, 998, 1240, 1240, 1451, 1451,
+    1647, 1647, 1857, 1857, 2069, 2069, 2258, 2258, 2437, 2437, 2641, 2641,
+    2877, 2877, 3124, 3124, 3361, 3361, 3575, 3575, 3754, 3754, 3885, 3885,
+    3987, 3987, 4103, 4103, 4242, 4242, 4392, 4392, 4558, 4558, 4738, 4738,
+    4893, 4893, 4994, 4994, 5067, 5067, 5125, 5125, 5131, 5131, 5091, 5091,
+    5082, 5082, 5155, 5155, 5261, 5261, 5329, 5329, 5346, 5346, 5342, 5342,
+    5330, 5330, 5297, 5297, 5238, 5238, 5187, 5187, 5187, 5187, 5221, 5221,
+    5223, 5223, 5153, 5153, 5046, 5046, 4949, 4949, 4848, 4848, 4692, 4692,
+    4481, 4481, 4301, 4301, 4217, 4217, 4181, 4181, 4111, 4111, 4003, 4003,
+    3909, 3909, 3817, 3817, 3683, 3683, 3533, 3533, 3436, 3436, 3402, 3402,
+    3386, 3386, 3363, 3363, 3331, 3331, 3283, 3283, 3216, 3216, 3141, 3141,
+    3047, 3047, 2915, 2915, 2761, 2761, 2640, 2640, 2571, 2571, 2517, 2517,
+    2433, 2433, 2325, 2325, 2225, 2225, 2137, 2137, 2048, 2048, 1974, 1974,
+    1940, 1940, 1928, 1928, 1905, 1905, 1878, 1878, 1875, 1875, 1876, 1876,
+    1834, 1834, 1725, 1725, 1568, 1568, 1403, 1403, 1276, 1276, 1193, 1193,
+    1108, 1108, 986, 986, 845, 845, 714, 714, 587, 587, 451, 451,
+    317, 317, 203, 203, 108, 108, 18, 18, -73, -73, -166, -166,
+    -261, -261, -362, -362, -471, -471, -596, -596, -747, -747, -920, -920,
+    -1079, -1079, -1200, -1200, -1297, -1297, -1401, -1401, -1521, -1521, -1659, -1659,
+    -1820, -1820, -1990, -1990, -2144, -2144, -2290, -2290, -2456, -2456, -2633, -2633,
+    -2784, -2784, -2904, -2904, -3021, -3021, -3153, -3153, -3294, -3294, -3445, -3445,
+    -3603, -3603, -3760, -3760, -3927, -3927, -4133, -4133, -4374, -4374, -4615, -4615,
+    -4844, -4844, -5083, -5083, -5319, -5319, -5499, -5499, -5612, -5612, -5713, -5713,
+    -5823, -5823, -5885, -5885, -5857, -5857, -5806, -5806, -5816, -5816, -5864, -5864,
+    -5877, -5877, -5856, -5856, -5863, -5863, -5918, -5918, -6004, -6004, -6115, -6115,
+    -6234, -6234, -6317, -6317, -6350, -6350, -6366, -6366, -6357, -6357, -6268, -6268,
+    -6100, -6100, -5926, -5926, -5780, -5780, -5611, -5611, -5387, -5387, -5153, -5153,
+    -4953, -4953, -4764, -4764, -4554, -4554, -4358, -4358, -4229, -4229, -4154, -4154,
+    -4076, -4076, -3976, -3976, -3868, -3868, -3760, -3760, -3649, -3649, -3542, -3542,
+    -3418, -3418, -3249, -3249, -3066, -3066, -2927, -2927, -2805, -2805, -2617, -2617,
+    -2352, -2352, -2081, -2081, -1829, -1829, -1565, -1565, -1286, -1286, -1039, -1039,
+    -844, -844, -659, -659, -441, -441, -191, -191, 55, 55, 274, 274,
+    472, 472, 668, 668, 875, 875, 1081, 1081, 1259, 1259, 1409, 1409,
+    1579, 1579, 1814, 1814, 2084, 2084, 2348, 2348, 2621, 2621, 2919, 2919,
+    3182, 3182, 3359, 3359, 3499, 3499, 3672, 3672, 3866, 3866, 4038, 4038,
+    4210, 4210, 4421, 4421, 4649, 4649, 4840, 4840, 4982, 4982, 5098, 5098,
+    5198, 5198, 5281, 5281, 5360, 5360, 5457, 5457, 5557, 5557, 5627, 5627,
+    5660, 5660, 5686, 5686, 5706, 5706, 5692, 5692, 5647, 5647, 5611, 5611,
+    5607, 5607, 5638, 5638, 5703, 5703, 5779, 5779, 5821, 5821, 5799, 5799,
+    5714, 5714, 5575, 5575, 5408, 5408, 5264, 5264, 5164, 5164, 5065, 5065,
+    4928, 4928, 4776, 4776, 4644, 4644, 4520, 4520, 4367, 4367, 4194, 4194,
+    4050, 4050, 3962, 3962, 3907, 3907, 3858, 3858, 3823, 3823, 3803, 3803,
+    3759, 3759, 3647, 3647, 3480, 3480, 3307, 3307, 3165, 3165, 3059, 3059,
+    2973, 2973, 2883, 2883, 2787, 2787, 2692, 2692, 2582, 2582, 2434, 2434,
+    2276, 2276, 2159, 2159, 2079, 2079, 2003, 2003, 1946, 1946, 1946, 1946,
+    1981, 1981, 1975, 1975, 1906, 1906, 1814, 1814, 1729, 1729, 1631, 1631,
+    1517, 1517, 1425, 1425, 1373, 1373, 1323, 1323, 1236, 1236, 1124, 1124,
+    1004, 1004, 857, 857, 680, 680, 521, 521, 412, 412, 332, 332,
+    260, 260, 206, 206, 152, 152, 49, 49, -104, -104, -256, -256,
+    -379, -379, -498, -498, -619, -619, -717, -717, -785, -785, -862, -862,
+    -974, -974, -1112, -1112, -1268, -1268, -1451, -1451, -1651, -1651, -1817, -1817,
+    -1932, -1932, -2041, -2041, -2184, -2184, -2334, -2334, -2460, -2460, -2586, -2586,
+    -2747, -2747, -2924, -2924, -3073, -3073, -3191, -3191, -3299, -3299, -3406, -3406,
+    -3501, -3501, -3593, -3593, -3715, -3715, -3894, -3894, -4119, -4119, -4360, -4360,
+    -4607, -4607, -4864, -4864, -5125, -5125, -5357, -5357, -5536, -5536, -5673, -5673,
+    -5790, -5790, -5895, -5895, -5979, -5979, -6033, -6033, -6047, -6047, -6008, -6008,
+    -5922, -5922, -5825, -5825, -5757, -5757, -5723, -5723, -5716, -5716, -5767, -5767,
+    -5913, -5913, -6122, -6122, -6295, -6295, -6374, -6374, -6383, -6383, -6361, -6361,
+    -6303, -6303, -6190, -6190, -6045, -6045, -5900, -5900, -5740, -5740, -5534, -5534,
+    -5289, -5289, -5037, -5037, -4789, -4789, -4538, -4538, -4297, -4297, -4098, -4098,
+    -3969, -3969, -3906, -3906, -3886, -3886, -3874, -3874, -3825, -3825, -3705, -3705,
+    -3528, -3528, -3344, -3344, -3193, -3193, -3068, -3068, -2940, -2940, -2803, -2803,
+    -2653, -2653, -2468, -2468, -2228, -2228, -1943, -1943, -1643, -1643, -1347, -1347,
+    -1059, -1059, -786, -786, -536, -536, -313, -313, -111, -111, 82, 82,
+    277, 277, 490, 490, 727, 727, 966, 966, 1167, 1167, 1334, 1334,
+    1506, 1506, 1697, 1697, 1887, 1887, 2076, 2076, 2303, 2303, 2580, 2580,
+    2874, 2874, 3145, 3145, 3381, 3381, 3584, 3584, 3753, 3753, 3893, 3893,
+    4027, 4027, 4187, 4187, 4372, 4372, 4566, 4566, 4761, 4761, 4959, 4959,
+    5140, 5140, 5274, 5274, 5360, 5360, 5417, 5417, 5449, 5449, 5454, 5454,
+    5461, 5461, 5499, 5499, 5557, 5557, 5594, 5594, 5577, 5577, 5515, 5515,
+    5445, 5445, 5393, 5393, 5360, 5360, 5342, 5342, 5354, 5354, 5397, 5397,
+    5436, 5436, 5430, 5430, 5367, 5367, 5262, 5262, 5125, 5125, 4961, 4961,
+    4779, 4779, 4595, 4595, 4428, 4428, 4299, 4299, 4202, 4202, 4115, 4115,
+    4013, 4013, 3884, 3884, 3739, 3739, 3599, 3599, 3478, 3478, 3375, 3375,
+    3297, 3297, 3246, 3246, 3203, 3203, 3142, 3142, 3062, 3062, 2972, 2972,
+    2867, 2867, 2746, 2746, 2631, 2631, 2537, 2537, 2450, 2450, 2368, 2368,
+    2304, 2304, 2246, 2246, 2155, 2155, 2017, 2017, 1860, 1860, 1721, 1721,
+    1604, 1604, 1512, 1512, 1461, 1461, 1459, 1459, 1479, 1479, 1484, 1484,
+    1471, 1471, 1447, 1447, 1394, 1394, 1296, 1296, 1188, 1188, 1113, 1113,
+    1056, 1056, 974, 974, 872, 872, 773, 773, 674, 674, 554, 554,
+    426, 426, 310, 310, 212, 212, 126, 126, 54, 54, -7, -7,
+    -68, -68, -142, -142, -236, -236, -347, -347, -466, -466, -582, -582,
+    -689, -689, -784, -784, -863, -863, -930, -930, -989, -989, -1066, -1066,
+    -1176, -1176, -1303, -1303, -1415, -1415, -1525, -1525, -1665, -1665, -1819, -1819,
+    -1953, -1953, -2078, -2078, -2220, -2220, -2354, -2354, -2451, -2451, -2550, -2550,
+    -2697, -2697, -2862, -2862, -2981, -2981, -3062, -3062, -3161, -3161, -3288, -3288,
+    -3389, -3389, -3452, -3452, -3542, -3542, -3720, -3720, -3978, -3978, -4275, -4275,
+    -4590, -4590, -4898, -4898, -5162, -5162, -5370, -5370, -5542, -5542, -5671, -5671,
+    -5738, -5738, -5765, -5765, -5802, -5802, -5844, -5844, -5853, -5853, -5829, -5829,
+    -5808, -5808, -5786, -5786, -5725, -5725, -5643, -5643, -5629, -5629, -5750, -5750,
+    -5967, -5967, -6181, -6181, -6332, -6332, -6425, -6425, -6465, -6465, -6422, -6422,
+    -6277, -6277, -6070, -6070, -5870, -5870, -5711, -5711, -5562, -5562, -5375, -5375,
+    -5144, -5144, -4894, -4894, -4641, -4641, -4379, -4379, -4121, -4121, -3913, -3913,
+    -3792, -3792, -3743, -3743, -3721, -3721, -3681, -3681, -3595, -3595, -3468, -3468,
+    -3322, -3322, -3164, -3164, -2978, -2978, -2778, -2778, -2612, -2612, -2497, -2497,
+    -2385, -2385, -2220, -2220, -2005, -2005, -1768, -1768, -1501, -1501, -1185, -1185,
+    -841, -841, -529, -529, -285, -285, -88, -88, 101, 101, 305, 305,
+    521, 521, 731, 731, 930, 930, 1143, 1143, 1390, 1390, 1648, 1648,
+    1860, 1860, 2020, 2020, 2184, 2184, 2389, 2389, 2608, 2608, 2830, 2830,
+    3092, 3092, 3408, 3408, 3710, 3710, 3925, 3925, 4054, 4054, 4148, 4148,
+    4245, 4245, 4356, 4356, 4488, 4488, 4649, 4649, 4838, 4838, 5041, 5041,
+    5235, 5235, 5388, 5388, 5478, 5478, 5510, 5510, 5513, 5513, 5509, 5509,
+    5501, 5501, 5496, 5496, 5504, 5504, 5511, 5511, 5481, 5481, 5401, 5401,
+    5301, 5301, 5204, 5204, 5118, 5118, 5053, 5053, 5028, 5028, 5033, 5033,
+    5041, 5041, 5034, 5034, 4993, 4993, 4896, 4896, 4737, 4737, 4546, 4546,
+    4358, 4358, 4192, 4192, 4049, 4049, 3929, 3929, 3823, 3823, 3711, 3711,
+    3584, 3584, 3450, 3450, 3322, 3322, 3192, 3192, 3051, 3051, 2916, 2916,
+    2820, 2820, 2774, 2774, 2760, 2760, 2748, 2748, 2707, 2707, 2620, 2620,
+    2499, 2499, 2378, 2378, 2272, 2272, 2177, 2177, 2093, 2093, 2027, 2027,
+    1969, 1969, 1898, 1898, 1815, 1815, 1725, 1725, 1620, 1620, 1499, 1499,
+    1398, 1398, 1351, 1351, 1350, 1350, 1365, 1365, 1385, 1385, 1406, 1406,
+    1405, 1405, 1360, 1360, 1278, 1278, 1188, 1188, 1102, 1102, 1023, 1023,
+    961, 961, 924, 924, 884, 884, 807, 807, 698, 698, 590, 590,
+    486, 486, 367, 367, 244, 244, 156, 156, 109, 109, 72, 72,
+    16, 16, -61, -61, -150, -150, -244, -244, -345, -345, -453, -453,
+    -558, -558, -641, -641, -701, -701, -753, -753, -809, -809, -872, -872,
+    -952, -952, -1066, -1066, -1209, -1209, -1351, -1351, -1478, -1478, -1601, -1601,
+    -1733, -1733, -1859, -1859, -1956, -1956, -2041, -2041, -2149, -2149, -2281, -2281,
+    -2410, -2410, -2533, -2533, -2663, -2663, -2787, -2787, -2883, -2883, -2962, -2962,
+    -3051, -3051, -3151, -3151, -3253, -3253, -3374, -3374, -3538, -3538, -3757, -3757,
+    -4041, -4041, -4379, -4379, -4722, -4722, -4997, -4997, -5183, -5183, -5321, -5321,
+    -5457, -5457, -5586, -5586, -5677, -5677, -5725, -5725, -5745, -5745, -5739, -5739,
+    -5699, -5699, -5641, -5641, -5584, -5584, -5525, -5525, -5470, -5470, -5464, -5464,
+    -5545, -5545, -5703, -5703, -5907, -5907, -6123, -6123, -6286, -6286, -6321, -6321,
+    -6226, -6226, -6075, -6075, -5929, -5929, -5781, -5781, -5607, -5607, -5427, -5427,
+    -5261, -5261, -5084, -5084, -4847, -4847, -4549, -4549, -4241, -4241, -3971, -3971,
+    -3762, -3762, -3625, -3625, -3560, -3560, -3536, -3536, -3507, -3507, -3448, -3448,
+    -3347, -3347, -3204, -3204, -3029, -3029, -2853, -2853, -2695, -2695, -2556, -2556,
+    -2428, -2428, -2311, -2311, -2197, -2197, -2054, -2054, -1843, -1843, -1541, -1541,
+    -1175, -1175, -814, -814, -516, -516, -277, -277, -69, -69, 119, 119,
+    291, 291, 476, 476, 704, 704, 966, 966, 1222, 1222, 1455, 1455,
+    1679, 1679, 1900, 1900, 2096, 2096, 2254, 2254, 2399, 2399, 2574, 2574,
+    2798, 2798, 3068, 3068, 3361, 3361, 3632, 3632, 3837, 3837, 3975, 3975,
+    4075, 4075, 4154, 4154, 4217, 4217, 4300, 4300, 4454, 4454, 4680, 4680,
+    4926, 4926, 5147, 5147, 5320, 5320, 5431, 5431, 5478, 5478, 5483, 5483,
+    5479, 5479, 5488, 5488, 5504, 5504, 5512, 5512, 5499, 5499, 5448, 5448,
+    5352, 5352, 5218, 5218, 5068, 5068, 4923, 4923, 4805, 4805, 4740, 4740,
+    4745, 4745, 4796, 4796, 4842, 4842, 4848, 4848, 4801, 4801, 4692, 4692,
+    4529, 4529, 4346, 4346, 4182, 4182, 4053, 4053, 3958, 3958, 3877, 3877,
+    3782, 3782, 3653, 3653, 3498, 3498, 3328, 3328, 3144, 3144, 2959, 2959,
+    2807, 2807, 2714, 2714, 2670, 2670, 2648, 2648, 2630, 2630, 2605, 2605,
+    2554, 2554, 2463, 2463, 2349, 2349, 2246, 2246, 2166, 2166, 2107, 2107,
+    2073, 2073, 2064, 2064, 2044, 2044, 1977, 1977, 1865, 1865, 1734, 1734,
+    1593, 1593, 1450, 1450, 1346, 1346, 1305, 1305, 1303, 1303, 1308, 1308,
+    1320, 1320, 1336, 1336, 1321, 1321, 1254, 1254, 1165, 1165, 1093, 1093,
+    1040, 1040, 993, 993, 957, 957, 939, 939, 914, 914, 851, 851,
+    745, 745, 620, 620, 491, 491, 373, 373, 290, 290, 250, 250,
+    224, 224, 177, 177, 105, 105, 14, 14, -106, -106, -247, -247,
+    -375, -375, -472, -472, -560, -560, -647, -647, -713, -713, -749, -749,
+    -779, -779, -831, -831, -910, -910, -1012, -1012, -1129, -1129, -1244, -1244,
+    -1341, -1341, -1427, -1427, -1526, -1526, -1641, -1641, -1759, -1759, -1881, -1881,
+    -2024, -2024, -2179, -2179, -2318, -2318, -2432, -2432, -2546, -2546, -2667, -2667,
+    -2775, -2775, -2863, -2863, -2960, -2960, -3083, -3083, -3217, -3217, -3346, -3346,
+    -3481, -3481, -3637, -3637, -3827, -3827, -4062, -4062, -4336, -4336, -4619, -4619,
+    -4881, -4881, -5117, -5117, -5327, -5327, -5491, -5491, -5585, -5585, -5613, -5613,
+    -5608, -5608, -5590, -5590, -5557, -5557, -5508, -5508, -5458, -5458, -5414, -5414,
+    -5362, -5362, -5305, -5305, -5285, -5285, -5348, -5348, -5499, -5499, -5702, -5702,
+    -5905, -5905, -6055, -6055, -6115, -6115, -6077, -6077, -5956, -5956, -5785, -5785,
+    -5593, -5593, -5394, -5394, -5184, -5184, -4961, -4961, -4733, -4733, -4497, -4497,
+    -4240, -4240, -3963, -3963, -3684, -3684, -3441, -3441, -3274, -3274, -3205, -3205,
+    -3201, -3201, -3199, -3199, -3157, -3157, -3075, -3075, -2961, -2961, -2808, -2808,
+    -2624, -2624, -2444, -2444, -2305, -2305, -2196, -2196, -2074, -2074, -1908, -1908,
+    -1697, -1697, -1447, -1447, -1156, -1156, -840, -840, -530, -530, -246, -246,
+    5, 5, 215, 215, 390, 390, 558, 558, 742, 742, 931, 931,
+    1122, 1122, 1341, 1341, 1604, 1604, 1871, 1871, 2092, 2092, 2264, 2264,
+    2427, 2427, 2606, 2606, 2799, 2799, 3007, 3007, 3234, 3234, 3460, 3460,
+    3656, 3656, 3812, 3812, 3938, 3938, 4037, 4037, 4109, 4109, 4177, 4177,
+    4279, 4279, 4429, 4429, 4618, 4618, 4838, 4838, 5066, 5066, 5253, 5253,
+    5360, 5360, 5398, 5398, 5403, 5403, 5386, 5386, 5340, 5340, 5282, 5282,
+    5241, 5241, 5223, 5223, 5201, 5201, 5143, 5143, 5033, 5033, 4888, 4888,
+    4748, 4748, 4650, 4650, 4608, 4608, 4608, 4608, 4631, 4631, 4658, 4658,
+    4662, 4662, 4618, 4618, 4521, 4521, 4390, 4390, 4238, 4238, 4060, 4060,
+    3866, 3866, 3697, 3697, 3581, 3581, 3494, 3494, 3395, 3395, 3269, 3269,
+    3124, 3124, 2966, 2966, 2808, 2808, 2671, 2671, 2565, 2565, 2488, 2488,
+    2444, 2444, 2429, 2429, 2424, 2424, 2397, 2397, 2333, 2333, 2235, 2235,
+    2122, 2122, 2008, 2008, 1908, 1908, 1843, 1843, 1820, 1820, 1813, 1813,
+    1786, 1786, 1721, 1721, 1625, 1625, 1508, 1508, 1386, 1386, 1279, 1279,
+    1208, 1208, 1182, 1182, 1207, 1207, 1270, 1270, 1332, 1332, 1345, 1345,
+    1296, 1296, 1210, 1210, 1115, 1115, 1024, 1024, 942, 942, 880, 880,
+    849, 849, 837, 837, 813, 813, 758, 758, 679, 679, 582, 582,
+    462, 462, 333, 333, 232, 232, 180, 180, 157, 157, 129, 129,
+    77, 77, -1, -1, -104, -104, -226, -226, -355, -355, -469, -469,
+    -557, -557, -614, -614, -648, -648, -672, -672, -703, -703, -761, -761,
+    -853, -853, -972, -972, -1106, -1106, -1235, -1235, -1345, -1345, -1433, -1433,
+    -1513, -1513, -1597, -1597, -1690, -1690, -1802, -1802, -1943, -1943, -2098, -2098,
+    -2232, -2232, -2340, -2340, -2447, -2447, -2561, -2561, -2664, -2664, -2754, -2754,
+    -2848, -2848, -2954, -2954, -3063, -3063, -3168, -3168, -3279, -3279, -3410, -3410,
+    -3577, -3577, -3795, -3795, -4071, -4071, -4372, -4372, -4640, -4640, -4857, -4857,
+    -5049, -5049, -5232, -5232, -5368, -5368, -5428, -5428, -5440, -5440, -5444, -5444,
+    -5446, -5446, -5431, -5431, -5399, -5399, -5346, -5346, -5250, -5250, -5120, -5120,
+    -5016, -5016, -5014, -5014, -5138, -5138, -5347, -5347, -5566, -5566, -5738, -5738,
+    -5836, -5836, -5847, -5847, -5763, -5763, -5598, -5598, -5398, -5398, -5210, -5210,
+    -5050, -5050, -4898, -4898, -4716, -4716, -4486, -4486, -4209, -4209, -3890, -3890,
+    -3557, -3557, -3268, -3268, -3080, -3080, -2992, -2992, -2967, -2967, -2973, -2973,
+    -2979, -2979, -2936, -2936, -2812, -2812, -2628, -2628, -2430, -2430, -2247, -2247,
+    -2085, -2085, -1963, -1963, -1891, -1891, -1832, -1832, -1723, -1723, -1522, -1522,
+    -1248, -1248, -943, -943, -634, -634, -336, -336, -67, -67, 159, 159,
+    348, 348, 518, 518, 679, 679, 851, 851, 1062, 1062, 1323, 1323,
+    1614, 1614, 1899, 1899, 2138, 2138, 2309, 2309, 2425, 2425, 2532, 2532,
+    2670, 2670, 2852, 2852, 3073, 3073, 3320, 3320, 3573, 3573, 3799, 3799,
+    3959, 3959, 4033, 4033, 4046, 4046, 4057, 4057, 4103, 4103, 4196, 4196,
+    4348, 4348, 4575, 4575, 4850, 4850, 5094, 5094, 5243, 5243, 5301, 5301,
+    5313, 5313, 5309, 5309, 5285, 5285, 5251, 5251, 5241, 5241, 5266, 5266,
+    5280, 5280, 5228, 5228, 5096, 5096, 4910, 4910, 4695, 4695, 4484, 4484,
+    4322, 4322, 4244, 4244, 4243, 4243, 4289, 4289, 4335, 4335, 4337, 4337,
+    4272, 4272, 4150, 4150, 3992, 3992, 3824, 3824, 3675, 3675, 3568, 3568,
+    3503, 3503, 3462, 3462, 3418, 3418, 3346, 3346, 3222, 3222, 3040, 3040,
+    2824, 2824, 2622, 2622, 2470, 2470, 2367, 2367, 2298, 2298, 2256, 2256,
+    2238, 2238, 2219, 2219, 2163, 2163, 2068, 2068, 1960, 1960, 1861, 1861,
+    1786, 1786, 1745, 1745, 1744, 1744, 1773, 1773, 1804, 1804, 1801, 1801,
+    1734, 1734, 1612, 1612, 1482, 1482, 1380, 1380, 1307, 1307, 1261, 1261,
+    1262, 1262, 1307, 1307, 1347, 1347, 1336, 1336, 1275, 1275, 1191, 1191,
+    1098, 1098, 997, 997, 905, 905, 849, 849, 829, 829, 821, 821,
+    805, 805, 776, 776, 718, 718, 624, 624, 515, 515, 427, 427,
+    361, 361, 302, 302, 254, 254, 215, 215, 157, 157, 57, 57,
+    -65, -65, -185, -185, -311, -311, -440, -440, -546, -546, -610, -610,
+    -644, -644, -667, -667, -685, -685, -711, -711, -764, -764, -846, -846,
+    -936, -936, -1021, -1021, -1123, -1123, -1253, -1253, -1385, -1385, -1486, -1486,
+    -1574, -1574, -1686, -1686, -1821, -1821, -1959, -1959, -2094, -2094, -2222, -2222,
+    -2323, -2323, -2401, -2401, -2492, -2492, -2610, -2610, -2732, -2732, -2849, -2849,
+    -2970, -2970, -3084, -3084, -3173, -3173, -3256, -3256, -3374, -3374, -3539, -3539,
+    -3725, -3725, -3918, -3918, -4136, -4136, -4397, -4397, -4678, -4678, -4933, -4933,
+    -5142, -5142, -5313, -5313, -5442, -5442, -5521, -5521, -5562, -5562, -5576, -5576,
+    -5558, -5558, -5503, -5503, -5411, -5411, -5274, -5274, -5095, -5095, -4926, -4926,
+    -4828, -4828, -4819, -4819, -4894, -4894, -5047, -5047, -5236, -5236, -5388, -5388,
+    -5453, -5453, -5442, -5442, -5390, -5390, -5314, -5314, -5215, -5215, -5099, -5099,
+    -4963, -4963, -4795, -4795, -4571, -4571, -4285, -4285, -3963, -3963, -3634, -3634,
+    -3321, -3321, -3061, -3061, -2886, -2886, -2777, -2777, -2700, -2700, -2643, -2643,
+    -2591, -2591, -2503, -2503, -2359, -2359, -2193, -2193, -2045, -2045, -1924, -1924,
+    -1840, -1840, -1793, -1793, -1755, -1755, -1675, -1675, -1527, -1527, -1317, -1317,
+    -1060, -1060, -776, -776, -495, -495, -253, -253, -60, -60, 118, 118,
+    330, 330, 576, 576, 824, 824, 1062, 1062, 1304, 1304, 1550, 1550,
+    1783, 1783, 1987, 1987, 2151, 2151, 2282, 2282, 2408, 2408, 2558, 2558,
+    2736, 2736, 2940, 2940, 3171, 3171, 3398, 3398, 3559, 3559, 3635, 3635,
+    3673, 3673, 3723, 3723, 3795, 3795, 3887, 3887, 4010, 4010, 4169, 4169,
+    4337, 4337, 4480, 4480, 4593, 4593, 4690, 4690, 4764, 4764, 4799, 4799,
+    4807, 4807, 4825, 4825, 4864, 4864, 4908, 4908, 4946, 4946, 4963, 4963,
+    4928, 4928, 4813, 4813, 4627, 4627, 4405, 4405, 4190, 4190, 4026, 4026,
+    3946, 3946, 3948, 3948, 3988, 3988, 4023, 4023, 4020, 4020, 3962, 3962,
+    3853, 3853, 3730, 3730, 3634, 3634, 3567, 3567, 3512, 3512, 3466, 3466,
+    3422, 3422, 3342, 3342, 3193, 3193, 2990, 2990, 2766, 2766, 2531, 2531,
+    2298, 2298, 2122, 2122, 2051, 2051, 2068, 2068, 2107, 2107, 2127, 2127,
+    2117, 2117, 2061, 2061, 1946, 1946, 1817, 1817, 1750, 1750, 1766, 1766,
+    1825, 1825, 1897, 1897, 1961, 1961, 1976, 1976, 1910, 1910, 1794, 1794,
+    1670, 1670, 1538, 1538, 1406, 1406, 1326, 1326, 1329, 1329, 1375, 1375,
+    1401, 1401, 1388, 1388, 1343, 1343, 1261, 1261, 1148, 1148, 1055, 1055,
+    1038, 1038, 1087, 1087, 1147, 1147, 1201, 1201, 1255, 1255, 1266, 1266,
+    1177, 1177, 1019, 1019, 870, 870, 744, 744, 620, 620, 515, 515,
+    462, 462, 426, 426, 342, 342, 194, 194, 20, 20, -143, -143,
+    -291, -291, -418, -418, -499, -499, -512, -512, -483, -483, -468, -468,
+    -503, -503, -586, -586, -700, -700, -828, -828, -949, -949, -1046, -1046,
+    -1108, -1108, -1138, -1138, -1158, -1158, -1198, -1198, -1263, -1263, -1355, -1355,
+    -1495, -1495, -1687, -1687, -1872, -1872, -1999, -1999, -2098, -2098, -2212, -2212,
+    -2311, -2311, -2353, -2353, -2385, -2385, -2495, -2495, -2680, -2680, -2842, -2842,
+    -2919, -2919, -2973, -2973, -3096, -3096, -3271, -3271, -3408, -3408, -3498, -3498,
+    -3651, -3651, -3943, -3943, -4292, -4292, -4560, -4560, -4740, -4740, -4957, -4957,
+    -5287, -5287, -5663, -5663, -6017, -6017, -6419, -6419, -6947, -6947, -7464, -7464,
+    -7724, -7724, -7658, -7658, -7378, -7378, -6924, -6924, -6239, -6239, -5414, -5414,
+    -4719, -4719, -4304, -4304, -4067, -4067, -3905, -3905, -3873, -3873, -3992, -3992,
+    -4094, -4094, -4037, -4037, -3943, -3943, -4016, -4016, -4230, -4230, -4387, -4387,
+    -4440, -4440, -4508, -4508, -4575, -4575, -4431, -4431, -3969, -3969, -3337, -3337,
+    -2733, -2733, -2191, -2191, -1661, -1661, -1188, -1188, -881, -881, -738, -738,
+    -595, -595, -288, -288, 160, 160, 600, 600, 957, 957, 1262, 1262,
+    1482, 1482, 1477, 1477, 1187, 1187, 753, 753, 366, 366, 73, 73,
+    -163, -163, -294, -294, -219, -219, 15, 15, 236, 236, 400, 400,
+    641, 641, 1025, 1025, 1447, 1447, 1839, 1839, 2288, 2288, 2821, 2821,
+    3277, 3277, 3493, 3493, 3500, 3500, 3407, 3407, 3224, 3224, 2909, 2909,
+    2531, 2531, 2237, 2237, 2093, 2093, 2047, 2047, 2058, 2058, 2118, 2118,
+    2162, 2162, 2103, 2103, 1977, 1977, 1909, 1909, 1940, 1940, 2011, 2011,
+    2125, 2125, 2381, 2381, 2796, 2796, 3223, 3223, 3505, 3505, 3647, 3647,
+    3732, 3732, 3755, 3755, 3634, 3634, 3371, 3371, 3078, 3078, 2817, 2817,
+    2529, 2529, 2144, 2144, 1696, 1696, 1275, 1275, 942, 942, 718, 718,
+    624, 624, 692, 692, 937, 937, 1329, 1329, 1792, 1792, 2232, 2232,
+    2576, 2576, 2801, 2801, 2931, 2931, 2984, 2984, 2958, 2958, 2856, 2856,
+    2720, 2720, 2608, 2608, 2547, 2547, 2496, 2496, 2386, 2386, 2204, 2204,
+    2021, 2021, 1887, 1887, 1758, 1758, 1590, 1590, 1449, 1449, 1434, 1434,
+    1538, 1538, 1668, 1668, 1789, 1789, 1975, 1975, 2283, 2283, 2672, 2672,
+    3073, 3073, 3461, 3461, 3805, 3805, 4017, 4017, 4047, 4047, 3924, 3924,
+    3668, 3668, 3260, 3260, 2756, 2756, 2293, 2293, 1930, 1930, 1625, 1625,
+    1378, 1378, 1256, 1256, 1267, 1267, 1337, 1337, 1417, 1417, 1536, 1536,
+    1720, 1720, 1924, 1924, 2076, 2076, 2161, 2161, 2198, 2198, 2167, 2167,
+    2048, 2048, 1867, 1867, 1641, 1641, 1363, 1363, 1074, 1074, 844, 844,
+    632, 632, 338, 338, -13, -13, -333, -333, -653, -653, -1045, -1045,
+    -1431, -1431, -1665, -1665, -1736, -1736, -1727, -1727, -1661, -1661, -1509, -1509,
+    -1309, -1309, -1153, -1153, -1067, -1067, -1005, -1005, -989, -989, -1108, -1108,
+    -1349, -1349, -1591, -1591, -1828, -1828, -2160, -2160, -2564, -2564, -2896, -2896,
+    -3149, -3149, -3404, -3404, -3601, -3601, -3605, -3605, -3444, -3444, -3236, -3236,
+    -3003, -3003, -2758, -2758, -2612, -2612, -2616, -2616, -2643, -2643, -2588, -2588,
+    -2540, -2540, -2618, -2618, -2732, -2732, -2733, -2733, -2698, -2698, -2799, -2799,
+    -2972, -2972, -3049, -3049, -3140, -3140, -3459, -3459, -3877, -3877, -4120, -4120,
+    -4273, -4273, -4592, -4592, -4967, -4967, -5102, -5102, -5064, -5064, -5132, -5132,
+    -5264, -5264, -5239, -5239, -5217, -5217, -5627, -5627, -6497, -6497, -7388, -7388,
+    -8069, -8069, -8724, -8724, -9301, -9301, -9250, -9250, -8240, -8240, -6644, -6644,
+    -4960, -4960, -3237, -3237, -1448, -1448, 57, 57, 908, 908, 1194, 1194,
+    1245, 1245, 1192, 1192, 985, 985, 641, 641, 243, 243, -176, -176,
+    -597, -597, -935, -935, -1093, -1093, -1040, -1040, -728, -728, -51, -51,
+    959, 959, 2018, 2018, 2844, 2844, 3390, 3390, 3714, 3714, 3799, 3799,
+    3664, 3664, 3486, 3486, 3450, 3450, 3610, 3610, 3933, 3933, 4315, 4315,
+    4524, 4524, 4323, 4323, 3695, 3695, 2808, 2808, 1763, 1763, 565, 565,
+    -664, -664, -1640, -1640, -2192, -2192, -2407, -2407, -2399, -2399, -2109, -2109,
+    -1473, -1473, -623, -623, 249, 249, 1092, 1092, 1909, 1909, 2586, 2586,
+    2971, 2971, 3001, 3001, 2665, 2665, 1946, 1946, 914, 914, -221, -221,
+    -1242, -1242, -2035, -2035, -2516, -2516, -2564, -2564, -2158, -2158, -1507, -1507,
+    -894, -894, -433, -433, -82, -82, 189, 189, 369, 369, 510, 510,
+    711, 711, 1018, 1018, 1409, 1409, 1845, 1845, 2262, 2262, 2550, 2550,
+    2619, 2619, 2485, 2485, 2236, 2236, 1929, 1929, 1584, 1584, 1239, 1239,
+    917, 917, 578, 578, 189, 189, -167, -167, -333, -333, -217, -217,
+    191, 191, 890, 890, 1846, 1846, 2932, 2932, 3973, 3973, 4839, 4839,
+    5442, 5442, 5672, 5672, 5456, 5456, 4883, 4883, 4155, 4155, 3417, 3417,
+    2704, 2704, 2072, 2072, 1644, 1644, 1473, 1473, 1468, 1468, 1537, 1537,
+    1699, 1699, 1984, 1984, 2322, 2322, 2606, 2606, 2809, 2809, 2950, 2950,
+    3001, 3001, 2916, 2916, 2717, 2717, 2501, 2501, 2349, 2349, 2260, 2260,
+    2193, 2193, 2127, 2127, 2046, 2046, 1906, 1906, 1649, 1649, 1246, 1246,
+    727, 727, 154, 154, -407, -407, -894, -894, -1230, -1230, -1346, -1346,
+    -1231, -1231, -938, -938, -529, -529, -39, -39, 499, 499, 1014, 1014,
+    1419, 1419, 1650, 1650, 1680, 1680, 1512, 1512, 1169, 1169, 700, 700,
+    166, 166, -375, -375, -857, -857, -1198, -1198, -1323, -1323, -1207, -1207,
+    -915, -915, -574, -574, -280, -280, -25, -25, 248, 248, 510, 510,
+    677, 677, 743, 743, 793, 793, 868, 868, 941, 941, 1008, 1008,
+    1091, 1091, 1158, 1158, 1135, 1135, 1019, 1019, 887, 887, 768, 768,
+    594, 594, 306, 306, -48, -48, -397, -397, -716, -716, -957, -957,
+    -1028, -1028, -923, -923, -725, -725, -442, -442, -16, -16, 463, 463,
+    779, 779, 847, 847, 738, 738, 471, 471, 7, 7, -590, -590,
+    -1186, -1186, -1735, -1735, -2259, -2259, -2706, -2706, -2995, -2995, -3158, -3158,
+    -3288, -3288, -3343, -3343, -3216, -3216, -3004, -3004, -2939, -2939, -3012, -3012,
+    -3012, -3012, -2962, -2962, -3104, -3104, -3433, -3433, -3710, -3710, -3910, -3910,
+    -4210, -4210, -4596, -4596, -4935, -4935, -5284, -5284, -5641, -5641, -5681, -5681,
+    -5282, -5282, -5082, -5082, -5855, -5855, -7394, -7394, -8735, -8735, -9520, -9520,
+    -10314, -10314, -11313, -11313, -11660, -11660, -10586, -10586, -8438, -8438, -5966, -5966,
+    -3367, -3367, -707, -707, 1461, 1461, 2639, 2639, 3046, 3046, 3174, 3174,
+    3118, 3118, 2775, 2775, 2304, 2304, 1939, 1939, 1591, 1591, 1020, 1020,
+    290, 290, -283, -283, -522, -522, -418, -418, 145, 145, 1264, 1264,
+    2679, 2679, 3929, 3929, 4767, 4767, 5150, 5150, 5055, 5055, 4587, 4587,
+    4036, 4036, 3629, 3629, 3438, 3438, 3568, 3568, 4057, 4057, 4582, 4582,
+    4620, 4620, 3963, 3963, 2809, 2809, 1393, 1393, -175, -175, -1700, -1700,
+    -2828, -2828, -3359, -3359, -3449, -3449, -3329, -3329, -3017, -3017, -2479, -2479,
+    -1846, -1846, -1226, -1226, -539, -539, 258, 258, 999, 999, 1520, 1520,
+    1784, 1784, 1698, 1698, 1101, 1101, 30, 30, -1232, -1232, -2411, -2411,
+    -3364, -3364, -3949, -3949, -4010, -4010, -3537, -3537, -2723, -2723, -1818, -1818,
+    -1001, -1001, -393, -393, -73, -73, 25, 25, 97, 97, 302, 302,
+    647, 647, 1092, 1092, 1640, 1640, 2248, 2248, 2771, 2771, 3064, 3064,
+    3087, 3087, 2873, 2873, 2488, 2488, 2042, 2042, 1665, 1665, 1418, 1418,
+    1255, 1255, 1101, 1101, 944, 944, 873, 873, 999, 999, 1355, 1355,
+    1891, 1891, 2601, 2601, 3526, 3526, 4571, 4571, 5463, 5463, 5997, 5997,
+    6166, 6166, 5976, 5976, 5328, 5328, 4246, 4246, 3025, 3025, 2015, 2015,
+    1330, 1330, 915, 915, 749, 749, 841, 841, 1082, 1082, 1298, 1298,
+    1451, 1451, 1626, 1626, 1803, 1803, 1866, 1866, 1833, 1833, 1845, 1845,
+    1914, 1914, 1905, 1905, 1756, 1756, 1528, 1528, 1264, 1264, 984, 984,
+    730, 730, 514, 514, 307, 307, 120, 120, -25, -25, -204, -204,
+    -529, -529, -969, -969, -1349, -1349, -1537, -1537, -1533, -1533, -1340, -1340,
+    -859, -859, -54, -54, 866, 866, 1608, 1608, 2082, 2082, 2343, 2343,
+    2355, 2355, 2055, 2055, 1556, 1556, 1051, 1051, 605, 605, 216, 216,
+    -63, -63, -192, -192, -219, -219, -207, -207, -144, -144, 28, 28,
+    341, 341, 750, 750, 1152, 1152, 1478, 1478, 1724, 1724, 1903, 1903,
+    2009, 2009, 2038, 2038, 1996, 1996, 1907, 1907, 1826, 1826, 1798, 1798,
+    1818, 1818, 1844, 1844, 1796, 1796, 1584, 1584, 1195, 1195, 732, 732,
+    294, 294, -115, -115, -481, -481, -705, -705, -726, -726, -586, -586,
+    -315, -315, 90, 90, 533, 533, 831, 831, 896, 896, 799, 799,
+    615, 615, 315, 315, -156, -156, -770, -770, -1416, -1416, -1976, -1976,
+    -2396, -2396, -2736, -2736, -3102, -3102, -3481, -3481, -3703, -3703, -3644, -3644,
+    -3427, -3427, -3267, -3267, -3181, -3181, -3042, -3042, -2854, -2854, -2772, -2772,
+    -2853, -2853, -3033, -3033, -3297, -3297, -3653, -3653, -3993, -3993, -4256, -4256,
+    -4594, -4594, -5111, -5111, -5620, -5620, -5951, -5951, -6243, -6243, -6578, -6578,
+    -6618, -6618, -6121, -6121, -5589, -5589, -5839, -5839, -6954, -6954, -8203, -8203,
+    -9043, -9043, -9634, -9634, -10151, -10151, -10141, -10141, -9006, -9006, -6757, -6757,
+    -3939, -3939, -1092, -1092, 1410, 1410, 3268, 3268, 4367, 4367, 4829, 4829,
+    4862, 4862, 4660, 4660, 4375, 4375, 3996, 3996, 3346, 3346, 2378, 2378,
+    1327, 1327, 442, 442, -232, -232, -648, -648, -538, -538, 340, 340,
+    1794, 1794, 3308, 3308, 4520, 4520, 5331, 5331, 5605, 5605, 5198, 5198,
+    4341, 4341, 3569, 3569, 3158, 3158, 2993, 2993, 2966, 2966, 3056, 3056,
+    3052, 3052, 2629, 2629, 1709, 1709, 479, 479, -879, -879, -2225, -2225,
+    -3349, -3349, -4055, -4055, -4349, -4349, -4375, -4375, -4186, -4186, -3745, -3745,
+    -3113, -3113, -2438, -2438, -1710, -1710, -804, -804, 215, 215, 1073, 1073,
+    1595, 1595, 1759, 1759, 1461, 1461, 591, 591, -683, -683, -1999, -1999,
+    -3113, -3113, -3920, -3920, -4263, -4263, -4013, -4013, -3271, -3271, -2302, -2302,
+    -1283, -1283, -259, -259, 691, 691, 1421, 1421, 1898, 1898, 2246, 2246,
+    2574, 2574, 2876, 2876, 3127, 3127, 3352, 3352, 3520, 3520, 3513, 3513,
+    3257, 3257, 2815, 2815, 2346, 2346, 2024, 2024, 1935, 1935, 1987, 1987,
+    1982, 1982, 1860, 1860, 1782, 1782, 1884, 1884, 2099, 2099, 2320, 2320,
+    2608, 2608, 3087, 3087, 3716, 3716, 4329, 4329, 4838, 4838, 5234, 5234,
+    5409, 5409, 5165, 5165, 4447, 4447, 3455, 3455, 2428, 2428, 1443, 1443,
+    535, 535, -133, -133, -393, -393, -322, -322, -124, -124, 149, 149,
+    577, 577, 1108, 1108, 1535, 1535, 1761, 1761, 1878, 1878, 1948, 1948,
+    1870, 1870, 1562, 1562, 1138, 1138, 742, 742, 335, 335, -164, -164,
+    -613, -613, -803, -803, -774, -774, -740, -740, -777, -777, -809, -809,
+    -814, -814, -842, -842, -888, -888, -893, -893, -803, -803, -542, -542,
+    -20, -20, 728, 728, 1479, 1479, 2005, 2005, 2264, 2264, 2356, 2356,
+    2324, 2324, 2119, 2119, 1748, 1748, 1288, 1288, 795, 795, 317, 317,
+    -49, -49, -233, -233, -285, -285, -237, -237, -13, -13, 430, 430,
+    996, 996, 1572, 1572, 2127, 2127, 2619, 2619, 2937, 2937, 3017, 3017,
+    2899, 2899, 2630, 2630, 2251, 2251, 1861, 1861, 1566, 1566, 1358, 1358,
+    1157, 1157, 975, 975, 874, 874, 807, 807, 636, 636, 347, 347,
+    70, 70, -107, -107, -203, -203, -214, -214, -100, -100, 64, 64,
+    155, 155, 222, 222, 399, 399, 604, 604, 592, 592, 311, 311,
+    -79, -79, -494, -494, -983, -983, -1533, -1533, -2072, -2072, -2592, -2592,
+    -3091, -3091, -3473, -3473, -3665, -3665, -3693, -3693, -3567, -3567, -3259, -3259,
+    -2856, -2856, -2570, -2570, -2475, -2475, -2413, -2413, -2296, -2296, -2293, -2293,
+    -2529, -2529, -2820, -2820, -2991, -2991, -3179, -3179, -3510, -3510, -3813, -3813,
+    -3995, -3995, -4265, -4265, -4657, -4657, -4872, -4872, -4905, -4905, -5163, -5163,
+    -5611, -5611, -5562, -5562, -4754, -4754, -3961, -3961, -3975, -3975, -4615, -4615,
+    -5351, -5351, -6301, -6301, -7752, -7752, -9115, -9115, -9423, -9423, -8634, -8634,
+    -7396, -7396, -5725, -5725, -3090, -3090, 229, 229, 3039, 3039, 4641, 4641,
+    5387, 5387, 5771, 5771, 5811, 5811, 5462, 5462, 4922, 4922, 4299, 4299,
+    3436, 3436, 2265, 2265, 1031, 1031, 16, 16, -666, -666, -892, -892,
+    -468, -468, 592, 592, 2003, 2003, 3500, 3500, 4843, 4843, 5593, 5593,
+    5405, 5405, 4530, 4530, 3582, 3582, 2830, 2830, 2168, 2168, 1629, 1629,
+    1409, 1409, 1418, 1418, 1265, 1265, 707, 707, -156, -156, -1156, -1156,
+    -2269, -2269, -3446, -3446, -4448, -4448, -4997, -4997, -5032, -5032, -4695, -4695,
+    -4173, -4173, -3590, -3590, -2946, -2946, -2128, -2128, -1092, -1092, 1, 1,
+    950, 950, 1682, 1682, 2121, 2121, 2067, 2067, 1415, 1415, 343, 343,
+    -890, -890, -2158, -2158, -3321, -3321, -4066, -4066, -4102, -4102, -3456, -3456,
+    -2412, -2412, -1220, -1220, 24, 24, 1225, 1225, 2201, 2201, 2834, 2834,
+    3196, 3196, 3449, 3449, 3646, 3646, 3744, 3744, 3725, 3725, 3626, 3626,
+    3437, 3437, 3076, 3076, 2518, 2518, 1926, 1926, 1550, 1550, 1482, 1482,
+    1562, 1562, 1614, 1614, 1645, 1645, 1708, 1708, 1739, 1739, 1695, 1695,
+    1710, 1710, 1925, 1925, 2299, 2299, 2730, 2730, 3227, 3227, 3780, 3780,
+    4183, 4183, 4164, 4164, 3662, 3662, 2855, 2855, 1936, 1936, 975, 975,
+    48, 48, -677, -677, -1088, -1088, -1243, -1243, -1229, -1229, -1042, -1042,
+    -681, -681, -244, -244, 168, 168, 545, 545, 911, 911, 1251, 1251,
+    1489, 1489, 1537, 1537, 1370, 1370, 1032, 1032, 575, 575, 42, 42,
+    -473, -473, -861, -861, -1095, -1095, -1212, -1212, -1203, -1203, -1038, -1038,
+    -771, -771, -546, -546, -456, -456, -430, -430, -301, -301, 17, 17,
+    477, 477, 1029, 1029, 1673, 1673, 2353, 2353, 2910, 2910, 3203, 3203,
+    3189, 3189, 2886, 2886, 2352, 2352, 1698, 1698, 1054, 1054, 531, 531,
+    192, 192, 48, 48, 86, 86, 303, 303, 695, 695, 1222, 1222,
+    1819, 1819, 2414, 2414, 2925, 2925, 3278, 3278, 3431, 3431, 3382, 3382,
+    3145, 3145, 2748, 2748, 2244, 2244, 1714, 1714, 1247, 1247, 901, 901,
+    672, 672, 539, 539, 498, 498, 534, 534, 599, 599, 643, 643,
+    635, 635, 566, 566, 442, 442, 299, 299, 175, 175, 88, 88,
+    62, 62, 122, 122, 261, 261, 437, 437, 608, 608, 726, 726,
+    719, 719, 508, 508, 75, 75, -505, -505, -1118, -1118, -1679, -1679,
+    -2141, -2141, -2473, -2473, -2665, -2665, -2700, -2700, -2535, -2535, -2176, -2176,
+    -1767, -1767, -1461, -1461, -1241, -1241, -1014, -1014, -853, -853, -943, -943,
+    -1284, -1284, -1704, -1704, -2142, -2142, -2660, -2660, -3183, -3183, -3501, -3501,
+    -3586, -3586, -3627, -3627, -3700, -3700, -3661, -3661, -3466, -3466, -3322, -3322,
+    -3364, -3364, -3467, -3467, -3543, -3543, -3728, -3728, -4022, -4022, -4066, -4066,
+    -3599, -3599, -2949, -2949, -2775, -2775, -3438, -3438, -4778, -4778, -6337, -6337,
+    -7675, -7675, -8602, -8602, -9125, -9125, -9065, -9065, -7931, -7931, -5473, -5473,
+    -2211, -2211, 944, 944, 3491, 3491, 5407, 5407, 6594, 6594, 6838, 6838,
+    6362, 6362, 5781, 5781, 5288, 5288, 4456, 4456, 3085, 3085, 1625, 1625,
+    452, 452, -586, -586, -1518, -1518, -1824, -1824, -1138, -1138, 193, 193,
+    1638, 1638, 3056, 3056, 4379, 4379, 5183, 5183, 5072, 5072, 4210, 4210,
+    3115, 3115, 2100, 2100, 1231, 1231, 621, 621, 368, 368, 305, 305,
+    146, 146, -214, -214, -796, -796, -1680, -1680, -2792, -2792, -3825, -3825,
+    -4603, -4603, -5201, -5201, -5563, -5563, -5437, -5437, -4818, -4818, -4046, -4046,
+    -3291, -3291, -2358, -2358, -1124, -1124, 160, 160, 1183, 1183, 1893, 1893,
+    2316, 2316, 2308, 2308, 1729, 1729, 708, 708, -509, -509, -1785, -1785,
+    -2964, -2964, -3731, -3731, -3854, -3854, -3372, -3372, -2420, -2420, -1102, -1102,
+    346, 346, 1586, 1586, 2492, 2492, 3187, 3187, 3715, 3715, 3963, 3963,
+    3943, 3943, 3849, 3849, 3771, 3771, 3583, 3583, 3201, 3201, 2725, 2725,
+    2265, 2265, 1799, 1799, 1339, 1339, 1054, 1054, 1074, 1074, 1273, 1273,
+    1396, 1396, 1344, 1344, 1224, 1224, 1165, 1165, 1199, 1199, 1318, 1318,
+    1566, 1566, 2003, 2003, 2586, 2586, 3113, 3113, 3375, 3375, 3347, 3347,
+    3097, 3097, 2558, 2558, 1610, 1610, 431, 431, -550, -550, -1140, -1140,
+    -1521, -1521, -1838, -1838, -1937, -1937, -1668, -1668, -1130, -1130, -502, -502,
+    145, 145, 764, 764, 1248, 1248, 1540, 1540, 1688, 1688, 1715, 1715,
+    1527, 1527, 1057, 1057, 437, 437, -119, -119, -528, -528, -809, -809,
+    -940, -940, -912, -912, -793, -793, -629, -629, -410, -410, -204, -204,
+    -122, -122, -114, -114, -10, -10, 243, 243, 595, 595, 1065, 1065,
+    1696, 1696, 2408, 2408, 3038, 3038, 3461, 3461, 3614, 3614, 3472, 3472,
+    3043, 3043, 2388, 2388, 1623, 1623, 896, 896, 338, 338, 40, 40,
+    15, 15, 193, 193, 512, 512, 1008, 1008, 1684, 1684, 2375, 2375,
+    2905, 2905, 3268, 3268, 3492, 3492, 3494, 3494, 3234, 3234, 2820, 2820,
+    2328, 2328, 1744, 1744, 1126, 1126, 632, 632, 326, 326, 157, 157,
+    107, 107, 205, 205, 397, 397, 539, 539, 543, 543, 460, 460,
+    377, 377, 307, 307, 219, 219, 133, 133, 90, 90, 97, 97,
+    167, 167, 311, 311, 448, 448, 460, 460, 356, 356, 216, 216,
+    3, 3, -362, -362, -801, -801, -1191, -1191, -1562, -1562, -1961, -1961,
+    -2267, -2267, -2349, -2349, -2259, -2259, -2088, -2088, -1815, -1815, -1430, -1430,
+    -1052, -1052, -814, -814, -735, -735, -802, -802, -1052, -1052, -1494, -1494,
+    -2021, -2021, -2522, -2522, -2987, -2987, -3403, -3403, -3661, -3661, -3713, -3713,
+    -3682, -3682, -3642, -3642, -3509, -3509, -3298, -3298, -3214, -3214, -3312, -3312,
+    -3405, -3405, -3462, -3462, -3635, -3635, -3785, -3785, -3544, -3544, -3028, -3028,
+    -2960, -2960, -3798, -3798, -5189, -5189, -6547, -6547, -7739, -7739, -8820, -8820,
+    -9444, -9444, -9033, -9033, -7422, -7422, -4937, -4937, -1952, -1952, 1213, 1213,
+    4066, 4066, 6086, 6086, 7125, 7125, 7386, 7386, 7088, 7088, 6408, 6408,
+    5551, 5551, 4588, 4588, 3377, 3377, 1877, 1877, 341, 341, -906, -906,
+    -1678, -1678, -1841, -1841, -1273, -1273, -65, -65, 1427, 1427, 2849, 2849,
+    4028, 4028, 4806, 4806, 4906, 4906, 4184, 4184, 2930, 2930, 1679, 1679,
+    747, 747, 132, 132, -228, -228, -360, -360, -420, -420, -673, -673,
+    -1268, -1268, -2145, -2145, -3152, -3152, -4148, -4148, -5010, -5010, -5612, -5612,
+    -5821, -5821, -5572, -5572, -4958, -4958, -4153, -4153, -3221, -3221, -2129, -2129,
+    -937, -937, 182, 182, 1110, 1110, 1829, 1829, 2289, 2289, 2359, 2359,
+    1943, 1943, 1066, 1066, -124, -124, -1398, -1398, -2511, -2511, -3257, -3257,
+    -3489, -3489, -3118, -3118, -2155, -2155, -781, -781, 674, 674, 1920, 1920,
+    2881, 2881, 3595, 3595, 4027, 4027, 4143, 4143, 4084, 4084, 4011, 4011,
+    3854, 3854, 3480, 3480, 2994, 2994, 2566, 2566, 2139, 2139, 1595, 1595,
+    1097, 1097, 898, 898, 953, 953, 1000, 1000, 955, 955, 934, 934,
+    950, 950, 884, 884, 762, 762, 801, 801, 1123, 1123, 1604, 1604,
+    2092, 2092, 2535, 2535, 2840, 2840, 2842, 2842, 2493, 2493, 1889, 1889,
+    1085, 1085, 114, 114, -825, -825, -1478, -1478, -1817, -1817, -1966, -1966,
+    -1905, -1905, -1510, -1510, -829, -829, -80, -80, 596, 596, 1191, 1191,
+    1687, 1687, 1997, 1997, 2052, 2052, 1865, 1865, 1477, 1477, 935, 935,
+    344, 344, -142, -142, -449, -449, -620, -620, -680, -680, -582, -582,
+    -330, -330, -36, -36, 208, 208, 376, 376, 450, 450, 437, 437,
+    440, 440, 574, 574, 862, 862, 1259, 1259, 1727, 1727, 2220, 2220,
+    2681, 2681, 3038, 3038, 3197, 3197, 3076, 3076, 2689, 2689, 2137, 2137,
+    1532, 1532, 975, 975, 566, 566, 352, 352, 306, 306, 396, 396,
+    654, 654, 1118, 1118, 1747, 1747, 2401, 2401, 2926, 2926, 3261, 3261,
+    3418, 3418, 3375, 3375, 3082, 3082, 2577, 2577, 1968, 1968, 1330, 1330,
+    713, 713, 219, 219, -52, -52, -99, -99, 5, 5, 173, 173,
+    337, 337, 489, 489, 660, 660, 811, 811, 831, 831, 695, 695,
+    517, 517, 387, 387, 277, 277, 149, 149, 44, 44, 26, 26,
+    94, 94, 180, 180, 208, 208, 130, 130, -94, -94, -469, -469,
+    -926, -926, -1363, -1363, -1728, -1728, -1997, -1997, -2108, -2108, -2045, -2045,
+    -1912, -1912, -1787, -1787, -1598, -1598, -1293, -1293, -992, -992, -824, -824,
+    -772, -772, -809, -809, -994, -994, -1342, -1342, -1761, -1761, -2201, -2201,
+    -2698, -2698, -3194, -3194, -3498, -3498, -3520, -3520, -3414, -3414, -3370, -3370,
+    -3351, -3351, -3220, -3220, -3048, -3048, -3036, -3036, -3161, -3161, -3146, -3146,
+    -2858, -2858, -2492, -2492, -2341, -2341, -2578, -2578, -3306, -3306, -4576, -4576,
+    -6256, -6256, -7956, -7956, -9134, -9134, -9368, -9368, -8575, -8575, -6931, -6931,
+    -4586, -4586, -1646, -1646, 1540, 1540, 4331, 4331, 6224, 6224, 7176, 7176,
+    7417, 7417, 7128, 7128, 6435, 6435, 5533, 5533, 4560, 4560, 3423, 3423,
+    1967, 1967, 355, 355, -946, -946, -1620, -1620, -1713, -1713, -1345, -1345,
+    -507, -507, 737, 737, 2104, 2104, 3262, 3262, 3968, 3968, 4053, 4053,
+    3512, 3512, 2620, 2620, 1740, 1740, 1037, 1037, 487, 487, 57, 57,
+    -285, -285, -653, -653, -1164, -1164, -1826, -1826, -2584, -2584, -3433, -3433,
+    -4353, -4353, -5160, -5160, -5593, -5593, -5574, -5574, -5244, -5244, -4709, -4709,
+    -3931, -3931, -2932, -2932, -1852, -1852, -789, -789, 244, 244, 1157, 1157,
+    1776, 1776, 2012, 2012, 1862, 1862, 1332, 1332, 495, 495, -469, -469,
+    -1397, -1397, -2210, -2210, -2787, -2787, -2915, -2915, -2488, -2488, -1635, -1635,
+    -574, -574, 552, 552, 1633, 1633, 2506, 2506, 3065, 3065, 3411, 3411,
+    3701, 3701, 3880, 3880, 3787, 3787, 3480, 3480, 3185, 3185, 2931, 2931,
+    2546, 2546, 1993, 1993, 1451, 1451, 1052, 1052, 779, 779, 608, 608,
+    546, 546, 524, 524, 439, 439, 314, 314, 310, 310, 550, 550,
+    992, 992, 1484, 1484, 1918, 1918, 2256, 2256, 2464, 2464, 2488, 2488,
+    2293, 2293, 1875, 1875, 1262, 1262, 548, 548, -139, -139, -731, -731,
+    -1209, -1209, -1517, -1517, -1604, -1604, -1492, -1492, -1224, -1224, -781, -781,
+    -174, -174, 495, 495, 1123, 1123, 1647, 1647, 1964, 1964, 1942, 1942,
+    1588, 1588, 1101, 1101, 692, 692, 408, 408, 188, 188, 14, 14,
+    -65, -65, -29, -29, 95, 95, 302, 302, 550, 550, 665, 665,
+    521, 521, 298, 298, 313, 313, 600, 600, 909, 909, 1108, 1108,
+    1331, 1331, 1702, 1702, 2134, 2134, 2460, 2460, 2592, 2592, 2521, 2521,
+    2274, 2274, 1932, 1932, 1589, 1589, 1262, 1262, 887, 887, 474, 474,
+    181, 181, 142, 142, 319, 319, 616, 616, 1024, 1024, 1524, 1524,
+    1989, 1989, 2325, 2325, 2573, 2573, 2742, 2742, 2717, 2717, 2444, 2444,
+    2046, 2046, 1648, 1648, 1239, 1239, 791, 791, 389, 389, 162, 162,
+    120, 120, 170, 170, 252, 252, 386, 386, 565, 565, 712, 712,
+    767, 767, 737, 737, 647, 647, 520, 520, 409, 409, 345, 345,
+    284, 284, 193, 193, 110, 110, 49, 49, -49, -49, -216, -216,
+    -419, -419, -657, -657, -962, -962, -1297, -1297, -1566, -1566, -1739, -1739,
+    -1872, -1872, -1990, -1990, -2031, -2031, -1933, -1933, -1716, -1716, -1467, -1467,
+    -1277, -1277, -1206, -1206, -1271, -1271, -1426, -1426, -1603, -1603, -1818, -1818,
+    -2146, -2146, -2548, -2548, -2873, -2873, -3081, -3081, -3280, -3280, -3506, -3506,
+    -3664, -3664, -3725, -3725, -3764, -3764, -3781, -3781, -3692, -3692, -3509, -3509,
+    -3278, -3278, -2910, -2910, -2371, -2371, -2027, -2027, -2453, -2453, -3769, -3769,
+    -5460, -5460, -7000, -7000, -8317, -8317, -9402, -9402, -9813, -9813, -9008, -9008,
+    -7008, -7008, -4286, -4286, -1217, -1217, 1923, 1923, 4605, 4605, 6297, 6297,
+    7052, 7052, 7372, 7372, 7448, 7448, 6962, 6962, 5724, 5724, 4089, 4089,
+    2538, 2538, 1166, 1166, -147, -147, -1270, -1270, -1856, -1856, -1754, -1754,
+    -1088, -1088, 9, 9, 1425, 1425, 2830, 2830, 3743, 3743, 3934, 3934,
+    3597, 3597, 3048, 3048, 2409, 2409, 1654, 1654, 841, 841, 161, 161,
+    -264, -264, -537, -537, -865, -865, -1351, -1351, -1980, -1980, -2735, -2735,
+    -3590, -3590, -4437, -4437, -5118, -5118, -5530, -5530, -5639, -5639, -5433, -5433,
+    -4918, -4918, -4137, -4137, -3159, -3159, -2070, -2070, -953, -953, 109, 109,
+    1018, 1018, 1661, 1661, 1933, 1933, 1767, 1767, 1183, 1183, 309, 309,
+    -682, -682, -1650, -1650, -2449, -2449, -2864, -2864, -2734, -2734, -2136, -2136,
+    -1285, -1285, -297, -297, 833, 833, 2034, 2034, 3114, 3114, 3917, 3917,
+    4408, 4408, 4607, 4607, 4531, 4531, 4230, 4230, 3799, 3799, 3295, 3295,
+    2719, 2719, 2120, 2120, 1662, 1662, 1465, 1465, 1439, 1439, 1373, 1373,
+    1158, 1158, 827, 827, 463, 463, 179, 179, 121, 121, 367, 367,
+    836, 836, 1372, 1372, 1877, 1877, 2319, 2319, 2655, 2655, 2787, 2787,
+    2617, 2617, 2132, 2132, 1435, 1435, 671, 671, -50, -50, -666, -666,
+    -1135, -1135, -1449, -1449, -1624, -1624, -1679, -1679, -1593, -1593, -1297, -1297,
+    -756, -756, -65, -65, 597, 597, 1106, 1106, 1442, 1442, 1594, 1594,
+    1536, 1536, 1311, 1311, 997, 997, 594, 594, 79, 79, -404, -404,
+    -589, -589, -392, -392, -32, -32, 220, 220, 320, 320, 394, 394,
+    506, 506, 633, 633, 790, 790, 1019, 1019, 1285, 1285, 1535, 1535,
+    1857, 1857, 2346, 2346, 2861, 2861, 3116, 3116, 3034, 3034, 2801, 2801,
+    2576, 2576, 2327, 2327, 1986, 1986, 1574, 1574, 1125, 1125, 647, 647,
+    223, 223, 10, 10, 87, 87, 359, 359, 698, 698, 1086, 1086,
+    1551, 1551, 2052, 2052, 2504, 2504, 2821, 2821, 2896, 2896, 2653, 2653,
+    2199, 2199, 1769, 1769, 1464, 1464, 1161, 1161, 753, 753, 314, 314,
+    -18, -18, -189, -189, -206, -206, -89, -89, 80, 80, 175, 175,
+    181, 181, 237, 237, 439, 439, 675, 675, 746, 746, 608, 608,
+    401, 401, 269, 269, 225, 225, 186, 186, 57, 57, -209, -209,
+    -560, -560, -878, -878, -1096, -1096, -1270, -1270, -1493, -1493, -1777, -1777,
+    -2016, -2016, -2072, -2072, -1929, -1929, -1740, -1740, -1674, -1674, -1713, -1713,
+    -1721, -1721, -1664, -1664, -1650, -1650, -1729, -1729, -1850, -1850, -1995, -1995,
+    -2205, -2205, -2427, -2427, -2547, -2547, -2607, -2607, -2794, -2794, -3118, -3118,
+    -3339, -3339, -3346, -3346, -3328, -3328, -3418, -3418, -3431, -3431, -3201, -3201,
+    -2892, -2892, -2726, -2726, -2692, -2692, -2835, -2835, -3515, -3515, -4938, -4938,
+    -6647, -6647, -7925, -7925, -8549, -8549, -8699, -8699, -8283, -8283, -6902, -6902,
+    -4504, -4504, -1605, -1605, 1228, 1228, 3720, 3720, 5666, 5666, 6807, 6807,
+    7135, 7135, 6972, 6972, 6531, 6531, 5679, 5679, 4293, 4293, 2616, 2616,
+    1042, 1042, -241, -241, -1207, -1207, -1779, -1779, -1851, -1851, -1419, -1419,
+    -562, -562, 618, 618, 1926, 1926, 3064, 3064, 3784, 3784, 4020, 4020,
+    3821, 3821, 3238, 3238, 2357, 2357, 1342, 1342, 345, 345, -596, -596,
+    -1482, -1482, -2257, -2257, -2864, -2864, -3357, -3357, -3834, -3834, -4291, -4291,
+    -4627, -4627, -4787, -4787, -4807, -4807, -4701, -4701, -4403, -4403, -3879, -3879,
+    -3237, -3237, -2624, -2624, -2046, -2046, -1396, -1396, -680, -680, -93, -93,
+    208, 208, 276, 276, 234, 234, 58, 58, -355, -355, -943, -943,
+    -1480, -1480, -1798, -1798, -1886, -1886, -1752, -1752, -1327, -1327, -593, -593,
+    333, 333, 1321, 1321, 2341, 2341, 3369, 3369, 4257, 4257, 4814, 4814,
+    4992, 4992, 4897, 4897, 4624, 4624, 4172, 4172, 3538, 3538, 2821, 2821,
+    2177, 2177, 1704, 1704, 1398, 1398, 1226, 1226, 1181, 1181, 1263, 1263,
+    1434, 1434, 1617, 1617, 1747, 1747, 1810, 1810, 1815, 1815, 1759, 1759,
+    1627, 1627, 1421, 1421, 1165, 1165, 880, 880, 579, 579, 299, 299,
+    79, 79, -98, -98, -298, -298, -544, -544, -733, -733, -741, -741,
+    -593, -593, -462, -462, -458, -458, -487, -487, -389, -389, -138, -138,
+    153, 153, 395, 395, 578, 578, 704, 704, 765, 765, 782, 782,
+    785, 785, 747, 747, 627, 627, 467, 467, 369, 369, 364, 364,
+    401, 401, 466, 466, 602, 602, 813, 813, 1049, 1049, 1305, 1305,
+    1627, 1627, 2000, 2000, 2335, 2335, 2579, 2579, 2742, 2742, 2800, 2800,
+    2682, 2682, 2401, 2401, 2076, 2076, 1773, 1773, 1445, 1445, 1091, 1091,
+    833, 833, 772, 772, 854, 854, 979, 979, 1145, 1145, 1395, 1395,
+    1700, 1700, 1988, 1988, 2232, 2232, 2429, 2429, 2533, 2533, 2479, 2479,
+    2276, 2276, 1997, 1997, 1690, 1690, 1356, 1356, 985, 985, 605, 605,
+    270, 270, 33, 33, -85, -85, -104, -104, -40, -40, 113, 113,
+    354, 354, 641, 641, 906, 906, 1093, 1093, 1165, 1165, 1108, 1108,
+    957, 957, 772, 772, 565, 565, 288, 288, -83, -83, -492, -492,
+    -873, -873, -1218, -1218, -1536, -1536, -1796, -1796, -1956, -1956, -2015, -2015,
+    -2002, -2002, -1930, -1930, -1822, -1822, -1732, -1732, -1706, -1706, -1735, -1735,
+    -1763, -1763, -1755, -1755, -1729, -1729, -1736, -1736, -1795, -1795, -1860, -1860,
+    -1887, -1887, -1924, -1924, -2079, -2079, -2367, -2367, -2697, -2697, -3023, -3023,
+    -3377, -3377, -3698, -3698, -3807, -3807, -3658, -3658, -3419, -3419, -3180, -3180,
+    -2832, -2832, -2424, -2424, -2389, -2389, -3081, -3081, -4264, -4264, -5409, -5409,
+    -6316, -6316, -7055, -7055, -7438, -7438, -7039, -7039, -5767, -5767, -3967, -3967,
+    -1931, -1931, 267, 267, 2402, 2402, 4036, 4036, 4979, 4979, 5440, 5440,
+    5574, 5574, 5251, 5251, 4416, 4416, 3325, 3325, 2215, 2215, 1083, 1083,
+    -28, -28, -855, -855, -1218, -1218, -1207, -1207, -885, -885, -120, -120,
+    1060, 1060, 2272, 2272, 3165, 3165, 3738, 3738, 4041, 4041, 3869, 3869,
+    3084, 3084, 1947, 1947, 834, 834, -200, -200, -1253, -1253, -2180, -2180,
+    -2742, -2742, -3004, -3004, -3234, -3234, -3480, -3480, -3570, -3570, -3479, -3479,
+    -3394, -3394, -3382, -3382, -3302, -3302, -3073, -3073, -2795, -2795, -2559, -2559,
+    -2325, -2325, -2059, -2059, -1818, -1818, -1631, -1631, -1439, -1439, -1187, -1187,
+    -889, -889, -596, -596, -366, -366, -269, -269, -317, -317, -423, -423,
+    -520, -520, -645, -645, -786, -786, -737, -737, -282, -282, 518, 518,
+    1411, 1411, 2305, 2305, 3273, 3273, 4219, 4219, 4810, 4810, 4848, 4848,
+    4485, 4485, 3939, 3939, 3223, 3223, 2345, 2345, 1557, 1557, 1154, 1154,
+    1130, 1130, 1282, 1282, 1575, 1575, 2132, 2132, 2903, 2903, 3588, 3588,
+    3957, 3957, 4024, 4024, 3871, 3871, 3478, 3478, 2828, 2828, 2024, 2024,
+    1186, 1186, 348, 348, -466, -466, -1152, -1152, -1579, -1579, -1690, -1690,
+    -1495, -1495, -1054, -1054, -489, -489, 64, 64, 549, 549, 966, 966,
+    1241, 1241, 1250, 1250, 996, 996, 643, 643, 321, 321, 16, 16,
+    -300, -300, -545, -545, -629, -629, -576, -576, -448, -448, -219, -219,
+    156, 156, 605, 605, 984, 984, 1238, 1238, 1423, 1423, 1584, 1584,
+    1681, 1681, 1675, 1675, 1611, 1611, 1582, 1582, 1634, 1634, 1745, 1745,
+    1879, 1879, 2025, 2025, 2150, 2150, 2187, 2187, 2094, 2094, 1915, 1915,
+    1719, 1719, 1526, 1526, 1326, 1326, 1161, 1161, 1085, 1085, 1079, 1079,
+    1094, 1094, 1168, 1168, 1383, 1383, 1706, 1706, 2002, 2002, 2191, 2191,
+    2297, 2297, 2312, 2312, 2176, 2176, 1902, 1902, 1578, 1578, 1227, 1227,
+    806, 806, 366, 366, 53, 53, -97, -97, -186, -186, -237, -237,
+    -138, -138, 143, 143, 455, 455, 691, 691, 915, 915, 1167, 1167,
+    1327, 1327, 1285, 1285, 1114, 1114, 921, 921, 666, 666, 268, 268,
+    -211, -211, -629, -629, -932, -932, -1168, -1168, -1391, -1391, -1621, -1621,
+    -1849, -1849, -2037, -2037, -2156, -2156, -2242, -2242, -2343, -2343, -2425, -2425,
+    -2416, -2416, -2318, -2318, -2183, -2183, -2020, -2020, -1855, -1855, -1801, -1801,
+    -1927, -1927, -2129, -2129, -2296, -2296, -2520, -2520, -2918, -2918, -3365, -3365,
+    -3630, -3630, -3694, -3694, -3676, -3676, -3548, -3548, -3244, -3244, -2975, -2975,
+    -3068, -3068, -3531, -3531, -4115, -4115, -4784, -4784, -5689, -5689, -6651, -6651,
+    -7121, -7121, -6775, -6775, -5798, -5798, -4461, -4461, -2827, -2827, -1002, -1002,
+    705, 705, 2090, 2090, 3209, 3209, 4059, 4059, 4424, 4424, 4244, 4244,
+    3798, 3798, 3307, 3307, 2647, 2647, 1687, 1687, 643, 643, -172, -172,
+    -688, -688, -943, -943, -821, -821, -219, -219, 701, 701, 1673, 1673,
+    2601, 2601, 3442, 3442, 3987, 3987, 4025, 4025, 3604, 3604, 2918, 2918,
+    2036, 2036, 970, 970, -119, -119, -1019, -1019, -1711, -1711, -2303, -2303,
+    -2789, -2789, -3076, -3076, -3182, -3182, -3204, -3204, -3135, -3135, -2903, -2903,
+    -2578, -2578, -2322, -2322, -2157, -2157, -1964, -1964, -1730, -1730, -1577, -1577,
+    -1537, -1537, -1467, -1467, -1268, -1268, -1028, -1028, -858, -858, -736, -736,
+    -616, -616, -576, -576, -711, -711, -947, -947, -1088, -1088, -1028, -1028,
+    -802, -802, -438, -438, 108, 108, 846, 846, 1669, 1669, 2429, 2429,
+    3058, 3058, 3553, 3553, 3896, 3896, 4045, 4045, 4000, 4000, 3817, 3817,
+    3545, 3545, 3196, 3196, 2780, 2780, 2343, 2343, 1948, 1948, 1619, 1619,
+    1345, 1345, 1136, 1136, 1058, 1058, 1170, 1170, 1426, 1426, 1680, 1680,
+    1827, 1827, 1905, 1905, 2005, 2005, 2097, 2097, 2055, 2055, 1829, 1829,
+    1526, 1526, 1257, 1257, 1007, 1007, 731, 731, 482, 482, 353, 353,
+    320, 320, 286, 286, 253, 253, 309, 309, 449, 449, 555, 555,
+    597, 597, 701, 701, 937, 937, 1157, 1157, 1204, 1204, 1149, 1149,
+    1163, 1163, 1218, 1218, 1124, 1124, 864, 864, 653, 653, 627, 627,
+    659, 659, 596, 596, 507, 507, 538, 538, 661, 661, 740, 740,
+    768, 768, 853, 853, 1009, 1009, 1135, 1135, 1189, 1189, 1222, 1222,
+    1250, 1250, 1213, 1213, 1087, 1087, 930, 930, 784, 784, 645, 645,
+    525, 525, 457, 457, 427, 427, 401, 401, 399, 399, 472, 472,
+    597, 597, 717, 717, 843, 843, 1017, 1017, 1193, 1193, 1283, 1283,
+    1304, 1304, 1345, 1345, 1402, 1402, 1382, 1382, 1282, 1282, 1207, 1207,
+    1194, 1194, 1172, 1172, 1105, 1105, 1040, 1040, 996, 996, 927, 927,
+    833, 833, 765, 765, 713, 713, 602, 602, 452, 452, 378, 378,
+    387, 387, 346, 346, 166, 166, -87, -87, -347, -347, -639, -639,
+    -968, -968, -1261, -1261, -1491, -1491, -1730, -1730, -1998, -1998, -2195, -2195,
+    -2274, -2274, -2346, -2346, -2495, -2495, -2628, -2628, -2634, -2634, -2576, -2576,
+    -2583, -2583, -2633, -2633, -2628, -2628, -2604, -2604, -2698, -2698, -2916, -2916,
+    -3136, -3136, -3308, -3308, -3484, -3484, -3621, -3621, -3587, -3587, -3429, -3429,
+    -3437, -3437, -3807, -3807, -4399, -4399, -5005, -5005, -5644, -5644, -6370, -6370,
+    -6889, -6889, -6741, -6741, -5845, -5845, -4569, -4569, -3199, -3199, -1707, -1707,
+    -124, -124, 1203, 1203, 2001, 2001, 2423, 2423, 2724, 2724, 2838, 2838,
+    2585, 2585, 2108, 2108, 1702, 1702, 1355, 1355, 845, 845, 233, 233,
+    -139, -139, -126, -126, 117, 117, 517, 517, 1187, 1187, 2088, 2088,
+    2921, 2921, 3493, 3493, 3850, 3850, 3987, 3987, 3732, 3732, 3061, 3061,
+    2220, 2220, 1409, 1409, 607, 607, -176, -176, -770, -770, -1107, -1107,
+    -1343, -1343, -1560, -1560, -1634, -1634, -1536, -1536, -1486, -1486, -1598, -1598,
+    -1678, -1678, -1572, -1572, -1445, -1445, -1472, -1472, -1522, -1522, -1413, -1413,
+    -1261, -1261, -1258, -1258, -1312, -1312, -1220, -1220, -1042, -1042, -990, -990,
+    -1050, -1050, -1032, -1032, -922, -922, -883, -883, -924, -924, -873, -873,
+    -663, -663, -400, -400, -132, -132, 216, 216, 644, 644, 1044, 1044,
+    1402, 1402, 1825, 1825, 2323, 2323, 2737, 2737, 2968, 2968, 3082, 3082,
+    3122, 3122, 2979, 2979, 2577, 2577, 2044, 2044, 1574, 1574, 1222, 1222,
+    964, 964, 873, 873, 1067, 1067, 1506, 1506, 1998, 1998, 2402, 2402,
+    2712, 2712, 2932, 2932, 2989, 2989, 2850, 2850, 2583, 2583, 2259, 2259,
+    1867, 1867, 1402, 1402, 957, 957, 634, 634, 418, 418, 261, 261,
+    206, 206, 331, 331, 594, 594, 880, 880, 1149, 1149, 1425, 1425,
+    1656, 1656, 1735, 1735, 1653, 1653, 1496, 1496, 1288, 1288, 969, 969,
+    571, 571, 245, 245, 86, 86, 51, 51, 89, 89, 223, 223,
+    437, 437, 633, 633, 760, 760, 876, 876, 1004, 1004, 1056, 1056,
+    989, 989, 899, 899, 862, 862, 817, 817, 701, 701, 580, 580,
+    528, 528, 496, 496, 413, 413, 348, 348, 408, 408, 540, 540,
+    592, 592, 525, 525, 431, 431, 356, 356, 243, 243, 72, 72,
+    -72, -72, -108, -108, -42, -42, 91, 91, 273, 273, 467, 467,
+    606, 606, 659, 659, 650, 650, 602, 602, 503, 503, 361, 361,
+    225, 225, 119, 119, 0, 0, -151, -151, -263, -263, -261, -261,
+    -189, -189, -149, -149, -139, -139, -78, -78, 27, 27, 70, 70,
+    5, 5, -104, -104, -232, -232, -440, -440, -724, -724, -964, -964,
+    -1115, -1115, -1279, -1279, -1486, -1486, -1578, -1578, -1472, -1472, -1373, -1373,
+    -1481, -1481, -1675, -1675, -1752, -1752, -1817, -1817, -2092, -2092, -2483, -2483,
+    -2728, -2728, -2880, -2880, -3187, -3187, -3550, -3550, -3587, -3587, -3303, -3303,
+    -3152, -3152, -3282, -3282, -3290, -3290, -2988, -2988, -2876, -2876, -3402, -3402,
+    -4232, -4232, -4797, -4797, -5147, -5147, -5632, -5632, -6043, -6043, -5796, -5796,
+    -4857, -4857, -3804, -3804, -2939, -2939, -1984, -1984, -788, -788, 261, 261,
+    794, 794, 970, 970, 1099, 1099, 1155, 1155, 992, 992, 741, 741,
+    597, 597, 465, 465, 164, 164, -144, -144, -102, -102, 360, 360,
+    979, 979, 1540, 1540, 2085, 2085, 2702, 2702, 3300, 3300, 3675, 3675,
+    3687, 3687, 3343, 3343, 2761, 2761, 2108, 2108, 1534, 1534, 1101, 1101,
+    796, 796, 580, 580, 407, 407, 260, 260, 185, 185, 213, 213,
+    246, 246, 133, 133, -104, -104, -273, -273, -286, -286, -279, -279,
+    -395, -395, -590, -590, -739, -739, -832, -832, -930, -930, -997, -997,
+    -936, -936, -768, -768, -643, -643, -627, -627, -631, -631, -582, -582,
+    -538, -538, -571, -571, -623, -623, -562, -562, -342, -342, -50, -50,
+    215, 215, 460, 460, 748, 748, 1042, 1042, 1233, 1233, 1318, 1318,
+    1427, 1427, 1599, 1599, 1707, 1707, 1672, 1672, 1621, 1621, 1704, 1704,
+    1849, 1849, 1868, 1868, 1767, 1767, 1734, 1734, 1814, 1814, 1847, 1847,
+    1770, 1770, 1749, 1749, 1869, 1869, 1967, 1967, 1903, 1903, 1784, 1784,
+    1749, 1749, 1731, 1731, 1601, 1601, 1425, 1425, 1383, 1383, 1489, 1489,
+    1579, 1579, 1567, 1567, 1548, 1548, 1601, 1601, 1657, 1657, 1635, 1635,
+    1580, 1580, 1560, 1560, 1550, 1550, 1492, 1492, 1397, 1397, 1325, 1325,
+    1282, 1282, 1199, 1199, 1027, 1027, 838, 838, 750, 750, 764, 764,
+    752, 752, 649, 649, 553, 553, 559, 559, 606, 606, 575, 575,
+    464, 464, 371, 371, 343, 343, 317, 317, 240, 240, 144, 144,
+    76, 76, 10, 10, -89, -89, -199, -199, -283, -283, -338, -338,
+    -365, -365, -372, -372, -378, -378, -376, -376, -325, -325, -236, -236,
+    -185, -185, -198, -198, -199, -199, -144, -144, -88, -88, -80, -80,
+    -75, -75, -28, -28, 11, 11, -17, -17, -59, -59, -33, -33,
+    21, 21, 9, 9, -42, -42, -37, -37, -8, -8, -41, -41,
+    -96, -96, -85, -85, -67, -67, -155, -155, -291, -291, -336, -336,
+    -311, -311, -373, -373, -553, -553, -718, -718, -798, -798, -887, -887,
+    -1059, -1059, -1242, -1242, -1363, -1363, -1474, -1474, -1637, -1637, -1794, -1794,
+    -1868, -1868, -1885, -1885, -1921, -1921, -2019, -2019, -2175, -2175, -2344, -2344,
+    -2474, -2474, -2591, -2591, -2785, -2785, -3049, -3049, -3262, -3262, -3368, -3368,
+    -3432, -3432, -3457, -3457, -3337, -3337, -3117, -3117, -3084, -3084, -3418, -3418,
+    -3904, -3904, -4232, -4232, -4425, -4425, -4665, -4665, -4834, -4834, -4613, -4613,
+    -3993, -3993, -3262, -3262, -2523, -2523, -1672, -1672, -841, -841, -382, -382,
+    -324, -324, -287, -287, -67, -67, 90, 90, -37, -37, -265, -265,
+    -324, -324, -273, -273, -296, -296, -339, -339, -247, -247, -61, -61,
+    134, 134, 480, 480, 1126, 1126, 1874, 1874, 2365, 2365, 2518, 2518,
+    2512, 2512, 2440, 2440, 2248, 2248, 1931, 1931, 1588, 1588, 1287, 1287,
+    1046, 1046, 919, 919, 951, 951, 1056, 1056, 1095, 1095, 1064, 1064,
+    1065, 1065, 1105, 1105, 1099, 1099, 1063, 1063, 1095, 1095, 1164, 1164,
+    1142, 1142, 1021, 1021, 906, 906, 809, 809, 639, 639, 403, 403,
+    228, 228, 171, 171, 158, 158, 147, 147, 201, 201, 330, 330,
+    405, 405, 351, 351, 291, 291, 368, 368, 519, 519, 602, 602,
+    646, 646, 782, 782, 1009, 1009, 1197, 1197, 1289, 1289, 1332, 1332,
+    1348, 1348, 1292, 1292, 1152, 1152, 1013, 1013, 948, 948, 927, 927,
+    903, 903, 905, 905, 976, 976, 1081, 1081, 1167, 1167, 1251, 1251,
+    1352, 1352, 1426, 1426, 1447, 1447, 1469, 1469, 1530, 1530, 1572, 1572,
+    1526, 1526, 1436, 1436, 1402, 1402, 1424, 1424, 1412, 1412, 1337, 1337,
+    1290, 1290, 1327, 1327, 1383, 1383, 1397, 1397, 1409, 1409, 1456, 1456,
+    1483, 1483, 1453, 1453, 1421, 1421, 1447, 1447, 1492, 1492, 1488, 1488,
+    1438, 1438, 1391, 1391, 1356, 1356, 1296, 1296, 1199, 1199, 1096, 1096,
+    998, 998, 892, 892, 795, 795, 743, 743, 708, 708, 628, 628,
+    518, 518, 452, 452, 441, 441, 419, 419, 361, 361, 316, 316,
+    315, 315, 311, 311, 238, 238, 103, 103, -44, -44, -196, -196,
+    -387, -387, -599, -599, -761, -761, -837, -837, -863, -863, -876, -876,
+    -882, -882, -886, -886, -896, -896, -908, -908, -918, -918, -947, -947,
+    -1016, -1016, -1100, -1100, -1149, -1149, -1163, -1163, -1195, -1195, -1268, -1268,
+    -1320, -1320, -1302, -1302, -1257, -1257, -1253, -1253, -1265, -1265, -1233, -1233,
+    -1171, -1171, -1140, -1140, -1144, -1144, -1140, -1140, -1122, -1122, -1121, -1121,
+    -1133, -1133, -1119, -1119, -1076, -1076, -1038, -1038, -1009, -1009, -964, -964,
+    -915, -915, -903, -903, -913, -913, -889, -889, -865, -865, -932, -932,
+    -1072, -1072, -1152, -1152, -1126, -1126, -1106, -1106, -1159, -1159, -1182, -1182,
+    -1078, -1078, -927, -927, -866, -866, -889, -889, -897, -897, -901, -901,
+    -983, -983, -1116, -1116, -1182, -1182, -1170, -1170, -1195, -1195, -1288, -1288,
+    -1349, -1349, -1319, -1319, -1283, -1283, -1324, -1324, -1428, -1428, -1555, -1555,
+    -1703, -1703, -1845, -1845, -1901, -1901, -1851, -1851, -1771, -1771, -1704, -1704,
+    -1590, -1590, -1400, -1400, -1231, -1231, -1175, -1175, -1177, -1177, -1139, -1139,
+    -1077, -1077, -1050, -1050, -1015, -1015, -907, -907, -797, -797, -813, -813,
+    -935, -935, -1007, -1007, -961, -961, -872, -872, -782, -782, -612, -612,
+    -327, -327, -19, -19, 214, 214, 378, 378, 494, 494, 529, 529,
+    489, 489, 469, 469, 524, 524, 580, 580, 568, 568, 553, 553,
+    619, 619, 717, 717, 750, 750, 765, 765, 878, 878, 1070, 1070,
+    1211, 1211, 1271, 1271, 1342, 1342, 1441, 1441, 1456, 1456, 1350, 1350,
+    1253, 1253, 1271, 1271, 1319, 1319, 1278, 1278, 1200, 1200, 1216, 1216,
+    1308, 1308, 1328, 1328, 1239, 1239, 1155, 1155, 1134, 1134, 1106, 1106,
+    1038, 1038, 1010, 1010, 1071, 1071, 1134, 1134, 1122, 1122, 1098, 1098,
+    1149, 1149, 1225, 1225, 1220, 1220, 1148, 1148, 1112, 1112, 1127, 1127,
+    1121, 1121, 1085, 1085, 1071, 1071, 1058, 1058, 972, 972, 848, 848,
+    804, 804, 860, 860, 903, 903, 879, 879, 878, 878, 969, 969,
+    1074, 1074, 1088, 1088, 1032, 1032, 994, 994, 978, 978, 940, 940,
+    900, 900, 909, 909, 946, 946, 949, 949, 921, 921, 913, 913,
+    936, 936, 957, 957, 963, 963, 966, 966, 972, 972, 985, 985,
+    1010, 1010, 1033, 1033, 1020, 1020, 965, 965, 919, 919, 924, 924,
+    945, 945, 919, 919, 860, 860, 834, 834, 842, 842, 819, 819,
+    744, 744, 650, 650, 558, 558, 460, 460, 372, 372, 326, 326,
+    325, 325, 331, 331, 307, 307, 267, 267, 252, 252, 263, 263,
+    256, 256, 200, 200, 122, 122, 57, 57, 3, 3, -61, -61,
+    -143, -143, -222, -222, -276, -276, -309, -309, -343, -343, -372, -372,
+    -373, -373, -363, -363, -381, -381, -420, -420, -448, -448, -472, -472,
+    -525, -525, -595, -595, -638, -638, -645, -645, -652, -652, -682, -682,
+    -712, -712, -714, -714, -712, -712, -740, -740, -783, -783, -789, -789,
+    -760, -760, -747, -747, -768, -768, -789, -789, -791, -791, -787, -787,
+    -798, -798, -823, -823, -839, -839, -828, -828, -808, -808, -807, -807,
+    -821, -821, -826, -826, -818, -818, -796, -796, -751, -751, -700, -700,
+    -682, -682, -708, -708, -736, -736, -736, -736, -735, -735, -777, -777,
+    -846, -846, -874, -874, -840, -840, -799, -799, -791, -791, -775, -775,
+    -721, -721, -674, -674, -674, -674, -691, -691, -684, -684, -671, -671,
+    -668, -668, -662, -662, -655, -655, -678, -678, -727, -727, -753, -753,
+    -730, -730, -702, -702, -701, -701, -684, -684, -606, -606, -525, -525,
+    -523, -523, -571, -571, -587, -587, -596, -596, -678, -678, -808, -808,
+    -873, -873, -845, -845, -784, -784, -716, -716, -611, -611, -486, -486,
+    -404, -404, -386, -386, -384, -384, -379, -379, -417, -417, -492, -492,
+    -509, -509, -437, -437, -385, -385, -429, -429, -484, -484, -457, -457,
+    -400, -400, -399, -399, -411, -411, -344, -344, -225, -225, -151, -151,
+    -122, -122, -51, -51, 75, 75, 152, 152, 130, 130, 105, 105,
+    149, 149, 193, 193, 166, 166, 133, 133, 174, 174, 256, 256,
+    308, 308, 350, 350, 433, 433, 528, 528, 574, 574, 590, 590,
+    640, 640, 711, 711, 715, 715, 644, 644, 608, 608, 664, 664,
+    730, 730, 736, 736, 737, 737, 792, 792, 841, 841, 816, 816,
+    765, 765, 770, 770, 814, 814, 822, 822, 794, 794, 803, 803,
+    866, 866, 908, 908, 887, 887, 858, 858, 867, 867, 866, 866,
+    818, 818, 774, 774, 777, 777, 785, 785, 756, 756, 726, 726,
+    736, 736, 756, 756, 738, 738, 708, 708, 722, 722, 765, 765,
+    766, 766, 712, 712, 674, 674, 682, 682, 672, 672, 606, 606,
+    540, 540, 532, 532, 558, 558, 575, 575, 581, 581, 584, 584,
+    579, 579, 570, 570, 575, 575, 588, 588, 578, 578, 541, 541,
+    521, 521, 552, 552, 599, 599, 609, 609, 601, 601, 623, 623,
+    650, 650, 629, 629, 584, 584, 577, 577, 600, 600, 587, 587,
+    533, 533, 483, 483, 456, 456, 426, 426, 382, 382, 348, 348,
+    345, 345, 352, 352, 341, 341, 330, 330, 347, 347, 371, 371,
+    363, 363, 331, 331, 303, 303, 273, 273, 223, 223, 162, 162,
+    103, 103, 48, 48, 0, 0, -43, -43, -83, -83, -107, -107,
+    -109, -109, -110, -110, -136, -136, -176, -176, -209, -209, -230, -230,
+    -250, -250, -275, -275, -304, -304, -330, -330, -356, -356, -384, -384,
+    -395, -395, -376, -376, -355, -355, -363, -363, -368, -368, -340, -340,
+    -313, -313, -329, -329, -377, -377, -432, -432, -498, -498, -563, -563,
+    -582, -582, -552, -552, -528, -528, -545, -545, -561, -561, -526, -526,
+    -476, -476, -487, -487, -535, -535, -524, -524, -458, -458, -443, -443,
+    -502, -502, -538, -538, -512, -512, -499, -499, -539, -539, -570, -570,
+    -539, -539, -484, -484, -462, -462, -469, -469, -468, -468, -452, -452,
+    -451, -451, -467, -467, -481, -481, -486, -486, -478, -478, -439, -439,
+    -374, -374, -326, -326, -311, -311, -290, -290, -252, -252, -237, -237,
+    -252, -252, -255, -255, -233, -233, -225, -225, -242, -242, -242, -242,
+    -203, -203, -157, -157, -140, -140, -146, -146, -149, -149, -146, -146,
+    -153, -153, -175, -175, -195, -195, -193, -193, -155, -155, -80, -80,
+    -12, -12, 9, 9, 9, 9, 39, 39, 70, 70, 40, 40,
+    -12, -12, -4, -4, 30, 30, -10, -10, -114, -114, -161, -161,
+    -124, -124, -107, -107, -155, -155, -174, -174, -98, -98, -26, -26,
+    -52, -52, -101, -101, -62, -62, 4, 4, -28, -28, -110, -110,
+    -95, -95, 13, 13, 68, 68, 25, 25, -4, -4, 47, 47,
+    100, 100, 78, 78, 35, 35, 65, 65, 153, 153, 206, 206,
+    208, 208, 220, 220, 259, 259, 272, 272, 240, 240, 209, 209,
+    221, 221, 257, 257, 283, 283, 296, 296, 316, 316, 346, 346,
+    365, 365, 365, 365, 368, 368, 381, 381, 378, 378, 344, 344,
+    302, 302, 284, 284, 281, 281, 274, 274, 264, 264, 271, 271,
+    294, 294, 309, 309, 298, 298, 271, 271, 251, 251, 248, 248,
+    255, 255, 261, 261, 262, 262, 259, 259, 265, 265, 281, 281,
+    289, 289, 275, 275, 248, 248, 230, 230, 218, 218, 200, 200,
+    184, 184, 190, 190, 211, 211, 217, 217, 199, 199, 187, 187,
+    199, 199, 217, 217, 219, 219, 220, 220, 257, 257, 324, 324,
+    369, 369, 369, 369, 354, 354, 357, 357, 362, 362, 338, 338,
+    297, 297, 268, 268, 260, 260, 260, 260, 270, 270, 303, 303,
+    349, 349, 377, 377, 375, 375, 367, 367, 370, 370, 366, 366,
+    339, 339, 310, 310, 297, 297, 288, 288, 273, 273, 268, 268,
+    280, 280, 281, 281, 256, 256, 229, 229, 225, 225, 231, 231,
+    211, 211, 167, 167, 130, 130, 110, 110, 86, 86, 52, 52,
+    33, 33, 41, 41, 58, 58, 72, 72, 86, 86, 97, 97,
+    90, 90, 65, 65, 40, 40, 23, 23, 7, 7, -16, -16,
+    -42, -42, -65, -65, -86, -86, -112, -112, -146, -146, -179, -179,
+    -204, -204, -215, -215, -212, -212, -203, -203, -203, -203, -215, -215,
+    -224, -224, -226, -226, -234, -234, -257, -257, -282, -282, -298, -298,
+    -306, -306, -319, -319, -340, -340, -360, -360, -369, -369, -370, -370,
+    -370, -370, -368, -368, -352, -352, -329, -329, -312, -312, -306, -306,
+    -303, -303, -296, -296, -289, -289, -274, -274, -242, -242, -190, -190,
+    -134, -134, -94, -94, -79, -79, -79, -79, -79, -79, -69, -69,
+    -52, -52, -35, -35, -28, -28, -35, -35, -47, -47, -51, -51,
+    -44, -44, -28, -28, -12, -12, -3, -3, 9, 9, 36, 36,
+    64, 64, 59, 59, 18, 18, -13, -13, -10, -10, -7, -7,
+    -39, -39, -84, -84, -93, -93, -67, -67, -49, -49, -52, -52,
+    -55, -55, -50, -50, -62, -62, -92, -92, -108, -108, -98, -98,
+    -93, -93, -110, -110, -124, -124, -122, -122, -119, -119, -127, -127,
+    -134, -134, -136, -136, -140, -140, -145, -145, -140, -140, -129, -129,
+    -129, -129, -133, -133, -120, -120, -95, -95, -91, -91, -117, -117,
+    -145, -145, -157, -157, -163, -163, -169, -169, -151, -151, -106, -106,
+    -61, -61, -32, -32, -4, -4, 34, 34, 63, 63, 63, 63,
+    45, 45, 40, 40, 57, 57, 83, 83, 92, 92, 83, 83,
+    85, 85, 114, 114, 144, 144, 142, 142, 127, 127, 146, 146,
+    196, 196, 222, 222, 212, 212, 213, 213, 237, 237, 233, 233,
+    177, 177, 134, 134, 149, 149, 172, 172, 150, 150, 125, 125,
+    150, 150, 184, 184, 167, 167, 139, 139, 162, 162, 192, 192,
+    154, 154, 79, 79, 49, 49, 56, 56, 27, 27, -32, -32,
+    -47, -47, -6, -6, 26, 26, 25, 25, 38, 38, 78, 78,
+    95, 95, 76, 76, 76, 76, 115, 115, 147, 147, 143, 143,
+    130, 130, 120, 120, 101, 101, 80, 80, 82, 82, 96, 96,
+    94, 94, 82, 82, 86, 86, 104, 104, 110, 110, 108, 108,
+    116, 116, 126, 126, 120, 120, 122, 122, 165, 165, 222, 222,
+    245, 245, 250, 250, 288, 288, 346, 346, 362, 362, 332, 332,
+    305, 305, 296, 296, 270, 270, 222, 222, 186, 186, 185, 185,
+    203, 203, 226, 226, 251, 251, 274, 274, 284, 284, 281, 281,
+    276, 276, 270, 270, 256, 256, 245, 245, 249, 249, 250, 250,
+    228, 228, 199, 199, 185, 185, 172, 172, 143, 143, 119, 119,
+    124, 124, 140, 140, 136, 136, 110, 110, 76, 76, 39, 39,
+    6, 6, -5, -5, 7, 7, 8, 8, -21, -21, -58, -58,
+    -77, -77, -92, -92, -122, -122, -152, -152, -162, -162, -170, -170,
+    -192, -192, -210, -210, -203, -203, -198, -198, -220, -220, -243, -243,
+    -231, -231, -200, -200, -195, -195, -220, -220, -242, -242, -246, -246,
+    -250, -250, -259, -259, -253, -253, -220, -220, -180, -180, -154, -154,
+    -132, -132, -95, -95, -55, -55, -43, -43, -62, -62, -80, -80,
+    -62, -62, -16, -16, 20, 20, 33, 33, 44, 44, 67, 67,
+    82, 82, 68, 68, 41, 41, 30, 30, 36, 36, 37, 37,
+    32, 32, 37, 37, 56, 56, 80, 80, 103, 103, 125, 125,
+    133, 133, 113, 113, 74, 74, 47, 47, 53, 53, 81, 81,
+    107, 107, 118, 118, 113, 113, 90, 90, 43, 43, -23, -23,
+    -83, -83, -113, -113, -114, -114, -109, -109, -115, -115, -127, -127,
+    -136, -136, -148, -148, -172, -172, -198, -198, -207, -207, -198, -198,
+    -186, -186, -183, -183, -186, -186, -193, -193, -196, -196, -186, -186,
+    -177, -177, -187, -187, -205, -205, -202, -202, -177, -177, -160, -160,
+    -158, -158, -144, -144, -109, -109, -81, -81, -80, -80, -78, -78,
+    -50, -50, -26, -26, -41, -41, -66, -66, -56, -56, -27, -27,
+    -22, -22, -29, -29, -14, -14, 9, 9, 6, 6, -6, -6,
+    14, 14, 59, 59, 82, 82, 75, 75, 75, 75, 100, 100,
+    113, 113, 95, 95, 75, 75, 81, 81, 89, 89, 80, 80,
+    75, 75, 90, 90, 106, 106, 103, 103, 96, 96, 101, 101,
+    110, 110, 113, 113, 107, 107, 94, 94, 72, 72, 45, 45,
+    30, 30, 38, 38, 61, 61, 81, 81, 95, 95, 108, 108,
+    114, 114, 112, 112, 114, 114, 125, 125, 126, 126, 110, 110,
+    99, 99, 110, 110, 127, 127, 128, 128, 114, 114, 106, 106,
+    111, 111, 113, 113, 106, 106, 107, 107, 126, 126, 149, 149,
+    160, 160, 162, 162, 167, 167, 174, 174, 177, 177, 184, 184,
+    200, 200, 213, 213, 213, 213, 199, 199, 182, 182, 169, 169,
+    157, 157, 153, 153, 167, 167, 198, 198, 226, 226, 234, 234,
+    228, 228, 221, 221, 214, 214, 201, 201, 189, 189, 189, 189,
+    205, 205, 223, 223, 233, 233, 238, 238, 252, 252, 277, 277,
+    295, 295, 295, 295, 284, 284, 280, 280, 280, 280, 267, 267,
+    235, 235, 206, 206, 204, 204, 229, 229, 254, 254, 257, 257,
+    246, 246, 242, 242, 252, 252, 261, 261, 257, 257, 248, 248,
+    244, 244, 239, 239, 219, 219, 185, 185, 153, 153, 135, 135,
+    126, 126, 108, 108, 85, 85, 71, 71, 77, 77, 96, 96,
+    112, 112, 113, 113, 101, 101, 96, 96, 107, 107, 117, 117,
+    109, 109, 89, 89, 80, 80, 78, 78, 63, 63, 33, 33,
+    12, 12, 12, 12, 23, 23, 24, 24, 21, 21, 26, 26,
+    35, 35, 32, 32, 16, 16, 6, 6, 14, 14, 31, 31,
+    43, 43, 42, 42, 37, 37, 36, 36, 40, 40, 38, 38,
+    24, 24, 12, 12, 13, 13, 19, 19, 24, 24, 31, 31,
+    36, 36, 31, 31, 20, 20, 16, 16, 25, 25, 29, 29,
+    12, 12, -12, -12, -16, -16, -3, -3, 2, 2, -9, -9,
+    -14, -14, 1, 1, 18, 18, 19, 19, 4, 4, -16, -16,
+    -34, -34, -52, -52, -75, -75, -100, -100, -115, -115, -120, -120,
+    -132, -132, -158, -158, -182, -182, -183, -183, -168, -168, -160, -160,
+    -163, -163, -163, -163, -150, -150, -137, -137, -133, -133, -132, -132,
+    -124, -124, -121, -121, -135, -135, -152, -152, -160, -160, -165, -165,
+    -169, -169, -165, -165, -155, -155, -151, -151, -148, -148, -133, -133,
+    -105, -105, -82, -82, -76, -76, -74, -74, -61, -61, -37, -37,
+    -17, -17, -9, -9, -11, -11, -21, -21, -29, -29, -22, -22,
+    -6, -6, 5, 5, 13, 13, 30, 30, 55, 55, 72, 72,
+    82, 82, 101, 101, 123, 123, 127, 127, 115, 115, 111, 111,
+    119, 119, 121, 121, 113, 113, 113, 113, 124, 124, 130, 130,
+    122, 122, 116, 116, 128, 128, 141, 141, 142, 142, 148, 148,
+    171, 171, 196, 196, 201, 201, 191, 191, 184, 184, 180, 180,
+    174, 174, 170, 170, 174, 174, 180, 180, 180, 180, 176, 176,
+    177, 177, 189, 189, 203, 203, 209, 209, 209, 209, 210, 210,
+    216, 216, 217, 217, 208, 208, 198, 198, 196, 196, 197, 197,
+    193, 193, 189, 189, 198, 198, 214, 214, 214, 214, 198, 198,
+    189, 189, 193, 193, 190, 190, 163, 163, 135, 135, 128, 128,
+    132, 132, 132, 132, 131, 131, 141, 141, 157, 157, 170, 170,
+    179, 179, 189, 189, 200, 200, 211, 211, 214, 214, 207, 207,
+    191, 191, 176, 176, 173, 173, 179, 179, 180, 180, 179, 179,
+    192, 192, 216, 216, 226, 226, 222, 222, 225, 225, 238, 238,
+    246, 246, 248, 248, 257, 257, 272, 272, 271, 271, 251, 251,
+    226, 226, 199, 199, 163, 163, 126, 126, 123, 123, 162, 162,
+    220, 220, 272, 272, 313, 313, 330, 330, 303, 303, 240, 240,
+    184, 184, 164, 164, 162, 162, 154, 154, 141, 141, 122, 122,
+    88, 88, 46, 46, 28, 28, 43, 43, 63, 63, 64, 64,
+    63, 63, 78, 78, 87, 87, 65, 65, 28, 28, 15, 15,
+    20, 20, 7, 7, -30, -30, -55, -55, -52, -52, -45, -45,
+    -49, -49, -45, -45, -18, -18, 16, 16, 29, 29, 18, 18,
+    -1, -1, -20, -20, -44, -44, -69, -69, -76, -76, -62, -62,
+    -41, -41, -25, -25, -9, -9, 3, 3, -8, -8, -50, -50,
+    -98, -98, -125, -125, -129, -129, -124, -124, -114, -114, -91, -91,
+    -66, -66, -64, -64, -83, -83, -98, -98, -93, -93, -83, -83,
+    -78, -78, -64, -64, -37, -37, -18, -18, -26, -26, -50, -50,
+    -69, -69, -80, -80, -99, -99, -129, -129, -152, -152, -161, -161,
+    -166, -166, -177, -177, -184, -184, -179, -179, -163, -163, -146, -146,
+    -132, -132, -118, -118, -107, -107, -113, -113, -135, -135, -158, -158,
+    -168, -168, -166, -166, -162, -162, -159, -159, -151, -151, -144, -144,
+    -144, -144, -148, -148, -146, -146, -142, -142, -142, -142, -143, -143,
+    -131, -131, -111, -111, -101, -101, -102, -102, -92, -92, -62, -62,
+    -28, -28, -13, -13, -12, -12, -8, -8, -2, -2, -6, -6,
+    -13, -13, -6, -6, 13, 13, 25, 25, 23, 23, 17, 17,
+    17, 17, 17, 17, 16, 16, 18, 18, 29, 29, 47, 47,
+    67, 67, 84, 84, 94, 94, 99, 99, 102, 102, 106, 106,
+    109, 109, 108, 108, 104, 104, 103, 103, 105, 105, 106, 106,
+    100, 100, 88, 88, 78, 78, 77, 77, 85, 85, 89, 89,
+    85, 85, 82, 82, 85, 85, 83, 83, 71, 71, 63, 63,
+    70, 70, 79, 79, 76, 76, 69, 69, 75, 75, 87, 87,
+    88, 88, 74, 74, 63, 63, 61, 61, 57, 57, 44, 44,
+    34, 34, 39, 39, 47, 47, 42, 42, 30, 30, 21, 21,
+    17, 17, 14, 14, 18, 18, 29, 29, 42, 42, 46, 46,
+    41, 41, 36, 36, 38, 38, 44, 44, 49, 49, 56, 56,
+    65, 65, 71, 71, 74, 74, 79, 79, 88, 88, 96, 96,
+    99, 99, 97, 97, 98, 98, 105, 105, 111, 111, 108, 108,
+    102, 102, 105, 105, 113, 113, 116, 116, 113, 113, 117, 117,
+    125, 125, 128, 128, 122, 122, 113, 113, 102, 102, 85, 85,
+    63, 63, 48, 48, 46, 46, 49, 49, 46, 46, 37, 37,
+    32, 32, 30, 30, 23, 23, 10, 10, -2, -2, -12, -12,
+    -23, -23, -31, -31, -33, -33, -32, -32, -38, -38, -54, -54,
+    -74, -74, -93, -93, -109, -109, -123, -123, -133, -133, -138, -138,
+    -142, -142, -146, -146, -152, -152, -159, -159, -164, -164, -165, -165,
+    -161, -161, -153, -153, -146, -146, -139, -139, -131, -131, -126, -126,
+    -129, -129, -140, -140, -153, -153, -165, -165, -174, -174, -182, -182,
+    -191, -191, -198, -198, -204, -204, -209, -209, -211, -211, -207, -207,
+    -200, -200, -192, -192, -183, -183, -174, -174, -168, -168, -171, -171,
+    -180, -180, -187, -187, -194, -194, -205, -205, -216, -216, -221, -221,
+    -220, -220, -219, -219, -223, -223, -228, -228, -227, -227, -223, -223,
+    -220, -220, -221, -221, -224, -224, -226, -226, -230, -230, -236, -236,
+    -242, -242, -249, -249, -252, -252, -250, -250, -246, -246, -244, -244,
+    -242, -242, -237, -237, -232, -232, -229, -229, -229, -229, -230, -230,
+    -229, -229, -228, -228, -227, -227, -224, -224, -218, -218, -213, -213,
+    -211, -211, -210, -210, -209, -209, -208, -208, -205, -205, -200, -200,
+    -194, -194, -185, -185, -174, -174, -161, -161, -148, -148, -135, -135,
+    -121, -121, -105, -105, -95, -95, -92, -92, -90, -90, -86, -86,
+    -79, -79, -73, -73, -62, -62, -47, -47, -28, -28, -14, -14,
+    -2, -2, 13, 13, 28, 28, 39, 39, 45, 45, 47, 47,
+    48, 48, 44, 44, 40, 40, 39, 39, 42, 42, 48, 48,
+    58, 58, 71, 71, 82, 82, 88, 88, 93, 93, 99, 99,
+    109, 109, 118, 118, 127, 127, 134, 134, 139, 139, 138, 138,
+    132, 132, 126, 126, 121, 121, 115, 115, 110, 110, 108, 108,
+    108, 108, 108, 108, 108, 108, 109, 109, 111, 111, 112, 112,
+    111, 111, 113, 113, 116, 116, 115, 115, 109, 109, 99, 99,
+    89, 89, 78, 78, 68, 68, 61, 61, 58, 58, 59, 59,
+    60, 60, 61, 61, 62, 62, 63, 63, 63, 63, 62, 62,
+    61, 61, 59, 59, 60, 60, 63, 63, 65, 65, 65, 65,
+    68, 68, 73, 73, 80, 80, 88, 88, 96, 96, 102, 102,
+    106, 106, 106, 106, 105, 105, 106, 106, 109, 109, 114, 114,
+    117, 117, 119, 119, 122, 122, 123, 123, 122, 122, 120, 120,
+    117, 117, 113, 113, 111, 111, 111, 111, 110, 110, 107, 107,
+    103, 103, 98, 98, 91, 91, 82, 82, 73, 73, 65, 65,
+    59, 59, 54, 54, 47, 47, 40, 40, 33, 33, 25, 25,
+    17, 17, 8, 8, -1, -1, -10, -10, -17, -17, -22, -22,
+    -26, -26, -31, -31, -34, -34, -37, -37, -39, -39, -42, -42,
+    -44, -44, -50, -50, -58, -58, -65, -65, -69, -69, -74, -74,
+    -80, -80, -88, -88, -94, -94, -98, -98, -101, -101, -103, -103,
+    -102, -102, -100, -100, -95, -95, -92, -92, -90, -90, -89, -89,
+    -87, -87, -87, -87, -85, -85, -85, -85, -86, -86, -91, -91,
+    -96, -96, -99, -99, -100, -100, -100, -100, -101, -101, -99, -99,
+    -93, -93, -85, -85, -78, -78, -74, -74, -71, -71, -68, -68,
+    -65, -65, -62, -62, -63, -63, -66, -66, -70, -70, -74, -74,
+    -78, -78, -81, -81, -82, -82, -84, -84, -86, -86, -88, -88,
+    -86, -86, -82, -82, -80, -80, -80, -80, -80, -80, -79, -79,
+    -78, -78, -77, -77, -76, -76, -76, -76, -78, -78, -80, -80,
+    -83, -83, -85, -85, -85, -85, -83, -83, -80, -80, -79, -79,
+    -78, -78, -76, -76, -72, -72, -68, -68, -65, -65, -60, -60,
+    -50, -50, -39, -39, -30, -30, -27, -27, -25, -25, -21, -21,
+    -17, -17, -15, -15, -15, -15, -13, -13, -11, -11, -8, -8,
+    -3, -3, 6, 6, 16, 16, 22, 22, 24, 24, 27, 27,
+    34, 34, 41, 41, 46, 46, 51, 51, 57, 57, 62, 62,
+    65, 65, 66, 66, 69, 69, 73, 73, 77, 77, 79, 79,
+    81, 81, 83, 83, 85, 85, 87, 87, 88, 88, 91, 91,
+    94, 94, 99, 99, 105, 105, 110, 110, 114, 114, 114, 114,
+    113, 113, 112, 112, 111, 111, 109, 109, 106, 106, 104, 104,
+    103, 103, 103, 103, 103, 103, 104, 104, 105, 105, 107, 107,
+    108, 108, 107, 107, 104, 104, 102, 102, 99, 99, 94, 94,
+    86, 86, 80, 80, 76, 76, 73, 73, 68, 68, 63, 63,
+    58, 58, 55, 55, 52, 52, 52, 52, 54, 54, 53, 53,
+    51, 51, 49, 49, 47, 47, 46, 46, 45, 45, 44, 44,
+    43, 43, 39, 39, 34, 34, 30, 30, 29, 29, 31, 31,
+    33, 33, 32, 32, 32, 32, 33, 33, 35, 35, 37, 37,
+    39, 39, 39, 39, 42, 42, 44, 44, 45, 45, 47, 47,
+    47, 47, 43, 43, 38, 38, 33, 33, 30, 30, 31, 31,
+    32, 32, 32, 32, 31, 31, 28, 28, 24, 24, 21, 21,
+    17, 17, 14, 14, 10, 10, 5, 5, 4, 4, 3, 3,
+    0, 0, -5, -5, -11, -11, -16, -16, -21, -21, -29, -29,
+    -37, -37, -43, -43, -50, -50, -59, -59, -68, -68, -76, -76,
+    -81, -81, -87, -87, -93, -93, -98, -98, -101, -101, -105, -105,
+    -107, -107, -111, -111, -117, -117, -123, -123, -126, -126, -130, -130,
+    -135, -135, -140, -140, -142, -142, -143, -143, -145, -145, -147, -147,
+    -148, -148, -147, -147, -148, -148, -150, -150, -150, -150, -147, -147,
+    -145, -145, -145, -145, -145, -145, -144, -144, -142, -142, -140, -140,
+    -139, -139, -135, -135, -132, -132, -130, -130, -129, -129, -126, -126,
+    -123, -123, -120, -120, -119, -119, -116, -116, -113, -113, -111, -111,
+    -110, -110, -110, -110, -110, -110, -109, -109, -106, -106, -103, -103,
+    -100, -100, -96, -96, -90, -90, -86, -86, -86, -86, -86, -86,
+    -84, -84, -80, -80, -77, -77, -75, -75, -73, -73, -71, -71,
+    -70, -70, -68, -68, -67, -67, -67, -67, -67, -67, -65, -65,
+    -63, -63, -61, -61, -59, -59, -57, -57, -54, -54, -53, -53,
+    -55, -55, -57, -57, -54, -54, -52, -52, -52, -52, -54, -54,
+    -52, -52, -48, -48, -45, -45, -44, -44, -42, -42, -39, -39,
+    -38, -38, -40, -40, -42, -42, -44, -44, -43, -43, -41, -41,
+    -36, -36, -31, -31, -28, -28, -28, -28, -29, -29, -30, -30,
+    -30, -30, -27, -27, -24, -24, -21, -21, -17, -17, -12, -12,
+    -8, -8, -5, -5, -5, -5, -2, -2, 5, 5, 11, 11,
+    14, 14, 16, 16, 17, 17, 19, 19, 21, 21, 23, 23,
+    25, 25, 27, 27, 28, 28, 29, 29, 29, 29, 28, 28,
+    27, 27, 28, 28, 31, 31, 34, 34, 37, 37, 38, 38,
+    38, 38, 37, 37, 35, 35, 32, 32, 27, 27, 23, 23,
+    19, 19, 15, 15, 12, 12, 9, 9, 7, 7, 6, 6,
+    6, 6, 3, 3, -1, -1, -3, -3, -4, -4, -7, -7,
+    -9, -9, -12, -12, -15, -15, -18, -18, -23, -23, -27, -27,
+    -29, -29, -34, -34, -38, -38, -39, -39, -37, -37, -37, -37,
+    -36, -36, -33, -33, -30, -30, -30, -30, -32, -32, -33, -33,
+    -34, -34, -37, -37, -38, -38, -36, -36, -35, -35, -34, -34,
+    -34, -34, -34, -34, -32, -32, -32, -32, -32, -32, -32, -32,
+    -31, -31, -31, -31, -31, -31, -29, -29, -28, -28, -27, -27,
+    -28, -28, -29, -29, -30, -30, -33, -33, -36, -36, -38, -38,
+    -38, -38, -39, -39, -42, -42, -45, -45, -45, -45, -45, -45,
+    -48, -48, -52, -52, -54, -54, -55, -55, -56, -56, -58, -58,
+    -60, -60, -63, -63, -66, -66, -70, -70, -72, -72, -76, -76,
+    -80, -80, -82, -82, -84, -84, -86, -86, -87, -87, -89, -89,
+    -93, -93, -98, -98, -101, -101, -101, -101, -99, -99, -99, -99,
+    -101, -101, -103, -103, -104, -104, -106, -106, -108, -108, -110, -110,
+    -111, -111, -113, -113, -115, -115, -117, -117, -118, -118, -117, -117,
+    -115, -115, -112, -112, -109, -109, -107, -107, -105, -105, -103, -103,
+    -102, -102, -102, -102, -101, -101, -100, -100, -97, -97, -92, -92,
+    -89, -89, -86, -86, -83, -83, -80, -80, -78, -78, -76, -76,
+    -73, -73, -67, -67, -62, -62, -59, -59, -56, -56, -51, -51,
+    -46, -46, -43, -43, -41, -41, -38, -38, -33, -33, -29, -29,
+    -26, -26, -23, -23, -21, -21, -19, -19, -17, -17, -14, -14,
+    -8, -8, -3, -3, -2, -2, -3, -3, -4, -4, -4, -4,
+    -4, -4, -5, -5, -5, -5, -4, -4, -4, -4, -4, -4,
+    -5, -5, -4, -4, -3, -3, -3, -3, -6, -6, -8, -8,
+    -9, -9, -8, -8, -8, -8, -9, -9, -8, -8, -5, -5,
+    -1, -1, 1, 1, 3, 3, 5, 5, 5, 5, 4, 4,
+    6, 6, 9, 9, 12, 12, 14, 14, 17, 17, 21, 21,
+    24, 24, 24, 24, 27, 27, 32, 32, 36, 36, 40, 40,
+    44, 44, 47, 47, 50, 50, 53, 53, 56, 56, 60, 60,
+    64, 64, 67, 67, 70, 70, 71, 71, 71, 71, 72, 72,
+    73, 73, 73, 73, 74, 74, 75, 75, 76, 76, 77, 77,
+    76, 76, 75, 75, 75, 75, 73, 73, 71, 71, 70, 70,
+    70, 70, 69, 69, 67, 67, 66, 66, 65, 65, 62, 62,
+    59, 59, 57, 57, 55, 55, 53, 53, 50, 50, 48, 48,
+    46, 46, 43, 43, 38, 38, 35, 35, 35, 35, 35, 35,
+    33, 33, 30, 30, 27, 27, 24, 24, 22, 22, 20, 20,
+    20, 20, 19, 19, 17, 17, 16, 16, 15, 15, 14, 14,
+    11, 11, 9, 9, 7, 7, 7, 7, 8, 8, 8, 8,
+    7, 7, 4, 4, 1, 1, -1, -1, -2, -2, -4, -4,
+    -5, -5, -4, -4, -5, -5, -8, -8, -11, -11, -12, -12,
+    -13, -13, -16, -16, -20, -20, -22, -22, -20, -20, -19, -19,
+    -20, -20, -22, -22, -23, -23, -24, -24, -24, -24, -25, -25,
+    -28, -28, -30, -30, -31, -31, -32, -32, -32, -32, -32, -32,
+    -34, -34, -36, -36, -39, -39, -42, -42, -44, -44, -46, -46,
+    -48, -48, -49, -49, -49, -49, -47, -47, -46, -46, -46, -46,
+    -46, -46, -48, -48, -50, -50, -53, -53, -55, -55, -57, -57,
+    -59, -59, -62, -62, -63, -63, -62, -62, -62, -62, -64, -64,
+    -65, -65, -67, -67, -68, -68, -69, -69, -69, -69, -69, -69,
+    -68, -68, -69, -69, -70, -70, -71, -71, -72, -72, -71, -71,
+    -71, -71, -71, -71, -71, -71, -71, -71, -70, -70, -69, -69,
+    -68, -68, -66, -66, -64, -64, -63, -63, -63, -63, -61, -61,
+    -58, -58, -55, -55, -52, -52, -48, -48, -45, -45, -43, -43,
+    -40, -40, -38, -38, -36, -36, -33, -33, -29, -29, -27, -27,
+    -26, -26, -25, -25, -23, -23, -20, -20, -17, -17, -15, -15,
+    -13, -13, -9, -9, -6, -6, -6, -6, -7, -7, -8, -8,
+    -7, -7, -4, -4, -1, -1, 0, 0, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+    4, 4, 5, 5, 5, 5, 6, 6, 7, 7, 8, 8,
+    9, 9, 9, 9, 9, 9, 10, 10, 11, 11, 14, 14,
+    17, 17, 19, 19, 22, 22, 25, 25, 27, 27, 28, 28,
+    29, 29, 30, 30, 33, 33, 33, 33, 33, 33, 34, 34,
+    36, 36, 40, 40, 42, 42, 43, 43, 44, 44, 46, 46,
+    48, 48, 50, 50, 52, 52, 54, 54, 56, 56, 58, 58,
+    59, 59, 58, 58, 56, 56, 55, 55, 56, 56, 58, 58,
+    59, 59, 59, 59, 59, 59, 58, 58, 57, 57, 58, 58,
+    57, 57, 56, 56, 55, 55, 55, 55, 54, 54, 52, 52,
+    50, 50, 50, 50, 50, 50, 48, 48, 45, 45, 43, 43,
+    43, 43, 43, 43, 41, 41, 40, 40, 40, 40, 40, 40,
+    40, 40, 39, 39, 39, 39, 39, 39, 38, 38, 37, 37,
+    35, 35, 33, 33, 31, 31, 30, 30, 28, 28, 27, 27,
+    25, 25, 24, 24, 24, 24, 24, 24, 23, 23, 21, 21,
+    18, 18, 17, 17, 16, 16, 14, 14, 11, 11, 9, 9,
+    6, 6, 3, 3, 0, 0, -1, -1, -1, -1, -2, -2,
+    -5, -5, -6, -6, -7, -7, -8, -8, -11, -11, -15, -15,
+    -19, -19, -23, -23, -26, -26, -27, -27, -29, -29, -33, -33,
+    -36, -36, -37, -37, -38, -38, -40, -40, -42, -42, -43, -43,
+    -44, -44, -45, -45, -46, -46, -46, -46, -47, -47, -49, -49,
+    -51, -51, -51, -51, -52, -52, -53, -53, -52, -52, -51, -51,
+    -51, -51, -53, -53, -54, -54, -53, -53, -53, -53, -54, -54,
+    -55, -55, -55, -55, -54, -54, -54, -54, -53, -53, -53, -53,
+    -53, -53, -53, -53, -54, -54, -54, -54, -52, -52, -52, -52,
+    -54, -54, -54, -54, -53, -53, -53, -53, -54, -54, -55, -55,
+    -55, -55, -55, -55, -57, -57, -59, -59, -59, -59, -58, -58,
+    -58, -58, -59, -59, -58, -58, -56, -56, -55, -55, -55, -55,
+    -55, -55, -55, -55, -56, -56, -57, -57, -56, -56, -55, -55,
+    -55, -55, -54, -54, -53, -53, -52, -52, -51, -51, -50, -50,
+    -48, -48, -46, -46, -44, -44, -42, -42, -40, -40, -39, -39,
+    -38, -38, -36, -36, -32, -32, -29, -29, -28, -28, -28, -28,
+    -27, -27, -26, -26, -24, -24, -23, -23, -23, -23, -21, -21,
+    -18, -18, -15, -15, -11, -11, -8, -8, -7, -7, -7, -7,
+    -6, -6, -4, -4, -2, -2, -1, -1, 0, 0, 1, 1,
+    1, 1, 2, 2, 4, 4, 7, 7, 9, 9, 9, 9,
+    10, 10, 12, 12, 12, 12, 12, 12, 13, 13, 14, 14,
+    17, 17, 19, 19, 20, 20, 20, 20, 20, 20, 21, 21,
+    23, 23, 24, 24, 26, 26, 27, 27, 28, 28, 28, 28,
+    27, 27, 28, 28, 30, 30, 31, 31, 32, 32, 33, 33,
+    34, 34, 34, 34, 35, 35, 36, 36, 37, 37, 36, 36,
+    36, 36, 38, 38, 40, 40, 41, 41, 40, 40, 39, 39,
+    40, 40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    40, 40, 40, 40, 39, 39, 38, 38, 38, 38, 38, 38,
+    37, 37, 36, 36, 35, 35, 34, 34, 34, 34, 33, 33,
+    33, 33, 33, 33, 32, 32, 31, 31, 30, 30, 29, 29,
+    27, 27, 25, 25, 22, 22, 21, 21, 21, 21, 20, 20,
+    18, 18, 17, 17, 15, 15, 13, 13, 12, 12, 11, 11,
+    10, 10, 8, 8, 5, 5, 3, 3, 0, 0, -2, -2,
+    -4, -4, -6, -6, -7, -7, -10, -10, -12, -12, -13, -13,
+    -14, -14, -16, -16, -17, -17, -19, -19, -20, -20, -20, -20,
+    -21, -21, -23, -23, -26, -26, -28, -28, -29, -29, -30, -30,
+    -32, -32, -33, -33, -34, -34, -34, -34, -36, -36, -37, -37,
+    -39, -39, -40, -40, -41, -41, -42, -42, -44, -44, -45, -45,
+    -46, -46, -47, -47, -49, -49, -50, -50, -49, -49, -49, -49,
+    -51, -51, -54, -54, -55, -55, -57, -57, -59, -59, -60, -60,
+    -61, -61, -63, -63, -64, -64, -65, -65, -65, -65, -65, -65,
+    -66, -66, -66, -66, -65, -65, -65, -65, -65, -65, -65, -65,
+    -66, -66, -68, -68, -69, -69, -69, -69, -68, -68, -68, -68,
+    -69, -69, -71, -71, -71, -71, -71, -71, -70, -70, -70, -70,
+    -70, -70, -70, -70, -69, -69, -69, -69, -69, -69, -70, -70,
+    -69, -69, -67, -67, -66, -66, -67, -67, -68, -68, -67, -67,
+    -66, -66, -65, -65, -64, -64, -64, -64, -63, -63, -61, -61,
+    -61, -61, -61, -61, -60, -60, -59, -59, -57, -57, -55, -55,
+    -55, -55, -55, -55, -53, -53, -51, -51, -51, -51, -51, -51,
+    -50, -50, -47, -47, -45, -45, -44, -44, -43, -43, -41, -41,
+    -39, -39, -37, -37, -35, -35, -33, -33, -32, -32, -32, -32,
+    -30, -30, -28, -28, -26, -26, -25, -25, -24, -24, -22, -22,
+    -19, -19, -17, -17, -17, -17, -16, -16, -14, -14, -11, -11,
+    -9, -9, -8, -8, -7, -7, -7, -7, -7, -7, -6, -6,
+    -4, -4, -2, -2, -1, -1, -2, -2, -1, -1, 1, 1,
+    3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 6, 6,
+    5, 5, 5, 5, 7, 7, 8, 8, 8, 8, 8, 8,
+    10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 11, 11,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11,
+    11, 11, 11, 11, 11, 11, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 9, 9, 9, 9, 10, 10, 10, 10,
+    10, 10, 9, 9, 8, 8, 7, 7, 5, 5, 3, 3,
+    2, 2, 2, 2, 1, 1, -2, -2, -4, -4, -6, -6,
+    -7, -7, -8, -8, -9, -9, -11, -11, -11, -11, -13, -13,
+    -15, -15, -17, -17, -17, -17, -18, -18, -21, -21, -24, -24,
+    -26, -26, -27, -27, -29, -29, -31, -31, -32, -32, -34, -34,
+    -36, -36, -38, -38, -41, -41, -42, -42, -44, -44, -46, -46,
+    -48, -48, -50, -50, -50, -50, -52, -52, -53, -53, -54, -54,
+    -55, -55, -56, -56, -58, -58, -60, -60, -60, -60, -60, -60,
+    -61, -61, -63, -63, -65, -65, -66, -66, -67, -67, -67, -67,
+    -68, -68, -67, -67, -68, -68, -70, -70, -70, -70, -70, -70,
+    -70, -70, -70, -70, -71, -71, -72, -72, -73, -73, -74, -74,
+    -72, -72, -73, -73, -74, -74, -74, -74, -74, -74, -74, -74,
+    -74, -74, -75, -75, -75, -75, -74, -74, -74, -74, -74, -74,
+    -76, -76, -77, -77, -76, -76, -76, -76, -76, -76, -76, -76,
+    -76, -76, -77, -77, -77, -77, -77, -77, -76, -76, -75, -75,
+    -74, -74, -73, -73, -72, -72, -72, -72, -72, -72, -71, -71,
+    -69, -69, -68, -68, -67, -67, -65, -65, -64, -64, -62, -62,
+    -62, -62, -60, -60, -58, -58, -56, -56, -57, -57, -56, -56,
+    -54, -54, -52, -52, -51, -51, -49, -49, -47, -47, -45, -45,
+    -42, -42, -41, -41, -40, -40, -39, -39, -38, -38, -37, -37,
+    -35, -35, -33, -33, -32, -32, -31, -31, -30, -30, -30, -30,
+    -28, -28, -27, -27, -25, -25, -23, -23, -22, -22, -23, -23,
+    -22, -22, -21, -21, -20, -20, -19, -19, -18, -18, -17, -17,
+    -17, -17, -16, -16, -14, -14, -12, -12, -11, -11, -10, -10,
+    -10, -10, -9, -9, -6, -6, -6, -6, -6, -6, -4, -4,
+    -2, -2, -1, -1, 0, 0, 1, 1, 3, 3, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+    8, 8, 8, 8, 9, 9, 11, 11, 12, 12, 12, 12,
+    13, 13, 14, 14, 14, 14, 15, 15, 16, 16, 17, 17,
+    18, 18, 19, 19, 20, 20, 20, 20, 19, 19, 20, 20,
+    21, 21, 22, 22, 23, 23, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 21, 21, 20, 20, 18, 18,
+    17, 17, 16, 16, 16, 16, 16, 16, 16, 16, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 14, 14, 12, 12,
+    12, 12, 12, 12, 11, 11, 9, 9, 7, 7, 7, 7,
+    5, 5, 3, 3, 1, 1, 0, 0, 0, 0, -2, -2,
+    -3, -3, -3, -3, -5, -5, -7, -7, -11, -11, -12, -12,
+    -12, -12, -13, -13, -15, -15, -17, -17, -20, -20, -21, -21,
+    -22, -22, -24, -24, -27, -27, -30, -30, -32, -32, -34, -34,
+    -36, -36, -38, -38, -40, -40, -42, -42, -43, -43, -44, -44,
+    -46, -46, -48, -48, -50, -50, -50, -50, -51, -51, -53, -53,
+    -54, -54, -54, -54, -54, -54, -57, -57, -59, -59, -60, -60,
+    -61, -61, -62, -62, -63, -63, -64, -64, -64, -64, -64, -64,
+    -66, -66, -66, -66, -66, -66, -65, -65, -65, -65, -66, -66,
+    -66, -66, -66, -66, -67, -67, -66, -66, -65, -65, -66, -66,
+    -66, -66, -66, -66, -66, -66, -67, -67, -67, -67, -67, -67,
+    -68, -68, -67, -67, -68, -68, -69, -69, -70, -70, -68, -68,
+    -68, -68, -68, -68, -68, -68, -67, -67, -66, -66, -67, -67,
+    -69, -69, -68, -68, -65, -65, -65, -65, -67, -67, -68, -68,
+    -66, -66, -65, -65, -64, -64, -62, -62, -60, -60, -60, -60,
+    -60, -60, -60, -60, -58, -58, -57, -57, -55, -55, -52, -52,
+    -50, -50, -50, -50, -50, -50, -48, -48, -46, -46, -45, -45,
+    -44, -44, -41, -41, -38, -38, -37, -37, -37, -37, -37, -37,
+    -37, -37, -36, -36, -33, -33, -31, -31, -30, -30, -29, -29,
+    -27, -27, -24, -24, -23, -23, -23, -23, -23, -23, -20, -20,
+    -18, -18, -16, -16, -15, -15, -13, -13, -11, -11, -11, -11,
+    -9, -9, -6, -6, -3, -3, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 1, 3, 3, 5, 5, 6, 6, 7, 7,
+    9, 9, 11, 11, 13, 13, 15, 15, 16, 16, 16, 16,
+    16, 16, 17, 17, 19, 19, 20, 20, 22, 22, 24, 24,
+    25, 25, 25, 25, 24, 24, 25, 25, 27, 27, 28, 28,
+    29, 29, 29, 29, 30, 30, 32, 32, 32, 32, 31, 31,
+    29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28,
+    29, 29, 29, 29, 28, 28, 28, 28, 27, 27, 26, 26,
+    24, 24, 24, 24, 24, 24, 24, 24, 22, 22, 21, 21,
+    20, 20, 20, 20, 20, 20, 19, 19, 17, 17, 16, 16,
+    14, 14, 12, 12, 11, 11, 11, 11, 11, 11, 10, 10,
+    9, 9, 9, 9, 9, 9, 7, 7, 5, 5, 4, 4,
+    3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, -2, -2, -4, -4, -5, -5, -6, -6, -6, -6,
+    -7, -7, -7, -7, -7, -7, -8, -8, -10, -10, -11, -11,
+    -11, -11, -11, -11, -15, -15, -19, -19, -20, -20, -20, -20,
+    -20, -20, -22, -22, -23, -23, -24, -24, -26, -26, -29, -29,
+    -30, -30, -31, -31, -31, -31, -33, -33, -36, -36, -38, -38,
+    -38, -38, -39, -39, -41, -41, -41, -41, -42, -42, -42, -42,
+    -44, -44, -46, -46, -45, -45, -45, -45, -46, -46, -47, -47,
+    -48, -48, -48, -48, -46, -46, -46, -46, -48, -48, -50, -50,
+    -50, -50, -49, -49, -48, -48, -47, -47, -45, -45, -45, -45,
+    -45, -45, -45, -45, -45, -45, -44, -44, -42, -42, -42, -42,
+    -40, -40, -39, -39, -38, -38, -37, -37, -35, -35, -35, -35,
+    -33, -33, -31, -31, -29, -29, -29, -29, -31, -31, -32, -32,
+    -30, -30, -27, -27, -25, -25, -24, -24, -23, -23, -22, -22,
+    -22, -22, -22, -22, -22, -22, -22, -22, -20, -20, -19, -19,
+    -20, -20, -19, -19, -18, -18, -18, -18, -17, -17, -16, -16,
+    -15, -15, -13, -13, -13, -13, -14, -14, -12, -12, -10, -10,
+    -8, -8, -8, -8, -9, -9, -9, -9, -7, -7, -5, -5,
+    -4, -4, -4, -4, -3, -3, -1, -1, 0, 0, 3, 3,
+    5, 5, 6, 6, 5, 5, 4, 4, 7, 7, 11, 11,
+    13, 13, 12, 12, 12, 12, 14, 14, 17, 17, 20, 20,
+    21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22,
+    23, 23, 25, 25, 27, 27, 26, 26, 26, 26, 27, 27,
+    28, 28, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32,
+    33, 33, 33, 33, 31, 31, 30, 30, 31, 31, 33, 33,
+    34, 34, 33, 33, 33, 33, 34, 34, 33, 33, 30, 30,
+    29, 29, 30, 30, 31, 31, 30, 30, 28, 28, 28, 28,
+    30, 30, 32, 32, 32, 32, 30, 30, 29, 29, 29, 29,
+    29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 29, 29,
+    28, 28, 30, 30, 31, 31, 30, 30, 28, 28, 28, 28,
+    31, 31, 31, 31, 29, 29, 27, 27, 28, 28, 30, 30,
+    30, 30, 28, 28, 28, 28, 29, 29, 28, 28, 26, 26,
+    25, 25, 26, 26, 28, 28, 27, 27, 25, 25, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 24, 24,
+    23, 23, 20, 20, 17, 17, 18, 18, 20, 20, 20, 20,
+    17, 17, 14, 14, 13, 13, 15, 15, 15, 15, 12, 12,
+    11, 11, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11,
+    8, 8, 4, 4, 2, 2, 3, 3, 6, 6, 6, 6,
+    4, 4, 2, 2, 1, 1, 0, 0, -1, -1, -1, -1,
+    -1, -1, -1, -1, -2, -2, -4, -4, -5, -5, -6, -6,
+    -7, -7, -7, -7, -7, -7, -6, -6, -6, -6, -8, -8,
+    -12, -12, -12, -12, -10, -10, -10, -10, -12, -12, -13, -13,
+    -12, -12, -10, -10, -9, -9, -10, -10, -11, -11, -12, -12,
+    -12, -12, -10, -10, -9, -9, -11, -11, -14, -14, -13, -13,
+    -10, -10, -10, -10, -13, -13, -13, -13, -10, -10, -8, -8,
+    -9, -9, -12, -12, -11, -11, -9, -9, -9, -9, -12, -12,
+    -13, -13, -11, -11, -11, -11, -11, -11, -11, -11, -10, -10,
+    -9, -9, -10, -10, -11, -11, -10, -10, -10, -10, -11, -11,
+    -11, -11, -9, -9, -6, -6, -6, -6, -7, -7, -9, -9,
+    -7, -7, -4, -4, -4, -4, -7, -7, -8, -8, -6, -6,
+    0, 0, 3, 3, 2, 2, 0, 0, -1, -1, 1, 1,
+    3, 3, 3, 3, 4, 4, 7, 7, 11, 11, 12, 12,
+    11, 11, 10, 10, 11, 11, 11, 11, 9, 9, 9, 9,
+    11, 11, 15, 15, 15, 15, 12, 12, 12, 12, 14, 14,
+    15, 15, 17, 17, 18, 18, 19, 19, 18, 18, 17, 17,
+    18, 18, 20, 20, 21, 21, 22, 22, 22, 22, 21, 21,
+    20, 20, 20, 20, 21, 21, 21, 21, 20, 20, 21, 21,
+    21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21,
+    23, 23, 24, 24, 23, 23, 20, 20, 19, 19, 21, 21,
+    24, 24, 22, 22, 20, 20, 20, 20, 20, 20, 18, 18,
+    18, 18, 20, 20, 22, 22, 21, 21, 19, 19, 19, 19,
+    20, 20, 18, 18, 17, 17, 18, 18, 20, 20, 23, 23,
+    23, 23, 22, 22, 22, 22, 21, 21, 22, 22, 21, 21,
+    20, 20, 22, 22, 25, 25, 25, 25, 21, 21, 16, 16,
+    18, 18, 24, 24, 24, 24, 20, 20, 18, 18, 21, 21,
+    23, 23, 23, 23, 19, 19, 17, 17, 19, 19, 19, 19,
+    18, 18, 17, 17, 17, 17, 17, 17, 14, 14, 13, 13,
+    13, 13, 16, 16, 16, 16, 13, 13, 10, 10, 13, 13,
+    18, 18, 17, 17, 14, 14, 16, 16, 20, 20, 20, 20,
+    17, 17, 15, 15, 17, 17, 17, 17, 14, 14, 13, 13,
+    14, 14, 15, 15, 14, 14, 14, 14, 16, 16, 17, 17,
+    14, 14, 11, 11, 13, 13, 16, 16, 13, 13, 11, 11,
+    10, 10, 11, 11, 11, 11, 8, 8, 7, 7, 9, 9,
+    12, 12, 13, 13, 11, 11, 8, 8, 6, 6, 5, 5,
+    6, 6, 9, 9, 11, 11, 12, 12, 12, 12, 12, 12,
+    10, 10, 9, 9, 8, 8, 9, 9, 15, 15, 21, 21,
+    20, 20, 12, 12, 7, 7, 9, 9, 13, 13, 16, 16,
+    17, 17, 17, 17, 15, 15, 10, 10, 9, 9, 12, 12,
+    16, 16, 16, 16, 12, 12, 8, 8, 8, 8, 10, 10,
+    12, 12, 14, 14, 13, 13, 11, 11, 12, 12, 16, 16,
+    16, 16, 13, 13, 15, 15, 17, 17, 14, 14, 7, 7,
+    7, 7, 10, 10, 9, 9, 7, 7, 10, 10, 14, 14,
+    12, 12, 5, 5, 3, 3, 6, 6, 10, 10, 11, 11,
+    11, 11, 7, 7, 2, 2, 1, 1, 5, 5, 5, 5,
+    0, 0, -3, -3, 2, 2, 7, 7, 2, 2, -8, -8,
+    -10, -10, -2, -2, 2, 2, -6, -6, -15, -15, -17, -17,
+    -15, -15, -13, -13, -12, -12, -10, -10, -6, -6, -6, -6,
+    -15, -15, -21, -21, -10, -10, 12, 12, 27, 27, 21, 21,
+    4, 4, -11, -11, -19, -19, -15, -15, 7, 7, 39, 39,
+    64, 64, 70, 70, 60, 60, 26, 26, -48, -48, -150, -150,
+    -201, -201, -114, -114, 121, 121, 411, 411, 610, 610, 604, 604,
+    392, 392, 117, 117, -24, -24, 41, 41, 196, 196, 288, 288,
+    274, 274, 197, 197, 79, 79, -81, -81, -227, -227, -259, -259,
+    -159, -159, -25, -25, 40, 40, 29, 29, -13, -13, -60, -60,
+    -109, -109, -133, -133, -99, -99, -12, -12, 83, 83, 132, 132,
+    104, 104, 16, 16, -83, -83, -143, -143, -149, -149, -121, -121,
+    -82, -82, -38, -38, 23, 23, 102, 102, 158, 158, 133, 133,
+    19, 19, -101, -101, -126, -126, -30, -30, 103, 103, 169, 169,
+    133, 133, 37, 37, -57, -57, -106, -106, -116, -116, -128, -128,
+    -154, -154, -131, -131, -14, -14, 115, 115, 114, 114, -21, -21,
+    -142, -142, -160, -160, -131, -131, -111, -111, -32, -32, 138, 138,
+    255, 255, 151, 151, -83, -83, -181, -181, -60, -60, 72, 72,
+    21, 21, -118, -118, -123, -123, 35, 35, 169, 169, 126, 126,
+    -56, -56, -234, -234, -291, -291, -188, -188, 41, 41, 264, 264,
+    300, 300, 104, 104, -147, -147, -221, -221, -78, -78, 110, 110,
+    188, 188, 164, 164, 127, 127, 82, 82, -27, -27, -180, -180,
+    -248, -248, -145, -145, 45, 45, 157, 157, 112, 112, -26, -26,
+    -120, -120, -89, -89, 16, 16, 80, 80, 66, 66, 37, 37,
+    28, 28, -13, -13, -105, -105, -141, -141, -11, -11, 211, 211,
+    289, 289, 100, 100, -201, -201, -345, -345, -242, -242, -30, -30,
+    114, 114, 131, 131, 69, 69, -14, -14, -118, -118, -225, -225,
+    -231, -231, -44, -44, 215, 215, 283, 283, 80, 80, -156, -156,
+    -173, -173, -27, -27, 36, 36, -29, -29, -33, -33, 79, 79,
+    97, 97, -107, -107, -313, -313, -247, -247, 23, 23, 192, 192,
+    130, 130, -20, -20, -98, -98, -91, -91, -38, -38, 54, 54,
+    143, 143, 125, 125, -26, -26, -164, -164, -128, -128, 40, 40,
+    150, 150, 109, 109, 5, 5, -52, -52, -59, -59, -61, -61,
+    -49, -49, -5, -5, 24, 24, -14, -14, -60, -60, -2, -2,
+    130, 130, 161, 161, 3, 3, -207, -207, -274, -274, -135, -135,
+    136, 136, 399, 399, 465, 465, 202, 202, -265, -265, -578, -578,
+    -496, -496, -152, -152, 164, 164, 334, 334, 399, 399, 330, 330,
+    48, 48, -337, -337, -539, -539, -396, -396, -19, -19, 364, 364,
+    567, 567, 459, 459, 50, 50, -394, -394, -518, -518, -252, -252,
+    134, 134, 375, 375, 434, 434, 341, 341, 51, 51, -373, -373,
+    -618, -618, -415, -415, 96, 96, 503, 503, 586, 586, 444, 444,
+    178, 178, -226, -226, -636, -636, -679, -679, -163, -163, 567, 567,
+    914, 914, 648, 648, 97, 97, -290, -290, -382, -382, -327, -327,
+    -228, -228, -46, -46, 236, 236, 493, 493, 548, 548, 336, 336,
+    -30, -30, -323, -323, -350, -350, -75, -75, 362, 362, 719, 719,
+    746, 746, 335, 335, -322, -322, -789, -789, -744, -744, -274, -274,
+    247, 247, 553, 553, 599, 599, 355, 355, -211, -211, -853, -853,
+    -1047, -1047, -540, -540, 284, 284, 815, 815, 840, 840, 534, 534,
+    41, 41, -543, -543, -886, -886, -594, -594, 231, 231, 932, 932,
+    994, 994, 556, 556, 91, 91, -175, -175, -323, -323, -409, -409,
+    -330, -330, -19, -19, 393, 393, 627, 627, 453, 453, -85, -85,
+    -615, -615, -705, -705, -284, -284, 289, 289, 592, 592, 492, 492,
+    111, 111, -351, -351, -666, -666, -636, -636, -279, -279, 128, 128,
+    291, 291, 163, 163, -108, -108, -368, -368, -523, -523, -495, -495,
+    -271, -271, 21, 21, 183, 183, 146, 146, -12, -12, -203, -203,
+    -368, -368, -397, -397, -210, -210, 58, 58, 130, 130, -62, -62,
+    -256, -256, -195, -195, 23, 23, 74, 74, -128, -128, -312, -312,
+    -255, -255, -82, -82, -7, -7, -5, -5, 40, 40, 47, 47,
+    -105, -105, -284, -284, -219, -219, 104, 104, 382, 382, 341, 341,
+    20, 20, -327, -327, -465, -465, -302, -302, 43, 43, 256, 256,
+    137, 137, -93, -93, -86, -86, 55, 55, -68, -68, -433, -433,
+    -542, -542, -174, -174, 287, 287, 455, 455, 386, 386, 215, 215,
+    -172, -172, -734, -734, -904, -904, -228, -228, 790, 790, 1102, 1102,
+    400, 400, -566, -566, -980, -980, -724, -724, -128, -128, 471, 471,
+    755, 755, 474, 474, -231, -231, -760, -760, -592, -592, 116, 116,
+    624, 624, 415, 415, -209, -209, -501, -501, -133, -133, 480, 480,
+    688, 688, 289, 289, -352, -352, -739, -739, -638, -638, -105, -105,
+    569, 569, 886, 886, 498, 498, -284, -284, -715, -715, -498, -498,
+    -48, -48, 217, 217, 336, 336, 419, 419, 298, 298, -106, -106,
+    -446, -446, -354, -354, 22, 22, 249, 249, 217, 217, 138, 138,
+    71, 71, -95, -95, -275, -275, -274, -274, -149, -149, -63, -63,
+    47, 47, 269, 269, 382, 382, 162, 162, -196, -196, -359, -359,
+    -334, -334, -287, -287, -109, -109, 347, 347, 714, 714, 421, 421,
+    -377, -377, -793, -793, -384, -384, 250, 250, 361, 361, 24, 24,
+    -202, -202, -99, -99, 123, 123, 250, 250, 220, 220, 48, 48,
+    -133, -133, -73, -73, 317, 317, 734, 734, 715, 715, 184, 184,
+    -406, -406, -536, -536, -154, -154, 342, 342, 544, 544, 385, 385,
+    73, 73, -237, -237, -550, -550, -758, -758, -529, -529, 195, 195,
+    812, 812, 620, 620, -251, -251, -917, -917, -772, -772, -104, -104,
+    419, 419, 493, 493, 226, 226, -232, -232, -744, -744, -999, -999,
+    -693, -693, 42, 42, 644, 644, 650, 650, 86, 86, -630, -630,
+    -1011, -1011, -780, -780, -63, -63, 639, 639, 802, 802, 340, 340,
+    -313, -313, -622, -622, -440, -440, -47, -47, 248, 248, 371, 371,
+    353, 353, 147, 147, -249, -249, -597, -597, -587, -587, -226, -226,
+    126, 126, 188, 188, 65, 65, 0, 0, 14, 14, -16, -16,
+    -64, -64, -3, -3, 119, 119, 118, 118, -3, -3, -24, -24,
+    119, 119, 189, 189, 0, 0, -267, -267, -311, -311, -114, -114,
+    93, 93, 182, 182, 197, 197, 143, 143, -65, -65, -365, -365,
+    -472, -472, -181, -181, 342, 342, 689, 689, 618, 618, 229, 229,
+    -208, -208, -467, -467, -438, -438, -158, -158, 182, 182, 361, 361,
+    286, 286, 32, 32, -264, -264, -485, -485, -521, -521, -310, -310,
+    54, 54, 297, 297, 186, 186, -208, -208, -544, -544, -539, -539,
+    -217, -217, 153, 153, 297, 297, 151, 151, -125, -125, -312, -312,
+    -331, -331, -254, -254, -177, -177, -134, -134, -113, -113, -86, -86,
+    -41, -41, -19, -19, -113, -113, -343, -343, -545, -545, -482, -482,
+    -124, -124, 247, 247, 317, 317, 57, 57, -292, -292, -489, -489,
+    -434, -434, -168, -168, 139, 139, 233, 233, 0, 0, -362, -362,
+    -517, -517, -356, -356, -91, -91, 15, 15, -90, -90, -270, -270,
+    -384, -384, -368, -368, -221, -221, -14, -14, 114, 114, 74, 74,
+    -62, -62, -135, -135, -84, -84, 9, 9, 44, 44, 3, 3,
+    -86, -86, -191, -191, -272, -272, -289, -289, -241, -241, -173, -173,
+    -111, -111, -40, -40, 39, 39, 57, 57, -33, -33, -125, -125,
+    -64, -64, 123, 123, 217, 217, 99, 99, -86, -86, -129, -129,
+    -17, -17, 94, 94, 87, 87, -19, -19, -134, -134, -194, -194,
+    -158, -158, -27, -27, 102, 102, 82, 82, -88, -88, -206, -206,
+    -108, -108, 111, 111, 208, 208, 77, 77, -148, -148, -255, -255,
+    -165, -165, 29, 29, 187, 187, 226, 226, 120, 120, -91, -91,
+    -256, -256, -218, -218, -15, -15, 143, 143, 109, 109, -55, -55,
+    -197, -197, -227, -227, -148, -148, -20, -20, 65, 65, 26, 26,
+    -122, -122, -230, -230, -152, -152, 65, 65, 218, 218, 188, 188,
+    30, 30, -146, -146, -258, -258, -241, -241, -108, -108, 12, 12,
+    1, 1, -106, -106, -172, -172, -130, -130, -49, -49, -38, -38,
+    -112, -112, -167, -167, -94, -94, 81, 81, 206, 206, 153, 153,
+    -51, -51, -240, -240, -271, -271, -161, -161, -29, -29, 50, 50,
+    62, 62, -10, -10, -146, -146, -235, -235, -170, -170, 13, 13,
+    162, 162, 146, 146, -41, -41, -251, -251, -295, -295, -124, -124,
+    117, 117, 243, 243, 184, 184, -4, -4, -201, -201, -281, -281,
+    -188, -188, -13, -13, 90, 90, 67, 67, 6, 6, -26, -26,
+    -71, -71, -147, -147, -151, -151, -34, -34, 47, 47, -46, -46,
+    -184, -184, -176, -176, -73, -73, -39, -39, -46, -46, 17, 17,
+    63, 63, -52, -52, -237, -237, -278, -278, -156, -156, -9, -9,
+    126, 126, 260, 260, 264, 264, 31, 31, -234, -234, -217, -217,
+    30, 30, 150, 150, 32, 32, -87, -87, -77, -77, -72, -72,
+    -110, -110, -35, -35, 151, 151, 212, 212, 50, 50, -161, -161,
+    -244, -244, -172, -172, 55, 55, 390, 390, 590, 590, 403, 403,
+    -54, -54, -359, -359, -297, -297, -68, -68, 75, 75, 106, 106,
+    73, 73, -47, -47, -195, -195, -206, -206, -51, -51, 107, 107,
+    175, 175, 192, 192, 139, 139, -44, -44, -222, -222, -160, -160,
+    117, 117, 325, 325, 290, 290, 114, 114, -60, -60, -197, -197,
+    -257, -257, -168, -168, 22, 22, 140, 140, 116, 116, 44, 44,
+    -12, -12, -76, -76, -112, -112, -32, -32, 116, 116, 178, 178,
+    128, 128, 77, 77, 52, 52, -5, -5, -58, -58, -17, -17,
+    68, 68, 65, 65, -19, -19, -58, -58, -36, -36, -52, -52,
+    -104, -104, -71, -71, 59, 59, 145, 145, 109, 109, 41, 41,
+    31, 31, 62, 62, 97, 97, 121, 121, 92, 92, -13, -13,
+    -115, -115, -106, -106, -13, -13, 36, 36, -18, -18, -131, -131,
+    -239, -239, -270, -270, -145, -145, 96, 96, 239, 239, 120, 120,
+    -142, -142, -267, -267, -154, -154, 47, 47, 168, 168, 184, 184,
+    146, 146, 81, 81, -6, -6, -111, -111, -222, -222, -279, -279,
+    -185, -185, 49, 49, 229, 229, 168, 168, -65, -65, -219, -219,
+    -173, -173, -40, -40, 37, 37, 59, 59, 100, 100, 149, 149,
+    120, 120, -7, -7, -139, -139, -179, -179, -136, -136, -89, -89,
+    -76, -76, -91, -91, -138, -138, -231, -231, -315, -315, -294, -294,
+    -158, -158, -27, -27, -11, -11, -75, -75, -107, -107, -78, -78,
+    -41, -41, -30, -30, -26, -26, -14, -14, -2, -2, -9, -9,
+    -64, -64, -181, -181, -295, -295, -299, -299, -202, -202, -130, -130,
+    -145, -145, -155, -155, -95, -95, -59, -59, -139, -139, -238, -238,
+    -209, -209, -95, -95, -60, -60, -122, -122, -152, -152, -109, -109,
+    -97, -97, -161, -161, -206, -206, -174, -174, -140, -140, -177, -177,
+    -239, -239, -250, -250, -220, -220, -199, -199, -194, -194, -193, -193,
+    -196, -196, -188, -188, -132, -132, -45, -45, -11, -11, -70, -70,
+    -143, -143, -135, -135, -70, -70, -37, -37, -57, -57, -73, -73,
+    -62, -62, -65, -65, -103, -103, -134, -134, -133, -133, -128, -128,
+    -134, -134, -103, -103, -11, -11, 72, 72, 61, 61, -22, -22,
+    -70, -70, -37, -37, 14, 14, 24, 24, 21, 21, 61, 61,
+    136, 136, 183, 183, 163, 163, 91, 91, 15, 15, -19, -19,
+    -10, -10, -8, -8, -49, -49, -85, -85, -34, -34, 96, 96,
+    197, 197, 201, 201, 164, 164, 172, 172, 220, 220, 245, 245,
+    244, 244, 260, 260, 294, 294, 294, 294, 246, 246, 187, 187,
+    149, 149, 121, 121, 102, 102, 113, 113, 163, 163, 217, 217,
+    239, 239, 236, 236, 244, 244, 276, 276, 313, 313, 327, 327,
+    315, 315, 296, 296, 294, 294, 313, 313, 341, 341, 367, 367,
+    384, 384, 380, 380, 348, 348, 298, 298, 246, 246, 195, 195,
+    156, 156, 162, 162, 216, 216, 272, 272, 288, 288, 299, 299,
+    357, 357, 427, 427, 419, 419, 332, 332, 276, 276, 313, 313,
+    375, 375, 377, 377, 337, 337, 313, 313, 301, 301, 269, 269,
+    234, 234, 226, 226, 222, 222, 194, 194, 177, 177, 212, 212,
+    262, 262, 265, 265, 236, 236, 242, 242, 280, 280, 295, 295,
+    282, 282, 287, 287, 307, 307, 290, 290, 231, 231, 199, 199,
+    222, 222, 243, 243, 208, 208, 133, 133, 63, 63, 19, 19,
+    10, 10, 52, 52, 128, 128, 182, 182, 174, 174, 127, 127,
+    80, 80, 54, 54, 59, 59, 95, 95, 126, 126, 110, 110,
+    46, 46, -20, -20, -59, -59, -91, -91, -130, -130, -156, -156,
+    -156, -156, -155, -155, -170, -170, -177, -177, -159, -159, -144, -144,
+    -166, -166, -217, -217, -262, -262, -275, -275, -252, -252, -217, -217,
+    -217, -217, -273, -273, -339, -339, -361, -361, -359, -359, -399, -399,
+    -483, -483, -545, -545, -560, -560, -589, -589, -663, -663, -724, -724,
+    -718, -718, -678, -678, -657, -657, -655, -655, -663, -663, -704, -704,
+    -772, -772, -794, -794, -735, -735, -685, -685, -738, -738, -864, -864,
+    -963, -963, -1006, -1006, -1032, -1032, -1048, -1048, -1034, -1034, -1028, -1028,
+    -1092, -1092, -1204, -1204, -1272, -1272, -1254, -1254, -1202, -1202, -1165, -1165,
+    -1147, -1147, -1162, -1162, -1242, -1242, -1363, -1363, -1442, -1442, -1433, -1433,
+    -1376, -1376, -1326, -1326, -1299, -1299, -1307, -1307, -1375, -1375, -1468, -1468,
+    -1480, -1480, -1342, -1342, -1130, -1130, -989, -989, -971, -971, -1002, -1002,
+    -993, -993, -929, -929, -849, -849, -796, -796, -794, -794, -820, -820,
+    -818, -818, -773, -773, -734, -734, -737, -737, -733, -733, -642, -642,
+    -481, -481, -347, -347, -289, -289, -246, -246, -163, -163, -77, -77,
+    -39, -39, -12, -12, 67, 67, 173, 173, 232, 232, 232, 232,
+    224, 224, 240, 240, 275, 275, 334, 334, 434, 434, 548, 548,
+    632, 632, 686, 686, 744, 744, 810, 810, 846, 846, 856, 856,
+    904, 904, 1019, 1019, 1142, 1142, 1202, 1202, 1202, 1202, 1189, 1189,
+    1186, 1186, 1201, 1201, 1245, 1245, 1307, 1307, 1348, 1348, 1346, 1346,
+    1333, 1333, 1347, 1347, 1384, 1384, 1418, 1418, 1444, 1444, 1481, 1481,
+    1520, 1520, 1527, 1527, 1508, 1508, 1507, 1507, 1535, 1535, 1545, 1545,
+    1496, 1496, 1425, 1425, 1385, 1385, 1374, 1374, 1339, 1339, 1264, 1264,
+    1193, 1193, 1182, 1182, 1226, 1226, 1267, 1267, 1264, 1264, 1225, 1225,
+    1187, 1187, 1168, 1168, 1159, 1159, 1126, 1126, 1055, 1055, 981, 981,
+    945, 945, 938, 938, 906, 906, 833, 833, 765, 765, 738, 738,
+    739, 739, 739, 739, 732, 732, 728, 728, 719, 719, 694, 694,
+    670, 670, 670, 670, 680, 680, 665, 665, 633, 633, 625, 625,
+    648, 648, 669, 669, 673, 673, 681, 681, 701, 701, 707, 707,
+    675, 675, 610, 610, 536, 536, 484, 484, 479, 479, 513, 513,
+    548, 548, 550, 550, 523, 523, 500, 500, 504, 504, 529, 529,
+    564, 564, 603, 603, 621, 621, 589, 589, 527, 527, 495, 495,
+    504, 504, 499, 499, 452, 452, 400, 400, 391, 391, 414, 414,
+    428, 428, 414, 414, 381, 381, 337, 337, 283, 283, 237, 237,
+    221, 221, 227, 227, 219, 219, 175, 175, 115, 115, 64, 64,
+    30, 30, 7, 7, -31, -31, -103, -103, -178, -178, -205, -205,
+    -191, -191, -209, -209, -284, -284, -358, -358, -388, -388, -411, -411,
+    -459, -459, -496, -496, -487, -487, -480, -480, -538, -538, -633, -633,
+    -677, -677, -664, -664, -671, -671, -741, -741, -835, -835, -919, -919,
+    -997, -997, -1062, -1062, -1102, -1102, -1138, -1138, -1187, -1187, -1220, -1220,
+    -1234, -1234, -1284, -1284, -1380, -1380, -1438, -1438, -1419, -1419, -1418, -1418,
+    -1511, -1511, -1616, -1616, -1627, -1627, -1612, -1612, -1705, -1705, -1864, -1864,
+    -1927, -1927, -1891, -1891, -1917, -1917, -2052, -2052, -2160, -2160, -2169, -2169,
+    -2175, -2175, -2243, -2243, -2319, -2319, -2371, -2371, -2445, -2445, -2541, -2541,
+    -2604, -2604, -2662, -2662, -2804, -2804, -2997, -2997, -3091, -3091, -3031, -3031,
+    -2905, -2905, -2751, -2751, -2492, -2492, -2131, -2131, -1820, -1820, -1655, -1655,
+    -1539, -1539, -1370, -1370, -1210, -1210, -1152, -1152, -1166, -1166, -1197, -1197,
+    -1265, -1265, -1376, -1376, -1455, -1455, -1451, -1451, -1401, -1401, -1325, -1325,
+    -1180, -1180, -948, -948, -679, -679, -411, -411, -124, -124, 178, 178,
+    432, 432, 593, 593, 687, 687, 744, 744, 762, 762, 762, 762,
+    791, 791, 850, 850, 878, 878, 861, 861, 852, 852, 881, 881,
+    933, 933, 1022, 1022, 1167, 1167, 1325, 1325, 1441, 1441, 1539, 1539,
+    1666, 1666, 1792, 1792, 1876, 1876, 1955, 1955, 2065, 2065, 2150, 2150,
+    2145, 2145, 2105, 2105, 2107, 2107, 2107, 2107, 2011, 2011, 1852, 1852,
+    1733, 1733, 1650, 1650, 1521, 1521, 1388, 1388, 1370, 1370, 1454, 1454,
+    1515, 1515, 1530, 1530, 1578, 1578, 1647, 1647, 1646, 1646, 1588, 1588,
+    1564, 1564, 1560, 1560, 1469, 1469, 1279, 1279, 1075, 1075, 888, 888,
+    671, 671, 425, 425, 220, 220, 68, 68, -76, -76, -196, -196,
+    -216, -216, -149, -149, -98, -98, -96, -96, -91, -91, -84, -84,
+    -129, -129, -201, -201, -236, -236, -264, -264, -367, -367, -519, -519,
+    -630, -630, -704, -704, -815, -815, -952, -952, -1033, -1033, -1046, -1046,
+    -1049, -1049, -1053, -1053, -1015, -1015, -937, -937, -867, -867, -794, -794,
+    -663, -663, -503, -503, -398, -398, -343, -343, -261, -261, -145, -145,
+    -68, -68, -30, -30, 27, 27, 82, 82, 64, 64, -8, -8,
+    -39, -39, -4, -4, 40, 40, 81, 81, 173, 173, 330, 330,
+    499, 499, 645, 645, 807, 807, 1018, 1018, 1251, 1251, 1459, 1459,
+    1627, 1627, 1747, 1747, 1802, 1802, 1808, 1808, 1809, 1809, 1811, 1811,
+    1790, 1790, 1763, 1763, 1783, 1783, 1851, 1851, 1908, 1908, 1920, 1920,
+    1924, 1924, 1976, 1976, 2078, 2078, 2175, 2175, 2219, 2219, 2237, 2237,
+    2281, 2281, 2342, 2342, 2362, 2362, 2330, 2330, 2285, 2285, 2237, 2237,
+    2151, 2151, 2025, 2025, 1920, 1920, 1873, 1873, 1835, 1835, 1737, 1737,
+    1594, 1594, 1474, 1474, 1391, 1391, 1313, 1313, 1240, 1240, 1200, 1200,
+    1177, 1177, 1132, 1132, 1081, 1081, 1060, 1060, 1047, 1047, 995, 995,
+    910, 910, 817, 817, 705, 705, 551, 551, 376, 376, 229, 229,
+    130, 130, 59, 59, -6, -6, -69, -69, -119, -119, -145, -145,
+    -147, -147, -140, -140, -145, -145, -160, -160, -168, -168, -180, -180,
+    -232, -232, -320, -320, -398, -398, -450, -450, -514, -514, -596, -596,
+    -651, -651, -663, -663, -669, -669, -692, -692, -718, -718, -744, -744,
+    -776, -776, -799, -799, -809, -809, -836, -836, -891, -891, -920, -920,
+    -878, -878, -800, -800, -751, -751, -727, -727, -697, -697, -685, -685,
+    -739, -739, -808, -808, -805, -805, -757, -757, -776, -776, -874, -874,
+    -946, -946, -953, -953, -965, -965, -1020, -1020, -1063, -1063, -1056, -1056,
+    -1030, -1030, -1025, -1025, -1046, -1046, -1086, -1086, -1137, -1137, -1189, -1189,
+    -1260, -1260, -1382, -1382, -1545, -1545, -1676, -1676, -1736, -1736, -1770, -1770,
+    -1833, -1833, -1891, -1891, -1890, -1890, -1870, -1870, -1912, -1912, -2010, -2010,
+    -2097, -2097, -2159, -2159, -2227, -2227, -2306, -2306, -2396, -2396, -2520, -2520,
+    -2666, -2666, -2790, -2790, -2919, -2919, -3144, -3144, -3457, -3457, -3725, -3725,
+    -3866, -3866, -3927, -3927, -3920, -3920, -3735, -3735, -3325, -3325, -2840, -2840,
+    -2447, -2447, -2119, -2119, -1744, -1744, -1369, -1369, -1133, -1133, -1035, -1035,
+    -970, -970, -935, -935, -1017, -1017, -1206, -1206, -1390, -1390, -1517, -1517,
+    -1616, -1616, -1674, -1674, -1631, -1631, -1460, -1460, -1170, -1170, -756, -756,
+    -247, -247, 243, 243, 613, 613, 886, 886, 1132, 1132, 1323, 1323,
+    1380, 1380, 1353, 1353, 1383, 1383, 1489, 1489, 1543, 1543, 1487, 1487,
+    1415, 1415, 1402, 1402, 1406, 1406, 1403, 1403, 1461, 1461, 1630, 1630,
+    1841, 1841, 2010, 2010, 2147, 2147, 2305, 2305, 2461, 2461, 2548, 2548,
+    2573, 2573, 2611, 2611, 2694, 2694, 2780, 2780, 2830, 2830, 2846, 2846,
+    2805, 2805, 2655, 2655, 2388, 2388, 2077, 2077, 1807, 1807, 1613, 1613,
+    1497, 1497, 1451, 1451, 1465, 1465, 1521, 1521, 1593, 1593, 1655, 1655,
+    1684, 1684, 1675, 1675, 1646, 1646, 1614, 1614, 1556, 1556, 1429, 1429,
+    1220, 1220, 959, 959, 669, 669, 342, 342, -7, -7, -319, -319,
+    -559, -559, -743, -743, -871, -871, -904, -904, -828, -828, -713, -713,
+    -654, -654, -669, -669, -710, -710, -735, -735, -746, -746, -757, -757,
+    -770, -770, -789, -789, -834, -834, -915, -915, -1018, -1018, -1130, -1130,
+    -1251, -1251, -1377, -1377, -1485, -1485, -1541, -1541, -1512, -1512, -1394, -1394,
+    -1237, -1237, -1112, -1112, -1038, -1038, -964, -964, -831, -831, -635, -635,
+    -405, -405, -167, -167, 64, 64, 261, 261, 392, 392, 438, 438,
+    411, 411, 335, 335, 238, 238, 149, 149, 97, 97, 111, 111,
+    211, 211, 395, 395, 617, 617, 818, 818, 993, 993, 1195, 1195,
+    1459, 1459, 1745, 1745, 1983, 1983, 2152, 2152, 2276, 2276, 2370, 2370,
+    2418, 2418, 2401, 2401, 2335, 2335, 2253, 2253, 2180, 2180, 2122, 2122,
+    2083, 2083, 2078, 2078, 2116, 2116, 2183, 2183, 2244, 2244, 2270, 2270,
+    2263, 2263, 2251, 2251, 2263, 2263, 2305, 2305, 2368, 2368, 2438, 2438,
+    2489, 2489, 2485, 2485, 2400, 2400, 2241, 2241, 2049, 2049, 1856, 1856,
+    1674, 1674, 1502, 1502, 1349, 1349, 1223, 1223, 1113, 1113, 1000, 1000,
+    886, 886, 800, 800, 769, 769, 781, 781, 806, 806, 822, 822,
+    825, 825, 805, 805, 751, 751, 654, 654, 517, 517, 352, 352,
+    175, 175, 0, 0, -171, -171, -331, -331, -454, -454, -508, -508,
+    -495, -495, -452, -452, -413, -413, -378, -378, -327, -327, -252, -252,
+    -171, -171, -103, -103, -57, -57, -46, -46, -83, -83, -172, -172,
+    -283, -283, -372, -372, -411, -411, -424, -424, -462, -462, -524, -524,
+    -551, -551, -516, -516, -463, -463, -440, -440, -424, -424, -383, -383,
+    -347, -347, -346, -346, -334, -334, -260, -260, -164, -164, -124, -124,
+    -134, -134, -120, -120, -79, -79, -85, -85, -160, -160, -240, -240,
+    -296, -296, -363, -363, -441, -441, -478, -478, -479, -479, -504, -504,
+    -550, -550, -545, -545, -485, -485, -451, -451, -463, -463, -451, -451,
+    -404, -404, -409, -409, -513, -513, -658, -658, -795, -795, -959, -959,
+    -1174, -1174, -1388, -1388, -1554, -1554, -1689, -1689, -1804, -1804, -1859, -1859,
+    -1850, -1850, -1856, -1856, -1911, -1911, -1960, -1960, -1980, -1980, -2045, -2045,
+    -2191, -2191, -2333, -2333, -2413, -2413, -2503, -2503, -2698, -2698, -2961, -2961,
+    -3165, -3165, -3257, -3257, -3309, -3309, -3427, -3427, -3634, -3634, -3871, -3871,
+    -4089, -4089, -4286, -4286, -4459, -4459, -4546, -4546, -4471, -4471, -4228, -4228,
+    -3866, -3866, -3399, -3399, -2814, -2814, -2201, -2201, -1758, -1758, -1559, -1559,
+    -1438, -1438, -1229, -1229, -1000, -1000, -924, -924, -1021, -1021, -1187, -1187,
+    -1371, -1371, -1571, -1571, -1726, -1726, -1747, -1747, -1613, -1613, -1340, -1340,
+    -922, -922, -385, -385, 178, 178, 694, 694, 1160, 1160, 1549, 1549,
+    1773, 1773, 1829, 1829, 1853, 1853, 1932, 1932, 1962, 1962, 1853, 1853,
+    1733, 1733, 1758, 1758, 1851, 1851, 1851, 1851, 1789, 1789, 1807, 1807,
+    1917, 1917, 2032, 2032, 2151, 2151, 2330, 2330, 2531, 2531, 2655, 2655,
+    2697, 2697, 2733, 2733, 2798, 2798, 2871, 2871, 2936, 2936, 2988, 2988,
+    2980, 2980, 2874, 2874, 2700, 2700, 2499, 2499, 2245, 2245, 1914, 1914,
+    1573, 1573, 1303, 1303, 1111, 1111, 996, 996, 991, 991, 1068, 1068,
+    1122, 1122, 1122, 1122, 1150, 1150, 1220, 1220, 1227, 1227, 1114, 1114,
+    952, 952, 781, 781, 544, 544, 209, 209, -160, -160, -520, -520,
+    -900, -900, -1275, -1275, -1520, -1520, -1574, -1574, -1541, -1541, -1531, -1531,
+    -1510, -1510, -1434, -1434, -1366, -1366, -1362, -1362, -1373, -1373, -1369, -1369,
+    -1419, -1419, -1528, -1528, -1579, -1579, -1526, -1526, -1484, -1484, -1537, -1537,
+    -1620, -1620, -1658, -1658, -1682, -1682, -1726, -1726, -1728, -1728, -1631, -1631,
+    -1493, -1493, -1398, -1398, -1315, -1315, -1161, -1161, -949, -949, -754, -754,
+    -581, -581, -376, -376, -135, -135, 110, 110, 351, 351, 567, 567,
+    700, 700, 728, 728, 711, 711, 699, 699, 693, 693, 689, 689,
+    709, 709, 762, 762, 844, 844, 967, 967, 1149, 1149, 1381, 1381,
+    1625, 1625, 1858, 1858, 2080, 2080, 2287, 2287, 2454, 2454, 2563, 2563,
+    2615, 2615, 2611, 2611, 2549, 2549, 2463, 2463, 2396, 2396, 2341, 2341,
+    2272, 2272, 2213, 2213, 2205, 2205, 2223, 2223, 2218, 2218, 2198, 2198,
+    2187, 2187, 2159, 2159, 2090, 2090, 2029, 2029, 2031, 2031, 2068, 2068,
+    2070, 2070, 2022, 2022, 1959, 1959, 1896, 1896, 1799, 1799, 1646, 1646,
+    1468, 1468, 1298, 1298, 1139, 1139, 988, 988, 866, 866, 770, 770,
+    655, 655, 500, 500, 340, 340, 230, 230, 204, 204, 245, 245,
+    282, 282, 253, 253, 184, 184, 143, 143, 131, 131, 84, 84,
+    -26, -26, -165, -165, -296, -296, -413, -413, -514, -514, -588, -588,
+    -624, -624, -628, -628, -615, -615, -583, -583, -516, -516, -415, -415,
+    -305, -305, -218, -218, -163, -163, -119, -119, -61, -61, -3, -3,
+    7, 7, -24, -24, -14, -14, 74, 74, 154, 154, 158, 158,
+    138, 138, 167, 167, 217, 217, 238, 238, 264, 264, 345, 345,
+    438, 438, 478, 478, 490, 490, 547, 547, 652, 652, 736, 736,
+    770, 770, 785, 785, 797, 797, 789, 789, 759, 759, 718, 718,
+    650, 650, 555, 555, 485, 485, 462, 462, 418, 418, 315, 315,
+    226, 226, 215, 215, 232, 232, 209, 209, 171, 171, 150, 150,
+    105, 105, 4, 4, -90, -90, -127, -127, -176, -176, -321, -321,
+    -526, -526, -695, -695, -836, -836, -1009, -1009, -1182, -1182, -1274, -1274,
+    -1316, -1316, -1412, -1412, -1552, -1552, -1634, -1634, -1649, -1649, -1702, -1702,
+    -1851, -1851, -2045, -2045, -2224, -2224, -2379, -2379, -2516, -2516, -2646, -2646,
+    -2796, -2796, -2982, -2982, -3169, -3169, -3313, -3313, -3413, -3413, -3505, -3505,
+    -3600, -3600, -3685, -3685, -3754, -3754, -3806, -3806, -3832, -3832, -3876, -3876,
+    -4048, -4048, -4407, -4407, -4848, -4848, -5192, -5192, -5367, -5367, -5403, -5403,
+    -5292, -5292, -4957, -4957, -4377, -4377, -3646, -3646, -2896, -2896, -2214, -2214,
+    -1650, -1650, -1244, -1244, -1000, -1000, -859, -859, -756, -756, -704, -704,
+    -791, -791, -1051, -1051, -1376, -1376, -1586, -1586, -1585, -1585, -1414, -1414,
+    -1151, -1151, -794, -794, -277, -277, 393, 393, 1093, 1093, 1689, 1689,
+    2132, 2132, 2431, 2431, 2588, 2588, 2618, 2618, 2580, 2580, 2540, 2540,
+    2502, 2502, 2428, 2428, 2315, 2315, 2230, 2230, 2229, 2229, 2291, 2291,
+    2343, 2343, 2358, 2358, 2368, 2368, 2410, 2410, 2478, 2478, 2547, 2547,
+    2601, 2601, 2628, 2628, 2623, 2623, 2604, 2604, 2613, 2613, 2671, 2671,
+    2747, 2747, 2772, 2772, 2695, 2695, 2519, 2519, 2279, 2279, 1997, 1997,
+    1660, 1660, 1255, 1255, 816, 816, 435, 435, 192, 192, 93, 93,
+    77, 77, 91, 91, 119, 119, 153, 153, 179, 179, 193, 193,
+    196, 196, 158, 158, 24, 24, -227, -227, -547, -547, -882, -882,
+    -1225, -1225, -1596, -1596, -1964, -1964, -2250, -2250, -2401, -2401, -2429, -2429,
+    -2379, -2379, -2284, -2284, -2168, -2168, -2062, -2062, -1992, -1992, -1944, -1944,
+    -1881, -1881, -1804, -1804, -1755, -1755, -1754, -1754, -1754, -1754, -1694, -1694,
+    -1587, -1587, -1510, -1510, -1510, -1510, -1554, -1554, -1567, -1567, -1509, -1509,
+    -1395, -1395, -1253, -1253, -1096, -1096, -929, -929, -750, -750, -547, -547,
+    -309, -309, -42, -42, 237, 237, 512, 512, 784, 784, 1068, 1068,
+    1358, 1358, 1597, 1597, 1710, 1710, 1685, 1685, 1596, 1596, 1525, 1525,
+    1493, 1493, 1479, 1479, 1479, 1479, 1520, 1520, 1629, 1629, 1806, 1806,
+    2031, 2031, 2273, 2273, 2505, 2505, 2699, 2699, 2841, 2841, 2943, 2943,
+    3025, 3025, 3081, 3081, 3066, 3066, 2941, 2941, 2728, 2728, 2510, 2510,
+    2349, 2349, 2228, 2228, 2105, 2105, 1996, 1996, 1942, 1942, 1927, 1927,
+    1903, 1903, 1858, 1858, 1803, 1803, 1708, 1708, 1549, 1549, 1383, 1383,
+    1290, 1290, 1266, 1266, 1233, 1233, 1150, 1150, 1041, 1041, 929, 929,
+    796, 796, 639, 639, 482, 482, 326, 326, 146, 146, -52, -52,
+    -219, -219, -344, -344, -459, -459, -570, -570, -636, -636, -646, -646,
+    -624, -624, -573, -573, -485, -485, -393, -393, -343, -343, -342, -342,
+    -374, -374, -436, -436, -527, -527, -617, -617, -683, -683, -734, -734,
+    -764, -764, -725, -725, -603, -603, -468, -468, -401, -401, -379, -379,
+    -309, -309, -169, -169, -11, -11, 132, 132, 280, 280, 426, 426,
+    544, 544, 643, 643, 754, 754, 861, 861, 932, 932, 978, 978,
+    1039, 1039, 1132, 1132, 1237, 1237, 1308, 1308, 1295, 1295, 1202, 1202,
+    1108, 1108, 1084, 1084, 1117, 1117, 1154, 1154, 1201, 1201, 1312, 1312,
+    1483, 1483, 1629, 1629, 1703, 1703, 1751, 1751, 1799, 1799, 1785, 1785,
+    1672, 1672, 1539, 1539, 1457, 1457, 1385, 1385, 1251, 1251, 1065, 1065,
+    872, 872, 694, 694, 547, 547, 455, 455, 409, 409, 367, 367,
+    307, 307, 241, 241, 175, 175, 90, 90, -29, -29, -188, -188,
+    -381, -381, -575, -575, -725, -725, -829, -829, -964, -964, -1187, -1187,
+    -1434, -1434, -1600, -1600, -1714, -1714, -1892, -1892, -2137, -2137, -2325, -2325,
+    -2413, -2413, -2483, -2483, -2588, -2588, -2676, -2676, -2709, -2709, -2722, -2722,
+    -2752, -2752, -2790, -2790, -2826, -2826, -2882, -2882, -2981, -2981, -3120, -3120,
+    -3280, -3280, -3448, -3448, -3624, -3624, -3821, -3821, -4040, -4040, -4229, -4229,
+    -4303, -4303, -4249, -4249, -4163, -4163, -4123, -4123, -4079, -4079, -3972, -3972,
+    -3888, -3888, -3962, -3962, -4179, -4179, -4423, -4423, -4640, -4640, -4825, -4825,
+    -4902, -4902, -4750, -4750, -4338, -4338, -3736, -3736, -3027, -3027, -2260, -2260,
+    -1488, -1488, -786, -786, -229, -229, 129, 129, 277, 277, 267, 267,
+    189, 189, 79, 79, -111, -111, -391, -391, -646, -646, -740, -740,
+    -650, -650, -400, -400, 33, 33, 640, 640, 1296, 1296, 1877, 1877,
+    2375, 2375, 2811, 2811, 3113, 3113, 3198, 3198, 3101, 3101, 2939, 2939,
+    2779, 2779, 2611, 2611, 2426, 2426, 2258, 2258, 2142, 2142, 2090, 2090,
+    2097, 2097, 2140, 2140, 2177, 2177, 2187, 2187, 2192, 2192, 2209, 2209,
+    2203, 2203, 2159, 2159, 2117, 2117, 2092, 2092, 2033, 2033, 1932, 1932,
+    1875, 1875, 1907, 1907, 1944, 1944, 1878, 1878, 1700, 1700, 1459, 1459,
+    1166, 1166, 802, 802, 375, 375, -55, -55, -428, -428, -712, -712,
+    -889, -889, -941, -941, -874, -874, -729, -729, -563, -563, -417, -417,
+    -309, -309, -236, -236, -211, -211, -289, -289, -509, -509, -824, -824,
+    -1156, -1156, -1494, -1494, -1855, -1855, -2184, -2184, -2391, -2391, -2458, -2458,
+    -2430, -2430, -2323, -2323, -2130, -2130, -1888, -1888, -1663, -1663, -1481, -1481,
+    -1322, -1322, -1176, -1176, -1067, -1067, -1012, -1012, -992, -992, -979, -979,
+    -960, -960, -923, -923, -854, -854, -766, -766, -690, -690, -620, -620,
+    -527, -527, -408, -408, -278, -278, -129, -129, 44, 44, 219, 219,
+    391, 391, 594, 594, 845, 845, 1116, 1116, 1369, 1369, 1593, 1593,
+    1780, 1780, 1915, 1915, 1990, 1990, 2010, 2010, 1969, 1969, 1870, 1870,
+    1738, 1738, 1626, 1626, 1565, 1565, 1554, 1554, 1577, 1577, 1635, 1635,
+    1719, 1719, 1818, 1818, 1944, 1944, 2115, 2115, 2287, 2287, 2380, 2380,
+    2383, 2383, 2347, 2347, 2273, 2273, 2114, 2114, 1874, 1874, 1632, 1632,
+    1426, 1426, 1237, 1237, 1052, 1052, 903, 903, 808, 808, 739, 739,
+    668, 668, 604, 604, 560, 560, 522, 522, 468, 468, 398, 398,
+    322, 322, 243, 243, 168, 168, 107, 107, 42, 42, -60, -60,
+    -199, -199, -348, -348, -490, -490, -615, -615, -697, -697, -729, -729,
+    -752, -752, -794, -794, -825, -825, -806, -806, -738, -738, -651, -651,
+    -566, -566, -490, -490, -414, -414, -319, -319, -211, -211, -135, -135,
+    -136, -136, -185, -185, -200, -200, -144, -144, -59, -59, 18, 18,
+    109, 109, 238, 238, 384, 384, 535, 535, 718, 718, 925, 925,
+    1096, 1096, 1210, 1210, 1327, 1327, 1476, 1476, 1607, 1607, 1673, 1673,
+    1708, 1708, 1754, 1754, 1798, 1798, 1814, 1814, 1821, 1821, 1852, 1852,
+    1897, 1897, 1923, 1923, 1924, 1924, 1919, 1919, 1913, 1913, 1896, 1896,
+    1871, 1871, 1846, 1846, 1826, 1826, 1825, 1825, 1854, 1854, 1895, 1895,
+    1914, 1914, 1914, 1914, 1913, 1913, 1891, 1891, 1804, 1804, 1657, 1657,
+    1502, 1502, 1371, 1371, 1250, 1250, 1122, 1122, 990, 990, 863, 863,
+    749, 749, 658, 658, 580, 580, 485, 485, 360, 360, 230, 230,
+    125, 125, 31, 31, -96, -96, -275, -275, -488, -488, -707, -707,
+    -892, -892, -1011, -1011, -1078, -1078, -1152, -1152, -1262, -1262, -1364, -1364,
+    -1428, -1428, -1498, -1498, -1614, -1614, -1750, -1750, -1864, -1864, -1973, -1973,
+    -2104, -2104, -2233, -2233, -2314, -2314, -2347, -2347, -2372, -2372, -2412, -2412,
+    -2457, -2457, -2498, -2498, -2532, -2532, -2556, -2556, -2567, -2567, -2582, -2582,
+    -2615, -2615, -2668, -2668, -2737, -2737, -2811, -2811, -2872, -2872, -2911, -2911,
+    -2945, -2945, -2972, -2972, -2939, -2939, -2816, -2816, -2673, -2673, -2608, -2608,
+    -2622, -2622, -2652, -2652, -2696, -2696, -2789, -2789, -2888, -2888, -2903, -2903,
+    -2857, -2857, -2907, -2907, -3141, -3141, -3474, -3474, -3779, -3779, -4028, -4028,
+    -4238, -4238, -4342, -4342, -4205, -4205, -3747, -3747, -3000, -3000, -2077, -2077,
+    -1124, -1124, -278, -278, 365, 365, 767, 767, 943, 943, 952, 952,
+    850, 850, 631, 631, 264, 264, -184, -184, -543, -543, -727, -727,
+    -832, -832, -953, -953, -980, -980, -705, -705, -107, -107, 626, 626,
+    1324, 1324, 1952, 1952, 2476, 2476, 2792, 2792, 2850, 2850, 2749, 2749,
+    2602, 2602, 2412, 2412, 2144, 2144, 1862, 1862, 1691, 1691, 1655, 1655,
+    1640, 1640, 1532, 1532, 1358, 1358, 1249, 1249, 1270, 1270, 1355, 1355,
+    1419, 1419, 1478, 1478, 1599, 1599, 1755, 1755, 1851, 1851, 1871, 1871,
+    1897, 1897, 1955, 1955, 1961, 1961, 1864, 1864, 1739, 1739, 1652, 1652,
+    1534, 1534, 1269, 1269, 861, 861, 417, 417, 13, 13, -346, -346,
+    -638, -638, -804, -804, -804, -804, -659, -659, -426, -426, -160, -160,
+    101, 101, 329, 329, 484, 484, 513, 513, 400, 400, 198, 198,
+    -36, -36, -318, -318, -688, -688, -1113, -1113, -1503, -1503, -1813, -1813,
+    -2050, -2050, -2193, -2193, -2186, -2186, -2042, -2042, -1840, -1840, -1615, -1615,
+    -1335, -1335, -1013, -1013, -753, -753, -638, -638, -633, -633, -646, -646,
+    -629, -629, -595, -595, -576, -576, -589, -589, -625, -625, -663, -663,
+    -699, -699, -739, -739, -771, -771, -752, -752, -671, -671, -560, -560,
+    -425, -425, -214, -214, 82, 82, 370, 370, 567, 567, 726, 726,
+    948, 948, 1221, 1221, 1437, 1437, 1548, 1548, 1607, 1607, 1647, 1647,
+    1637, 1637, 1545, 1545, 1399, 1399, 1238, 1238, 1078, 1078, 945, 945,
+    895, 895, 959, 959, 1113, 1113, 1297, 1297, 1470, 1470, 1629, 1629,
+    1788, 1788, 1932, 1932, 2017, 2017, 2021, 2021, 1976, 1976, 1913, 1913,
+    1807, 1807, 1617, 1617, 1366, 1366, 1118, 1118, 903, 903, 711, 711,
+    555, 555, 474, 474, 461, 461, 446, 446, 394, 394, 341, 341,
+    331, 331, 347, 347, 343, 343, 292, 292, 203, 203, 101, 101,
+    8, 8, -80, -80, -187, -187, -326, -326, -477, -477, -623, -623,
+    -769, -769, -901, -901, -992, -992, -1055, -1055, -1133, -1133, -1210, -1210,
+    -1193, -1193, -1046, -1046, -872, -872, -789, -789, -785, -785, -747, -747,
+    -637, -637, -529, -529, -509, -509, -584, -584, -697, -697, -776, -776,
+    -758, -758, -627, -627, -418, -418, -178, -178, 74, 74, 325, 325,
+    547, 547, 731, 731, 892, 892, 1042, 1042, 1181, 1181, 1317, 1317,
+    1466, 1466, 1615, 1615, 1731, 1731, 1805, 1805, 1861, 1861, 1924, 1924,
+    2000, 2000, 2101, 2101, 2228, 2228, 2350, 2350, 2415, 2415, 2406, 2406,
+    2356, 2356, 2303, 2303, 2266, 2266, 2252, 2252, 2258, 2258, 2275, 2275,
+    2306, 2306, 2375, 2375, 2477, 2477, 2559, 2559, 2581, 2581, 2562, 2562,
+    2529, 2529, 2469, 2469, 2362, 2362, 2224, 2224, 2072, 2072, 1906, 1906,
+    1744, 1744, 1624, 1624, 1540, 1540, 1441, 1441, 1315, 1315, 1227, 1227,
+    1224, 1224, 1259, 1259, 1246, 1246, 1159, 1159, 1027, 1027, 866, 866,
+    679, 679, 472, 472, 255, 255, 41, 41, -138, -138, -248, -248,
+    -309, -309, -371, -371, -443, -443, -514, -514, -607, -607, -754, -754,
+    -922, -922, -1053, -1053, -1166, -1166, -1318, -1318, -1492, -1492, -1621, -1621,
+    -1703, -1703, -1809, -1809, -1959, -1959, -2087, -2087, -2151, -2151, -2189, -2189,
+    -2244, -2244, -2304, -2304, -2341, -2341, -2365, -2365, -2397, -2397, -2460, -2460,
+    -2568, -2568, -2692, -2692, -2754, -2754, -2712, -2712, -2616, -2616, -2539, -2539,
+    -2486, -2486, -2439, -2439, -2418, -2418, -2432, -2432, -2445, -2445, -2459, -2459,
+    -2531, -2531, -2668, -2668, -2780, -2780, -2827, -2827, -2897, -2897, -3044, -3044,
+    -3154, -3154, -3105, -3105, -2972, -2972, -2921, -2921, -2940, -2940, -2871, -2871,
+    -2690, -2690, -2607, -2607, -2808, -2808, -3224, -3224, -3623, -3623, -3856, -3856,
+    -3943, -3943, -3932, -3932, -3737, -3737, -3197, -3197, -2306, -2306, -1295, -1295,
+    -429, -429, 199, 199, 601, 601, 755, 755, 682, 682, 550, 550,
+    497, 497, 400, 400, 39, 39, -529, -529, -966, -966, -1072, -1072,
+    -984, -984, -867, -867, -643, -643, -151, -151, 567, 567, 1308, 1308,
+    1929, 1929, 2383, 2383, 2621, 2621, 2612, 2612, 2423, 2423, 2194, 2194,
+    2006, 2006, 1835, 1835, 1616, 1616, 1363, 1363, 1198, 1198, 1231, 1231,
+    1382, 1382, 1441, 1441, 1326, 1326, 1193, 1193, 1208, 1208, 1341, 1341,
+    1460, 1460, 1546, 1546, 1642, 1642, 1705, 1705, 1659, 1659, 1568, 1568,
+    1574, 1574, 1660, 1660, 1669, 1669, 1557, 1557, 1446, 1446, 1390, 1390,
+    1261, 1261, 936, 936, 472, 472, 20, 20, -335, -335, -599, -599,
+    -776, -776, -829, -829, -723, -723, -500, -500, -259, -259, -60, -60,
+    119, 119, 281, 281, 339, 339, 211, 211, -41, -41, -275, -275,
+    -466, -466, -727, -727, -1110, -1110, -1509, -1509, -1810, -1810, -2024, -2024,
+    -2174, -2174, -2185, -2185, -1994, -1994, -1691, -1691, -1428, -1428, -1233, -1233,
+    -1039, -1039, -839, -839, -717, -717, -726, -726, -808, -808, -855, -855,
+    -827, -827, -779, -779, -769, -769, -778, -778, -758, -758, -718, -718,
+    -696, -696, -674, -674, -595, -595, -456, -456, -325, -325, -212, -212,
+    -40, -40, 222, 222, 474, 474, 618, 618, 708, 708, 859, 859,
+    1073, 1073, 1264, 1264, 1415, 1415, 1565, 1565, 1677, 1677, 1659, 1659,
+    1508, 1508, 1320, 1320, 1176, 1176, 1077, 1077, 1002, 1002, 971, 971,
+    1027, 1027, 1184, 1184, 1386, 1386, 1557, 1557, 1672, 1672, 1769, 1769,
+    1880, 1880, 1968, 1968, 1987, 1987, 1949, 1949, 1886, 1886, 1772, 1772,
+    1558, 1558, 1276, 1276, 1029, 1029, 844, 844, 655, 655, 448, 448,
+    319, 319, 330, 330, 417, 417, 482, 482, 500, 500, 481, 481,
+    427, 427, 339, 339, 233, 233, 123, 123, 19, 19, -65, -65,
+    -131, -131, -212, -212, -339, -339, -507, -507, -692, -692, -880, -880,
+    -1053, -1053, -1168, -1168, -1196, -1196, -1176, -1176, -1161, -1161, -1143, -1143,
+    -1084, -1084, -999, -999, -932, -932, -869, -869, -759, -759, -610, -610,
+    -488, -488, -429, -429, -426, -426, -458, -458, -503, -503, -544, -544,
+    -586, -586, -632, -632, -634, -634, -526, -526, -300, -300, -20, -20,
+    260, 260, 539, 539, 833, 833, 1128, 1128, 1398, 1398, 1629, 1629,
+    1813, 1813, 1933, 1933, 2007, 2007, 2083, 2083, 2173, 2173, 2238, 2238,
+    2251, 2251, 2239, 2239, 2226, 2226, 2221, 2221, 2245, 2245, 2326, 2326,
+    2427, 2427, 2488, 2488, 2504, 2504, 2521, 2521, 2550, 2550, 2563, 2563,
+    2546, 2546, 2517, 2517, 2492, 2492, 2482, 2482, 2501, 2501, 2551, 2551,
+    2584, 2584, 2542, 2542, 2418, 2418, 2256, 2256, 2093, 2093, 1932, 1932,
+    1774, 1774, 1627, 1627, 1487, 1487, 1356, 1356, 1273, 1273, 1261, 1261,
+    1283, 1283, 1289, 1289, 1275, 1275, 1254, 1254, 1208, 1208, 1125, 1125,
+    1010, 1010, 844, 844, 587, 587, 256, 256, -67, -67, -335, -335,
+    -564, -564, -764, -764, -895, -895, -928, -928, -906, -906, -891, -891,
+    -892, -892, -891, -891, -907, -907, -978, -978, -1108, -1108, -1271, -1271,
+    -1449, -1449, -1627, -1627, -1784, -1784, -1926, -1926, -2064, -2064, -2174, -2174,
+    -2225, -2225, -2247, -2247, -2287, -2287, -2332, -2332, -2349, -2349, -2368, -2368,
+    -2428, -2428, -2488, -2488, -2491, -2491, -2480, -2480, -2544, -2544, -2665, -2665,
+    -2729, -2729, -2690, -2690, -2620, -2620, -2569, -2569, -2500, -2500, -2398, -2398,
+    -2339, -2339, -2376, -2376, -2450, -2450, -2503, -2503, -2576, -2576, -2716, -2716,
+    -2873, -2873, -2973, -2973, -3023, -3023, -3072, -3072, -3121, -3121, -3110, -3110,
+    -3018, -3018, -2921, -2921, -2917, -2917, -2991, -2991, -3013, -3013, -2940, -2940,
+    -2935, -2935, -3175, -3175, -3573, -3573, -3824, -3824, -3745, -3745, -3435, -3435,
+    -3037, -3037, -2505, -2505, -1738, -1738, -844, -844, -88, -88, 402, 402,
+    680, 680, 772, 772, 638, 638, 355, 355, 116, 116, -6, -6,
+    -157, -157, -464, -464, -810, -810, -947, -947, -772, -772, -399, -399,
+    26, 26, 486, 486, 1017, 1017, 1562, 1562, 2003, 2003, 2286, 2286,
+    2439, 2439, 2468, 2468, 2336, 2336, 2067, 2067, 1792, 1792, 1627, 1627,
+    1546, 1546, 1445, 1445, 1331, 1331, 1318, 1318, 1426, 1426, 1515, 1515,
+    1476, 1476, 1377, 1377, 1331, 1331, 1345, 1345, 1374, 1374, 1432, 1432,
+    1542, 1542, 1646, 1646, 1657, 1657, 1590, 1590, 1551, 1551, 1586, 1586,
+    1611, 1611, 1523, 1523, 1331, 1331, 1102, 1102, 853, 853, 542, 542,
+    170, 170, -196, -196, -482, -482, -653, -653, -707, -707, -650, -650,
+    -490, -490, -262, -262, -34, -34, 147, 147, 278, 278, 353, 353,
+    317, 317, 129, 129, -174, -174, -507, -507, -819, -819, -1106, -1106,
+    -1371, -1371, -1608, -1608, -1806, -1806, -1943, -1943, -1978, -1978, -1873, -1873,
+    -1643, -1643, -1364, -1364, -1114, -1114, -913, -913, -749, -749, -631, -631,
+    -577, -577, -577, -577, -613, -613, -666, -666, -709, -709, -706, -706,
+    -662, -662, -619, -619, -606, -606, -603, -603, -569, -569, -484, -484,
+    -369, -369, -260, -260, -155, -155, -12, -12, 193, 193, 433, 433,
+    670, 670, 885, 885, 1074, 1074, 1236, 1236, 1374, 1374, 1492, 1492,
+    1579, 1579, 1607, 1607, 1546, 1546, 1412, 1412, 1270, 1270, 1160, 1160,
+    1061, 1061, 961, 961, 912, 912, 974, 974, 1129, 1129, 1309, 1309,
+    1476, 1476, 1642, 1642, 1821, 1821, 1980, 1980, 2054, 2054, 2014, 2014,
+    1893, 1893, 1741, 1741, 1570, 1570, 1365, 1365, 1139, 1139, 928, 928,
+    751, 751, 604, 604, 486, 486, 414, 414, 398, 398, 425, 425,
+    475, 475, 540, 540, 606, 606, 619, 619, 530, 530, 372, 372,
+    226, 226, 115, 115, -5, -5, -156, -156, -306, -306, -425, -425,
+    -522, -522, -615, -615, -700, -700, -753, -753, -767, -767, -765, -765,
+    -777, -777, -801, -801, -819, -819, -828, -828, -832, -832, -813, -813,
+    -749, -749, -640, -640, -532, -532, -470, -470, -443, -443, -406, -406,
+    -356, -356, -346, -346, -389, -389, -416, -416, -369, -369, -275, -275,
+    -182, -182, -78, -78, 74, 74, 270, 270, 485, 485, 714, 714,
+    959, 959, 1195, 1195, 1382, 1382, 1509, 1509, 1603, 1603, 1688, 1688,
+    1754, 1754, 1785, 1785, 1800, 1800, 1833, 1833, 1901, 1901, 1990, 1990,
+    2068, 2068, 2107, 2107, 2113, 2113, 2127, 2127, 2165, 2165, 2199, 2199,
+    2212, 2212, 2217, 2217, 2229, 2229, 2240, 2240, 2246, 2246, 2252, 2252,
+    2254, 2254, 2244, 2244, 2223, 2223, 2197, 2197, 2167, 2167, 2121, 2121,
+    2045, 2045, 1933, 1933, 1792, 1792, 1636, 1636, 1478, 1478, 1336, 1336,
+    1224, 1224, 1139, 1139, 1073, 1073, 1038, 1038, 1042, 1042, 1061, 1061,
+    1058, 1058, 1007, 1007, 901, 901, 755, 755, 599, 599, 434, 434,
+    242, 242, 25, 25, -182, -182, -361, -361, -520, -520, -655, -655,
+    -751, -751, -811, -811, -854, -854, -895, -895, -936, -936, -971, -971,
+    -1002, -1002, -1050, -1050, -1144, -1144, -1285, -1285, -1447, -1447, -1604, -1604,
+    -1748, -1748, -1875, -1875, -1967, -1967, -2007, -2007, -2010, -2010, -2026, -2026,
+    -2068, -2068, -2086, -2086, -2052, -2052, -2021, -2021, -2049, -2049, -2102, -2102,
+    -2124, -2124, -2137, -2137, -2186, -2186, -2258, -2258, -2315, -2315, -2359, -2359,
+    -2408, -2408, -2450, -2450, -2463, -2463, -2452, -2452, -2438, -2438, -2419, -2419,
+    -2384, -2384, -2342, -2342, -2315, -2315, -2302, -2302, -2300, -2300, -2336, -2336,
+    -2419, -2419, -2491, -2491, -2498, -2498, -2476, -2476, -2487, -2487, -2534, -2534,
+    -2607, -2607, -2714, -2714, -2807, -2807, -2794, -2794, -2697, -2697, -2693, -2693,
+    -2897, -2897, -3198, -3198, -3397, -3397, -3431, -3431, -3376, -3376, -3242, -3242,
+    -2895, -2895, -2221, -2221, -1299, -1299, -366, -366, 359, 359, 792, 792,
+    982, 982, 1021, 1021, 954, 954, 770, 770, 482, 482, 144, 144,
+    -216, -216, -559, -559, -762, -762, -713, -713, -489, -489, -255, -255,
+    1, 1, 464, 464, 1181, 1181, 1925, 1925, 2445, 2445, 2704, 2704,
+    2811, 2811, 2798, 2798, 2618, 2618, 2305, 2305, 1983, 1983, 1727, 1727,
+    1527, 1527, 1387, 1387, 1353, 1353, 1416, 1416, 1497, 1497, 1517, 1517,
+    1466, 1466, 1410, 1410, 1445, 1445, 1587, 1587, 1724, 1724, 1752, 1752,
+    1703, 1703, 1673, 1673, 1679, 1679, 1680, 1680, 1664, 1664, 1631, 1631,
+    1545, 1545, 1386, 1386, 1203, 1203, 1049, 1049, 878, 878, 587, 587,
+    174, 174, -232, -232, -516, -516, -677, -677, -742, -742, -709, -709,
+    -585, -585, -402, -402, -171, -171, 82, 82, 260, 260, 272, 272,
+    140, 140, -64, -64, -316, -316, -621, -621, -947, -947, -1264, -1264,
+    -1580, -1580, -1879, -1879, -2091, -2091, -2158, -2158, -2095, -2095, -1957, -1957,
+    -1765, -1765, -1515, -1515, -1239, -1239, -998, -998, -817, -817, -691, -691,
+    -638, -638, -663, -663, -721, -721, -773, -773, -832, -832, -900, -900,
+    -936, -936, -934, -934, -936, -936, -928, -928, -845, -845, -700, -700,
+    -584, -584, -512, -512, -400, -400, -204, -204, 19, 19, 225, 225,
+    441, 441, 687, 687, 913, 913, 1069, 1069, 1179, 1179, 1278, 1278,
+    1333, 1333, 1306, 1306, 1229, 1229, 1152, 1152, 1063, 1063, 948, 948,
+    845, 845, 799, 799, 815, 815, 892, 892, 1024, 1024, 1174, 1174,
+    1328, 1328, 1517, 1517, 1740, 1740, 1907, 1907, 1955, 1955, 1932, 1932,
+    1898, 1898, 1809, 1809, 1599, 1599, 1313, 1313, 1063, 1063, 892, 892,
+    752, 752, 629, 629, 564, 564, 558, 558, 566, 566, 585, 585,
+    646, 646, 710, 710, 702, 702, 632, 632, 568, 568, 510, 510,
+    414, 414, 285, 285, 157, 157, 26, 26, -114, -114, -225, -225,
+    -294, -294, -372, -372, -487, -487, -584, -584, -607, -607, -594, -594,
+    -618, -618, -680, -680, -727, -727, -735, -735, -720, -720, -674, -674,
+    -589, -589, -499, -499, -434, -434, -371, -371, -307, -307, -308, -308,
+    -403, -403, -504, -504, -525, -525, -489, -489, -452, -452, -407, -407,
+    -322, -322, -200, -200, -55, -55, 107, 107, 275, 275, 438, 438,
+    626, 626, 872, 872, 1139, 1139, 1335, 1335, 1424, 1424, 1464, 1464,
+    1508, 1508, 1545, 1545, 1561, 1561, 1596, 1596, 1670, 1670, 1752, 1752,
+    1816, 1816, 1883, 1883, 1954, 1954, 1990, 1990, 1980, 1980, 1963, 1963,
+    1972, 1972, 2008, 2008, 2071, 2071, 2150, 2150, 2214, 2214, 2255, 2255,
+    2305, 2305, 2373, 2373, 2404, 2404, 2355, 2355, 2267, 2267, 2202, 2202,
+    2141, 2141, 2027, 2027, 1866, 1866, 1715, 1715, 1587, 1587, 1453, 1453,
+    1321, 1321, 1235, 1235, 1209, 1209, 1225, 1225, 1275, 1275, 1349, 1349,
+    1393, 1393, 1359, 1359, 1260, 1260, 1138, 1138, 1004, 1004, 855, 855,
+    688, 688, 491, 491, 249, 249, -3, -3, -201, -201, -339, -339,
+    -468, -468, -596, -596, -671, -671, -671, -671, -647, -647, -645, -645,
+    -657, -657, -688, -688, -773, -773, -912, -912, -1048, -1048, -1160, -1160,
+    -1303, -1303, -1496, -1496, -1669, -1669, -1765, -1765, -1825, -1825, -1910, -1910,
+    -2013, -2013, -2104, -2104, -2178, -2178, -2226, -2226, -2217, -2217, -2161, -2161,
+    -2121, -2121, -2132, -2132, -2154, -2154, -2145, -2145, -2133, -2133, -2159, -2159,
+    -2215, -2215, -2265, -2265, -2299, -2299, -2320, -2320, -2325, -2325, -2317, -2317,
+    -2324, -2324, -2364, -2364, -2416, -2416, -2443, -2443, -2434, -2434, -2412, -2412,
+    -2392, -2392, -2367, -2367, -2338, -2338, -2329, -2329, -2356, -2356, -2398, -2398,
+    -2416, -2416, -2411, -2411, -2444, -2444, -2541, -2541, -2618, -2618, -2569, -2569,
+    -2434, -2434, -2387, -2387, -2526, -2526, -2754, -2754, -2932, -2932, -3042, -3042,
+    -3143, -3143, -3217, -3217, -3132, -3132, -2765, -2765, -2122, -2122, -1327, -1327,
+    -545, -545, 93, 93, 511, 511, 712, 712, 774, 774, 790, 790,
+    775, 775, 650, 650, 350, 350, -56, -56, -407, -407, -605, -605,
+    -685, -685, -696, -696, -569, -569, -199, -199, 394, 394, 1061, 1061,
+    1663, 1663, 2127, 2127, 2412, 2412, 2506, 2506, 2456, 2456, 2329, 2329,
+    2146, 2146, 1897, 1897, 1611, 1611, 1370, 1370, 1244, 1244, 1227, 1227,
+    1256, 1256, 1266, 1266, 1238, 1238, 1205, 1205, 1218, 1218, 1296, 1296,
+    1401, 1401, 1476, 1476, 1501, 1501, 1479, 1479, 1419, 1419, 1353, 1353,
+    1322, 1322, 1328, 1328, 1326, 1326, 1296, 1296, 1257, 1257, 1199, 1199,
+    1062, 1062, 814, 814, 487, 487, 134, 134, -211, -211, -510, -510,
+    -712, -712, -797, -797, -790, -790, -713, -713, -560, -560, -341, -341,
+    -127, -127, 8, 8, 48, 48, 3, 3, -127, -127, -337, -337,
+    -588, -588, -861, -861, -1177, -1177, -1532, -1532, -1857, -1857, -2081, -2081,
+    -2182, -2182, -2161, -2161, -2020, -2020, -1782, -1782, -1510, -1510, -1259, -1259,
+    -1053, -1053, -902, -902, -826, -826, -826, -826, -864, -864, -901, -901,
+    -936, -936, -985, -985, -1029, -1029, -1040, -1040, -1022, -1022, -995, -995,
+    -953, -953, -875, -875, -768, -768, -644, -644, -492, -492, -309, -309,
+    -116, -116, 65, 65, 228, 228, 376, 376, 506, 506, 624, 624,
+    750, 750, 895, 895, 1039, 1039, 1149, 1149, 1205, 1205, 1209, 1209,
+    1159, 1159, 1068, 1068, 975, 975, 920, 920, 910, 910, 938, 938,
+    1016, 1016, 1149, 1149, 1307, 1307, 1458, 1458, 1605, 1605, 1756, 1756,
+    1887, 1887, 1957, 1957, 1958, 1958, 1913, 1913, 1833, 1833, 1706, 1706,
+    1531, 1531, 1334, 1334, 1134, 1134, 943, 943, 789, 789, 712, 712,
+    715, 715, 761, 761, 817, 817, 886, 886, 963, 963, 1013, 1013,
+    998, 998, 911, 911, 782, 782, 649, 649, 528, 528, 407, 407,
+    261, 261, 91, 91, -70, -70, -193, -193, -291, -291, -379, -379,
+    -446, -446, -468, -468, -457, -457, -447, -447, -443, -443, -422, -422,
+    -392, -392, -388, -388, -420, -420, -448, -448, -452, -452, -455, -455,
+    -481, -481, -514, -514, -526, -526, -525, -525, -538, -538, -564, -564,
+    -568, -568, -528, -528, -450, -450, -356, -356, -247, -247, -103, -103,
+    88, 88, 305, 305, 507, 507, 672, 672, 814, 814, 943, 943,
+    1049, 1049, 1123, 1123, 1181, 1181, 1242, 1242, 1302, 1302, 1344, 1344,
+    1373, 1373, 1407, 1407, 1447, 1447, 1483, 1483, 1517, 1517, 1573, 1573,
+    1668, 1668, 1786, 1786, 1898, 1898, 1988, 1988, 2066, 2066, 2138, 2138,
+    2201, 2201, 2242, 2242, 2249, 2249, 2231, 2231, 2204, 2204, 2169, 2169,
+    2111, 2111, 2023, 2023, 1922, 1922, 1821, 1821, 1725, 1725, 1637, 1637,
+    1566, 1566, 1513, 1513, 1476, 1476, 1462, 1462, 1469, 1469, 1484, 1484,
+    1481, 1481, 1445, 1445, 1378, 1378, 1295, 1295, 1192, 1192, 1052, 1052,
+    876, 876, 694, 694, 520, 520, 342, 342, 163, 163, 4, 4,
+    -123, -123, -227, -227, -322, -322, -404, -404, -460, -460, -497, -497,
+    -546, -546, -630, -630, -743, -743, -876, -876, -1031, -1031, -1196, -1196,
+    -1344, -1344, -1484, -1484, -1636, -1636, -1778, -1778, -1872, -1872, -1934, -1934,
+    -2002, -2002, -2074, -2074, -2126, -2126, -2166, -2166, -2209, -2209, -2240, -2240,
+    -2242, -2242, -2244, -2244, -2287, -2287, -2343, -2343, -2347, -2347, -2321, -2321,
+    -2366, -2366, -2494, -2494, -2592, -2592, -2596, -2596, -2580, -2580, -2606, -2606,
+    -2633, -2633, -2621, -2621, -2603, -2603, -2594, -2594, -2559, -2559, -2506, -2506,
+    -2478, -2478, -2466, -2466, -2428, -2428, -2391, -2391, -2435, -2435, -2545, -2545,
+    -2608, -2608, -2584, -2584, -2563, -2563, -2600, -2600, -2619, -2619, -2565, -2565,
+    -2523, -2523, -2595, -2595, -2759, -2759, -2947, -2947, -3131, -3131, -3259, -3259,
+    -3241, -3241, -3055, -3055, -2736, -2736, -2251, -2251, -1543, -1543, -722, -722,
+    -23, -23, 428, 428, 669, 669, 742, 742, 648, 648, 462, 462,
+    300, 300, 147, 147, -124, -124, -500, -500, -777, -777, -829, -829,
+    -732, -732, -554, -554, -206, -206, 358, 358, 995, 995, 1552, 1552,
+    2000, 2000, 2311, 2311, 2400, 2400, 2283, 2283, 2111, 2111, 1968, 1968,
+    1794, 1794, 1566, 1566, 1377, 1377, 1286, 1286, 1247, 1247, 1228, 1228,
+    1257, 1257, 1314, 1314, 1319, 1319, 1270, 1270, 1281, 1281, 1402, 1402,
+    1527, 1527, 1559, 1559, 1540, 1540, 1539, 1539, 1536, 1536, 1524, 1524,
+    1548, 1548, 1600, 1600, 1597, 1597, 1530, 1530, 1463, 1463, 1368, 1368,
+    1137, 1137, 764, 764, 376, 376, 60, 60, -199, -199, -405, -405,
+    -498, -498, -443, -443, -288, -288, -101, -101, 92, 92, 273, 273,
+    388, 388, 400, 400, 322, 322, 174, 174, -49, -49, -326, -326,
+    -618, -618, -927, -927, -1267, -1267, -1579, -1579, -1783, -1783, -1879, -1879,
+    -1894, -1894, -1799, -1799, -1582, -1582, -1328, -1328, -1134, -1134, -1006, -1006,
+    -914, -914, -864, -864, -880, -880, -944, -944, -1009, -1009, -1045, -1045,
+    -1054, -1054, -1042, -1042, -1011, -1011, -981, -981, -967, -967, -951, -951,
+    -916, -916, -874, -874, -824, -824, -724, -724, -563, -563, -395, -395,
+    -244, -244, -71, -71, 126, 126, 300, 300, 452, 452, 637, 637,
+    850, 850, 1027, 1027, 1146, 1146, 1230, 1230, 1262, 1262, 1190, 1190,
+    1029, 1029, 875, 875, 803, 803, 802, 802, 833, 833, 915, 915,
+    1074, 1074, 1283, 1283, 1502, 1502, 1720, 1720, 1918, 1918, 2051, 2051,
+    2109, 2109, 2128, 2128, 2116, 2116, 2050, 2050, 1938, 1938, 1812, 1812,
+    1664, 1664, 1484, 1484, 1317, 1317, 1215, 1215, 1161, 1161, 1108, 1108,
+    1067, 1067, 1096, 1096, 1189, 1189, 1271, 1271, 1281, 1281, 1228, 1228,
+    1150, 1150, 1053, 1053, 942, 942, 838, 838, 755, 755, 681, 681,
+    600, 600, 505, 505, 390, 390, 251, 251, 108, 108, -18, -18,
+    -133, -133, -240, -240, -318, -318, -352, -352, -361, -361, -365, -365,
+    -353, -353, -322, -322, -294, -294, -284, -284, -278, -278, -267, -267,
+    -270, -270, -304, -304, -361, -361, -416, -416, -452, -452, -480, -480,
+    -508, -508, -523, -523, -490, -490, -394, -394, -245, -245, -71, -71,
+    104, 104, 272, 272, 432, 432, 577, 577, 695, 695, 788, 788,
+    862, 862, 910, 910, 949, 949, 1020, 1020, 1130, 1130, 1223, 1223,
+    1261, 1261, 1273, 1273, 1296, 1296, 1323, 1323, 1336, 1336, 1355, 1355,
+    1410, 1410, 1502, 1502, 1602, 1602, 1681, 1681, 1742, 1742, 1803, 1803,
+    1868, 1868, 1929, 1929, 1982, 1982, 2025, 2025, 2056, 2056, 2069, 2069,
+    2051, 2051, 1979, 1979, 1852, 1852, 1711, 1711, 1597, 1597, 1511, 1511,
+    1442, 1442, 1393, 1393, 1367, 1367, 1361, 1361, 1373, 1373, 1390, 1390,
+    1395, 1395, 1387, 1387, 1360, 1360, 1294, 1294, 1182, 1182, 1048, 1048,
+    909, 909, 749, 749, 560, 560, 372, 372, 212, 212, 77, 77,
+    -53, -53, -172, -172, -258, -258, -315, -315, -369, -369, -428, -428,
+    -489, -489, -575, -575, -710, -710, -862, -862, -981, -981, -1078, -1078,
+    -1205, -1205, -1352, -1352, -1471, -1471, -1564, -1564, -1673, -1673, -1796, -1796,
+    -1888, -1888, -1950, -1950, -2022, -2022, -2106, -2106, -2167, -2167, -2198, -2198,
+    -2221, -2221, -2239, -2239, -2244, -2244, -2258, -2258, -2302, -2302, -2356, -2356,
+    -2390, -2390, -2424, -2424, -2484, -2484, -2542, -2542, -2564, -2564, -2582, -2582,
+    -2635, -2635, -2679, -2679, -2655, -2655, -2598, -2598, -2586, -2586, -2604, -2604,
+    -2578, -2578, -2518, -2518, -2492, -2492, -2503, -2503, -2491, -2491, -2455, -2455,
+    -2448, -2448, -2495, -2495, -2578, -2578, -2661, -2661, -2695, -2695, -2649, -2649,
+    -2588, -2588, -2649, -2649, -2864, -2864, -3100, -3100, -3230, -3230, -3266, -3266,
+    -3221, -3221, -2962, -2962, -2375, -2375, -1592, -1592, -877, -877, -329, -329,
+    99, 99, 383, 383, 446, 446, 343, 343, 224, 224, 134, 134,
+    -1, -1, -217, -217, -465, -465, -687, -687, -829, -829, -807, -807,
+    -582, -582, -220, -220, 189, 189, 651, 651, 1185, 1185, 1676, 1676,
+    1968, 1968, 2072, 2072, 2113, 2113, 2098, 2098, 1950, 1950, 1728, 1728,
+    1593, 1593, 1573, 1573, 1562, 1562, 1532, 1532, 1551, 1551, 1611, 1611,
+    1611, 1611, 1528, 1528, 1458, 1458, 1462, 1462, 1494, 1494, 1521, 1521,
+    1579, 1579, 1662, 1662, 1690, 1690, 1659, 1659, 1685, 1685, 1805, 1805,
+    1908, 1908, 1917, 1917, 1900, 1900, 1894, 1894, 1798, 1798, 1530, 1530,
+    1160, 1160, 799, 799, 469, 469, 150, 150, -108, -108, -218, -218,
+    -175, -175, -48, -48, 113, 113, 293, 293, 452, 452, 537, 537,
+    535, 535, 459, 459, 305, 305, 81, 81, -159, -159, -392, -392,
+    -657, -657, -971, -971, -1265, -1265, -1471, -1471, -1605, -1605, -1701, -1701,
+    -1724, -1724, -1626, -1626, -1444, -1444, -1280, -1280, -1191, -1191, -1155, -1155,
+    -1144, -1144, -1166, -1166, -1214, -1214, -1252, -1252, -1246, -1246, -1201, -1201,
+    -1134, -1134, -1064, -1064, -1024, -1024, -1032, -1032, -1063, -1063, -1083, -1083,
+    -1094, -1094, -1107, -1107, -1084, -1084, -981, -981, -817, -817, -661, -661,
+    -532, -532, -388, -388, -196, -196, 28, 28, 254, 254, 480, 480,
+    702, 702, 886, 886, 987, 987, 1005, 1005, 974, 974, 921, 921,
+    848, 848, 780, 780, 751, 751, 778, 778, 848, 848, 955, 955,
+    1101, 1101, 1276, 1276, 1464, 1464, 1655, 1655, 1835, 1835, 1975, 1975,
+    2051, 2051, 2068, 2068, 2064, 2064, 2066, 2066, 2044, 2044, 1961, 1961,
+    1845, 1845, 1750, 1750, 1683, 1683, 1615, 1615, 1557, 1557, 1539, 1539,
+    1547, 1547, 1535, 1535, 1487, 1487, 1422, 1422, 1357, 1357, 1291, 1291,
+    1228, 1228, 1181, 1181, 1158, 1158, 1142, 1142, 1124, 1124, 1111, 1111,
+    1085, 1085, 1005, 1005, 875, 875, 751, 751, 646, 646, 514, 514,
+    343, 343, 187, 187, 79, 79, -1, -1, -69, -69, -104, -104,
+    -96, -96, -73, -73, -67, -67, -71, -71, -59, -59, -33, -33,
+    -31, -31, -72, -72, -127, -127, -170, -170, -200, -200, -224, -224,
+    -248, -248, -267, -267, -257, -257, -200, -200, -123, -123, -56, -56,
+    8, 8, 88, 88, 162, 162, 209, 209, 245, 245, 297, 297,
+    360, 360, 420, 420, 495, 495, 604, 604, 737, 737, 858, 858,
+    946, 946, 1002, 1002, 1029, 1029, 1022, 1022, 994, 994, 982, 982,
+    996, 996, 1022, 1022, 1060, 1060, 1120, 1120, 1188, 1188, 1247, 1247,
+    1311, 1311, 1398, 1398, 1493, 1493, 1564, 1564, 1613, 1613, 1652, 1652,
+    1669, 1669, 1643, 1643, 1588, 1588, 1527, 1527, 1463, 1463, 1386, 1386,
+    1315, 1315, 1280, 1280, 1272, 1272, 1245, 1245, 1185, 1185, 1128, 1128,
+    1097, 1097, 1060, 1060, 979, 979, 878, 878, 800, 800, 745, 745,
+    682, 682, 605, 605, 526, 526, 445, 445, 345, 345, 226, 226,
+    104, 104, -6, -6, -113, -113, -233, -233, -364, -364, -492, -492,
+    -616, -616, -749, -749, -889, -889, -1015, -1015, -1118, -1118, -1195, -1195,
+    -1250, -1250, -1305, -1305, -1376, -1376, -1452, -1452, -1518, -1518, -1601, -1601,
+    -1731, -1731, -1877, -1877, -1978, -1978, -2038, -2038, -2108, -2108, -2195, -2195,
+    -2240, -2240, -2230, -2230, -2233, -2233, -2306, -2306, -2402, -2402, -2458, -2458,
+    -2505, -2505, -2601, -2601, -2705, -2705, -2736, -2736, -2712, -2712, -2709, -2709,
+    -2725, -2725, -2713, -2713, -2681, -2681, -2671, -2671, -2681, -2681, -2683, -2683,
+    -2671, -2671, -2651, -2651, -2618, -2618, -2592, -2592, -2618, -2618, -2701, -2701,
+    -2773, -2773, -2792, -2792, -2815, -2815, -2898, -2898, -2981, -2981, -2990, -2990,
+    -3004, -3004, -3128, -3128, -3268, -3268, -3233, -3233, -2985, -2985, -2631, -2631,
+    -2198, -2198, -1635, -1635, -1006, -1006, -497, -497, -206, -206, -80, -80,
+    -45, -45, -104, -104, -256, -256, -424, -424, -547, -547, -645, -645,
+    -743, -743, -797, -797, -776, -776, -698, -698, -539, -539, -238, -238,
+    184, 184, 613, 613, 986, 986, 1309, 1309, 1549, 1549, 1627, 1627,
+    1558, 1558, 1464, 1464, 1430, 1430, 1430, 1430, 1434, 1434, 1478, 1478,
+    1583, 1583, 1675, 1675, 1682, 1682, 1642, 1642, 1623, 1623, 1604, 1604,
+    1546, 1546, 1499, 1499, 1529, 1529, 1607, 1607, 1669, 1669, 1728, 1728,
+    1834, 1834, 1973, 1973, 2086, 2086, 2158, 2158, 2220, 2220, 2267, 2267,
+    2243, 2243, 2124, 2124, 1937, 1937, 1702, 1702, 1416, 1416, 1099, 1099,
+    810, 810, 587, 587, 437, 437, 377, 377, 423, 423, 545, 545,
+    679, 679, 793, 793, 882, 882, 917, 917, 861, 861, 723, 723,
+    557, 557, 377, 377, 160, 160, -83, -83, -302, -302, -484, -484,
+    -671, -671, -873, -873, -1037, -1037, -1129, -1129, -1181, -1181, -1225, -1225,
+    -1244, -1244, -1227, -1227, -1207, -1207, -1219, -1219, -1255, -1255, -1281, -1281,
+    -1298, -1298, -1310, -1310, -1291, -1291, -1227, -1227, -1156, -1156, -1124, -1124,
+    -1132, -1132, -1173, -1173, -1259, -1259, -1382, -1382, -1499, -1499, -1585, -1585,
+    -1650, -1650, -1690, -1690, -1664, -1664, -1559, -1559, -1407, -1407, -1236, -1236,
+    -1028, -1028, -772, -772, -510, -510, -297, -297, -127, -127, 24, 24,
+    130, 130, 155, 155, 121, 121, 83, 83, 48, 48, 2, 2,
+    -37, -37, -23, -23, 59, 59, 194, 194, 364, 364, 552, 552,
+    746, 746, 933, 933, 1100, 1100, 1234, 1234, 1335, 1335, 1418, 1418,
+    1499, 1499, 1573, 1573, 1616, 1616, 1625, 1625, 1628, 1628, 1640, 1640,
+    1643, 1643, 1622, 1622, 1599, 1599, 1592, 1592, 1589, 1589, 1574, 1574,
+    1555, 1555, 1540, 1540, 1529, 1529, 1525, 1525, 1533, 1533, 1550, 1550,
+    1576, 1576, 1617, 1617, 1666, 1666, 1703, 1703, 1721, 1721, 1731, 1731,
+    1728, 1728, 1684, 1684, 1580, 1580, 1443, 1443, 1303, 1303, 1155, 1155,
+    988, 988, 834, 834, 738, 738, 695, 695, 676, 676, 678, 678,
+    713, 713, 757, 757, 768, 768, 747, 747, 725, 725, 698, 698,
+    640, 640, 558, 558, 485, 485, 422, 422, 347, 347, 259, 259,
+    184, 184, 133, 133, 95, 95, 67, 67, 58, 58, 71, 71,
+    91, 91, 102, 102, 100, 100, 86, 86, 69, 69, 69, 69,
+    101, 101, 156, 156, 221, 221, 295, 295, 373, 373, 424, 424,
+    426, 426, 397, 397, 366, 366, 335, 335, 299, 299, 268, 268,
+    262, 262, 284, 284, 317, 317, 339, 339, 351, 351, 378, 378,
+    436, 436, 514, 514, 581, 581, 636, 636, 702, 702, 767, 767,
+    789, 789, 755, 755, 707, 707, 681, 681, 663, 663, 627, 627,
+    595, 595, 601, 601, 617, 617, 590, 590, 527, 527, 478, 478,
+    451, 451, 416, 416, 377, 377, 365, 365, 375, 375, 372, 372,
+    345, 345, 316, 316, 288, 288, 252, 252, 208, 208, 161, 161,
+    105, 105, 29, 29, -57, -57, -134, -134, -212, -212, -310, -310,
+    -407, -407, -476, -476, -531, -531, -605, -605, -679, -679, -716, -716,
+    -730, -730, -762, -762, -808, -808, -842, -842, -881, -881, -960, -960,
+    -1065, -1065, -1150, -1150, -1201, -1201, -1243, -1243, -1292, -1292, -1330, -1330,
+    -1350, -1350, -1381, -1381, -1439, -1439, -1500, -1500, -1543, -1543, -1580, -1580,
+    -1620, -1620, -1660, -1660, -1700, -1700, -1745, -1745, -1783, -1783, -1799, -1799,
+    -1793, -1793, -1776, -1776, -1755, -1755, -1738, -1738, -1742, -1742, -1780, -1780,
+    -1839, -1839, -1893, -1893, -1929, -1929, -1961, -1961, -2001, -2001, -2045, -2045,
+    -2085, -2085, -2116, -2116, -2130, -2130, -2109, -2109, -2046, -2046, -1965, -1965,
+    -1909, -1909, -1920, -1920, -2004, -2004, -2126, -2126, -2232, -2232, -2267, -2267,
+    -2191, -2191, -1993, -1993, -1705, -1705, -1397, -1397, -1135, -1135, -952, -952,
+    -863, -863, -854, -854, -883, -883, -891, -891, -856, -856, -812, -812,
+    -792, -792, -801, -801, -843, -843, -932, -932, -1048, -1048, -1121, -1121,
+    -1092, -1092, -969, -969, -794, -794, -589, -589, -367, -367, -183, -183,
+    -91, -91, -74, -74, -67, -67, -36, -36, 15, 15, 86, 86,
+    188, 188, 298, 298, 371, 371, 382, 382, 350, 350, 290, 290,
+    215, 215, 160, 160, 163, 163, 223, 223, 300, 300, 374, 374,
+    454, 454, 543, 543, 617, 617, 676, 676, 757, 757, 877, 877,
+    1007, 1007, 1118, 1118, 1208, 1208, 1263, 1263, 1252, 1252, 1163, 1163,
+    1031, 1031, 907, 907, 802, 802, 710, 710, 651, 651, 653, 653,
+    699, 699, 743, 743, 779, 779, 821, 821, 860, 860, 870, 870,
+    857, 857, 847, 847, 839, 839, 814, 814, 772, 772, 732, 732,
+    694, 694, 632, 632, 541, 541, 448, 448, 368, 368, 282, 282,
+    195, 195, 149, 149, 153, 153, 161, 161, 136, 136, 92, 92,
+    43, 43, -27, -27, -112, -112, -166, -166, -157, -157, -103, -103,
+    -39, -39, 18, 18, 59, 59, 49, 49, -31, -31, -147, -147,
+    -253, -253, -338, -338, -406, -406, -433, -433, -414, -414, -391, -391,
+    -398, -398, -406, -406, -389, -389, -371, -371, -366, -366, -335, -335,
+    -247, -247, -140, -140, -71, -71, -38, -38, -11, -11, -2, -2,
+    -44, -44, -114, -114, -146, -146, -125, -125, -89, -89, -53, -53,
+    2, 2, 66, 66, 96, 96, 93, 93, 92, 92, 108, 108,
+    131, 131, 171, 171, 245, 245, 336, 336, 405, 405, 443, 443,
+    476, 476, 506, 506, 512, 512, 503, 503, 522, 522, 573, 573,
+    610, 610, 606, 606, 589, 589, 574, 574, 541, 541, 482, 482,
+    432, 432, 426, 426, 457, 457, 502, 502, 559, 559, 626, 626,
+    687, 687, 724, 724, 743, 743, 759, 759, 764, 764, 753, 753,
+    733, 733, 714, 714, 682, 682, 625, 625, 557, 557, 501, 501,
+    461, 461, 430, 430, 417, 417, 432, 432, 462, 462, 491, 491,
+    510, 510, 529, 529, 552, 552, 567, 567, 563, 563, 548, 548,
+    534, 534, 518, 518, 496, 496, 469, 469, 449, 449, 439, 439,
+    435, 435, 430, 430, 420, 420, 410, 410, 406, 406, 410, 410,
+    417, 417, 426, 426, 437, 437, 447, 447, 455, 455, 457, 457,
+    451, 451, 443, 443, 441, 441, 444, 444, 447, 447, 452, 452,
+    457, 457, 460, 460, 453, 453, 430, 430, 392, 392, 351, 351,
+    319, 319, 301, 301, 294, 294, 295, 295, 300, 300, 304, 304,
+    300, 300, 286, 286, 269, 269, 260, 260, 264, 264, 275, 275,
+    284, 284, 290, 290, 292, 292, 288, 288, 271, 271, 244, 244,
+    213, 213, 184, 184, 162, 162, 147, 147, 139, 139, 136, 136,
+    134, 134, 126, 126, 116, 116, 108, 108, 105, 105, 103, 103,
+    99, 99, 93, 93, 90, 90, 90, 90, 89, 89, 85, 85,
+    81, 81, 80, 80, 80, 80, 75, 75, 66, 66, 55, 55,
+    46, 46, 37, 37, 25, 25, 10, 10, -7, -7, -27, -27,
+    -49, -49, -66, -66, -77, -77, -83, -83, -85, -85, -79, -79,
+    -71, -71, -65, -65, -64, -64, -66, -66, -68, -68, -71, -71,
+    -75, -75, -82, -82, -89, -89, -101, -101, -116, -116, -131, -131,
+    -144, -144, -159, -159, -177, -177, -190, -190, -199, -199, -219, -219,
+    -251, -251, -280, -280, -296, -296, -310, -310, -330, -330, -342, -342,
+    -336, -336, -324, -324, -324, -324, -332, -332, -336, -336, -341, -341,
+    -363, -363, -400, -400, -435, -435, -462, -462, -489, -489, -517, -517,
+    -537, -537, -554, -554, -579, -579, -614, -614, -643, -643, -663, -663,
+    -681, -681, -692, -692, -686, -686, -672, -672, -672, -672, -691, -691,
+    -718, -718, -747, -747, -785, -785, -828, -828, -858, -858, -872, -872,
+    -886, -886, -914, -914, -945, -945, -972, -972, -1002, -1002, -1036, -1036,
+    -1057, -1057, -1061, -1061, -1063, -1063, -1069, -1069, -1072, -1072, -1068, -1068,
+    -1071, -1071, -1083, -1083, -1091, -1091, -1087, -1087, -1079, -1079, -1069, -1069,
+    -1050, -1050, -1018, -1018, -991, -991, -985, -985, -993, -993, -998, -998,
+    -1000, -1000, -1009, -1009, -1012, -1012, -994, -994, -962, -962, -934, -934,
+    -910, -910, -887, -887, -864, -864, -844, -844, -820, -820, -783, -783,
+    -736, -736, -692, -692, -656, -656, -621, -621, -589, -589, -567, -567,
+    -555, -555, -539, -539, -513, -513, -487, -487, -467, -467, -443, -443,
+    -409, -409, -377, -377, -355, -355, -339, -339, -319, -319, -292, -292,
+    -266, -266, -239, -239, -205, -205, -168, -168, -136, -136, -113, -113,
+    -96, -96, -82, -82, -70, -70, -53, -53, -28, -28, -1, -1,
+    19, 19, 37, 37, 59, 59, 78, 78, 84, 84, 83, 83,
+    94, 94, 118, 118, 144, 144, 166, 166, 195, 195, 232, 232,
+    268, 268, 297, 297, 325, 325, 355, 355, 381, 381, 401, 401,
+    422, 422, 449, 449, 477, 477, 501, 501, 522, 522, 542, 542,
+    558, 558, 576, 576, 605, 605, 642, 642, 674, 674, 703, 703,
+    736, 736, 770, 770, 794, 794, 810, 810, 833, 833, 861, 861,
+    885, 885, 903, 903, 918, 918, 935, 935, 946, 946, 949, 949,
+    952, 952, 964, 964, 977, 977, 986, 986, 993, 993, 999, 999,
+    1004, 1004, 1010, 1010, 1021, 1021, 1033, 1033, 1038, 1038, 1038, 1038,
+    1040, 1040, 1043, 1043, 1039, 1039, 1027, 1027, 1017, 1017, 1017, 1017,
+    1015, 1015, 1003, 1003, 982, 982, 960, 960, 942, 942, 926, 926,
+    912, 912, 903, 903, 904, 904, 908, 908, 902, 902, 884, 884,
+    860, 860, 838, 838, 819, 819, 799, 799, 778, 778, 763, 763,
+    754, 754, 742, 742, 721, 721, 695, 695, 667, 667, 637, 637,
+    608, 608, 582, 582, 555, 555, 529, 529, 508, 508, 494, 494,
+    478, 478, 455, 455, 430, 430, 412, 412, 397, 397, 381, 381,
+    365, 365, 353, 353, 341, 341, 322, 322, 298, 298, 277, 277,
+    258, 258, 234, 234, 210, 210, 194, 194, 185, 185, 173, 173,
+    159, 159, 151, 151, 149, 149, 147, 147, 141, 141, 135, 135,
+    133, 133, 129, 129, 119, 119, 109, 109, 101, 101, 94, 94,
+    88, 88, 83, 83, 76, 76, 67, 67, 55, 55, 45, 45,
+    38, 38, 31, 31, 27, 27, 29, 29, 33, 33, 31, 31,
+    27, 27, 25, 25, 26, 26, 24, 24, 17, 17, 14, 14,
+    16, 16, 20, 20, 17, 17, 7, 7, -3, -3, -12, -12,
+    -23, -23, -38, -38, -51, -51, -60, -60, -68, -68, -77, -77,
+    -87, -87, -98, -98, -107, -107, -115, -115, -123, -123, -126, -126,
+    -124, -124, -118, -118, -115, -115, -116, -116, -122, -122, -132, -132,
+    -144, -144, -156, -156, -168, -168, -179, -179, -189, -189, -196, -196,
+    -205, -205, -216, -216, -230, -230, -242, -242, -248, -248, -249, -249,
+    -247, -247, -244, -244, -243, -243, -245, -245, -247, -247, -245, -245,
+    -240, -240, -237, -237, -238, -238, -241, -241, -246, -246, -259, -259,
+    -276, -276, -290, -290, -298, -298, -303, -303, -312, -312, -324, -324,
+    -334, -334, -341, -341, -347, -347, -352, -352, -354, -354, -351, -351,
+    -351, -351, -355, -355, -363, -363, -372, -372, -380, -380, -390, -390,
+    -403, -403, -421, -421, -439, -439, -454, -454, -465, -465, -477, -477,
+    -490, -490, -504, -504, -515, -515, -527, -527, -541, -541, -555, -555,
+    -566, -566, -574, -574, -582, -582, -591, -591, -598, -598, -601, -601,
+    -603, -603, -609, -609, -620, -620, -633, -633, -646, -646, -659, -659,
+    -675, -675, -694, -694, -710, -710, -722, -722, -732, -732, -741, -741,
+    -747, -747, -747, -747, -745, -745, -743, -743, -740, -740, -737, -737,
+    -732, -732, -724, -724, -712, -712, -699, -699, -687, -687, -679, -679,
+    -673, -673, -664, -664, -653, -653, -642, -642, -626, -626, -604, -604,
+    -580, -580, -559, -559, -541, -541, -527, -527, -513, -513, -499, -499,
+    -481, -481, -460, -460, -437, -437, -412, -412, -382, -382, -351, -351,
+    -324, -324, -303, -303, -282, -282, -260, -260, -241, -241, -227, -227,
+    -213, -213, -195, -195, -178, -178, -166, -166, -157, -157, -147, -147,
+    -133, -133, -119, -119, -106, -106, -91, -91, -69, -69, -44, -44,
+    -22, -22, -6, -6, 6, 6, 20, 20, 35, 35, 44, 44,
+    47, 47, 52, 52, 61, 61, 69, 69, 74, 74, 79, 79,
+    86, 86, 96, 96, 106, 106, 115, 115, 125, 125, 138, 138,
+    151, 151, 161, 161, 171, 171, 185, 185, 199, 199, 212, 212,
+    222, 222, 232, 232, 245, 245, 259, 259, 269, 269, 275, 275,
+    281, 281, 291, 291, 299, 299, 306, 306, 315, 315, 330, 330,
+    344, 344, 355, 355, 366, 366, 383, 383, 402, 402, 416, 416,
+    426, 426, 440, 440, 455, 455, 468, 468, 478, 478, 489, 489,
+    500, 500, 506, 506, 507, 507, 511, 511, 516, 516, 520, 520,
+    525, 525, 534, 534, 542, 542, 547, 547, 550, 550, 556, 556,
+    565, 565, 568, 568, 568, 568, 572, 572, 580, 580, 585, 585,
+    586, 586, 587, 587, 591, 591, 592, 592, 589, 589, 582, 582,
+    576, 576, 568, 568, 560, 560, 556, 556, 556, 556, 556, 556,
+    553, 553, 552, 552, 553, 553, 553, 553, 550, 550, 547, 547,
+    549, 549, 551, 551, 549, 549, 546, 546, 545, 545, 546, 546,
+    543, 543, 537, 537, 534, 534, 535, 535, 534, 534, 523, 523,
+    510, 510, 502, 502, 501, 501, 498, 498, 491, 491, 484, 484,
+    478, 478, 469, 469, 457, 457, 448, 448, 444, 444, 443, 443,
+    441, 441, 438, 438, 433, 433, 422, 422, 406, 406, 391, 391,
+    381, 381, 369, 369, 355, 355, 344, 344, 338, 338, 329, 329,
+    315, 315, 301, 301, 291, 291, 282, 282, 269, 269, 256, 256,
+    247, 247, 238, 238, 225, 225, 213, 213, 203, 203, 192, 192,
+    178, 178, 164, 164, 153, 153, 141, 141, 125, 125, 109, 109,
+    101, 101, 95, 95, 85, 85, 72, 72, 61, 61, 51, 51,
+    37, 37, 21, 21, 11, 11, 5, 5, -2, -2, -14, -14,
+    -24, -24, -32, -32, -41, -41, -52, -52, -62, -62, -68, -68,
+    -76, -76, -87, -87, -99, -99, -107, -107, -113, -113, -119, -119,
+    -124, -124, -126, -126, -129, -129, -135, -135, -145, -145, -154, -154,
+    -158, -158, -162, -162, -167, -167, -171, -171, -174, -174, -175, -175,
+    -178, -178, -183, -183, -187, -187, -193, -193, -198, -198, -200, -200,
+    -199, -199, -201, -201, -207, -207, -213, -213, -219, -219, -225, -225,
+    -235, -235, -241, -241, -238, -238, -233, -233, -233, -233, -238, -238,
+    -241, -241, -242, -242, -245, -245, -253, -253, -258, -258, -257, -257,
+    -257, -257, -263, -263, -272, -272, -279, -279, -282, -282, -284, -284,
+    -287, -287, -292, -292, -299, -299, -306, -306, -312, -312, -319, -319,
+    -327, -327, -334, -334, -338, -338, -340, -340, -343, -343, -350, -350,
+    -359, -359, -366, -366, -374, -374, -384, -384, -394, -394, -401, -401,
+    -405, -405, -410, -410, -416, -416, -425, -425, -434, -434, -442, -442,
+    -450, -450, -457, -457, -463, -463, -467, -467, -470, -470, -473, -473,
+    -478, -478, -485, -485, -492, -492, -497, -497, -500, -500, -503, -503,
+    -506, -506, -506, -506, -504, -504, -505, -505, -512, -512, -518, -518,
+    -520, -520, -517, -517, -512, -512, -507, -507, -500, -500, -495, -495,
+    -494, -494, -492, -492, -484, -484, -474, -474, -468, -468, -466, -466,
+    -463, -463, -458, -458, -452, -452, -444, -444, -434, -434, -422, -422,
+    -413, -413, -402, -402, -390, -390, -378, -378, -368, -368, -358, -358,
+    -345, -345, -331, -331, -319, -319, -308, -308, -294, -294, -280, -280,
+    -270, -270, -260, -260, -244, -244, -226, -226, -213, -213, -202, -202,
+    -189, -189, -173, -173, -160, -160, -149, -149, -133, -133, -116, -116,
+    -102, -102, -93, -93, -82, -82, -69, -69, -54, -54, -39, -39,
+    -23, -23, -7, -7, 8, 8, 21, 21, 34, 34, 46, 46,
+    55, 55, 65, 65, 79, 79, 94, 94, 106, 106, 116, 116,
+    125, 125, 136, 136, 149, 149, 161, 161, 173, 173, 185, 185,
+    196, 196, 208, 208, 219, 219, 231, 231, 243, 243, 256, 256,
+    267, 267, 278, 278, 288, 288, 298, 298, 310, 310, 320, 320,
+    327, 327, 335, 335, 344, 344, 355, 355, 366, 366, 374, 374,
+    380, 380, 386, 386, 394, 394, 403, 403, 412, 412, 420, 420,
+    427, 427, 435, 435, 442, 442, 447, 447, 454, 454, 461, 461,
+    466, 466, 469, 469, 472, 472, 477, 477, 482, 482, 486, 486,
+    489, 489, 492, 492, 496, 496, 497, 497, 498, 498, 497, 497,
+    497, 497, 495, 495, 495, 495, 496, 496, 496, 496, 495, 495,
+    494, 494, 492, 492, 490, 490, 486, 486, 481, 481, 476, 476,
+    470, 470, 464, 464, 459, 459, 452, 452, 444, 444, 436, 436,
+    427, 427, 419, 419, 413, 413, 409, 409, 405, 405, 400, 400,
+    395, 395, 389, 389, 381, 381, 373, 373, 365, 365, 357, 357,
+    349, 349, 340, 340, 331, 331, 322, 322, 314, 314, 307, 307,
+    300, 300, 292, 292, 284, 284, 276, 276, 269, 269, 260, 260,
+    251, 251, 245, 245, 238, 238, 230, 230, 221, 221, 212, 212,
+    203, 203, 195, 195, 185, 185, 177, 177, 169, 169, 161, 161,
+    151, 151, 140, 140, 128, 128, 117, 117, 107, 107, 99, 99,
+    90, 90, 81, 81, 72, 72, 62, 62, 53, 53, 44, 44,
+    34, 34, 25, 25, 16, 16, 8, 8, -2, -2, -12, -12,
+    -22, -22, -30, -30, -38, -38, -48, -48, -55, -55, -62, -62,
+    -68, -68, -77, -77, -85, -85, -92, -92, -98, -98, -105, -105,
+    -111, -111, -118, -118, -126, -126, -133, -133, -142, -142, -148, -148,
+    -152, -152, -158, -158, -164, -164, -169, -169, -172, -172, -176, -176,
+    -182, -182, -186, -186, -189, -189, -193, -193, -198, -198, -201, -201,
+    -204, -204, -209, -209, -213, -213, -215, -215, -217, -217, -220, -220,
+    -223, -223, -224, -224, -225, -225, -225, -225, -225, -225, -224, -224,
+    -223, -223, -223, -223, -224, -224, -225, -225, -225, -225, -224, -224,
+    -222, -222, -223, -223, -224, -224, -224, -224, -222, -222, -220, -220,
+    -219, -219, -218, -218, -217, -217, -216, -216, -213, -213, -211, -211,
+    -210, -210, -210, -210, -209, -209, -209, -209, -208, -208, -207, -207,
+    -207, -207, -208, -208, -210, -210, -212, -212, -213, -213, -214, -214,
+    -216, -216, -218, -218, -220, -220, -222, -222, -223, -223, -224, -224,
+    -226, -226, -226, -226, -227, -227, -228, -228, -229, -229, -231, -231,
+    -232, -232, -233, -233, -235, -235, -237, -237, -239, -239, -241, -241,
+    -243, -243, -245, -245, -247, -247, -250, -250, -252, -252, -254, -254,
+    -254, -254, -255, -255, -255, -255, -255, -255, -254, -254, -254, -254,
+    -254, -254, -254, -254, -254, -254, -254, -254, -255, -255, -256, -256,
+    -256, -256, -255, -255, -253, -253, -252, -252, -251, -251, -251, -251,
+    -251, -251, -250, -250, -248, -248, -245, -245, -243, -243, -242, -242,
+    -238, -238, -233, -233, -230, -230, -227, -227, -223, -223, -219, -219,
+    -214, -214, -209, -209, -204, -204, -197, -197, -191, -191, -185, -185,
+    -179, -179, -173, -173, -166, -166, -160, -160, -154, -154, -146, -146,
+    -139, -139, -132, -132, -122, -122, -112, -112, -103, -103, -98, -98,
+    -93, -93, -84, -84, -74, -74, -65, -65, -55, -55, -46, -46,
+    -38, -38, -28, -28, -19, -19, -9, -9, -1, -1, 8, 8,
+    17, 17, 25, 25, 33, 33, 43, 43, 53, 53, 63, 63,
+    72, 72, 81, 81, 89, 89, 96, 96, 103, 103, 111, 111,
+    121, 121, 130, 130, 139, 139, 147, 147, 156, 156, 166, 166,
+    177, 177, 184, 184, 191, 191, 199, 199, 207, 207, 214, 214,
+    220, 220, 228, 228, 237, 237, 244, 244, 249, 249, 254, 254,
+    259, 259, 265, 265, 270, 270, 275, 275, 283, 283, 291, 291,
+    296, 296, 303, 303, 309, 309, 315, 315, 320, 320, 325, 325,
+    330, 330, 334, 334, 335, 335, 335, 335, 336, 336, 338, 338,
+    339, 339, 341, 341, 344, 344, 346, 346, 347, 347, 348, 348,
+    351, 351, 356, 356, 357, 357, 356, 356, 356, 356, 358, 358,
+    360, 360, 361, 361, 360, 360, 361, 361, 362, 362, 359, 359,
+    356, 356, 354, 354, 353, 353, 350, 350, 346, 346, 344, 344,
+    342, 342, 339, 339, 335, 335, 333, 333, 333, 333, 332, 332,
+    329, 329, 327, 327, 324, 324, 320, 320, 316, 316, 311, 311,
+    306, 306, 301, 301, 296, 296, 292, 292, 288, 288, 284, 284,
+    278, 278, 272, 272, 266, 266, 261, 261, 257, 257, 252, 252,
+    248, 248, 244, 244, 239, 239, 234, 234, 228, 228, 222, 222,
+    215, 215, 207, 207, 202, 202, 197, 197, 191, 191, 184, 184,
+    177, 177, 168, 168, 159, 159, 151, 151, 145, 145, 139, 139,
+    131, 131, 124, 124, 118, 118, 112, 112, 107, 107, 101, 101,
+    93, 93, 85, 85, 77, 77, 68, 68, 60, 60, 50, 50,
+    41, 41, 30, 30, 21, 21, 12, 12, 4, 4, -6, -6,
+    -15, -15, -22, -22, -27, -27, -35, -35, -43, -43, -50, -50,
+    -55, -55, -62, -62, -73, -73, -82, -82, -89, -89, -98, -98,
+    -107, -107, -115, -115, -122, -122, -128, -128, -136, -136, -145, -145,
+    -154, -154, -162, -162, -170, -170, -175, -175, -180, -180, -184, -184,
+    -188, -188, -192, -192, -196, -196, -200, -200, -207, -207, -214, -214,
+    -220, -220, -224, -224, -230, -230, -234, -234, -239, -239, -244, -244,
+    -250, -250, -257, -257, -261, -261, -263, -263, -263, -263, -264, -264,
+    -265, -265, -265, -265, -266, -266, -265, -265, -265, -265, -264, -264,
+    -264, -264, -264, -264, -264, -264, -265, -265, -265, -265, -265, -265,
+    -264, -264, -262, -262, -260, -260, -260, -260, -261, -261, -260, -260,
+    -255, -255, -247, -247, -241, -241, -239, -239, -239, -239, -238, -238,
+    -234, -234, -229, -229, -222, -222, -216, -216, -209, -209, -204, -204,
+    -203, -203, -203, -203, -198, -198, -193, -193, -189, -189, -185, -185,
+    -180, -180, -173, -173, -167, -167, -164, -164, -158, -158, -151, -151,
+    -146, -146, -141, -141, -136, -136, -131, -131, -126, -126, -123, -123,
+    -120, -120, -114, -114, -111, -111, -110, -110, -105, -105, -97, -97,
+    -91, -91, -86, -86, -82, -82, -75, -75, -69, -69, -64, -64,
+    -60, -60, -53, -53, -45, -45, -39, -39, -33, -33, -27, -27,
+    -21, -21, -16, -16, -12, -12, -8, -8, -5, -5, -2, -2,
+    2, 2, 8, 8, 15, 15, 21, 21, 28, 28, 34, 34,
+    38, 38, 39, 39, 42, 42, 47, 47, 52, 52, 56, 56,
+    60, 60, 65, 65, 67, 67, 68, 68, 72, 72, 79, 79,
+    82, 82, 84, 84, 86, 86, 89, 89, 89, 89, 85, 85,
+    86, 86, 92, 92, 99, 99, 101, 101, 102, 102, 105, 105,
+    105, 105, 104, 104, 103, 103, 105, 105, 108, 108, 107, 107,
+    105, 105, 102, 102, 99, 99, 97, 97, 97, 97, 97, 97,
+    94, 94, 88, 88, 85, 85, 85, 85, 85, 85, 82, 82,
+    79, 79, 77, 77, 76, 76, 75, 75, 75, 75, 73, 73,
+    67, 67, 61, 61, 59, 59, 60, 60, 61, 61, 57, 57,
+    51, 51, 47, 47, 45, 45, 41, 41, 36, 36, 34, 34,
+    34, 34, 35, 35, 33, 33, 27, 27, 22, 22, 21, 21,
+    20, 20, 17, 17, 12, 12, 11, 11, 12, 12, 12, 12,
+    9, 9, 7, 7, 7, 7, 6, 6, 1, 1, -2, -2,
+    -2, -2, 0, 0, 2, 2, 5, 5, 7, 7, 5, 5,
+    -3, -3, -11, -11, -13, -13, -8, -8, 0, 0, 3, 3,
+    -1, -1, -8, -8, -11, -11, -10, -10, -11, -11, -12, -12,
+    -10, -10, -4, -4, 0, 0, 0, 0, -4, -4, -7, -7,
+    -7, -7, -9, -9, -9, -9, -5, -5, 1, 1, 2, 2,
+    -3, -3, -8, -8, -6, -6, -2, -2, -1, -1, -2, -2,
+    -4, -4, -6, -6, -9, -9, -14, -14, -15, -15, -13, -13,
+    -12, -12, -11, -11, -13, -13, -17, -17, -23, -23, -30, -30,
+    -33, -33, -32, -32, -27, -27, -23, -23, -27, -27, -39, -39,
+    -49, -49, -50, -50, -45, -45, -43, -43, -47, -47, -51, -51,
+    -51, -51, -52, -52, -53, -53, -51, -51, -45, -45, -39, -39,
+    -35, -35, -34, -34, -33, -33, -31, -31, -23, -23, -12, -12,
+    -5, -5, -7, -7, -11, -11, -13, -13, -16, -16, -20, -20,
+    -18, -18, -6, -6, 9, 9, 22, 22, 36, 36, 49, 49,
+    53, 53, 55, 55, 78, 78, 123, 123, 163, 163, 169, 169,
+    136, 136, 70, 70, -17, -17, -83, -83, -64, -64, 82, 82,
+    319, 319, 549, 549, 666, 666, 610, 610, 396, 396, 123, 123,
+    -75, -75, -113, -113, 6, 6, 197, 197, 348, 348, 369, 369,
+    241, 241, 37, 37, -126, -126, -171, -171, -95, -95, 56, 56,
+    207, 207, 278, 278, 224, 224, 86, 86, -40, -40, -90, -90,
+    -68, -68, -5, -5, 75, 75, 137, 137, 133, 133, 55, 55,
+    -43, -43, -94, -94, -78, -78, -12, -12, 81, 81, 165, 165,
+    198, 198, 160, 160, 79, 79, -3, -3, -81, -81, -167, -167,
+    -244, -244, -268, -268, -225, -225, -164, -164, -145, -145, -176, -176,
+    -206, -206, -191, -191, -141, -141, -100, -100, -98, -98, -124, -124,
+    -144, -144, -129, -129, -75, -75, -8, -8, 36, 36, 25, 25,
+    -47, -47, -156, -156, -251, -251, -285, -285, -257, -257, -207, -207,
+    -172, -172, -148, -148, -126, -126, -127, -127, -172, -172, -236, -236,
+    -261, -261, -219, -219, -140, -140, -68, -68, -42, -42, -80, -80,
+    -167, -167, -241, -241, -235, -235, -158, -158, -80, -80, -55, -55,
+    -83, -83, -146, -146, -218, -218, -251, -251, -195, -195, -61, -61,
+    74, 74, 134, 134, 99, 99, 5, 5, -89, -89, -136, -136,
+    -126, -126, -80, -80, -16, -16, 49, 49, 78, 78, 27, 27,
+    -77, -77, -123, -123, -48, -48, 69, 69, 106, 106, 51, 51,
+    -1, -1, 7, 7, 51, 51, 110, 110, 184, 184, 253, 253,
+    272, 272, 239, 239, 208, 208, 221, 221, 245, 245, 222, 222,
+    144, 144, 52, 52, -14, -14, -38, -38, -14, -14, 56, 56,
+    143, 143, 190, 190, 150, 150, 41, 41, -54, -54, -66, -66,
+    -8, -8, 60, 60, 107, 107, 131, 131, 140, 140, 156, 156,
+    208, 208, 265, 265, 252, 252, 173, 173, 144, 144, 230, 230,
+    310, 310, 236, 236, 58, 58, -33, -33, 17, 17, 70, 70,
+    38, 38, 10, 10, 77, 77, 168, 168, 167, 167, 89, 89,
+    26, 26, 5, 5, -4, -4, 8, 8, 82, 82, 188, 188,
+    216, 216, 98, 98, -98, -98, -235, -235, -244, -244, -156, -156,
+    -35, -35, 80, 80, 156, 156, 154, 154, 78, 78, -5, -5,
+    -29, -29, -2, -2, 29, 29, 52, 52, 86, 86, 114, 114,
+    103, 103, 71, 71, 65, 65, 82, 82, 64, 64, -15, -15,
+    -117, -117, -197, -197, -217, -217, -139, -139, 23, 23, 158, 158,
+    151, 151, 27, 27, -71, -71, -63, -63, -1, -1, 39, 39,
+    51, 51, 60, 60, 60, 60, 46, 46, 50, 50, 113, 113,
+    213, 213, 239, 239, 88, 88, -190, -190, -381, -381, -315, -315,
+    -65, -65, 140, 140, 195, 195, 190, 190, 193, 193, 118, 118,
+    -86, -86, -267, -267, -238, -238, -24, -24, 189, 189, 276, 276,
+    236, 236, 94, 94, -106, -106, -249, -249, -238, -238, -104, -104,
+    32, 32, 110, 110, 131, 131, 64, 64, -109, -109, -267, -267,
+    -231, -231, 11, 11, 256, 256, 315, 315, 197, 197, 29, 29,
+    -112, -112, -195, -195, -161, -161, 22, 22, 249, 249, 320, 320,
+    157, 157, -102, -102, -250, -250, -205, -205, -35, -35, 136, 136,
+    207, 207, 144, 144, 3, 3, -105, -105, -111, -111, -53, -53,
+    5, 5, 77, 77, 190, 190, 259, 259, 166, 166, -48, -48,
+    -192, -192, -145, -145, 41, 41, 246, 246, 377, 377, 363, 363,
+    166, 166, -156, -156, -427, -427, -456, -456, -179, -179, 273, 273,
+    632, 632, 644, 644, 242, 242, -339, -339, -686, -686, -525, -525,
+    40, 40, 613, 613, 788, 788, 433, 433, -186, -186, -613, -613,
+    -595, -595, -247, -247, 177, 177, 488, 488, 540, 540, 253, 253,
+    -220, -220, -531, -531, -469, -469, -150, -150, 167, 167, 350, 350,
+    394, 394, 273, 273, -8, -8, -283, -283, -348, -348, -209, -209,
+    -9, -9, 196, 196, 378, 378, 384, 384, 125, 125, -206, -206,
+    -350, -350, -286, -286, -123, -123, 115, 115, 382, 382, 472, 472,
+    211, 211, -255, -255, -563, -563, -502, -502, -147, -147, 312, 312,
+    676, 676, 688, 688, 212, 212, -469, -469, -812, -812, -577, -577,
+    -19, -19, 465, 465, 634, 634, 426, 426, -35, -35, -449, -449,
+    -551, -551, -307, -307, 105, 105, 446, 446, 518, 518, 269, 269,
+    -133, -133, -408, -408, -402, -402, -190, -190, 71, 71, 299, 299,
+    418, 418, 301, 301, -47, -47, -350, -350, -349, -349, -119, -119,
+    105, 105, 239, 239, 292, 292, 191, 191, -77, -77, -306, -306,
+    -286, -286, -66, -66, 135, 135, 198, 198, 149, 149, 33, 33,
+    -116, -116, -206, -206, -138, -138, 61, 61, 246, 246, 301, 301,
+    194, 194, -45, -45, -290, -290, -331, -331, -93, -93, 222, 222,
+    339, 339, 198, 198, -53, -53, -240, -240, -255, -255, -64, -64,
+    229, 229, 393, 393, 274, 274, -32, -32, -257, -257, -245, -245,
+    -74, -74, 89, 89, 180, 180, 232, 232, 242, 242, 151, 151,
+    -48, -48, -252, -252, -329, -329, -227, -227, 12, 12, 287, 287,
+    459, 459, 385, 385, 48, 48, -342, -342, -480, -480, -243, -243,
+    189, 189, 491, 491, 460, 460, 151, 151, -185, -185, -296, -296,
+    -129, -129, 135, 135, 257, 257, 159, 159, -49, -49, -190, -190,
+    -152, -152, 41, 41, 216, 216, 196, 196, 20, 20, -85, -85,
+    -9, -9, 100, 100, 76, 76, -33, -33, -77, -77, -27, -27,
+    37, 37, 77, 77, 102, 102, 97, 97, 38, 38, -47, -47,
+    -111, -111, -139, -139, -96, -96, 66, 66, 261, 261, 278, 278,
+    61, 61, -156, -156, -142, -142, 43, 43, 192, 192, 224, 224,
+    170, 170, 49, 49, -98, -98, -161, -161, -78, -78, 86, 86,
+    232, 232, 319, 319, 305, 305, 141, 141, -95, -95, -174, -174,
+    16, 16, 294, 294, 409, 409, 344, 344, 244, 244, 169, 169,
+    100, 100, 90, 90, 219, 219, 441, 441, 616, 616, 646, 646,
+    531, 531, 346, 346, 230, 230, 290, 290, 490, 490, 661, 661,
+    654, 654, 469, 469, 228, 228, 89, 89, 149, 149, 377, 377,
+    598, 598, 618, 618, 414, 414, 138, 138, -56, -56, -111, -111,
+    -30, -30, 133, 133, 243, 243, 174, 174, -35, -35, -225, -225,
+    -292, -292, -247, -247, -125, -125, 29, 29, 138, 138, 124, 124,
+    -3, -3, -156, -156, -249, -249, -247, -247, -165, -165, -70, -70,
+    -47, -47, -111, -111, -183, -183, -205, -205, -215, -215, -243, -243,
+    -221, -221, -109, -109, -27, -27, -114, -114, -315, -315, -445, -445,
+    -411, -411, -275, -275, -145, -145, -79, -79, -72, -72, -86, -86,
+    -85, -85, -75, -75, -84, -84, -116, -116, -138, -138, -145, -145,
+    -174, -174, -215, -215, -186, -186, -55, -55, 71, 71, 71, 71,
+    -39, -39, -142, -142, -154, -154, -73, -73, 59, 59, 171, 171,
+    204, 204, 157, 157, 86, 86, 56, 56, 85, 85, 141, 141,
+    174, 174, 164, 164, 140, 140, 129, 129, 108, 108, 47, 47,
+    -15, -15, 5, 5, 118, 118, 212, 212, 190, 190, 84, 84,
+    -16, -16, -61, -61, -23, -23, 124, 124, 311, 311, 385, 385,
+    291, 291, 140, 140, 42, 42, -19, -19, -75, -75, -75, -75,
+    9, 9, 81, 81, 38, 38, -71, -71, -119, -119, -81, -81,
+    -18, -18, 45, 45, 95, 95, 76, 76, -28, -28, -113, -113,
+    -86, -86, -5, -5, 25, 25, 14, 14, 25, 25, 29, 29,
+    -46, -46, -161, -161, -189, -189, -91, -91, 17, 17, 15, 15,
+    -79, -79, -162, -162, -182, -182, -167, -167, -154, -154, -142, -142,
+    -111, -111, -73, -73, -66, -66, -78, -78, -43, -43, 51, 51,
+    107, 107, 50, 50, -54, -54, -92, -92, -70, -70, -68, -68,
+    -102, -102, -122, -122, -106, -106, -72, -72, -27, -27, 19, 19,
+    30, 30, -1, -1, -11, -11, 49, 49, 114, 114, 103, 103,
+    49, 49, 34, 34, 48, 48, 29, 29, -6, -6, -14, -14,
+    -32, -32, -95, -95, -119, -119, -23, -23, 112, 112, 136, 136,
+    46, 46, -31, -31, -53, -53, -86, -86, -145, -145, -142, -142,
+    -44, -44, 59, 59, 92, 92, 65, 65, 1, 1, -82, -82,
+    -119, -119, -36, -36, 121, 121, 215, 215, 170, 170, 15, 15,
+    -176, -176, -319, -319, -324, -324, -173, -173, 19, 19, 98, 98,
+    44, 44, -48, -48, -127, -127, -205, -205, -229, -229, -100, -100,
+    126, 126, 233, 233, 101, 101, -135, -135, -270, -270, -255, -255,
+    -163, -163, -55, -55, 40, 40, 78, 78, 31, 31, -54, -54,
+    -93, -93, -65, -65, -13, -13, 32, 32, 57, 57, 36, 36,
+    -35, -35, -102, -102, -121, -121, -119, -119, -121, -121, -77, -77,
+    47, 47, 165, 165, 161, 161, 46, 46, -59, -59, -79, -79,
+    -52, -52, -21, -21, 20, 20, 62, 62, 53, 53, -18, -18,
+    -96, -96, -140, -140, -147, -147, -89, -89, 56, 56, 197, 197,
+    196, 196, 66, 66, -30, -30, -11, -11, 18, 18, -39, -39,
+    -106, -106, -62, -62, 44, 44, 56, 56, -46, -46, -128, -128,
+    -92, -92, 13, 13, 97, 97, 116, 116, 69, 69, -19, -19,
+    -99, -99, -130, -130, -108, -108, -57, -57, 7, 7, 61, 61,
+    69, 69, 17, 17, -55, -55, -84, -84, -53, -53, 1, 1,
+    42, 42, 65, 65, 54, 54, -7, -7, -92, -92, -142, -142,
+    -126, -126, -76, -76, -46, -46, -54, -54, -73, -73, -62, -62,
+    -16, -16, 42, 42, 100, 100, 147, 147, 147, 147, 72, 72,
+    -33, -33, -85, -85, -61, -61, -21, -21, -11, -11, 0, 0,
+    52, 52, 94, 94, 56, 56, -29, -29, -51, -51, 13, 13,
+    65, 65, 40, 40, -9, -9, -10, -10, 26, 26, 40, 40,
+    16, 16, -8, -8, -12, -12, -18, -18, -42, -42, -57, -57,
+    -38, -38, 0, 0, 21, 21, 17, 17, -7, -7, -54, -54,
+    -120, -120, -174, -174, -179, -179, -134, -134, -70, -70, -19, -19,
+    18, 18, 37, 37, 19, 19, -27, -27, -59, -59, -55, -55,
+    -45, -45, -64, -64, -100, -100, -128, -128, -148, -148, -169, -169,
+    -176, -176, -149, -149, -94, -94, -48, -48, -55, -55, -114, -114,
+    -176, -176, -171, -171, -88, -88, 2, 2, 17, 17, -33, -33,
+    -69, -69, -63, -63, -66, -66, -92, -92, -90, -90, -44, -44,
+    -22, -22, -68, -68, -126, -126, -122, -122, -68, -68, -32, -32,
+    -40, -40, -65, -65, -85, -85, -100, -100, -101, -101, -75, -75,
+    -38, -38, -16, -16, -3, -3, 17, 17, 32, 32, 11, 11,
+    -41, -41, -95, -95, -122, -122, -111, -111, -69, -69, -22, -22,
+    -6, -6, -28, -28, -69, -69, -94, -94, -79, -79, -22, -22,
+    46, 46, 80, 80, 59, 59, 10, 10, -20, -20, -26, -26,
+    -35, -35, -42, -42, -14, -14, 44, 44, 64, 64, 3, 3,
+    -106, -106, -189, -189, -195, -195, -121, -121, -9, -9, 82, 82,
+    106, 106, 49, 49, -54, -54, -138, -138, -136, -136, -40, -40,
+    81, 81, 136, 136, 97, 97, 16, 16, -33, -33, -36, -36,
+    -21, -21, -3, -3, 16, 16, 15, 15, -29, -29, -94, -94,
+    -131, -131, -118, -118, -73, -73, -16, -16, 33, 33, 44, 44,
+    -3, -3, -74, -74, -96, -96, -38, -38, 39, 39, 60, 60,
+    24, 24, -10, -10, -18, -18, -34, -34, -83, -83, -128, -128,
+    -119, -119, -64, -64, -22, -22, -33, -33, -76, -76, -108, -108,
+    -105, -105, -68, -68, -10, -10, 44, 44, 75, 75, 82, 82,
+    68, 68, 30, 30, -19, -19, -37, -37, -9, -9, 14, 14,
+    -29, -29, -115, -115, -159, -159, -124, -124, -59, -59, -21, -21,
+    -9, -9, -8, -8, -36, -36, -92, -92, -119, -119, -64, -64,
+    38, 38, 110, 110, 117, 117, 87, 87, 44, 44, -14, -14,
+    -81, -81, -117, -117, -92, -92, -29, -29, 7, 7, -21, -21,
+    -85, -85, -124, -124, -106, -106, -50, -50, 5, 5, 48, 48,
+    82, 82, 87, 87, 34, 34, -52, -52, -95, -95, -48, -48,
+    53, 53, 123, 123, 103, 103, -4, -4, -132, -132, -191, -191,
+    -128, -128, 18, 18, 140, 140, 161, 161, 97, 97, 7, 7,
+    -78, -78, -138, -138, -133, -133, -43, -43, 73, 73, 116, 116,
+    56, 56, -40, -40, -97, -97, -89, -89, -35, -35, 41, 41,
+    110, 110, 138, 138, 107, 107, 32, 32, -53, -53, -107, -107,
+    -95, -95, -14, -14, 76, 76, 97, 97, 35, 35, -44, -44,
+    -67, -67, -18, -18, 76, 76, 168, 168, 203, 203, 147, 147,
+    31, 31, -69, -69, -100, -100, -72, -72, -19, -19, 37, 37,
+    73, 73, 58, 58, -6, -6, -62, -62, -63, -63, -15, -15,
+    41, 41, 82, 82, 96, 96, 78, 78, 42, 42, 14, 14,
+    1, 1, -1, -1, 12, 12, 54, 54, 101, 101, 108, 108,
+    73, 73, 39, 39, 22, 22, -1, -1, -28, -28, -23, -23,
+    15, 15, 27, 27, -4, -4, -29, -29, -14, -14, 12, 12,
+    34, 34, 89, 89, 176, 176, 214, 214, 149, 149, 40, 40,
+    -16, -16, -12, -12, 3, 3, 16, 16, 36, 36, 40, 40,
+    -4, -4, -69, -69, -91, -91, -52, -52, 17, 17, 87, 87,
+    133, 133, 121, 121, 34, 34, -80, -80, -144, -144, -122, -122,
+    -44, -44, 39, 39, 81, 81, 61, 61, 7, 7, -26, -26,
+    -11, -11, 20, 20, 29, 29, 21, 21, 10, 10, -20, -20,
+    -76, -76, -122, -122, -113, -113, -62, -62, -23, -23, -18, -18,
+    -26, -26, -23, -23, -2, -2, 29, 29, 56, 56, 64, 64,
+    57, 57, 49, 49, 43, 43, 17, 17, -29, -29, -52, -52,
+    -30, -30, 3, 3, -2, -2, -29, -29, -24, -24, 27, 27,
+    72, 72, 72, 72, 40, 40, 9, 9, -11, -11, -21, -21,
+    -7, -7, 38, 38, 85, 85, 93, 93, 51, 51, -14, -14,
+    -68, -68, -91, -91, -76, -76, -28, -28, 31, 31, 60, 60,
+    37, 37, -24, -24, -76, -76, -77, -77, -24, -24, 52, 52,
+    112, 112, 132, 132, 105, 105, 47, 47, -5, -5, -13, -13,
+    30, 30, 84, 84, 97, 97, 57, 57, 0, 0, -38, -38,
+    -47, -47, -35, -35, -12, -12, 6, 6, 5, 5, -6, -6,
+    -5, -5, 5, 5, -4, -4, -37, -37, -54, -54, -25, -25,
+    20, 20, 30, 30, 2, 2, -22, -22, -14, -14, 22, 22,
+    64, 64, 96, 96, 101, 101, 74, 74, 35, 35, 3, 3,
+    -17, -17, -23, -23, -7, -7, 31, 31, 71, 71, 98, 98,
+    111, 111, 112, 112, 90, 90, 59, 59, 60, 60, 108, 108,
+    159, 159, 163, 163, 131, 131, 99, 99, 71, 71, 36, 36,
+    21, 21, 54, 54, 105, 105, 114, 114, 68, 68, 18, 18,
+    3, 3, 9, 9, 15, 15, 28, 28, 52, 52, 66, 66,
+    47, 47, 3, 3, -27, -27, -12, -12, 54, 54, 132, 132,
+    170, 170, 145, 145, 80, 80, 19, 19, -15, -15, -19, -19,
+    1, 1, 23, 23, 21, 21, -10, -10, -40, -40, -45, -45,
+    -32, -32, -17, -17, -1, -1, 20, 20, 38, 38, 38, 38,
+    27, 27, 19, 19, 18, 18, 23, 23, 30, 30, 29, 29,
+    7, 7, -35, -35, -70, -70, -81, -81, -72, -72, -53, -53,
+    -28, -28, -8, -8, -22, -22, -74, -74, -123, -123, -114, -114,
+    -40, -40, 47, 47, 98, 98, 99, 99, 71, 71, 43, 43,
+    29, 29, 28, 28, 33, 33, 35, 35, 28, 28, 16, 16,
+    6, 6, -1, -1, -8, -8, -19, -19, -22, -22, -9, -9,
+    13, 13, 31, 31, 46, 46, 64, 64, 80, 80, 85, 85,
+    91, 91, 110, 110, 130, 130, 128, 128, 106, 106, 88, 88,
+    80, 80, 67, 67, 50, 50, 47, 47, 53, 53, 41, 41,
+    12, 12, 0, 0, 17, 17, 35, 35, 34, 34, 26, 26,
+    31, 31, 41, 41, 53, 53, 73, 73, 98, 98, 105, 105,
+    83, 83, 52, 52, 29, 29, 5, 5, -20, -20, -25, -25,
+    -3, -3, 24, 24, 28, 28, 11, 11, 3, 3, 22, 22,
+    62, 62, 102, 102, 122, 122, 120, 120, 117, 117, 128, 128,
+    144, 144, 151, 151, 150, 150, 152, 152, 147, 147, 123, 123,
+    85, 85, 53, 53, 32, 32, 21, 21, 22, 22, 30, 30,
+    27, 27, 7, 7, -9, -9, 5, 5, 39, 39, 70, 70,
+    96, 96, 122, 122, 139, 139, 129, 129, 99, 99, 70, 70,
+    44, 44, 8, 8, -37, -37, -67, -67, -72, -72, -61, -61,
+    -47, -47, -29, -29, -5, -5, 19, 19, 42, 42, 68, 68,
+    97, 97, 122, 122, 134, 134, 128, 128, 107, 107, 80, 80,
+    61, 61, 55, 55, 55, 55, 56, 56, 56, 56, 55, 55,
+    52, 52, 45, 45, 38, 38, 33, 33, 31, 31, 38, 38,
+    50, 50, 56, 56, 55, 55, 61, 61, 87, 87, 121, 121,
+    145, 145, 152, 152, 146, 146, 121, 121, 74, 74, 25, 25,
+    -3, -3, -12, -12, -26, -26, -54, -54, -82, -82, -92, -92,
+    -85, -85, -66, -66, -28, -28, 23, 23, 65, 65, 76, 76,
+    59, 59, 45, 45, 49, 49, 54, 54, 35, 35, -4, -4,
+    -36, -36, -46, -46, -43, -43, -41, -41, -38, -38, -32, -32,
+    -37, -37, -59, -59, -89, -89, -109, -109, -112, -112, -97, -97,
+    -64, -64, -24, -24, -3, -3, -12, -12, -25, -25, -14, -14,
+    13, 13, 24, 24, 11, 11, -9, -9, -27, -27, -51, -51,
+    -81, -81, -104, -104, -115, -115, -122, -122, -127, -127, -124, -124,
+    -113, -113, -98, -98, -78, -78, -46, -46, 1, 1, 56, 56,
+    101, 101, 118, 118, 108, 108, 82, 82, 53, 53, 22, 22,
+    -12, -12, -32, -32, -22, -22, 1, 1, 5, 5, -15, -15,
+    -32, -32, -32, -32, -34, -34, -45, -45, -37, -37, 4, 4,
+    54, 54, 82, 82, 89, 89, 95, 95, 102, 102, 98, 98,
+    81, 81, 71, 71, 74, 74, 80, 80, 75, 75, 59, 59,
+    39, 39, 12, 12, -23, -23, -54, -54, -58, -58, -26, -26,
+    17, 17, 39, 39, 36, 36, 39, 39, 68, 68, 106, 106,
+    127, 127, 134, 134, 136, 136, 119, 119, 78, 78, 37, 37,
+    25, 25, 39, 39, 49, 49, 42, 42, 28, 28, 10, 10,
+    -18, -18, -46, -46, -43, -43, 3, 3, 66, 66, 107, 107,
+    117, 117, 108, 108, 103, 103, 120, 120, 153, 153, 177, 177,
+    176, 176, 164, 164, 160, 160, 156, 156, 132, 132, 87, 87,
+    41, 41, 3, 3, -32, -32, -63, -63, -69, -69, -38, -38,
+    13, 13, 53, 53, 77, 77, 99, 99, 122, 122, 141, 141,
+    153, 153, 160, 160, 159, 159, 141, 141, 105, 105, 64, 64,
+    36, 36, 20, 20, 3, 3, -14, -14, -23, -23, -25, -25,
+    -26, -26, -20, -20, 12, 12, 69, 69, 119, 119, 132, 132,
+    117, 117, 96, 96, 71, 71, 39, 39, 16, 16, 37, 37,
+    93, 93, 134, 134, 122, 122, 73, 73, 23, 23, -16, -16,
+    -47, -47, -58, -58, -35, -35, 3, 3, 15, 15, -3, -3,
+    -22, -22, -15, -15, 14, 14, 50, 50, 81, 81, 99, 99,
+    89, 89, 58, 58, 31, 31, 22, 22, 26, 26, 29, 29,
+    26, 26, 12, 12, -18, -18, -52, -52, -59, -59, -37, -37,
+    -18, -18, -22, -22, -25, -25, -1, -1, 27, 27, 27, 27,
+    8, 8, 8, 8, 28, 28, 37, 37, 25, 25, 16, 16,
+    20, 20, 22, 22, 7, 7, -10, -10, -18, -18, -31, -31,
+    -50, -50, -58, -58, -45, -45, -28, -28, -22, -22, -22, -22,
+    -20, -20, -19, -19, -19, -19, -3, -3, 30, 30, 52, 52,
+    46, 46, 29, 29, 26, 26, 38, 38, 44, 44, 38, 38,
+    29, 29, 17, 17, -9, -9, -38, -38, -45, -45, -26, -26,
+    0, 0, 17, 17, 27, 27, 34, 34, 32, 32, 12, 12,
+    -13, -13, -19, -19, 0, 0, 20, 20, 13, 13, -18, -18,
+    -49, -49, -65, -65, -69, -69, -65, -65, -57, -57, -54, -54,
+    -62, -62, -76, -76, -79, -79, -61, -61, -37, -37, -26, -26,
+    -29, -29, -33, -33, -32, -32, -26, -26, -11, -11, 16, 16,
+    38, 38, 40, 40, 21, 21, -3, -3, -16, -16, -19, -19,
+    -20, -20, -25, -25, -31, -31, -30, -30, -23, -23, -16, -16,
+    -16, -16, -16, -16, -5, -5, 16, 16, 31, 31, 31, 31,
+    18, 18, 4, 4, -5, -5, -11, -11, -17, -17, -28, -28,
+    -47, -47, -67, -67, -78, -78, -73, -73, -60, -60, -47, -47,
+    -37, -37, -35, -35, -38, -38, -36, -36, -19, -19, 4, 4,
+    15, 15, 16, 16, 15, 15, 11, 11, 4, 4, -1, -1,
+    6, 6, 19, 19, 19, 19, -3, -3, -27, -27, -36, -36,
+    -40, -40, -45, -45, -42, -42, -22, -22, 0, 0, 2, 2,
+    -12, -12, -21, -21, -13, -13, 4, 4, 23, 23, 40, 40,
+    55, 55, 57, 57, 41, 41, 20, 20, 10, 10, 7, 7,
+    -6, -6, -29, -29, -45, -45, -45, -45, -41, -41, -47, -47,
+    -54, -54, -48, -48, -33, -33, -26, -26, -33, -33, -36, -36,
+    -26, -26, -11, -11, -3, -3, -4, -4, -9, -9, -21, -21,
+    -38, -38, -48, -48, -46, -46, -40, -40, -36, -36, -36, -36,
+    -39, -39, -45, -45, -52, -52, -51, -51, -43, -43, -37, -37,
+    -39, -39, -43, -43, -36, -36, -19, -19, 0, 0, 19, 19,
+    41, 41, 61, 61, 66, 66, 57, 57, 43, 43, 30, 30,
+    21, 21, 15, 15, 12, 12, 8, 8, 2, 2, -5, -5,
+    -3, -3, 8, 8, 19, 19, 24, 24, 27, 27, 34, 34,
+    44, 44, 50, 50, 52, 52, 53, 53, 53, 53, 48, 48,
+    38, 38, 24, 24, 11, 11, -2, -2, -14, -14, -25, -25,
+    -36, -36, -47, -47, -52, -52, -54, -54, -56, -56, -61, -61,
+    -59, -59, -44, -44, -18, -18, 8, 8, 25, 25, 37, 37,
+    47, 47, 54, 54, 57, 57, 55, 55, 45, 45, 28, 28,
+    8, 8, -5, -5, -12, -12, -17, -17, -25, -25, -29, -29,
+    -23, -23, -7, -7, 15, 15, 38, 38, 57, 57, 69, 69,
+    69, 69, 60, 60, 49, 49, 44, 44, 39, 39, 33, 33,
+    29, 29, 30, 30, 35, 35, 37, 37, 30, 30, 17, 17,
+    8, 8, 1, 1, -7, -7, -17, -17, -22, -22, -16, -16,
+    -3, -3, 11, 11, 22, 22, 32, 32, 42, 42, 59, 59,
+    83, 83, 100, 100, 100, 100, 85, 85, 66, 66, 44, 44,
+    18, 18, -4, -4, -12, -12, -4, -4, 8, 8, 17, 17,
+    28, 28, 47, 47, 63, 63, 72, 72, 81, 81, 92, 92,
+    90, 90, 63, 63, 28, 28, 6, 6, -3, -3, -8, -8,
+    -11, -11, -10, -10, -6, -6, -10, -10, -18, -18, -14, -14,
+    6, 6, 28, 28, 40, 40, 36, 36, 24, 24, 13, 13,
+    8, 8, 10, 10, 19, 19, 29, 29, 41, 41, 54, 54,
+    61, 61, 53, 53, 33, 33, 12, 12, 0, 0, 2, 2,
+    8, 8, 9, 9, 3, 3, 1, 1, 10, 10, 23, 23,
+    41, 41, 61, 61, 79, 79, 87, 87, 82, 82, 75, 75,
+    79, 79, 89, 89, 88, 88, 72, 72, 49, 49, 26, 26,
+    0, 0, -23, -23, -30, -30, -19, -19, 0, 0, 21, 21,
+    36, 36, 40, 40, 31, 31, 21, 21, 23, 23, 34, 34,
+    43, 43, 48, 48, 50, 50, 43, 43, 27, 27, 12, 12,
+    9, 9, 7, 7, -9, -9, -38, -38, -61, -61, -74, -74,
+    -83, -83, -89, -89, -89, -89, -87, -87, -87, -87, -81, -81,
+    -63, -63, -43, -43, -37, -37, -37, -37, -29, -29, -14, -14,
+    -9, -9, -17, -17, -29, -29, -48, -48, -78, -78, -107, -107,
+    -115, -115, -97, -97, -79, -79, -74, -74, -70, -70, -56, -56,
+    -39, -39, -27, -27, -20, -20, -12, -12, -4, -4, 8, 8,
+    22, 22, 29, 29, 20, 20, -1, -1, -17, -17, -27, -27,
+    -41, -41, -59, -59, -69, -69, -64, -64, -58, -58, -66, -66,
+    -78, -78, -80, -80, -74, -74, -68, -68, -60, -60, -43, -43,
+    -27, -27, -23, -23, -32, -32, -36, -36, -27, -27, -12, -12,
+    3, 3, 18, 18, 28, 28, 18, 18, -12, -12, -38, -38,
+    -40, -40, -26, -26, -23, -23, -34, -34, -51, -51, -68, -68,
+    -86, -86, -97, -97, -87, -87, -63, -63, -46, -46, -44, -44,
+    -47, -47, -46, -46, -44, -44, -41, -41, -31, -31, -21, -21,
+    -23, -23, -39, -39, -54, -54, -59, -59, -61, -61, -66, -66,
+    -69, -69, -65, -65, -65, -65, -75, -75, -82, -82, -74, -74,
+    -60, -60, -54, -54, -55, -55, -51, -51, -41, -41, -37, -37,
+    -39, -39, -38, -38, -30, -30, -20, -20, -19, -19, -28, -28,
+    -40, -40, -46, -46, -43, -43, -34, -34, -24, -24, -18, -18,
+    -17, -17, -13, -13, 0, 0, 22, 22, 38, 38, 35, 35,
+    16, 16, -1, -1, 1, 1, 15, 15, 22, 22, 16, 16,
+    3, 3, -9, -9, -18, -18, -23, -23, -28, -28, -38, -38,
+    -55, -55, -68, -68, -65, -65, -49, -49, -36, -36, -36, -36,
+    -45, -45, -49, -49, -46, -46, -45, -45, -48, -48, -49, -49,
+    -42, -42, -30, -30, -18, -18, -7, -7, 0, 0, -1, -1,
+    -8, -8, -14, -14, -12, -12, -1, -1, 9, 9, 9, 9,
+    1, 1, -12, -12, -30, -30, -48, -48, -55, -55, -51, -51,
+    -48, -48, -46, -46, -38, -38, -23, -23, -9, -9, 0, 0,
+    9, 9, 20, 20, 23, 23, 7, 7, -15, -15, -28, -28,
+    -28, -28, -26, -26, -28, -28, -27, -27, -25, -25, -32, -32,
+    -48, -48, -57, -57, -46, -46, -25, -25, -5, -5, 4, 4,
+    3, 3, -2, -2, 0, 0, 6, 6, 10, 10, 8, 8,
+    1, 1, -6, -6, -7, -7, -2, -2, 6, 6, 14, 14,
+    19, 19, 16, 16, 9, 9, -1, -1, -14, -14, -29, -29,
+    -32, -32, -16, -16, 3, 3, 7, 7, 0, 0, -5, -5,
+    -4, -4, -2, -2, -4, -4, -11, -11, -22, -22, -33, -33,
+    -39, -39, -40, -40, -42, -42, -49, -49, -59, -59, -66, -66,
+    -66, -66, -63, -63, -58, -58, -50, -50, -43, -43, -40, -40,
+    -43, -43, -49, -49, -57, -57, -61, -61, -52, -52, -33, -33,
+    -12, -12, 6, 6, 18, 18, 23, 23, 20, 20, 15, 15,
+    17, 17, 24, 24, 27, 27, 19, 19, 6, 6, 0, 0,
+    7, 7, 18, 18, 25, 25, 26, 26, 23, 23, 19, 19,
+    17, 17, 16, 16, 16, 16, 20, 20, 28, 28, 38, 38,
+    44, 44, 41, 41, 30, 30, 16, 16, 11, 11, 21, 21,
+    39, 39, 46, 46, 35, 35, 14, 14, -8, -8, -26, -26,
+    -37, -37, -39, -39, -29, -29, -15, -15, -5, -5, 2, 2,
+    9, 9, 16, 16, 15, 15, 2, 2, -16, -16, -31, -31,
+    -40, -40, -43, -43, -43, -43, -45, -45, -48, -48, -48, -48,
+    -45, -45, -44, -44, -44, -44, -41, -41, -35, -35, -32, -32,
+    -30, -30, -26, -26, -20, -20, -20, -20, -30, -30, -41, -41,
+    -42, -42, -38, -38, -37, -37, -41, -41, -41, -41, -32, -32,
+    -24, -24, -25, -25, -40, -40, -62, -62, -83, -83, -91, -91,
+    -83, -83, -68, -68, -56, -56, -50, -50, -45, -45, -35, -35,
+    -21, -21, -7, -7, 4, 4, 10, 10, 10, 10, 4, 4,
+    -7, -7, -18, -18, -26, -26, -29, -29, -29, -29, -28, -28,
+    -27, -27, -25, -25, -23, -23, -19, -19, -12, -12, -4, -4,
+    -1, -1, -2, -2, -9, -9, -19, -19, -27, -27, -28, -28,
+    -20, -20, -7, -7, 3, 3, 4, 4, -5, -5, -21, -21,
+    -34, -34, -38, -38, -37, -37, -40, -40, -52, -52, -64, -64,
+    -65, -65, -58, -58, -49, -49, -40, -40, -30, -30, -19, -19,
+    -12, -12, -11, -11, -15, -15, -27, -27, -49, -49, -74, -74,
+    -91, -91, -97, -97, -103, -103, -116, -116, -125, -125, -121, -121,
+    -107, -107, -92, -92, -82, -82, -77, -77, -76, -76, -77, -77,
+    -80, -80, -83, -83, -87, -87, -95, -95, -103, -103, -104, -104,
+    -96, -96, -88, -88, -90, -90, -101, -101, -109, -109, -103, -103,
+    -90, -90, -83, -83, -88, -88, -100, -100, -109, -109, -111, -111,
+    -109, -109, -101, -101, -90, -90, -76, -76, -61, -61, -42, -42,
+    -17, -17, 7, 7, 21, 21, 25, 25, 20, 20, 12, 12,
+    2, 2, -5, -5, -9, -9, -7, -7, -2, -2, 2, 2,
+    5, 5, 10, 10, 17, 17, 19, 19, 14, 14, 7, 7,
+    8, 8, 19, 19, 32, 32, 35, 35, 28, 28, 17, 17,
+    6, 6, -11, -11, -29, -29, -41, -41, -44, -44, -44, -44,
+    -45, -45, -43, -43, -36, -36, -31, -31, -33, -33, -38, -38,
+    -40, -40, -39, -39, -42, -42, -47, -47, -47, -47, -38, -38,
+    -25, -25, -16, -16, -17, -17, -27, -27, -40, -40, -46, -46,
+    -40, -40, -26, -26, -13, -13, -3, -3, 6, 6, 14, 14,
+    18, 18, 13, 13, 6, 6, 0, 0, -6, -6, -16, -16,
+    -31, -31, -44, -44, -49, -49, -52, -52, -57, -57, -62, -62,
+    -66, -66, -65, -65, -55, -55, -38, -38, -20, -20, -4, -4,
+    5, 5, 12, 12, 13, 13, 5, 5, -16, -16, -39, -39,
+    -49, -49, -45, -45, -37, -37, -34, -34, -34, -34, -34, -34,
+    -31, -31, -21, -21, -4, -4, 14, 14, 20, 20, 18, 18,
+    19, 19, 28, 28, 41, 41, 51, 51, 58, 58, 58, 58,
+    48, 48, 28, 28, 17, 17, 27, 27, 48, 48, 64, 64,
+    71, 71, 72, 72, 66, 66, 47, 47, 24, 24, 10, 10,
+    13, 13, 23, 23, 31, 31, 34, 34, 36, 36, 38, 38,
+    41, 41, 44, 44, 43, 43, 36, 36, 23, 23, 9, 9,
+    -3, -3, -9, -9, -15, -15, -25, -25, -42, -42, -59, -59,
+    -73, -73, -82, -82, -86, -86, -79, -79, -58, -58, -33, -33,
+    -20, -20, -27, -27, -48, -48, -75, -75, -99, -99, -113, -113,
+    -115, -115, -104, -104, -88, -88, -74, -74, -63, -63, -51, -51,
+    -41, -41, -33, -33, -29, -29, -31, -31, -42, -42, -61, -61,
+    -79, -79, -82, -82, -72, -72, -60, -60, -54, -54, -57, -57,
+    -60, -60, -55, -55, -41, -41, -24, -24, -11, -11, -6, -6,
+    -5, -5, -7, -7, -16, -16, -25, -25, -29, -29, -28, -28,
+    -26, -26, -23, -23, -14, -14, -1, -1, 9, 9, 14, 14,
+    19, 19, 23, 23, 22, 22, 15, 15, 9, 9, 8, 8,
+    13, 13, 19, 19, 21, 21, 13, 13, 1, 1, -8, -8,
+    -12, -12, -14, -14, -18, -18, -26, -26, -33, -33, -38, -38,
+    -42, -42, -43, -43, -38, -38, -26, -26, -16, -16, -12, -12,
+    -14, -14, -17, -17, -20, -20, -23, -23, -28, -28, -36, -36,
+    -50, -50, -68, -68, -82, -82, -88, -88, -86, -86, -82, -82,
+    -79, -79, -72, -72, -58, -58, -44, -44, -37, -37, -37, -37,
+    -35, -35, -31, -31, -25, -25, -23, -23, -24, -24, -25, -25,
+    -28, -28, -31, -31, -33, -33, -31, -31, -30, -30, -31, -31,
+    -31, -31, -27, -27, -24, -24, -29, -29, -42, -42, -57, -57,
+    -66, -66, -71, -71, -75, -75, -76, -76, -69, -69, -56, -56,
+    -41, -41, -29, -29, -20, -20, -13, -13, -12, -12, -23, -23,
+    -43, -43, -64, -64, -81, -81, -92, -92, -89, -89, -73, -73,
+    -50, -50, -30, -30, -20, -20, -16, -16, -9, -9, -1, -1,
+    7, 7, 11, 11, 16, 16, 15, 15, 5, 5, -11, -11,
+    -22, -22, -25, -25, -25, -25, -23, -23, -20, -20, -21, -21,
+    -29, -29, -39, -39, -42, -42, -39, -39, -35, -35, -34, -34,
+    -33, -33, -32, -32, -31, -31, -26, -26, -14, -14, 1, 1,
+    9, 9, 11, 11, 11, 11, 11, 11, 3, 3, -12, -12,
+    -25, -25, -34, -34, -41, -41, -47, -47, -49, -49, -46, -46,
+    -46, -46, -49, -49, -55, -55, -56, -56, -52, -52, -46, -46,
+    -36, -36, -24, -24, -12, -12, -5, -5, -5, -5, -12, -12,
+    -25, -25, -38, -38, -46, -46, -47, -47, -44, -44, -37, -37,
+    -27, -27, -20, -20, -18, -18, -16, -16, -17, -17, -24, -24,
+    -40, -40, -56, -56, -62, -62, -59, -59, -48, -48, -33, -33,
+    -15, -15, -3, -3, -4, -4, -11, -11, -11, -11, -5, -5,
+    1, 1, 3, 3, 4, 4, 4, 4, -6, -6, -25, -25,
+    -40, -40, -44, -44, -39, -39, -32, -32, -26, -26, -18, -18,
+    -7, -7, 2, 2, 3, 3, 0, 0, 2, 2, 8, 8,
+    12, 12, 12, 12, 13, 13, 22, 22, 32, 32, 34, 34,
+    29, 29, 21, 21, 10, 10, -7, -7, -22, -22, -27, -27,
+    -20, -20, -14, -14, -10, -10, -1, -1, 14, 14, 22, 22,
+    21, 21, 15, 15, 8, 8, 3, 3, -1, -1, -1, -1,
+    1, 1, -1, -1, -12, -12, -28, -28, -42, -42, -47, -47,
+    -45, -45, -40, -40, -33, -33, -28, -28, -21, -21, -12, -12,
+    -3, -3, 0, 0, -6, -6, -18, -18, -29, -29, -39, -39,
+    -44, -44, -45, -45, -47, -47, -46, -46, -40, -40, -28, -28,
+    -17, -17, -9, -9, -1, -1, 7, 7, 10, 10, 5, 5,
+    -4, -4, -11, -11, -19, -19, -30, -30, -39, -39, -39, -39,
+    -34, -34, -29, -29, -24, -24, -12, -12, 3, 3, 13, 13,
+    17, 17, 16, 16, 11, 11, 0, 0, -12, -12, -17, -17,
+    -13, -13, -3, -3, 8, 8, 16, 16, 19, 19, 18, 18,
+    18, 18, 21, 21, 24, 24, 25, 25, 27, 27, 28, 28,
+    23, 23, 10, 10, -6, -6, -14, -14, -14, -14, -12, -12,
+    -9, -9, -4, -4, 5, 5, 12, 12, 15, 15, 15, 15,
+    13, 13, 6, 6, -6, -6, -22, -22, -37, -37, -49, -49,
+    -58, -58, -59, -59, -54, -54, -46, -46, -43, -43, -45, -45,
+    -51, -51, -57, -57, -64, -64, -68, -68, -68, -68, -64, -64,
+    -58, -58, -53, -53, -51, -51, -50, -50, -47, -47, -43, -43,
+    -38, -38, -34, -34, -33, -33, -38, -38, -47, -47, -60, -60,
+    -75, -75, -90, -90, -96, -96, -89, -89, -73, -73, -52, -52,
+    -29, -29, -5, -5, 18, 18, 35, 35, 40, 40, 34, 34,
+    22, 22, 10, 10, 1, 1, -8, -8, -23, -23, -42, -42,
+    -61, -61, -73, -73, -75, -75, -68, -68, -54, -54, -36, -36,
+    -16, -16, 0, 0, 8, 8, 6, 6, -3, -3, -13, -13,
+    -21, -21, -26, -26, -28, -28, -24, -24, -19, -19, -18, -18,
+    -23, -23, -30, -30, -41, -41, -54, -54, -70, -70, -84, -84,
+    -93, -93, -94, -94, -88, -88, -74, -74, -54, -54, -33, -33,
+    -16, -16, -3, -3, 7, 7, 12, 12, 14, 14, 13, 13,
+    12, 12, 11, 11, 8, 8, -2, -2, -18, -18, -34, -34,
+    -46, -46, -50, -50, -44, -44, -32, -32, -20, -20, -10, -10,
+    -3, -3, 1, 1, 3, 3, 1, 1, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 1, 1, 4, 4, 6, 6,
+    3, 3, -7, -7, -22, -22, -38, -38, -50, -50, -54, -54,
+    -53, -53, -49, -49, -45, -45, -39, -39, -31, -31, -21, -21,
+    -9, -9, 5, 5, 19, 19, 31, 31, 39, 39, 40, 40,
+    37, 37, 34, 34, 33, 33, 31, 31, 26, 26, 16, 16,
+    5, 5, -7, -7, -20, -20, -30, -30, -33, -33, -33, -33,
+    -35, -35, -39, -39, -42, -42, -40, -40, -33, -33, -24, -24,
+    -12, -12, 4, 4, 21, 21, 33, 33, 37, 37, 36, 36,
+    33, 33, 26, 26, 13, 13, -3, -3, -18, -18, -33, -33,
+    -47, -47, -57, -57, -59, -59, -54, -54, -45, -45, -35, -35,
+    -23, -23, -6, -6, 13, 13, 33, 33, 50, 50, 58, 58,
+    59, 59, 56, 56, 51, 51, 42, 42, 29, 29, 17, 17,
+    13, 13, 12, 12, 11, 11, 11, 11, 12, 12, 14, 14,
+    13, 13, 10, 10, 12, 12, 19, 19, 25, 25, 27, 27,
+    33, 33, 44, 44, 56, 56, 63, 63, 64, 64, 66, 66,
+    68, 68, 65, 65, 54, 54, 37, 37, 21, 21, 7, 7,
+    -5, -5, -16, -16, -26, -26, -31, -31, -30, -30, -22, -22,
+    -4, -4, 21, 21, 47, 47, 67, 67, 74, 74, 71, 71,
+    61, 61, 48, 48, 36, 36, 29, 29, 29, 29, 29, 29,
+    25, 25, 19, 19, 13, 13, 8, 8, 4, 4, 4, 4,
+    7, 7, 9, 9, 8, 8, 7, 7, 9, 9, 17, 17,
+    25, 25, 33, 33, 44, 44, 55, 55, 64, 64, 70, 70,
+    76, 76, 79, 79, 75, 75, 63, 63, 49, 49, 39, 39,
+    29, 29, 18, 18, 7, 7, 1, 1, 4, 4, 14, 14,
+    25, 25, 34, 34, 40, 40, 46, 46, 53, 53, 61, 61,
+    64, 64, 65, 65, 65, 65, 64, 64, 60, 60, 54, 54,
+    48, 48, 39, 39, 26, 26, 14, 14, 5, 5, 1, 1,
+    -1, -1, 0, 0, 6, 6, 15, 15, 24, 24, 35, 35,
+    47, 47, 58, 58, 67, 67, 72, 72, 75, 75, 78, 78,
+    79, 79, 77, 77, 72, 72, 64, 64, 52, 52, 40, 40,
+    31, 31, 26, 26, 25, 25, 24, 24, 25, 25, 27, 27,
+    32, 32, 39, 39, 44, 44, 50, 50, 59, 59, 68, 68,
+    75, 75, 76, 76, 71, 71, 64, 64, 58, 58, 52, 52,
+    45, 45, 36, 36, 26, 26, 15, 15, 7, 7, 1, 1,
+    0, 0, 3, 3, 8, 8, 13, 13, 19, 19, 28, 28,
+    36, 36, 41, 41, 44, 44, 49, 49, 56, 56, 60, 60,
+    54, 54, 40, 40, 25, 25, 13, 13, 5, 5, 1, 1,
+    2, 2, 4, 4, 4, 4, 3, 3, 3, 3, 4, 4,
+    6, 6, 9, 9, 14, 14, 19, 19, 21, 21, 21, 21,
+    22, 22, 24, 24, 27, 27, 29, 29, 29, 29, 27, 27,
+    21, 21, 13, 13, 6, 6, 4, 4, 3, 3, 0, 0,
+    -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 3, 3,
+    9, 9, 15, 15, 21, 21, 25, 25, 28, 28, 28, 28,
+    27, 27, 27, 27, 28, 28, 27, 27, 22, 22, 16, 16,
+    11, 11, 10, 10, 9, 9, 8, 8, 6, 6, 7, 7,
+    12, 12, 19, 19, 27, 27, 34, 34, 39, 39, 43, 43,
+    45, 45, 46, 46, 44, 44, 40, 40, 36, 36, 35, 35,
+    35, 35, 34, 34, 31, 31, 28, 28, 27, 27, 28, 28,
+    27, 27, 27, 27, 25, 25, 22, 22, 20, 20, 21, 21,
+    25, 25, 28, 28, 27, 27, 26, 26, 24, 24, 23, 23,
+    20, 20, 16, 16, 13, 13, 11, 11, 10, 10, 5, 5,
+    0, 0, -6, -6, -12, -12, -17, -17, -21, -21, -24, -24,
+    -22, -22, -15, -15, -8, -8, 1, 1, 10, 10, 15, 15,
+    16, 16, 16, 16, 17, 17, 17, 17, 16, 16, 15, 15,
+    16, 16, 21, 21, 26, 26, 30, 30, 30, 30, 28, 28,
+    25, 25, 22, 22, 19, 19, 19, 19, 21, 21, 24, 24,
+    28, 28, 30, 30, 33, 33, 36, 36, 40, 40, 43, 43,
+    45, 45, 47, 47, 46, 46, 41, 41, 33, 33, 25, 25,
+    18, 18, 11, 11, 6, 6, 2, 2, 2, 2, 4, 4,
+    8, 8, 15, 15, 22, 22, 25, 25, 25, 25, 24, 24,
+    22, 22, 18, 18, 13, 13, 9, 9, 10, 10, 13, 13,
+    15, 15, 16, 16, 15, 15, 13, 13, 11, 11, 10, 10,
+    10, 10, 11, 11, 12, 12, 12, 12, 13, 13, 14, 14,
+    17, 17, 19, 19, 19, 19, 17, 17, 16, 16, 18, 18,
+    20, 20, 22, 22, 23, 23, 23, 23, 22, 22, 22, 22,
+    20, 20, 18, 18, 16, 16, 12, 12, 10, 10, 11, 11,
+    16, 16, 20, 20, 23, 23, 25, 25, 26, 26, 28, 28,
+    28, 28, 27, 27, 26, 26, 25, 25, 22, 22, 21, 21,
+    22, 22, 24, 24, 26, 26, 27, 27, 27, 27, 26, 26,
+    25, 25, 27, 27, 30, 30, 32, 32, 33, 33, 35, 35,
+    34, 34, 32, 32, 27, 27, 23, 23, 19, 19, 16, 16,
+    14, 14, 15, 15, 16, 16, 14, 14, 12, 12, 13, 13,
+    17, 17, 19, 19, 18, 18, 18, 18, 18, 18, 19, 19,
+    19, 19, 20, 20, 22, 22, 21, 21, 16, 16, 10, 10,
+    7, 7, 7, 7, 7, 7, 4, 4, 2, 2, 1, 1,
+    1, 1, 3, 3, 6, 6, 10, 10, 14, 14, 17, 17,
+    17, 17, 17, 17, 18, 18, 20, 20, 21, 21, 19, 19,
+    16, 16, 12, 12, 7, 7, 2, 2, -2, -2, -3, -3,
+    -5, -5, -8, -8, -12, -12, -14, -14, -13, -13, -10, -10,
+    -6, -6, -1, -1, 5, 5, 12, 12, 18, 18, 20, 20,
+    20, 20, 20, 20, 20, 20, 19, 19, 15, 15, 9, 9,
+    1, 1, -7, -7, -13, -13, -16, -16, -14, -14, -10, -10,
+    -7, -7, -5, -5, -3, -3, 1, 1, 6, 6, 11, 11,
+    17, 17, 25, 25, 33, 33, 37, 37, 38, 38, 38, 38,
+    37, 37, 34, 34, 29, 29, 26, 26, 23, 23, 20, 20,
+    17, 17, 16, 16, 16, 16, 15, 15, 12, 12, 9, 9,
+    8, 8, 9, 9, 11, 11, 13, 13, 16, 16, 20, 20,
+    24, 24, 29, 29, 32, 32, 32, 32, 32, 32, 31, 31,
+    27, 27, 20, 20, 13, 13, 8, 8, 2, 2, -4, -4,
+    -9, -9, -12, -12, -13, -13, -14, -14, -14, -14, -11, -11,
+    -9, -9, -7, -7, -2, -2, 4, 4, 5, 5, 2, 2,
+    -4, -4, -8, -8, -9, -9, -11, -11, -12, -12, -10, -10,
+    -8, -8, -7, -7, -10, -10, -13, -13, -13, -13, -14, -14,
+    -14, -14, -14, -14, -13, -13, -9, -9, -7, -7, -8, -8,
+    -7, -7, -3, -3, 2, 2, 6, 6, 5, 5, 1, 1,
+    -3, -3, -8, -8, -14, -14, -19, -19, -22, -22, -23, -23,
+    -23, -23, -23, -23, -20, -20, -15, -15, -11, -11, -9, -9,
+    -8, -8, -7, -7, -6, -6, -6, -6, -5, -5, -3, -3,
+    2, 2, 4, 4, 4, 4, 2, 2, 0, 0, -3, -3,
+    -8, -8, -15, -15, -21, -21, -26, -26, -28, -28, -28, -28,
+    -25, -25, -21, -21, -16, -16, -11, -11, -5, -5, 0, 0,
+    4, 4, 6, 6, 7, 7, 7, 7, 4, 4, -1, -1,
+    -8, -8, -17, -17, -26, -26, -34, -34, -39, -39, -44, -44,
+    -48, -48, -49, -49, -47, -47, -45, -45, -45, -45, -44, -44,
+    -42, -42, -38, -38, -35, -35, -31, -31, -28, -28, -26, -26,
+    -26, -26, -26, -26, -26, -26, -27, -27, -30, -30, -36, -36,
+    -41, -41, -45, -45, -50, -50, -53, -53, -56, -56, -56, -56,
+    -54, -54, -51, -51, -49, -49, -47, -47, -45, -45, -42, -42,
+    -40, -40, -38, -38, -36, -36, -34, -34, -34, -34, -34, -34,
+    -35, -35, -37, -37, -39, -39, -38, -38, -35, -35, -32, -32,
+    -30, -30, -28, -28, -25, -25, -23, -23, -20, -20, -18, -18,
+    -16, -16, -11, -11, -5, -5, 0, 0, 3, 3, 8, 8,
+    14, 14, 16, 16, 12, 12, 7, 7, 6, 6, 7, 7,
+    5, 5, 2, 2, 1, 1, 1, 1, -1, -1, -2, -2,
+    -2, -2, 0, 0, 1, 1, 2, 2, 2, 2, 3, 3,
+    1, 1, -1, -1, -2, -2, -4, -4, -6, -6, -7, -7,
+    -10, -10, -14, -14, -18, -18, -23, -23, -27, -27, -31, -31,
+    -33, -33, -35, -35, -39, -39, -42, -42, -45, -45, -45, -45,
+    -43, -43, -41, -41, -39, -39, -34, -34, -29, -29, -24, -24,
+    -23, -23, -24, -24, -26, -26, -29, -29, -34, -34, -38, -38,
+    -40, -40, -42, -42, -44, -44, -48, -48, -50, -50, -46, -46,
+    -40, -40, -33, -33, -26, -26, -18, -18, -13, -13, -9, -9,
+    -6, -6, -2, -2, 0, 0, -1, -1, -2, -2, -5, -5,
+    -10, -10, -14, -14, -17, -17, -17, -17, -17, -17, -17, -17,
+    -16, -16, -16, -16, -17, -17, -14, -14, -10, -10, -7, -7,
+    -6, -6, -6, -6, -5, -5, -4, -4, -2, -2, -2, -2,
+    -2, -2, -5, -5, -8, -8, -11, -11, -15, -15, -19, -19,
+    -22, -22, -23, -23, -25, -25, -28, -28, -34, -34, -39, -39,
+    -42, -42, -44, -44, -44, -44, -42, -42, -39, -39, -37, -37,
+    -37, -37, -39, -39, -38, -38, -37, -37, -37, -37, -38, -38,
+    -38, -38, -38, -38, -40, -40, -42, -42, -43, -43, -46, -46,
+    -51, -51, -54, -54, -53, -53, -50, -50, -48, -48, -48, -48,
+    -45, -45, -41, -41, -38, -38, -36, -36, -34, -34, -32, -32,
+    -30, -30, -32, -32, -33, -33, -32, -32, -32, -32, -34, -34,
+    -33, -33, -31, -31, -30, -30, -31, -31, -33, -33, -37, -37,
+    -39, -39, -41, -41, -42, -42, -43, -43, -43, -43, -41, -41,
+    -38, -38, -37, -37, -34, -34, -30, -30, -28, -28, -28, -28,
+    -30, -30, -33, -33, -35, -35, -38, -38, -40, -40, -41, -41,
+    -42, -42, -44, -44, -48, -48, -49, -49, -48, -48, -46, -46,
+    -45, -45, -43, -43, -40, -40, -37, -37, -35, -35, -35, -35,
+    -33, -33, -30, -30, -29, -29, -28, -28, -29, -29, -30, -30,
+    -34, -34, -39, -39, -42, -42, -46, -46, -49, -49, -52, -52,
+    -51, -51, -49, -49, -48, -48, -49, -49, -48, -48, -46, -46,
+    -44, -44, -41, -41, -39, -39, -38, -38, -39, -39, -41, -41,
+    -43, -43, -44, -44, -45, -45, -48, -48, -51, -51, -53, -53,
+    -52, -52, -54, -54, -56, -56, -56, -56, -54, -54, -51, -51,
+    -48, -48, -47, -47, -47, -47, -47, -47, -47, -47, -45, -45,
+    -41, -41, -38, -38, -35, -35, -36, -36, -39, -39, -43, -43,
+    -47, -47, -52, -52, -55, -55, -55, -55, -57, -57, -58, -58,
+    -58, -58, -58, -58, -56, -56, -53, -53, -51, -51, -49, -49,
+    -46, -46, -44, -44, -42, -42, -40, -40, -39, -39, -38, -38,
+    -39, -39, -40, -40, -42, -42, -43, -43, -44, -44, -42, -42,
+    -39, -39, -38, -38, -38, -38, -39, -39, -40, -40, -41, -41,
+    -41, -41, -40, -40, -39, -39, -37, -37, -34, -34, -30, -30,
+    -28, -28, -29, -29, -32, -32, -34, -34, -34, -34, -33, -33,
+    -34, -34, -34, -34, -34, -34, -34, -34, -34, -34, -33, -33,
+    -31, -31, -29, -29, -30, -30, -32, -32, -33, -33, -32, -32,
+    -30, -30, -29, -29, -29, -29, -29, -29, -30, -30, -31, -31,
+    -32, -32, -34, -34, -35, -35, -37, -37, -38, -38, -38, -38,
+    -39, -39, -42, -42, -42, -42, -39, -39, -34, -34, -28, -28,
+    -24, -24, -21, -21, -19, -19, -19, -19, -20, -20, -22, -22,
+    -25, -25, -28, -28, -32, -32, -35, -35, -36, -36, -36, -36,
+    -35, -35, -35, -35, -36, -36, -35, -35, -33, -33, -32, -32,
+    -32, -32, -31, -31, -28, -28, -27, -27, -26, -26, -26, -26,
+    -25, -25, -24, -24, -25, -25, -26, -26, -26, -26, -24, -24,
+    -22, -22, -21, -21, -20, -20, -20, -20, -21, -21, -23, -23,
+    -24, -24, -24, -24, -22, -22, -20, -20, -19, -19, -19, -19,
+    -20, -20, -21, -21, -19, -19, -18, -18, -18, -18, -17, -17,
+    -16, -16, -15, -15, -15, -15, -17, -17, -17, -17, -14, -14,
+    -12, -12, -10, -10, -9, -9, -9, -9, -8, -8, -8, -8,
+    -7, -7, -6, -6, -8, -8, -11, -11, -12, -12, -13, -13,
+    -12, -12, -13, -13, -16, -16, -16, -16, -17, -17, -18, -18,
+    -19, -19, -19, -19, -19, -19, -19, -19, -19, -19, -18, -18,
+    -17, -17, -17, -17, -17, -17, -19, -19, -19, -19, -19, -19,
+    -18, -18, -18, -18, -20, -20, -21, -21, -22, -22, -23, -23,
+    -25, -25, -26, -26, -26, -26, -26, -26, -27, -27, -29, -29,
+    -30, -30, -29, -29, -25, -25, -22, -22, -22, -22, -23, -23,
+    -21, -21, -18, -18, -17, -17, -17, -17, -16, -16, -14, -14,
+    -12, -12, -11, -11, -11, -11, -11, -11, -11, -11, -9, -9,
+    -7, -7, -8, -8, -9, -9, -10, -10, -10, -10, -8, -8,
+    -6, -6, -6, -6, -4, -4, -4, -4, -3, -3, -3, -3,
+    -3, -3, -2, -2, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -1, -2, -2, -2, -2, -4, -4,
+    -6, -6, -9, -9, -10, -10, -11, -11, -13, -13, -15, -15,
+    -16, -16, -17, -17, -20, -20, -20, -20, -18, -18, -16, -16,
+    -15, -15, -14, -14, -13, -13, -13, -13, -13, -13, -14, -14,
+    -16, -16, -19, -19, -22, -22, -24, -24, -25, -25, -26, -26,
+    -27, -27, -25, -25, -23, -23, -21, -21, -19, -19, -16, -16,
+    -13, -13, -12, -12, -11, -11, -9, -9, -7, -7, -6, -6,
+    -6, -6, -6, -6, -6, -6, -8, -8, -11, -11, -14, -14,
+    -16, -16, -17, -17, -17, -17, -17, -17, -16, -16, -15, -15,
+    -16, -16, -17, -17, -17, -17, -16, -16, -15, -15, -13, -13,
+    -9, -9, -4, -4, -1, -1, -1, -1, -2, -2, -1, -1,
+    -1, -1, -2, -2, -3, -3, -3, -3, -3, -3, -5, -5,
+    -8, -8, -9, -9, -7, -7, -7, -7, -9, -9, -11, -11,
+    -12, -12, -10, -10, -10, -10, -11, -11, -11, -11, -8, -8,
+    -6, -6, -4, -4, -4, -4, -3, -3, 0, 0, 1, 1,
+    -1, -1, -3, -3, -3, -3, -1, -1, -2, -2, -5, -5,
+    -10, -10, -14, -14, -16, -16, -17, -17, -17, -17, -17, -17,
+    -14, -14, -11, -11, -10, -10, -10, -10, -10, -10, -9, -9,
+    -7, -7, -6, -6, -5, -5, -5, -5, -5, -5, -6, -6,
+    -6, -6, -4, -4, -3, -3, -3, -3, -3, -3, -3, -3,
+    -4, -4, -4, -4, -4, -4, -4, -4, -1, -1, 1, 1,
+    3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0,
+    0, 0, -2, -2, -4, -4, -4, -4, -4, -4, -3, -3,
+    -4, -4, -5, -5, -5, -5, -4, -4, -3, -3, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1,
+    3, 3, 4, 4, 4, 4, 3, 3, 3, 3, 4, 4,
+    5, 5, 5, 5, 6, 6, 6, 6, 4, 4, 1, 1,
+    -1, -1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -2,
+    -3, -3, -2, -2, -1, -1, -1, -1, -1, -1, -2, -2,
+    -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 2, 2,
+    5, 5, 7, 7, 8, 8, 7, 7, 7, 7, 8, 8,
+    7, 7, 7, 7, 7, 7, 6, 6, 5, 5, 4, 4,
+    5, 5, 6, 6, 5, 5, 4, 4, 4, 4, 5, 5,
+    5, 5, 5, 5, 5, 5, 6, 6, 8, 8, 8, 8,
+    7, 7, 7, 7, 9, 9, 9, 9, 8, 8, 7, 7,
+    7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 5, 5,
+    2, 2, 1, 1, 0, 0, 0, 0, 1, 1, 2, 2,
+    3, 3, 5, 5, 7, 7, 7, 7, 7, 7, 9, 9,
+    10, 10, 10, 10, 12, 12, 12, 12, 10, 10, 8, 8,
+    9, 9, 11, 11, 11, 11, 11, 11, 10, 10, 9, 9,
+    9, 9, 10, 10, 11, 11, 12, 12, 12, 12, 14, 14,
+    15, 15, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15,
+    15, 15, 14, 14, 14, 14, 14, 14, 12, 12, 11, 11,
+    11, 11, 10, 10, 9, 9, 8, 8, 9, 9, 11, 11,
+    11, 11, 10, 10, 8, 8, 8, 8, 10, 10, 11, 11,
+    8, 8, 6, 6, 4, 4, 3, 3, 1, 1, 0, 0,
+    0, 0, 1, 1, 0, 0, -1, -1, 0, 0, 1, 1,
+    0, 0, -2, -2, -4, -4, -4, -4, -2, -2, -1, -1,
+    0, 0, 0, 0, 1, 1, 2, 2, 4, 4, 7, 7,
+    8, 8, 7, 7, 6, 6, 5, 5, 5, 5, 7, 7,
+    7, 7, 6, 6, 7, 7, 8, 8, 8, 8, 8, 8,
+    9, 9, 12, 12, 14, 14, 17, 17, 20, 20, 21, 21,
+    21, 21, 21, 21, 20, 20, 19, 19, 19, 19, 18, 18,
+    17, 17, 16, 16, 15, 15, 15, 15, 15, 15, 15, 15,
+    17, 17, 18, 18, 18, 18, 17, 17, 17, 17, 18, 18,
+    18, 18, 17, 17, 16, 16, 15, 15, 14, 14, 12, 12,
+    11, 11, 9, 9, 8, 8, 6, 6, 5, 5, 3, 3,
+    2, 2, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 1, 1,
+    2, 2, 2, 2, 2, 2, 3, 3, 5, 5, 6, 6,
+    6, 6, 5, 5, 5, 5, 7, 7, 9, 9, 9, 9,
+    10, 10, 10, 10, 9, 9, 10, 10, 11, 11, 11, 11,
+    10, 10, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10,
+    11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 6, 6,
+    5, 5, 5, 5, 4, 4, 3, 3, 1, 1, 1, 1,
+    2, 2, 4, 4, 4, 4, 3, 3, 2, 2, 2, 2,
+    2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 4, 4,
+    5, 5, 4, 4, 2, 2, 1, 1, 2, 2, 2, 2,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 5, 5, 4, 4, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 4, 4,
+    5, 5, 6, 6, 6, 6, 7, 7, 8, 8, 8, 8,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6,
+    5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 8, 8,
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 9, 9,
+    9, 9, 10, 10, 11, 11, 9, 9, 7, 7, 7, 7,
+    5, 5, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3,
+    2, 2, 3, 3, 4, 4, 4, 4, 6, 6, 7, 7,
+    6, 6, 4, 4, 4, 4, 5, 5, 5, 5, 4, 4,
+    4, 4, 3, 3, 3, 3, 4, 4, 3, 3, 2, 2,
+    1, 1, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3,
+    4, 4, 4, 4, 5, 5, 6, 6, 6, 6, 8, 8,
+    8, 8, 8, 8, 7, 7, 8, 8, 7, 7, 7, 7,
+    6, 6, 7, 7, 8, 8, 7, 7, 7, 7, 6, 6,
+    5, 5, 6, 6, 6, 6, 7, 7, 8, 8, 8, 8,
+    8, 8, 7, 7, 8, 8, 9, 9, 9, 9, 8, 8,
+    7, 7, 6, 6, 5, 5, 4, 4, 2, 2, 1, 1,
+    0, 0, 0, 0, 0, 0, -1, -1, -2, -2, -2, -2,
+    -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2,
+    -3, -3, -4, -4, -4, -4, -4, -4, -5, -5, -6, -6,
+    -6, -6, -6, -6, -7, -7, -8, -8, -7, -7, -7, -7,
+    -9, -9, -10, -10, -9, -9, -7, -7, -6, -6, -4, -4,
+    -2, -2, -1, -1, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    2, 2, 2, 2, 1, 1, 2, 2, 3, 3, 3, 3,
+    2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, -1, -1, -2, -2,
+    -2, -2, -3, -3, -4, -4, -4, -4, -3, -3, -3, -3,
+    -3, -3, -3, -3, -2, -2, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -3, -3,
+    -3, -3, -2, -2, -3, -3, -4, -4, -4, -4, -3, -3,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2,
+    -2, -2, -3, -3, -3, -3, -2, -2, -2, -2, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, -1, -1,
+    -1, -1, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -3, -3,
+    -3, -3, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2,
+    -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -2, -2, -3, -3, -3, -3, -3, -3, -2, -2,
+    -2, -2, -2, -2, -2, -2, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, -1, -1, -1, -1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    -1, -1, -1, -1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 1, 1, 2, 2, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, -1, -1, -1, -1,
+    1, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 0, 0, -1, -1, 0, 0, 1, 1, 0, 0,
+    -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    0, 0, 1, 1, 0, 0, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, 0, 0, 1, 1, 1, 1,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, 0, 0, 1, 1, 0, 0, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1,
+    1, 1, 2, 2, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 2, 2,
+    2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, -1, -1, 0, 0, 1, 1,
+    1, 1, -1, -1, -1, -1, 1, 1, 1, 1, -1, -1,
+    -1, -1, 1, 1, 1, 1, -1, -1, -1, -1, 1, 1,
+    1, 1, -1, -1, -1, -1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    -1, -1, 0, 0, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 2, 2, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, -1, -1,
+    -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    -1, -1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 2, 2, 1, 1, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, -1, -1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+const embedded_sound_t assets_embedded_sounds[1] = {
+    { "bt_connect.wav", sound_bt_connect_wav, sizeof(sound_bt_connect_wav) / (2 * sizeof(int16_t)) },
+};
+
+const int assets_embedded_count = 1;
@@ -0,0 +1,84 @@
+#include "audio_command.h"
+#include <string.h>
+
+void audio_command_queue_init(audio_command_queue_t *queue) {
+    memset(queue, 0, sizeof(audio_command_queue_t));
+    
+    for (size_t i = 0; i < AUDIO_COMMAND_QUEUE_SIZE; i++) {
+        atomic_init(&queue->cells[i].sequence, i);
+    }
+    atomic_init(&queue->enqueue_pos, 0);
+    queue->dequeue_pos = 0;
+}
+
+// Returns false when the queue is full
+bool audio_command_push(audio_command_queue_t *queue, const audio_command_t *command) {
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    
+    for (;;) {
+        audio_command_cell_t *cell = &queue->cells[pos & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        
+        if (sequence == pos) {
+            // Cell is free for this lap: claim it, then publish
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                cell->command = *command;
+                atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+                return true;
+            }
+            // Lost the race; pos now holds the current value
+        } else if (sequence < pos) {
+            return false; // Consumer hasn't freed this cell yet
+        } else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+// Returns false when nothing is published yet
+bool audio_command_pop(audio_command_queue_t *queue, audio_command_t *command) {
+    size_t pos = queue->dequeue_pos;
+    audio_command_cell_t *cell = &queue->cells[pos & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+    
+    if (atomic_load_explicit(&cell->sequence, memory_order_acquire) != pos + 1) {
+        return false;
+    }
+    
+    *command = cell->command;
+    atomic_store_explicit(&cell->sequence, pos + AUDIO_COMMAND_QUEUE_SIZE, memory_order_release);
+    queue->dequeue_pos = pos + 1;
+    return true;
+}
+
+void audio_completion_init(audio_completion_t *completion) {
+    pthread_mutex_init(&completion->lock, NULL);
+    pthread_cond_init(&completion->signal, NULL);
+    completion->done = false;
+    completion->result = -1;
+}
+
+void audio_completion_destroy(audio_completion_t *completion) {
+    pthread_cond_destroy(&completion->signal);
+    pthread_mutex_destroy(&completion->lock);
+}
+
+// Engine side: the waiter may free the completion as soon as this unlocks
+void audio_completion_signal(audio_completion_t *completion, int result) {
+    pthread_mutex_lock(&completion->lock);
+    completion->result = result;
+    completion->done = true;
+    pthread_cond_signal(&completion->signal);
+    pthread_mutex_unlock(&completion->lock);
+}
+
+// Sleeps until the engine has applied the command; returns its result
+int audio_completion_wait(audio_completion_t *completion) {
+    pthread_mutex_lock(&completion->lock);
+    while (!completion->done) {
+        pthread_cond_wait(&completion->signal, &completion->lock);
+    }
+    int result = completion->result;
+    pthread_mutex_unlock(&completion->lock);
+    return result;
+}
@@ -0,0 +1,69 @@
+#ifndef AUDIO_COMMAND_H
+#define AUDIO_COMMAND_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// Queue depth (power of two); button presses never come close
+#define AUDIO_COMMAND_QUEUE_SIZE 64
+
+typedef enum {
+    AUDIO_CMD_PLAY = 0,      // arg: track
+    AUDIO_CMD_PAUSE,
+    AUDIO_CMD_RESUME,
+    AUDIO_CMD_STOP,
+    AUDIO_CMD_SEEK,          // position_ms within the current track
+    AUDIO_CMD_NEXT,
+    AUDIO_CMD_PREV,
+    AUDIO_CMD_SCAN,          // arg: direction (-1, 0, 1)
+    AUDIO_CMD_SET_DEVICE,    // device; outcome in the snapshot's output_state
+    AUDIO_CMD_ADD_SINK,      // device played alongside the main output
+    AUDIO_CMD_REMOVE_SINK,   // device
+    AUDIO_CMD_SET_LATENCY,   // arg: profile for the main output
+    AUDIO_CMD_SET_RESAMPLER  // arg: quality
+} audio_command_type_t;
+
+// Lets a caller wait for a command that must report a result. Lives on
+// the caller's stack: the engine signals it once and never touches it again.
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t signal;
+    bool done;
+    int result;
+} audio_completion_t;
+
+typedef struct {
+    audio_command_type_t type;
+    int arg;
+    long position_ms;
+    char device[64];
+    audio_completion_t *completion;   // Optional
+} audio_command_t;
+
+typedef struct {
+    atomic_size_t sequence;
+    audio_command_t command;
+} audio_command_cell_t;
+
+// Bounded lock-free multi-producer/single-consumer queue.
+// Any thread may push; only the playback engine pops. Each cell's sequence
+// number tells producers whether it is free and the consumer whether it is
+// published, so neither side ever takes a lock.
+typedef struct {
+    audio_command_cell_t cells[AUDIO_COMMAND_QUEUE_SIZE];
+    _Alignas(64) atomic_size_t enqueue_pos;   // Claimed by producers (CAS)
+    _Alignas(64) size_t dequeue_pos;          // Engine thread only
+} audio_command_queue_t;
+
+// Function declarations
+void audio_command_queue_init(audio_command_queue_t *queue);
+bool audio_command_push(audio_command_queue_t *queue, const audio_command_t *command);
+bool audio_command_pop(audio_command_queue_t *queue, audio_command_t *command);
+void audio_completion_init(audio_completion_t *completion);
+void audio_completion_destroy(audio_completion_t *completion);
+void audio_completion_signal(audio_completion_t *completion, int result);
+int audio_completion_wait(audio_completion_t *completion);
+
+#endif
@@ -0,0 +1,85 @@
+#include "audio_crossfade.h"
+#include "audio_dsp.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+void audio_crossfade_init(audio_crossfade_t *xfade) {
+    memset(xfade, 0, sizeof(audio_crossfade_t));
+    atomic_init(&xfade->seconds, AUDIO_CROSSFADE_DEFAULT_SECONDS);
+    sector_deemph_init(&xfade->deemph);
+}
+
+// Whatever was running no longer leads anywhere (seek, new play)
+void audio_crossfade_reset(audio_crossfade_t *xfade) {
+    xfade->sectors = 0;
+    xfade->done = 0;
+    xfade->skip = 0;
+}
+
+void audio_crossfade_begin(audio_crossfade_t *xfade, int to_track, int to_start, int sectors) {
+    xfade->sectors = sectors;
+    xfade->done = 0;
+    xfade->to_track = to_track;
+    xfade->to_start = to_start;
+    xfade->skip = 0;
+    xfade->missing = 0;
+    xfade->deemph.active = false;
+    
+    printf("🔀 Crossfading into track %d over %.1f s\n", to_track, (double)sectors / CD_SECTORS_PER_SECOND);
+}
+
+// Mix the next head sector into a tail sector in place, with cos/sin gains
+// so the summed power stays constant across the fade. head is NULL when the
+// reader has not got to it: that stretch of the incoming track stays silent.
+// Returns true once the last tail sector is mixed.
+bool audio_crossfade_mix(audio_crossfade_t *xfade, int16_t *tail, const int16_t *head,
+                         bool emphasized, float head_gain) {
+    audio_dsp_to_float(tail, xfade->tail, CD_SAMPLES_PER_SECTOR);
+    
+    if (head) {
+        // The ring sector is left as read: it is dropped at the hand-over
+        memcpy(xfade->head_pcm, head, CDIO_CD_FRAMESIZE_RAW);
+        sector_deemph_process(&xfade->deemph, xfade->head_pcm, xfade->to_track, emphasized);
+        audio_dsp_to_float(xfade->head_pcm, xfade->head, CD_SAMPLES_PER_SECTOR);
+        if (head_gain != 1.0f) {
+            audio_dsp_scale(xfade->head, CD_SAMPLES_PER_SECTOR, head_gain);
+        }
+    } else {
+        memset(xfade->head, 0, sizeof(xfade->head));
+        xfade->missing++;
+    }
+    
+    // Angle steps by a fixed rotation per frame, set exactly at each sector
+    double frames = (double)xfade->sectors * CD_FRAMES_PER_SECTOR;
+    double step = M_PI / 2.0 / frames;
+    double angle = (xfade->done * CD_FRAMES_PER_SECTOR + 0.5) * step;
+    double c = cos(angle);
+    double s = sin(angle);
+    double dc = cos(step);
+    double ds = sin(step);
+    
+    for (int f = 0; f < CD_FRAMES_PER_SECTOR; f++) {
+        float out = (float)c;
+        float in = (float)s;
+        xfade->tail[f * 2] = xfade->tail[f * 2] * out + xfade->head[f * 2] * in;
+        xfade->tail[f * 2 + 1] = xfade->tail[f * 2 + 1] * out + xfade->head[f * 2 + 1] * in;
+    
+        double next = c * dc - s * ds;
+        s = s * dc + c * ds;
+        c = next;
+    }
+    
+    audio_dsp_to_int16(xfade->tail, tail, CD_SAMPLES_PER_SECTOR);
+    
+    if (++xfade->done < xfade->sectors) {
+        return false;
+    }
+    
+    if (xfade->missing > 0) {
+        printf("⚠️  Crossfade into track %d: %lu sectors not read in time\n", xfade->to_track, xfade->missing);
+    }
+    xfade->skip = xfade->sectors;
+    xfade->sectors = 0;
+    return true;
+}
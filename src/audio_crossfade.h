@@ -0,0 +1,44 @@
+#ifndef AUDIO_CROSSFADE_H
+#define AUDIO_CROSSFADE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "cd_control.h"
+#include "sector_deemph.h"
+
+// Track transitions: 0 s keeps them gapless
+#define AUDIO_CROSSFADE_DEFAULT_SECONDS 0
+#define AUDIO_CROSSFADE_MAX_SECONDS 10
+
+// Read-ahead the ring keeps beyond the fade, so the reader stays ahead of
+// the incoming track while both are being played
+#define AUDIO_CROSSFADE_SLACK_SECONDS 2
+
+// Equal-power crossfade between the tail of one track and the head of the
+// next. Both come out of the read-ahead ring at once: the head sector being
+// faded in sits a fixed number of sectors behind the tail sector it is
+// mixed into. Engine only, apart from the requested length.
+typedef struct {
+    atomic_int seconds;          // Requested length
+    
+    int sectors;                 // Length of the running fade; 0 when none
+    int done;                    // Sectors mixed so far
+    int to_track;
+    int to_start;                // First sector of the incoming track
+    int skip;                    // Head sectors already heard, dropped at the hand-over
+    unsigned long missing;       // Head sectors the reader had not delivered in time
+    sector_deemph_t deemph;      // De-emphasis of the incoming track
+    int16_t head_pcm[CD_SAMPLES_PER_SECTOR];
+    float tail[CD_SAMPLES_PER_SECTOR];
+    float head[CD_SAMPLES_PER_SECTOR];
+} audio_crossfade_t;
+
+// Function declarations
+void audio_crossfade_init(audio_crossfade_t *xfade);
+void audio_crossfade_reset(audio_crossfade_t *xfade);
+void audio_crossfade_begin(audio_crossfade_t *xfade, int to_track, int to_start, int sectors);
+bool audio_crossfade_mix(audio_crossfade_t *xfade, int16_t *tail, const int16_t *head,
+                         bool emphasized, float head_gain);
+
+#endif
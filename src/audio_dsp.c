@@ -0,0 +1,604 @@
+#include "audio_dsp.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static const char *dsp_band_names[] = {
+    [AUDIO_DSP_PEAKING]    = "peq",
+    [AUDIO_DSP_LOW_SHELF]  = "lowshelf",
+    [AUDIO_DSP_HIGH_SHELF] = "highshelf",
+};
+
+static uint64_t dsp_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static float dsp_db_to_gain(double db) {
+    return (float)pow(10.0, db / 20.0);
+}
+
+// Samples stay at int16 scale in float, so the limiter threshold is
+// relative to full scale 32768
+void audio_dsp_to_float(const int16_t *src, float *dst, size_t count) {
+    size_t i = 0;
+    
+#if defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) {
+        int16x8_t v = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+        vst1q_f32(dst + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+    }
+#elif defined(__SSE2__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(lo));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(hi));
+    }
+#endif
+    
+    for (; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void audio_dsp_to_int16(const float *src, int16_t *dst, size_t count) {
+    size_t i = 0;
+    
+#if defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) {
+#if defined(__aarch64__)
+        int32x4_t lo = vcvtnq_s32_f32(vld1q_f32(src + i));
+        int32x4_t hi = vcvtnq_s32_f32(vld1q_f32(src + i + 4));
+#else
+        int32x4_t lo = vcvtq_s32_f32(vld1q_f32(src + i));
+        int32x4_t hi = vcvtq_s32_f32(vld1q_f32(src + i + 4));
+#endif
+        vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+#elif defined(__SSE2__)
+    // Clamp first: out-of-range conversions come back as INT_MIN
+    __m128 max = _mm_set1_ps(32767.0f);
+    __m128 min = _mm_set1_ps(-32768.0f);
+    for (; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), min), max));
+        __m128i hi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), min), max));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(lo, hi));
+    }
+#endif
+    
+    for (; i < count; i++) {
+        long s = lrintf(src[i]);
+        dst[i] = (int16_t)(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+    }
+}
+
+// x *= gain over count samples
+void audio_dsp_scale(float *x, size_t count, float gain) {
+    size_t i = 0;
+    
+#if defined(__ARM_NEON)
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(x + i, vmulq_n_f32(vld1q_f32(x + i), gain));
+    }
+#elif defined(__SSE2__)
+    __m128 g = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(x + i, _mm_mul_ps(_mm_loadu_ps(x + i), g));
+    }
+#endif
+    
+    for (; i < count; i++) {
+        x[i] *= gain;
+    }
+}
+
+// Stereo frames scaled by gain, gain + step, gain + 2 * step, ...
+static void dsp_ramp(float *x, size_t frames, float gain, float step) {
+    size_t f = 0;
+    
+#if defined(__ARM_NEON)
+    // Two frames per vector: lanes L0 R0 L1 R1
+    float init[4] = { gain, gain, gain + step, gain + step };
+    float32x4_t g = vld1q_f32(init);
+    float32x4_t d = vdupq_n_f32(2.0f * step);
+    for (; f + 2 <= frames; f += 2) {
+        vst1q_f32(x + f * 2, vmulq_f32(vld1q_f32(x + f * 2), g));
+        g = vaddq_f32(g, d);
+    }
+#elif defined(__SSE2__)
+    __m128 g = _mm_setr_ps(gain, gain, gain + step, gain + step);
+    __m128 d = _mm_set1_ps(2.0f * step);
+    for (; f + 2 <= frames; f += 2) {
+        _mm_storeu_ps(x + f * 2, _mm_mul_ps(_mm_loadu_ps(x + f * 2), g));
+        g = _mm_add_ps(g, d);
+    }
+#endif
+    
+    for (; f < frames; f++) {
+        float g1 = gain + step * f;
+        x[f * 2] *= g1;
+        x[f * 2 + 1] *= g1;
+    }
+}
+
+// Largest magnitude among count samples
+float audio_dsp_peak(const float *x, size_t count) {
+    size_t i = 0;
+    float peak = 0.0f;
+    
+#if defined(__ARM_NEON)
+    float32x4_t m = vdupq_n_f32(0.0f);
+    for (; i + 4 <= count; i += 4) {
+        m = vmaxq_f32(m, vabsq_f32(vld1q_f32(x + i)));
+    }
+    float32x2_t m2 = vpmax_f32(vget_low_f32(m), vget_high_f32(m));
+    peak = vget_lane_f32(vpmax_f32(m2, m2), 0);
+#elif defined(__SSE2__)
+    __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 m = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        m = _mm_max_ps(m, _mm_andnot_ps(sign, _mm_loadu_ps(x + i)));
+    }
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    peak = _mm_cvtss_f32(m);
+#endif
+    
+    for (; i < count; i++) {
+        float a = fabsf(x[i]);
+        if (a > peak) {
+            peak = a;
+        }
+    }
+    return peak;
+}
+
+// RBJ cookbook coefficients, normalised by a0
+void audio_dsp_band_design(audio_dsp_band_t *band) {
+    double a = pow(10.0, band->gain_db / 40.0);
+    double w0 = 2.0 * M_PI * band->freq / PCM_OUTPUT_RATE;
+    double cw = cos(w0);
+    double alpha = sin(w0) / (2.0 * band->q);
+    double sa = 2.0 * sqrt(a) * alpha;
+    double b0, b1, b2, a0, a1, a2;
+    
+    switch (band->type) {
+        case AUDIO_DSP_LOW_SHELF:
+            b0 = a * ((a + 1) - (a - 1) * cw + sa);
+            b1 = 2 * a * ((a - 1) - (a + 1) * cw);
+            b2 = a * ((a + 1) - (a - 1) * cw - sa);
+            a0 = (a + 1) + (a - 1) * cw + sa;
+            a1 = -2 * ((a - 1) + (a + 1) * cw);
+            a2 = (a + 1) + (a - 1) * cw - sa;
+            break;
+        case AUDIO_DSP_HIGH_SHELF:
+            b0 = a * ((a + 1) + (a - 1) * cw + sa);
+            b1 = -2 * a * ((a - 1) + (a + 1) * cw);
+            b2 = a * ((a + 1) + (a - 1) * cw - sa);
+            a0 = (a + 1) - (a - 1) * cw + sa;
+            a1 = 2 * ((a - 1) - (a + 1) * cw);
+            a2 = (a + 1) - (a - 1) * cw - sa;
+            break;
+        default:
+            b0 = 1 + alpha * a;
+            b1 = -2 * cw;
+            b2 = 1 - alpha * a;
+            a0 = 1 + alpha / a;
+            a1 = -2 * cw;
+            a2 = 1 - alpha / a;
+            break;
+    }
+    
+    band->b0 = (float)(b0 / a0);
+    band->b1 = (float)(b1 / a0);
+    band->b2 = (float)(b2 / a0);
+    band->a1 = (float)(a1 / a0);
+    band->a2 = (float)(a2 / a0);
+}
+
+// One band over a block in place. Each output depends on the previous
+// one, so the vector lanes carry the two channels side by side.
+void audio_dsp_biquad(audio_dsp_band_t *band, float *x, size_t frames) {
+#if defined(__ARM_NEON)
+    float32x2_t z1 = vld1_f32(band->z1);
+    float32x2_t z2 = vld1_f32(band->z2);
+    for (size_t f = 0; f < frames; f++) {
+        float32x2_t in = vld1_f32(x + f * 2);
+        float32x2_t y = vmla_n_f32(z1, in, band->b0);
+        z1 = vmls_n_f32(vmla_n_f32(z2, in, band->b1), y, band->a1);
+        z2 = vmls_n_f32(vmul_n_f32(in, band->b2), y, band->a2);
+        vst1_f32(x + f * 2, y);
+    }
+    vst1_f32(band->z1, z1);
+    vst1_f32(band->z2, z2);
+#elif defined(__SSE2__)
+    __m128 b0 = _mm_set1_ps(band->b0);
+    __m128 b1 = _mm_set1_ps(band->b1);
+    __m128 b2 = _mm_set1_ps(band->b2);
+    __m128 a1 = _mm_set1_ps(band->a1);
+    __m128 a2 = _mm_set1_ps(band->a2);
+    __m128 z1 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)band->z1);
+    __m128 z2 = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)band->z2);
+    for (size_t f = 0; f < frames; f++) {
+        __m128 in = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(x + f * 2));
+        __m128 y = _mm_add_ps(_mm_mul_ps(in, b0), z1);
+        z1 = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(in, b1), z2), _mm_mul_ps(y, a1));
+        z2 = _mm_sub_ps(_mm_mul_ps(in, b2), _mm_mul_ps(y, a2));
+        _mm_storel_pi((__m64 *)(x + f * 2), y);
+    }
+    _mm_storel_pi((__m64 *)band->z1, z1);
+    _mm_storel_pi((__m64 *)band->z2, z2);
+#else
+    for (int c = 0; c < 2; c++) {
+        float z1 = band->z1[c];
+        float z2 = band->z2[c];
+        for (size_t f = 0; f < frames; f++) {
+            float in = x[f * 2 + c];
+            float y = band->b0 * in + z1;
+            z1 = band->b1 * in - band->a1 * y + z2;
+            z2 = band->b2 * in - band->a2 * y;
+            x[f * 2 + c] = y;
+        }
+        band->z1[c] = z1;
+        band->z2[c] = z2;
+    }
+#endif
+    
+    // A decaying tail would otherwise end up in slow denormals
+    for (int c = 0; c < 2; c++) {
+        if (fabsf(band->z1[c]) < 1e-15f) {
+            band->z1[c] = 0.0f;
+        }
+        if (fabsf(band->z2[c]) < 1e-15f) {
+            band->z2[c] = 0.0f;
+        }
+    }
+}
+
+static void dsp_volume(audio_dsp_stage_t *stage, float *x, size_t frames) {
+    size_t done = 0;
+    
+    if (stage->ramp_left > 0) {
+        done = frames < (size_t)stage->ramp_left ? frames : (size_t)stage->ramp_left;
+        dsp_ramp(x, done, stage->gain + stage->step, stage->step);
+        stage->ramp_left -= (int)done;
+        stage->gain = stage->ramp_left > 0 ? stage->gain + stage->step * done : stage->target;
+    }
+    
+    if (done < frames && stage->gain != 1.0f) {
+        audio_dsp_scale(x + done * 2, (frames - done) * 2, stage->gain);
+    }
+}
+
+static void dsp_limiter(audio_dsp_stage_t *stage, float *x, size_t frames) {
+    // Nothing over the threshold and fully recovered: nothing to do
+    if (stage->envelope >= 1.0f && audio_dsp_peak(x, frames * 2) <= stage->threshold) {
+        return;
+    }
+    
+    float env = stage->envelope;
+    for (size_t f = 0; f < frames; f++) {
+        float peak = fmaxf(fabsf(x[f * 2]), fabsf(x[f * 2 + 1]));
+        float target = peak > stage->threshold ? stage->threshold / peak : 1.0f;
+        env = target < env ? target : target + (env - target) * stage->release;
+        x[f * 2] *= env;
+        x[f * 2 + 1] *= env;
+    }
+    stage->envelope = env > 0.9999f ? 1.0f : env;
+}
+
+static void dsp_run_stage(audio_dsp_stage_t *stage, float *x, size_t frames) {
+    switch (stage->type) {
+        case AUDIO_DSP_VOLUME:
+            dsp_volume(stage, x, frames);
+            break;
+        case AUDIO_DSP_EQ:
+            for (int b = 0; b < stage->band_count; b++) {
+                audio_dsp_biquad(&stage->bands[b], x, frames);
+            }
+            break;
+        case AUDIO_DSP_LIMITER:
+            dsp_limiter(stage, x, frames);
+            break;
+    }
+}
+
+// Short name for the logs
+static void dsp_stage_name(const audio_dsp_stage_t *stage, char *name, size_t size) {
+    switch (stage->type) {
+        case AUDIO_DSP_VOLUME:
+            snprintf(name, size, "volume");
+            break;
+        case AUDIO_DSP_EQ:
+            snprintf(name, size, "eq (%d band%s)", stage->band_count, stage->band_count == 1 ? "" : "s");
+            break;
+        case AUDIO_DSP_LIMITER:
+            snprintf(name, size, "limiter");
+            break;
+    }
+}
+
+// Time spent per stage as a share of one core, against the audio it covered
+static void dsp_report(audio_dsp_t *dsp) {
+    double audio_ns = dsp->frames * 1e9 / PCM_OUTPUT_RATE;
+    char line[512];
+    size_t len = snprintf(line, sizeof(line), "📊 DSP load over %.0f s:", audio_ns / 1e9);
+    
+    for (int i = 0; i < dsp->stage_count && len < sizeof(line); i++) {
+        char name[32];
+        dsp_stage_name(&dsp->stages[i], name, sizeof(name));
+        len += snprintf(line + len, sizeof(line) - len, " %s %.2f%%,", name, dsp->stages[i].ns * 100.0 / audio_ns);
+        dsp->stages[i].ns = 0;
+    }
+    if (len < sizeof(line)) {
+        snprintf(line + len, sizeof(line) - len, " conversion %.2f%% of one core", dsp->convert_ns * 100.0 / audio_ns);
+    }
+    printf("%s\n", line);
+    
+    dsp->convert_ns = 0;
+    dsp->frames = 0;
+}
+
+static void dsp_volume_stage_init(audio_dsp_stage_t *stage, double db, double ramp_ms) {
+    memset(stage, 0, sizeof(audio_dsp_stage_t));
+    stage->type = AUDIO_DSP_VOLUME;
+    stage->level_db = db;
+    stage->gain = dsp_db_to_gain(db);
+    stage->target = stage->gain;
+    stage->ramp_frames = (int)(ramp_ms * PCM_OUTPUT_RATE / 1000.0);
+}
+
+// Chain of a single volume stage at 0 dB: a pass-through
+void audio_dsp_init(audio_dsp_t *dsp) {
+    memset(dsp, 0, sizeof(audio_dsp_t));
+    dsp_volume_stage_init(&dsp->stages[0], 0.0, AUDIO_DSP_RAMP_MS);
+    dsp->stage_count = 1;
+    dsp->volume_stage = 0;
+    atomic_init(&dsp->volume_mb, 0);
+}
+
+// Room for one more stage, keeping a slot for the volume stage until there is one
+static audio_dsp_stage_t *dsp_add_stage(audio_dsp_t *dsp, audio_dsp_stage_type_t type, bool have_volume) {
+    if (dsp->stage_count >= AUDIO_DSP_MAX_STAGES - (have_volume ? 0 : 1)) {
+        return NULL;
+    }
+    audio_dsp_stage_t *stage = &dsp->stages[dsp->stage_count++];
+    memset(stage, 0, sizeof(audio_dsp_stage_t));
+    stage->type = type;
+    return stage;
+}
+
+// One config line into the chain. Returns -1 when it makes no sense.
+static int dsp_parse_line(audio_dsp_t *dsp, const char *line, bool *have_volume) {
+    char kind[16];
+    double a, b, c;
+    int fields = sscanf(line, "%15s %lf %lf %lf", kind, &a, &b, &c);
+    
+    if (strcmp(kind, "volume") == 0) {
+        double ramp = fields >= 3 ? b : AUDIO_DSP_RAMP_MS;
+        if (*have_volume || fields < 2 || a < AUDIO_DSP_VOLUME_MIN_DB || a > AUDIO_DSP_VOLUME_MAX_DB ||
+            ramp < 0 || ramp > 1000) {
+            return -1;
+        }
+        audio_dsp_stage_t *stage = dsp_add_stage(dsp, AUDIO_DSP_VOLUME, true);
+        if (!stage) {
+            return -1;
+        }
+        dsp_volume_stage_init(stage, a, ramp);
+        dsp->volume_stage = dsp->stage_count - 1;
+        *have_volume = true;
+        return 0;
+    }
+    
+    if (strcmp(kind, "peq") == 0 || strcmp(kind, "lowshelf") == 0 || strcmp(kind, "highshelf") == 0) {
+        bool peaking = (strcmp(kind, "peq") == 0);
+        double q = fields >= 4 ? c : AUDIO_DSP_SHELF_Q;
+        if (fields < (peaking ? 4 : 3) || a < 10 || a >= PCM_OUTPUT_RATE / 2 ||
+            b < -24 || b > 24 || q <= 0 || q > 20) {
+            return -1;
+        }
+    
+        // Consecutive bands share one EQ stage
+        audio_dsp_stage_t *stage = dsp->stage_count > 0 ? &dsp->stages[dsp->stage_count - 1] : NULL;
+        if (!stage || stage->type != AUDIO_DSP_EQ || stage->band_count == AUDIO_DSP_MAX_BANDS) {
+            stage = dsp_add_stage(dsp, AUDIO_DSP_EQ, *have_volume);
+            if (!stage) {
+                return -1;
+            }
+        }
+    
+        audio_dsp_band_t *band = &stage->bands[stage->band_count++];
+        band->type = peaking ? AUDIO_DSP_PEAKING :
+                     (strcmp(kind, "lowshelf") == 0 ? AUDIO_DSP_LOW_SHELF : AUDIO_DSP_HIGH_SHELF);
+        band->freq = a;
+        band->gain_db = b;
+        band->q = q;
+        audio_dsp_band_design(band);
+        return 0;
+    }
+    
+    if (strcmp(kind, "limiter") == 0) {
+        double release = fields >= 3 ? b : AUDIO_DSP_LIMITER_RELEASE_MS;
+        if (fields < 2 || a < -30 || a > 0 || release <= 0 || release > 5000) {
+            return -1;
+        }
+        audio_dsp_stage_t *stage = dsp_add_stage(dsp, AUDIO_DSP_LIMITER, *have_volume);
+        if (!stage) {
+            return -1;
+        }
+        stage->threshold_db = a;
+        stage->threshold = 32768.0f * dsp_db_to_gain(a);
+        stage->release = (float)exp(-1000.0 / (release * PCM_OUTPUT_RATE));
+        stage->envelope = 1.0f;
+        return 0;
+    }
+    
+    return -1;
+}
+
+// Build the chain from the config file. Lines that make no sense are
+// skipped with a warning; without a file the chain stays a pass-through.
+int audio_dsp_load(audio_dsp_t *dsp, const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return 0;
+    }
+    
+    dsp->stage_count = 0;
+    bool have_volume = false;
+    char line[256];
+    int number = 0;
+    
+    while (fgets(line, sizeof(line), file)) {
+        number++;
+        char *comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+        line[strcspn(line, "\r\n")] = '\0';
+    
+        char kind[16];
+        if (sscanf(line, "%15s", kind) != 1) {
+            continue;
+        }
+        if (dsp_parse_line(dsp, line, &have_volume) != 0) {
+            printf("⚠️  %s line %d skipped: \"%s\"\n", path, number, line);
+        }
+    }
+    fclose(file);
+    
+    // The volume control needs a stage: unity gain ahead of everything else
+    if (!have_volume) {
+        memmove(&dsp->stages[1], &dsp->stages[0], dsp->stage_count * sizeof(audio_dsp_stage_t));
+        dsp_volume_stage_init(&dsp->stages[0], 0.0, AUDIO_DSP_RAMP_MS);
+        dsp->stage_count++;
+        dsp->volume_stage = 0;
+    }
+    
+    const audio_dsp_stage_t *volume = &dsp->stages[dsp->volume_stage];
+    dsp->applied_mb = (int)lround(volume->level_db * 100.0);
+    atomic_store(&dsp->volume_mb, dsp->applied_mb);
+    
+    printf("🎛️  DSP chain from %s:\n", path);
+    for (int i = 0; i < dsp->stage_count; i++) {
+        const audio_dsp_stage_t *stage = &dsp->stages[i];
+        switch (stage->type) {
+            case AUDIO_DSP_VOLUME:
+                printf("🎛️    %d. volume %.1f dB (%d ms ramps)\n", i + 1, stage->level_db,
+                       stage->ramp_frames * 1000 / PCM_OUTPUT_RATE);
+                break;
+            case AUDIO_DSP_EQ:
+                for (int b = 0; b < stage->band_count; b++) {
+                    const audio_dsp_band_t *band = &stage->bands[b];
+                    printf("🎛️    %d. %s %.0f Hz %+.1f dB Q %.2f\n", i + 1, dsp_band_names[band->type],
+                           band->freq, band->gain_db, band->q);
+                }
+                break;
+            case AUDIO_DSP_LIMITER:
+                printf("🎛️    %d. limiter at %.1f dBFS\n", i + 1, stage->threshold_db);
+                break;
+        }
+    }
+    return 0;
+}
+
+// Forget filter and limiter state: what comes next does not follow on from
+// what was processed last (seek, new track)
+void audio_dsp_reset(audio_dsp_t *dsp) {
+    for (int i = 0; i < dsp->stage_count; i++) {
+        audio_dsp_stage_t *stage = &dsp->stages[i];
+        for (int b = 0; b < stage->band_count; b++) {
+            memset(stage->bands[b].z1, 0, sizeof(stage->bands[b].z1));
+            memset(stage->bands[b].z2, 0, sizeof(stage->bands[b].z2));
+        }
+        stage->envelope = 1.0f;
+    }
+}
+
+// Pick up a volume change from another thread: ramp to it
+static void dsp_apply_volume(audio_dsp_t *dsp) {
+    int mb = atomic_load_explicit(&dsp->volume_mb, memory_order_relaxed);
+    if (mb == dsp->applied_mb) {
+        return;
+    }
+    
+    audio_dsp_stage_t *stage = &dsp->stages[dsp->volume_stage];
+    dsp->applied_mb = mb;
+    stage->level_db = mb / 100.0;
+    stage->target = dsp_db_to_gain(stage->level_db);
+    stage->ramp_left = stage->ramp_frames;
+    if (stage->ramp_left > 0) {
+        stage->step = (stage->target - stage->gain) / stage->ramp_left;
+    } else {
+        stage->gain = stage->target;
+    }
+}
+
+// Whole chain is a no-op: unity volume, not ramping, nothing else
+static bool dsp_bypassed(const audio_dsp_t *dsp) {
+    const audio_dsp_stage_t *volume = &dsp->stages[dsp->volume_stage];
+    return dsp->stage_count == 1 && volume->gain == 1.0f && volume->ramp_left == 0;
+}
+
+// Run the chain over interleaved stereo in place (engine only)
+void audio_dsp_process(audio_dsp_t *dsp, int16_t *samples, size_t frames) {
+    dsp_apply_volume(dsp);
+    if (dsp_bypassed(dsp)) {
+        return;
+    }
+    
+    for (size_t done = 0; done < frames;) {
+        size_t count = frames - done;
+        if (count > AUDIO_DSP_BLOCK) {
+            count = AUDIO_DSP_BLOCK;
+        }
+        int16_t *pcm = samples + done * PCM_OUTPUT_CHANNELS;
+    
+        uint64_t start = dsp_now_ns();
+        audio_dsp_to_float(pcm, dsp->block, count * PCM_OUTPUT_CHANNELS);
+        uint64_t now = dsp_now_ns();
+        dsp->convert_ns += now - start;
+    
+        for (int i = 0; i < dsp->stage_count; i++) {
+            dsp_run_stage(&dsp->stages[i], dsp->block, count);
+            uint64_t then = now;
+            now = dsp_now_ns();
+            dsp->stages[i].ns += now - then;
+        }
+    
+        audio_dsp_to_int16(dsp->block, pcm, count * PCM_OUTPUT_CHANNELS);
+        dsp->convert_ns += dsp_now_ns() - now;
+        done += count;
+    }
+    
+    dsp->frames += frames;
+    if (dsp->frames >= (uint64_t)AUDIO_DSP_REPORT_SECONDS * PCM_OUTPUT_RATE) {
+        dsp_report(dsp);
+    }
+}
+
+// Any thread; the engine ramps to the new level
+void audio_dsp_set_volume(audio_dsp_t *dsp, double db) {
+    if (db < AUDIO_DSP_VOLUME_MIN_DB) {
+        db = AUDIO_DSP_VOLUME_MIN_DB;
+    } else if (db > AUDIO_DSP_VOLUME_MAX_DB) {
+        db = AUDIO_DSP_VOLUME_MAX_DB;
+    }
+    atomic_store_explicit(&dsp->volume_mb, (int)lround(db * 100.0), memory_order_relaxed);
+}
+
+double audio_dsp_get_volume(audio_dsp_t *dsp) {
+    return atomic_load_explicit(&dsp->volume_mb, memory_order_relaxed) / 100.0;
+}
@@ -0,0 +1,115 @@
+#ifndef AUDIO_DSP_H
+#define AUDIO_DSP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "pcm_output.h"
+#include "assets.h"
+
+// Chain declared one stage per line, applied top to bottom; consecutive
+// EQ lines form one stage. Without a volume line the chain starts with one
+// at 0 dB, so the volume control always has a stage to act on.
+//
+//   volume    <dB> [ramp ms]
+//   peq       <Hz> <gain dB> <Q>
+//   lowshelf  <Hz> <gain dB> [Q]
+//   highshelf <Hz> <gain dB> [Q]
+//   limiter   <threshold dBFS> [release ms]
+#define AUDIO_DSP_CONFIG_FILE CDPLAYER_CONFIG_DIR "/dsp.conf"
+
+#define AUDIO_DSP_MAX_STAGES 8
+#define AUDIO_DSP_MAX_BANDS 10
+
+// Frames converted to float and run through the chain per pass
+#define AUDIO_DSP_BLOCK 512
+
+#define AUDIO_DSP_RAMP_MS 50
+#define AUDIO_DSP_SHELF_Q 0.707
+#define AUDIO_DSP_LIMITER_RELEASE_MS 100
+#define AUDIO_DSP_VOLUME_MIN_DB -60.0
+#define AUDIO_DSP_VOLUME_MAX_DB 12.0
+
+// Stage CPU time is logged after this much audio
+#define AUDIO_DSP_REPORT_SECONDS 60
+
+typedef enum {
+    AUDIO_DSP_VOLUME = 0,
+    AUDIO_DSP_EQ,
+    AUDIO_DSP_LIMITER
+} audio_dsp_stage_type_t;
+
+typedef enum {
+    AUDIO_DSP_PEAKING = 0,
+    AUDIO_DSP_LOW_SHELF,
+    AUDIO_DSP_HIGH_SHELF
+} audio_dsp_band_type_t;
+
+// One biquad (transposed direct form II), state per channel
+typedef struct {
+    audio_dsp_band_type_t type;
+    double freq;
+    double gain_db;
+    double q;
+    float b0, b1, b2, a1, a2;
+    float z1[2];
+    float z2[2];
+} audio_dsp_band_t;
+
+typedef struct {
+    audio_dsp_stage_type_t type;
+    
+    // Volume: linear gain ramping to target over ramp_frames
+    double level_db;
+    float gain;
+    float target;
+    float step;                  // Gain change per frame while ramping
+    int ramp_left;               // Frames until target is reached
+    int ramp_frames;
+    
+    // EQ
+    audio_dsp_band_t bands[AUDIO_DSP_MAX_BANDS];
+    int band_count;
+    
+    // Limiter: gain drops at once to keep peaks under threshold, then
+    // recovers with release
+    double threshold_db;
+    float threshold;
+    float release;               // Per-frame recovery coefficient
+    float envelope;
+    
+    uint64_t ns;                 // Time spent since the last report
+} audio_dsp_stage_t;
+
+// Volume, EQ and limiter on the stream between the ring and the outputs.
+// Runs on the playback engine in place, a block at a time, in float; only
+// the volume request may come from other threads.
+typedef struct {
+    audio_dsp_stage_t stages[AUDIO_DSP_MAX_STAGES];
+    int stage_count;
+    int volume_stage;
+    
+    atomic_int volume_mb;        // Requested volume in millibels (1/100 dB)
+    int applied_mb;              // Engine only
+    
+    float block[AUDIO_DSP_BLOCK * PCM_OUTPUT_CHANNELS];
+    uint64_t convert_ns;         // int16 <-> float, since the last report
+    uint64_t frames;             // Processed since the last report
+} audio_dsp_t;
+
+// Function declarations
+void audio_dsp_init(audio_dsp_t *dsp);
+int audio_dsp_load(audio_dsp_t *dsp, const char *path);
+void audio_dsp_reset(audio_dsp_t *dsp);
+void audio_dsp_process(audio_dsp_t *dsp, int16_t *samples, size_t frames);
+void audio_dsp_set_volume(audio_dsp_t *dsp, double db);
+double audio_dsp_get_volume(audio_dsp_t *dsp);
+void audio_dsp_band_design(audio_dsp_band_t *band);
+void audio_dsp_biquad(audio_dsp_band_t *band, float *x, size_t frames);
+void audio_dsp_to_float(const int16_t *src, float *dst, size_t count);
+void audio_dsp_to_int16(const float *src, int16_t *dst, size_t count);
+void audio_dsp_scale(float *x, size_t count, float gain);
+float audio_dsp_peak(const float *x, size_t count);
+
+#endif
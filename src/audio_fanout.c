@@ -0,0 +1,631 @@
+#include "audio_fanout.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <time.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+
+// Sink thread wait when nothing arrives (flush, pause and exit wake it early)
+#define FANOUT_WAIT_MS 500
+
+// A sink measurement older than this is not compared
+#define FANOUT_STALE_NS 250000000ULL
+
+// Resampled frames staged per ring write
+#define FANOUT_SCRATCH_FRAMES 512
+
+static uint64_t fanout_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void fanout_wake(fanout_sink_t *sink) {
+    uint64_t one = 1;
+    if (write(sink->wake_fd, &one, sizeof(one)) < 0) {
+        // Counter saturated: a wake-up is already pending
+    }
+}
+
+static void fanout_wait(int fd, int timeout_ms) {
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    
+    if (poll(&pfd, 1, timeout_ms) > 0) {
+        uint64_t count;
+        if (read(fd, &count, sizeof(count)) < 0) {
+            // Already drained
+        }
+    }
+}
+
+// Frames queued ahead of the listener once the device buffer is full
+static snd_pcm_sframes_t fanout_latency(pcm_output_t *out) {
+    return (snd_pcm_sframes_t)out->buffer_size + out->transport_delay;
+}
+
+// Sink side: what is being heard right now (seqlock, the sink is the writer)
+static void fanout_sink_publish(fanout_sink_t *sink, long long heard, uint64_t stamp_ns) {
+    unsigned int seq = atomic_load_explicit(&sink->measure_seq, memory_order_relaxed);
+    
+    atomic_store_explicit(&sink->measure_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&sink->heard_index, heard, memory_order_relaxed);
+    atomic_store_explicit(&sink->stamp_ns, stamp_ns, memory_order_relaxed);
+    atomic_store_explicit(&sink->measure_seq, seq + 2, memory_order_release);
+}
+
+static bool fanout_sink_measurement(fanout_sink_t *sink, long long *heard, uint64_t *stamp_ns) {
+    unsigned int seq;
+    
+    do {
+        seq = atomic_load_explicit(&sink->measure_seq, memory_order_acquire);
+        if (seq & 1) {
+            continue; // Sink is mid-update
+        }
+        *heard = atomic_load_explicit(&sink->heard_index, memory_order_relaxed);
+        *stamp_ns = atomic_load_explicit(&sink->stamp_ns, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || atomic_load_explicit(&sink->measure_seq, memory_order_relaxed) != seq);
+    
+    return *stamp_ns != 0;
+}
+
+// Sink thread: moves frames from the ring into its own PCM and reports what
+// it is playing. Nothing here can hold up the engine.
+static void *fanout_sink_thread(void *arg) {
+    fanout_sink_t *sink = (fanout_sink_t *)arg;
+    pcm_output_t *out = &sink->output;
+    unsigned int flush_seq = atomic_load_explicit(&sink->flush_seq, memory_order_acquire);
+    bool paused = false;
+    
+    while (!atomic_load_explicit(&sink->stop, memory_order_acquire)) {
+        unsigned int seq = atomic_load_explicit(&sink->flush_seq, memory_order_acquire);
+        if (seq != flush_seq) {
+            flush_seq = seq;
+            unsigned long long flush_index = atomic_load_explicit(&sink->flush_index, memory_order_relaxed);
+            if (flush_index > atomic_load_explicit(&sink->tail, memory_order_relaxed)) {
+                atomic_store_explicit(&sink->tail, flush_index, memory_order_release);
+            }
+            snd_pcm_drop(out->handle);
+            pcm_output_prepare(out);
+            fanout_sink_publish(sink, 0, 0);
+        }
+    
+        bool pause = atomic_load_explicit(&sink->paused, memory_order_acquire);
+        if (pause != paused) {
+            paused = pause;
+            snd_pcm_state_t state = snd_pcm_state(out->handle);
+            if ((state == SND_PCM_STATE_RUNNING || state == SND_PCM_STATE_PAUSED) &&
+                snd_pcm_pause(out->handle, pause) < 0) {
+                // No pause support: restart from what is left in the ring
+                snd_pcm_drop(out->handle);
+                pcm_output_prepare(out);
+            }
+            fanout_sink_publish(sink, 0, 0);
+        }
+    
+        if (paused || atomic_load_explicit(&sink->lost, memory_order_relaxed)) {
+            fanout_wait(sink->wake_fd, FANOUT_WAIT_MS);
+            continue;
+        }
+    
+        unsigned long long tail = atomic_load_explicit(&sink->tail, memory_order_relaxed);
+        if (atomic_load_explicit(&sink->head, memory_order_acquire) == tail) {
+            // Ask the engine for a wake-up, then look again so a push in
+            // between is never missed
+            atomic_store_explicit(&sink->waiting, true, memory_order_seq_cst);
+            if (atomic_load_explicit(&sink->head, memory_order_seq_cst) == tail) {
+                fanout_wait(sink->wake_fd, FANOUT_WAIT_MS);
+            }
+            atomic_store_explicit(&sink->waiting, false, memory_order_relaxed);
+            continue;
+        }
+    
+        int16_t *dst;
+        snd_pcm_uframes_t frames = atomic_load_explicit(&sink->head, memory_order_acquire) - tail;
+        if (pcm_output_begin(out, &dst, &frames) < 0) {
+            if (snd_pcm_state(out->handle) == SND_PCM_STATE_DISCONNECTED) {
+                printf("❌ Lost audio device %s\n", out->device_name);
+                atomic_store_explicit(&sink->lost, true, memory_order_release);
+                fanout_sink_publish(sink, 0, 0);
+            }
+            continue;
+        }
+    
+        if (frames == 0) {
+            pcm_output_wait(out, sink->wake_fd, FANOUT_WAIT_MS);
+            fanout_wait(sink->wake_fd, 0);
+            continue;
+        }
+    
+        size_t index = tail % AUDIO_FANOUT_RING_FRAMES;
+        size_t first = AUDIO_FANOUT_RING_FRAMES - index;
+        if (first > frames) {
+            first = frames;
+        }
+        memcpy(dst, sink->frames + index * PCM_OUTPUT_CHANNELS, first * PCM_OUTPUT_FRAME_BYTES);
+        memcpy(dst + first * PCM_OUTPUT_CHANNELS, sink->frames, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+        atomic_store_explicit(&sink->tail, tail + frames, memory_order_release);
+    
+        if (pcm_output_commit(out, frames) < 0) {
+            continue;
+        }
+    
+        snd_pcm_sframes_t delay;
+        if (snd_pcm_state(out->handle) == SND_PCM_STATE_RUNNING && !out->start_pending &&
+            pcm_output_delay(out, &delay) == 0) {
+            fanout_sink_publish(sink, (long long)(tail + frames) - delay, fanout_now_ns());
+        }
+    }
+    
+    snd_pcm_drop(out->handle);
+    return NULL;
+}
+
+// Copy frames into the sink's ring (NULL: silence). Never waits: what does
+// not fit is left out. Returns the frames queued.
+static size_t fanout_sink_push(fanout_sink_t *sink, const int16_t *samples, size_t frames) {
+    unsigned long long head = atomic_load_explicit(&sink->head, memory_order_relaxed);
+    unsigned long long tail = atomic_load_explicit(&sink->tail, memory_order_acquire);
+    size_t room = AUDIO_FANOUT_RING_FRAMES - (size_t)(head - tail);
+    if (frames > room) {
+        frames = room;
+    }
+    if (frames == 0) {
+        return 0;
+    }
+    
+    size_t index = head % AUDIO_FANOUT_RING_FRAMES;
+    size_t first = AUDIO_FANOUT_RING_FRAMES - index;
+    if (first > frames) {
+        first = frames;
+    }
+    int16_t *dst = sink->frames + index * PCM_OUTPUT_CHANNELS;
+    if (samples) {
+        memcpy(dst, samples, first * PCM_OUTPUT_FRAME_BYTES);
+        memcpy(sink->frames, samples + first * PCM_OUTPUT_CHANNELS, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+    } else {
+        memset(dst, 0, first * PCM_OUTPUT_FRAME_BYTES);
+        memset(sink->frames, 0, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+    }
+    
+    atomic_store_explicit(&sink->head, head + frames, memory_order_release);
+    if (atomic_exchange_explicit(&sink->waiting, false, memory_order_acq_rel)) {
+        fanout_wake(sink);
+    }
+    return frames;
+}
+
+// Silence ahead of the sink's stream, moving it later by frames
+static void fanout_sink_delay(fanout_sink_t *sink, size_t frames) {
+    sink->offset += (long long)fanout_sink_push(sink, NULL, frames);
+}
+
+// Stream frames through the sink's resampler into its ring. Returns the
+// resampled frames that did not fit.
+static size_t fanout_sink_feed(fanout_sink_t *sink, const int16_t *samples, size_t frames) {
+    size_t lost = 0;
+    
+    while (frames > 0) {
+        size_t used = frames;
+        size_t produced = audio_resampler_process(&sink->resampler, samples, &used,
+                                                  sink->scratch, FANOUT_SCRATCH_FRAMES);
+        lost += produced - fanout_sink_push(sink, sink->scratch, produced);
+        samples += used * PCM_OUTPUT_CHANNELS;
+        frames -= used;
+    }
+    return lost;
+}
+
+// Drift estimator: error is how far the sink is ahead of the main output,
+// in frames. The integral settles on the sink clock's drift and holds the
+// ratio that cancels it; the proportional term takes out what is left.
+static void fanout_sink_steer(fanout_sink_t *sink, double error) {
+    sink->drift_ppm += AUDIO_FANOUT_DRIFT_KI * error;
+    sink->drift_ppm = fmax(-AUDIO_FANOUT_DRIFT_MAX_PPM, fmin(AUDIO_FANOUT_DRIFT_MAX_PPM, sink->drift_ppm));
+    
+    double ppm = sink->drift_ppm + AUDIO_FANOUT_DRIFT_KP * error;
+    ppm = fmax(-AUDIO_FANOUT_DRIFT_MAX_PPM, fmin(AUDIO_FANOUT_DRIFT_MAX_PPM, ppm));
+    
+    // A sink ahead gets more frames per stream frame, so it slows down
+    audio_resampler_set_ratio(&sink->resampler, 1.0 + ppm / 1e6);
+    
+    if (fabs(sink->drift_ppm - sink->logged_ppm) >= AUDIO_FANOUT_DRIFT_LOG_PPM) {
+        printf("🕰️  %s clock runs %+.0f ppm against the main output\n", sink->output.device_name,
+               sink->drift_ppm);
+        sink->logged_ppm = sink->drift_ppm;
+    }
+}
+
+// Append frames to the main output's delay line (NULL: silence)
+static void fanout_held_write(audio_fanout_t *fanout, const int16_t *samples, size_t frames) {
+    size_t index = (fanout->held_read + fanout->held_frames) % fanout->held_capacity;
+    size_t first = fanout->held_capacity - index;
+    if (first > frames) {
+        first = frames;
+    }
+    int16_t *dst = fanout->held + index * PCM_OUTPUT_CHANNELS;
+    if (samples) {
+        memcpy(dst, samples, first * PCM_OUTPUT_FRAME_BYTES);
+        memcpy(fanout->held, samples + first * PCM_OUTPUT_CHANNELS, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+    } else {
+        memset(dst, 0, first * PCM_OUTPUT_FRAME_BYTES);
+        memset(fanout->held, 0, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+    }
+    fanout->held_frames += frames;
+}
+
+// Take the oldest frames out of the delay line into dst
+static void fanout_held_read(audio_fanout_t *fanout, int16_t *dst, size_t frames) {
+    size_t first = fanout->held_capacity - fanout->held_read;
+    if (first > frames) {
+        first = frames;
+    }
+    memcpy(dst, fanout->held + fanout->held_read * PCM_OUTPUT_CHANNELS, first * PCM_OUTPUT_FRAME_BYTES);
+    memcpy(dst + first * PCM_OUTPUT_CHANNELS, fanout->held, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+    fanout->held_read = (fanout->held_read + frames) % fanout->held_capacity;
+    fanout->held_frames -= frames;
+}
+
+// Hold the main output back further by frames of silence
+static void fanout_held_grow(audio_fanout_t *fanout, size_t frames) {
+    if (fanout->held_frames + frames > AUDIO_FANOUT_MAX_DELAY_FRAMES) {
+        frames = AUDIO_FANOUT_MAX_DELAY_FRAMES - fanout->held_frames;
+    }
+    fanout_held_write(fanout, NULL, frames);
+}
+
+int audio_fanout_init(audio_fanout_t *fanout, pcm_pool_t *pool) {
+    memset(fanout, 0, sizeof(audio_fanout_t));
+    fanout->pool = pool;
+    
+    // Room for the longest delay plus one write of the main output
+    fanout->held_capacity = AUDIO_FANOUT_MAX_DELAY_FRAMES + PCM_OUTPUT_STAGING_FRAMES;
+    fanout->held = malloc(fanout->held_capacity * PCM_OUTPUT_FRAME_BYTES);
+    return fanout->held ? 0 : -1;
+}
+
+static void fanout_sink_dispose(fanout_sink_t *sink) {
+    if (sink->wake_fd >= 0) {
+        close(sink->wake_fd);
+    }
+    audio_resampler_free(&sink->resampler);
+    free(sink->scratch);
+    free(sink->frames);
+    free(sink);
+}
+
+static void fanout_sink_free(fanout_sink_t *sink, pcm_pool_t *pool) {
+    atomic_store_explicit(&sink->stop, true, memory_order_release);
+    fanout_wake(sink);
+    pthread_join(sink->thread, NULL);
+    
+    if (sink->dropped > 0 || sink->corrections > 0) {
+        printf("🔗 %s: %lu frames lost to a full ring, %lu alignment corrections\n",
+               sink->output.device_name, sink->dropped, sink->corrections);
+    }
+    
+    if (pool) {
+        pcm_pool_release(pool, &sink->output, sink->allow_mmap);
+    } else {
+        pcm_output_close(&sink->output);
+    }
+    fanout_sink_dispose(sink);
+}
+
+// Stop every sink and close its device; the engine must be gone
+void audio_fanout_free(audio_fanout_t *fanout) {
+    for (int i = 0; i < fanout->count; i++) {
+        fanout_sink_free(fanout->sinks[i], NULL);
+    }
+    fanout->count = 0;
+    free(fanout->held);
+    fanout->held = NULL;
+}
+
+int audio_fanout_find(audio_fanout_t *fanout, const char *device) {
+    for (int i = 0; i < fanout->count; i++) {
+        if (strcmp(fanout->sinks[i]->output.device_name, device) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Start playing on another opened output; the fan-out owns it from here.
+// It joins the running stream once audio_fanout_align() gives it a lead-in.
+int audio_fanout_add(audio_fanout_t *fanout, pcm_output_t *output, bool allow_mmap) {
+    if (fanout->count >= AUDIO_FANOUT_MAX_SINKS) {
+        printf("❌ At most %d extra outputs can play at once\n", AUDIO_FANOUT_MAX_SINKS);
+        return -1;
+    }
+    
+    fanout_sink_t *sink = calloc(1, sizeof(fanout_sink_t));
+    if (!sink) {
+        return -1;
+    }
+    sink->frames = malloc(AUDIO_FANOUT_RING_FRAMES * PCM_OUTPUT_FRAME_BYTES);
+    sink->scratch = malloc(FANOUT_SCRATCH_FRAMES * PCM_OUTPUT_FRAME_BYTES);
+    sink->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (!sink->frames || !sink->scratch || sink->wake_fd < 0 ||
+        audio_resampler_init(&sink->resampler, 1.0, output->quality) != 0) {
+        fanout_sink_dispose(sink);
+        return -1;
+    }
+    
+    sink->output = *output;
+    sink->allow_mmap = allow_mmap;
+    sink->latency = fanout_latency(&sink->output);
+    atomic_init(&sink->paused, fanout->paused);
+    
+    if (pthread_create(&sink->thread, NULL, fanout_sink_thread, sink) != 0) {
+        printf("❌ Failed to create output thread for %s\n", output->device_name);
+        fanout_sink_dispose(sink);
+        return -1;
+    }
+    
+    memset(output, 0, sizeof(pcm_output_t));
+    fanout->sinks[fanout->count++] = sink;
+    printf("🔗 Also playing on %s (%.1f ms to the listener)\n", sink->output.device_name,
+           sink->latency * 1000.0 / PCM_OUTPUT_RATE);
+    return 0;
+}
+
+// Stop playing on a sink; its device goes back to the standby pool. The
+// main output keeps its delay until the next flush rather than skipping.
+int audio_fanout_remove(audio_fanout_t *fanout, const char *device) {
+    int index = audio_fanout_find(fanout, device);
+    if (index < 0) {
+        return -1;
+    }
+    
+    fanout_sink_t *sink = fanout->sinks[index];
+    fanout->sinks[index] = fanout->sinks[--fanout->count];
+    printf("🔗 No longer playing on %s\n", device);
+    fanout_sink_free(sink, fanout->pool);
+    return 0;
+}
+
+// Latency every output can reach: the slowest one's
+static snd_pcm_sframes_t fanout_target(audio_fanout_t *fanout, pcm_output_t *main) {
+    snd_pcm_sframes_t target = fanout_latency(main);
+    for (int i = 0; i < fanout->count; i++) {
+        if (fanout->sinks[i]->latency > target) {
+            target = fanout->sinks[i]->latency;
+        }
+    }
+    if (target > fanout_latency(main) + AUDIO_FANOUT_MAX_DELAY_FRAMES) {
+        target = fanout_latency(main) + AUDIO_FANOUT_MAX_DELAY_FRAMES;
+    }
+    return target;
+}
+
+// Sinks or the main output changed during a stream: hold the main output
+// back far enough for the slowest device to run with a full buffer, and
+// give new sinks the lead-in that puts them where the main output is.
+// Every frame the main output takes from here on goes to the sinks too, so
+// a sink lines up when what it has queued plus its transport delay equals
+// the delay line plus the main output's delay. The common latency only
+// goes down at the next flush, so nothing audible is skipped.
+void audio_fanout_align(audio_fanout_t *fanout, pcm_output_t *main) {
+    if (fanout->count == 0) {
+        return;
+    }
+    
+    snd_pcm_sframes_t target = fanout_target(fanout, main);
+    if (target > fanout->target) {
+        fanout->target = target;
+    }
+    
+    size_t before = fanout->held_frames;
+    snd_pcm_sframes_t held = fanout->target - fanout_latency(main);
+    if (held > (snd_pcm_sframes_t)fanout->held_frames) {
+        fanout_held_grow(fanout, held - fanout->held_frames);
+    }
+    size_t grown = fanout->held_frames - before;
+    
+    snd_pcm_sframes_t main_delay = 0;
+    pcm_output_delay(main, &main_delay);
+    
+    for (int i = 0; i < fanout->count; i++) {
+        fanout_sink_t *sink = fanout->sinks[i];
+        if (sink->primed) {
+            fanout_sink_delay(sink, grown);
+            continue;
+        }
+    
+        audio_resampler_reset(&sink->resampler);
+        sink->offset = (long long)atomic_load_explicit(&sink->head, memory_order_relaxed) - fanout->frames_in;
+        snd_pcm_sframes_t lead = (snd_pcm_sframes_t)fanout->held_frames + main_delay - sink->output.transport_delay;
+        if (lead > 0) {
+            fanout_sink_delay(sink, lead);
+        } else {
+            sink->skip = -lead;
+        }
+        sink->primed = true;
+    }
+    
+    printf("🔗 Outputs aligned at %.1f ms (main output held back %.1f ms)\n",
+           fanout->target * 1000.0 / PCM_OUTPUT_RATE, fanout->held_frames * 1000.0 / PCM_OUTPUT_RATE);
+    fanout->next_check_ns = 0;
+}
+
+// Drop everything queued on the sinks and in the delay line (stop, seek)
+void audio_fanout_flush(audio_fanout_t *fanout) {
+    fanout->frames_in = 0;
+    fanout->replay_pending = 0;
+    fanout->held_read = 0;
+    fanout->held_frames = 0;
+    fanout->paused = false;
+    
+    for (int i = 0; i < fanout->count; i++) {
+        fanout_sink_t *sink = fanout->sinks[i];
+        atomic_store_explicit(&sink->flush_index, atomic_load_explicit(&sink->head, memory_order_relaxed),
+                              memory_order_relaxed);
+        atomic_fetch_add_explicit(&sink->flush_seq, 1, memory_order_release);
+        atomic_store_explicit(&sink->paused, false, memory_order_release);
+        sink->skip = 0;
+        sink->primed = false;
+        fanout_wake(sink);
+    }
+}
+
+// A new stream starts on a prepared main output: every output begins with
+// the lead-in that lines it up with the slowest one
+void audio_fanout_start(audio_fanout_t *fanout, pcm_output_t *main) {
+    audio_fanout_flush(fanout);
+    fanout->target = 0;
+    audio_fanout_align(fanout, main);
+}
+
+void audio_fanout_pause(audio_fanout_t *fanout, bool paused) {
+    fanout->paused = paused;
+    for (int i = 0; i < fanout->count; i++) {
+        atomic_store_explicit(&fanout->sinks[i]->paused, paused, memory_order_release);
+        fanout_wake(fanout->sinks[i]);
+    }
+    fanout->next_check_ns = 0;
+}
+
+// Engine: frames about to be written to the main output. Each sink gets a
+// copy; the main output gets them back delayed, in place.
+void audio_fanout_process(audio_fanout_t *fanout, int16_t *samples, size_t frames) {
+    // Frames replayed after a device switch already went out on the sinks
+    size_t replayed = fanout->replay_pending < frames ? fanout->replay_pending : frames;
+    fanout->replay_pending -= replayed;
+    fanout->frames_in += (long long)frames;
+    
+    if (fanout->count == 0 && fanout->held_frames == 0) {
+        return;
+    }
+    
+    for (int i = 0; i < fanout->count; i++) {
+        fanout_sink_t *sink = fanout->sinks[i];
+        const int16_t *fresh = samples + replayed * PCM_OUTPUT_CHANNELS;
+        size_t count = frames - replayed;
+    
+        size_t skip = sink->skip < count ? (size_t)sink->skip : count;
+        sink->skip -= skip;
+    
+        size_t lost = fanout_sink_feed(sink, fresh + skip * PCM_OUTPUT_CHANNELS, count - skip);
+        if (lost > 0) {
+            if (sink->dropped == 0) {
+                printf("⚠️  %s is not keeping up, dropping audio\n", sink->output.device_name);
+            }
+            sink->dropped += lost;
+        }
+    
+        // The next frame into the ring stands for the stream frame still
+        // inside the resampler
+        sink->offset = (long long)atomic_load_explicit(&sink->head, memory_order_relaxed) -
+                       (fanout->frames_in + (long long)fanout->replay_pending) +
+                       llround(audio_resampler_pending(&sink->resampler));
+    }
+    
+    // Delay line: in through the back, out of the front
+    size_t done = 0;
+    while (fanout->held_frames > 0 && done < frames) {
+        size_t chunk = fanout->held_capacity - fanout->held_frames;
+        if (chunk > frames - done) {
+            chunk = frames - done;
+        }
+        fanout_held_write(fanout, samples + done * PCM_OUTPUT_CHANNELS, chunk);
+        fanout_held_read(fanout, samples + done * PCM_OUTPUT_CHANNELS, chunk);
+        done += chunk;
+    }
+}
+
+// End of the stream: let the delay line run out into dst. Returns frames.
+size_t audio_fanout_drain(audio_fanout_t *fanout, int16_t *dst, size_t frames) {
+    if (frames > fanout->held_frames) {
+        frames = fanout->held_frames;
+    }
+    fanout_held_read(fanout, dst, frames);
+    return frames;
+}
+
+// Frames in the delay line: not yet written to the main output
+size_t audio_fanout_held(audio_fanout_t *fanout) {
+    return fanout->held_frames;
+}
+
+// Device switch: the newest frames were taken back from the main output
+// (the delay line's contents first) and will be replayed. The sinks already
+// have them, so the stream steps back without sending them again.
+void audio_fanout_take_back(audio_fanout_t *fanout, size_t frames) {
+    fanout->held_read = 0;
+    fanout->held_frames = 0;
+    fanout->frames_in -= (long long)frames;
+    fanout->replay_pending = frames;
+}
+
+// Compare what each sink is playing with the main output. Within the
+// tolerance the drift estimator steers the sink's rate; beyond it the
+// difference is trimmed: a sink ahead gets silence, a sink behind leaves out
+// frames it has queued. When it has too few, the main output waits for it.
+void audio_fanout_check(audio_fanout_t *fanout, pcm_output_t *main) {
+    uint64_t now = fanout_now_ns();
+    if (fanout->count == 0 || now < fanout->next_check_ns) {
+        return;
+    }
+    
+    for (int i = 0; i < fanout->count; i++) {
+        if (atomic_load_explicit(&fanout->sinks[i]->lost, memory_order_acquire)) {
+            audio_fanout_remove(fanout, fanout->sinks[i]->output.device_name);
+            i--;
+        }
+    }
+    
+    snd_pcm_sframes_t delay;
+    if (snd_pcm_state(main->handle) != SND_PCM_STATE_RUNNING || main->start_pending ||
+        pcm_output_delay(main, &delay) != 0) {
+        return;
+    }
+    fanout->next_check_ns = now + AUDIO_FANOUT_CHECK_MS * 1000000ULL;
+    
+    long long main_heard = fanout->frames_in - (long long)fanout->held_frames - delay;
+    bool corrected = false;
+    
+    for (int i = 0; i < fanout->count; i++) {
+        fanout_sink_t *sink = fanout->sinks[i];
+        long long heard;
+        uint64_t stamp;
+        if (!sink->primed || !fanout_sink_measurement(sink, &heard, &stamp) ||
+            now < stamp || now - stamp > FANOUT_STALE_NS) {
+            continue;
+        }
+    
+        double error = (double)(heard - sink->offset - main_heard) +
+                       (double)(now - stamp) * PCM_OUTPUT_RATE / 1e9;
+        if (fabs(error) <= AUDIO_FANOUT_TOLERANCE_FRAMES) {
+            fanout_sink_steer(sink, error);
+            continue;
+        }
+    
+        long long ahead = llround(error);
+        printf("🔗 %s %s by %.1f ms, realigning\n", sink->output.device_name,
+               ahead > 0 ? "ahead" : "behind", llabs(ahead) * 1000.0 / PCM_OUTPUT_RATE);
+    
+        if (ahead > 0) {
+            fanout_sink_delay(sink, (size_t)ahead);
+        } else {
+            unsigned long long queued = atomic_load_explicit(&sink->head, memory_order_relaxed) -
+                                        atomic_load_explicit(&sink->tail, memory_order_acquire);
+            unsigned long long late = (unsigned long long)-ahead;
+            if (late > queued) {
+                fanout_held_grow(fanout, late - queued);
+                late = queued;
+            }
+            sink->skip += late;
+        }
+        sink->corrections++;
+        corrected = true;
+    }
+    
+    if (corrected) {
+        fanout->next_check_ns = now + AUDIO_FANOUT_SETTLE_MS * 1000000ULL;
+    }
+}
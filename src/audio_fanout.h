@@ -0,0 +1,119 @@
+#ifndef AUDIO_FANOUT_H
+#define AUDIO_FANOUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "pcm_output.h"
+#include "pcm_pool.h"
+#include "audio_resampler.h"
+
+// Outputs that play the stream alongside the main one (e.g. a Bluetooth
+// speaker next to the DAC)
+#define AUDIO_FANOUT_MAX_SINKS 2
+
+// Per-sink ring: how far a stalled sink may fall behind before it loses audio
+#define AUDIO_FANOUT_RING_FRAMES (PCM_OUTPUT_RATE * 2)
+
+// Longest the main output is held back to wait for a slower sink
+#define AUDIO_FANOUT_MAX_DELAY_FRAMES PCM_OUTPUT_RATE
+
+// Alignment: outputs further apart than the tolerance (5 ms) are corrected,
+// then left alone until the correction has been heard
+#define AUDIO_FANOUT_TOLERANCE_FRAMES (PCM_OUTPUT_RATE / 200)
+#define AUDIO_FANOUT_CHECK_MS 1000
+#define AUDIO_FANOUT_SETTLE_MS 3000
+
+// Clock drift: each check feeds the remaining error (in frames) into a PI
+// loop that sets the sink's resampling ratio. The integral is the estimate
+// of how fast the sink's clock runs against the main output's.
+#define AUDIO_FANOUT_DRIFT_KP 4.0       // ppm per frame of error
+#define AUDIO_FANOUT_DRIFT_KI 0.4       // ppm per frame of error, per check
+#define AUDIO_FANOUT_DRIFT_MAX_PPM 1000
+#define AUDIO_FANOUT_DRIFT_LOG_PPM 50   // Estimate changes worth logging
+
+// One extra output with its own writer thread. The engine only ever copies
+// into the ring, so a slow sink can never stall the main output.
+typedef struct {
+    pcm_output_t output;            // Sink thread only once started
+    bool allow_mmap;
+    pthread_t thread;
+    int wake_fd;                    // eventfd: frames, flush, pause or exit
+    
+    // Frame ring: the engine writes at head, the sink thread reads at tail.
+    // Both are free-running frame counters.
+    int16_t *frames;
+    _Alignas(64) atomic_ullong head;
+    _Alignas(64) atomic_ullong tail;
+    atomic_bool waiting;            // Sink asleep on an empty ring
+    
+    // Engine requests
+    atomic_uint flush_seq;          // Bumped to drop everything before flush_index
+    atomic_ullong flush_index;
+    atomic_bool paused;
+    atomic_bool stop;
+    atomic_bool lost;               // Set by the sink: device went away
+    
+    // Published by the sink (seqlock): ring index heard at stamp_ns,
+    // stamp_ns 0 while not running
+    atomic_uint measure_seq;
+    atomic_llong heard_index;
+    atomic_ullong stamp_ns;
+    
+    // Engine only
+    audio_resampler_t resampler;    // Stream frames in, ring frames out
+    int16_t *scratch;               // Resampler output on its way to the ring
+    long long offset;               // Ring index minus stream frame
+    unsigned long long skip;        // Stream frames still to leave out
+    snd_pcm_sframes_t latency;      // Nominal: device buffer plus transport
+    bool primed;                    // Lead-in for the current stream queued
+    double drift_ppm;               // Estimated clock drift, kept across streams
+    double logged_ppm;
+    unsigned long dropped;          // Frames lost to a full ring
+    unsigned long corrections;
+} fanout_sink_t;
+
+// Fan-out stage between the engine and its outputs. The main output keeps
+// its zero-copy path and is held back by a delay line just long enough to
+// line up with the slowest sink; every sink gets a lead-in of silence for
+// the same purpose. Measured delays (snd_pcm_delay plus the Bluetooth
+// transport delay) then keep each sink on the main output: small errors
+// steer the sink's resampler, so a sink on another clock neither runs dry
+// nor overflows; large ones are trimmed at once.
+// Engine thread only.
+typedef struct {
+    fanout_sink_t *sinks[AUDIO_FANOUT_MAX_SINKS];
+    int count;
+    pcm_pool_t *pool;               // Removed sinks go back here
+    bool paused;
+    
+    // Delay line in front of the main output (FIFO of frames)
+    int16_t *held;
+    size_t held_capacity;
+    size_t held_read;
+    size_t held_frames;
+    
+    long long frames_in;            // Stream frames seen since the last flush
+    size_t replay_pending;          // Replayed after a device switch: sinks have them
+    snd_pcm_sframes_t target;       // Latency every output is held to
+    uint64_t next_check_ns;
+} audio_fanout_t;
+
+// Function declarations
+int audio_fanout_init(audio_fanout_t *fanout, pcm_pool_t *pool);
+void audio_fanout_free(audio_fanout_t *fanout);
+int audio_fanout_add(audio_fanout_t *fanout, pcm_output_t *output, bool allow_mmap);
+int audio_fanout_remove(audio_fanout_t *fanout, const char *device);
+int audio_fanout_find(audio_fanout_t *fanout, const char *device);
+void audio_fanout_align(audio_fanout_t *fanout, pcm_output_t *main);
+void audio_fanout_start(audio_fanout_t *fanout, pcm_output_t *main);
+void audio_fanout_flush(audio_fanout_t *fanout);
+void audio_fanout_pause(audio_fanout_t *fanout, bool paused);
+void audio_fanout_process(audio_fanout_t *fanout, int16_t *samples, size_t frames);
+size_t audio_fanout_drain(audio_fanout_t *fanout, int16_t *dst, size_t frames);
+size_t audio_fanout_held(audio_fanout_t *fanout);
+void audio_fanout_take_back(audio_fanout_t *fanout, size_t frames);
+void audio_fanout_check(audio_fanout_t *fanout, pcm_output_t *main);
+
+#endif
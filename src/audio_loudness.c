@@ -0,0 +1,489 @@
+#include "audio_loudness.h"
+#include "sector_deemph.h"
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Samples are at int16 scale in float (see audio_dsp_to_float)
+#define LOUDNESS_FULL_SCALE 32768.0
+
+static const char *loudness_mode_names[] = {
+    [AUDIO_LOUDNESS_OFF]   = "off",
+    [AUDIO_LOUDNESS_TRACK] = "track",
+    [AUDIO_LOUDNESS_ALBUM] = "album",
+};
+
+const char *audio_loudness_mode_name(audio_loudness_mode_t mode) {
+    if (mode < 0 || mode >= AUDIO_LOUDNESS_MODE_COUNT) {
+        return "?";
+    }
+    return loudness_mode_names[mode];
+}
+
+// BS.1770 K-weighting, designed for our rate from the analogue prototypes
+// (the standard only tabulates 48 kHz coefficients)
+static void loudness_design(audio_loudness_meter_t *meter) {
+    double k = tan(M_PI * 1681.974450955533 / PCM_OUTPUT_RATE);
+    double q = 0.7071752369554196;
+    double vh = pow(10.0, 3.999843853973347 / 20.0);
+    double vb = pow(vh, 0.4996667741545416);
+    double a0 = 1.0 + k / q + k * k;
+    meter->shelf.b0 = (float)((vh + vb * k / q + k * k) / a0);
+    meter->shelf.b1 = (float)(2.0 * (k * k - vh) / a0);
+    meter->shelf.b2 = (float)((vh - vb * k / q + k * k) / a0);
+    meter->shelf.a1 = (float)(2.0 * (k * k - 1.0) / a0);
+    meter->shelf.a2 = (float)((1.0 - k / q + k * k) / a0);
+    
+    k = tan(M_PI * 38.13547087602444 / PCM_OUTPUT_RATE);
+    q = 0.5003270373238773;
+    a0 = 1.0 + k / q + k * k;
+    meter->highpass.b0 = 1.0f;
+    meter->highpass.b1 = -2.0f;
+    meter->highpass.b2 = 1.0f;
+    meter->highpass.a1 = (float)(2.0 * (k * k - 1.0) / a0);
+    meter->highpass.a2 = (float)((1.0 - k / q + k * k) / a0);
+    
+    meter->deemph.type = AUDIO_DSP_HIGH_SHELF;
+    meter->deemph.freq = SECTOR_DEEMPH_FREQ;
+    meter->deemph.gain_db = SECTOR_DEEMPH_GAIN_DB;
+    meter->deemph.q = SECTOR_DEEMPH_Q;
+    audio_dsp_band_design(&meter->deemph);
+}
+
+// Sum of squares over count samples
+static double loudness_energy(const float *x, size_t count) {
+    size_t i = 0;
+    double sum = 0.0;
+    
+#if defined(__ARM_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t v = vld1q_f32(x + i);
+        acc = vmlaq_f32(acc, v, v);
+    }
+    float lanes[4];
+    vst1q_f32(lanes, acc);
+    sum = (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE2__)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        __m128 v = _mm_loadu_ps(x + i);
+        acc = _mm_add_ps(acc, _mm_mul_ps(v, v));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc);
+    sum = (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+    
+    for (; i < count; i++) {
+        sum += (double)x[i] * x[i];
+    }
+    return sum;
+}
+
+// Mean square (both channels summed, full scale 1.0) of a histogram bin's centre
+static double loudness_bin_energy(int bin) {
+    double lufs = AUDIO_LOUDNESS_ABSOLUTE_GATE + (bin + 0.5) * AUDIO_LOUDNESS_BIN_LU;
+    return pow(10.0, (lufs + 0.691) / 10.0);
+}
+
+static double loudness_lufs(double energy) {
+    return -0.691 + 10.0 * log10(energy);
+}
+
+// Gain that brings lufs to the target without pushing peak past full scale
+static int loudness_gain_mb(double lufs, double peak, unsigned long blocks) {
+    if (blocks == 0) {
+        return 0; // Silence is left alone
+    }
+    
+    double gain = AUDIO_LOUDNESS_TARGET_LUFS - lufs;
+    if (peak > 0.0 && gain > -20.0 * log10(peak)) {
+        gain = -20.0 * log10(peak);
+    }
+    return (int)lround(gain * 100.0);
+}
+
+// Album loudness from the tracks' integrated loudness, weighted by their
+// gated blocks. Published once every track is measured (or unreadable).
+static void loudness_publish_album(audio_loudness_t *loudness) {
+    double energy = 0.0;
+    double peak = 0.0;
+    unsigned long blocks = 0;
+    int measured = 0;
+    
+    for (int t = 1; t <= loudness->num_tracks; t++) {
+        const audio_loudness_track_t *track = &loudness->tracks[t];
+        if (!track->measured && !track->failed) {
+            atomic_store_explicit(&loudness->album_gain_mb, AUDIO_LOUDNESS_UNKNOWN, memory_order_release);
+            return;
+        }
+        if (track->measured) {
+            energy += track->blocks * pow(10.0, (track->lufs + 0.691) / 10.0);
+            blocks += track->blocks;
+            peak = fmax(peak, track->peak);
+            measured++;
+        }
+    }
+    
+    if (measured == 0) {
+        atomic_store_explicit(&loudness->album_gain_mb, AUDIO_LOUDNESS_UNKNOWN, memory_order_release);
+        return;
+    }
+    
+    double lufs = blocks > 0 ? loudness_lufs(energy / blocks) : AUDIO_LOUDNESS_ABSOLUTE_GATE;
+    int gain_mb = loudness_gain_mb(lufs, peak, blocks);
+    atomic_store_explicit(&loudness->album_gain_mb, gain_mb, memory_order_release);
+    printf("📏 Album: %.1f LUFS, peak %.1f dBFS (gain %+.1f dB)\n",
+           lufs, 20.0 * log10(fmax(peak, 1e-6)), gain_mb / 100.0);
+}
+
+static void loudness_publish_track(audio_loudness_t *loudness, int t) {
+    const audio_loudness_track_t *track = &loudness->tracks[t];
+    int gain_mb = track->measured ? loudness_gain_mb(track->lufs, track->peak, track->blocks) : AUDIO_LOUDNESS_UNKNOWN;
+    atomic_store_explicit(&loudness->track_gain_mb[t], gain_mb, memory_order_release);
+}
+
+int audio_loudness_init(audio_loudness_t *loudness) {
+    memset(loudness, 0, sizeof(audio_loudness_t));
+    atomic_init(&loudness->mode, AUDIO_LOUDNESS_MODE_DEFAULT);
+    for (int t = 0; t <= CDIO_CD_MAX_TRACKS; t++) {
+        atomic_init(&loudness->track_gain_mb[t], AUDIO_LOUDNESS_UNKNOWN);
+    }
+    atomic_init(&loudness->album_gain_mb, AUDIO_LOUDNESS_UNKNOWN);
+    loudness->scan = AUDIO_LOUDNESS_SCAN_DEFAULT;
+    loudness_design(&loudness->meter);
+    
+    loudness->scan_buffer = malloc((size_t)AUDIO_LOUDNESS_SCAN_SECTORS * CDIO_CD_FRAMESIZE_RAW);
+    if (!loudness->scan_buffer) {
+        loudness->scan = false;
+        return -1;
+    }
+    return 0;
+}
+
+void audio_loudness_free(audio_loudness_t *loudness) {
+    free(loudness->scan_buffer);
+    loudness->scan_buffer = NULL;
+}
+
+// Load what is known about the disc in the drive, if it is not the one
+// already bound. Reader thread, before any of the disc's sectors are queued.
+int audio_loudness_bind(audio_loudness_t *loudness, cd_player_t *cd) {
+    if (!cd || !cd->disc_present || !cd->is_audio_cd) {
+        return -1;
+    }
+    if (loudness->bound && loudness->disc_id == cd->disc_id) {
+        return 0;
+    }
+    
+    loudness->bound = true;
+    loudness->disc_id = cd->disc_id;
+    loudness->num_tracks = cd->num_tracks;
+    loudness->meter.track = 0;
+    memset(loudness->tracks, 0, sizeof(loudness->tracks));
+    
+    int known = 0;
+    FILE *file = fopen(AUDIO_LOUDNESS_CACHE_FILE, "r");
+    if (file) {
+        char line[128];
+        unsigned int disc_id;
+        int t;
+        double lufs, peak;
+        unsigned long blocks;
+        while (fgets(line, sizeof(line), file)) {
+            if (sscanf(line, "%x %d %lf %lf %lu", &disc_id, &t, &lufs, &peak, &blocks) != 5 ||
+                disc_id != loudness->disc_id || t < 1 || t > loudness->num_tracks) {
+                continue;
+            }
+            audio_loudness_track_t *track = &loudness->tracks[t];
+            known += !track->measured;
+            track->measured = true;
+            track->lufs = lufs;
+            track->peak = peak;
+            track->blocks = blocks;
+        }
+        fclose(file);
+    }
+    
+    for (int t = 0; t <= CDIO_CD_MAX_TRACKS; t++) {
+        loudness_publish_track(loudness, t);
+    }
+    printf("📏 Loudness known for %d of %d tracks of disc %08x\n", known, loudness->num_tracks, loudness->disc_id);
+    loudness_publish_album(loudness);
+    return 0;
+}
+
+// Rewrite the cache file with this track's entry replaced
+static int loudness_save(audio_loudness_t *loudness, int t) {
+    const audio_loudness_track_t *track = &loudness->tracks[t];
+    char tmp_path[sizeof(AUDIO_LOUDNESS_CACHE_FILE) + 4];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", AUDIO_LOUDNESS_CACHE_FILE);
+    
+    mkdir(CDPLAYER_CONFIG_DIR, 0755);
+    FILE *out = fopen(tmp_path, "w");
+    if (!out) {
+        printf("⚠️  Cannot save loudness: %s\n", strerror(errno));
+        return -1;
+    }
+    
+    FILE *in = fopen(AUDIO_LOUDNESS_CACHE_FILE, "r");
+    if (in) {
+        char line[128];
+        unsigned int disc_id;
+        int other;
+        while (fgets(line, sizeof(line), in)) {
+            if (sscanf(line, "%x %d", &disc_id, &other) == 2 && disc_id == loudness->disc_id && other == t) {
+                continue;
+            }
+            fputs(line, out);
+        }
+        fclose(in);
+    }
+    
+    fprintf(out, "%08x %d %.2f %.6f %lu\n", loudness->disc_id, t, track->lufs, track->peak, track->blocks);
+    fclose(out);
+    
+    if (rename(tmp_path, AUDIO_LOUDNESS_CACHE_FILE) != 0) {
+        printf("⚠️  Cannot save loudness: %s\n", strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+static void loudness_start(audio_loudness_meter_t *meter, int track, long start, long end, bool emphasized) {
+    audio_dsp_band_t *bands[] = { &meter->deemph, &meter->shelf, &meter->highpass };
+    for (int b = 0; b < 3; b++) {
+        memset(bands[b]->z1, 0, sizeof(bands[b]->z1));
+        memset(bands[b]->z2, 0, sizeof(bands[b]->z2));
+    }
+    memset(meter->hops, 0, sizeof(meter->hops));
+    memset(meter->bins, 0, sizeof(meter->bins));
+    meter->hop_count = 0;
+    meter->hop_sum = 0.0;
+    meter->hop_frames = 0;
+    meter->peak = 0.0f;
+    meter->emphasized = emphasized;
+    meter->track = track;
+    meter->next_lsn = start;
+    meter->end_lsn = end;
+}
+
+// A full hop: the block ending here goes into the histogram if it passes
+// the absolute gate
+static void loudness_hop(audio_loudness_meter_t *meter) {
+    meter->hops[meter->hop_count % AUDIO_LOUDNESS_BLOCK_HOPS] = meter->hop_sum;
+    meter->hop_count++;
+    meter->hop_sum = 0.0;
+    meter->hop_frames = 0;
+    
+    if (meter->hop_count < AUDIO_LOUDNESS_BLOCK_HOPS) {
+        return;
+    }
+    
+    double sum = 0.0;
+    for (int h = 0; h < AUDIO_LOUDNESS_BLOCK_HOPS; h++) {
+        sum += meter->hops[h];
+    }
+    double energy = sum / ((double)AUDIO_LOUDNESS_HOP_FRAMES * AUDIO_LOUDNESS_BLOCK_HOPS) /
+                    (LOUDNESS_FULL_SCALE * LOUDNESS_FULL_SCALE);
+    if (energy <= 0.0) {
+        return;
+    }
+    
+    int bin = (int)((loudness_lufs(energy) - AUDIO_LOUDNESS_ABSOLUTE_GATE) / AUDIO_LOUDNESS_BIN_LU);
+    if (bin >= 0) {
+        meter->bins[bin < AUDIO_LOUDNESS_BINS ? bin : AUDIO_LOUDNESS_BINS - 1]++;
+    }
+}
+
+// Gated integrated loudness of the finished track
+static void loudness_finish(audio_loudness_t *loudness) {
+    audio_loudness_meter_t *meter = &loudness->meter;
+    audio_loudness_track_t *track = &loudness->tracks[meter->track];
+    
+    double sum = 0.0;
+    unsigned long count = 0;
+    for (int b = 0; b < AUDIO_LOUDNESS_BINS; b++) {
+        sum += meter->bins[b] * loudness_bin_energy(b);
+        count += meter->bins[b];
+    }
+    
+    track->lufs = AUDIO_LOUDNESS_ABSOLUTE_GATE;
+    track->blocks = 0;
+    if (count > 0) {
+        double gate = loudness_lufs(sum / count) + AUDIO_LOUDNESS_RELATIVE_GATE;
+        int first = (int)ceil((gate - AUDIO_LOUDNESS_ABSOLUTE_GATE) / AUDIO_LOUDNESS_BIN_LU);
+        sum = 0.0;
+        for (int b = first > 0 ? first : 0; b < AUDIO_LOUDNESS_BINS; b++) {
+            sum += meter->bins[b] * loudness_bin_energy(b);
+            track->blocks += meter->bins[b];
+        }
+        if (track->blocks > 0) {
+            track->lufs = loudness_lufs(sum / track->blocks);
+        }
+    }
+    track->peak = meter->peak / LOUDNESS_FULL_SCALE;
+    track->measured = true;
+    track->failed = false;
+    
+    int t = meter->track;
+    meter->track = 0;
+    loudness_publish_track(loudness, t);
+    printf("📏 Track %d: %.1f LUFS, peak %.1f dBFS (gain %+.1f dB)\n", t, track->lufs,
+           20.0 * log10(fmax(track->peak, 1e-6)), loudness_gain_mb(track->lufs, track->peak, track->blocks) / 100.0);
+    loudness_publish_album(loudness);
+    loudness_save(loudness, t);
+}
+
+// One sector the reader is about to queue. Only a track read from its
+// first sector to its last without a gap gets a result; anything else
+// (a seek, a scan burst) drops the run until a track starts again.
+void audio_loudness_feed(audio_loudness_t *loudness, cd_player_t *cd, const int16_t *samples, long lsn, int track) {
+    audio_loudness_meter_t *meter = &loudness->meter;
+    
+    if (!loudness->bound || track < 1 || track > loudness->num_tracks) {
+        return;
+    }
+    
+    if (track != meter->track || lsn != meter->next_lsn) {
+        int start, end;
+        meter->track = 0;
+        if (loudness->tracks[track].measured || cd_get_track_bounds(cd, track, &start, &end) != 0 || lsn != start) {
+            return;
+        }
+        loudness_start(meter, track, start, end, cd_track_preemphasis(cd, track));
+    }
+    
+    audio_dsp_to_float(samples, meter->block, CD_SAMPLES_PER_SECTOR);
+    if (meter->emphasized) {
+        audio_dsp_biquad(&meter->deemph, meter->block, CD_FRAMES_PER_SECTOR);
+    }
+    meter->peak = fmaxf(meter->peak, audio_dsp_peak(meter->block, CD_SAMPLES_PER_SECTOR));
+    audio_dsp_biquad(&meter->shelf, meter->block, CD_FRAMES_PER_SECTOR);
+    audio_dsp_biquad(&meter->highpass, meter->block, CD_FRAMES_PER_SECTOR);
+    
+    // Hops don't line up with sectors (7.5 per hop)
+    int frame = 0;
+    while (frame < CD_FRAMES_PER_SECTOR) {
+        int count = AUDIO_LOUDNESS_HOP_FRAMES - meter->hop_frames;
+        if (count > CD_FRAMES_PER_SECTOR - frame) {
+            count = CD_FRAMES_PER_SECTOR - frame;
+        }
+        meter->hop_sum += loudness_energy(meter->block + frame * 2, (size_t)count * 2);
+        meter->hop_frames += count;
+        frame += count;
+        if (meter->hop_frames == AUDIO_LOUDNESS_HOP_FRAMES) {
+            loudness_hop(meter);
+        }
+    }
+    
+    meter->next_lsn = lsn + 1;
+    if (lsn == meter->end_lsn) {
+        loudness_finish(loudness);
+    }
+}
+
+// Parked reader, holding drive_lock: measure the next track nobody has
+// played through yet, a batch of sectors per call so a play request (or the
+// UI wanting the drive) is picked up quickly.
+// Returns 1 if it read something, 0 when there is nothing left to measure.
+int audio_loudness_scan(audio_loudness_t *loudness, cd_player_t *cd) {
+    if (!loudness->scan || audio_loudness_bind(loudness, cd) != 0) {
+        return 0;
+    }
+    
+    audio_loudness_meter_t *meter = &loudness->meter;
+    int start, end;
+    
+    if (meter->track == 0) {
+        int t = 1;
+        while (t <= loudness->num_tracks && (loudness->tracks[t].measured || loudness->tracks[t].failed)) {
+            t++;
+        }
+        if (t > loudness->num_tracks || cd_get_track_bounds(cd, t, &start, &end) != 0) {
+            return 0;
+        }
+        printf("📏 Measuring track %d in the background\n", t);
+        loudness_start(meter, t, start, end, cd_track_preemphasis(cd, t));
+    }
+    
+    int track = meter->track;
+    long lsn = meter->next_lsn;
+    int count = AUDIO_LOUDNESS_SCAN_SECTORS;
+    if (count > meter->end_lsn - lsn + 1) {
+        count = (int)(meter->end_lsn - lsn + 1);
+    }
+    
+    if (cd_read_sectors_background(cd, (int)lsn, count, loudness->scan_buffer) != 0) {
+        printf("⚠️  Background loudness scan of track %d failed at sector %ld\n", track, lsn);
+        loudness->tracks[track].failed = true;
+        meter->track = 0;
+        loudness_publish_album(loudness);
+        return 1;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        audio_loudness_feed(loudness, cd, loudness->scan_buffer + (size_t)i * CD_SAMPLES_PER_SECTOR, lsn + i, track);
+    }
+    return 1;
+}
+
+// The next sector starts a new run (seek, new play): latch its gain afresh
+void audio_loudness_reset(audio_loudness_t *loudness) {
+    loudness->applied_track = 0;
+}
+
+// Gain the mode calls for on a track, in millibels; 0 while unknown
+static int loudness_mode_gain_mb(audio_loudness_t *loudness, int mode, int track) {
+    int gain_mb = AUDIO_LOUDNESS_UNKNOWN;
+    if (mode == AUDIO_LOUDNESS_ALBUM) {
+        gain_mb = atomic_load_explicit(&loudness->album_gain_mb, memory_order_acquire);
+    }
+    if (mode != AUDIO_LOUDNESS_OFF && gain_mb == AUDIO_LOUDNESS_UNKNOWN && track >= 1 && track <= CDIO_CD_MAX_TRACKS) {
+        gain_mb = atomic_load_explicit(&loudness->track_gain_mb[track], memory_order_acquire);
+    }
+    return gain_mb == AUDIO_LOUDNESS_UNKNOWN ? 0 : gain_mb;
+}
+
+// Linear gain for a track other than the one being played (a crossfade's
+// incoming track); nothing is latched
+float audio_loudness_track_gain(audio_loudness_t *loudness, int track) {
+    int mode = atomic_load_explicit(&loudness->mode, memory_order_relaxed);
+    return (float)pow(10.0, loudness_mode_gain_mb(loudness, mode, track) / 2000.0);
+}
+
+// Normalise one ring sector in place. The gain is picked when a track's
+// first sector comes by and held for the rest of it, so a result that
+// arrives while the track is still playing waits for the next play.
+void audio_loudness_apply(audio_loudness_t *loudness, int16_t *samples, int track) {
+    int mode = atomic_load_explicit(&loudness->mode, memory_order_relaxed);
+    
+    if (track != loudness->applied_track || mode != loudness->applied_mode) {
+        int gain_mb = loudness_mode_gain_mb(loudness, mode, track);
+        if (gain_mb != loudness->applied_mb) {
+            printf("📏 Track %d: %s gain %+.1f dB\n", track, audio_loudness_mode_name(mode), gain_mb / 100.0);
+        }
+        loudness->applied_track = track;
+        loudness->applied_mode = mode;
+        loudness->applied_mb = gain_mb;
+        loudness->applied_gain = (float)pow(10.0, gain_mb / 2000.0);
+    }
+    
+    if (loudness->applied_mb == 0) {
+        return;
+    }
+    
+    audio_dsp_to_float(samples, loudness->block, CD_SAMPLES_PER_SECTOR);
+    audio_dsp_scale(loudness->block, CD_SAMPLES_PER_SECTOR, loudness->applied_gain);
+    audio_dsp_to_int16(loudness->block, samples, CD_SAMPLES_PER_SECTOR);
+}
@@ -0,0 +1,110 @@
+#ifndef AUDIO_LOUDNESS_H
+#define AUDIO_LOUDNESS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <limits.h>
+#include "cd_control.h"
+#include "audio_dsp.h"
+#include "assets.h"
+
+// Measured tracks, one per line: <disc id> <track> <LUFS> <peak> <blocks>
+// with the peak as a fraction of full scale
+#define AUDIO_LOUDNESS_CACHE_FILE CDPLAYER_CONFIG_DIR "/loudness.conf"
+
+// Level tracks are brought to (the ReplayGain 2.0 reference)
+#define AUDIO_LOUDNESS_TARGET_LUFS -18.0
+#define AUDIO_LOUDNESS_MODE_DEFAULT AUDIO_LOUDNESS_TRACK
+
+// EBU R128 / BS.1770: 400 ms blocks every 100 ms, gated at -70 LUFS and
+// then at 10 LU under the loudness of what passed the first gate
+#define AUDIO_LOUDNESS_HOP_FRAMES (PCM_OUTPUT_RATE / 10)
+#define AUDIO_LOUDNESS_BLOCK_HOPS 4
+#define AUDIO_LOUDNESS_ABSOLUTE_GATE -70.0
+#define AUDIO_LOUDNESS_RELATIVE_GATE -10.0
+
+// Block loudness histogram from the absolute gate up to +5 LUFS
+#define AUDIO_LOUDNESS_BIN_LU 0.01
+#define AUDIO_LOUDNESS_BINS 7500
+
+// Background scan while stopped: sectors per drive read, and how often a
+// parked reader with nothing to scan looks again (a disc may have changed)
+#define AUDIO_LOUDNESS_SCAN_DEFAULT true
+#define AUDIO_LOUDNESS_SCAN_SECTORS CD_BULK_DEFAULT_SECTORS
+#define AUDIO_LOUDNESS_SCAN_POLL_MS 2000
+
+// Published gain of a track not measured yet
+#define AUDIO_LOUDNESS_UNKNOWN INT_MIN
+
+typedef enum {
+    AUDIO_LOUDNESS_OFF = 0,
+    AUDIO_LOUDNESS_TRACK,
+    AUDIO_LOUDNESS_ALBUM,
+    AUDIO_LOUDNESS_MODE_COUNT
+} audio_loudness_mode_t;
+
+typedef struct {
+    bool measured;
+    bool failed;                 // Background scan could not read it
+    double lufs;                 // Integrated loudness
+    double peak;                 // Sample peak, fraction of full scale
+    unsigned long blocks;        // Blocks through both gates (album weight)
+} audio_loudness_track_t;
+
+// K-weighted meter over one track, fed a sector at a time in disc order
+typedef struct {
+    audio_dsp_band_t deemph;     // Flagged tracks are measured as heard
+    audio_dsp_band_t shelf;      // BS.1770 stage 1: head response
+    audio_dsp_band_t highpass;   // BS.1770 stage 2: RLB high-pass
+    bool emphasized;
+    int track;                   // Being measured; 0 when not
+    long next_lsn;               // Sector that keeps the run contiguous
+    long end_lsn;
+    double hops[AUDIO_LOUDNESS_BLOCK_HOPS];  // Sum of squares of the last hops
+    unsigned long hop_count;
+    double hop_sum;
+    int hop_frames;
+    float peak;
+    uint32_t bins[AUDIO_LOUDNESS_BINS];
+    float block[CD_SAMPLES_PER_SECTOR];
+} audio_loudness_meter_t;
+
+// Per-track loudness, measured on the CD reader thread from every sector
+// it reads in order (playback, gapless prefetch or a background scan while
+// stopped) and kept on disk per disc. The engine applies the gain from the
+// first sector of a track once it is known.
+typedef struct {
+    atomic_int mode;
+    atomic_int track_gain_mb[CDIO_CD_MAX_TRACKS + 1];  // Millibels
+    atomic_int album_gain_mb;
+    
+    // Reader thread only
+    bool scan;
+    bool bound;
+    unsigned int disc_id;
+    int num_tracks;
+    audio_loudness_track_t tracks[CDIO_CD_MAX_TRACKS + 1];
+    audio_loudness_meter_t meter;
+    int16_t *scan_buffer;
+    
+    // Engine only: gain latched at the first sector of a track
+    int applied_track;
+    int applied_mode;
+    int applied_mb;
+    float applied_gain;
+    float block[CD_SAMPLES_PER_SECTOR];
+} audio_loudness_t;
+
+// Function declarations
+int audio_loudness_init(audio_loudness_t *loudness);
+void audio_loudness_free(audio_loudness_t *loudness);
+int audio_loudness_bind(audio_loudness_t *loudness, cd_player_t *cd);
+void audio_loudness_feed(audio_loudness_t *loudness, cd_player_t *cd, const int16_t *samples, long lsn, int track);
+int audio_loudness_scan(audio_loudness_t *loudness, cd_player_t *cd);
+void audio_loudness_reset(audio_loudness_t *loudness);
+void audio_loudness_apply(audio_loudness_t *loudness, int16_t *samples, int track);
+float audio_loudness_track_gain(audio_loudness_t *loudness, int track);
+const char *audio_loudness_mode_name(audio_loudness_mode_t mode);
+
+#endif
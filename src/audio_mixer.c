@@ -0,0 +1,170 @@
+#include "audio_mixer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// dst[i] = saturate(dst[i] + src[i]) over count samples
+static void mix_saturating(int16_t *dst, const int16_t *src, size_t count) {
+    size_t i = 0;
+    
+#if defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), vld1q_s16(src + i)));
+    }
+#elif defined(__SSE2__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_adds_epi16(a, b));
+    }
+#endif
+    
+    for (; i < count; i++) {
+        int32_t sum = (int32_t)dst[i] + src[i];
+        dst[i] = (int16_t)(sum > 32767 ? 32767 : (sum < -32768 ? -32768 : sum));
+    }
+}
+
+// Fixed Q15 gain below unity over count samples
+static void scale_q15(int16_t *dst, size_t count, int gain) {
+    size_t i = 0;
+    
+#if defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1q_s16(dst + i, vqrdmulhq_n_s16(vld1q_s16(dst + i), (int16_t)gain));
+    }
+#elif defined(__SSE2__)
+    // (x * 2g) >> 16 == (x * g) >> 15
+    __m128i g = _mm_set1_epi16((int16_t)gain);
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(dst + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_slli_epi16(_mm_mulhi_epi16(x, g), 1));
+    }
+#endif
+    
+    for (; i < count; i++) {
+        dst[i] = (int16_t)(((int32_t)dst[i] * gain) >> 15);
+    }
+}
+
+void audio_mixer_init(audio_mixer_t *mixer) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        atomic_init(&mixer->voices[i].state, AUDIO_VOICE_FREE);
+        mixer->voices[i].samples = NULL;
+        mixer->voices[i].frames = 0;
+        mixer->voices[i].position = 0;
+    }
+    mixer->duck_gain = AUDIO_MIXER_UNITY_GAIN;
+}
+
+// The engine must no longer be mixing
+void audio_mixer_free(audio_mixer_t *mixer) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        if (mixer->voices[i].owned) {
+            free((void *)mixer->voices[i].samples);
+        }
+        mixer->voices[i].samples = NULL;
+        mixer->voices[i].owned = false;
+        atomic_store(&mixer->voices[i].state, AUDIO_VOICE_FREE);
+    }
+}
+
+// Queue a voice. With owned the mixer frees samples once played; otherwise
+// they must outlive the voice (e.g. the sound bank). Returns -1 when every
+// voice is in use.
+int audio_mixer_add(audio_mixer_t *mixer, const int16_t *samples, size_t frames, bool owned) {
+    // Producers reclaim finished voices, so the engine never calls free()
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        audio_voice_t *voice = &mixer->voices[i];
+        int done = AUDIO_VOICE_DONE;
+        if (atomic_compare_exchange_strong_explicit(&voice->state, &done, AUDIO_VOICE_LOADING,
+                                                    memory_order_acquire, memory_order_relaxed)) {
+            if (voice->owned) {
+                free((void *)voice->samples);
+            }
+            voice->samples = NULL;
+            atomic_store_explicit(&voice->state, AUDIO_VOICE_FREE, memory_order_release);
+        }
+    }
+    
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        audio_voice_t *voice = &mixer->voices[i];
+        int expected = AUDIO_VOICE_FREE;
+        if (atomic_compare_exchange_strong_explicit(&voice->state, &expected, AUDIO_VOICE_LOADING,
+                                                    memory_order_acquire, memory_order_relaxed)) {
+            voice->samples = samples;
+            voice->owned = owned;
+            voice->frames = frames;
+            voice->position = 0;
+            atomic_store_explicit(&voice->state, AUDIO_VOICE_ACTIVE, memory_order_release);
+            return 0;
+        }
+    }
+    
+    return -1;
+}
+
+// A voice is playing (engine thread)
+bool audio_mixer_active(audio_mixer_t *mixer) {
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        if (atomic_load_explicit(&mixer->voices[i].state, memory_order_acquire) == AUDIO_VOICE_ACTIVE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Voices playing or the CD gain still ramping back (engine thread)
+bool audio_mixer_busy(audio_mixer_t *mixer) {
+    return mixer->duck_gain != AUDIO_MIXER_UNITY_GAIN || audio_mixer_active(mixer);
+}
+
+// Duck dst (the CD stream, or silence) under active voices and sum them in.
+// Engine thread only; cheap no-op when nothing is playing.
+void audio_mixer_mix(audio_mixer_t *mixer, int16_t *dst, size_t frames) {
+    bool active = audio_mixer_active(mixer);
+    if (!active && mixer->duck_gain == AUDIO_MIXER_UNITY_GAIN) {
+        return;
+    }
+    
+    // Ramp towards the target gain, then hold it
+    int target = active ? AUDIO_MIXER_DUCK_GAIN : AUDIO_MIXER_UNITY_GAIN;
+    int step = (AUDIO_MIXER_UNITY_GAIN - AUDIO_MIXER_DUCK_GAIN) / AUDIO_MIXER_RAMP_FRAMES + 1;
+    size_t frame = 0;
+    
+    for (; frame < frames && mixer->duck_gain != target; frame++) {
+        if (mixer->duck_gain > target) {
+            mixer->duck_gain = (mixer->duck_gain - step < target) ? target : mixer->duck_gain - step;
+        } else {
+            mixer->duck_gain = (mixer->duck_gain + step > target) ? target : mixer->duck_gain + step;
+        }
+        dst[frame * 2] = (int16_t)(((int32_t)dst[frame * 2] * mixer->duck_gain) >> 15);
+        dst[frame * 2 + 1] = (int16_t)(((int32_t)dst[frame * 2 + 1] * mixer->duck_gain) >> 15);
+    }
+    if (frame < frames && mixer->duck_gain < AUDIO_MIXER_UNITY_GAIN) {
+        scale_q15(dst + frame * 2, (frames - frame) * 2, mixer->duck_gain);
+    }
+    
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        audio_voice_t *voice = &mixer->voices[i];
+        if (atomic_load_explicit(&voice->state, memory_order_acquire) != AUDIO_VOICE_ACTIVE) {
+            continue;
+        }
+    
+        size_t count = voice->frames - voice->position;
+        if (count > frames) {
+            count = frames;
+        }
+        mix_saturating(dst, voice->samples + voice->position * 2, count * 2);
+        voice->position += count;
+    
+        if (voice->position >= voice->frames) {
+            atomic_store_explicit(&voice->state, AUDIO_VOICE_DONE, memory_order_release);
+        }
+    }
+}
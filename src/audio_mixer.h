@@ -0,0 +1,49 @@
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+// Notification voices mixed at once; more are refused until one ends
+#define AUDIO_MIXER_VOICES 4
+
+// CD audio is ducked to -12 dB (Q15 gain) under a voice, ramping over 50 ms
+#define AUDIO_MIXER_UNITY_GAIN 32768
+#define AUDIO_MIXER_DUCK_GAIN 8231
+#define AUDIO_MIXER_RAMP_FRAMES 2205
+
+typedef enum {
+    AUDIO_VOICE_FREE = 0,
+    AUDIO_VOICE_LOADING,     // Claimed by a producer, not visible to the engine
+    AUDIO_VOICE_ACTIVE,      // Being mixed by the engine
+    AUDIO_VOICE_DONE         // Finished; the next producer frees the samples
+} audio_voice_state_t;
+
+typedef struct {
+    atomic_int state;
+    const int16_t *samples;  // Interleaved stereo at the output rate
+    bool owned;              // Freed when the voice is reclaimed
+    size_t frames;
+    size_t position;         // Engine thread only
+} audio_voice_t;
+
+// Real-time mixer in front of the PCM: notification voices are summed into
+// the CD stream (or into silence when nothing plays) by the playback engine,
+// so the one open device handle is never shared. Any thread may add voices;
+// only the engine mixes, and it never allocates or frees.
+typedef struct {
+    audio_voice_t voices[AUDIO_MIXER_VOICES];
+    int duck_gain;           // Current gain on the CD stream, Q15 (engine only)
+} audio_mixer_t;
+
+// Function declarations
+void audio_mixer_init(audio_mixer_t *mixer);
+void audio_mixer_free(audio_mixer_t *mixer);
+int audio_mixer_add(audio_mixer_t *mixer, const int16_t *samples, size_t frames, bool owned);
+bool audio_mixer_active(audio_mixer_t *mixer);
+bool audio_mixer_busy(audio_mixer_t *mixer);
+void audio_mixer_mix(audio_mixer_t *mixer, int16_t *dst, size_t frames);
+
+#endif
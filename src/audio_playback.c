@@ -6,6 +6,9 @@
 #include <stdbool.h>             // For bool, true, false
 #include <unistd.h>              // For usleep
 #include <pthread.h>             // For threading
+#include <poll.h>                // For the writer's event loop
+#include <sys/eventfd.h>         // For writer control wake-ups
+#include <time.h>                // For position timestamps
 #include <signal.h> 
 #include <math.h>              // For signal handling
 #include <alsa/asoundlib.h>      // For ALSA audio types and functions
@@ -14,131 +17,1756 @@
 #include <cdio/paranoia/paranoia.h>  // For CD audio reading
 
 bool is_bluealsa_device(const char *device_name);
+static int audio_open_device(audio_player_t *player, pcm_output_t *output, const char *device);
+static void audio_release(audio_player_t *player);
 
-// CD audio playback thread
-void* cd_playback_thread(void* arg) {
+// Read-ahead pipeline tuning
+#define READER_BACKOFF_US 5000                           // Reader wait when the ring is full
+#define WRITER_POLL_TIMEOUT_MS 500                       // Safety net for a lost wake-up
+#define WRITER_PREFILL_SECTORS (CD_SECTORS_PER_SECOND / 2) // Buffer before the first write
+
+// Fast scan (FF/REW): play a short cue burst, then skip a block of sectors
+#define SCAN_BURST_SECTORS 6                             // 80 ms of audio per burst
+#define SCAN_SKIP_SECTORS CD_SECTORS_PER_SECOND          // 1 s jumped per burst
+
+// Player that owns the output notifications are mixed into (first initialized)
+static audio_player_t *notification_player;
+
+// Point the player at a track: sector range, length and progress reset
+static int audio_load_track(audio_player_t *player, int track) {
+    // Get track information
+    int track_length;
+    if (cd_get_track_info(player->cd_player, track, &track_length) != 0) {
+        printf("❌ Failed to get track %d information\n", track);
+        return -1;
+    }
+    
+    // Get track sector positions
+    int start_lsn, end_lsn;
+    if (cd_get_track_bounds(player->cd_player, track, &start_lsn, &end_lsn) != 0) {
+        printf("❌ Failed to get track %d position\n", track);
+        return -1;
+    }
+    
+    player->track_start_sector = start_lsn;
+    player->track_end_sector = end_lsn;
+    player->current_track = track;
+    player->current_sector = start_lsn;
+    player->elapsed_seconds = 0;
+    player->track_length_seconds = track_length;
+    player->written_frames = 0;
+    
+    return 0;
+}
+
+// Wake the engine out of pcm_output_wait/poll; commands take effect at once
+static void audio_wake_engine(audio_player_t *player) {
+    uint64_t one = 1;
+    if (player->control_fd >= 0 && write(player->control_fd, &one, sizeof(one)) < 0) {
+        // Counter saturated: a wake-up is already pending
+    }
+}
+
+// Wake a parked reader: a new position, or a request it has to act on
+static void audio_wake_reader(audio_player_t *player) {
+    uint64_t one = 1;
+    if (player->reader_fd >= 0 && write(player->reader_fd, &one, sizeof(one)) < 0) {
+        // Counter saturated: a wake-up is already pending
+    }
+}
+
+// Reader side: only pay for the eventfd write when the engine is starving
+static void audio_notify_writer(audio_player_t *player) {
+    if (atomic_exchange_explicit(&player->writer_waiting, false, memory_order_acq_rel)) {
+        audio_wake_engine(player);
+    }
+}
+
+// Sleep on an eventfd until it is signalled (or the timeout expires)
+static void audio_wait_fd(int fd, int timeout_ms) {
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    
+    if (poll(&pfd, 1, timeout_ms) > 0) {
+        uint64_t count;
+        if (read(fd, &count, sizeof(count)) < 0) {
+            // Already drained
+        }
+    }
+}
+
+// Ask the reader to continue from a new position; older ring contents become
+// stale. Track 0 parks the reader. Engine thread only.
+static void audio_request_position(audio_player_t *player, int track, long lsn) {
+    atomic_store_explicit(&player->seek_track, track, memory_order_relaxed);
+    atomic_store_explicit(&player->seek_lsn, lsn, memory_order_relaxed);
+    atomic_store_explicit(&player->reader_done, false, memory_order_relaxed);
+    atomic_fetch_add_explicit(&player->seek_epoch, 1, memory_order_release);
+    
+    // The position clock restarts here once the old audio is dropped
+    player->prev_track = 0;
+    if (track > 0) {
+        player->heard_track = track;
+        player->written_frames = (lsn - player->track_start_sector) * CD_FRAMES_PER_SECTOR;
+    }
+    
+    audio_wake_reader(player);
+}
+
+static void audio_report_reader_stats(audio_player_t *player) {
+    sector_cache_stats_t stats;
+    sector_cache_get_stats(&player->cache, &stats);
+    printf("📀 CD reader idle (cache: %lu hits, %lu spill hits, %lu misses, %d/%d sectors)\n",
+           stats.hits, stats.spill_hits, stats.misses, stats.resident_sectors, stats.capacity_sectors);
+    
+    cd_read_engine_t *engine = &player->cd_player->read_engine;
+    printf("🛡️  Read engine: %s mode, %lu escalations, %lu paranoia events\n",
+           engine->full_mode ? "full" : "fast", engine->escalations, engine->events);
+    cd_report_read_throughput(player->cd_player);
+    
+    for (int track = 1; track < SECTOR_CONCEAL_MAX_TRACKS; track++) {
+        const sector_conceal_stats_t *conceal = &player->conceal.tracks[track];
+        if (conceal->samples > 0) {
+            printf("🩹 Track %d: %lu samples concealed in %lu gap(s) (%.2f s)\n", track,
+                   conceal->samples, conceal->gaps, (double)conceal->samples / PCM_OUTPUT_RATE);
+        }
+    }
+}
+
+// Queue a filled slot for the engine; the loudness meter sees it first
+static void audio_reader_commit(audio_player_t *player, ring_sector_t *slot) {
+    audio_loudness_feed(&player->loudness, player->cd_player, slot->samples, slot->lsn, slot->track);
+    sector_ring_commit_write(&player->ring);
+    audio_notify_writer(player);
+}
+
+// Wait for the writer to free a slot; NULL after a seek or on shutdown
+static ring_sector_t *audio_reader_slot(audio_player_t *player, unsigned int epoch) {
+    ring_sector_t *slot = sector_ring_begin_write(&player->ring);
+    while (!slot && !atomic_load_explicit(&player->shutdown, memory_order_relaxed) &&
+           atomic_load_explicit(&player->seek_epoch, memory_order_relaxed) == epoch) {
+        usleep(READER_BACKOFF_US);
+        slot = sector_ring_begin_write(&player->ring);
+    }
+    return slot;
+}
+
+// Emit the sectors concealment held back, starting in slot. With have_next,
+// slot holds the good sector after the gap: it is interpolated towards and
+// returned in a fresh slot, ready to commit. Without it the gap fades out.
+// Returns NULL when a seek or shutdown cut the flush short.
+static ring_sector_t *audio_reader_conceal(audio_player_t *player, ring_sector_t *slot,
+                                           bool have_next, unsigned int epoch) {
+    sector_conceal_t *conceal = &player->conceal;
+    int16_t next[CD_SAMPLES_PER_SECTOR];
+    int next_lsn = slot->lsn;
+    int next_track = slot->track;
+    
+    if (have_next) {
+        memcpy(next, slot->samples, CDIO_CD_FRAMESIZE_RAW);
+    }
+    
+    for (int i = 0; i < conceal->pending; i++) {
+        if (i > 0 && !(slot = audio_reader_slot(player, epoch))) {
+            sector_conceal_reset(conceal);
+            return NULL;
+        }
+        sector_conceal_synth(conceal, i, have_next ? next : NULL, slot->samples);
+        slot->lsn = conceal->pending_lsn + i;
+        slot->track = conceal->pending_track[i];
+        slot->epoch = epoch;
+        audio_reader_commit(player, slot);
+    }
+    
+    bool held = conceal->pending > 0;
+    sector_conceal_flushed(conceal, have_next);
+    if (!have_next) {
+        return NULL;
+    }
+    
+    if (held && !(slot = audio_reader_slot(player, epoch))) {
+        sector_conceal_reset(conceal);
+        return NULL;
+    }
+    memcpy(slot->samples, next, CDIO_CD_FRAMESIZE_RAW);
+    slot->lsn = next_lsn;
+    slot->track = next_track;
+    slot->epoch = epoch;
+    return slot;
+}
+
+// Time both read methods over the start of track 1; the reader is parked,
+// so only the UI can want the drive meanwhile
+static int audio_reader_benchmark(audio_player_t *player) {
+    int start, end;
+    if (!player->cd_player) {
+        return -1;
+    }
+    
+    cd_lock_drive(player->cd_player);
+    int result = -1;
+    if (cd_get_track_bounds(player->cd_player, 1, &start, &end) == 0) {
+        int count = end - start + 1;
+        if (count > AUDIO_READ_BENCHMARK_SECTORS) {
+            count = AUDIO_READ_BENCHMARK_SECTORS;
+        }
+        result = cd_benchmark_read(player->cd_player, start, count);
+    }
+    cd_unlock_drive(player->cd_player);
+    return result;
+}
+
+// CD reader thread: the only code that reads the drive during playback.
+// Fills the ring with sectors and never blocks the ALSA writer. Every drive
+// access holds drive_lock, so disc detection and eject from the UI happen
+// between reads; the paranoia handle is looked up afresh under the lock.
+static void* cd_reader_thread(void* arg) {
     audio_player_t *player = (audio_player_t*)arg;
+    cdrom_paranoia_t *paranoia = NULL;  // Handle drive_lsn and fast_reads refer to
+    
+    printf("📀 CD reader thread started\n");
+    
+    unsigned int epoch = atomic_load_explicit(&player->seek_epoch, memory_order_acquire);
+    int track = 0;         // 0: parked until the engine asks for a position
+    long start = 0;
+    long end = -1;
+    long lsn = 0;
+    long drive_lsn = -1;   // Where paranoia will read next
+    int scan_count = 0;    // Sectors played in the current scan burst
+    bool fast_reads = false;
+    bool scan_ready = false; // Parked long enough to start a loudness scan
+    
+    atomic_store_explicit(&player->reader_idle, true, memory_order_release);
+    
+    while (!atomic_load_explicit(&player->shutdown, memory_order_acquire)) {
+        // Settings from other threads only reach the drive through here
+        cd_read_method_t method = atomic_load_explicit(&player->read_method, memory_order_relaxed);
+        if (player->cd_player && player->cd_player->read_engine.method != method) {
+            cd_lock_drive(player->cd_player);
+            cd_set_read_method(player->cd_player, method, player->cd_player->read_engine.bulk_sectors);
+            cd_unlock_drive(player->cd_player);
+        }
+        if (atomic_load_explicit(&player->benchmark, memory_order_relaxed)) {
+            audio_completion_t *benchmark = atomic_exchange_explicit(&player->benchmark, NULL, memory_order_acquire);
+            audio_completion_signal(benchmark, track == 0 ? audio_reader_benchmark(player) : -1);
+        }
+        
+        // Seek and scan requests restart the reader at a new position
+        unsigned int requested = atomic_load_explicit(&player->seek_epoch, memory_order_acquire);
+        if (requested != epoch) {
+            int new_start, new_end;
+            epoch = requested;
+            
+            if (atomic_load_explicit(&player->seek_track, memory_order_relaxed) == 0) {
+                cd_lock_drive(player->cd_player);
+                if (track != 0) {
+                    audio_report_reader_stats(player);
+                }
+                if (fast_reads && paranoia == player->cd_player->paranoia) {
+                    cdio_paranoia_modeset(paranoia, player->cd_player->paranoia_mode);
+                }
+                cd_unlock_drive(player->cd_player);
+                fast_reads = false;
+                track = 0;
+                scan_ready = false;
+                atomic_store_explicit(&player->reader_idle, true, memory_order_release);
+                continue;
+            }
+            
+            // A new play request may follow a disc change
+            if (track == 0) {
+                sector_conceal_init(&player->conceal);
+            }
+            cd_lock_drive(player->cd_player);
+            audio_loudness_bind(&player->loudness, player->cd_player);
+            cd_unlock_drive(player->cd_player);
+            sector_conceal_reset(&player->conceal);
+            atomic_store_explicit(&player->reader_idle, false, memory_order_release);
+            drive_lsn = -1;
+            track = atomic_load_explicit(&player->seek_track, memory_order_relaxed);
+            lsn = atomic_load_explicit(&player->seek_lsn, memory_order_relaxed);
+            if (cd_get_track_bounds(player->cd_player, track, &new_start, &new_end) == 0) {
+                start = new_start;
+                end = new_end;
+            }
+            scan_count = 0;
+        }
+        
+        if (track == 0) {
+            // Parked and left alone for a while: the drive is free to
+            // measure tracks not played through yet
+            if (scan_ready && player->cd_player) {
+                cd_lock_drive(player->cd_player);
+                int scanned = audio_loudness_scan(&player->loudness, player->cd_player);
+                cd_unlock_drive(player->cd_player);
+                if (scanned > 0) {
+                    continue;
+                }
+            }
+            audio_wait_fd(player->reader_fd, player->loudness.scan ? AUDIO_LOUDNESS_SCAN_POLL_MS : -1);
+            scan_ready = true;
+            continue;
+        }
+        
+        // Scan: play a short cue burst, then jump a block of sectors
+        int scan = atomic_load_explicit(&player->scan_direction, memory_order_relaxed);
+        if (scan != 0 && ++scan_count > SCAN_BURST_SECTORS) {
+            scan_count = 1;
+            lsn += (scan > 0) ? SCAN_SKIP_SECTORS : -(SCAN_SKIP_SECTORS + SCAN_BURST_SECTORS);
+            if (lsn < start) {
+                lsn = start;
+            }
+        }
+        
+        if (lsn > end) {
+            // Gapless: run on into the next track while this one plays out
+            int next_start, next_end;
+            if (atomic_load_explicit(&player->gapless, memory_order_relaxed) &&
+                track < player->cd_player->num_tracks &&
+                cd_get_track_bounds(player->cd_player, track + 1, &next_start, &next_end) == 0) {
+                track++;
+                lsn = next_start;
+                start = next_start;
+                end = next_end;
+                printf("⏭️  Prefetching track %d\n", track);
+            } else {
+                // Sectors still held back by concealment fade out at the end
+                if (player->conceal.pending > 0) {
+                    ring_sector_t *tail = audio_reader_slot(player, epoch);
+                    if (tail) {
+                        audio_reader_conceal(player, tail, false, epoch);
+                    }
+                }
+                
+                // Nothing left to read; wait for a seek back or a new request
+                if (!atomic_load_explicit(&player->reader_done, memory_order_relaxed) &&
+                    atomic_load_explicit(&player->seek_epoch, memory_order_acquire) == epoch) {
+                    atomic_store_explicit(&player->reader_done, true, memory_order_release);
+                    audio_notify_writer(player);
+                }
+                audio_wait_fd(player->reader_fd, -1);
+                continue;
+            }
+        }
+        
+        // Wait for the writer to free a slot
+        ring_sector_t *slot = audio_reader_slot(player, epoch);
+        if (!slot) {
+            continue;
+        }
+        
+        slot->lsn = lsn;
+        slot->track = track;
+        slot->epoch = epoch;
+        
+        // Replays and restarts come straight from the cache
+        if (sector_cache_lookup(&player->cache, lsn, slot->samples)) {
+            if (!sector_conceal_idle(&player->conceal) &&
+                !(slot = audio_reader_conceal(player, slot, true, epoch))) {
+                continue;
+            }
+            sector_conceal_good(&player->conceal, slot->samples);
+            audio_reader_commit(player, slot);
+            lsn++;
+            continue;
+        }
+        
+        cd_lock_drive(player->cd_player);
+        
+        // Disc detected afresh: paranoia has a new handle, with no position
+        if (paranoia != player->cd_player->paranoia) {
+            paranoia = player->cd_player->paranoia;
+            drive_lsn = -1;
+            fast_reads = false;
+        }
+        
+        // Cue bursts don't need verified reads
+        if (paranoia && (scan != 0) != fast_reads) {
+            fast_reads = (scan != 0);
+            cdio_paranoia_modeset(paranoia, fast_reads ? PARANOIA_MODE_DISABLE : player->cd_player->paranoia_mode);
+        }
+        
+        // Clean stretch with bulk reads enabled: one ioctl straight into the ring.
+        // Nothing checked these sectors, so they stay out of the cache.
+        if (!fast_reads && cd_bulk_read_active(player->cd_player) && sector_conceal_idle(&player->conceal)) {
+            size_t count;
+            size_t want = (size_t)(end - lsn + 1);
+            if (want > (size_t)player->cd_player->read_engine.bulk_sectors) {
+                want = player->cd_player->read_engine.bulk_sectors;
+            }
+            
+            ring_sector_t *batch = sector_ring_begin_write_batch(&player->ring, want, &count);
+            drive_lsn = -1; // Paranoia no longer knows where the drive is
+            
+            if (batch && cd_read_sectors_bulk(player->cd_player, lsn, (int)count, batch->samples) == 0) {
+                cd_unlock_drive(player->cd_player);
+                for (size_t i = 0; i < count; i++) {
+                    batch[i].lsn = lsn + i;
+                    batch[i].track = track;
+                    batch[i].epoch = epoch;
+                    audio_loudness_feed(&player->loudness, player->cd_player, batch[i].samples, batch[i].lsn, track);
+                }
+                sector_conceal_good(&player->conceal, batch[count - 1].samples);
+                sector_ring_commit_batch(&player->ring, count);
+                audio_notify_writer(player);
+                lsn += count;
+                continue;
+            }
+            // Failed batch escalated the engine; verify this sector with paranoia
+        }
+        
+        // Cache hits or a seek moved us away from the drive; reposition paranoia
+        if (paranoia && lsn != drive_lsn) {
+            cdio_paranoia_seek(paranoia, lsn, SEEK_SET);
+        }
+        
+        // Scan bursts read raw; everything else goes through the adaptive engine.
+        // No handle (disc ejected): nothing to read, conceal like a read error.
+        bool verified = false;
+        int16_t *audio_data = NULL;
+        if (paranoia) {
+            audio_data = fast_reads ? cdio_paranoia_read(paranoia, NULL) :
+                                      cd_read_sector(player->cd_player, lsn, &verified);
+        }
+        bool damaged = !fast_reads && player->cd_player->read_engine.damaged;
+        if (audio_data) {
+            memcpy(slot->samples, audio_data, CDIO_CD_FRAMESIZE_RAW);
+        }
+        cd_unlock_drive(player->cd_player);
+        drive_lsn = lsn + 1;
+        lsn++;
+        
+        // Unreadable or given up on: conceal it, never drop it (keeps time)
+        if (!audio_data || damaged) {
+            if (!audio_data) {
+                printf("❌ Failed to read sector %d from CD\n", slot->lsn);
+            }
+            if (sector_conceal_fail(&player->conceal, slot->lsn, track)) {
+                audio_reader_conceal(player, slot, false, epoch);
+            }
+            continue;
+        }
+        
+        if (verified) {
+            sector_cache_store(&player->cache, slot->lsn, slot->samples);
+        }
+        if (!sector_conceal_idle(&player->conceal) &&
+            !(slot = audio_reader_conceal(player, slot, true, epoch))) {
+            continue;
+        }
+        sector_conceal_good(&player->conceal, slot->samples);
+        audio_reader_commit(player, slot);
+    }
+    
+    if (fast_reads) {
+        cd_lock_drive(player->cd_player);
+        if (paranoia == player->cd_player->paranoia) {
+            cdio_paranoia_modeset(paranoia, player->cd_player->paranoia_mode);
+        }
+        cd_unlock_drive(player->cd_player);
+    }
+    
+    // Nobody is left to run a benchmark asked for just now
+    audio_completion_t *benchmark = atomic_exchange(&player->benchmark, NULL);
+    if (benchmark) {
+        audio_completion_signal(benchmark, -1);
+    }
+    
+    printf("📀 CD reader thread ended\n");
+    return NULL;
+}
+
+// Start or continue a crossfade on a whole tail sector, in place. The fade
+// starts at the sector that leaves exactly its length of the track, once
+// the reader has the next track's first sector that far behind it in the
+// ring; the head sector mixed in is always the same distance back.
+static void audio_crossfade_sector(audio_player_t *player, const ring_sector_t *sector, unsigned int epoch) {
+    audio_crossfade_t *xfade = &player->crossfade;
+    
+    if (xfade->sectors == 0) {
+        int sectors = atomic_load_explicit(&xfade->seconds, memory_order_relaxed) * CD_SECTORS_PER_SECOND;
+        int limit = (int)player->ring.capacity - CD_SECTORS_PER_SECOND;
+        if (sectors > limit) {
+            sectors = limit;
+        }
+        
+        int next_start, next_end;
+        if (sectors <= 0 || !atomic_load_explicit(&player->gapless, memory_order_relaxed) ||
+            sector->track != player->current_track ||
+            sector->lsn != player->track_end_sector - sectors + 1 ||
+            player->track_end_sector - player->track_start_sector + 1 <= sectors ||
+            atomic_load_explicit(&player->scan_direction, memory_order_relaxed) != 0 ||
+            cd_get_track_bounds(player->cd_player, player->current_track + 1, &next_start, &next_end) != 0 ||
+            next_end - next_start + 1 <= sectors) {
+            return;
+        }
+        
+        // Not read that far ahead (slow drive, small ring): plain gapless
+        const ring_sector_t *head = sector_ring_peek_at(&player->ring, sectors);
+        if (!head || head->epoch != epoch || head->lsn != next_start) {
+            return;
+        }
+        audio_crossfade_begin(xfade, player->current_track + 1, next_start, sectors);
+    }
+    
+    const ring_sector_t *head = sector_ring_peek_at(&player->ring, xfade->sectors);
+    if (head && (head->epoch != epoch || head->track != xfade->to_track || head->lsn != xfade->to_start + xfade->done)) {
+        head = NULL;
+    }
+    
+    if (audio_crossfade_mix(xfade, sector->samples, head ? head->samples : NULL,
+                            cd_track_preemphasis(player->cd_player, xfade->to_track),
+                            audio_loudness_track_gain(&player->loudness, xfade->to_track))) {
+        // The incoming track's filter carries on with its history
+        player->deemph = xfade->deemph;
+    }
+}
+
+// Copy up to frames of audio from the ring into dst (the device ring with MMAP).
+// Handles stale sectors, partial sectors and gapless track hand-over.
+static snd_pcm_uframes_t audio_fill_from_ring(audio_player_t *player, int16_t *dst,
+                                              snd_pcm_uframes_t frames, unsigned int epoch) {
+    snd_pcm_uframes_t filled = 0;
+    
+    while (filled < frames) {
+        const ring_sector_t *sector = sector_ring_peek(&player->ring);
+        if (!sector) {
+            break;
+        }
+        
+        // Sectors read before the last seek are skipped
+        if (sector->epoch != epoch) {
+            sector_ring_release(&player->ring);
+            player->sector_offset = 0;
+            continue;
+        }
+        
+        // A finished crossfade already played the head of the new track
+        if (player->crossfade.skip > 0 && sector->track == player->crossfade.to_track) {
+            sector_ring_release(&player->ring);
+            player->crossfade.skip--;
+            continue;
+        }
+        
+        // Gapless hand-over: first sample of the next track, same running PCM
+        if (player->sector_offset == 0 && sector->track != player->current_track) {
+            // The old track stays audible until the device drains it
+            int prev_track = player->current_track;
+            long prev_frames = (long)(player->track_end_sector - player->track_start_sector + 1) * CD_FRAMES_PER_SECTOR;
+            int prev_length = player->track_length_seconds;
+            
+            if (audio_load_track(player, sector->track) == 0) {
+                player->prev_track = prev_track;
+                player->prev_track_frames = prev_frames;
+                player->prev_length_seconds = prev_length;
+                printf("⏭️  Gapless transition to track %d\n", player->current_track);
+            }
+        }
+        
+        // Whole sector at once, before any of it goes out
+        if (player->sector_offset == 0) {
+            sector_deemph_process(&player->deemph, sector->samples, sector->track,
+                                  cd_track_preemphasis(player->cd_player, sector->track));
+            audio_loudness_apply(&player->loudness, sector->samples, sector->track);
+            audio_crossfade_sector(player, sector, epoch);
+        }
+        
+        snd_pcm_uframes_t count = CD_FRAMES_PER_SECTOR - player->sector_offset;
+        if (count > frames - filled) {
+            count = frames - filled;
+        }
+        
+        memcpy(dst + filled * PCM_OUTPUT_CHANNELS,
+               sector->samples + player->sector_offset * PCM_OUTPUT_CHANNELS,
+               count * PCM_OUTPUT_FRAME_BYTES);
+        filled += count;
+        player->sector_offset += count;
+        player->written_frames = (sector->lsn - player->track_start_sector) * CD_FRAMES_PER_SECTOR +
+                                 player->sector_offset;
+        
+        if (player->sector_offset < CD_FRAMES_PER_SECTOR) {
+            break; // Destination full mid-sector
+        }
+        
+        // Whole sector handed to the device (heard later; see audio_update_position)
+        long played = sector->lsn - player->track_start_sector + 1;
+        
+        if (played % CD_SECTORS_PER_SECOND == 0) {
+            long written_seconds = played / CD_SECTORS_PER_SECOND;
+            printf("⏱️  Playing: %ld:%02ld (sector %ld/%d, ring %zu/%zu)\n", 
+                   written_seconds / 60, written_seconds % 60,
+                   played, player->track_end_sector - player->track_start_sector + 1,
+                   sector_ring_fill(&player->ring), player->ring.capacity);
+        }
+        
+        sector_ring_release(&player->ring);
+        player->sector_offset = 0;
+    }
+    
+    return filled;
+}
+
+// Keep the CD audio just handed to the PCM, newest last (engine only)
+static void audio_history_store(audio_player_t *player, const int16_t *samples, size_t frames) {
+    if (!player->history || frames == 0) {
+        return;
+    }
+    
+    if (frames > player->history_capacity) {
+        samples += (frames - player->history_capacity) * PCM_OUTPUT_CHANNELS;
+        frames = player->history_capacity;
+    }
+    
+    size_t first = player->history_capacity - player->history_pos;
+    if (first > frames) {
+        first = frames;
+    }
+    memcpy(player->history + player->history_pos * PCM_OUTPUT_CHANNELS, samples, first * PCM_OUTPUT_FRAME_BYTES);
+    memcpy(player->history, samples + first * PCM_OUTPUT_CHANNELS, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+    
+    player->history_pos = (player->history_pos + frames) % player->history_capacity;
+    player->history_fill += frames;
+    if (player->history_fill > player->history_capacity) {
+        player->history_fill = player->history_capacity;
+    }
+}
+
+// Copy the newest frames of the history into dst, oldest first
+static void audio_history_tail(audio_player_t *player, int16_t *dst, size_t frames) {
+    size_t start = (player->history_pos + player->history_capacity - frames) % player->history_capacity;
+    size_t first = player->history_capacity - start;
+    if (first > frames) {
+        first = frames;
+    }
+    memcpy(dst, player->history + start * PCM_OUTPUT_CHANNELS, first * PCM_OUTPUT_FRAME_BYTES);
+    memcpy(dst + first * PCM_OUTPUT_CHANNELS, player->history, (frames - first) * PCM_OUTPUT_FRAME_BYTES);
+}
+
+// Forget the history and any pending replay: the PCM no longer continues
+// from them (seek, stop)
+static void audio_history_reset(audio_player_t *player) {
+    player->history_pos = 0;
+    player->history_fill = 0;
+    
+    free(player->replay);
+    player->replay = NULL;
+    player->replay_frames = 0;
+    player->replay_pos = 0;
+    player->fade_in_pos = -1;
+}
+
+// Size the history to what the (new) device can hold unplayed, plus the
+// delay line in front of it while other outputs play along
+static void audio_history_resize(audio_player_t *player) {
+    free(player->history);
+    player->history_capacity = player->output.buffer_size +
+                               (player->fanout.count > 0 ? AUDIO_FANOUT_MAX_DELAY_FRAMES : 0);
+    player->history = player->history_capacity ? malloc(player->history_capacity * PCM_OUTPUT_FRAME_BYTES) : NULL;
+    if (!player->history) {
+        player->history_capacity = 0;
+    }
+    player->history_pos = 0;
+    player->history_fill = 0;
+}
+
+// Fill dst for the PCM: after a device switch the replayed audio comes
+// first, then the ring. The history keeps the result before a new device
+// fades it in.
+static snd_pcm_uframes_t audio_fill(audio_player_t *player, int16_t *dst, snd_pcm_uframes_t frames) {
+    snd_pcm_uframes_t filled = 0;
+    
+    if (player->replay) {
+        filled = player->replay_frames - player->replay_pos;
+        if (filled > frames) {
+            filled = frames;
+        }
+        memcpy(dst, player->replay + player->replay_pos * PCM_OUTPUT_CHANNELS, filled * PCM_OUTPUT_FRAME_BYTES);
+        player->replay_pos += filled;
+        player->written_frames += filled;
+    
+        if (player->replay_pos >= player->replay_frames) {
+            free(player->replay);
+            player->replay = NULL;
+        }
+    }
+    
+    if (filled < frames) {
+        filled += audio_fill_from_ring(player, dst + filled * PCM_OUTPUT_CHANNELS, frames - filled,
+                                       player->output_epoch);
+    }
+    audio_history_store(player, dst, filled);
+    
+    for (snd_pcm_uframes_t i = 0; i < filled && player->fade_in_pos >= 0; i++) {
+        float gain = (player->fade_in_pos + 0.5f) / AUDIO_SWITCH_FADE_FRAMES;
+        dst[i * 2] = (int16_t)(dst[i * 2] * gain);
+        dst[i * 2 + 1] = (int16_t)(dst[i * 2 + 1] * gain);
+        if (++player->fade_in_pos >= AUDIO_SWITCH_FADE_FRAMES) {
+            player->fade_in_pos = -1;
+        }
+    }
+    
+    return filled;
+}
+
+// Engine is about to wait for sectors: ask the reader to wake it. The ring is
+// checked again afterwards so a commit in between is never missed.
+static bool audio_writer_starving(audio_player_t *player, size_t needed) {
+    atomic_store_explicit(&player->writer_waiting, true, memory_order_seq_cst);
+    if (sector_ring_fill(&player->ring) >= needed ||
+        atomic_load_explicit(&player->reader_done, memory_order_acquire)) {
+        atomic_store_explicit(&player->writer_waiting, false, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+static unsigned long long audio_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Position clock: the listener hears what was written minus what the device
+// (and a Bluetooth link) still holds, not what the reader has fetched
+static void audio_update_position(audio_player_t *player) {
+    player->heard_track = player->current_track;
+    player->heard_length_seconds = player->track_length_seconds;
+    player->clock_running = false;
+    
+    if (player->state == AUDIO_STATE_STOPPED) {
+        player->heard_frames = 0;
+        return;
+    }
+    
+    long track_frames = (long)(player->track_end_sector - player->track_start_sector + 1) * CD_FRAMES_PER_SECTOR;
+    snd_pcm_sframes_t delay = 0;
+    
+    // Until the engine drops it, the PCM holds audio from before the last seek
+    if (player->output_epoch == atomic_load_explicit(&player->seek_epoch, memory_order_acquire)) {
+        pcm_output_delay(&player->output, &delay);
+        delay += audio_fanout_held(&player->fanout);
+        player->clock_running = (player->state == AUDIO_STATE_PLAYING &&
+                                 snd_pcm_state(player->output.handle) == SND_PCM_STATE_RUNNING);
+    }
+    
+    long heard = player->written_frames - delay;
+    if (heard < 0 && player->prev_track > 0) {
+        // Still draining the tail of the previous track after a gapless switch
+        heard += player->prev_track_frames;
+        track_frames = player->prev_track_frames;
+        player->heard_track = player->prev_track;
+        player->heard_length_seconds = player->prev_length_seconds;
+    } else if (heard >= 0) {
+        player->prev_track = 0;
+    }
+    
+    if (heard < 0) {
+        heard = 0;
+    } else if (heard > track_frames) {
+        heard = track_frames;
+    }
+    
+    player->heard_frames = heard;
+    player->elapsed_seconds = heard / PCM_OUTPUT_RATE;
+    player->current_sector = player->track_start_sector;
+    if (player->heard_track == player->current_track) {
+        player->current_sector += heard / CD_FRAMES_PER_SECTOR;
+    }
+}
+
+// Publish the engine state (seqlock; the engine is the only writer)
+// Strings go through the seqlock a character at a time, like any other field
+static void audio_publish_string(atomic_char *dst, const char *src, size_t size) {
+    size_t i = 0;
+    for (; i < size - 1 && src[i]; i++) {
+        atomic_store_explicit(&dst[i], src[i], memory_order_relaxed);
+    }
+    atomic_store_explicit(&dst[i], '\0', memory_order_relaxed);
+}
+
+static void audio_read_string(char *dst, atomic_char *src, size_t size) {
+    size_t i = 0;
+    for (; i < size - 1; i++) {
+        dst[i] = atomic_load_explicit(&src[i], memory_order_relaxed);
+        if (!dst[i]) {
+            return;
+        }
+    }
+    dst[i] = '\0';
+}
+
+static void audio_publish(audio_player_t *player) {
+    audio_snapshot_slot_t *slot = &player->snapshot;
+    unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    
+    audio_update_position(player);
+    long length_frames = (long)(player->track_end_sector - player->track_start_sector + 1) * CD_FRAMES_PER_SECTOR;
+    if (player->heard_track != player->current_track) {
+        length_frames = player->prev_track_frames;
+    }
+    
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    
+    atomic_store_explicit(&slot->state, player->state, memory_order_relaxed);
+    atomic_store_explicit(&slot->track, player->heard_track, memory_order_relaxed);
+    atomic_store_explicit(&slot->elapsed_seconds, player->elapsed_seconds, memory_order_relaxed);
+    atomic_store_explicit(&slot->track_length_seconds, player->heard_length_seconds, memory_order_relaxed);
+    atomic_store_explicit(&slot->scan_direction,
+                          atomic_load_explicit(&player->scan_direction, memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_store_explicit(&slot->current_sector, player->current_sector, memory_order_relaxed);
+    atomic_store_explicit(&slot->position_ms, player->heard_frames * 1000L / PCM_OUTPUT_RATE, memory_order_relaxed);
+    atomic_store_explicit(&slot->length_ms, length_frames * 1000L / PCM_OUTPUT_RATE, memory_order_relaxed);
+    atomic_store_explicit(&slot->clock_running, player->clock_running, memory_order_relaxed);
+    atomic_store_explicit(&slot->stamp_ms, audio_now_ms(), memory_order_relaxed);
+    atomic_store_explicit(&slot->commands_done, player->commands_applied, memory_order_relaxed);
+    atomic_store_explicit(&slot->deemphasis, player->state != AUDIO_STATE_STOPPED && player->deemph.active,
+                          memory_order_relaxed);
+    atomic_store_explicit(&slot->crossfading, player->state != AUDIO_STATE_STOPPED && player->crossfade.sectors > 0,
+                          memory_order_relaxed);
+    audio_publish_string(slot->device, player->output.device_name, sizeof(slot->device));
+    atomic_store_explicit(&slot->latency_profile, player->output.profile, memory_order_relaxed);
+    atomic_store_explicit(&slot->outputs_done, player->outputs_applied, memory_order_relaxed);
+    atomic_store_explicit(&slot->output_failed, player->output_failed, memory_order_relaxed);
+    
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+}
+
+static int audio_engine_play(audio_player_t *player, int track) {
+    if (!player->output.handle || !player->cd_player) {
+        return -1;
+    }
+    
+    printf("🎵 Starting playback of track %d\n", track);
+    printf("📱 Using audio device: %s\n", player->output.device_name);
+    
+    // Verify the audio device is still valid and matches current selection
+    snd_pcm_state_t state = snd_pcm_state(player->output.handle);
+    if (state == SND_PCM_STATE_DISCONNECTED) {
+        printf("⚠️  Audio device disconnected, reinitializing...\n");
+        
+        // Reinitialize with current device
+        char current_device[64];
+        snprintf(current_device, sizeof(current_device), "%s", player->output.device_name);
+        
+        pcm_output_close(&player->output);
+        
+        if (audio_open_device(player, &player->output, current_device) != 0) {
+            printf("❌ Failed to reinitialize audio device\n");
+            player->state = AUDIO_STATE_STOPPED;
+            return -1;
+        }
+        audio_history_resize(player);
+    }
+    
+    // Get track information and sector positions
+    if (audio_load_track(player, track) != 0) {
+        return -1;
+    }
+    
+    // A parked reader can't touch the ring: resize it if asked and start empty.
+    // Otherwise the epoch bump below makes whatever it holds stale.
+    if (atomic_load_explicit(&player->reader_idle, memory_order_acquire)) {
+        int ring_seconds = atomic_load_explicit(&player->ring_seconds, memory_order_relaxed);
+        if (player->ring.capacity != (size_t)ring_seconds * CD_SECTORS_PER_SECOND) {
+            sector_ring_free(&player->ring);
+            if (sector_ring_init(&player->ring, ring_seconds) != 0) {
+                player->state = AUDIO_STATE_STOPPED;
+                return -1;
+            }
+        }
+        sector_ring_reset(&player->ring);
+    }
+    
+    // Cache survives track changes but not disc changes
+    sector_cache_bind_disc(&player->cache, player->cd_player->disc_id, player->cd_player->disc_sectors);
+    
+    player->ring_underruns = 0;
+    player->state = AUDIO_STATE_PLAYING;
+    atomic_store_explicit(&player->scan_direction, 0, memory_order_relaxed);
+    
+    printf("📊 Track %d: sectors %d to %d (%d seconds)\n", 
+           track, player->track_start_sector, player->track_end_sector, player->track_length_seconds);
+    
+    // The writer side sees the new epoch and drops/prepares the PCM
+    audio_request_position(player, track, player->track_start_sector);
+    return 0;
+}
+
+static void audio_engine_stop(audio_player_t *player) {
+    if (player->state == AUDIO_STATE_STOPPED) {
+        return;
+    }
+    
+    printf("⏹️  Stopping playback\n");
+    
+    player->state = AUDIO_STATE_STOPPED;
+    atomic_store_explicit(&player->scan_direction, 0, memory_order_relaxed);
+    audio_request_position(player, 0, 0); // Park the reader
+    audio_history_reset(player);
+    audio_fanout_flush(&player->fanout);
+    
+    // Stop and drain the PCM device
+    int err = snd_pcm_drop(player->output.handle);
+    if (err < 0) {
+        fprintf(stderr, "Cannot stop playback: %s\n", snd_strerror(err));
+    }
+    
+    err = pcm_output_prepare(&player->output);
+    if (err < 0) {
+        fprintf(stderr, "Cannot prepare audio interface: %s\n", snd_strerror(err));
+    }
+    
+    // Reset timing
+    player->elapsed_seconds = 0;
+    player->current_sector = 0;
+    
+    printf("✅ Playback stopped\n");
+}
+
+static int audio_engine_pause(audio_player_t *player) {
+    if (player->state != AUDIO_STATE_PLAYING) {
+        return player->state == AUDIO_STATE_PAUSED ? 0 : -1;
+    }
+    
+    printf("⏸️  Pausing playback\n");
+    
+    // Check PCM state before pausing
+    snd_pcm_state_t state = snd_pcm_state(player->output.handle);
+    printf("🔍 PCM state before pause: %d\n", state);
+    
+    if (state == SND_PCM_STATE_RUNNING) {
+        int err = snd_pcm_pause(player->output.handle, 1);
+        if (err < 0) {
+            fprintf(stderr, "Cannot pause playback: %s\n", snd_strerror(err));
+            
+            // Fallback: use drop instead of pause
+            printf("🔄 Trying alternative pause method...\n");
+            err = snd_pcm_drop(player->output.handle);
+            if (err < 0) {
+                fprintf(stderr, "Cannot drop playback: %s\n", snd_strerror(err));
+                return -1;
+            }
+        }
+    }
+    
+    audio_fanout_pause(&player->fanout, true);
+    player->state = AUDIO_STATE_PAUSED;
+    return 0;
+}
+
+static int audio_engine_resume(audio_player_t *player) {
+    if (player->state != AUDIO_STATE_PAUSED) {
+        return -1;
+    }
+    
+    printf("▶️  Resuming playback\n");
+    
+    // Check PCM state before resuming
+    snd_pcm_state_t state = snd_pcm_state(player->output.handle);
+    printf("🔍 PCM state before resume: %d\n", state);
+    
+    if (state == SND_PCM_STATE_PAUSED) {
+        int err = snd_pcm_pause(player->output.handle, 0);
+        if (err < 0) {
+            fprintf(stderr, "Cannot resume playback: %s\n", snd_strerror(err));
+            
+            // Fallback: prepare and restart
+            printf("🔄 Trying alternative resume method...\n");
+            err = pcm_output_prepare(&player->output);
+            if (err < 0) {
+                fprintf(stderr, "Cannot prepare for resume: %s\n", snd_strerror(err));
+                return -1;
+            }
+        }
+    } else if (state == SND_PCM_STATE_SETUP) {
+        // Device was dropped, just prepare it
+        int err = pcm_output_prepare(&player->output);
+        if (err < 0) {
+            fprintf(stderr, "Cannot prepare for resume: %s\n", snd_strerror(err));
+            return -1;
+        }
+    }
+    
+    audio_fanout_pause(&player->fanout, false);
+    player->state = AUDIO_STATE_PLAYING;
+    return 0;
+}
+
+// Ring depth for the next track start: the one asked for, deepened to hold
+// the crossfade plus slack while one is set. Returns true if it changed.
+static bool audio_update_ring_depth(audio_player_t *player) {
+    int seconds = atomic_load_explicit(&player->ring_requested, memory_order_relaxed);
+    int fade = atomic_load_explicit(&player->crossfade.seconds, memory_order_relaxed);
+    if (fade > 0 && seconds < fade + AUDIO_CROSSFADE_SLACK_SECONDS) {
+        seconds = fade + AUDIO_CROSSFADE_SLACK_SECONDS;
+        if (seconds > SECTOR_RING_MAX_SECONDS) {
+            seconds = SECTOR_RING_MAX_SECONDS;
+        }
+    }
+    return atomic_exchange_explicit(&player->ring_seconds, seconds, memory_order_relaxed) != seconds;
+}
+
+// Overlap each track's last seconds with the next one's first (0: gapless).
+// Needs gapless run-on, and a ring deep enough to hold the fade plus slack.
+// The ring is only resized at the next track start, so until then a fade
+// is cut to what the current ring holds; turning crossfade off gives the
+// ring back its own depth.
+int audio_set_crossfade(audio_player_t *player, int seconds) {
+    if (!player) {
+        return -1;
+    }
+    
+    if (seconds < 0) {
+        seconds = 0;
+    } else if (seconds > AUDIO_CROSSFADE_MAX_SECONDS) {
+        seconds = AUDIO_CROSSFADE_MAX_SECONDS;
+    }
+    
+    atomic_store_explicit(&player->crossfade.seconds, seconds, memory_order_relaxed);
+    bool resized = audio_update_ring_depth(player);
+    
+    if (seconds > 0) {
+        printf("✅ Crossfade: %d s between tracks%s\n", seconds,
+               atomic_load_explicit(&player->gapless, memory_order_relaxed) ? "" : " (needs gapless playback)");
+        if (resized) {
+            printf("⚠️  Read-ahead ring deepens to %d seconds at the next track start; the first fade may be shorter\n",
+                   atomic_load_explicit(&player->ring_seconds, memory_order_relaxed));
+        }
+    } else {
+        printf("✅ Crossfade off, gapless transitions\n");
+    }
+    return 0;
+}
+
+int audio_get_crossfade(audio_player_t *player) {
+    return atomic_load_explicit(&player->crossfade.seconds, memory_order_relaxed);
+}
+
+// Jump to a position within the current track (sector-accurate)
+static int audio_engine_seek(audio_player_t *player, long position_ms) {
+    if (player->state == AUDIO_STATE_STOPPED) {
+        return -1;
+    }
+    
+    long lsn = player->track_start_sector + (position_ms * CD_SECTORS_PER_SECOND + 500) / 1000;
+    if (lsn < player->track_start_sector) {
+        lsn = player->track_start_sector;
+    } else if (lsn > player->track_end_sector) {
+        lsn = player->track_end_sector;
+    }
+    
+    long offset = lsn - player->track_start_sector;
+    printf("⏩ Seeking track %d to %ld:%02ld.%02ld (sector %ld)\n", player->current_track,
+           offset / CD_SECTORS_PER_SECOND / 60, offset / CD_SECTORS_PER_SECOND % 60,
+           offset % CD_SECTORS_PER_SECOND, lsn);
+    
+    audio_request_position(player, player->current_track, lsn);
+    return 0;
+}
+
+// Start (direction > 0 forward, < 0 backward) or stop (0) fast scan
+static int audio_engine_scan(audio_player_t *player, int direction) {
+    if (player->state != AUDIO_STATE_PLAYING) {
+        return -1;
+    }
+    
+    direction = (direction > 0) - (direction < 0);
+    if (direction == atomic_load_explicit(&player->scan_direction, memory_order_relaxed)) {
+        return 0;
+    }
+    
+    printf("%s\n", direction > 0 ? "⏩ Scanning forward" : 
+                   direction < 0 ? "⏪ Scanning backward" : "▶️  Scan ended");
+    
+    // Both scanning and normal play continue from what is being heard now
+    atomic_store_explicit(&player->scan_direction, direction, memory_order_relaxed);
+    audio_request_position(player, player->current_track, player->current_sector);
+    return 0;
+}
+
+static int audio_engine_skip(audio_player_t *player, int delta) {
+    int track = player->heard_track + delta; // Relative to what is heard, not read
+    if (!player->cd_player || track < 1 || track > player->cd_player->num_tracks) {
+        return -1;
+    }
+    return audio_engine_play(player, track);
+}
+
+// Device switch, old side: take back what the device has not played yet
+// (as far as it can rewind) into the replay buffer and end it with a short
+// fade. Returns true if the rest is left to play out, which the caller
+// hands off so the engine does not wait for it. A paused or stalled device,
+// or one that is about to be reopened (play_out false), is dropped and
+// everything it held is replayed. Frames still in the fan-out delay line
+// were never written and are always replayed.
+static bool audio_switch_capture(audio_player_t *player, bool play_out) {
+    snd_pcm_sframes_t unheard = 0;
+    pcm_output_delay(&player->output, &unheard);
+    bool running = (play_out && player->state == AUDIO_STATE_PLAYING &&
+                    snd_pcm_state(player->output.handle) == SND_PCM_STATE_RUNNING);
+    size_t held = audio_fanout_held(&player->fanout);
+    unheard += held;
+    
+    // A replay the old device had not got through yet (switching again
+    // straight away) follows whatever is taken back from it
+    int16_t *pending = player->replay;
+    size_t pending_frames = pending ? player->replay_frames - player->replay_pos : 0;
+    
+    size_t take = (size_t)unheard < player->history_fill ? (size_t)unheard : player->history_fill;
+    player->replay = malloc((take + pending_frames + AUDIO_SWITCH_FADE_FRAMES) * PCM_OUTPUT_FRAME_BYTES);
+    if (!player->replay) {
+        take = 0;
+        pending_frames = 0;
+    } else if (running && take > held) {
+        take = held + pcm_output_rewind(&player->output, take - held);
+    }
+    audio_fanout_take_back(&player->fanout, take);
+    
+    // First frame the old device will not play, in current track frames
+    long resume_frame = player->written_frames - (long)take;
+    int track = player->current_track;
+    
+    if (take > 0) {
+        audio_history_tail(player, player->replay, take);
+    }
+    if (pending_frames > 0) {
+        memcpy(player->replay + take * PCM_OUTPUT_CHANNELS, pending + player->replay_pos * PCM_OUTPUT_CHANNELS,
+               pending_frames * PCM_OUTPUT_FRAME_BYTES);
+    }
+    free(pending);
+    player->replay_frames = take + pending_frames;
+    player->replay_pos = 0;
+    
+    // The fade out needs audio past the rewind point: borrow it from the ring
+    if (running && player->replay && player->replay_frames < AUDIO_SWITCH_FADE_FRAMES) {
+        size_t have = player->replay_frames;
+        player->replay_frames += audio_fill_from_ring(player, player->replay + have * PCM_OUTPUT_CHANNELS,
+                                                      AUDIO_SWITCH_FADE_FRAMES - have, player->output_epoch);
+        if (player->current_track != track) {
+            resume_frame -= player->prev_track_frames; // Crossed into the next track
+        }
+    }
+    player->written_frames = resume_frame;
+    
+    if (running) {
+        int16_t fade[AUDIO_SWITCH_FADE_FRAMES * PCM_OUTPUT_CHANNELS];
+        size_t count = player->replay_frames < AUDIO_SWITCH_FADE_FRAMES ? player->replay_frames : AUDIO_SWITCH_FADE_FRAMES;
+    
+        for (size_t i = 0; i < count; i++) {
+            float gain = 1.0f - (i + 0.5f) / AUDIO_SWITCH_FADE_FRAMES;
+            fade[i * 2] = (int16_t)(player->replay[i * 2] * gain);
+            fade[i * 2 + 1] = (int16_t)(player->replay[i * 2 + 1] * gain);
+        }
+        pcm_output_write(&player->output, fade, count);
+    
+        printf("🔀 Replaying %zu frames on the new device, %ld ms still playing out on %s\n",
+               take + pending_frames, (long)(unheard - (snd_pcm_sframes_t)take) * 1000L / PCM_OUTPUT_RATE,
+               player->output.device_name);
+    } else {
+        snd_pcm_drop(player->output.handle);
+    }
+    
+    if (player->replay_frames == 0) {
+        free(player->replay);
+        player->replay = NULL;
+    }
+    return running;
+}
+
+// Move the output to another device, already opened by the helper.
+// Playback does not stop: the reader and ring carry on, and the new device
+// resumes at the first frame the old one did not play, after a short fade
+// out and fade in, while the old one plays out in the background.
+static void audio_engine_swap_output(audio_player_t *player, pcm_output_t *next) {
+    bool allow_mmap = atomic_load_explicit(&player->allow_mmap, memory_order_relaxed);
+    bool live = (player->state != AUDIO_STATE_STOPPED &&
+                 player->output_epoch == atomic_load_explicit(&player->seek_epoch, memory_order_acquire));
+    
+    printf("🔀 Switching output from %s to %s%s\n", player->output.device_name, next->device_name,
+           live ? " during playback" : "");
+    
+    bool playing_out = false;
+    if (live) {
+        playing_out = audio_switch_capture(player, true);
+    } else {
+        audio_history_reset(player);
+    }
+    
+    // The old device stays warm for switching back
+    if (playing_out) {
+        pcm_pool_drain(&player->pool, &player->output, allow_mmap);
+    } else {
+        pcm_pool_release(&player->pool, &player->output, allow_mmap);
+    }
+    
+    player->output = *next;
+    audio_history_resize(player);
+    if (live) {
+        player->fade_in_pos = 0;
+        audio_fanout_align(&player->fanout, &player->output);
+    }
+}
+
+// Reopen the main output with the current settings (latency profile,
+// resampler). The device has to be closed first, so it is cut off and
+// everything it held is replayed. If it will not open with the new
+// settings, the previous ones are used.
+static int audio_engine_reopen(audio_player_t *player) {
+    pcm_output_t next;
+    char device[sizeof(player->output.device_name)];
+    pcm_latency_profile_t previous_profile = player->output.profile;
+    audio_resampler_quality_t previous_quality = player->output.quality;
+    bool allow_mmap = atomic_load_explicit(&player->allow_mmap, memory_order_relaxed);
+    bool live = (player->state != AUDIO_STATE_STOPPED &&
+                 player->output_epoch == atomic_load_explicit(&player->seek_epoch, memory_order_acquire));
+    
+    snprintf(device, sizeof(device), "%s", player->output.device_name);
+    printf("🔀 Reopening %s%s\n", device, live ? " during playback" : "");
+    
+    if (live) {
+        audio_switch_capture(player, false);
+    } else {
+        audio_history_reset(player);
+    }
+    pcm_output_close(&player->output);
+    
+    if (audio_open_device(player, &next, device) != 0) {
+        printf("⚠️  Reopening %s with its previous settings\n", device);
+        if (pcm_output_open(&next, device, allow_mmap, previous_profile, previous_quality) != 0) {
+            printf("❌ Lost audio device %s\n", device);
+            player->state = AUDIO_STATE_STOPPED;
+            audio_request_position(player, 0, 0);
+            audio_history_reset(player);
+            return -1;
+        }
+    }
+    
+    player->output = next;
+    audio_history_resize(player);
+    if (live) {
+        player->fade_in_pos = 0;
+        audio_fanout_align(&player->fanout, &player->output);
+    }
+    return 0;
+}
+
+// Whether the device can be added to the outputs playing along
+static int audio_engine_check_sink(audio_player_t *player, const char *device) {
+    if (strcmp(device, player->output.device_name) == 0 || audio_fanout_find(&player->fanout, device) >= 0) {
+        printf("⚠️  Already playing on %s\n", device);
+        return -1;
+    }
+    if (player->fanout.count >= AUDIO_FANOUT_MAX_SINKS) {
+        printf("❌ At most %d extra outputs can play at once\n", AUDIO_FANOUT_MAX_SINKS);
+        return -1;
+    }
+    return 0;
+}
+
+// Play the stream on another device as well, lined up with the main output;
+// output was opened by the helper
+static int audio_engine_attach_sink(audio_player_t *player, pcm_output_t *output) {
+    bool allow_mmap = atomic_load_explicit(&player->allow_mmap, memory_order_relaxed);
+    if (audio_fanout_add(&player->fanout, output, allow_mmap) != 0) {
+        pcm_pool_release(&player->pool, output, allow_mmap);
+        return -1;
+    }
+    
+    // The history has to cover the delay line the main output may now get
+    if (player->history_capacity < player->output.buffer_size + AUDIO_FANOUT_MAX_DELAY_FRAMES) {
+        audio_history_resize(player);
+    }
+    
+    // A running stream picks the sink up at once; otherwise the next start does
+    if (player->state != AUDIO_STATE_STOPPED &&
+        player->output_epoch == atomic_load_explicit(&player->seek_epoch, memory_order_acquire)) {
+        audio_fanout_align(&player->fanout, &player->output);
+    }
+    return 0;
+}
+
+static void *audio_open_thread(void *arg) {
+    audio_player_t *player = (audio_player_t *)arg;
+    audio_device_open_t *opening = &player->opening;
+    
+    opening->result = audio_open_device(player, &opening->output, opening->command.device);
+    atomic_store_explicit(&opening->done, true, memory_order_release);
+    audio_wake_engine(player);
+    return NULL;
+}
+
+// Open the device of a SET_DEVICE or ADD_SINK command on a helper thread;
+// the engine keeps playing and finishes the command once it is ready
+static int audio_engine_begin_open(audio_player_t *player, const audio_command_t *command) {
+    audio_device_open_t *opening = &player->opening;
+    
+    opening->command = *command;
+    atomic_store_explicit(&opening->done, false, memory_order_relaxed);
+    if (pthread_create(&opening->thread, NULL, audio_open_thread, player) != 0) {
+        printf("❌ Cannot start opening %s\n", command->device);
+        return -1;
+    }
+    opening->busy = true;
+    return 0;
+}
+
+// Store the profile for the main output and reopen it with the new geometry
+static int audio_engine_set_latency(audio_player_t *player, pcm_latency_profile_t profile) {
+    char device[sizeof(player->output.device_name)];
+    snprintf(device, sizeof(device), "%s", player->output.device_name);
+    
+    if (pcm_latency_save(device, profile) != 0) {
+        return -1;
+    }
+    printf("✅ Latency profile for %s: %s\n", device, pcm_latency_params(profile)->name);
+    
+    if (!player->output.handle || player->output.profile == profile) {
+        return 0;
+    }
+    return audio_engine_reopen(player);
+}
+
+// The main output only needs reopening if it is resampling
+static int audio_engine_set_resampler(audio_player_t *player, audio_resampler_quality_t quality) {
+    if (!player->output.handle || !player->output.resampler || player->output.quality == quality) {
+        return 0;
+    }
+    return audio_engine_reopen(player);
+}
+
+// Commands that change the outputs run one at a time
+static bool audio_command_uses_device(audio_command_type_t type) {
+    return type == AUDIO_CMD_SET_DEVICE || type == AUDIO_CMD_ADD_SINK || type == AUDIO_CMD_REMOVE_SINK ||
+           type == AUDIO_CMD_SET_LATENCY || type == AUDIO_CMD_SET_RESAMPLER;
+}
+
+// A command is done: count it and report to a caller waiting for it.
+// Output commands report through the snapshot instead.
+static void audio_engine_finish(audio_player_t *player, const audio_command_t *command, int result) {
+    player->commands_applied++;
+    if (audio_command_uses_device(command->type)) {
+        player->outputs_applied++;
+        player->output_failed = (result != 0);
+    }
+    if (command->completion) {
+        // The caller may look at the snapshot as soon as it is woken
+        audio_publish(player);
+        audio_completion_signal(command->completion, result);
+    }
+}
+
+static void audio_engine_command(audio_player_t *player, const audio_command_t *command) {
+    int result = 0;
+    
+    // An output is being opened: device commands wait for it, in order
+    if (player->opening.busy && audio_command_uses_device(command->type)) {
+        if (player->deferred_count < AUDIO_DEFERRED_COMMANDS) {
+            player->deferred[player->deferred_count++] = *command;
+            return;
+        }
+        printf("⚠️  Too many output changes waiting, dropping command %d\n", command->type);
+        audio_engine_finish(player, command, -1);
+        return;
+    }
+    
+    switch (command->type) {
+        case AUDIO_CMD_PLAY:
+            result = audio_engine_play(player, command->arg);
+            break;
+        case AUDIO_CMD_PAUSE:
+            result = audio_engine_pause(player);
+            break;
+        case AUDIO_CMD_RESUME:
+            result = audio_engine_resume(player);
+            break;
+        case AUDIO_CMD_STOP:
+            audio_engine_stop(player);
+            break;
+        case AUDIO_CMD_SEEK:
+            result = audio_engine_seek(player, command->position_ms);
+            break;
+        case AUDIO_CMD_NEXT:
+            result = audio_engine_skip(player, 1);
+            break;
+        case AUDIO_CMD_PREV:
+            result = audio_engine_skip(player, -1);
+            break;
+        case AUDIO_CMD_SCAN:
+            result = audio_engine_scan(player, command->arg);
+            break;
+        case AUDIO_CMD_SET_DEVICE:
+            if (strcmp(command->device, player->output.device_name) == 0) {
+                result = audio_engine_reopen(player);
+                break;
+            }
+            // A device playing along moves over to the main output
+            audio_fanout_remove(&player->fanout, command->device);
+            if (audio_engine_begin_open(player, command) == 0) {
+                return; // Finished once the device is open
+            }
+            result = -1;
+            break;
+        case AUDIO_CMD_ADD_SINK:
+            if (audio_engine_check_sink(player, command->device) == 0 &&
+                audio_engine_begin_open(player, command) == 0) {
+                return;
+            }
+            result = -1;
+            break;
+        case AUDIO_CMD_REMOVE_SINK:
+            result = audio_fanout_remove(&player->fanout, command->device);
+            break;
+        case AUDIO_CMD_SET_LATENCY:
+            result = audio_engine_set_latency(player, command->arg);
+            break;
+        case AUDIO_CMD_SET_RESAMPLER:
+            result = audio_engine_set_resampler(player, command->arg);
+            break;
+    }
+    
+    audio_engine_finish(player, command, result);
+}
+
+// The helper has the device open: put it to use, then run the device
+// commands that waited for it, until one needs the helper again
+static void audio_engine_poll_open(audio_player_t *player) {
+    audio_device_open_t *opening = &player->opening;
+    if (!opening->busy || !atomic_load_explicit(&opening->done, memory_order_acquire)) {
+        return;
+    }
+    
+    pthread_join(opening->thread, NULL);
+    opening->busy = false;
     
-    printf("🎵 CD playback thread started\n");
+    int result = opening->result;
+    if (opening->command.type == AUDIO_CMD_SET_DEVICE) {
+        if (result == 0) {
+            audio_engine_swap_output(player, &opening->output);
+        } else {
+            printf("❌ Cannot open %s, staying on %s\n", opening->command.device, player->output.device_name);
+        }
+    } else if (result == 0) {
+        result = audio_engine_attach_sink(player, &opening->output);
+    }
+    audio_engine_finish(player, &opening->command, result);
+    
+    while (!opening->busy && player->deferred_count > 0) {
+        audio_command_t command = player->deferred[0];
+        player->deferred_count--;
+        memmove(player->deferred, player->deferred + 1, (size_t)player->deferred_count * sizeof(audio_command_t));
+        audio_engine_command(player, &command);
+    }
+}
+
+// Engine on its way out: an output still being opened goes to the pool,
+// and whatever waited for it fails
+static void audio_engine_cancel_open(audio_player_t *player) {
+    audio_device_open_t *opening = &player->opening;
+    
+    if (opening->busy) {
+        pthread_join(opening->thread, NULL);
+        opening->busy = false;
+        if (opening->result == 0) {
+            pcm_pool_release(&player->pool, &opening->output,
+                             atomic_load_explicit(&player->allow_mmap, memory_order_relaxed));
+        }
+        audio_engine_finish(player, &opening->command, -1);
+    }
+    for (int i = 0; i < player->deferred_count; i++) {
+        audio_engine_finish(player, &player->deferred[i], -1);
+    }
+    player->deferred_count = 0;
+}
+
+// Nothing playing from the CD: voices still go out on the same PCM, mixed
+// into silence, followed by a buffer of silence so their tail is heard.
+// Returns false once there is nothing left to write.
+static bool audio_engine_mix_idle(audio_player_t *player) {
+    if (!player->output.handle) {
+        return false;
+    }
+    
+    bool busy = audio_mixer_busy(&player->mixer);
+    if (busy) {
+        player->mixer_tail = (long)player->output.buffer_size;
+    } else if (player->mixer_tail <= 0) {
+        return false;
+    }
+    
+    // A paused CD stream holds the device: give it up; resume then restarts
+    // from the heard position like a seek
+    if (player->state == AUDIO_STATE_PAUSED &&
+        player->output_epoch == atomic_load_explicit(&player->seek_epoch, memory_order_acquire)) {
+        long lsn = player->current_sector;
+        snd_pcm_drop(player->output.handle);
+        pcm_output_prepare(&player->output);
+        audio_request_position(player, player->current_track, lsn);
+    }
+    
+    int16_t *dst;
+    snd_pcm_uframes_t frames = player->output.period_size ? player->output.period_size : CD_FRAMES_PER_SECTOR;
+    if (pcm_output_begin(&player->output, &dst, &frames) < 0) {
+        return true; // Recovered; try again
+    }
+    
+    if (frames == 0) {
+        int events = pcm_output_wait(&player->output, player->control_fd, WRITER_POLL_TIMEOUT_MS);
+        if (events > 0 && (events & PCM_OUTPUT_EVENT_CONTROL)) {
+            audio_wait_fd(player->control_fd, 0);
+        }
+        return true;
+    }
+    
+    memset(dst, 0, frames * PCM_OUTPUT_FRAME_BYTES);
+    audio_mixer_mix(&player->mixer, dst, frames);
+    audio_dsp_process(&player->dsp, dst, frames);
+    pcm_output_commit(&player->output, frames);
+    
+    if (!busy) {
+        player->mixer_tail -= (long)frames;
+        if (player->mixer_tail <= 0) {
+            // Played out: back to a prepared, silent device
+            snd_pcm_drop(player->output.handle);
+            pcm_output_prepare(&player->output);
+        }
+    }
+    return true;
+}
+
+// Playback engine: the one long-lived thread that owns the PCM. Applies queued
+// commands, then drains the ring into the device. Sleeps only in poll() on the
+// PCM descriptors plus the control eventfd, so commands are seen within one
+// period, and not at all while paused or stopped.
+static void* audio_engine_thread(void* arg) {
+    audio_player_t *player = (audio_player_t*)arg;
     
-    // Use the working script's approach
-    long start = player->track_start_sector;
-    long end = player->track_end_sector;
-    long total_sectors = end - start;
+    printf("🎵 Playback engine started\n");
     
-    // Seek to track start (like working script)
-    cdio_paranoia_seek(player->cd_player->paranoia, start, SEEK_SET);
+    player->output_epoch = atomic_load_explicit(&player->seek_epoch, memory_order_acquire);
+    bool prefilled = false;
     
-    for (long i = 0; i < total_sectors && !player->stop_playback && player->is_playing; i++) {
-        if (player->is_paused) {
-            usleep(100000);
+    while (!atomic_load_explicit(&player->shutdown, memory_order_acquire)) {
+        audio_command_t command;
+        while (audio_command_pop(&player->commands, &command)) {
+            audio_engine_command(player, &command);
+        }
+        audio_engine_poll_open(player);
+        audio_publish(player);
+        pcm_pool_expire(&player->pool);
+        
+        if (player->state != AUDIO_STATE_PLAYING) {
+            if (!audio_engine_mix_idle(player)) {
+                // No wake-ups until a command, or until standby outputs are due a check
+                audio_wait_fd(player->control_fd, pcm_pool_empty(&player->pool) ? -1 : PCM_POOL_CHECK_MS);
+            }
             continue;
         }
         
-        // Direct paranoia read (like working script)
-        int16_t *audio_data = (int16_t *)cdio_paranoia_read(player->cd_player->paranoia, NULL);
-        if (!audio_data) {
-            printf("❌ Failed to read sector from CD\n");
-            continue; // Skip this sector, don't fail
+        // After a play/seek, drop what ALSA still holds from the old position
+        unsigned int requested = atomic_load_explicit(&player->seek_epoch, memory_order_acquire);
+        if (requested != player->output_epoch) {
+            player->output_epoch = requested;
+            snd_pcm_drop(player->output.handle);
+            pcm_output_prepare(&player->output);
+            player->sector_offset = 0;
+            audio_history_reset(player);
+            audio_dsp_reset(&player->dsp);
+            sector_deemph_reset(&player->deemph);
+            audio_loudness_reset(&player->loudness);
+            audio_crossfade_reset(&player->crossfade);
+            audio_fanout_start(&player->fanout, &player->output);
+            prefilled = (atomic_load_explicit(&player->scan_direction, memory_order_relaxed) != 0); // Scan bursts start at once
         }
         
-        // Calculate frames (like working script)
-        int frames_per_sector = CDIO_CD_FRAMESIZE_RAW / 4;
+        // Let the reader get ahead before the PCM starts consuming
+        if (!prefilled) {
+            if (audio_writer_starving(player, WRITER_PREFILL_SECTORS)) {
+                audio_wait_fd(player->control_fd, WRITER_POLL_TIMEOUT_MS);
+                continue;
+            }
+            prefilled = true;
+        }
         
-        // Simple write with basic recovery (like working script)
-        int err = snd_pcm_writei(player->pcm_handle, audio_data, frames_per_sector);
-        if (err < 0) {
-            printf("🔧 Recovering from ALSA error...\n");
-            snd_pcm_recover(player->pcm_handle, err, 0);
-            // Continue to next sector - don't retry or fail
-        } else {
-            // Update progress
-            player->elapsed_seconds = (i + 1) / 75;
-            
-            if ((i + 1) % 75 == 0) {
-                printf("⏱️  Playing: %d:%02d (sector %ld/%ld)\n", 
-                       player->elapsed_seconds / 60, player->elapsed_seconds % 60,
-                       i + 1, total_sectors);
+        bool draining = false;
+        if (!player->replay && sector_ring_fill(&player->ring) == 0) {
+            bool finished = atomic_load_explicit(&player->reader_done, memory_order_acquire) &&
+                            atomic_load_explicit(&player->seek_epoch, memory_order_acquire) == player->output_epoch;
+            if (finished && audio_fanout_held(&player->fanout) == 0) {
+                // Disc fully played; what ALSA still holds plays out
+                printf("🏁 Playback finished after track %d\n", player->current_track);
+                player->state = AUDIO_STATE_STOPPED;
+                audio_request_position(player, 0, 0);
+                continue;
+            }
+            if (!finished) {
+                if (audio_writer_starving(player, 1)) {
+                    player->ring_underruns++;
+                    audio_wait_fd(player->control_fd, WRITER_POLL_TIMEOUT_MS);
+                }
+                continue;
             }
+            draining = true; // The main output's delayed tail still has to go out
         }
         
-        // No artificial timing - let ALSA handle it naturally
+        // Ring sectors go straight into the region ALSA hands out
+        int16_t *dst;
+        snd_pcm_uframes_t frames = player->output.period_size ? player->output.period_size : CD_FRAMES_PER_SECTOR;
+        if (pcm_output_begin(&player->output, &dst, &frames) < 0) {
+            continue; // Recovered; try again
+        }
+        
+        if (frames == 0) {
+            // Device full: sleep until a period frees up or a command arrives
+            int events = pcm_output_wait(&player->output, player->control_fd, WRITER_POLL_TIMEOUT_MS);
+            if (events > 0 && (events & PCM_OUTPUT_EVENT_CONTROL)) {
+                audio_wait_fd(player->control_fd, 0);
+            }
+            continue;
+        }
+        
+        if (draining) {
+            frames = audio_fanout_drain(&player->fanout, dst, frames);
+            audio_mixer_mix(&player->mixer, dst, frames);
+        } else {
+            frames = audio_fill(player, dst, frames);
+            audio_mixer_mix(&player->mixer, dst, frames);
+            audio_dsp_process(&player->dsp, dst, frames);
+            audio_fanout_process(&player->fanout, dst, frames);
+        }
+        pcm_output_commit(&player->output, frames);
+        audio_fanout_check(&player->fanout, &player->output);
     }
     
-    printf("🎵 CD playback thread ended\n");
+    audio_engine_cancel_open(player);
+    audio_engine_stop(player);
+    audio_publish(player);
+    
+    printf("🎵 Playback engine ended\n");
     return NULL;
 }
 
+// Queue a command for the engine; never blocks
+static int audio_post(audio_player_t *player, const audio_command_t *command) {
+    if (!player || !player->engine_running) {
+        return -1;
+    }
+    
+    // Count first so a snapshot never shows more applied than posted
+    atomic_fetch_add_explicit(&player->commands_posted, 1, memory_order_relaxed);
+    if (!audio_command_push(&player->commands, command)) {
+        atomic_fetch_sub_explicit(&player->commands_posted, 1, memory_order_relaxed);
+        printf("⚠️  Playback command queue full, dropping command %d\n", command->type);
+        return -1;
+    }
+    
+    audio_wake_engine(player);
+    return 0;
+}
 
+static int audio_post_simple(audio_player_t *player, audio_command_type_t type, int arg) {
+    audio_command_t command = { .type = type, .arg = arg };
+    return audio_post(player, &command);
+}
 
-
-
+// Play a WAV on a device. The output the player already owns gets it
+// through the mixer; any other device (e.g. a Bluetooth sink being
+// tested before it is selected) is opened just for the sound.
 int audio_play_wav_file(const char *device_id, const char *wav_file_path) {
     if (!device_id || !wav_file_path) {
         return -1;
     }
     
+    audio_snapshot_t snapshot;
+    if (notification_player && notification_player->output.handle &&
+        audio_get_snapshot(notification_player, &snapshot) == 0 && strcmp(snapshot.device, device_id) == 0) {
+        return audio_play_notification(notification_player, wav_file_path);
+    }
+    
     printf("🎵 Playing WAV file on device: %s\n", device_id);
     
-    // Create temporary audio player for notification
-    audio_player_t temp_player = {0};
+    size_t frames;
+    int16_t *decoded = NULL;
+    const int16_t *samples = assets_sound_pcm(assets_sound_handle(wav_file_path), &frames);
+    if (!samples) {
+        samples = decoded = assets_decode_wav(wav_file_path, &frames);
+    }
+    if (!samples) {
+        return -1;
+    }
     
-    // Initialize audio device
-    if (audio_init(&temp_player, device_id) != 0) {
+    // Through the player's standby pool when there is one: a device that was
+    // just tested (or used before) is already open and configured
+    pcm_output_t output;
+    audio_player_t *owner = notification_player;
+    pcm_latency_profile_t profile = pcm_latency_load(device_id);
+    bool allow_mmap = owner && atomic_load_explicit(&owner->allow_mmap, memory_order_relaxed);
+    int opened = owner ? pcm_pool_acquire(&owner->pool, &output, device_id, allow_mmap, profile,
+                                          atomic_load_explicit(&owner->resampler_quality, memory_order_relaxed)) :
+                         pcm_output_open(&output, device_id, false, profile, AUDIO_RESAMPLER_QUALITY_DEFAULT);
+    if (opened != 0) {
         printf("❌ Failed to initialize audio device for notification\n");
+        free(decoded);
         return -1;
     }
     
-    // Play the notification
-    int result = audio_play_notification(&temp_player, wav_file_path);
-    
-    // Cleanup
-    audio_cleanup(&temp_player);
+    snd_pcm_sframes_t written = pcm_output_write(&output, samples, frames);
+    pcm_output_drain(&output);
+    if (owner) {
+        pcm_pool_release(&owner->pool, &output, allow_mmap);
+    } else {
+        pcm_output_close(&output);
+    }
+    free(decoded);
     
-    return result;
+    printf("✅ Notification sound completed (%ld frames)\n", (long)written);
+    return 0;
 }
 
-int audio_play_notification(audio_player_t *player, const char *wav_file_path) {
-    if (!player->pcm_handle || !wav_file_path) {
+// Mix a sound bank entry into the player's output: no I/O, no allocation
+int audio_play_sound(audio_player_t *player, sound_handle_t sound) {
+    size_t frames;
+    const int16_t *samples = assets_sound_pcm(sound, &frames);
+    if (!player->output.handle || !samples) {
         return -1;
     }
     
-    printf("🔊 Playing notification sound: %s\n", wav_file_path);
+    if (audio_mixer_add(&player->mixer, samples, frames, false) != 0) {
+        printf("⚠️  All notification voices busy, dropping sound %d\n", sound);
+        return -1;
+    }
     
-    // Open WAV file
-    FILE *wav_file = fopen(wav_file_path, "rb");
-    if (!wav_file) {
-        printf("❌ Failed to open WAV file: %s\n", wav_file_path);
+    audio_wake_engine(player);
+    return 0;
+}
+
+// Mix a notification into the player's output; returns without waiting.
+// Sounds in the bank play from memory, anything else is decoded first.
+int audio_play_notification(audio_player_t *player, const char *wav_file_path) {
+    if (!player->output.handle || !wav_file_path) {
         return -1;
     }
     
-    // Skip WAV header (44 bytes for standard WAV)
-    fseek(wav_file, 44, SEEK_SET);
+    printf("🔊 Playing notification sound: %s\n", wav_file_path);
     
-    // Read and play audio data in chunks
-    int16_t buffer[1024];
-    size_t bytes_read;
-    int total_frames = 0;
+    sound_handle_t sound = assets_sound_handle(wav_file_path);
+    if (sound != SOUND_HANDLE_INVALID) {
+        return audio_play_sound(player, sound);
+    }
     
-    while ((bytes_read = fread(buffer, sizeof(int16_t), 1024, wav_file)) > 0) {
-        // Convert bytes to frames (2 bytes per sample, 2 channels)
-        int frames = bytes_read / 2; // 2 channels
-        
-        snd_pcm_sframes_t frames_written = audio_write_samples(player, buffer, frames);
-        
-        if (frames_written < 0) {
-            printf("❌ Failed to write audio data\n");
-            break;
-        }
-        
-        total_frames += frames_written;
+    size_t frames;
+    int16_t *samples = assets_decode_wav(wav_file_path, &frames);
+    if (!samples) {
+        return -1;
     }
     
-    // Ensure all audio is played
-    snd_pcm_drain(player->pcm_handle);
+    if (audio_mixer_add(&player->mixer, samples, frames, true) != 0) {
+        printf("⚠️  All notification voices busy, dropping %s\n", wav_file_path);
+        free(samples);
+        return -1;
+    }
     
-    fclose(wav_file);
-    printf("✅ Notification sound completed (%d frames)\n", total_frames);
+    audio_wake_engine(player);
     return 0;
 }
 
@@ -165,75 +1793,115 @@ bool is_bluealsa_device(const char *device_name) {
         return (system(cmd) == 0);
     }
     
-    return false;
+    return false;
+}
+
+
+
+// Open and configure a PCM without touching the rest of the player state
+static int audio_open_device(audio_player_t *player, pcm_output_t *output, const char *device) {
+    printf("🎵 Initializing audio device: %s\n", device ? device : "default");
+    
+    pcm_latency_profile_t profile = pcm_latency_load(device ? device : "default");
+    if (pcm_pool_acquire(&player->pool, output, device, atomic_load_explicit(&player->allow_mmap, memory_order_relaxed),
+                         profile, atomic_load_explicit(&player->resampler_quality, memory_order_relaxed)) != 0) {
+        return -1;
+    }
+    
+    printf("✅ Audio device initialized successfully\n");
+    return 0;
 }
 
-
-
 int audio_init(audio_player_t *player, const char *device) {
     memset(player, 0, sizeof(audio_player_t));
-    
-    // Store device name
-    snprintf(player->device_name, sizeof(player->device_name), "%s", device ? device : "default");
-    
-    printf("🎵 Initializing audio device: %s\n", player->device_name);
-    
-    // Simple PCM device opening (like your test script)
-    int err = snd_pcm_open(&player->pcm_handle, player->device_name, 
-                          SND_PCM_STREAM_PLAYBACK, 0);
-    if (err < 0) {
-        fprintf(stderr, "❌ Failed to open PCM device: %s\n", snd_strerror(err));
+    pcm_pool_init(&player->pool);
+    player->control_fd = -1;
+    player->reader_fd = -1;
+    if (audio_fanout_init(&player->fanout, &player->pool) != 0) {
+        audio_release(player);
         return -1;
     }
     
-    // Set hardware parameters (simplified like test script)
-    snd_pcm_hw_params_t *hw_params;
-    snd_pcm_hw_params_alloca(&hw_params);
+    atomic_init(&player->ring_seconds, SECTOR_RING_DEFAULT_SECONDS);
+    atomic_init(&player->ring_requested, SECTOR_RING_DEFAULT_SECONDS);
+    atomic_init(&player->gapless, AUDIO_GAPLESS_DEFAULT);
+    atomic_init(&player->allow_mmap, AUDIO_MMAP_DEFAULT);
+    atomic_init(&player->resampler_quality, AUDIO_RESAMPLER_QUALITY_DEFAULT);
+    atomic_init(&player->read_method, AUDIO_READ_METHOD_DEFAULT);
+    atomic_init(&player->benchmark, NULL);
+    player->state = AUDIO_STATE_STOPPED;
+    player->fade_in_pos = -1;
+    audio_command_queue_init(&player->commands);
+    audio_mixer_init(&player->mixer);
+    audio_dsp_init(&player->dsp);
+    audio_dsp_load(&player->dsp, AUDIO_DSP_CONFIG_FILE);
+    sector_deemph_init(&player->deemph);
+    audio_crossfade_init(&player->crossfade);
+    if (audio_loudness_init(&player->loudness) != 0) {
+        printf("⚠️  No memory for background loudness scans\n");
+    }
     
-    snd_pcm_hw_params_any(player->pcm_handle, hw_params);
-    snd_pcm_hw_params_set_access(player->pcm_handle, hw_params, SND_PCM_ACCESS_RW_INTERLEAVED);
-    snd_pcm_hw_params_set_format(player->pcm_handle, hw_params, SND_PCM_FORMAT_S16_LE);
-    snd_pcm_hw_params_set_channels(player->pcm_handle, hw_params, 2);
+    player->control_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    player->reader_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (player->control_fd < 0 || player->reader_fd < 0) {
+        printf("❌ Failed to create playback engine eventfds\n");
+        audio_release(player);
+        return -1;
+    }
     
-    unsigned int rate = 44100;
-    snd_pcm_hw_params_set_rate_near(player->pcm_handle, hw_params, &rate, 0);
-    snd_pcm_hw_params(player->pcm_handle, hw_params);
+    sector_cache_init(&player->cache, (size_t)SECTOR_CACHE_DEFAULT_BUDGET_MB * 1024 * 1024, NULL);
     
-    printf("✅ Sample rate set to: %u Hz\n", rate);
+    if (sector_ring_init(&player->ring, SECTOR_RING_DEFAULT_SECONDS) != 0 ||
+        audio_open_device(player, &player->output, device) != 0) {
+        audio_release(player);
+        return -1;
+    }
+    audio_history_resize(player);
     
-    // Simple pre-buffering for Bluetooth stability (like test script)
-    bool is_bluetooth = (strstr(player->device_name, "bluealsa") != NULL);
-    if (is_bluetooth) {
-        printf("🔧 Pre-buffering for Bluetooth stability...\n");
-        usleep(2000000); // 2 seconds sleep (exactly like test script)
+    // Both threads live as long as the player; they sleep while idle
+    if (pthread_create(&player->reader_thread, NULL, cd_reader_thread, player) != 0) {
+        printf("❌ Failed to create CD reader thread\n");
+        audio_release(player);
+        return -1;
     }
     
-    player->is_playing = false;
-    player->is_paused = false;
+    if (pthread_create(&player->engine_thread, NULL, audio_engine_thread, player) != 0) {
+        printf("❌ Failed to create playback engine thread\n");
+        atomic_store_explicit(&player->shutdown, true, memory_order_release);
+        audio_request_position(player, 0, 0);
+        pthread_join(player->reader_thread, NULL);
+        audio_release(player);
+        return -1;
+    }
     
-    printf("✅ Audio device initialized successfully\n");
+    player->engine_running = true;
+    if (!notification_player) {
+        notification_player = player;
+    }
     return 0;
 }
 
 
 
+// Queue raw frames as a mixer voice; only the engine writes to the PCM
 int audio_write_samples(audio_player_t *player, const int16_t *samples, int frames) {
-    if (!player->pcm_handle || !samples) {
+    if (!player->output.handle || !samples || frames <= 0) {
         return -1;
     }
     
-    // ✅ FIRST: Actually write the audio data
-    snd_pcm_sframes_t written = snd_pcm_writei(player->pcm_handle, samples, frames);
+    int16_t *copy = malloc((size_t)frames * PCM_OUTPUT_FRAME_BYTES);
+    if (!copy) {
+        return -1;
+    }
+    memcpy(copy, samples, (size_t)frames * PCM_OUTPUT_FRAME_BYTES);
     
-    // ✅ THEN: Check for errors and recover (like your working script)
-    if (written < 0) {
-        printf("🔧 Recovering from ALSA error...\n");
-        snd_pcm_recover(player->pcm_handle, written, 0);
-        // Just return 0 and continue - don't retry (this prevents I/O errors)
-        return 0;
+    if (audio_mixer_add(&player->mixer, copy, (size_t)frames, true) != 0) {
+        free(copy);
+        return -1;
     }
     
-    return written;
+    audio_wake_engine(player);
+    return frames;
 }
 
 
@@ -241,24 +1909,44 @@ int audio_write_samples(audio_player_t *player, const int16_t *samples, int fram
 
 
 
-int audio_set_device(audio_player_t *player, const char *device) {
-    if (!device) {
+// Output commands don't wait for the engine (opening a device can take
+// seconds): their outcome shows up as output_state in the snapshot
+static int audio_post_output(audio_player_t *player, const audio_command_t *command) {
+    if (!player) {
         return -1;
     }
     
-    // Stop current playback
-    if (player->is_playing) {
-        audio_stop(player);
+    atomic_fetch_add_explicit(&player->outputs_posted, 1, memory_order_relaxed);
+    if (audio_post(player, command) != 0) {
+        atomic_fetch_sub_explicit(&player->outputs_posted, 1, memory_order_relaxed);
+        return -1;
     }
-    
-    // Close current device
-    if (player->pcm_handle) {
-        snd_pcm_close(player->pcm_handle);
-        player->pcm_handle = NULL;
+    return 0;
+}
+
+static int audio_post_device(audio_player_t *player, audio_command_type_t type, const char *device) {
+    if (!device) {
+        return -1;
     }
     
-    // Initialize with new device
-    return audio_init(player, device);
+    audio_command_t command = { .type = type };
+    snprintf(command.device, sizeof(command.device), "%s", device);
+    return audio_post_output(player, &command);
+}
+
+// Move the output to another device; playback carries on where it was heard
+int audio_set_device(audio_player_t *player, const char *device) {
+    return audio_post_device(player, AUDIO_CMD_SET_DEVICE, device);
+}
+
+// Play on another device as well as the current output, latency-aligned
+// with it (e.g. the DAC and a Bluetooth speaker together)
+int audio_add_sink(audio_player_t *player, const char *device) {
+    return audio_post_device(player, AUDIO_CMD_ADD_SINK, device);
+}
+
+int audio_remove_sink(audio_player_t *player, const char *device) {
+    return audio_post_device(player, AUDIO_CMD_REMOVE_SINK, device);
 }
 
 int audio_test_device_with_notification(const char *device_id, const char *wav_file_path) {
@@ -266,128 +1954,105 @@ int audio_test_device_with_notification(const char *device_id, const char *wav_f
     printf("📱 Device: %s\n", device_id);
     printf("🔊 Sound file: %s\n", wav_file_path);
     
-    // Test if the device is accessible
-    snd_pcm_t *test_handle;
-    int err = snd_pcm_open(&test_handle, device_id, SND_PCM_STREAM_PLAYBACK, SND_PCM_NONBLOCK);
+    // Test if the device is accessible. With a player the test opens and
+    // configures it for real and parks it, so the notification (and a switch
+    // to the device right after) reuse the handle instead of reopening
+    audio_player_t *owner = notification_player;
+    audio_snapshot_t snapshot;
+    if (owner && audio_get_snapshot(owner, &snapshot) == 0 && strcmp(snapshot.device, device_id) != 0) {
+        pcm_output_t output;
+        bool allow_mmap = atomic_load_explicit(&owner->allow_mmap, memory_order_relaxed);
+        if (pcm_pool_acquire(&owner->pool, &output, device_id, allow_mmap, pcm_latency_load(device_id),
+                             atomic_load_explicit(&owner->resampler_quality, memory_order_relaxed)) != 0) {
+            printf("❌ Cannot access audio device %s\n", device_id);
+            return -1;
+        }
+        pcm_pool_release(&owner->pool, &output, allow_mmap);
+    } else if (!owner) {
+        snd_pcm_t *test_handle;
+        int err = snd_pcm_open(&test_handle, device_id, SND_PCM_STREAM_PLAYBACK, SND_PCM_NONBLOCK);
     
-    if (err < 0) {
-        printf("❌ Cannot access audio device %s: %s\n", device_id, snd_strerror(err));
-        return -1;
+        if (err < 0) {
+            printf("❌ Cannot access audio device %s: %s\n", device_id, snd_strerror(err));
+            return -1;
+        }
+        snd_pcm_close(test_handle);
     }
-    
-    snd_pcm_close(test_handle);
     printf("✅ Audio device is accessible\n");
     
     // Play notification sound
     return audio_play_wav_file(device_id, wav_file_path);
 }
 
-void audio_cleanup(audio_player_t *player) {
-    if (player->is_playing) {
-        audio_stop(player);
+// Close descriptors and free buffers; threads must already be stopped
+static void audio_release(audio_player_t *player) {
+    pcm_output_close(&player->output);
+    audio_fanout_free(&player->fanout);
+    pcm_pool_free(&player->pool);
+    
+    sector_ring_free(&player->ring);
+    sector_cache_free(&player->cache);
+    audio_loudness_free(&player->loudness);
+    audio_mixer_free(&player->mixer);
+    free(player->history);
+    free(player->replay);
+    
+    if (notification_player == player) {
+        notification_player = NULL;
     }
     
-    if (player->pcm_handle) {
-        snd_pcm_close(player->pcm_handle);
-        player->pcm_handle = NULL;
+    if (player->control_fd >= 0) {
+        close(player->control_fd);
+    }
+    if (player->reader_fd >= 0) {
+        close(player->reader_fd);
     }
     
     memset(player, 0, sizeof(audio_player_t));
+    player->control_fd = -1;
+    player->reader_fd = -1;
 }
 
-
-int audio_play_track(audio_player_t *player, int track) {
-    if (!player->pcm_handle || !player->cd_player) {
-        return -1;
-    }
-    
-    printf("🎵 Starting playback of track %d\n", track);
-    printf("📱 Using audio device: %s\n", player->device_name);
-    
-    // Verify the audio device is still valid and matches current selection
-    snd_pcm_state_t state = snd_pcm_state(player->pcm_handle);
-    if (state == SND_PCM_STATE_DISCONNECTED) {
-        printf("⚠️  Audio device disconnected, reinitializing...\n");
-        
-        // Reinitialize with current device
-        char current_device[64];
-        snprintf(current_device, sizeof(current_device), "%s", player->device_name);
-        
-        if (player->pcm_handle) {
-            snd_pcm_close(player->pcm_handle);
-            player->pcm_handle = NULL;
-        }
+void audio_cleanup(audio_player_t *player) {
+    if (player->engine_running) {
+        // Engine stops playback and parks the reader on its way out
+        atomic_store_explicit(&player->shutdown, true, memory_order_release);
+        audio_wake_engine(player);
+        pthread_join(player->engine_thread, NULL);
         
-        if (audio_init(player, current_device) != 0) {
-            printf("❌ Failed to reinitialize audio device\n");
-            return -1;
+        // The reader may be inside a paranoia read; it exits right after
+        uint64_t one = 1;
+        if (write(player->reader_fd, &one, sizeof(one)) < 0) {
+            // Wake-up already pending
         }
+        pthread_join(player->reader_thread, NULL);
     }
     
-    // Stop any existing playback
-    if (player->is_playing) {
-        audio_stop(player);
-    }
-    
-    // Get track information
-    int track_length;
-    if (cd_get_track_info(player->cd_player, track, &track_length) != 0) {
-        printf("❌ Failed to get track %d information\n", track);
-        return -1;
-    }
-    
-    // Get track sector positions
-    player->track_start_sector = cd_get_track_position(player->cd_player, track);
-    if (player->track_start_sector < 0) {
-        printf("❌ Failed to get track %d start position\n", track);
-        return -1;
-    }
-    
-    // Calculate end sector
-    lsn_t end_lsn = cdio_get_track_last_lsn(player->cd_player->cdio, track);
-    if (end_lsn == CDIO_INVALID_LSN) {
-        printf("❌ Failed to get track %d end position\n", track);
-        return -1;
-    }
-    player->track_end_sector = end_lsn;
-    
-    // Initialize playback state
-    player->current_track = track;
-    player->current_sector = player->track_start_sector;
-    player->elapsed_seconds = 0;
-    player->track_length_seconds = track_length;
-    player->is_playing = true;
-    player->is_paused = false;
-    player->stop_playback = false;
-    
-    printf("📊 Track %d: sectors %d to %d (%d seconds)\n", 
-           track, player->track_start_sector, player->track_end_sector, track_length);
-    
-    // Prepare PCM device for playback
-    int err = snd_pcm_prepare(player->pcm_handle);
-    if (err < 0) {
-        fprintf(stderr, "Cannot prepare audio interface: %s\n", snd_strerror(err));
+    audio_release(player);
+}
+
+
+int audio_play_track(audio_player_t *player, int track) {
+    if (!player->output.handle || !player->cd_player) {
         return -1;
     }
     
-    // Start playback thread
-    if (pthread_create(&player->playback_thread, NULL, cd_playback_thread, player) != 0) {
-        printf("❌ Failed to create playback thread\n");
+    if (track < 1 || track > player->cd_player->num_tracks) {
+        printf("❌ Invalid track number: %d\n", track);
         return -1;
     }
     
-    printf("✅ CD playback started successfully\n");
-    return 0;
+    return audio_post_simple(player, AUDIO_CMD_PLAY, track);
 }
 
 int audio_validate_device(audio_player_t *player) {
-    if (!player->pcm_handle) {
+    if (!player->output.handle) {
         printf("❌ No audio device initialized\n");
         return -1;
     }
     
     // Test if device is accessible
-    snd_pcm_state_t state = snd_pcm_state(player->pcm_handle);
+    snd_pcm_state_t state = snd_pcm_state(player->output.handle);
     printf("🔍 Audio device state: %d\n", state);
     
     switch (state) {
@@ -410,131 +2075,330 @@ int audio_validate_device(audio_player_t *player) {
 }
 
 int audio_pause(audio_player_t *player) {
-    if (!player->pcm_handle || !player->is_playing) {
+    return audio_post_simple(player, AUDIO_CMD_PAUSE, 0);
+}
+
+int audio_resume(audio_player_t *player) {
+    return audio_post_simple(player, AUDIO_CMD_RESUME, 0);
+}
+
+int audio_stop(audio_player_t *player) {
+    return audio_post_simple(player, AUDIO_CMD_STOP, 0);
+}
+
+// Heard position in a snapshot. Between engine updates the clock is
+// extrapolated from the last sample while the PCM is running.
+static long audio_snapshot_position_ms(const audio_snapshot_t *snapshot) {
+    long position = snapshot->position_ms;
+    if (snapshot->clock_running) {
+        unsigned long long now = audio_now_ms();
+        if (now > snapshot->stamp_ms) {
+            position += (long)(now - snapshot->stamp_ms);
+        }
+        if (position > snapshot->length_ms) {
+            position = snapshot->length_ms;
+        }
+    }
+    return position;
+}
+
+// Add function to get current playback time. Both values come from one
+// snapshot, so they always belong to the same track.
+int audio_get_position(audio_player_t *player, int *elapsed, int *total) {
+    audio_snapshot_t snapshot;
+    if (audio_get_snapshot(player, &snapshot) != 0) {
         return -1;
     }
     
-    if (player->is_paused) {
-        return 0; // Already paused
+    *elapsed = (int)(audio_snapshot_position_ms(&snapshot) / 1000);
+    *total = snapshot.track_length_seconds;
+    
+    return 0;
+}
+
+// Heard position in milliseconds
+int audio_get_position_ms(audio_player_t *player, long *elapsed_ms, long *total_ms) {
+    audio_snapshot_t snapshot;
+    if (audio_get_snapshot(player, &snapshot) != 0) {
+        return -1;
     }
     
-    printf("⏸️  Pausing playback\n");
+    *elapsed_ms = audio_snapshot_position_ms(&snapshot);
+    *total_ms = snapshot.length_ms;
+    return 0;
+}
+
+// Consistent view of the engine state; safe from any thread
+int audio_get_snapshot(audio_player_t *player, audio_snapshot_t *snapshot) {
+    if (!player || !snapshot) {
+        return -1;
+    }
     
-    // Check PCM state before pausing
-    snd_pcm_state_t state = snd_pcm_state(player->pcm_handle);
-    printf("🔍 PCM state before pause: %d\n", state);
+    audio_snapshot_slot_t *slot = &player->snapshot;
+    unsigned long done;
+    unsigned long outputs_done;
+    bool output_failed;
+    unsigned int seq;
     
-    if (state == SND_PCM_STATE_RUNNING) {
-        int err = snd_pcm_pause(player->pcm_handle, 1);
-        if (err < 0) {
-            fprintf(stderr, "Cannot pause playback: %s\n", snd_strerror(err));
-            
-            // Fallback: use drop instead of pause
-            printf("🔄 Trying alternative pause method...\n");
-            err = snd_pcm_drop(player->pcm_handle);
-            if (err < 0) {
-                fprintf(stderr, "Cannot drop playback: %s\n", snd_strerror(err));
-                return -1;
-            }
+    do {
+        seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq & 1) {
+            continue; // Engine is mid-update
         }
+        
+        snapshot->state = atomic_load_explicit(&slot->state, memory_order_relaxed);
+        snapshot->track = atomic_load_explicit(&slot->track, memory_order_relaxed);
+        snapshot->elapsed_seconds = atomic_load_explicit(&slot->elapsed_seconds, memory_order_relaxed);
+        snapshot->track_length_seconds = atomic_load_explicit(&slot->track_length_seconds, memory_order_relaxed);
+        snapshot->scan_direction = atomic_load_explicit(&slot->scan_direction, memory_order_relaxed);
+        snapshot->current_sector = atomic_load_explicit(&slot->current_sector, memory_order_relaxed);
+        snapshot->position_ms = atomic_load_explicit(&slot->position_ms, memory_order_relaxed);
+        snapshot->length_ms = atomic_load_explicit(&slot->length_ms, memory_order_relaxed);
+        snapshot->clock_running = atomic_load_explicit(&slot->clock_running, memory_order_relaxed);
+        snapshot->stamp_ms = atomic_load_explicit(&slot->stamp_ms, memory_order_relaxed);
+        done = atomic_load_explicit(&slot->commands_done, memory_order_relaxed);
+        snapshot->deemphasis = atomic_load_explicit(&slot->deemphasis, memory_order_relaxed);
+        snapshot->crossfading = atomic_load_explicit(&slot->crossfading, memory_order_relaxed);
+        audio_read_string(snapshot->device, slot->device, sizeof(snapshot->device));
+        snapshot->latency_profile = atomic_load_explicit(&slot->latency_profile, memory_order_relaxed);
+        outputs_done = atomic_load_explicit(&slot->outputs_done, memory_order_relaxed);
+        output_failed = atomic_load_explicit(&slot->output_failed, memory_order_relaxed);
+        
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq);
+    
+    snapshot->pending = (done != atomic_load_explicit(&player->commands_posted, memory_order_relaxed));
+    if (outputs_done != atomic_load_explicit(&player->outputs_posted, memory_order_relaxed)) {
+        snapshot->output_state = AUDIO_OUTPUT_CHANGING;
+    } else {
+        snapshot->output_state = output_failed ? AUDIO_OUTPUT_FAILED : AUDIO_OUTPUT_READY;
+    }
+    return 0;
+}
+
+int audio_set_cd_player(audio_player_t *player, cd_player_t *cd_player) {
+    if (!player) {
+        return -1;
     }
     
-    player->is_paused = true;
+    player->cd_player = cd_player;
+    printf("✅ CD player reference set in audio player\n");
     return 0;
 }
 
-int audio_resume(audio_player_t *player) {
-    if (!player->pcm_handle || !player->is_playing || !player->is_paused) {
+int audio_set_ring_seconds(audio_player_t *player, int seconds) {
+    if (!player) {
         return -1;
     }
     
-    printf("▶️  Resuming playback\n");
+    if (seconds < SECTOR_RING_MIN_SECONDS) {
+        seconds = SECTOR_RING_MIN_SECONDS;
+    } else if (seconds > SECTOR_RING_MAX_SECONDS) {
+        seconds = SECTOR_RING_MAX_SECONDS;
+    }
     
-    // Check PCM state before resuming
-    snd_pcm_state_t state = snd_pcm_state(player->pcm_handle);
-    printf("🔍 PCM state before resume: %d\n", state);
+    // The engine resizes at the next track start while the reader is parked
+    atomic_store_explicit(&player->ring_requested, seconds, memory_order_relaxed);
+    audio_update_ring_depth(player);
     
-    if (state == SND_PCM_STATE_PAUSED) {
-        int err = snd_pcm_pause(player->pcm_handle, 0);
-        if (err < 0) {
-            fprintf(stderr, "Cannot resume playback: %s\n", snd_strerror(err));
-            
-            // Fallback: prepare and restart
-            printf("🔄 Trying alternative resume method...\n");
-            err = snd_pcm_prepare(player->pcm_handle);
-            if (err < 0) {
-                fprintf(stderr, "Cannot prepare for resume: %s\n", snd_strerror(err));
-                return -1;
-            }
-        }
-    } else if (state == SND_PCM_STATE_SETUP || state == SND_PCM_STATE_PREPARED) {
-        // Device was dropped, just prepare it
-        int err = snd_pcm_prepare(player->pcm_handle);
-        if (err < 0) {
-            fprintf(stderr, "Cannot prepare for resume: %s\n", snd_strerror(err));
-            return -1;
-        }
+    printf("✅ Read-ahead ring depth set to %d seconds\n", seconds);
+    return 0;
+}
+
+// Ring fill level in sectors (75 per second of audio)
+int audio_get_ring_fill(audio_player_t *player, int *filled, int *capacity) {
+    if (!player || !player->ring.slots) {
+        return -1;
     }
     
-    player->is_paused = false;
+    *filled = (int)sector_ring_fill(&player->ring);
+    *capacity = (int)player->ring.capacity;
+    
     return 0;
 }
 
-int audio_stop(audio_player_t *player) {
-    if (!player->pcm_handle) {
+// Change the cache budget and spill file; drops anything cached so far
+int audio_set_sector_cache(audio_player_t *player, int budget_mb, const char *spill_path) {
+    if (!player || budget_mb < 0 ||
+        !atomic_load_explicit(&player->reader_idle, memory_order_acquire)) {
         return -1;
     }
     
-    printf("⏹️  Stopping playback\n");
-    
-    // Signal thread to stop
-    player->stop_playback = true;
-    player->is_playing = false;
-    player->is_paused = false;
+    audio_snapshot_t snapshot;
+    if (audio_get_snapshot(player, &snapshot) != 0 || snapshot.state != AUDIO_STATE_STOPPED || snapshot.pending) {
+        return -1;
+    }
     
-    // Wait for playback thread to finish
-    if (player->playback_thread) {
-        pthread_join(player->playback_thread, NULL);
-        player->playback_thread = 0;
+    sector_cache_free(&player->cache);
+    if (sector_cache_init(&player->cache, (size_t)budget_mb * 1024 * 1024, spill_path) != 0) {
+        return -1;
     }
     
-    // Stop and drain the PCM device
-    int err = snd_pcm_drop(player->pcm_handle);
-    if (err < 0) {
-        fprintf(stderr, "Cannot stop playback: %s\n", snd_strerror(err));
+    printf("✅ Sector cache budget set to %d MB%s%s\n", budget_mb,
+           spill_path ? ", spill file " : "", spill_path ? spill_path : "");
+    return 0;
+}
+
+int audio_get_cache_stats(audio_player_t *player, sector_cache_stats_t *stats) {
+    if (!player || !stats) {
+        return -1;
     }
     
-    err = snd_pcm_prepare(player->pcm_handle);
-    if (err < 0) {
-        fprintf(stderr, "Cannot prepare audio interface: %s\n", snd_strerror(err));
+    sector_cache_get_stats(&player->cache, stats);
+    return 0;
+}
+
+// Gapless mode keeps one PCM stream running from track to track
+int audio_set_gapless(audio_player_t *player, bool enabled) {
+    if (!player) {
+        return -1;
     }
     
-    // Reset timing
-    player->elapsed_seconds = 0;
-    player->current_sector = 0;
+    atomic_store_explicit(&player->gapless, enabled, memory_order_relaxed);
+    printf("✅ Gapless playback %s\n", enabled ? "enabled" : "disabled");
+    return 0;
+}
+
+// Jump to a position within the current track (sector-accurate)
+int audio_seek(audio_player_t *player, double seconds) {
+    audio_command_t command = { .type = AUDIO_CMD_SEEK, .position_ms = lround(seconds * 1000.0) };
+    return audio_post(player, &command);
+}
+
+// Start (direction > 0 forward, < 0 backward) or stop (0) fast scan
+int audio_scan(audio_player_t *player, int direction) {
+    return audio_post_simple(player, AUDIO_CMD_SCAN, direction);
+}
+
+int audio_next(audio_player_t *player) {
+    return audio_post_simple(player, AUDIO_CMD_NEXT, 0);
+}
+
+int audio_prev(audio_player_t *player) {
+    return audio_post_simple(player, AUDIO_CMD_PREV, 0);
+}
+
+// MMAP output is used when the device allows it; takes effect on the next open
+int audio_set_mmap(audio_player_t *player, bool enabled) {
+    if (!player) {
+        return -1;
+    }
     
-    printf("✅ Playback stopped\n");
+    atomic_store_explicit(&player->allow_mmap, enabled, memory_order_relaxed);
+    printf("✅ MMAP output %s\n", enabled ? "enabled" : "disabled");
     return 0;
 }
 
-// Add function to get current playback time
-int audio_get_position(audio_player_t *player, int *elapsed, int *total) {
+// Store the profile for the current device and reopen it with the new geometry
+int audio_set_latency_profile(audio_player_t *player, pcm_latency_profile_t profile) {
+    if (!player || profile < 0 || profile >= PCM_LATENCY_COUNT) {
+        return -1;
+    }
+    
+    audio_command_t command = { .type = AUDIO_CMD_SET_LATENCY, .arg = profile };
+    return audio_post_output(player, &command);
+}
+
+pcm_latency_profile_t audio_get_latency_profile(audio_player_t *player) {
+    audio_snapshot_t snapshot;
+    if (audio_get_snapshot(player, &snapshot) != 0) {
+        return PCM_LATENCY_BALANCED;
+    }
+    return snapshot.latency_profile;
+}
+
+// Filter used wherever the stream has to be resampled. The current device
+// is reopened with it when it is resampling; extra outputs pick it up the
+// next time they are added.
+int audio_set_resampler_quality(audio_player_t *player, audio_resampler_quality_t quality) {
+    if (!player || quality < 0 || quality >= AUDIO_RESAMPLER_QUALITY_COUNT) {
+        return -1;
+    }
+    
+    atomic_store_explicit(&player->resampler_quality, quality, memory_order_relaxed);
+    printf("✅ Resampler quality: %s\n", audio_resampler_params(quality)->name);
+    
+    audio_command_t command = { .type = AUDIO_CMD_SET_RESAMPLER, .arg = quality };
+    return audio_post_output(player, &command);
+}
+
+audio_resampler_quality_t audio_get_resampler_quality(audio_player_t *player) {
+    return atomic_load_explicit(&player->resampler_quality, memory_order_relaxed);
+}
+
+// Output volume, ramped by the engine; 0 dB leaves the stream untouched
+int audio_set_volume(audio_player_t *player, double db) {
     if (!player) {
         return -1;
     }
     
-    *elapsed = player->elapsed_seconds;
-    *total = player->track_length_seconds;
+    audio_dsp_set_volume(&player->dsp, db);
+    printf("🔈 Volume: %.1f dB\n", audio_dsp_get_volume(&player->dsp));
+    return 0;
+}
+
+double audio_get_volume(audio_player_t *player) {
+    return audio_dsp_get_volume(&player->dsp);
+}
+
+// Loudness normalisation of tracks already measured: off, per track, or
+// per album (keeping the disc's own balance between tracks)
+int audio_set_normalization(audio_player_t *player, audio_loudness_mode_t mode) {
+    if (!player || mode < 0 || mode >= AUDIO_LOUDNESS_MODE_COUNT) {
+        return -1;
+    }
     
+    atomic_store_explicit(&player->loudness.mode, mode, memory_order_relaxed);
+    printf("📏 Normalisation: %s (target %.0f LUFS)\n", audio_loudness_mode_name(mode), AUDIO_LOUDNESS_TARGET_LUFS);
     return 0;
 }
 
-int audio_set_cd_player(audio_player_t *player, cd_player_t *cd_player) {
-    if (!player) {
+audio_loudness_mode_t audio_get_normalization(audio_player_t *player) {
+    return (audio_loudness_mode_t)atomic_load_explicit(&player->loudness.mode, memory_order_relaxed);
+}
+
+// Bulk ioctls while nothing needs verifying, or paranoia throughout
+int audio_set_read_method(audio_player_t *player, cd_read_method_t method) {
+    if (!player || (method != CD_READ_METHOD_PARANOIA && method != CD_READ_METHOD_BULK)) {
         return -1;
     }
     
-    player->cd_player = cd_player;
-    printf("✅ CD player reference set in audio player\n");
+    atomic_store_explicit(&player->read_method, method, memory_order_relaxed);
+    audio_wake_reader(player);
     return 0;
 }
+
+cd_read_method_t audio_get_read_method(audio_player_t *player) {
+    return (cd_read_method_t)atomic_load_explicit(&player->read_method, memory_order_relaxed);
+}
+
+// Compare read throughput and CPU cost of both methods on this drive and
+// disc; the report goes to the log. Only while stopped: the reader runs it
+// when the drive is free, and this waits for it.
+int audio_benchmark_read(audio_player_t *player) {
+    audio_snapshot_t snapshot;
+    if (!player || !player->cd_player || audio_get_snapshot(player, &snapshot) != 0) {
+        return -1;
+    }
+    if (snapshot.state != AUDIO_STATE_STOPPED) {
+        printf("⚠️  Read benchmark needs playback stopped\n");
+        return -1;
+    }
+    
+    audio_completion_t completion;
+    audio_completion_init(&completion);
+    
+    audio_completion_t *expected = NULL;
+    int result = -1;
+    if (atomic_compare_exchange_strong(&player->benchmark, &expected, &completion)) {
+        audio_wake_reader(player);
+    
+        // A reader already on its way out will not pick it up: take it back
+        audio_completion_t *mine = &completion;
+        if (!atomic_load(&player->shutdown) || !atomic_compare_exchange_strong(&player->benchmark, &mine, NULL)) {
+            result = audio_completion_wait(&completion);
+        }
+    }
+    audio_completion_destroy(&completion);
+    return result;
+}
@@ -3,30 +3,222 @@
 
 #include <stdbool.h>
 #include <pthread.h>
+#include <stdatomic.h>
 #include <alsa/asoundlib.h>
+#include "sector_ring.h"
+#include "sector_cache.h"
+#include "sector_conceal.h"
+#include "sector_deemph.h"
+#include "pcm_output.h"
+#include "pcm_pool.h"
+#include "audio_fanout.h"
+#include "audio_mixer.h"
+#include "audio_dsp.h"
+#include "audio_loudness.h"
+#include "audio_crossfade.h"
+#include "assets.h"
+#include "audio_command.h"
+
+// Continue into the next track without stopping the PCM
+#define AUDIO_GAPLESS_DEFAULT true
 
 // Forward declaration to avoid circular dependency
 struct cd_player_t;
 bool is_bluealsa_device(const char *device_name);
 
+// Use zero-copy MMAP output when the device supports it
+#define AUDIO_MMAP_DEFAULT true
+
+// Filter for devices that can't play 44.1 kHz, and for drift correction
+#define AUDIO_RESAMPLER_QUALITY_DEFAULT AUDIO_RESAMPLER_STANDARD
+
+// Drive reads at startup, and how much of track 1 the read benchmark
+// covers (10 seconds)
+#define AUDIO_READ_METHOD_DEFAULT CD_READ_METHOD_PARANOIA
+#define AUDIO_READ_BENCHMARK_SECTORS (10 * CD_SECTORS_PER_SECOND)
+
+// Device switch during playback: fade out on the old device and back in on
+// the new one over this many frames (20 ms)
+#define AUDIO_SWITCH_FADE_FRAMES (PCM_OUTPUT_RATE / 50)
+
+// Device commands that can wait for an output being opened
+#define AUDIO_DEFERRED_COMMANDS 8
+
+typedef enum {
+    AUDIO_STATE_STOPPED = 0,
+    AUDIO_STATE_PLAYING,
+    AUDIO_STATE_PAUSED
+} audio_state_t;
+
+// Outcome of the output commands (device, sinks, latency, resampler)
+typedef enum {
+    AUDIO_OUTPUT_READY = 0,        // All applied, the last one worked
+    AUDIO_OUTPUT_CHANGING,         // Some not applied yet
+    AUDIO_OUTPUT_FAILED            // All applied, the last one failed
+} audio_output_state_t;
+
+// What the engine is doing, as seen from other threads
+typedef struct {
+    audio_state_t state;
+    int track;
+    int elapsed_seconds;
+    int track_length_seconds;
+    int scan_direction;
+    long current_sector;
+    long position_ms;              // Heard position: frames written minus device delay
+    long length_ms;
+    bool clock_running;            // PCM running: position advances in real time
+    unsigned long long stamp_ms;   // CLOCK_MONOTONIC time of position_ms
+    bool pending;                  // Commands posted but not yet applied
+    bool deemphasis;               // De-emphasis filter running on the track
+    bool crossfading;              // Next track fading in over this one
+    char device[64];               // Main output
+    pcm_latency_profile_t latency_profile;
+    audio_output_state_t output_state;
+} audio_snapshot_t;
+
+// Seqlock-published snapshot: the engine is the only writer, readers retry
+// while seq is odd or changed underneath them
+typedef struct {
+    atomic_uint seq;
+    atomic_int state;
+    atomic_int track;
+    atomic_int elapsed_seconds;
+    atomic_int track_length_seconds;
+    atomic_int scan_direction;
+    atomic_long current_sector;
+    atomic_long position_ms;
+    atomic_long length_ms;
+    atomic_bool clock_running;
+    atomic_ullong stamp_ms;
+    atomic_ulong commands_done;
+    atomic_bool deemphasis;
+    atomic_bool crossfading;
+    atomic_char device[64];
+    atomic_int latency_profile;
+    atomic_ulong outputs_done;
+    atomic_bool output_failed;
+} audio_snapshot_slot_t;
+
+// An output opened on a helper thread (snd_pcm_open, hw/sw params, a
+// Bluetooth transport can take seconds) while the engine keeps playing
+typedef struct {
+    bool busy;                     // Helper running (engine only)
+    atomic_bool done;              // Helper finished: output and result are set
+    pthread_t thread;
+    audio_command_t command;       // SET_DEVICE or ADD_SINK being carried out
+    pcm_output_t output;
+    int result;
+} audio_device_open_t;
+
 typedef struct {
-    snd_pcm_t *pcm_handle;
-    char device_name[64];
-    bool is_playing;
-    bool is_paused;
+    pcm_output_t output;           // Engine only; other threads read the snapshot
+    atomic_bool allow_mmap;
+    atomic_int resampler_quality;
+    pcm_pool_t pool;             // Recently used outputs kept open and prepared
+    audio_fanout_t fanout;       // Extra outputs playing the same stream (engine only)
     
-    // CD playback support
+    // Notifications are mixed into the one PCM by the engine
+    audio_mixer_t mixer;
+    long mixer_tail;             // Silence still to write after the last voice (engine only)
+    
+    // Volume, EQ and limiter on everything the outputs play
+    audio_dsp_t dsp;
+    
+    // Undoes pre-emphasis on flagged tracks, a ring sector at a time (engine only)
+    sector_deemph_t deemph;
+    
+    // Overlaps the end of a track with the start of the next (engine only)
+    audio_crossfade_t crossfade;
+    
+    // Playback engine: one long-lived thread owns the PCM and applies
+    // commands from the queue; audio_* control calls only post commands
+    pthread_t engine_thread;
+    bool engine_running;
+    audio_command_queue_t commands;
+    atomic_ulong commands_posted;
+    atomic_ulong outputs_posted;   // Output commands among them
+    int control_fd;              // eventfd: wakes the engine for commands
+    atomic_bool writer_waiting;  // Engine asleep until the reader commits a sector
+    audio_snapshot_slot_t snapshot;
+    atomic_bool shutdown;
+    
+    // A new main output or sink is swapped in once the helper has it ready;
+    // device commands arriving meanwhile wait their turn (engine only)
+    audio_device_open_t opening;
+    audio_command_t deferred[AUDIO_DEFERRED_COMMANDS];
+    int deferred_count;
+    
+    // Engine thread only; other threads read the snapshot
+    audio_state_t state;
+    unsigned long commands_applied;
+    unsigned long outputs_applied;
+    bool output_failed;            // Last output command failed
     struct cd_player_t *cd_player;  // Use struct prefix
     int current_track;
     int current_sector;
     int track_start_sector;
     int track_end_sector;
-    pthread_t playback_thread;
-    bool stop_playback;
-    
-    // Timing information
     int elapsed_seconds;
     int track_length_seconds;
+    
+    // Position clock: frames written for current_track minus what the device
+    // still holds. Right after a gapless switch the previous track is what
+    // is being heard, so the clock can point there.
+    long written_frames;
+    int prev_track;
+    long prev_track_frames;
+    int prev_length_seconds;
+    int heard_track;
+    int heard_length_seconds;
+    long heard_frames;
+    bool clock_running;
+    unsigned int output_epoch;     // Epoch of the audio the PCM holds
+    
+    // Device switch: the CD audio last handed to the PCM (before
+    // notifications are mixed in) is kept, so what the old device had not
+    // played yet can be replayed on the new one before the ring continues
+    int16_t *history;
+    size_t history_capacity;       // Frames (device buffer plus the fan-out delay)
+    size_t history_pos;            // Next frame to store
+    size_t history_fill;
+    int16_t *replay;
+    size_t replay_frames;
+    size_t replay_pos;
+    long fade_in_pos;              // Frames faded in on a new device; -1 when done
+    
+    // CD reader (ring producer): long-lived, parks on reader_fd when idle
+    pthread_t reader_thread;
+    int reader_fd;
+    atomic_int read_method;      // Applied by the reader before its next read
+    _Atomic(audio_completion_t *) benchmark;  // Read benchmark asked for
+    atomic_bool reader_idle;     // Parked: the engine may reset/resize the ring
+    atomic_bool reader_done;     // Read up to the end of the last track
+    
+    // Read-ahead ring between the CD reader and the ALSA writer
+    sector_ring_t ring;
+    atomic_int ring_seconds;       // Applied at the next track start
+    atomic_int ring_requested;     // Depth asked for; a crossfade may deepen it
+    atomic_bool gapless;
+    
+    // Seek/scan requests; bumping seek_epoch makes older ring sectors stale.
+    // Track 0 parks the reader.
+    atomic_uint seek_epoch;
+    atomic_int seek_track;
+    atomic_long seek_lsn;
+    atomic_int scan_direction;     // -1 REW, 0 off, 1 FF
+    
+    int sector_offset;             // Frames of the ring tail already output (writer only)
+    unsigned long ring_underruns;
+    
+    // Verified sectors of the current disc, so replays skip the drive
+    sector_cache_t cache;
+    
+    // Fills unreadable sectors in place (reader thread only)
+    sector_conceal_t conceal;
+    
+    // Per-track loudness: measured by the reader, applied by the engine
+    audio_loudness_t loudness;
 } audio_player_t;
 
 // Function declarations
@@ -36,13 +228,41 @@ int audio_pause(audio_player_t *player);
 int audio_resume(audio_player_t *player);
 int audio_stop(audio_player_t *player);
 int audio_set_device(audio_player_t *player, const char *device);
+int audio_add_sink(audio_player_t *player, const char *device);
+int audio_remove_sink(audio_player_t *player, const char *device);
 int audio_write_samples(audio_player_t *player, const int16_t *samples, int frames);
 int audio_play_notification(audio_player_t *player, const char *wav_file_path);
+int audio_play_sound(audio_player_t *player, sound_handle_t sound);
 int audio_play_wav_file(const char *device_id, const char *wav_file_path);
 int audio_test_device_with_notification(const char *device_id, const char *wav_file_path);
 int audio_set_cd_player(audio_player_t *player, struct cd_player_t *cd_player);
 int audio_get_position(audio_player_t *player, int *elapsed, int *total);
+int audio_get_position_ms(audio_player_t *player, long *elapsed_ms, long *total_ms);
 void audio_cleanup(audio_player_t *player);
 int audio_validate_device(audio_player_t *player);
+int audio_set_ring_seconds(audio_player_t *player, int seconds);
+int audio_get_ring_fill(audio_player_t *player, int *filled, int *capacity);
+int audio_set_sector_cache(audio_player_t *player, int budget_mb, const char *spill_path);
+int audio_get_cache_stats(audio_player_t *player, sector_cache_stats_t *stats);
+int audio_set_gapless(audio_player_t *player, bool enabled);
+int audio_set_crossfade(audio_player_t *player, int seconds);
+int audio_get_crossfade(audio_player_t *player);
+int audio_seek(audio_player_t *player, double seconds);
+int audio_scan(audio_player_t *player, int direction);
+int audio_next(audio_player_t *player);
+int audio_prev(audio_player_t *player);
+int audio_get_snapshot(audio_player_t *player, audio_snapshot_t *snapshot);
+int audio_set_mmap(audio_player_t *player, bool enabled);
+int audio_set_latency_profile(audio_player_t *player, pcm_latency_profile_t profile);
+pcm_latency_profile_t audio_get_latency_profile(audio_player_t *player);
+int audio_set_resampler_quality(audio_player_t *player, audio_resampler_quality_t quality);
+audio_resampler_quality_t audio_get_resampler_quality(audio_player_t *player);
+int audio_set_volume(audio_player_t *player, double db);
+double audio_get_volume(audio_player_t *player);
+int audio_set_normalization(audio_player_t *player, audio_loudness_mode_t mode);
+audio_loudness_mode_t audio_get_normalization(audio_player_t *player);
+int audio_set_read_method(audio_player_t *player, cd_read_method_t method);
+cd_read_method_t audio_get_read_method(audio_player_t *player);
+int audio_benchmark_read(audio_player_t *player);
 
 #endif
@@ -0,0 +1,234 @@
+#include "audio_resampler.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
+
+#define RESAMPLER_CAPACITY (AUDIO_RESAMPLER_MAX_TAPS + AUDIO_RESAMPLER_BLOCK)
+
+static const audio_resampler_params_t resampler_qualities[AUDIO_RESAMPLER_QUALITY_COUNT] = {
+    [AUDIO_RESAMPLER_FAST]     = { "fast",     "Fast",     16, 0.40, 5.0 },
+    [AUDIO_RESAMPLER_STANDARD] = { "standard", "Standard", 32, 0.44, 6.0 },
+    [AUDIO_RESAMPLER_HIGH]     = { "high",     "High",     48, 0.46, 7.0 },
+};
+
+const audio_resampler_params_t *audio_resampler_params(audio_resampler_quality_t quality) {
+    if (quality < 0 || quality >= AUDIO_RESAMPLER_QUALITY_COUNT) {
+        quality = AUDIO_RESAMPLER_STANDARD;
+    }
+    return &resampler_qualities[quality];
+}
+
+// Which inner product this build runs
+const char *audio_resampler_simd(void) {
+#if defined(__ARM_NEON)
+    return "NEON";
+#elif defined(__SSE2__)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+// Zeroth-order modified Bessel function, for the Kaiser window
+static double resampler_bessel_i0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+// Kaiser-windowed sinc at x input frames from the centre
+static double resampler_tap(const audio_resampler_params_t *params, double x) {
+    double half = params->taps / 2.0;
+    if (fabs(x) >= half) {
+        return 0.0;
+    }
+    
+    double fc = params->cutoff;
+    double sinc = (x == 0.0) ? 1.0 : sin(2.0 * M_PI * fc * x) / (2.0 * M_PI * fc * x);
+    double r = x / half;
+    double window = resampler_bessel_i0(params->kaiser_beta * sqrt(1.0 - r * r)) /
+                    resampler_bessel_i0(params->kaiser_beta);
+    return 2.0 * fc * sinc * window;
+}
+
+// Row p holds the filter for an output p / PHASES of the way from one input
+// frame to the next; every row sums to 1 so the gain never wobbles with phase
+static void resampler_build_kernel(float *kernel, const audio_resampler_params_t *params) {
+    int taps = params->taps;
+    
+    for (int p = 0; p <= AUDIO_RESAMPLER_PHASES; p++) {
+        double row[AUDIO_RESAMPLER_MAX_TAPS];
+        double sum = 0.0;
+        double frac = (double)p / AUDIO_RESAMPLER_PHASES;
+    
+        for (int k = 0; k < taps; k++) {
+            row[k] = resampler_tap(params, k - (taps / 2 - 1) - frac);
+            sum += row[k];
+        }
+        for (int k = 0; k < taps; k++) {
+            float c = (float)(row[k] / sum);
+            kernel[(p * taps + k) * 2] = c;
+            kernel[(p * taps + k) * 2 + 1] = c;
+        }
+    }
+}
+
+static int16_t resampler_clip(float v) {
+    long s = lrintf(v);
+    return (int16_t)(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+}
+
+// One stereo output frame: x against two neighbouring kernel rows of n
+// values (a multiple of 4), blended by t. x and the rows are interleaved
+// L/R, so each vector lane stays on one channel.
+static void resampler_dot(const float *x, const float *r0, const float *r1, int n, float t, int16_t *out) {
+#if defined(__ARM_NEON)
+    float32x4_t a0 = vdupq_n_f32(0.0f);
+    float32x4_t a1 = vdupq_n_f32(0.0f);
+    for (int k = 0; k < n; k += 4) {
+        float32x4_t v = vld1q_f32(x + k);
+        a0 = vmlaq_f32(a0, v, vld1q_f32(r0 + k));
+        a1 = vmlaq_f32(a1, v, vld1q_f32(r1 + k));
+    }
+    float32x4_t acc = vmlaq_n_f32(vmulq_n_f32(a0, 1.0f - t), a1, t);
+    float32x2_t lr = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    out[0] = resampler_clip(vget_lane_f32(lr, 0));
+    out[1] = resampler_clip(vget_lane_f32(lr, 1));
+#elif defined(__SSE2__)
+    __m128 a0 = _mm_setzero_ps();
+    __m128 a1 = _mm_setzero_ps();
+    for (int k = 0; k < n; k += 4) {
+        __m128 v = _mm_loadu_ps(x + k);
+        a0 = _mm_add_ps(a0, _mm_mul_ps(v, _mm_loadu_ps(r0 + k)));
+        a1 = _mm_add_ps(a1, _mm_mul_ps(v, _mm_loadu_ps(r1 + k)));
+    }
+    __m128 acc = _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(1.0f - t)), _mm_mul_ps(a1, _mm_set1_ps(t)));
+    float lr[4];
+    _mm_storeu_ps(lr, _mm_add_ps(acc, _mm_movehl_ps(acc, acc)));
+    out[0] = resampler_clip(lr[0]);
+    out[1] = resampler_clip(lr[1]);
+#else
+    float a0[2] = { 0.0f, 0.0f };
+    float a1[2] = { 0.0f, 0.0f };
+    for (int k = 0; k < n; k++) {
+        a0[k & 1] += x[k] * r0[k];
+        a1[k & 1] += x[k] * r1[k];
+    }
+    out[0] = resampler_clip(a0[0] + (a1[0] - a0[0]) * t);
+    out[1] = resampler_clip(a0[1] + (a1[1] - a0[1]) * t);
+#endif
+}
+
+// ratio: output frames per input frame
+int audio_resampler_init(audio_resampler_t *rs, double ratio, audio_resampler_quality_t quality) {
+    const audio_resampler_params_t *params = audio_resampler_params(quality);
+    
+    memset(rs, 0, sizeof(audio_resampler_t));
+    rs->quality = quality;
+    rs->taps = params->taps;
+    rs->kernel = malloc((AUDIO_RESAMPLER_PHASES + 1) * rs->taps * 2 * sizeof(float));
+    if (!rs->kernel) {
+        return -1;
+    }
+    
+    resampler_build_kernel(rs->kernel, params);
+    audio_resampler_set_ratio(rs, ratio);
+    audio_resampler_reset(rs);
+    return 0;
+}
+
+void audio_resampler_free(audio_resampler_t *rs) {
+    free(rs->kernel);
+    rs->kernel = NULL;
+}
+
+// Forget all input. The history starts as silence placed so that the first
+// output lands exactly on the first input frame that follows.
+void audio_resampler_reset(audio_resampler_t *rs) {
+    rs->buffered = rs->taps / 2 - 1;
+    memset(rs->buffer, 0, rs->buffered * 2 * sizeof(float));
+    rs->position = 0.0;
+}
+
+// Takes effect from the next output frame
+void audio_resampler_set_ratio(audio_resampler_t *rs, double ratio) {
+    rs->step = 1.0 / ratio;
+}
+
+// Resample up to *in_frames frames from in into at most out_frames frames
+// at out. *in_frames is set to the frames taken; returns the frames written.
+size_t audio_resampler_process(audio_resampler_t *rs, const int16_t *in, size_t *in_frames,
+                               int16_t *out, size_t out_frames) {
+    size_t used = 0;
+    size_t produced = 0;
+    
+    for (;;) {
+        while (produced < out_frames) {
+            size_t i = (size_t)rs->position;
+            if (i + rs->taps > rs->buffered) {
+                break;
+            }
+    
+            double phase = (rs->position - i) * AUDIO_RESAMPLER_PHASES;
+            size_t p = (size_t)phase;
+            const float *row = rs->kernel + p * rs->taps * 2;
+            resampler_dot(rs->buffer + i * 2, row, row + rs->taps * 2, rs->taps * 2, (float)(phase - p),
+                          out + produced * 2);
+            rs->position += rs->step;
+            produced++;
+        }
+        if (produced == out_frames || used == *in_frames) {
+            break;
+        }
+    
+        // Slide out the frames behind the filter and take in more
+        size_t drop = (size_t)rs->position;
+        if (drop > rs->buffered) {
+            drop = rs->buffered;
+        }
+        memmove(rs->buffer, rs->buffer + drop * 2, (rs->buffered - drop) * 2 * sizeof(float));
+        rs->buffered -= drop;
+        rs->position -= drop;
+    
+        size_t take = RESAMPLER_CAPACITY - rs->buffered;
+        if (take > *in_frames - used) {
+            take = *in_frames - used;
+        }
+        float *dst = rs->buffer + rs->buffered * 2;
+        const int16_t *src = in + used * 2;
+        for (size_t k = 0; k < take * 2; k++) {
+            dst[k] = src[k];
+        }
+        rs->buffered += take;
+        used += take;
+    }
+    
+    *in_frames = used;
+    return produced;
+}
+
+// Input frames taken in but not yet reached by the output. The next output
+// frame stands for the input frame this far before the next one to come in.
+double audio_resampler_pending(const audio_resampler_t *rs) {
+    return rs->buffered - (rs->position + rs->taps / 2 - 1);
+}
+
+// Multiply-adds per second at out_rate, for the log
+double audio_resampler_cost(const audio_resampler_t *rs, unsigned int out_rate) {
+    // Two kernel rows per channel per output frame
+    return 4.0 * rs->taps * out_rate;
+}
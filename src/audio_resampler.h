@@ -0,0 +1,53 @@
+#ifndef AUDIO_RESAMPLER_H
+#define AUDIO_RESAMPLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Polyphase filter: phases tabulated between two input frames (coefficients
+// in between are interpolated) and the longest filter of any quality
+#define AUDIO_RESAMPLER_PHASES 64
+#define AUDIO_RESAMPLER_MAX_TAPS 48
+
+// Input frames taken in per pass
+#define AUDIO_RESAMPLER_BLOCK 256
+
+// Filter length against CPU time. Cutoffs are fractions of the input rate.
+typedef enum {
+    AUDIO_RESAMPLER_FAST = 0,       // 16 taps: flat to ~15 kHz at 44.1 kHz
+    AUDIO_RESAMPLER_STANDARD,       // 32 taps: flat to ~17 kHz
+    AUDIO_RESAMPLER_HIGH,           // 48 taps: flat to ~18 kHz, 70 dB stopband
+    AUDIO_RESAMPLER_QUALITY_COUNT
+} audio_resampler_quality_t;
+
+typedef struct {
+    const char *name;               // Log name
+    const char *label;              // LCD label
+    int taps;
+    double cutoff;
+    double kaiser_beta;
+} audio_resampler_params_t;
+
+typedef struct {
+    audio_resampler_quality_t quality;
+    int taps;
+    float *kernel;                  // PHASES + 1 rows of taps coefficients, each doubled for L/R
+    float buffer[(AUDIO_RESAMPLER_MAX_TAPS + AUDIO_RESAMPLER_BLOCK) * 2];
+    size_t buffered;                // Input frames in buffer
+    double position;                // Buffer frame under the next output's first tap
+    double step;                    // Input frames per output frame
+} audio_resampler_t;
+
+// Function declarations
+int audio_resampler_init(audio_resampler_t *rs, double ratio, audio_resampler_quality_t quality);
+void audio_resampler_free(audio_resampler_t *rs);
+void audio_resampler_reset(audio_resampler_t *rs);
+void audio_resampler_set_ratio(audio_resampler_t *rs, double ratio);
+size_t audio_resampler_process(audio_resampler_t *rs, const int16_t *in, size_t *in_frames,
+                               int16_t *out, size_t out_frames);
+double audio_resampler_pending(const audio_resampler_t *rs);
+double audio_resampler_cost(const audio_resampler_t *rs, unsigned int out_rate);
+const audio_resampler_params_t *audio_resampler_params(audio_resampler_quality_t quality);
+const char *audio_resampler_simd(void);
+
+#endif
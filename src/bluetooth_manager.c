@@ -659,7 +659,7 @@ int bluetooth_connect_device(bluetooth_manager_t *manager, const char *device_ad
         
         // Test and potentially switch to Bluetooth audio
         printf("🔄 Testing Bluetooth audio device...\n");
-        if (audio_test_device_with_notification(bt_device_id, "./assets/sounds/bt_connect.wav") == 0) {
+        if (audio_test_device_with_notification(bt_device_id, NOTIFICATION_SOUND_PATH) == 0) {
             printf("🎉 Bluetooth audio working! Device ready for CD playback\n");
         }
         
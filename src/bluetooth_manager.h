@@ -2,9 +2,9 @@
 #define BLUETOOTH_MANAGER_H
 
 // With this:
-#define NOTIFICATION_SOUND_PATH "./assets/sounds/bt_connect.wav"
-#define DISCONNECT_SOUND_PATH "./assets/sounds/bt_disconnect.wav"
-#define ERROR_SOUND_PATH "./assets/sounds/error_beep.wav"
+#define NOTIFICATION_SOUND_PATH "bt_connect.wav"
+#define DISCONNECT_SOUND_PATH "bt_disconnect.wav"
+#define ERROR_SOUND_PATH "error_beep.wav"
 
 #include <stdbool.h>
 #include <glib.h>
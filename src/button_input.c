@@ -42,34 +42,85 @@ int button_init(button_manager_t *manager, int play_pin, int prev_pin, int next_
     return 0;
 }
 
+// PREV/NEXT: a short press reports on release, a long one reports a hold
+static button_event_t button_poll_holdable(int last_state, int current, unsigned int *press_ms,
+                                           bool *holding, button_event_t press_event,
+                                           button_event_t hold_event) {
+    // Falling edge (1 -> 0): start timing the press
+    if (last_state == 1 && current == 0) {
+        *press_ms = millis();
+        *holding = false;
+        usleep(DEBOUNCE_DELAY); // Debounce delay
+        return BUTTON_NONE;
+    }
+    
+    // Still down: becomes a hold once past the threshold
+    if (last_state == 0 && current == 0) {
+        if (!*holding && millis() - *press_ms >= BUTTON_HOLD_MS) {
+            *holding = true;
+            return hold_event;
+        }
+        return BUTTON_NONE;
+    }
+    
+    // Rising edge (0 -> 1): end of a press or a hold
+    if (last_state == 0 && current == 1) {
+        bool was_holding = *holding;
+        *holding = false;
+        usleep(DEBOUNCE_DELAY); // Debounce delay
+        return was_holding ? BUTTON_HOLD_RELEASE : press_event;
+    }
+    
+    return BUTTON_NONE;
+}
+
 button_event_t button_poll(button_manager_t *manager) {
     // Read current button states
     int play_current = digitalRead(manager->play_pin);
     int prev_current = digitalRead(manager->prev_pin);
     int next_current = digitalRead(manager->next_pin);
     
-    button_event_t event = BUTTON_NONE;
+    button_event_t events[3] = { BUTTON_NONE, BUTTON_NONE, BUTTON_NONE };
     
     // Check for button press (falling edge: 1 -> 0)
     // Buttons are active low with pull-up resistors
     if (manager->play_last_state == 1 && play_current == 0) {
-        event = BUTTON_PLAY_PAUSE;
-        usleep(DEBOUNCE_DELAY); // Debounce delay
-    }
-    else if (manager->prev_last_state == 1 && prev_current == 0) {
-        event = BUTTON_PREV;
-        usleep(DEBOUNCE_DELAY); // Debounce delay
-    }
-    else if (manager->next_last_state == 1 && next_current == 0) {
-        event = BUTTON_NEXT;
+        events[0] = BUTTON_PLAY_PAUSE;
         usleep(DEBOUNCE_DELAY); // Debounce delay
     }
     
+    // PREV/NEXT always track their edges, even under a PLAY press, so a
+    // hold is always followed by its release
+    events[1] = button_poll_holdable(manager->prev_last_state, prev_current,
+                                     &manager->prev_press_ms, &manager->prev_holding,
+                                     BUTTON_PREV, BUTTON_PREV_HOLD);
+    events[2] = button_poll_holdable(manager->next_last_state, next_current,
+                                     &manager->next_press_ms, &manager->next_holding,
+                                     BUTTON_NEXT, BUTTON_NEXT_HOLD);
+    
     // Update last states
     manager->play_last_state = play_current;
     manager->prev_last_state = prev_current;
     manager->next_last_state = next_current;
     
+    // One event per poll: earlier ones first, then PLAY before PREV/NEXT
+    button_event_t event = BUTTON_NONE;
+    if (manager->num_queued > 0) {
+        event = manager->queued[0];
+        manager->num_queued--;
+        memmove(manager->queued, manager->queued + 1, manager->num_queued * sizeof(manager->queued[0]));
+    }
+    for (int i = 0; i < 3; i++) {
+        if (events[i] == BUTTON_NONE) {
+            continue;
+        }
+        if (event == BUTTON_NONE) {
+            event = events[i];
+        } else if (manager->num_queued < BUTTON_QUEUED_EVENTS) {
+            manager->queued[manager->num_queued++] = events[i];
+        }
+    }
+    
     return event;
 }
 
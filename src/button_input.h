@@ -7,9 +7,17 @@ typedef enum {
     BUTTON_NONE = 0,
     BUTTON_PLAY_PAUSE,
     BUTTON_PREV,
-    BUTTON_NEXT
+    BUTTON_NEXT,
+    BUTTON_PREV_HOLD,       // PREV held past BUTTON_HOLD_MS
+    BUTTON_NEXT_HOLD,       // NEXT held past BUTTON_HOLD_MS
+    BUTTON_HOLD_RELEASE     // A held PREV/NEXT was let go
 } button_event_t;
 
+#define BUTTON_HOLD_MS 600
+
+// Events from one poll beyond the one returned (at most one per button)
+#define BUTTON_QUEUED_EVENTS 2
+
 typedef struct {
     int play_pin;
     int prev_pin;
@@ -18,6 +26,16 @@ typedef struct {
     int play_last_state;
     int prev_last_state;
     int next_last_state;
+    
+    // PREV/NEXT report on release so a hold can be told apart from a press
+    unsigned int prev_press_ms;
+    unsigned int next_press_ms;
+    bool prev_holding;
+    bool next_holding;
+    
+    // Handed out by the next polls, so a release is never lost
+    button_event_t queued[BUTTON_QUEUED_EVENTS];
+    int num_queued;
 } button_manager_t;
 
 // Function declarations
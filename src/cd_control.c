@@ -6,9 +6,150 @@
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <linux/cdrom.h>
+#include <time.h>
+
+// Paranoia events during the read in progress (reads happen on one thread)
+static int read_events;
+static int read_damage;      // Of those, the ones where paranoia gave up
+
+static void cd_paranoia_callback(long inpos, paranoia_cb_mode_t function) {
+    (void)inpos;
+    
+    switch (function) {
+        case PARANOIA_CB_FIXUP_EDGE:
+        case PARANOIA_CB_FIXUP_ATOM:
+        case PARANOIA_CB_FIXUP_DROPPED:
+        case PARANOIA_CB_FIXUP_DUPED:
+        case PARANOIA_CB_DRIFT:
+        case PARANOIA_CB_SCRATCH:
+        case PARANOIA_CB_REPAIR:
+            read_events++;
+            break;
+        case PARANOIA_CB_SKIP:
+        case PARANOIA_CB_READERR:
+            read_damage++;
+            read_events++;
+            break;
+        default:
+            break;
+    }
+}
+
+static double cd_clock_seconds(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Time one read call: wall time includes waiting on the drive, CPU time doesn't
+typedef struct {
+    double wall;
+    double cpu;
+} cd_read_timer_t;
+
+static void cd_read_timer_start(cd_read_timer_t *timer) {
+    timer->wall = cd_clock_seconds(CLOCK_MONOTONIC);
+    timer->cpu = cd_clock_seconds(CLOCK_THREAD_CPUTIME_ID);
+}
+
+static void cd_read_timer_stop(cd_read_timer_t *timer, cd_read_throughput_t *stats, int sectors) {
+    stats->wall_seconds += cd_clock_seconds(CLOCK_MONOTONIC) - timer->wall;
+    stats->cpu_seconds += cd_clock_seconds(CLOCK_THREAD_CPUTIME_ID) - timer->cpu;
+    stats->sectors += sectors;
+    stats->calls++;
+}
+
+static int16_t *cd_paranoia_read_timed(cd_player_t *player) {
+    cd_read_timer_t timer;
+    cd_read_timer_start(&timer);
+    
+    read_events = 0;
+    read_damage = 0;
+    int16_t *audio_data = cdio_paranoia_read(player->paranoia, cd_paranoia_callback);
+    player->read_engine.events += read_events;
+    player->read_engine.damaged = (read_damage > 0);
+    
+    cd_read_timer_stop(&timer, &player->read_engine.paranoia_stats, audio_data ? 1 : 0);
+    return audio_data;
+}
+
+static void cd_read_set_mode(cd_player_t *player, bool full_mode) {
+    player->read_engine.full_mode = full_mode;
+    player->paranoia_mode = full_mode ? PARANOIA_MODE_FULL : CD_READ_FAST_MODE;
+    if (player->paranoia) {
+        cdio_paranoia_modeset(player->paranoia, player->paranoia_mode);
+    }
+}
+
+static void cd_read_escalate(cd_player_t *player, int lsn, int events) {
+    cd_read_engine_t *engine = &player->read_engine;
+    
+    engine->escalations++;
+    engine->clean_sectors = 0;
+    engine->current.start_lsn = lsn;
+    engine->current.end_lsn = lsn;
+    engine->current.errors = events;
+    cd_read_set_mode(player, true);
+    
+    printf("🛡️  Read trouble at sector %d (%d events): full paranoia verification on\n", lsn, events);
+}
+
+static void cd_read_close_region(cd_read_engine_t *engine) {
+    engine->regions[engine->num_regions % CD_READ_MAX_REGIONS] = engine->current;
+    engine->num_regions++;
+}
+
+static void cd_read_relax(cd_player_t *player) {
+    cd_read_engine_t *engine = &player->read_engine;
+    
+    cd_read_close_region(engine);
+    cd_read_set_mode(player, false);
+    
+    printf("✅ Sectors %d-%d verified (%d events), back to fast reads\n",
+           engine->current.start_lsn, engine->current.end_lsn, engine->current.errors);
+}
+
+// New disc: a region still being verified is recorded as it stands, then
+// adaptive reads start fast again; otherwise always verify
+static void cd_read_reset(cd_player_t *player) {
+    cd_read_engine_t *engine = &player->read_engine;
+    
+    if (engine->adaptive && engine->full_mode) {
+        cd_read_close_region(engine);
+    }
+    engine->clean_sectors = 0;
+    cd_read_set_mode(player, !engine->adaptive);
+}
+
+// Sum of decimal digits, as used by the FreeDB disc ID
+static int cd_digit_sum(int n) {
+    int sum = 0;
+    while (n > 0) {
+        sum += n % 10;
+        n /= 10;
+    }
+    return sum;
+}
+
+// FreeDB-style disc ID computed from the TOC
+static unsigned int cd_compute_disc_id(CdIo_t *cdio, track_t first_track, track_t last_track) {
+    int checksum = 0;
+    for (track_t t = first_track; t <= last_track; t++) {
+        checksum += cd_digit_sum(cdio_get_track_lba(cdio, t) / CD_SECTORS_PER_SECOND);
+    }
+    
+    int first_sec = cdio_get_track_lba(cdio, first_track) / CD_SECTORS_PER_SECOND;
+    int leadout_sec = cdio_get_track_lba(cdio, CDIO_CDROM_LEADOUT_TRACK) / CD_SECTORS_PER_SECOND;
+    int num_tracks = last_track - first_track + 1;
+    
+    return ((unsigned int)(checksum % 0xff) << 24) | 
+           ((unsigned int)(leadout_sec - first_sec) << 8) | 
+           (unsigned int)num_tracks;
+}
 
 int cd_init(cd_player_t *player) {
     memset(player, 0, sizeof(cd_player_t));
+    pthread_mutex_init(&player->drive_lock, NULL);
     
     printf("🔵 Initializing CD player...\n");
     
@@ -27,6 +168,9 @@ int cd_init(cd_player_t *player) {
     printf("✅ CD-ROM device opened successfully\n");
     
     player->current_track = 1;
+    player->read_engine.adaptive = CD_READ_ADAPTIVE_DEFAULT;
+    player->read_engine.method = CD_READ_METHOD_PARANOIA;
+    player->read_engine.bulk_sectors = CD_BULK_DEFAULT_SECTORS;
     player->disc_present = false;
     player->is_audio_cd = false;
     strcpy(player->disc_title, "Unknown Disc");
@@ -37,11 +181,16 @@ int cd_init(cd_player_t *player) {
     return 0;
 }
 
-int cd_detect_disc(cd_player_t *player) {
-    if (!player->cdio) {
-        return -1;
-    }
-    
+void cd_lock_drive(cd_player_t *player) {
+    pthread_mutex_lock(&player->drive_lock);
+}
+
+void cd_unlock_drive(cd_player_t *player) {
+    pthread_mutex_unlock(&player->drive_lock);
+}
+
+// Caller holds drive_lock
+static int cd_detect_disc_locked(cd_player_t *player) {
     printf("🔍 Detecting CD disc...\n");
     
     // Check if disc is present
@@ -80,21 +229,57 @@ int cd_detect_disc(cd_player_t *player) {
         return 0;
     }
     
+    unsigned int disc_id = cd_compute_disc_id(player->cdio, first_track, last_track);
+    bool disc_changed = (disc_id != player->disc_id);
+    
     player->disc_present = true;
     player->is_audio_cd = true;
     player->num_tracks = last_track - first_track + 1;
+    player->disc_id = disc_id;
+    player->disc_sectors = cdio_get_track_lsn(player->cdio, CDIO_CDROM_LEADOUT_TRACK);
     
     // Ensure current track is valid
     if (player->current_track < 1 || player->current_track > player->num_tracks) {
         player->current_track = 1;
     }
     
-    printf("✅ Audio CD detected: %d tracks\n", player->num_tracks);
+    printf("✅ Audio CD detected: %d tracks (disc ID %08x)\n", player->num_tracks, player->disc_id);
+    
+    // Pre-emphasis is a per-track control flag in the TOC. The engine reads
+    // the flags for every sector it plays, so they are built aside and only
+    // replaced for a different disc.
+    if (disc_changed) {
+        bool preemphasis[CDIO_CD_MAX_TRACKS + 1] = { false };
+        int preemphasis_tracks = 0;
+        char flagged[256] = "";
+        size_t len = 0;
+        for (track_t t = first_track; t <= last_track && t <= CDIO_CD_MAX_TRACKS; t++) {
+            if (cdio_get_track_preemphasis(player->cdio, t) == CDIO_TRACK_FLAG_TRUE) {
+                preemphasis[t] = true;
+                preemphasis_tracks++;
+                if (len < sizeof(flagged)) {
+                    len += snprintf(flagged + len, sizeof(flagged) - len, " %d", t);
+                }
+            }
+        }
+        memcpy(player->preemphasis, preemphasis, sizeof(player->preemphasis));
+        player->preemphasis_tracks = preemphasis_tracks;
+        if (preemphasis_tracks > 0) {
+            printf("🎚️  Pre-emphasis on %d of %d tracks:%s\n", preemphasis_tracks, player->num_tracks, flagged);
+        }
+    }
     
-    if (player->disc_present && player->is_audio_cd) {
+    // Paranoia is only set up again for a different disc (or after an
+    // eject dropped it): the reader is between reads while we hold
+    // drive_lock, and picks a new handle up before its next one
+    if (disc_changed || !player->paranoia) {
         // Initialize paranoia like the test script
         if (player->paranoia) {
             cdio_paranoia_free(player->paranoia);
+            player->paranoia = NULL;
+        }
+        if (disc_changed) {
+            cd_read_reset(player);
         }
         
         cdrom_drive_t *drive = cdio_cddap_identify_cdio(player->cdio, 0, NULL);
@@ -102,7 +287,7 @@ int cd_detect_disc(cd_player_t *player) {
             if (cdio_cddap_open(drive) == 0) {
                 player->paranoia = cdio_paranoia_init(drive);
                 if (player->paranoia) {
-                    cdio_paranoia_modeset(player->paranoia, PARANOIA_MODE_FULL);
+                    cd_read_set_mode(player, player->read_engine.full_mode);
                     printf("✅ Paranoia initialized for audio extraction\n");
                 }
             }
@@ -112,6 +297,17 @@ int cd_detect_disc(cd_player_t *player) {
     return 1;
 }
 
+int cd_detect_disc(cd_player_t *player) {
+    if (!player->cdio) {
+        return -1;
+    }
+    
+    cd_lock_drive(player);
+    int result = cd_detect_disc_locked(player);
+    cd_unlock_drive(player);
+    return result;
+}
+
 int cd_get_disc_info(cd_player_t *player) {
     if (!player->cdio || !player->disc_present) {
         return -1;
@@ -120,6 +316,7 @@ int cd_get_disc_info(cd_player_t *player) {
     printf("📀 Getting disc information...\n");
     
     // Try to get CD-TEXT information
+    cd_lock_drive(player);
     cdtext_t *cdtext = cdio_get_cdtext(player->cdio);
     if (cdtext) {
         const char *title = cdtext_get_const(cdtext, CDTEXT_FIELD_TITLE, 0);
@@ -128,6 +325,7 @@ int cd_get_disc_info(cd_player_t *player) {
             printf("📀 Disc title: %s\n", player->disc_title);
         }
     }
+    cd_unlock_drive(player);
     
     // Calculate total disc time
     int total_seconds = 0;
@@ -170,14 +368,14 @@ int cd_get_track_info(cd_player_t *player, int track, int *length) {
 
 int cd_read_audio_sector(cd_player_t *player, int track, int sector, int16_t *buffer) {
     (void)track;   // Suppress unused parameter warning
-    (void)sector;  // Suppress unused parameter warning
     
     if (!player->paranoia || !player->disc_present || !player->is_audio_cd) {
         return -1;
     }
     
-    // Direct paranoia read (like your working test script)
-    int16_t *audio_data = (int16_t *)cdio_paranoia_read(player->paranoia, NULL);
+    // Paranoia read at its current position, through the adaptive engine
+    bool verified;
+    int16_t *audio_data = cd_read_sector(player, sector, &verified);
     if (!audio_data) {
         printf("❌ Failed to read sector from CD\n");
         return -1;
@@ -190,6 +388,179 @@ int cd_read_audio_sector(cd_player_t *player, int track, int sector, int16_t *bu
     return frames_per_sector;
 }
 
+// Read the sector at paranoia's current position (lsn is where that is).
+// Like the other reads below, the caller holds drive_lock.
+// verified is set when the data passed the checks of the active mode;
+// read_engine.damaged flags data paranoia returned after giving up.
+int16_t *cd_read_sector(cd_player_t *player, int lsn, bool *verified) {
+    cd_read_engine_t *engine = &player->read_engine;
+    
+    int16_t *audio_data = cd_paranoia_read_timed(player);
+    
+    if (!engine->adaptive) {
+        *verified = (audio_data != NULL && !engine->damaged);
+        return audio_data;
+    }
+    
+    if (!engine->full_mode) {
+        if (audio_data && read_events == 0) {
+            *verified = true;
+            return audio_data;
+        }
+        
+        // Trouble on a fast read: verify this region from this sector on
+        cd_read_escalate(player, lsn, audio_data ? read_events : read_events + 1);
+        cdio_paranoia_seek(player->paranoia, lsn, SEEK_SET);
+        audio_data = cd_paranoia_read_timed(player);
+    }
+    
+    engine->current.end_lsn = lsn;
+    if (!audio_data || read_events > 0) {
+        engine->current.errors += audio_data ? read_events : read_events + 1;
+        engine->clean_sectors = 0;
+    } else if (++engine->clean_sectors >= CD_READ_CLEAN_SECTORS) {
+        cd_read_relax(player);
+    }
+    
+    *verified = (audio_data != NULL && !engine->damaged);
+    return audio_data;
+}
+
+int cd_set_adaptive_read(cd_player_t *player, bool enabled) {
+    cd_lock_drive(player);
+    player->read_engine.adaptive = enabled;
+    
+    if (player->paranoia) {
+        cd_read_set_mode(player, !enabled);
+    }
+    cd_unlock_drive(player);
+    
+    printf("✅ Adaptive paranoia reads %s\n", enabled ? "enabled" : "disabled");
+    return 0;
+}
+
+// Bulk reads replace paranoia only while nothing needs verifying
+bool cd_bulk_read_active(cd_player_t *player) {
+    cd_read_engine_t *engine = &player->read_engine;
+    return engine->method == CD_READ_METHOD_BULK && engine->adaptive && !engine->full_mode;
+}
+
+// Read count consecutive sectors in one ioctl into buffer (count * 2352 bytes).
+// A failed batch escalates the adaptive engine to full paranoia at lsn.
+int cd_read_sectors_bulk(cd_player_t *player, int lsn, int count, int16_t *buffer) {
+    if (!player->cdio || !player->disc_present || !player->is_audio_cd || count <= 0) {
+        return -1;
+    }
+    
+    cd_read_timer_t timer;
+    cd_read_timer_start(&timer);
+    
+    driver_return_code_t rc = cdio_read_audio_sectors(player->cdio, buffer, lsn, count);
+    
+    cd_read_timer_stop(&timer, &player->read_engine.bulk_stats, rc == DRIVER_OP_SUCCESS ? count : 0);
+    
+    if (rc != DRIVER_OP_SUCCESS) {
+        player->read_engine.events++;
+        cd_read_escalate(player, lsn, 1);
+        return -1;
+    }
+    
+    return 0;
+}
+
+// Same read for background work (loudness scans): a failed batch is only
+// reported back, the adaptive engine and its statistics are left alone
+int cd_read_sectors_background(cd_player_t *player, int lsn, int count, int16_t *buffer) {
+    if (!player->cdio || !player->disc_present || !player->is_audio_cd || count <= 0) {
+        return -1;
+    }
+    
+    return cdio_read_audio_sectors(player->cdio, buffer, lsn, count) == DRIVER_OP_SUCCESS ? 0 : -1;
+}
+
+int cd_set_read_method(cd_player_t *player, cd_read_method_t method, int bulk_sectors) {
+    if (bulk_sectors < CD_BULK_MIN_SECTORS) {
+        bulk_sectors = CD_BULK_MIN_SECTORS;
+    } else if (bulk_sectors > CD_BULK_MAX_SECTORS) {
+        bulk_sectors = CD_BULK_MAX_SECTORS;
+    }
+    
+    player->read_engine.method = method;
+    player->read_engine.bulk_sectors = bulk_sectors;
+    
+    if (method == CD_READ_METHOD_BULK) {
+        printf("✅ Bulk reads enabled (%d sectors per read when not verifying)\n", bulk_sectors);
+    } else {
+        printf("✅ Paranoia reads enabled\n");
+    }
+    return 0;
+}
+
+static void cd_print_throughput(const char *name, const cd_read_throughput_t *stats) {
+    if (stats->sectors == 0 || stats->wall_seconds <= 0) {
+        printf("📊 %-8s: no reads\n", name);
+        return;
+    }
+    
+    double rate = stats->sectors / stats->wall_seconds;
+    printf("📊 %-8s: %lu sectors in %lu calls, %.1f sectors/s (%.1fx), CPU %.1f%% of wall, %.1f us CPU/sector\n",
+           name, stats->sectors, stats->calls, rate, rate / CD_SECTORS_PER_SECOND,
+           100.0 * stats->cpu_seconds / stats->wall_seconds,
+           1e6 * stats->cpu_seconds / stats->sectors);
+}
+
+void cd_report_read_throughput(cd_player_t *player) {
+    cd_print_throughput("paranoia", &player->read_engine.paranoia_stats);
+    cd_print_throughput("bulk", &player->read_engine.bulk_stats);
+}
+
+// Read the same range with both methods and report throughput and CPU cost.
+// Caller holds drive_lock, with the playback reader parked.
+int cd_benchmark_read(cd_player_t *player, int lsn, int count) {
+    if (!player->paranoia || !player->disc_present || !player->is_audio_cd || count <= 0) {
+        return -1;
+    }
+    
+    cd_read_engine_t *engine = &player->read_engine;
+    cd_read_throughput_t saved_paranoia = engine->paranoia_stats;
+    cd_read_throughput_t saved_bulk = engine->bulk_stats;
+    memset(&engine->paranoia_stats, 0, sizeof(engine->paranoia_stats));
+    memset(&engine->bulk_stats, 0, sizeof(engine->bulk_stats));
+    
+    printf("⏱️  Benchmarking %d sectors from LSN %d\n", count, lsn);
+    
+    // Paranoia path, in the mode the engine would use for clean reads
+    cdio_paranoia_seek(player->paranoia, lsn, SEEK_SET);
+    for (int i = 0; i < count; i++) {
+        if (!cd_paranoia_read_timed(player)) {
+            break;
+        }
+    }
+    
+    // Bulk path
+    int16_t *buffer = malloc((size_t)engine->bulk_sectors * CDIO_CD_FRAMESIZE_RAW);
+    if (buffer) {
+        for (int done = 0; done < count; ) {
+            int n = count - done < engine->bulk_sectors ? count - done : engine->bulk_sectors;
+            cd_read_timer_t timer;
+            cd_read_timer_start(&timer);
+            driver_return_code_t rc = cdio_read_audio_sectors(player->cdio, buffer, lsn + done, n);
+            cd_read_timer_stop(&timer, &engine->bulk_stats, rc == DRIVER_OP_SUCCESS ? n : 0);
+            if (rc != DRIVER_OP_SUCCESS) {
+                break;
+            }
+            done += n;
+        }
+        free(buffer);
+    }
+    
+    cd_report_read_throughput(player);
+    
+    engine->paranoia_stats = saved_paranoia;
+    engine->bulk_stats = saved_bulk;
+    return 0;
+}
+
 int cd_eject(cd_player_t *player) {
     printf("⏏️  Ejecting CD...\n");
     
@@ -203,6 +574,8 @@ int cd_eject(cd_player_t *player) {
         return -1;
     }
     
+    // Not in the middle of a read, and nobody reads after the handle is gone
+    cd_lock_drive(player);
     int result = ioctl(fd, CDROMEJECT);
     close(fd);
     
@@ -220,6 +593,7 @@ int cd_eject(cd_player_t *player) {
     } else {
         printf("❌ Failed to eject CD\n");
     }
+    cd_unlock_drive(player);
     
     return result;
 }
@@ -261,6 +635,28 @@ int cd_get_track_position(cd_player_t *player, int track) {
     return cdio_get_track_lsn(player->cdio, track);
 }
 
+// First and last LSN of a track (inclusive)
+int cd_get_track_bounds(cd_player_t *player, int track, int *start_lsn, int *end_lsn) {
+    int start = cd_get_track_position(player, track);
+    if (start < 0) {
+        return -1;
+    }
+    
+    lsn_t end = cdio_get_track_last_lsn(player->cdio, track);
+    if (end == CDIO_INVALID_LSN) {
+        return -1;
+    }
+    
+    *start_lsn = start;
+    *end_lsn = end;
+    return 0;
+}
+
+// Whether the track was mastered with pre-emphasis (read when a new disc is detected)
+bool cd_track_preemphasis(cd_player_t *player, int track) {
+    return track >= 1 && track <= CDIO_CD_MAX_TRACKS && player->preemphasis[track];
+}
+
 void cd_cleanup(cd_player_t *player) {
     printf("🧹 Cleaning up CD player...\n");
     
@@ -274,6 +670,7 @@ void cd_cleanup(cd_player_t *player) {
         player->cdio = NULL;
     }
     
+    pthread_mutex_destroy(&player->drive_lock);
     memset(player, 0, sizeof(cd_player_t));
     printf("✅ CD player cleanup completed\n");
 }
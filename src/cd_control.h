@@ -2,22 +2,87 @@
 #define CD_CONTROL_H
 
 #include <stdbool.h>
+#include <pthread.h>
 #include <cdio/cdio.h>
 #include <cdio/cd_types.h>
 #include <cdio/paranoia/paranoia.h>
 
+// CD-DA geometry: 2352-byte sectors of 16-bit stereo at 44.1 kHz
+#define CD_SECTORS_PER_SECOND 75
+#define CD_FRAMES_PER_SECTOR (CDIO_CD_FRAMESIZE_RAW / 4)
+#define CD_SAMPLES_PER_SECTOR (CDIO_CD_FRAMESIZE_RAW / 2)
+
+// Adaptive read engine: overlap-only reads until paranoia reports trouble,
+// full verification for the affected region, back to fast after a clean stretch
+#define CD_READ_ADAPTIVE_DEFAULT true
+#define CD_READ_FAST_MODE PARANOIA_MODE_OVERLAP
+#define CD_READ_CLEAN_SECTORS (5 * CD_SECTORS_PER_SECOND)
+#define CD_READ_MAX_REGIONS 8
+
+// Bulk reads: cdio_read_audio_sectors batches used while verification is off
+#define CD_BULK_MIN_SECTORS 16
+#define CD_BULK_MAX_SECTORS 75
+#define CD_BULK_DEFAULT_SECTORS 32
+
+typedef enum {
+    CD_READ_METHOD_PARANOIA = 0,  // Sector-at-a-time paranoia reads
+    CD_READ_METHOD_BULK           // Multi-sector ioctl when not verifying
+} cd_read_method_t;
+
+typedef struct {
+    unsigned long sectors;
+    unsigned long calls;
+    double wall_seconds;
+    double cpu_seconds;
+} cd_read_throughput_t;
+
+typedef struct {
+    int start_lsn;
+    int end_lsn;
+    int errors;                  // Paranoia events while verifying this region
+} cd_read_region_t;
+
+typedef struct {
+    bool adaptive;
+    bool full_mode;              // Currently verifying
+    int clean_sectors;           // Consecutive clean sectors in full mode
+    unsigned long escalations;
+    unsigned long events;        // Jitter/skip/error callbacks seen overall
+    bool damaged;                // Last read: paranoia skipped or hit a read error
+    cd_read_region_t current;    // Open full-mode region
+    cd_read_region_t regions[CD_READ_MAX_REGIONS];  // Most recent closed regions
+    int num_regions;
+    
+    cd_read_method_t method;
+    int bulk_sectors;            // Sectors per bulk ioctl
+    cd_read_throughput_t paranoia_stats;
+    cd_read_throughput_t bulk_stats;
+} cd_read_engine_t;
+
+// The drive and the disc state are shared by the CD reader thread (playback
+// and background scans) and the UI (detection, eject): both take drive_lock
+// around anything that touches cdio or paranoia or changes what disc is in
 typedef struct cd_player_t {
+    pthread_mutex_t drive_lock;
     CdIo_t *cdio;
     cdrom_paranoia_t *paranoia;  // Ensure this member exists
+    int paranoia_mode;           // Mode used for normal (verified) reads
     int num_tracks;
     int current_track;
     bool disc_present;
     bool is_audio_cd;
     char disc_title[256];
+    unsigned int disc_id;        // FreeDB-style TOC hash
+    int disc_sectors;            // Leadout LSN (total sectors on disc)
+    bool preemphasis[CDIO_CD_MAX_TRACKS + 1];  // Per track number: mastered with pre-emphasis
+    int preemphasis_tracks;
+    cd_read_engine_t read_engine;
 } cd_player_t;
 
 // Function declarations
 int cd_init(cd_player_t *player);
+void cd_lock_drive(cd_player_t *player);
+void cd_unlock_drive(cd_player_t *player);
 int cd_detect_disc(cd_player_t *player);
 int cd_get_track_info(cd_player_t *player, int track, int *length);
 int cd_get_disc_info(cd_player_t *player);
@@ -25,6 +90,16 @@ int cd_read_audio_sector(cd_player_t *player, int track, int sector, int16_t *bu
 int cd_eject(cd_player_t *player);
 int cd_close_tray(cd_player_t *player);
 int cd_get_track_position(cd_player_t *player, int track);
+int cd_get_track_bounds(cd_player_t *player, int track, int *start_lsn, int *end_lsn);
+bool cd_track_preemphasis(cd_player_t *player, int track);
+int16_t *cd_read_sector(cd_player_t *player, int lsn, bool *verified);
+int cd_set_adaptive_read(cd_player_t *player, bool enabled);
+bool cd_bulk_read_active(cd_player_t *player);
+int cd_read_sectors_bulk(cd_player_t *player, int lsn, int count, int16_t *buffer);
+int cd_read_sectors_background(cd_player_t *player, int lsn, int count, int16_t *buffer);
+int cd_set_read_method(cd_player_t *player, cd_read_method_t method, int bulk_sectors);
+void cd_report_read_throughput(cd_player_t *player);
+int cd_benchmark_read(cd_player_t *player, int lsn, int count);
 void cd_cleanup(cd_player_t *player);
 
 #endif
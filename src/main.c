@@ -10,6 +10,7 @@
 #include "button_input.h"
 #include "bluetooth_manager.h"
 #include "menu_system.h"
+#include "assets.h"
 
 static volatile bool running = true;
 static menu_system_t menu;
@@ -80,6 +81,10 @@ int main() {
         printf("Warning: No audio device available - continuing without audio\n");
     }
     
+    // Sounds are built in; overrides are converted once so playing one costs no I/O
+    assets_init();
+    assets_load_sound_bank(true);
+    
     // Initialize buttons with WiringPi pin numbers
     if (button_init(&button_manager, 2, 5, 8) != 0) {
         printf("Warning: Button initialization failed - continuing without buttons\n");
@@ -109,6 +114,13 @@ int main() {
     
     printf("CD Player ready!\n");
     
+    // Refresh the playback screen from the engine's state snapshot
+    pthread_t timer_thread;
+    bool timer_started = false;
+    if (lcd.i2c_fd >= 0 && pthread_create(&timer_thread, NULL, playback_timer_thread, &menu) == 0) {
+        timer_started = true;
+    }
+    
     // Main event loop with null pointer checks
     while (running) {
         // Only poll buttons if they were initialized successfully
@@ -122,6 +134,11 @@ int main() {
         usleep(50000); // 50ms delay
     }
     
+    running = false;
+    if (timer_started) {
+        pthread_join(timer_thread, NULL);
+    }
+    
 cleanup:
     // Cleanup with proper checks
     if (button_manager.play_pin >= 0) {
@@ -130,10 +147,11 @@ cleanup:
     if (bluetooth_manager.connection != NULL) {
         bluetooth_cleanup(&bluetooth_manager);
     }
-    if (audio_player.pcm_handle != NULL) {
+    if (audio_player.output.handle != NULL) {
         audio_cleanup(&audio_player);
     }
     cd_cleanup(&cd_player);
+    assets_free_sound_bank();
     if (lcd.i2c_fd >= 0) {
         lcd_cleanup(&lcd);
     }
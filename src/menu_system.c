@@ -16,6 +16,12 @@ static const char* main_menu_items[] = {
 static const char* audio_output_items[] = {
     "Select Device",
     "Refresh List",
+    "Latency",
+    "Resampler",
+    "CD Reads",
+    "Volume",
+    "Normalize",
+    "Crossfade",
     "Back"
 };
 
@@ -27,10 +33,12 @@ static const char* bluetooth_items[] = {
 };
 
 static void scan_bluetooth_audio_devices(menu_system_t *menu);
+static void menu_sync_current_track(menu_system_t *menu);
 
 int menu_init(menu_system_t *menu, lcd_t *lcd, cd_player_t *cd_player, 
               audio_player_t *audio_player, bluetooth_manager_t *bluetooth_manager) {
     memset(menu, 0, sizeof(menu_system_t));
+    pthread_mutex_init(&menu->lock, NULL);
     
     menu->lcd = lcd;
     menu->cd_player = cd_player;
@@ -231,6 +239,15 @@ static void menu_display_playback(menu_system_t *menu) {
             
             if (menu->playback_state == PLAYBACK_PAUSED) {
                 strcat(line2, " ||");
+            } else {
+                audio_snapshot_t snapshot;
+                if (audio_get_snapshot(menu->audio_player, &snapshot) == 0) {
+                    if (snapshot.scan_direction != 0) {
+                        strcat(line2, snapshot.scan_direction > 0 ? " >>" : " <<");
+                    } else if (snapshot.crossfading) {
+                        strcat(line2, " X");
+                    }
+                }
             }
         } else {
             strcpy(line2, "00:00/00:00");
@@ -248,7 +265,30 @@ static void menu_display_audio_output(menu_system_t *menu) {
     lcd_print(menu->lcd, 0, 0, "Audio Output");
     
     char line2[32];
-    snprintf(line2, sizeof(line2), ">%s", audio_output_items[menu->menu_selection]);
+    if (menu->menu_selection == 2) {
+        snprintf(line2, sizeof(line2), ">Lat: %s",
+                 pcm_latency_params(audio_get_latency_profile(menu->audio_player))->label);
+    } else if (menu->menu_selection == 3) {
+        snprintf(line2, sizeof(line2), ">SRC: %s",
+                 audio_resampler_params(audio_get_resampler_quality(menu->audio_player))->label);
+    } else if (menu->menu_selection == 4) {
+        snprintf(line2, sizeof(line2), ">Read: %s",
+                 audio_get_read_method(menu->audio_player) == CD_READ_METHOD_BULK ? "Bulk" : "Paranoia");
+    } else if (menu->menu_selection == 5) {
+        snprintf(line2, sizeof(line2), ">Vol: %.0f dB", audio_get_volume(menu->audio_player));
+    } else if (menu->menu_selection == 6) {
+        snprintf(line2, sizeof(line2), ">Norm: %s",
+                 audio_loudness_mode_name(audio_get_normalization(menu->audio_player)));
+    } else if (menu->menu_selection == 7) {
+        int seconds = audio_get_crossfade(menu->audio_player);
+        if (seconds > 0) {
+            snprintf(line2, sizeof(line2), ">Xfade: %d s", seconds);
+        } else {
+            snprintf(line2, sizeof(line2), ">Xfade: off");
+        }
+    } else {
+        snprintf(line2, sizeof(line2), ">%s", audio_output_items[menu->menu_selection]);
+    }
     lcd_print(menu->lcd, 1, 0, line2);
 }
 
@@ -391,11 +431,24 @@ static void menu_handle_bt_device_list(menu_system_t *menu, button_event_t event
 
 static void menu_display_cd_info(menu_system_t *menu) {
     lcd_clear(menu->lcd);
-    lcd_print(menu->lcd, 0, 0, "CD Info");
+    
+    // Discs with pre-emphasis: how many tracks, and whether the filter runs now
+    char line1[32];
+    int emphasized = menu->cd_player->is_audio_cd ? menu->cd_player->preemphasis_tracks : 0;
+    if (emphasized > 0) {
+        snprintf(line1, sizeof(line1), "CD Info %d emph", emphasized);
+    } else {
+        strcpy(line1, "CD Info");
+    }
+    lcd_print(menu->lcd, 0, 0, line1);
     
     char line2[32];
     if (menu->cd_player->disc_present) {
-        if (menu->cd_player->is_audio_cd) {
+        if (menu->cd_player->is_audio_cd && emphasized > 0) {
+            audio_snapshot_t snapshot;
+            bool active = (audio_get_snapshot(menu->audio_player, &snapshot) == 0 && snapshot.deemphasis);
+            snprintf(line2, sizeof(line2), "%dtrk Deemph:%s", menu->cd_player->num_tracks, active ? "on" : "off");
+        } else if (menu->cd_player->is_audio_cd) {
             snprintf(line2, sizeof(line2), "%d audio tracks", menu->cd_player->num_tracks);
         } else {
             strcpy(line2, "Not audio CD");
@@ -482,7 +535,7 @@ static void menu_handle_main_menu(menu_system_t *menu, button_event_t event) {
                 case 1: // Audio Output
                     menu->current_menu = MENU_AUDIO_OUTPUT;
                     menu->menu_selection = 0;
-                    menu->max_selections = 3;
+                    menu->max_selections = 9;
                     menu_update_display(menu);
                     break;
                 case 2: // Bluetooth
@@ -548,7 +601,76 @@ static void menu_handle_audio_output(menu_system_t *menu, button_event_t event)
                     usleep(1000000); // Show message for 1 second
                     menu_update_display(menu);
                     break;
-                case 2: // Back
+                case 2: { // Latency: cycle profiles for the current device
+                    pcm_latency_profile_t profile =
+                        (audio_get_latency_profile(menu->audio_player) + 1) % PCM_LATENCY_COUNT;
+                    
+                    // The device is reopened under the running stream
+                    if (audio_set_latency_profile(menu->audio_player, profile) == 0) {
+                        menu->output_change = MENU_OUTPUT_SETTING;
+                    } else {
+                        lcd_print(menu->lcd, 1, 0, "Failed");
+                        usleep(1000000);
+                    }
+                    menu_update_display(menu);
+                    break;
+                }
+                case 3: { // Resampler: cycle filter quality
+                    audio_resampler_quality_t quality =
+                        (audio_get_resampler_quality(menu->audio_player) + 1) % AUDIO_RESAMPLER_QUALITY_COUNT;
+                    
+                    if (audio_set_resampler_quality(menu->audio_player, quality) == 0) {
+                        menu->output_change = MENU_OUTPUT_SETTING;
+                    } else {
+                        lcd_print(menu->lcd, 1, 0, "Failed");
+                        usleep(1000000);
+                    }
+                    menu_update_display(menu);
+                    break;
+                }
+                case 4: { // CD Reads: toggle bulk reads for clean stretches
+                    cd_read_method_t method = audio_get_read_method(menu->audio_player) == CD_READ_METHOD_BULK ?
+                                              CD_READ_METHOD_PARANOIA : CD_READ_METHOD_BULK;
+                    audio_set_read_method(menu->audio_player, method);
+                    menu_update_display(menu);
+                    break;
+                }
+                case 5: { // Volume: step down, stopping at the floor
+                    double current = audio_get_volume(menu->audio_player);
+                    double volume = current - MENU_VOLUME_STEP_DB;
+                    if (volume < MENU_VOLUME_FLOOR_DB) {
+                        volume = current < MENU_VOLUME_FLOOR_DB ? current : MENU_VOLUME_FLOOR_DB;
+                    }
+                    audio_set_volume(menu->audio_player, volume);
+                    menu_update_display(menu);
+                    break;
+                }
+                case 6: { // Normalize: cycle off, track, album
+                    audio_loudness_mode_t mode =
+                        (audio_get_normalization(menu->audio_player) + 1) % AUDIO_LOUDNESS_MODE_COUNT;
+                    audio_set_normalization(menu->audio_player, mode);
+                    menu_update_display(menu);
+                    break;
+                }
+                case 7: { // Crossfade: lengthen a step, wrapping to gapless
+                    int seconds = audio_get_crossfade(menu->audio_player) + MENU_CROSSFADE_STEP_SECONDS;
+                    if (seconds > AUDIO_CROSSFADE_MAX_SECONDS) {
+                        seconds = 0;
+                    }
+                    audio_set_crossfade(menu->audio_player, seconds);
+                    
+                    // The ring grows at the next track start; until then
+                    // a fade only gets what the current ring holds
+                    int filled, capacity;
+                    if (seconds > 0 && audio_get_ring_fill(menu->audio_player, &filled, &capacity) == 0 &&
+                        capacity - CD_SECTORS_PER_SECOND < seconds * CD_SECTORS_PER_SECOND) {
+                        lcd_print(menu->lcd, 1, 0, "1st fade shorter");
+                        usleep(1000000);
+                    }
+                    menu_update_display(menu);
+                    break;
+                }
+                case 8: // Back
                     printf("🔙 Returning to main menu\n");
                     menu->current_menu = MENU_MAIN;
                     menu->menu_selection = 0;
@@ -558,6 +680,31 @@ static void menu_handle_audio_output(menu_system_t *menu, button_event_t event)
             }
             break;
             
+        case BUTTON_NEXT_HOLD:
+            // Hold NEXT on Volume to turn it up a step
+            if (menu->menu_selection == 5) {
+                double volume = audio_get_volume(menu->audio_player);
+                if (volume < MENU_VOLUME_CEILING_DB) {
+                    volume += MENU_VOLUME_STEP_DB;
+                    audio_set_volume(menu->audio_player,
+                                     volume > MENU_VOLUME_CEILING_DB ? MENU_VOLUME_CEILING_DB : volume);
+                }
+                menu_update_display(menu);
+            }
+    
+            // Hold NEXT on CD Reads to time both read methods on this disc
+            if (menu->menu_selection == 4) {
+                lcd_print(menu->lcd, 1, 0, "Testing reads...");
+                if (audio_benchmark_read(menu->audio_player) == 0) {
+                    lcd_print(menu->lcd, 1, 0, "Done, see log");
+                } else {
+                    lcd_print(menu->lcd, 1, 0, "Read test failed");
+                }
+                usleep(2000000);
+                menu_update_display(menu);
+            }
+            break;
+            
         case BUTTON_NONE:
             break;
             
@@ -599,55 +746,55 @@ static void menu_handle_audio_device_list(menu_system_t *menu, button_event_t ev
                         }
                     }
                     
-                    // Stop current playback if active
-                    bool was_playing = (menu->playback_state == PLAYBACK_PLAYING);
-                    int current_track = menu->current_track;
-                    
-                    if (was_playing) {
-                        printf("⏹️ Stopping current playback for device switch\n");
-                        audio_stop(menu->audio_player);
-                        menu->playback_state = PLAYBACK_STOPPED;
-                    }
-                    
-                    // Switch audio device
+                    // Playback carries on across the switch: the engine moves
+                    // the stream to the new device where it was heard. Opening
+                    // it can take a while, menu_check_output reports the result
                     if (audio_set_device(menu->audio_player, device->device_id) == 0) {
-                        strcpy(menu->current_audio_device, device->device_id);
-                        menu->use_bluetooth = device->is_bluetooth;
-                        
-                        // Ensure CD player reference is maintained
-                        audio_set_cd_player(menu->audio_player, menu->cd_player);
-                        
-                        printf("✅ Audio device switched to: %s\n", device->device_id);
-                        lcd_print(menu->lcd, 1, 0, "Device Selected");
-                        
-                        // If we were playing, restart on new device
-                        if (was_playing) {
-                            printf("🔄 Restarting playback on new device...\n");
-                            usleep(2000000); // 2 second delay for device stabilization
-                            
-                            if (audio_play_track(menu->audio_player, current_track) == 0) {
-                                menu->playback_state = PLAYBACK_PLAYING;
-                                printf("✅ Playback resumed on %s\n", device->name);
-                            } else {
-                                printf("❌ Failed to restart playback on new device\n");
-                            }
-                        }
+                        snprintf(menu->pending_audio_device, sizeof(menu->pending_audio_device),
+                                 "%s", device->device_id);
+                        menu->pending_bluetooth = device->is_bluetooth;
+                        menu->output_change = MENU_OUTPUT_SWITCH;
+                        lcd_print(menu->lcd, 1, 0, "Switching...");
                     } else {
                         lcd_print(menu->lcd, 1, 0, "Switch Failed");
                         printf("❌ Failed to switch to audio device: %s\n", device->device_id);
+                        usleep(2000000); // Show message for 2 seconds
+                        menu_update_display(menu);
                     }
-                    
-                    usleep(2000000); // Show message for 2 seconds
-                    
-                    // Return to audio output menu
-                    menu->current_menu = MENU_AUDIO_OUTPUT;
-                    menu->menu_selection = 0;
-                    menu->max_selections = 3;
-                    menu_update_display(menu);
                 }
             }
             break;
             
+        case BUTTON_NEXT_HOLD:
+        case BUTTON_PREV_HOLD:
+            // Hold NEXT to play on this device as well, hold PREV to stop it
+            if (menu->num_audio_devices > 0 && menu->menu_selection < menu->num_audio_devices) {
+                audio_device_info_t *device = &menu->audio_devices[menu->menu_selection];
+                bool add = (event == BUTTON_NEXT_HOLD);
+    
+                if (add && (!device->is_available ||
+                            strcmp(device->device_id, menu->current_audio_device) == 0)) {
+                    break;
+                }
+                if (add && device->is_bluetooth && bluetooth_check_bluealsa_health() != 0) {
+                    lcd_print(menu->lcd, 1, 0, "BT Service Error");
+                    printf("❌ BlueALSA service unhealthy, cannot use Bluetooth audio\n");
+                } else if ((add ? audio_add_sink(menu->audio_player, device->device_id)
+                                : audio_remove_sink(menu->audio_player, device->device_id)) == 0) {
+                    snprintf(menu->pending_audio_device, sizeof(menu->pending_audio_device),
+                             "%s", device->device_id);
+                    menu->output_change = add ? MENU_OUTPUT_ADD_SINK : MENU_OUTPUT_REMOVE_SINK;
+                    lcd_print(menu->lcd, 1, 0, add ? "Adding..." : "Removing...");
+                    break;
+                } else {
+                    lcd_print(menu->lcd, 1, 0, "Failed");
+                }
+    
+                usleep(1000000);
+                menu_update_display(menu);
+            }
+            break;
+    
         case BUTTON_NONE:
             break;
             
@@ -754,7 +901,26 @@ static void menu_handle_bluetooth(menu_system_t *menu, button_event_t event) {
     }
 }
 
+// The playback engine advances tracks on its own (gapless, end of disc).
+// Follow it once it has applied everything we asked for.
+static void menu_sync_current_track(menu_system_t *menu) {
+    audio_snapshot_t snapshot;
+    if (menu->playback_state == PLAYBACK_STOPPED ||
+        audio_get_snapshot(menu->audio_player, &snapshot) != 0 || snapshot.pending) {
+        return;
+    }
+    
+    if (snapshot.track > 0) {
+        menu->current_track = snapshot.track;
+    }
+    if (snapshot.state == AUDIO_STATE_STOPPED) {
+        menu->playback_state = PLAYBACK_STOPPED;
+    }
+}
+
 static void menu_handle_playback(menu_system_t *menu, button_event_t event) {
+    menu_sync_current_track(menu);
+    
     switch (event) {
         case BUTTON_PLAY_PAUSE:
             if (menu->playback_state == PLAYBACK_PLAYING) {
@@ -773,7 +939,12 @@ static void menu_handle_playback(menu_system_t *menu, button_event_t event) {
         case BUTTON_PREV:
             if (menu->current_track > 1) {
                 menu->current_track--;
-                audio_play_track(menu->audio_player, menu->current_track);
+                if (menu->playback_state == PLAYBACK_STOPPED) {
+                    audio_play_track(menu->audio_player, menu->current_track);
+                } else {
+                    audio_prev(menu->audio_player);
+                }
+                menu->playback_state = PLAYBACK_PLAYING;
                 menu->elapsed_time = 0;
                 menu_update_display(menu);
             }
@@ -782,22 +953,109 @@ static void menu_handle_playback(menu_system_t *menu, button_event_t event) {
         case BUTTON_NEXT:
             if (menu->current_track < menu->cd_player->num_tracks) {
                 menu->current_track++;
-                audio_play_track(menu->audio_player, menu->current_track);
+                if (menu->playback_state == PLAYBACK_STOPPED) {
+                    audio_play_track(menu->audio_player, menu->current_track);
+                } else {
+                    audio_next(menu->audio_player);
+                }
+                menu->playback_state = PLAYBACK_PLAYING;
                 menu->elapsed_time = 0;
                 menu_update_display(menu);
             }
             break;
             
+        case BUTTON_PREV_HOLD:
+        case BUTTON_NEXT_HOLD:
+            // Fast scan while the button stays down
+            if (menu->playback_state == PLAYBACK_PLAYING) {
+                audio_scan(menu->audio_player, event == BUTTON_NEXT_HOLD ? 1 : -1);
+                menu_update_display(menu);
+            }
+            break;
+            
+        case BUTTON_HOLD_RELEASE:
+            audio_scan(menu->audio_player, 0);
+            menu_update_display(menu);
+            break;
+            
         default:
             break;
     }
 }
 
+// Report an output change once the engine has applied everything posted.
+// Called from the playback timer with menu->lock held.
+static void menu_check_output(menu_system_t *menu) {
+    audio_snapshot_t snapshot;
+    if (menu->output_change == MENU_OUTPUT_NONE ||
+        audio_get_snapshot(menu->audio_player, &snapshot) != 0 ||
+        snapshot.output_state == AUDIO_OUTPUT_CHANGING) {
+        return;
+    }
+    
+    menu_output_change_t change = menu->output_change;
+    bool ok = (snapshot.output_state == AUDIO_OUTPUT_READY);
+    bool shown = (menu->current_menu == MENU_AUDIO_DEVICE_LIST);
+    menu->output_change = MENU_OUTPUT_NONE;
+    
+    switch (change) {
+        case MENU_OUTPUT_SWITCH:
+            // A later command may have failed after the switch itself worked
+            if (strcmp(snapshot.device, menu->pending_audio_device) == 0) {
+                strcpy(menu->current_audio_device, menu->pending_audio_device);
+                menu->use_bluetooth = menu->pending_bluetooth;
+                printf("✅ Audio device switched to: %s\n", menu->pending_audio_device);
+                ok = true;
+            } else {
+                printf("❌ Failed to switch to audio device: %s\n", menu->pending_audio_device);
+                ok = false;
+            }
+            if (shown) {
+                lcd_print(menu->lcd, 1, 0, ok ? "Device Selected" : "Switch Failed");
+                usleep(2000000); // Show message for 2 seconds
+                
+                // Return to audio output menu
+                menu->current_menu = MENU_AUDIO_OUTPUT;
+                menu->menu_selection = 0;
+                menu->max_selections = 9;
+            }
+            break;
+        case MENU_OUTPUT_ADD_SINK:
+        case MENU_OUTPUT_REMOVE_SINK:
+            if (ok) {
+                printf("%s %s\n", change == MENU_OUTPUT_ADD_SINK ? "🔗 Also playing on:" : "🔗 No longer playing on:",
+                       menu->pending_audio_device);
+            }
+            if (shown) {
+                lcd_print(menu->lcd, 1, 0, !ok ? "Failed" :
+                          change == MENU_OUTPUT_ADD_SINK ? "Also Playing" : "Output Removed");
+                usleep(1000000);
+            }
+            break;
+        case MENU_OUTPUT_SETTING:
+            shown = (menu->current_menu == MENU_AUDIO_OUTPUT);
+            if (!ok && shown) {
+                lcd_print(menu->lcd, 1, 0, "Failed");
+                usleep(1000000);
+            }
+            break;
+        default:
+            break;
+    }
+    
+    // Show what the engine ended up with
+    if (shown) {
+        menu_update_display(menu);
+    }
+}
+
 void menu_handle_button(menu_system_t *menu, button_event_t event) {
     if (event == BUTTON_NONE) {
         return;
     }
     
+    pthread_mutex_lock(&menu->lock);
+    
     switch (menu->current_menu) {
         case MENU_MAIN:
             menu_handle_main_menu(menu, event);
@@ -825,15 +1083,26 @@ void menu_handle_button(menu_system_t *menu, button_event_t event) {
             menu_update_display(menu);
             break;
     }
+    
+    pthread_mutex_unlock(&menu->lock);
 }
 
+// Called from the timer thread; reads the engine snapshot, never blocks on audio
 void menu_update_playback_info(menu_system_t *menu) {
-    if (menu->playback_state == PLAYBACK_PLAYING) {
-        // Force display update even if audio thread isn't updating properly
-        if (menu->current_menu == MENU_PLAYBACK) {
-            menu_update_display(menu);
-        }
+    pthread_mutex_lock(&menu->lock);
+    
+    menu_check_output(menu);
+    
+    bool was_playing = (menu->playback_state == PLAYBACK_PLAYING);
+    menu_sync_current_track(menu);
+    
+    // Refresh while playing, and once more when playback runs out
+    if ((was_playing || menu->playback_state == PLAYBACK_PLAYING) &&
+        menu->current_menu == MENU_PLAYBACK) {
+        menu_update_display(menu);
     }
+    
+    pthread_mutex_unlock(&menu->lock);
 }
 
 void menu_cleanup(menu_system_t *menu) {
@@ -841,5 +1110,6 @@ void menu_cleanup(menu_system_t *menu) {
         audio_stop(menu->audio_player);
     }
     
+    pthread_mutex_destroy(&menu->lock);
     memset(menu, 0, sizeof(menu_system_t));
 }
@@ -2,6 +2,7 @@
 #define MENU_SYSTEM_H
 
 #include <stdbool.h>
+#include <pthread.h>
 #include "lcd_display.h"
 #include "cd_control.h"
 #include "audio_playback.h"
@@ -11,6 +12,15 @@
 #define MAX_AUDIO_DEVICES 10
 #define MAX_BT_DEVICES 10
 
+// Volume item: each press turns down a step, no further than the floor;
+// holding NEXT turns it up a step, no further than unity gain
+#define MENU_VOLUME_STEP_DB 3.0
+#define MENU_VOLUME_FLOOR_DB -30.0
+#define MENU_VOLUME_CEILING_DB 0.0
+
+// Crossfade item: each press adds a step, past the maximum back to gapless
+#define MENU_CROSSFADE_STEP_SECONDS 2
+
 typedef enum {
     MENU_MAIN = 0,
     MENU_PLAYBACK,
@@ -27,6 +37,15 @@ typedef enum {
     PLAYBACK_PAUSED
 } playback_state_t;
 
+// Output change posted to the engine, reported once it has been applied
+typedef enum {
+    MENU_OUTPUT_NONE = 0,
+    MENU_OUTPUT_SWITCH,
+    MENU_OUTPUT_ADD_SINK,
+    MENU_OUTPUT_REMOVE_SINK,
+    MENU_OUTPUT_SETTING            // Latency or resampler
+} menu_output_change_t;
+
 typedef struct {
     char name[256];
     char device_id[64];
@@ -54,6 +73,12 @@ typedef struct {
     bool use_bluetooth;
     char current_audio_device[64];
     
+    // Device switches don't wait for the engine; the menu picks up the
+    // outcome from the snapshot
+    menu_output_change_t output_change;
+    char pending_audio_device[64];
+    bool pending_bluetooth;
+    
     // Audio device management
     audio_device_info_t audio_devices[MAX_AUDIO_DEVICES];
     int num_audio_devices;
@@ -65,6 +90,9 @@ typedef struct {
     int selected_bt_device;
     bool bt_scanning;
     
+    // Button handling (main loop) and the playback timer share the menu
+    pthread_mutex_t lock;
+    
     // Component references
     lcd_t *lcd;
     cd_player_t *cd_player;
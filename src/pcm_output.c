@@ -0,0 +1,724 @@
+#include "pcm_output.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <sys/stat.h>
+
+// Poll timeout while waiting for room in the device buffer
+#define PCM_OUTPUT_WAIT_MS 100
+
+static uint64_t pcm_output_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Device formats in order of preference (the stream's own first), tried at
+// each rate in turn: the stream rate in any format beats resampling
+static const snd_pcm_format_t output_formats[] = {
+    SND_PCM_FORMAT_S16_LE, SND_PCM_FORMAT_S32_LE, SND_PCM_FORMAT_S24_LE, SND_PCM_FORMAT_S24_3LE
+};
+static const unsigned int output_rates[] = { PCM_OUTPUT_RATE, 48000, 96000 };
+
+static const pcm_latency_params_t latency_profiles[PCM_LATENCY_COUNT] = {
+    [PCM_LATENCY_LOW]      = { "low",      "Low",       20000,   5000, 1, 1 },
+    [PCM_LATENCY_BALANCED] = { "balanced", "Balanced", 100000,  25000, 2, 1 },
+    [PCM_LATENCY_ROBUST]   = { "robust",   "Robust BT", 500000, 100000, 4, 1 },
+};
+
+const pcm_latency_params_t *pcm_latency_params(pcm_latency_profile_t profile) {
+    if (profile < 0 || profile >= PCM_LATENCY_COUNT) {
+        profile = PCM_LATENCY_BALANCED;
+    }
+    return &latency_profiles[profile];
+}
+
+// Bluetooth links need the long buffer; everything else starts balanced
+pcm_latency_profile_t pcm_latency_default(const char *device_id) {
+    if (device_id && strstr(device_id, "bluealsa") != NULL) {
+        return PCM_LATENCY_ROBUST;
+    }
+    return PCM_LATENCY_BALANCED;
+}
+
+// Profile saved for this device, or its default when none was chosen
+pcm_latency_profile_t pcm_latency_load(const char *device_id) {
+    pcm_latency_profile_t profile = pcm_latency_default(device_id);
+    if (!device_id) {
+        return profile;
+    }
+    
+    FILE *file = fopen(PCM_LATENCY_PROFILE_FILE, "r");
+    if (!file) {
+        return profile;
+    }
+    
+    char line[256];
+    char id[128];
+    char name[32];
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "%127s %31s", id, name) != 2 || strcmp(id, device_id) != 0) {
+            continue;
+        }
+        for (int i = 0; i < PCM_LATENCY_COUNT; i++) {
+            if (strcmp(name, latency_profiles[i].name) == 0) {
+                profile = (pcm_latency_profile_t)i;
+            }
+        }
+    }
+    
+    fclose(file);
+    return profile;
+}
+
+// Rewrite the profile file with this device's entry replaced
+int pcm_latency_save(const char *device_id, pcm_latency_profile_t profile) {
+    if (!device_id || profile < 0 || profile >= PCM_LATENCY_COUNT) {
+        return -1;
+    }
+    
+    char tmp_path[sizeof(PCM_LATENCY_PROFILE_FILE) + 4];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", PCM_LATENCY_PROFILE_FILE);
+    
+    mkdir(CDPLAYER_CONFIG_DIR, 0755);
+    FILE *out = fopen(tmp_path, "w");
+    if (!out) {
+        printf("⚠️  Cannot save latency profile: %s\n", strerror(errno));
+        return -1;
+    }
+    
+    FILE *in = fopen(PCM_LATENCY_PROFILE_FILE, "r");
+    if (in) {
+        char line[256];
+        char id[128];
+        while (fgets(line, sizeof(line), in)) {
+            if (sscanf(line, "%127s", id) == 1 && strcmp(id, device_id) == 0) {
+                continue;
+            }
+            fputs(line, out);
+        }
+        fclose(in);
+    }
+    
+    fprintf(out, "%s %s\n", device_id, latency_profiles[profile].name);
+    fclose(out);
+    
+    if (rename(tmp_path, PCM_LATENCY_PROFILE_FILE) != 0) {
+        printf("⚠️  Cannot save latency profile: %s\n", strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+// Buffer/period geometry from the profile; the driver may round both
+static void pcm_output_configure_hw(pcm_output_t *out, snd_pcm_hw_params_t *hw_params) {
+    const pcm_latency_params_t *params = pcm_latency_params(out->profile);
+    
+    unsigned int buffer_us = params->buffer_us;
+    int err = snd_pcm_hw_params_set_buffer_time_near(out->handle, hw_params, &buffer_us, NULL);
+    if (err < 0) {
+        printf("⚠️  Buffer time not settable on %s: %s\n", out->device_name, snd_strerror(err));
+    }
+    
+    unsigned int period_us = params->period_us;
+    err = snd_pcm_hw_params_set_period_time_near(out->handle, hw_params, &period_us, NULL);
+    if (err < 0) {
+        printf("⚠️  Period time not settable on %s: %s\n", out->device_name, snd_strerror(err));
+    }
+}
+
+// Start and wake-up thresholds follow the negotiated period size (device frames)
+static int pcm_output_configure_sw(pcm_output_t *out, snd_pcm_uframes_t period_size) {
+    const pcm_latency_params_t *params = pcm_latency_params(out->profile);
+    snd_pcm_sw_params_t *sw_params;
+    snd_pcm_sw_params_alloca(&sw_params);
+    
+    out->start_threshold = period_size * params->start_periods;
+    if (out->start_threshold > out->device_buffer_size) {
+        out->start_threshold = out->device_buffer_size;
+    }
+    out->avail_min = period_size * params->avail_min_periods;
+    
+    int err = snd_pcm_sw_params_current(out->handle, sw_params);
+    if (err >= 0) {
+        snd_pcm_sw_params_set_start_threshold(out->handle, sw_params, out->start_threshold);
+        snd_pcm_sw_params_set_avail_min(out->handle, sw_params, out->avail_min);
+        err = snd_pcm_sw_params(out->handle, sw_params);
+    }
+    
+    if (err < 0) {
+        printf("⚠️  Software params rejected by %s: %s\n", out->device_name, snd_strerror(err));
+    }
+    return err;
+}
+
+// Device frames as stream frames
+static snd_pcm_sframes_t pcm_output_to_stream(pcm_output_t *out, snd_pcm_sframes_t frames) {
+    return (snd_pcm_sframes_t)((int64_t)frames * PCM_OUTPUT_RATE / out->rate);
+}
+
+// Settle format and rate on what the device plays natively. libasound's
+// own rate conversion is turned off so a plug device can't hide one. With
+// exact only the stream format itself will do (MMAP is zero copy).
+static int pcm_output_negotiate(pcm_output_t *out, snd_pcm_hw_params_t *hw_params, bool exact) {
+    snd_pcm_hw_params_t *trial;
+    snd_pcm_hw_params_alloca(&trial);
+    
+    snd_pcm_hw_params_set_rate_resample(out->handle, hw_params, 0);
+    
+    for (size_t r = 0; r < sizeof(output_rates) / sizeof(output_rates[0]); r++) {
+        for (size_t f = 0; f < sizeof(output_formats) / sizeof(output_formats[0]); f++) {
+            snd_pcm_hw_params_copy(trial, hw_params);
+            if (snd_pcm_hw_params_set_format(out->handle, trial, output_formats[f]) == 0 &&
+                snd_pcm_hw_params_set_rate(out->handle, trial, output_rates[r], 0) == 0) {
+                snd_pcm_hw_params_copy(hw_params, trial);
+                out->format = output_formats[f];
+                out->rate = output_rates[r];
+                return 0;
+            }
+            if (exact) {
+                return -EINVAL;
+            }
+        }
+    }
+    
+    // Nothing on the list: the nearest rate the device has, in S16
+    unsigned int rate = PCM_OUTPUT_RATE;
+    int err = snd_pcm_hw_params_set_format(out->handle, hw_params, SND_PCM_FORMAT_S16_LE);
+    if (err < 0 || (err = snd_pcm_hw_params_set_rate_near(out->handle, hw_params, &rate, 0)) < 0) {
+        return err;
+    }
+    if (rate < PCM_OUTPUT_RATE) {
+        printf("⚠️  %s only plays %u Hz, high frequencies will alias\n", out->device_name, rate);
+    }
+    out->format = SND_PCM_FORMAT_S16_LE;
+    out->rate = rate;
+    return 0;
+}
+
+static int pcm_output_configure(pcm_output_t *out, snd_pcm_access_t access) {
+    snd_pcm_hw_params_t *hw_params;
+    snd_pcm_hw_params_alloca(&hw_params);
+    
+    snd_pcm_hw_params_any(out->handle, hw_params);
+    
+    int err = snd_pcm_hw_params_set_access(out->handle, hw_params, access);
+    if (err < 0) {
+        return err;
+    }
+    
+    snd_pcm_hw_params_set_channels(out->handle, hw_params, PCM_OUTPUT_CHANNELS);
+    
+    err = pcm_output_negotiate(out, hw_params, access == SND_PCM_ACCESS_MMAP_INTERLEAVED);
+    if (err < 0) {
+        return err;
+    }
+    
+    pcm_output_configure_hw(out, hw_params);
+    
+    err = snd_pcm_hw_params(out->handle, hw_params);
+    if (err < 0) {
+        return err;
+    }
+    
+    snd_pcm_uframes_t period_size;
+    out->use_mmap = (access == SND_PCM_ACCESS_MMAP_INTERLEAVED);
+    out->convert = (out->format != SND_PCM_FORMAT_S16_LE || out->rate != PCM_OUTPUT_RATE);
+    snd_pcm_hw_params_get_buffer_size(hw_params, &out->device_buffer_size);
+    snd_pcm_hw_params_get_period_size(hw_params, &period_size, NULL);
+    out->buffer_size = pcm_output_to_stream(out, out->device_buffer_size);
+    out->period_size = pcm_output_to_stream(out, period_size);
+    
+    pcm_output_configure_sw(out, period_size);
+    return 0;
+}
+
+// Conversion path buffers, and the resampler when the rate differs
+static int pcm_output_setup_conversion(pcm_output_t *out) {
+    if (out->rate != PCM_OUTPUT_RATE) {
+        out->resampler = malloc(sizeof(audio_resampler_t));
+        if (!out->resampler ||
+            audio_resampler_init(out->resampler, (double)out->rate / PCM_OUTPUT_RATE, out->quality) != 0) {
+            return -1;
+        }
+    }
+    
+    out->resampled = malloc(PCM_OUTPUT_CONVERT_FRAMES * PCM_OUTPUT_FRAME_BYTES);
+    out->converted = malloc(snd_pcm_frames_to_bytes(out->handle, PCM_OUTPUT_CONVERT_FRAMES));
+    return (out->resampled && out->converted) ? 0 : -1;
+}
+
+// Which path the stream takes to the device
+static void pcm_output_report(pcm_output_t *out) {
+    const char *access = out->use_mmap ? "MMAP" : "RW";
+    const char *format = snd_pcm_format_name(out->format);
+    
+    if (!out->convert) {
+        printf("✅ %s plays the stream as it is: %s at %u Hz (%s access)\n",
+               out->device_name, format, out->rate, access);
+    } else if (!out->resampler) {
+        printf("✅ %s: %s at %u Hz, samples widened in-process (%s access)\n",
+               out->device_name, format, out->rate, access);
+    } else {
+        const audio_resampler_params_t *params = audio_resampler_params(out->resampler->quality);
+        printf("🔁 %s: %s at %u Hz, resampling from %d Hz in-process "
+               "(%s quality, %d taps, %s, %.1f M multiply-adds/s)\n",
+               out->device_name, format, out->rate, PCM_OUTPUT_RATE, params->name, params->taps,
+               audio_resampler_simd(), audio_resampler_cost(out->resampler, out->rate) / 1e6);
+    }
+}
+
+// BlueALSA folds the A2DP transport delay (codec + link) into
+// snd_pcm_delay(), so a prepared, empty stream reports just that. It is
+// kept as the device's share of the nominal latency for lining up outputs;
+// delay readings already include it.
+static void pcm_output_calibrate_transport(pcm_output_t *out) {
+    if (strstr(out->device_name, "bluealsa") == NULL) {
+        return;
+    }
+    
+    snd_pcm_sframes_t reported = 0;
+    if (snd_pcm_prepare(out->handle) < 0 || snd_pcm_delay(out->handle, &reported) < 0 || reported <= 0) {
+        printf("⚠️  %s reports no Bluetooth transport delay\n", out->device_name);
+        return;
+    }
+    
+    out->transport_delay = pcm_output_to_stream(out, reported);
+    printf("✅ Bluetooth transport delay %.1f ms (reported by BlueALSA)\n",
+           out->transport_delay * 1000.0 / PCM_OUTPUT_RATE);
+}
+
+int pcm_output_open(pcm_output_t *out, const char *device, bool allow_mmap,
+                    pcm_latency_profile_t profile, audio_resampler_quality_t quality) {
+    memset(out, 0, sizeof(pcm_output_t));
+    out->profile = profile;
+    out->quality = quality;
+    
+    // Store device name
+    snprintf(out->device_name, sizeof(out->device_name), "%s", device ? device : "default");
+    
+    // Non-blocking: writers sleep in pcm_output_wait, never inside ALSA
+    int err = snd_pcm_open(&out->handle, out->device_name, SND_PCM_STREAM_PLAYBACK, SND_PCM_NONBLOCK);
+    if (err < 0) {
+        fprintf(stderr, "❌ Failed to open PCM device: %s\n", snd_strerror(err));
+        out->handle = NULL;
+        return -1;
+    }
+    
+    // Zero-copy MMAP when the device or plugin supports it and plays the
+    // stream as it is, RW otherwise
+    err = allow_mmap ? pcm_output_configure(out, SND_PCM_ACCESS_MMAP_INTERLEAVED) : -EINVAL;
+    if (err < 0) {
+        if (allow_mmap) {
+            printf("⚠️  MMAP not supported by %s for the stream format, using RW access\n", out->device_name);
+        }
+        err = pcm_output_configure(out, SND_PCM_ACCESS_RW_INTERLEAVED);
+    }
+    
+    if (err < 0) {
+        fprintf(stderr, "❌ Failed to configure PCM device: %s\n", snd_strerror(err));
+        snd_pcm_close(out->handle);
+        out->handle = NULL;
+        return -1;
+    }
+    
+    if (!out->use_mmap) {
+        out->staging = malloc(PCM_OUTPUT_STAGING_FRAMES * PCM_OUTPUT_FRAME_BYTES);
+    }
+    
+    // Slot 0 is reserved for the caller's control descriptor
+    out->poll_count = snd_pcm_poll_descriptors_count(out->handle);
+    out->poll_fds = calloc(out->poll_count + 1, sizeof(struct pollfd));
+    
+    if ((!out->use_mmap && !out->staging) || out->poll_count < 0 || !out->poll_fds ||
+        (out->convert && pcm_output_setup_conversion(out) != 0)) {
+        pcm_output_close(out);
+        return -1;
+    }
+    
+    pcm_output_calibrate_transport(out);
+    
+    const pcm_latency_params_t *params = pcm_latency_params(out->profile);
+    pcm_output_report(out);
+    printf("✅ Latency profile %s: buffer %lu frames (%.1f ms), period %lu frames (%.1f ms), "
+           "start %lu, avail_min %lu (requested %.1f/%.1f ms)\n",
+           params->name,
+           (unsigned long)out->buffer_size, out->buffer_size * 1000.0 / PCM_OUTPUT_RATE,
+           (unsigned long)out->period_size, out->period_size * 1000.0 / PCM_OUTPUT_RATE,
+           (unsigned long)out->start_threshold, (unsigned long)out->avail_min,
+           params->buffer_us / 1000.0, params->period_us / 1000.0);
+    
+    out->start_pending = true;
+    out->prepared_ms = pcm_output_now_ms();
+    return 0;
+}
+
+void pcm_output_close(pcm_output_t *out) {
+    if (out->handle) {
+        snd_pcm_close(out->handle);
+        out->handle = NULL;
+    }
+    
+    free(out->staging);
+    out->staging = NULL;
+    free(out->poll_fds);
+    out->poll_fds = NULL;
+    
+    if (out->resampler) {
+        audio_resampler_free(out->resampler);
+        free(out->resampler);
+        out->resampler = NULL;
+    }
+    free(out->resampled);
+    out->resampled = NULL;
+    free(out->converted);
+    out->converted = NULL;
+}
+
+// Prepare for a fresh start: playback begins once start_threshold frames
+// are queued, not after a fixed delay
+int pcm_output_prepare(pcm_output_t *out) {
+    int err = snd_pcm_prepare(out->handle);
+    if (err < 0) {
+        return err;
+    }
+    
+    out->frames_written = 0;
+    out->start_pending = true;
+    out->started_ms = 0;
+    out->prepared_ms = pcm_output_now_ms();
+    if (out->resampler) {
+        audio_resampler_reset(out->resampler);
+    }
+    return 0;
+}
+
+// After the start, confirm the transport really drains (BlueALSA may accept
+// frames long before the link plays them) and report time-to-first-sound
+static void pcm_output_watch_start(pcm_output_t *out) {
+    if (!out->start_pending || snd_pcm_state(out->handle) != SND_PCM_STATE_RUNNING) {
+        return;
+    }
+    
+    snd_pcm_sframes_t avail = snd_pcm_avail(out->handle);
+    if (avail < 0) {
+        return;
+    }
+    
+    // Frames handed to the device minus those still queued in it
+    snd_pcm_sframes_t queued = (snd_pcm_sframes_t)out->device_buffer_size - avail;
+    uint64_t consumed = out->frames_written - (queued > 0 ? (uint64_t)queued : 0);
+    uint64_t now = pcm_output_now_ms();
+    
+    if (out->started_ms == 0) {
+        out->started_ms = now;
+        out->start_consumed = consumed;
+        printf("🔊 PCM started after %llu ms with %.1f ms queued\n",
+               (unsigned long long)(now - out->prepared_ms), queued * 1000.0 / out->rate);
+        return;
+    }
+    
+    if (consumed > out->start_consumed) {
+        out->start_pending = false;
+        printf("🔊 %s draining, first sound after %llu ms\n",
+               out->device_name, (unsigned long long)(now - out->prepared_ms));
+    } else if (now - out->started_ms > PCM_OUTPUT_START_TIMEOUT_MS) {
+        out->start_pending = false;
+        printf("⚠️  %s started but consumed nothing in %d ms\n",
+               out->device_name, PCM_OUTPUT_START_TIMEOUT_MS);
+    }
+}
+
+// Hand out up to *frames writable frames; *frames is updated to what is
+// available and is 0 when the buffer is full (wait with pcm_output_wait).
+// Never blocks. Returns a negative ALSA error after recovering from an xrun.
+int pcm_output_begin(pcm_output_t *out, int16_t **buffer, snd_pcm_uframes_t *frames) {
+    snd_pcm_sframes_t avail = snd_pcm_avail_update(out->handle);
+    if (avail < 0) {
+        printf("🔧 Recovering from ALSA error...\n");
+        snd_pcm_recover(out->handle, avail, 0);
+        return (int)avail;
+    }
+    
+    if (avail == 0) {
+        // Buffer full: a prepared stream needs an explicit start with MMAP
+        if (snd_pcm_state(out->handle) == SND_PCM_STATE_PREPARED) {
+            snd_pcm_start(out->handle);
+        }
+        *frames = 0;
+        return 0;
+    }
+    
+    // Conversion path: what fits once resampled (a frame or two over the
+    // limit only makes commit wait briefly)
+    if (out->convert) {
+        avail = pcm_output_to_stream(out, avail);
+    }
+    if (*frames > (snd_pcm_uframes_t)avail) {
+        *frames = avail;
+    }
+    
+    if (!out->use_mmap) {
+        if (*frames > PCM_OUTPUT_STAGING_FRAMES) {
+            *frames = PCM_OUTPUT_STAGING_FRAMES;
+        }
+        *buffer = out->staging;
+        return 0;
+    }
+    
+    const snd_pcm_channel_area_t *areas;
+    snd_pcm_uframes_t offset;
+    snd_pcm_uframes_t count = *frames;
+    
+    int err = snd_pcm_mmap_begin(out->handle, &areas, &offset, &count);
+    if (err < 0) {
+        printf("🔧 Recovering from ALSA error...\n");
+        snd_pcm_recover(out->handle, err, 0);
+        return err;
+    }
+    
+    // Interleaved: every channel shares one area
+    out->mmap_offset = offset;
+    *buffer = (int16_t *)((uint8_t *)areas[0].addr + areas[0].first / 8 + offset * areas[0].step / 8);
+    *frames = count;
+    return 0;
+}
+
+// Sleep until the device has room (avail_min), control_fd is readable or
+// the timeout expires. control_fd may be -1. Returns PCM_OUTPUT_EVENT_* bits.
+int pcm_output_wait(pcm_output_t *out, int control_fd, int timeout_ms) {
+    struct pollfd *fds = out->poll_fds;
+    
+    fds[0].fd = control_fd;
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+    snd_pcm_poll_descriptors(out->handle, fds + 1, out->poll_count);
+    
+    int n = poll(fds, out->poll_count + 1, timeout_ms);
+    if (n < 0) {
+        return (errno == EINTR) ? 0 : -errno;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    
+    int events = 0;
+    if (fds[0].revents & POLLIN) {
+        events |= PCM_OUTPUT_EVENT_CONTROL;
+    }
+    
+    // Errors count as ready: the next pcm_output_begin recovers them
+    unsigned short revents = 0;
+    snd_pcm_poll_descriptors_revents(out->handle, fds + 1, out->poll_count, &revents);
+    if (revents & (POLLOUT | POLLERR)) {
+        events |= PCM_OUTPUT_EVENT_DEVICE;
+    }
+    
+    return events;
+}
+
+// Block until everything queued has been played
+int pcm_output_drain(pcm_output_t *out) {
+    snd_pcm_nonblock(out->handle, 0);
+    int err = snd_pcm_drain(out->handle);
+    snd_pcm_nonblock(out->handle, 1);
+    return err;
+}
+
+// Frames queued ahead of the listener: what the device still holds,
+// transport delay included. 0 while the stream is not running or prepared.
+int pcm_output_delay(pcm_output_t *out, snd_pcm_sframes_t *delay) {
+    *delay = 0;
+    
+    snd_pcm_state_t state = snd_pcm_state(out->handle);
+    if (state != SND_PCM_STATE_RUNNING && state != SND_PCM_STATE_PREPARED &&
+        state != SND_PCM_STATE_PAUSED && state != SND_PCM_STATE_DRAINING) {
+        return 0;
+    }
+    
+    snd_pcm_sframes_t frames = 0;
+    int err = snd_pcm_delay(out->handle, &frames);
+    if (err < 0) {
+        return err;
+    }
+    
+    *delay = pcm_output_to_stream(out, frames > 0 ? frames : 0);
+    if (out->resampler) {
+        *delay += (snd_pcm_sframes_t)audio_resampler_pending(out->resampler);
+    }
+    return 0;
+}
+
+// Take back up to frames queued frames that the hardware has not fetched
+// yet, so they can be written again (or elsewhere). Returns the number
+// taken back; 0 when the device or plugin cannot rewind.
+snd_pcm_uframes_t pcm_output_rewind(pcm_output_t *out, snd_pcm_uframes_t frames) {
+    // Converted frames don't map back onto the stream
+    if (out->convert) {
+        return 0;
+    }
+    
+    snd_pcm_sframes_t rewindable = snd_pcm_rewindable(out->handle);
+    if (rewindable <= 0) {
+        return 0;
+    }
+    if (frames > (snd_pcm_uframes_t)rewindable) {
+        frames = rewindable;
+    }
+    
+    snd_pcm_sframes_t rewound = snd_pcm_rewind(out->handle, frames);
+    if (rewound <= 0) {
+        return 0;
+    }
+    
+    out->frames_written -= rewound;
+    return (snd_pcm_uframes_t)rewound;
+}
+
+// snd_pcm_writei() all of frames device frames, waiting for room
+static int pcm_output_writei(pcm_output_t *out, const void *data, snd_pcm_uframes_t frames) {
+    const uint8_t *bytes = data;
+    
+    while (frames > 0) {
+        snd_pcm_sframes_t written = snd_pcm_writei(out->handle, bytes, frames);
+        if (written == -EAGAIN) {
+            pcm_output_wait(out, -1, PCM_OUTPUT_WAIT_MS);
+            continue;
+        }
+        if (written < 0) {
+            printf("🔧 Recovering from ALSA error...\n");
+            snd_pcm_recover(out->handle, written, 0);
+            return (int)written; // Drop the rest, like the RW path always did
+        }
+        bytes += snd_pcm_frames_to_bytes(out->handle, written);
+        frames -= written;
+        out->frames_written += written;
+    }
+    return 0;
+}
+
+// Stream samples to the device's sample format, into out->converted
+static void pcm_output_widen(pcm_output_t *out, const int16_t *samples, size_t count) {
+    switch (out->format) {
+        case SND_PCM_FORMAT_S32_LE: {
+            int32_t *dst = (int32_t *)out->converted;
+            for (size_t i = 0; i < count; i++) {
+                dst[i] = (int32_t)samples[i] * 65536;
+            }
+            break;
+        }
+        case SND_PCM_FORMAT_S24_LE: {
+            int32_t *dst = (int32_t *)out->converted;
+            for (size_t i = 0; i < count; i++) {
+                dst[i] = (int32_t)samples[i] * 256;
+            }
+            break;
+        }
+        case SND_PCM_FORMAT_S24_3LE: {
+            uint8_t *dst = out->converted;
+            for (size_t i = 0; i < count; i++) {
+                uint32_t value = (uint32_t)((int32_t)samples[i] * 256);
+                dst[3 * i] = value & 0xff;
+                dst[3 * i + 1] = (value >> 8) & 0xff;
+                dst[3 * i + 2] = (value >> 16) & 0xff;
+            }
+            break;
+        }
+        default:
+            memcpy(out->converted, samples, count * sizeof(int16_t));
+            break;
+    }
+}
+
+// Conversion path: resample and widen the staged stream frames, then write
+static int pcm_output_commit_converted(pcm_output_t *out, snd_pcm_uframes_t frames) {
+    const int16_t *samples = out->staging;
+    
+    while (frames > 0) {
+        size_t used = frames < PCM_OUTPUT_CONVERT_FRAMES ? frames : PCM_OUTPUT_CONVERT_FRAMES;
+        size_t count = used;
+        const int16_t *chunk = samples;
+        if (out->resampler) {
+            used = frames;
+            count = audio_resampler_process(out->resampler, samples, &used,
+                                            out->resampled, PCM_OUTPUT_CONVERT_FRAMES);
+            chunk = out->resampled;
+        }
+    
+        pcm_output_widen(out, chunk, count * PCM_OUTPUT_CHANNELS);
+        int err = pcm_output_writei(out, out->converted, count);
+        if (err < 0) {
+            return err;
+        }
+        samples += used * PCM_OUTPUT_CHANNELS;
+        frames -= used;
+    }
+    
+    pcm_output_watch_start(out);
+    return 0;
+}
+
+// Publish frames written into the region from pcm_output_begin
+int pcm_output_commit(pcm_output_t *out, snd_pcm_uframes_t frames) {
+    if (out->convert) {
+        return pcm_output_commit_converted(out, frames);
+    }
+    
+    if (!out->use_mmap) {
+        int err = pcm_output_writei(out, out->staging, frames);
+        if (err < 0) {
+            return err;
+        }
+        pcm_output_watch_start(out);
+        return 0;
+    }
+    
+    snd_pcm_sframes_t committed = snd_pcm_mmap_commit(out->handle, out->mmap_offset, frames);
+    if (committed < 0 || (snd_pcm_uframes_t)committed != frames) {
+        printf("🔧 Recovering from ALSA error...\n");
+        snd_pcm_recover(out->handle, committed < 0 ? committed : -EPIPE, 0);
+        return committed < 0 ? (int)committed : -EPIPE;
+    }
+    out->frames_written += frames;
+    
+    // MMAP streams don't auto-start: go once start_threshold is queued
+    if (snd_pcm_state(out->handle) == SND_PCM_STATE_PREPARED) {
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(out->handle);
+        if (avail >= 0 && out->device_buffer_size - avail >= out->start_threshold) {
+            snd_pcm_start(out->handle);
+        }
+    }
+    
+    pcm_output_watch_start(out);
+    return 0;
+}
+
+// Copying write for callers that already have the samples in a buffer
+snd_pcm_sframes_t pcm_output_write(pcm_output_t *out, const int16_t *samples, snd_pcm_uframes_t frames) {
+    snd_pcm_uframes_t total = 0;
+    
+    while (total < frames) {
+        int16_t *dst;
+        snd_pcm_uframes_t count = frames - total;
+        
+        if (pcm_output_begin(out, &dst, &count) < 0) {
+            return total;
+        }
+        if (count == 0) {
+            pcm_output_wait(out, -1, PCM_OUTPUT_WAIT_MS);
+            continue;
+        }
+        
+        memcpy(dst, samples + total * PCM_OUTPUT_CHANNELS, count * PCM_OUTPUT_FRAME_BYTES);
+        
+        if (pcm_output_commit(out, count) < 0) {
+            return total;
+        }
+        total += count;
+    }
+    
+    return total;
+}
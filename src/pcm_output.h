@@ -0,0 +1,117 @@
+#ifndef PCM_OUTPUT_H
+#define PCM_OUTPUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <poll.h>
+#include <alsa/asoundlib.h>
+#include "audio_resampler.h"
+#include "assets.h"
+
+// Stream format: CD audio, 16-bit stereo at 44.1 kHz. Every frame count a
+// writer sees is in stream frames, whatever the device itself plays.
+#define PCM_OUTPUT_RATE 44100
+#define PCM_OUTPUT_CHANNELS 2
+#define PCM_OUTPUT_FRAME_BYTES (PCM_OUTPUT_CHANNELS * sizeof(int16_t))
+
+// Give up waiting for a started stream to consume frames after this long
+#define PCM_OUTPUT_START_TIMEOUT_MS 3000
+
+// pcm_output_wait() result bits
+#define PCM_OUTPUT_EVENT_DEVICE  0x1
+#define PCM_OUTPUT_EVENT_CONTROL 0x2
+
+// Staging buffer for the RW fallback (frames)
+#define PCM_OUTPUT_STAGING_FRAMES 4096
+
+// Device frames converted per write on the conversion path
+#define PCM_OUTPUT_CONVERT_FRAMES 1024
+
+// Per-device latency profiles are remembered here (one "device_id profile" per line)
+#define PCM_LATENCY_PROFILE_FILE CDPLAYER_CONFIG_DIR "/latency_profiles.conf"
+
+// Named buffer/period trade-offs between latency and dropout resistance
+typedef enum {
+    PCM_LATENCY_LOW = 0,    // Wired DAC, short buffer
+    PCM_LATENCY_BALANCED,   // Default for wired outputs
+    PCM_LATENCY_ROBUST,     // Bluetooth (BlueALSA), long buffer
+    PCM_LATENCY_COUNT
+} pcm_latency_profile_t;
+
+typedef struct {
+    const char *name;             // Config file / log name
+    const char *label;            // LCD label
+    unsigned int buffer_us;
+    unsigned int period_us;
+    unsigned int start_periods;   // start_threshold in periods
+    unsigned int avail_min_periods;
+} pcm_latency_params_t;
+
+// One opened ALSA playback device.
+// Writers fill frames between pcm_output_begin() and pcm_output_commit():
+// with MMAP access that region is the device ring itself (zero copy);
+// devices that can't MMAP (e.g. some plugins) get a staging buffer that is
+// handed to snd_pcm_writei() on commit. A device that won't take the stream
+// format as it is (e.g. HDMI at 48 kHz only) also gets the staging buffer,
+// and commit resamples and widens it in-process.
+typedef struct {
+    snd_pcm_t *handle;
+    char device_name[64];
+    bool use_mmap;
+    unsigned int rate;                  // What the device plays
+    snd_pcm_format_t format;
+    snd_pcm_uframes_t buffer_size;      // Stream frames
+    snd_pcm_uframes_t period_size;      // Stream frames
+    snd_pcm_uframes_t device_buffer_size;
+    snd_pcm_uframes_t start_threshold;  // Device frames
+    snd_pcm_uframes_t avail_min;        // Device frames
+    pcm_latency_profile_t profile;
+    
+    // Conversion path, when the device's rate or format differs from the
+    // stream's. Heap-allocated so the output can still be moved by value.
+    bool convert;
+    audio_resampler_quality_t quality;  // For resampling, here or downstream
+    audio_resampler_t *resampler;       // NULL at the stream rate
+    int16_t *resampled;
+    uint8_t *converted;                 // Device format, on its way to snd_pcm_writei
+    
+    // Prefill-driven start: set by pcm_output_prepare, cleared once the
+    // device is seen consuming frames
+    uint64_t frames_written;            // Device frames
+    bool start_pending;
+    uint64_t prepared_ms;
+    uint64_t started_ms;
+    uint64_t start_consumed;
+    
+    // Stream frames between the device and the listener (Bluetooth
+    // codec/link delay, as BlueALSA reports it within snd_pcm_delay())
+    snd_pcm_sframes_t transport_delay;
+    
+    snd_pcm_uframes_t mmap_offset;   // Region handed out by pcm_output_begin (MMAP)
+    int16_t *staging;                // Region handed out by pcm_output_begin (RW)
+    
+    struct pollfd *poll_fds;         // [0] control fd, then the PCM's descriptors
+    int poll_count;                  // PCM descriptors only
+} pcm_output_t;
+
+// Function declarations
+int pcm_output_open(pcm_output_t *out, const char *device, bool allow_mmap,
+                    pcm_latency_profile_t profile, audio_resampler_quality_t quality);
+void pcm_output_close(pcm_output_t *out);
+int pcm_output_prepare(pcm_output_t *out);
+int pcm_output_begin(pcm_output_t *out, int16_t **buffer, snd_pcm_uframes_t *frames);
+int pcm_output_commit(pcm_output_t *out, snd_pcm_uframes_t frames);
+int pcm_output_wait(pcm_output_t *out, int control_fd, int timeout_ms);
+int pcm_output_drain(pcm_output_t *out);
+int pcm_output_delay(pcm_output_t *out, snd_pcm_sframes_t *delay);
+snd_pcm_uframes_t pcm_output_rewind(pcm_output_t *out, snd_pcm_uframes_t frames);
+snd_pcm_sframes_t pcm_output_write(pcm_output_t *out, const int16_t *samples, snd_pcm_uframes_t frames);
+
+
+// Latency profiles
+const pcm_latency_params_t *pcm_latency_params(pcm_latency_profile_t profile);
+pcm_latency_profile_t pcm_latency_default(const char *device_id);
+pcm_latency_profile_t pcm_latency_load(const char *device_id);
+int pcm_latency_save(const char *device_id, pcm_latency_profile_t profile);
+
+#endif
@@ -0,0 +1,286 @@
+#include "pcm_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t pcm_pool_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+void pcm_pool_init(pcm_pool_t *pool) {
+    memset(pool, 0, sizeof(pcm_pool_t));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->drained, NULL);
+}
+
+// Index of device in the draining list, -1 if it is not playing out.
+// Called with the lock held.
+static int pcm_pool_find_draining(pcm_pool_t *pool, const char *name) {
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        if (pool->draining[i] && strcmp(pool->draining[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Nothing may be using the pool any more; outputs still playing out are
+// waited for
+void pcm_pool_free(pcm_pool_t *pool) {
+    pthread_mutex_lock(&pool->lock);
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        while (pool->draining[i]) {
+            pthread_cond_wait(&pool->drained, &pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        if (pool->entries[i].parked) {
+            pcm_output_close(&pool->entries[i].output);
+            pool->entries[i].parked = false;
+        }
+    }
+    pthread_cond_destroy(&pool->drained);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+// A parked output is usable if the device is still there and it prepares
+static bool pcm_pool_healthy(pcm_output_t *out) {
+    if (snd_pcm_state(out->handle) == SND_PCM_STATE_DISCONNECTED) {
+        return false;
+    }
+    return pcm_output_prepare(out) == 0;
+}
+
+// Open device into out: a parked output with the same settings is handed
+// over at once, anything else is opened and configured from scratch
+int pcm_pool_acquire(pcm_pool_t *pool, pcm_output_t *out, const char *device, bool allow_mmap,
+                     pcm_latency_profile_t profile, audio_resampler_quality_t quality) {
+    const char *name = device ? device : "default";
+    pcm_output_t stale[PCM_POOL_SIZE];
+    int stale_count = 0;
+    bool found = false;
+    
+    pthread_mutex_lock(&pool->lock);
+    
+    // Switching straight back: the device is free once it has played out
+    if (pcm_pool_find_draining(pool, name) >= 0) {
+        printf("⏳ Waiting for %s to finish playing out\n", name);
+        while (pcm_pool_find_draining(pool, name) >= 0) {
+            pthread_cond_wait(&pool->drained, &pool->lock);
+        }
+    }
+    
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        pcm_pool_entry_t *entry = &pool->entries[i];
+        if (!entry->parked || strcmp(entry->output.device_name, name) != 0) {
+            continue;
+        }
+    
+        // Same device with other settings still holds it: close before reopening
+        entry->parked = false;
+        if (!found && entry->allow_mmap == allow_mmap && entry->output.profile == profile &&
+            entry->output.quality == quality) {
+            *out = entry->output;
+            found = true;
+        } else {
+            stale[stale_count++] = entry->output;
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    for (int i = 0; i < stale_count; i++) {
+        pcm_output_close(&stale[i]);
+    }
+    
+    uint64_t start = pcm_pool_now_ms();
+    if (found) {
+        if (pcm_pool_healthy(out)) {
+            printf("♻️  %s ready from standby in %llu ms\n", name,
+                   (unsigned long long)(pcm_pool_now_ms() - start));
+            return 0;
+        }
+        printf("⚠️  Standby handle for %s went bad, reopening\n", name);
+        pcm_output_close(out);
+    }
+    
+    if (pcm_output_open(out, device, allow_mmap, profile, quality) != 0) {
+        return -1;
+    }
+    printf("🎵 Opened %s in %llu ms\n", name, (unsigned long long)(pcm_pool_now_ms() - start));
+    return 0;
+}
+
+// Give an output back: it is stopped, prepared and parked for the next
+// acquire, displacing the least recently used one when the pool is full.
+// out no longer owns the handle afterwards.
+void pcm_pool_release(pcm_pool_t *pool, pcm_output_t *out, bool allow_mmap) {
+    if (!out->handle) {
+        return;
+    }
+    
+    snd_pcm_drop(out->handle);
+    if (!pcm_pool_healthy(out)) {
+        pcm_output_close(out);
+        return;
+    }
+    
+    pcm_output_t evicted;
+    bool evict = false;
+    
+    pthread_mutex_lock(&pool->lock);
+    pcm_pool_entry_t *slot = NULL;
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        pcm_pool_entry_t *entry = &pool->entries[i];
+        if (!entry->parked) {
+            slot = entry;
+            break;
+        }
+        if (!slot || entry->parked_ms < slot->parked_ms) {
+            slot = entry;
+        }
+    }
+    
+    if (slot->parked) {
+        evicted = slot->output;
+        evict = true;
+    }
+    slot->output = *out;
+    slot->allow_mmap = allow_mmap;
+    slot->parked_ms = pcm_pool_now_ms();
+    slot->parked = true;
+    pthread_mutex_unlock(&pool->lock);
+    
+    printf("💤 %s parked on standby\n", out->device_name);
+    memset(out, 0, sizeof(pcm_output_t));
+    
+    if (evict) {
+        printf("💤 %s dropped from standby\n", evicted.device_name);
+        pcm_output_close(&evicted);
+    }
+}
+
+typedef struct {
+    pcm_pool_t *pool;
+    pcm_output_t output;
+    bool allow_mmap;
+    int slot;                    // In pool->draining
+} pcm_pool_drain_t;
+
+static void *pcm_pool_drain_thread(void *arg) {
+    pcm_pool_drain_t *drain = (pcm_pool_drain_t *)arg;
+    pcm_pool_t *pool = drain->pool;
+    
+    pcm_output_drain(&drain->output);
+    
+    // Parked before it leaves the draining list, so an acquire never finds
+    // the device in neither place while it is still open
+    pcm_pool_release(pool, &drain->output, drain->allow_mmap);
+    
+    pthread_mutex_lock(&pool->lock);
+    pool->draining[drain->slot] = NULL;
+    pthread_cond_broadcast(&pool->drained);
+    pthread_mutex_unlock(&pool->lock);
+    free(drain);
+    return NULL;
+}
+
+// Like pcm_pool_release, but for an output that is still playing: what it
+// holds plays out on a helper thread and it is parked afterwards, so the
+// caller does not wait for it. If no helper can be had it is cut off.
+void pcm_pool_drain(pcm_pool_t *pool, pcm_output_t *out, bool allow_mmap) {
+    if (!out->handle) {
+        return;
+    }
+    
+    pcm_pool_drain_t *drain = malloc(sizeof(pcm_pool_drain_t));
+    if (!drain) {
+        pcm_pool_release(pool, out, allow_mmap);
+        return;
+    }
+    drain->pool = pool;
+    drain->output = *out;
+    drain->allow_mmap = allow_mmap;
+    drain->slot = -1;
+    
+    pthread_mutex_lock(&pool->lock);
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        if (!pool->draining[i]) {
+            drain->slot = i;
+            pool->draining[i] = drain->output.device_name;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (drain->slot < 0 || pthread_create(&thread, &attr, pcm_pool_drain_thread, drain) != 0) {
+        printf("⚠️  Cannot let %s play out, stopping it\n", out->device_name);
+        if (drain->slot >= 0) {
+            pthread_mutex_lock(&pool->lock);
+            pool->draining[drain->slot] = NULL;
+            pthread_mutex_unlock(&pool->lock);
+        }
+        free(drain);
+        pcm_pool_release(pool, out, allow_mmap);
+    } else {
+        memset(out, 0, sizeof(pcm_output_t));
+    }
+    pthread_attr_destroy(&attr);
+}
+
+// Close parked outputs that sat unused too long or whose device went away.
+// Cheap to call often: the work is done every PCM_POOL_CHECK_MS.
+void pcm_pool_expire(pcm_pool_t *pool) {
+    pcm_output_t closing[PCM_POOL_SIZE];
+    int count = 0;
+    uint64_t now = pcm_pool_now_ms();
+    
+    pthread_mutex_lock(&pool->lock);
+    if (now < pool->next_check_ms) {
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+    pool->next_check_ms = now + PCM_POOL_CHECK_MS;
+    
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        pcm_pool_entry_t *entry = &pool->entries[i];
+        if (!entry->parked) {
+            continue;
+        }
+    
+        bool idle = (now - entry->parked_ms > PCM_POOL_IDLE_MS);
+        bool lost = (snd_pcm_state(entry->output.handle) == SND_PCM_STATE_DISCONNECTED);
+        if (idle || lost) {
+            printf("💤 Closing standby %s (%s)\n", entry->output.device_name, lost ? "disconnected" : "idle");
+            closing[count++] = entry->output;
+            entry->parked = false;
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    
+    for (int i = 0; i < count; i++) {
+        pcm_output_close(&closing[i]);
+    }
+}
+
+bool pcm_pool_empty(pcm_pool_t *pool) {
+    bool empty = true;
+    
+    pthread_mutex_lock(&pool->lock);
+    for (int i = 0; i < PCM_POOL_SIZE; i++) {
+        if (pool->entries[i].parked) {
+            empty = false;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return empty;
+}
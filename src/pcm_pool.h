@@ -0,0 +1,48 @@
+#ifndef PCM_POOL_H
+#define PCM_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "pcm_output.h"
+
+// Outputs kept open after use (wired, HDMI, the connected Bluetooth sink)
+#define PCM_POOL_SIZE 3
+
+// A parked output is closed after this long unused; parked outputs are
+// checked for disconnects this often
+#define PCM_POOL_IDLE_MS 120000
+#define PCM_POOL_CHECK_MS 5000
+
+typedef struct {
+    pcm_output_t output;         // Configured and prepared, silent
+    bool allow_mmap;             // What it was opened with
+    uint64_t parked_ms;
+    bool parked;
+} pcm_pool_entry_t;
+
+// Warm standby for recently used outputs: an output that is given back is
+// parked prepared instead of closed, so opening the same device again with
+// the same settings skips snd_pcm_open and the hw/sw params negotiation.
+// Outputs are moved in and out by value; any thread may use the pool.
+// An output can also be handed over still playing: a helper thread lets
+// it play out and parks it afterwards.
+typedef struct {
+    pcm_pool_entry_t entries[PCM_POOL_SIZE];
+    const char *draining[PCM_POOL_SIZE];  // Devices still playing out
+    pthread_mutex_t lock;
+    pthread_cond_t drained;
+    uint64_t next_check_ms;
+} pcm_pool_t;
+
+// Function declarations
+void pcm_pool_init(pcm_pool_t *pool);
+void pcm_pool_free(pcm_pool_t *pool);
+int pcm_pool_acquire(pcm_pool_t *pool, pcm_output_t *out, const char *device, bool allow_mmap,
+                     pcm_latency_profile_t profile, audio_resampler_quality_t quality);
+void pcm_pool_release(pcm_pool_t *pool, pcm_output_t *out, bool allow_mmap);
+void pcm_pool_drain(pcm_pool_t *pool, pcm_output_t *out, bool allow_mmap);
+void pcm_pool_expire(pcm_pool_t *pool);
+bool pcm_pool_empty(pcm_pool_t *pool);
+
+#endif
@@ -0,0 +1,245 @@
+#include "sector_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+// Per-slot bookkeeping counted against the memory budget
+#define SLOT_OVERHEAD (3 * sizeof(int32_t))
+
+static void cache_release_disc(sector_cache_t *cache) {
+    free(cache->index);
+    free(cache->spilled);
+    free(cache->data);
+    free(cache->slot_lsn);
+    free(cache->lru_prev);
+    free(cache->lru_next);
+    
+    cache->index = NULL;
+    cache->spilled = NULL;
+    cache->data = NULL;
+    cache->slot_lsn = NULL;
+    cache->lru_prev = NULL;
+    cache->lru_next = NULL;
+    cache->disc_id = 0;
+    cache->disc_sectors = 0;
+    cache->capacity = 0;
+    cache->used = 0;
+    cache->lru_head = -1;
+    cache->lru_tail = -1;
+    
+    if (cache->spill_fd >= 0) {
+        close(cache->spill_fd);
+        cache->spill_fd = -1;
+    }
+}
+
+static void lru_unlink(sector_cache_t *cache, int slot) {
+    int prev = cache->lru_prev[slot];
+    int next = cache->lru_next[slot];
+    
+    if (prev >= 0) {
+        cache->lru_next[prev] = next;
+    } else {
+        cache->lru_head = next;
+    }
+    
+    if (next >= 0) {
+        cache->lru_prev[next] = prev;
+    } else {
+        cache->lru_tail = prev;
+    }
+}
+
+static void lru_push_front(sector_cache_t *cache, int slot) {
+    cache->lru_prev[slot] = -1;
+    cache->lru_next[slot] = cache->lru_head;
+    
+    if (cache->lru_head >= 0) {
+        cache->lru_prev[cache->lru_head] = slot;
+    }
+    cache->lru_head = slot;
+    
+    if (cache->lru_tail < 0) {
+        cache->lru_tail = slot;
+    }
+}
+
+static int16_t *slot_samples(sector_cache_t *cache, int slot) {
+    return cache->data + (size_t)slot * CD_SAMPLES_PER_SECTOR;
+}
+
+// Free the least recently used slot, spilling its sector if enabled
+static int cache_evict(sector_cache_t *cache) {
+    int slot = cache->lru_tail;
+    int lsn = cache->slot_lsn[slot];
+    
+    lru_unlink(cache, slot);
+    cache->index[lsn] = -1;
+    cache->stats.evictions++;
+    
+    if (cache->spill_fd >= 0 && !(cache->spilled[lsn / 8] & (1 << (lsn % 8)))) {
+        off_t offset = (off_t)lsn * CDIO_CD_FRAMESIZE_RAW;
+        if (pwrite(cache->spill_fd, slot_samples(cache, slot), CDIO_CD_FRAMESIZE_RAW, offset) == CDIO_CD_FRAMESIZE_RAW) {
+            cache->spilled[lsn / 8] |= (1 << (lsn % 8));
+        }
+    }
+    
+    return slot;
+}
+
+int sector_cache_init(sector_cache_t *cache, size_t budget_bytes, const char *spill_path) {
+    memset(cache, 0, sizeof(sector_cache_t));
+    
+    cache->budget_bytes = budget_bytes;
+    cache->spill_fd = -1;
+    cache->lru_head = -1;
+    cache->lru_tail = -1;
+    
+    if (spill_path) {
+        snprintf(cache->spill_path, sizeof(cache->spill_path), "%s", spill_path);
+    }
+    
+    if (pthread_mutex_init(&cache->lock, NULL) != 0) {
+        return -1;
+    }
+    
+    return 0;
+}
+
+// Attach the cache to a disc; a different disc drops everything cached
+int sector_cache_bind_disc(sector_cache_t *cache, unsigned int disc_id, int disc_sectors) {
+    if (disc_sectors <= 0) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&cache->lock);
+    
+    if (cache->index && cache->disc_id == disc_id && cache->disc_sectors == disc_sectors) {
+        pthread_mutex_unlock(&cache->lock);
+        return 0;
+    }
+    
+    cache_release_disc(cache);
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    
+    int capacity = (int)(cache->budget_bytes / (CDIO_CD_FRAMESIZE_RAW + SLOT_OVERHEAD));
+    if (capacity > disc_sectors) {
+        capacity = disc_sectors;
+    }
+    
+    cache->index = malloc((size_t)disc_sectors * sizeof(int32_t));
+    cache->spilled = calloc((size_t)disc_sectors / 8 + 1, 1);
+    cache->data = malloc((size_t)capacity * CDIO_CD_FRAMESIZE_RAW);
+    cache->slot_lsn = malloc((size_t)capacity * sizeof(int32_t));
+    cache->lru_prev = malloc((size_t)capacity * sizeof(int32_t));
+    cache->lru_next = malloc((size_t)capacity * sizeof(int32_t));
+    
+    if (!cache->index || !cache->spilled || !cache->data || 
+        !cache->slot_lsn || !cache->lru_prev || !cache->lru_next) {
+        fprintf(stderr, "❌ Failed to allocate sector cache\n");
+        cache_release_disc(cache);
+        pthread_mutex_unlock(&cache->lock);
+        return -1;
+    }
+    
+    memset(cache->index, 0xff, (size_t)disc_sectors * sizeof(int32_t));
+    cache->disc_id = disc_id;
+    cache->disc_sectors = disc_sectors;
+    cache->capacity = capacity;
+    cache->stats.capacity_sectors = capacity;
+    
+    // Spill file is per disc: start it empty
+    if (cache->spill_path[0]) {
+        cache->spill_fd = open(cache->spill_path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (cache->spill_fd < 0) {
+            printf("⚠️  Sector spill file unavailable: %s\n", cache->spill_path);
+        }
+    }
+    
+    printf("✅ Sector cache bound to disc %08x: %d sectors in RAM (%zu MB)%s\n",
+           disc_id, capacity, cache->budget_bytes / (1024 * 1024),
+           cache->spill_fd >= 0 ? " + spill file" : "");
+    
+    pthread_mutex_unlock(&cache->lock);
+    return 0;
+}
+
+// Copy a cached sector into samples; returns false on a miss
+bool sector_cache_lookup(sector_cache_t *cache, int lsn, int16_t *samples) {
+    pthread_mutex_lock(&cache->lock);
+    
+    if (!cache->index || lsn < 0 || lsn >= cache->disc_sectors) {
+        pthread_mutex_unlock(&cache->lock);
+        return false;
+    }
+    
+    int slot = cache->index[lsn];
+    if (slot >= 0) {
+        memcpy(samples, slot_samples(cache, slot), CDIO_CD_FRAMESIZE_RAW);
+        lru_unlink(cache, slot);
+        lru_push_front(cache, slot);
+        cache->stats.hits++;
+        pthread_mutex_unlock(&cache->lock);
+        return true;
+    }
+    
+    if (cache->spill_fd >= 0 && (cache->spilled[lsn / 8] & (1 << (lsn % 8)))) {
+        off_t offset = (off_t)lsn * CDIO_CD_FRAMESIZE_RAW;
+        if (pread(cache->spill_fd, samples, CDIO_CD_FRAMESIZE_RAW, offset) == CDIO_CD_FRAMESIZE_RAW) {
+            cache->stats.spill_hits++;
+            pthread_mutex_unlock(&cache->lock);
+            return true;
+        }
+    }
+    
+    cache->stats.misses++;
+    pthread_mutex_unlock(&cache->lock);
+    return false;
+}
+
+// Insert a verified sector, evicting the least recently used one if full
+void sector_cache_store(sector_cache_t *cache, int lsn, const int16_t *samples) {
+    pthread_mutex_lock(&cache->lock);
+    
+    if (!cache->index || cache->capacity == 0 || lsn < 0 || lsn >= cache->disc_sectors) {
+        pthread_mutex_unlock(&cache->lock);
+        return;
+    }
+    
+    int slot = cache->index[lsn];
+    if (slot >= 0) {
+        lru_unlink(cache, slot);
+    } else if (cache->used < cache->capacity) {
+        slot = cache->used++;
+    } else {
+        slot = cache_evict(cache);
+    }
+    
+    memcpy(slot_samples(cache, slot), samples, CDIO_CD_FRAMESIZE_RAW);
+    cache->slot_lsn[slot] = lsn;
+    cache->index[lsn] = slot;
+    lru_push_front(cache, slot);
+    
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void sector_cache_get_stats(sector_cache_t *cache, sector_cache_stats_t *stats) {
+    pthread_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    stats->resident_sectors = cache->used;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void sector_cache_free(sector_cache_t *cache) {
+    pthread_mutex_lock(&cache->lock);
+    cache_release_disc(cache);
+    pthread_mutex_unlock(&cache->lock);
+    
+    if (cache->spill_path[0]) {
+        unlink(cache->spill_path);
+    }
+    
+    pthread_mutex_destroy(&cache->lock);
+}
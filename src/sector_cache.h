@@ -0,0 +1,55 @@
+#ifndef SECTOR_CACHE_H
+#define SECTOR_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "cd_control.h"
+
+#define SECTOR_CACHE_DEFAULT_BUDGET_MB 64
+
+typedef struct {
+    unsigned long hits;          // Served from RAM
+    unsigned long spill_hits;    // Served from the spill file
+    unsigned long misses;        // Had to go to the drive
+    unsigned long evictions;     // Dropped from RAM to stay in budget
+    int resident_sectors;
+    int capacity_sectors;
+} sector_cache_stats_t;
+
+// Per-disc cache of verified CD sectors keyed by LSN.
+// RAM slots are recycled in LRU order; evicted sectors optionally land in
+// a sparse spill file at offset lsn * CDIO_CD_FRAMESIZE_RAW.
+typedef struct {
+    unsigned int disc_id;
+    int disc_sectors;            // Size of the LSN index (disc leadout)
+    int32_t *index;              // LSN -> RAM slot, -1 when not resident
+    uint8_t *spilled;            // LSN bitmap of sectors in the spill file
+    
+    int16_t *data;               // capacity * CD_SAMPLES_PER_SECTOR
+    int32_t *slot_lsn;
+    int32_t *lru_prev;
+    int32_t *lru_next;
+    int lru_head;                // Most recently used slot
+    int lru_tail;                // Next eviction candidate
+    int capacity;
+    int used;
+    
+    size_t budget_bytes;
+    char spill_path[256];
+    int spill_fd;
+    
+    pthread_mutex_t lock;
+    sector_cache_stats_t stats;
+} sector_cache_t;
+
+// Function declarations
+int sector_cache_init(sector_cache_t *cache, size_t budget_bytes, const char *spill_path);
+int sector_cache_bind_disc(sector_cache_t *cache, unsigned int disc_id, int disc_sectors);
+bool sector_cache_lookup(sector_cache_t *cache, int lsn, int16_t *samples);
+void sector_cache_store(sector_cache_t *cache, int lsn, const int16_t *samples);
+void sector_cache_get_stats(sector_cache_t *cache, sector_cache_stats_t *stats);
+void sector_cache_free(sector_cache_t *cache);
+
+#endif
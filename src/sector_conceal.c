@@ -0,0 +1,118 @@
+#include "sector_conceal.h"
+#include <stdio.h>
+#include <string.h>
+
+// Sample index of a waveform continued past the end of a block by running
+// it backwards (and forwards again), so the join has no step
+static int reflect_index(long n) {
+    long period = 2L * CD_FRAMES_PER_SECTOR;
+    long p = n % period;
+    return (int)(p < CD_FRAMES_PER_SECTOR ? p : period - 1 - p);
+}
+
+static int16_t clamp_sample(float value) {
+    if (value > 32767.0f) {
+        return 32767;
+    }
+    if (value < -32768.0f) {
+        return -32768;
+    }
+    return (int16_t)value;
+}
+
+void sector_conceal_init(sector_conceal_t *conceal) {
+    memset(conceal, 0, sizeof(sector_conceal_t));
+}
+
+// Position jumped (seek, scan, new track request): neighbours no longer apply
+void sector_conceal_reset(sector_conceal_t *conceal) {
+    conceal->have_last = false;
+    conceal->pending = 0;
+    conceal->muted = false;
+}
+
+// Record a failed sector. Returns true when the held sectors must be
+// emitted now without waiting for a good neighbour (gap too long to
+// interpolate, or already muted).
+bool sector_conceal_fail(sector_conceal_t *conceal, int lsn, int track) {
+    if (conceal->pending == 0) {
+        conceal->pending_lsn = lsn;
+        if (!conceal->muted && track > 0 && track < SECTOR_CONCEAL_MAX_TRACKS) {
+            conceal->tracks[track].gaps++;
+        }
+    }
+    
+    conceal->pending_track[conceal->pending++] = track;
+    return conceal->muted || conceal->pending > SECTOR_CONCEAL_INTERP_SECTORS;
+}
+
+// Synthesize held sector index (0 = oldest) into out. With next (the good
+// sector after the gap) the gap is a crossfade between the last good block
+// run on forwards and the next one run back from its start; without it the
+// last block fades out into silence.
+void sector_conceal_synth(sector_conceal_t *conceal, int index, const int16_t *next, int16_t *out) {
+    long gap_frames = (long)conceal->pending * CD_FRAMES_PER_SECTOR;
+    long base = (long)index * CD_FRAMES_PER_SECTOR;
+    
+    for (int frame = 0; frame < CD_FRAMES_PER_SECTOR; frame++) {
+        long g = base + frame;
+        int left_idx = CD_FRAMES_PER_SECTOR - 1 - reflect_index(g);
+        int right_idx = reflect_index(gap_frames - 1 - g);
+        float w = (g + 0.5f) / gap_frames;
+        float fade = 1.0f - (g + 0.5f) / SECTOR_CONCEAL_FADE_FRAMES;
+    
+        for (int ch = 0; ch < 2; ch++) {
+            float left = conceal->have_last ? conceal->last_good[left_idx * 2 + ch] : 0.0f;
+            float value = 0.0f;
+    
+            if (next) {
+                value = left + (next[right_idx * 2 + ch] - left) * w;
+            } else if (!conceal->muted && g < SECTOR_CONCEAL_FADE_FRAMES) {
+                value = left * fade;
+            }
+            out[frame * 2 + ch] = clamp_sample(value);
+        }
+    }
+    
+    int track = conceal->pending_track[index];
+    if (track > 0 && track < SECTOR_CONCEAL_MAX_TRACKS) {
+        conceal->tracks[track].samples += CD_FRAMES_PER_SECTOR;
+    }
+}
+
+// All held sectors were emitted; interpolated tells which way
+void sector_conceal_flushed(sector_conceal_t *conceal, bool interpolated) {
+    if (conceal->pending == 0) {
+        return;
+    }
+    
+    if (interpolated) {
+        printf("🩹 Interpolated %d unreadable sector(s) at %d\n", conceal->pending, conceal->pending_lsn);
+    } else if (!conceal->muted) {
+        printf("🩹 Unreadable sectors from %d: fading out until the disc reads again\n",
+               conceal->pending_lsn);
+        conceal->muted = true;
+    }
+    conceal->pending = 0;
+}
+
+// A good sector is about to be emitted: fade it in after a long gap and
+// keep it as the left neighbour of the next gap
+void sector_conceal_good(sector_conceal_t *conceal, int16_t *samples) {
+    if (conceal->muted) {
+        for (int frame = 0; frame < SECTOR_CONCEAL_FADE_FRAMES; frame++) {
+            float gain = (frame + 0.5f) / SECTOR_CONCEAL_FADE_FRAMES;
+            samples[frame * 2] = (int16_t)(samples[frame * 2] * gain);
+            samples[frame * 2 + 1] = (int16_t)(samples[frame * 2 + 1] * gain);
+        }
+        conceal->muted = false;
+    }
+    
+    memcpy(conceal->last_good, samples, CDIO_CD_FRAMESIZE_RAW);
+    conceal->have_last = true;
+}
+
+// Nothing held back and not muted: good sectors can bypass concealment
+bool sector_conceal_idle(const sector_conceal_t *conceal) {
+    return conceal->pending == 0 && !conceal->muted;
+}
@@ -0,0 +1,45 @@
+#ifndef SECTOR_CONCEAL_H
+#define SECTOR_CONCEAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cd_control.h"
+
+// Gaps up to this many sectors (40 ms) are interpolated from both
+// neighbours; longer ones fade the last good block out, stay silent and
+// fade back in on the next good sector
+#define SECTOR_CONCEAL_INTERP_SECTORS 3
+#define SECTOR_CONCEAL_FADE_FRAMES (CD_FRAMES_PER_SECTOR / 2)   // ~6.7 ms
+#define SECTOR_CONCEAL_MAX_TRACKS 100
+
+typedef struct {
+    unsigned long samples;       // Sample frames synthesized
+    unsigned long gaps;          // Error runs concealed
+} sector_conceal_stats_t;
+
+// Concealment for sectors the drive could not deliver (or paranoia gave up
+// on). Failed sectors are held back until the next good one shows how the
+// gap closes, then emitted in their place, so playback never loses time.
+// Owned by the CD reader thread.
+typedef struct {
+    int16_t last_good[CD_SAMPLES_PER_SECTOR];
+    bool have_last;
+    
+    int pending;                 // Failed sectors held back
+    int pending_lsn;             // First of them
+    int pending_track[SECTOR_CONCEAL_INTERP_SECTORS + 1];
+    bool muted;                  // Long gap: silent until the next good sector
+    
+    sector_conceal_stats_t tracks[SECTOR_CONCEAL_MAX_TRACKS];
+} sector_conceal_t;
+
+// Function declarations
+void sector_conceal_init(sector_conceal_t *conceal);
+void sector_conceal_reset(sector_conceal_t *conceal);
+bool sector_conceal_fail(sector_conceal_t *conceal, int lsn, int track);
+void sector_conceal_synth(sector_conceal_t *conceal, int index, const int16_t *next, int16_t *out);
+void sector_conceal_flushed(sector_conceal_t *conceal, bool interpolated);
+void sector_conceal_good(sector_conceal_t *conceal, int16_t *samples);
+bool sector_conceal_idle(const sector_conceal_t *conceal);
+
+#endif
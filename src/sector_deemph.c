@@ -0,0 +1,44 @@
+#include "sector_deemph.h"
+#include <stdio.h>
+#include <string.h>
+
+void sector_deemph_init(sector_deemph_t *deemph) {
+    memset(deemph, 0, sizeof(sector_deemph_t));
+    deemph->band.type = AUDIO_DSP_HIGH_SHELF;
+    deemph->band.freq = SECTOR_DEEMPH_FREQ;
+    deemph->band.gain_db = SECTOR_DEEMPH_GAIN_DB;
+    deemph->band.q = SECTOR_DEEMPH_Q;
+    audio_dsp_band_design(&deemph->band);
+}
+
+// Filter history no longer leads into what comes next (seek, new play)
+void sector_deemph_reset(sector_deemph_t *deemph) {
+    memset(deemph->band.z1, 0, sizeof(deemph->band.z1));
+    memset(deemph->band.z2, 0, sizeof(deemph->band.z2));
+}
+
+// One sector of track, in place. The filter follows the track's flag, so
+// a gapless run switches it on and off at the first sector of a track.
+void sector_deemph_process(sector_deemph_t *deemph, int16_t *samples, int track, bool emphasized) {
+    if (emphasized && (!deemph->active || track != deemph->track)) {
+        // Running on from another flagged track keeps the filter history
+        if (!deemph->active) {
+            sector_deemph_reset(deemph);
+        }
+        printf("🎚️  Track %d was mastered with pre-emphasis, de-emphasis on\n", track);
+        deemph->track = track;
+        deemph->sectors = 0;
+    } else if (!emphasized && deemph->active) {
+        printf("🎚️  De-emphasis off after %lu sectors of track %d\n", deemph->sectors, deemph->track);
+    }
+    deemph->active = emphasized;
+    
+    if (!emphasized) {
+        return;
+    }
+    
+    audio_dsp_to_float(samples, deemph->block, CD_SAMPLES_PER_SECTOR);
+    audio_dsp_biquad(&deemph->band, deemph->block, CD_FRAMES_PER_SECTOR);
+    audio_dsp_to_int16(deemph->block, samples, CD_SAMPLES_PER_SECTOR);
+    deemph->sectors++;
+}
@@ -0,0 +1,30 @@
+#ifndef SECTOR_DEEMPH_H
+#define SECTOR_DEEMPH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cd_control.h"
+#include "audio_dsp.h"
+
+// CD de-emphasis (50/15 us time constants) as a biquad high shelf, fitted
+// to the analogue curve: within 0.05 dB of it from 20 Hz to 20 kHz
+#define SECTOR_DEEMPH_FREQ 5275.0
+#define SECTOR_DEEMPH_GAIN_DB -9.48
+#define SECTOR_DEEMPH_Q 0.47
+
+// De-emphasis for tracks mastered with pre-emphasis. Runs on the playback
+// engine over whole ring sectors in place, before any of them is output.
+typedef struct {
+    audio_dsp_band_t band;
+    bool active;                 // Filtering the current track
+    int track;                   // Track it was switched on for
+    unsigned long sectors;       // Sectors filtered since switched on
+    float block[CD_SAMPLES_PER_SECTOR];
+} sector_deemph_t;
+
+// Function declarations
+void sector_deemph_init(sector_deemph_t *deemph);
+void sector_deemph_reset(sector_deemph_t *deemph);
+void sector_deemph_process(sector_deemph_t *deemph, int16_t *samples, int track, bool emphasized);
+
+#endif
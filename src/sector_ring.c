@@ -0,0 +1,133 @@
+#include "sector_ring.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int sector_ring_init(sector_ring_t *ring, int seconds) {
+    if (seconds < SECTOR_RING_MIN_SECONDS) {
+        seconds = SECTOR_RING_MIN_SECONDS;
+    } else if (seconds > SECTOR_RING_MAX_SECONDS) {
+        seconds = SECTOR_RING_MAX_SECONDS;
+    }
+    
+    size_t capacity = (size_t)seconds * CD_SECTORS_PER_SECOND;
+    ring_sector_t *slots = calloc(capacity, sizeof(ring_sector_t));
+    int16_t *pcm = calloc(capacity, CDIO_CD_FRAMESIZE_RAW);
+    if (!slots || !pcm) {
+        fprintf(stderr, "❌ Failed to allocate %zu sector ring slots\n", capacity);
+        free(slots);
+        free(pcm);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < capacity; i++) {
+        slots[i].samples = pcm + i * CD_SAMPLES_PER_SECTOR;
+    }
+    
+    ring->slots = slots;
+    ring->pcm = pcm;
+    ring->capacity = capacity;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    
+    printf("✅ Read-ahead ring: %zu sectors (%d seconds, %zu KB)\n",
+           capacity, seconds, capacity * (sizeof(ring_sector_t) + CDIO_CD_FRAMESIZE_RAW) / 1024);
+    return 0;
+}
+
+void sector_ring_free(sector_ring_t *ring) {
+    free(ring->slots);
+    free(ring->pcm);
+    ring->slots = NULL;
+    ring->pcm = NULL;
+    ring->capacity = 0;
+    atomic_store(&ring->head, 0);
+    atomic_store(&ring->tail, 0);
+}
+
+// Only safe while neither the producer nor the consumer is running
+void sector_ring_reset(sector_ring_t *ring) {
+    atomic_store(&ring->head, 0);
+    atomic_store(&ring->tail, 0);
+}
+
+// Producer: returns the next free slot, or NULL if the ring is full
+ring_sector_t *sector_ring_begin_write(sector_ring_t *ring) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    
+    if (head - tail >= ring->capacity) {
+        return NULL;
+    }
+    
+    return &ring->slots[head % ring->capacity];
+}
+
+// Producer: publish the slot returned by sector_ring_begin_write
+void sector_ring_commit_write(sector_ring_t *ring) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+// Producer: up to max free slots that are contiguous in memory (stops at the
+// wrap point). Fill slots [0, *count) from the returned one, then commit.
+ring_sector_t *sector_ring_begin_write_batch(sector_ring_t *ring, size_t max, size_t *count) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t free_slots = ring->capacity - (head - tail);
+    size_t index = head % ring->capacity;
+    size_t until_wrap = ring->capacity - index;
+    
+    size_t n = free_slots < until_wrap ? free_slots : until_wrap;
+    if (n > max) {
+        n = max;
+    }
+    
+    *count = n;
+    return n ? &ring->slots[index] : NULL;
+}
+
+// Producer: publish count slots filled after sector_ring_begin_write_batch
+void sector_ring_commit_batch(sector_ring_t *ring, size_t count) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);
+}
+
+// Consumer: returns the oldest filled slot, or NULL if the ring is empty
+const ring_sector_t *sector_ring_peek(sector_ring_t *ring) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    
+    if (tail == head) {
+        return NULL;
+    }
+    
+    return &ring->slots[tail % ring->capacity];
+}
+
+// Consumer: the filled slot n places after the oldest, or NULL if the
+// producer has not got that far yet
+const ring_sector_t *sector_ring_peek_at(sector_ring_t *ring, size_t n) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    
+    if (head - tail <= n) {
+        return NULL;
+    }
+    
+    return &ring->slots[(tail + n) % ring->capacity];
+}
+
+// Consumer: hand the slot returned by sector_ring_peek back to the producer
+void sector_ring_release(sector_ring_t *ring) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+// Number of filled sectors; safe to call from any thread
+size_t sector_ring_fill(sector_ring_t *ring) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    
+    return head - tail;
+}
@@ -0,0 +1,49 @@
+#ifndef SECTOR_RING_H
+#define SECTOR_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "cd_control.h"
+
+// Ring depth limits (in seconds of CD audio)
+#define SECTOR_RING_MIN_SECONDS 2
+#define SECTOR_RING_MAX_SECONDS 30
+#define SECTOR_RING_DEFAULT_SECONDS 5
+
+// One raw CD-DA sector plus where it came from.
+// Sample storage of consecutive slots is contiguous, so a multi-sector
+// read can land directly in the ring.
+typedef struct {
+    int16_t *samples;
+    int lsn;
+    int track;
+    unsigned int epoch;          // Seek generation the sector was read for
+} ring_sector_t;
+
+// Single-producer/single-consumer lock-free ring of CD sectors.
+// The reader thread is the only producer, the ALSA writer the only consumer.
+// head/tail are free-running counters; slot index is counter % capacity.
+typedef struct {
+    ring_sector_t *slots;
+    int16_t *pcm;                // capacity * CD_SAMPLES_PER_SECTOR
+    size_t capacity;
+    _Alignas(64) atomic_size_t head;   // Next slot the producer fills
+    _Alignas(64) atomic_size_t tail;   // Next slot the consumer drains
+} sector_ring_t;
+
+// Function declarations
+int sector_ring_init(sector_ring_t *ring, int seconds);
+void sector_ring_free(sector_ring_t *ring);
+void sector_ring_reset(sector_ring_t *ring);
+ring_sector_t *sector_ring_begin_write(sector_ring_t *ring);
+void sector_ring_commit_write(sector_ring_t *ring);
+ring_sector_t *sector_ring_begin_write_batch(sector_ring_t *ring, size_t max, size_t *count);
+void sector_ring_commit_batch(sector_ring_t *ring, size_t count);
+const ring_sector_t *sector_ring_peek(sector_ring_t *ring);
+const ring_sector_t *sector_ring_peek_at(sector_ring_t *ring, size_t n);
+void sector_ring_release(sector_ring_t *ring);
+size_t sector_ring_fill(sector_ring_t *ring);
+
+#endif
@@ -0,0 +1,113 @@
+// Build step: convert the notification WAVs into C tables so the player
+// carries its sounds instead of finding them on disk.
+//
+//   cc -Isrc tools/embed_sounds.c src/assets.c -o embed_sounds
+//   ./embed_sounds src/assets_embedded.c assets/sounds/*.wav
+//
+// Each file goes through the same decoder the player uses at runtime
+// (assets_decode_wav), so the tables are already 16-bit stereo at
+// ASSETS_SOUND_RATE and a sound in the override directory converts
+// identically to its embedded counterpart.
+
+#include "assets.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// assets.c refers to the generated index; the generator itself embeds nothing
+const embedded_sound_t assets_embedded_sounds[1];
+const int assets_embedded_count = 0;
+
+#define SAMPLES_PER_LINE 12
+
+static int compare_paths(const void *a, const void *b) {
+    const char *name_a = strrchr(*(const char **)a, '/');
+    const char *name_b = strrchr(*(const char **)b, '/');
+    name_a = name_a ? name_a + 1 : *(const char **)a;
+    name_b = name_b ? name_b + 1 : *(const char **)b;
+    return strcmp(name_a, name_b);
+}
+
+// C identifier for a file name ("bt_connect.wav" -> "bt_connect_wav")
+static void symbol_name(const char *name, char *symbol, size_t size) {
+    size_t i = 0;
+    for (; name[i] && i + 1 < size; i++) {
+        char c = name[i];
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        symbol[i] = valid ? c : '_';
+    }
+    symbol[i] = '\0';
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output.c> [sound.wav ...]\n", argv[0]);
+        return 1;
+    }
+    
+    int count = argc - 2;
+    if (count > ASSETS_MAX_SOUNDS) {
+        fprintf(stderr, "❌ %d sounds, at most %d can be embedded\n", count, ASSETS_MAX_SOUNDS);
+        return 1;
+    }
+    
+    // Same order as the runtime bank, whatever the shell glob gave us
+    char **paths = argv + 2;
+    qsort(paths, count, sizeof(char *), compare_paths);
+    
+    FILE *out = fopen(argv[1], "w");
+    if (!out) {
+        perror(argv[1]);
+        return 1;
+    }
+    
+    fprintf(out, "// Generated by tools/embed_sounds from assets/sounds - do not edit.\n");
+    fprintf(out, "// 16-bit stereo PCM at %d Hz, sorted by file name.\n\n", ASSETS_SOUND_RATE);
+    fprintf(out, "#include \"assets.h\"\n");
+    
+    size_t total_frames = 0;
+    for (int i = 0; i < count; i++) {
+        const char *name = strrchr(paths[i], '/');
+        name = name ? name + 1 : paths[i];
+    
+        size_t frames;
+        int16_t *pcm = assets_decode_wav(paths[i], &frames);
+        if (!pcm) {
+            fclose(out);
+            remove(argv[1]);
+            return 1;
+        }
+    
+        char symbol[64];
+        symbol_name(name, symbol, sizeof(symbol));
+        fprintf(out, "\n// %s: %zu frames\n", name, frames);
+        fprintf(out, "static const int16_t sound_%s[%zu] = {", symbol, frames * 2);
+        for (size_t s = 0; s < frames * 2; s++) {
+            fprintf(out, "%s%d,", s % SAMPLES_PER_LINE ? " " : "\n    ", pcm[s]);
+        }
+        fprintf(out, "\n};\n");
+    
+        free(pcm);
+        total_frames += frames;
+        fprintf(stderr, "  🔊 %s -> %zu frames\n", name, frames);
+    }
+    
+    fprintf(out, "\nconst embedded_sound_t assets_embedded_sounds[%d] = {\n", count > 0 ? count : 1);
+    for (int i = 0; i < count; i++) {
+        const char *name = strrchr(paths[i], '/');
+        name = name ? name + 1 : paths[i];
+        char symbol[64];
+        symbol_name(name, symbol, sizeof(symbol));
+        fprintf(out, "    { \"%s\", sound_%s, sizeof(sound_%s) / (2 * sizeof(int16_t)) },\n",
+                name, symbol, symbol);
+    }
+    fprintf(out, "};\n\nconst int assets_embedded_count = %d;\n", count);
+    
+    if (fclose(out) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    
+    fprintf(stderr, "✅ Embedded %d sounds, %zu KB of PCM\n", count, total_frames * 4 / 1024);
+    return 0;
+}